@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include "kompute/Kompute.hpp"
+#include "kompute/shaders/shaderopmult.hpp"
+
+#include "kompute_benchmark/BenchmarkManager.hpp"
+
+namespace {
+
+std::vector<uint32_t>
+multSpirv()
+{
+    return std::vector<uint32_t>(
+      (uint32_t*)kp::shader_data::shaders_glsl_opmult_comp_spv,
+      (uint32_t*)(kp::shader_data::shaders_glsl_opmult_comp_spv +
+                  kp::shader_data::shaders_glsl_opmult_comp_spv_len));
+}
+
+std::vector<std::shared_ptr<kp::Tensor>>
+multTensors(kp::Manager& mgr, uint64_t size)
+{
+    return { mgr.tensor(kp::bench::data(size)),
+             mgr.tensor(kp::bench::data(size)),
+             mgr.tensor(kp::bench::data(size)) };
+}
+
+void
+destroyTensors(const std::vector<std::shared_ptr<kp::Tensor>>& tensors)
+{
+    for (const std::shared_ptr<kp::Tensor>& tensor : tensors) {
+        tensor->destroy();
+    }
+}
+
+}
+
+static void
+BM_AlgorithmCreate(benchmark::State& state)
+{
+    kp::Manager& mgr = kp::bench::manager();
+    std::vector<std::shared_ptr<kp::Tensor>> tensors = multTensors(mgr, 1);
+    std::vector<uint32_t> spirv = multSpirv();
+
+    // The shader module and pipeline come from the caches of the manager
+    // after the first iteration, as for the algorithms of an application
+    for (auto _ : state) {
+        std::shared_ptr<kp::Algorithm> algorithm =
+          mgr.algorithm<uint32_t, float>(
+            tensors, spirv, { 1, 1, 1 }, { 0, 0, 0 }, {});
+        benchmark::DoNotOptimize(algorithm.get());
+        algorithm->destroy();
+    }
+
+    destroyTensors(tensors);
+}
+BENCHMARK(BM_AlgorithmCreate);
+
+static void
+BM_DispatchRoundTrip(benchmark::State& state)
+{
+    kp::Manager& mgr = kp::bench::manager();
+    std::vector<std::shared_ptr<kp::Tensor>> tensors = multTensors(mgr, 1);
+    std::shared_ptr<kp::Algorithm> algorithm = mgr.algorithm<uint32_t, float>(
+      tensors, multSpirv(), { 1, 1, 1 }, { 0, 0, 0 }, {});
+    std::shared_ptr<kp::Sequence> sq =
+      mgr.sequence()->record<kp::OpAlgoDispatch>(algorithm);
+
+    // A single workgroup replayed from a recorded sequence, so the time is
+    // the latency of a submission and the wait for its fence
+    for (auto _ : state) {
+        sq->eval();
+    }
+
+    sq->destroy();
+    algorithm->destroy();
+    destroyTensors(tensors);
+}
+BENCHMARK(BM_DispatchRoundTrip)->UseRealTime();
+
+static void
+BM_SequenceEval(benchmark::State& state)
+{
+    kp::Manager& mgr = kp::bench::manager();
+    std::vector<std::shared_ptr<kp::Tensor>> tensors = multTensors(mgr, 1);
+    std::shared_ptr<kp::Algorithm> algorithm = mgr.algorithm<uint32_t, float>(
+      tensors, multSpirv(), { 1, 1, 1 }, { 0, 0, 0 }, {});
+    std::shared_ptr<kp::Sequence> sq = mgr.sequence();
+
+    // Records the operation again on every eval, so the difference with
+    // the round trip is the cost of recording
+    for (auto _ : state) {
+        sq->eval<kp::OpAlgoDispatch>(algorithm);
+    }
+
+    sq->destroy();
+    algorithm->destroy();
+    destroyTensors(tensors);
+}
+BENCHMARK(BM_SequenceEval)->UseRealTime();
+
+static void
+BM_OpMult(benchmark::State& state)
+{
+    kp::Manager& mgr = kp::bench::manager();
+    std::vector<std::shared_ptr<kp::Tensor>> tensors =
+      multTensors(mgr, state.range(0));
+    mgr.sequence()->eval<kp::OpTensorSyncDevice>(tensors);
+    std::shared_ptr<kp::Sequence> sq =
+      mgr.sequence()->record<kp::OpMult>(tensors, mgr.algorithm());
+
+    for (auto _ : state) {
+        sq->eval();
+    }
+
+    // Two inputs read and one output written per element
+    state.SetBytesProcessed(state.iterations() * 3 * state.range(0) *
+                            sizeof(float));
+    sq->destroy();
+    destroyTensors(tensors);
+}
+BENCHMARK(BM_OpMult)->RangeMultiplier(16)->Range(1 << 10, 1 << 24)->UseRealTime();
@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <kompute/Kompute.hpp>
+
+int
+main(int argc, char* argv[])
+{
+    // The report is also written as JSON unless another output is requested,
+    // so every run leaves a file to compare against a baseline
+    std::vector<char*> args(argv, argv + argc);
+    std::string out = "--benchmark_out=kompute_benchmark.json";
+    std::string outFormat = "--benchmark_out_format=json";
+    bool hasOut = false;
+    for (int i = 1; i < argc; i++) {
+        if (!strncmp(argv[i], "--benchmark_out=", strlen("--benchmark_out="))) {
+            hasOut = true;
+        }
+    }
+    if (!hasOut) {
+        args.push_back(&out[0]);
+        args.push_back(&outFormat[0]);
+    }
+    int count = args.size();
+
+    benchmark::Initialize(&count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(count, args.data())) {
+        return 1;
+    }
+
+#if KOMPUTE_ENABLE_SPDLOG
+    spdlog::set_level(spdlog::level::warn);
+#endif
+
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
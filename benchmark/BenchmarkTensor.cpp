@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include "kompute/Kompute.hpp"
+
+#include "kompute_benchmark/BenchmarkManager.hpp"
+
+static void
+BM_TensorCreate(benchmark::State& state)
+{
+    kp::Manager& mgr = kp::bench::manager();
+    std::vector<float> data = kp::bench::data(state.range(0));
+
+    for (auto _ : state) {
+        std::shared_ptr<kp::TensorT<float>> tensor = mgr.tensor(data);
+        benchmark::DoNotOptimize(tensor->rawData());
+        tensor->destroy();
+    }
+
+    state.SetBytesProcessed(state.iterations() * data.size() * sizeof(float));
+}
+BENCHMARK(BM_TensorCreate)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+static void
+BM_TensorRebuild(benchmark::State& state)
+{
+    kp::Manager& mgr = kp::bench::manager();
+    std::vector<float> data = kp::bench::data(state.range(0));
+    std::shared_ptr<kp::TensorT<float>> tensor = mgr.tensor(data);
+
+    // Rebuilds within the capacity keep the buffers, so this measures the
+    // update of the host data
+    for (auto _ : state) {
+        tensor->rebuild(data.data(), data.size(), sizeof(float));
+    }
+
+    state.SetBytesProcessed(state.iterations() * data.size() * sizeof(float));
+    tensor->destroy();
+}
+BENCHMARK(BM_TensorRebuild)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+static void
+BM_TensorRebuildGrow(benchmark::State& state)
+{
+    kp::Manager& mgr = kp::bench::manager();
+    std::vector<float> data = kp::bench::data(state.range(0));
+
+    // Each rebuild doubles the size past the capacity, so the buffers and
+    // memory are reallocated every time
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::shared_ptr<kp::TensorT<float>> tensor =
+          mgr.tensor(kp::bench::data(1));
+        state.ResumeTiming();
+
+        tensor->rebuild(data.data(), data.size(), sizeof(float));
+
+        state.PauseTiming();
+        tensor->destroy();
+        state.ResumeTiming();
+    }
+
+    state.SetBytesProcessed(state.iterations() * data.size() * sizeof(float));
+}
+BENCHMARK(BM_TensorRebuildGrow)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+static void
+BM_TensorSyncDevice(benchmark::State& state)
+{
+    kp::Manager& mgr = kp::bench::manager();
+    std::shared_ptr<kp::TensorT<float>> tensor =
+      mgr.tensor(kp::bench::data(state.range(0)));
+    std::shared_ptr<kp::Sequence> sq =
+      mgr.sequence()->record<kp::OpTensorSyncDevice>({ tensor });
+
+    for (auto _ : state) {
+        sq->eval();
+    }
+
+    state.SetBytesProcessed(state.iterations() * tensor->memorySize());
+    sq->destroy();
+    tensor->destroy();
+}
+BENCHMARK(BM_TensorSyncDevice)
+  ->RangeMultiplier(16)
+  ->Range(1 << 10, 1 << 24)
+  ->UseRealTime();
+
+static void
+BM_TensorSyncLocal(benchmark::State& state)
+{
+    kp::Manager& mgr = kp::bench::manager();
+    std::shared_ptr<kp::TensorT<float>> tensor =
+      mgr.tensor(kp::bench::data(state.range(0)));
+    mgr.sequence()->eval<kp::OpTensorSyncDevice>({ tensor });
+    std::shared_ptr<kp::Sequence> sq =
+      mgr.sequence()->record<kp::OpTensorSyncLocal>({ tensor });
+
+    for (auto _ : state) {
+        sq->eval();
+    }
+
+    state.SetBytesProcessed(state.iterations() * tensor->memorySize());
+    sq->destroy();
+    tensor->destroy();
+}
+BENCHMARK(BM_TensorSyncLocal)
+  ->RangeMultiplier(16)
+  ->Range(1 << 10, 1 << 24)
+  ->UseRealTime();
@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Kompute.hpp"
+
+namespace kp {
+namespace bench {
+
+/**
+ * Manager shared by all the benchmarks, so the creation of the instance and
+ * device is not part of what they measure.
+ *
+ * @return Reference to the manager, created on first use
+ */
+inline Manager&
+manager()
+{
+    static Manager mgr;
+    return mgr;
+}
+
+/**
+ * Float data of the size provided, to fill the tensors of the benchmarks.
+ *
+ * @param size Number of elements
+ * @return Vector of elements cycling through small values
+ */
+inline std::vector<float>
+data(uint64_t size)
+{
+    std::vector<float> values(size);
+    for (uint64_t i = 0; i < size; i++) {
+        values[i] = (float)(i % 13);
+    }
+    return values;
+}
+
+} // End namespace bench
+} // End namespace kp
@@ -1,5 +1,3 @@
-import time
-
 import kp
 import numpy as np
 from imp1_naive import MatMulOp as MatMulOp1
@@ -29,25 +27,29 @@ def main():
               f'{mat_2}\n')
         print(f'Output :\n{mat_result}')
 
+        op_count = tensor_shape[0] * tensor_shape[1] * ((tensor_shape[1] * 2) - 1)
+        bench = kp.benchmark.Benchmark(mgr, warmup=3, repetitions=experiment_count)
+
+        if tensor_size <= 512:
+            result = bench.run_host(lambda: mat_1 @ mat_2, flops=op_count)
+            print(f'From numpy : median matmul time : {result.median_ns / 1e6:0.2f}ms => '
+                  f'{result.gflops:0.2f} GFLOPS')
+
         for MatMulOp in [MatMulOp1, MatMulOp2, MatMulOp3]:
             tensor_out.data()[:] = 0
             mgr.sequence().record(kp.OpTensorSyncDevice([tensor_out]))
             matmul_op = MatMulOp(mgr)
             matmul_op(tensor_shape, tensor_in_1, tensor_in_2, tensor_out)
 
-            start_time = time.time()
-            for _ in range(experiment_count):
-                matmul_op(tensor_shape, tensor_in_1, tensor_in_2, tensor_out)
-            end_time = time.time()
-            experiment_time = end_time - start_time
-            op_count = tensor_shape[0] * tensor_shape[1] * ((tensor_shape[1] * 2) - 1)
+            # The dispatch alone is timed on the GPU, without the syncs
+            sq = mgr.sequence(0, 1).record(kp.OpAlgoDispatch(matmul_op.algo), "matmul")
+            result = bench.run(sq, flops=op_count, label="matmul")
 
             # print(tensor_out.data().reshape(tensor_shape))
             if (tensor_out.data().reshape(tensor_shape) == mat_result).all():
-                print(f'From {MatMulOp.__module__} : {experiment_count} matmul time : '
-                      f'{experiment_time * 1000:0.2f}ms => '
-                      f'{experiment_count / experiment_time:0.2f}op/s or '
-                      f'{experiment_count * op_count / (1e9 * experiment_time):0.2f} GFLOPS')
+                print(f'From {MatMulOp.__module__} : median matmul time : '
+                      f'{result.median_ns / 1e6:0.2f}ms (+/- {result.stddev_ns / 1e6:0.2f}ms) => '
+                      f'{result.gflops:0.2f} GFLOPS')
             else:
                 print(f'Test failed => output tensor is wrong :\n{tensor_out.data().reshape(tensor_shape)}')
 
@@ -0,0 +1,193 @@
+
+#include <kompute/Kompute.hpp>
+#include <pybind11/pybind11.h>
+
+// Structures of the DLPack ABI, as exchanged in the "dltensor" capsules of
+// the __dlpack__ protocol of numpy, PyTorch, CuPy and others
+extern "C" {
+typedef struct {
+    int32_t device_type;
+    int32_t device_id;
+} DLDevice;
+
+typedef struct {
+    uint8_t code;
+    uint8_t bits;
+    uint16_t lanes;
+} DLDataType;
+
+typedef struct {
+    void* data;
+    DLDevice device;
+    int32_t ndim;
+    DLDataType dtype;
+    int64_t* shape;
+    int64_t* strides;
+    uint64_t byte_offset;
+} DLTensor;
+
+typedef struct DLManagedTensor {
+    DLTensor dl_tensor;
+    void* manager_ctx;
+    void (*deleter)(struct DLManagedTensor* self);
+} DLManagedTensor;
+}
+
+namespace kp {
+namespace py {
+
+enum DLDeviceType { kDLCPU = 1, kDLCUDAHost = 3 };
+enum DLDataTypeCode { kDLInt = 0, kDLUInt = 1, kDLFloat = 2, kDLBool = 6 };
+
+static DLDataType dlDataType(const kp::Tensor::TensorDataTypes& dataType) {
+    switch (dataType) {
+    case kp::Tensor::TensorDataTypes::eBool:
+        return { kDLBool, 8, 1 };
+    case kp::Tensor::TensorDataTypes::eInt:
+        return { kDLInt, 32, 1 };
+    case kp::Tensor::TensorDataTypes::eUnsignedInt:
+        return { kDLUInt, 32, 1 };
+    case kp::Tensor::TensorDataTypes::eFloat:
+        return { kDLFloat, 32, 1 };
+    case kp::Tensor::TensorDataTypes::eDouble:
+        return { kDLFloat, 64, 1 };
+    case kp::Tensor::TensorDataTypes::eHalf:
+        return { kDLFloat, 16, 1 };
+    case kp::Tensor::TensorDataTypes::eInt8:
+        return { kDLInt, 8, 1 };
+    case kp::Tensor::TensorDataTypes::eUnsignedInt8:
+        return { kDLUInt, 8, 1 };
+    case kp::Tensor::TensorDataTypes::eInt16:
+        return { kDLInt, 16, 1 };
+    default:
+        throw std::runtime_error("Kompute Python data type not supported by DLPack");
+    }
+}
+
+static kp::Tensor::TensorDataTypes tensorDataType(const DLDataType& dtype) {
+    if (dtype.lanes == 1) {
+        const std::vector<kp::Tensor::TensorDataTypes> dataTypes = {
+            kp::Tensor::TensorDataTypes::eBool,  kp::Tensor::TensorDataTypes::eInt,
+            kp::Tensor::TensorDataTypes::eUnsignedInt, kp::Tensor::TensorDataTypes::eFloat,
+            kp::Tensor::TensorDataTypes::eDouble, kp::Tensor::TensorDataTypes::eHalf,
+            kp::Tensor::TensorDataTypes::eInt8, kp::Tensor::TensorDataTypes::eUnsignedInt8,
+            kp::Tensor::TensorDataTypes::eInt16,
+        };
+        for (const kp::Tensor::TensorDataTypes& dataType : dataTypes) {
+            DLDataType candidate = dlDataType(dataType);
+            if (candidate.code == dtype.code && candidate.bits == dtype.bits) {
+                return dataType;
+            }
+        }
+    }
+    throw std::runtime_error(fmt::format(
+      "Kompute Python DLPack dtype code {} bits {} lanes {} not supported",
+      dtype.code, dtype.bits, dtype.lanes));
+}
+
+/**
+ * Copies the elements of a strided array into a contiguous destination, in
+ * row major order, one innermost row at a time when its elements are
+ * contiguous.
+ */
+static void copyStrided(uint8_t* dst,
+                        const uint8_t* src,
+                        const std::vector<int64_t>& shape,
+                        const std::vector<int64_t>& byteStrides,
+                        size_t elementSize) {
+    size_t ndim = shape.size();
+    uint64_t count = 1;
+    for (int64_t extent : shape) {
+        count *= extent;
+    }
+    if (count == 0) {
+        return;
+    }
+    if (ndim == 0) {
+        memcpy(dst, src, elementSize);
+        return;
+    }
+
+    int64_t rowLength = shape[ndim - 1];
+    bool rowContiguous = byteStrides[ndim - 1] == (int64_t)elementSize;
+    std::vector<int64_t> index(ndim, 0);
+    for (uint64_t row = 0; row < count / rowLength; row++) {
+        const uint8_t* rowSrc = src;
+        for (size_t d = 0; d + 1 < ndim; d++) {
+            rowSrc += index[d] * byteStrides[d];
+        }
+        if (rowContiguous) {
+            memcpy(dst, rowSrc, rowLength * elementSize);
+        } else {
+            for (int64_t i = 0; i < rowLength; i++) {
+                memcpy(dst + i * elementSize, rowSrc + i * byteStrides[ndim - 1], elementSize);
+            }
+        }
+        dst += rowLength * elementSize;
+
+        for (size_t d = ndim - 1; d-- > 0;) {
+            if (++index[d] < shape[d]) {
+                break;
+            }
+            index[d] = 0;
+        }
+    }
+}
+
+/**
+ * Whether strided elements are laid out contiguously in row major order, in
+ * which case they can be read with a single copy or imported as they are.
+ */
+static bool isContiguous(const std::vector<int64_t>& shape,
+                         const std::vector<int64_t>& byteStrides,
+                         size_t elementSize) {
+    int64_t expected = elementSize;
+    for (size_t d = shape.size(); d-- > 0;) {
+        if (shape[d] != 1 && byteStrides[d] != expected) {
+            return false;
+        }
+        expected *= shape[d];
+    }
+    return true;
+}
+
+/**
+ * Creates a tensor from strided host data with a single copy. Contiguous data
+ * is copied by the tensor itself, or imported when the host memory type is
+ * eImported, while other layouts are gathered straight into the mapped host
+ * memory of the tensor instead of through an intermediate contiguous array.
+ * The data must outlive the tensor when it was imported.
+ */
+static std::shared_ptr<kp::Tensor> tensorFromStrided(
+  kp::Manager& manager,
+  const void* data,
+  const std::vector<int64_t>& shape,
+  const std::vector<int64_t>& byteStrides,
+  const kp::Tensor::TensorDataTypes& dataType,
+  kp::Tensor::TensorTypes tensorType,
+  kp::Tensor::HostMemoryTypes hostMemoryType) {
+
+    uint32_t elementMemorySize = kp::Tensor::elementMemorySize(dataType);
+    uint64_t count = 1;
+    for (int64_t extent : shape) {
+        count *= extent;
+    }
+
+    if (isContiguous(shape, byteStrides, elementMemorySize)) {
+        return manager.tensor(
+          (void*)data, count, elementMemorySize, dataType, tensorType, hostMemoryType);
+    }
+
+    KP_LOG_DEBUG("Kompute Python gathering strided data of {} elements into mapped memory", count);
+
+    std::shared_ptr<kp::Tensor> tensor = manager.tensor(
+      count, dataType, tensorType, false, hostMemoryType);
+    // Storage tensors have no host memory, and ignore their data as well
+    if (tensor->rawData()) {
+        copyStrided((uint8_t*)tensor->rawData(), (const uint8_t*)data, shape, byteStrides,
+                    elementMemorySize);
+    }
+    return tensor;
+}
+}
+}
@@ -43,6 +43,20 @@ use when initializing the pipeline, which set the size of the push
 constants - these can be modified but all new values must have the
 same vector size as this initial value.)doc";
 
+static const char *__doc_kp_Algorithm_BindingModes =
+R"doc(How the tensors of the algorithm are passed to its shader.)doc";
+
+static const char *__doc_kp_Algorithm_BindingModes_eDescriptors =
+R"doc(Bound to one descriptor set, a binding each)doc";
+
+static const char *__doc_kp_Algorithm_BindingModes_eDeviceAddresses =
+R"doc(Addresses at the start of the push constants)doc";
+
+static const char *__doc_kp_Algorithm_bindingMode =
+R"doc(Retrieve how the tensors of the algorithm are passed to its shader.
+
+@return The binding mode the algorithm was created with)doc";
+
 static const char *__doc_kp_Algorithm_createParameters = R"doc()doc";
 
 static const char *__doc_kp_Algorithm_createPipeline = R"doc()doc";
@@ -51,11 +65,24 @@ static const char *__doc_kp_Algorithm_createShaderModule = R"doc()doc";
 
 static const char *__doc_kp_Algorithm_destroy = R"doc()doc";
 
+static const char *__doc_kp_Algorithm_getLocalSizeX =
+R"doc(Gets the local size the local_size_x_id of the shader was specialized
+with, which the group count of automatic workgroups is based on.
+
+@returns The specialized local size, or 0 if the local size of the
+shader is not specialized by the algorithm)doc";
+
 static const char *__doc_kp_Algorithm_getPush =
 R"doc(Gets the specialization constants of the current algorithm.
 
 @returns The std::vector<float> currently set for push constants)doc";
 
+static const char *__doc_kp_Algorithm_getSpirv =
+R"doc(Gets the SPIR-V the algorithm was built from, which allows rebuilding
+it with other workgroups or specialization constants.
+
+@returns The SPIR-V of the shader of the algorithm.)doc";
+
 static const char *__doc_kp_Algorithm_getSpecializationConstants =
 R"doc(Gets the specialization constants of the current algorithm.
 
@@ -119,6 +146,12 @@ static const char *__doc_kp_Algorithm_mTensors = R"doc()doc";
 
 static const char *__doc_kp_Algorithm_mWorkgroup = R"doc()doc";
 
+static const char *__doc_kp_Algorithm_name =
+R"doc(Retrieve the name of the algorithm set with setName.
+
+Returns:
+    Name of the algorithm, empty if it was not named)doc";
+
 static const char *__doc_kp_Algorithm_rebuild =
 R"doc(Rebuild function to reconstruct algorithm with configuration
 parameters to create the underlying resources.
@@ -136,7 +169,9 @@ size as this initial value.)doc";
 
 static const char *__doc_kp_Algorithm_recordBindCore =
 R"doc(Records command that binds the "core" algorithm components which
-consist of binding the pipeline and binding the descriptorsets.
+consist of binding the pipeline and binding the descriptorsets. The
+descriptors are refreshed first if any of the tensors has been rebuilt
+since they were last written.
 
 @param commandBuffer Command buffer to record the algorithm resources
 to)doc";
@@ -149,6 +184,17 @@ same size as the ones provided during initialization.
 @param commandBuffer Command buffer to record the algorithm resources
 to)doc";
 
+static const char *__doc_kp_Algorithm_recordPushConstants =
+R"doc(Records command that binds push constants provided as raw memory
+instead of the push constants stored in the algorithm, which allows
+recording several dispatches with different push constants without
+updating the algorithm in between.
+
+@param commandBuffer Command buffer to record the algorithm resources
+to @param data The raw data of the push constants @param size The size
+of the data in bytes, which has to be the memory size of the push
+constants provided during initialization)doc";
+
 static const char *__doc_kp_Algorithm_recordDispatch =
 R"doc(Records the dispatch function with the provided template parameters or
 alternatively using the size of the tensor by default.
@@ -156,6 +202,25 @@ alternatively using the size of the tensor by default.
 @param commandBuffer Command buffer to record the algorithm resources
 to)doc";
 
+static const char *__doc_kp_Algorithm_recordDispatch_2 =
+R"doc(Records a dispatch with the workgroup counts provided instead of the
+workgroup of the algorithm, which allows the passes of a multi pass
+operation to dispatch different grids of the same pipeline.
+
+@param commandBuffer Command buffer to record the algorithm resources
+to @param workgroup The workgroup counts of the dispatch, which are
+used as they are so a count of zero records an empty dispatch)doc";
+
+static const char *__doc_kp_Algorithm_setName =
+R"doc(Sets the name of the algorithm, which names its pipeline, pipeline
+layout and descriptor set through VK_EXT_debug_utils so they can be
+identified in captures of debugging and profiling tools. The resources
+keep the name through rebuilds. Pipelines shared through the shader
+cache take the name of the last algorithm named.
+
+Parameter ``name``:
+    The name of the algorithm)doc";
+
 static const char *__doc_kp_Algorithm_setPush =
 R"doc(Sets the push constants to the new value provided to use in the next
 bindPush()
@@ -164,6 +229,15 @@ bindPush()
 next bindPush(...) calls. The constants provided must be of the same
 size as the ones created during initialization.)doc";
 
+static const char *__doc_kp_Algorithm_setTensors =
+R"doc(Binds other tensors to the algorithm by rewriting its descriptor set,
+keeping the shader module and pipeline. The tensors must match the
+number of bindings and the descriptor type of each binding. Sequences
+that recorded the algorithm must not be running, and need to be
+recorded again to use the new tensors.
+
+@param tensors The tensors to bind, one per binding)doc";
+
 static const char *__doc_kp_Algorithm_setWorkgroup =
 R"doc(Sets the work group to use in the recordDispatch
 
@@ -172,10 +246,540 @@ algorithm. It must have a value greater than 1 on the x value (index
 1) otherwise it will be initialized on the size of the first tensor
 (ie. this->mTensor[0]->size()))doc";
 
+static const char *__doc_kp_Benchmark =
+R"doc(Harness timing the operations of sequences with their GPU timestamps
+rather than the wall clock, so the time of the submission and of the
+wait for completion are left out. Each run evaluates the sequence a
+number of times to warm up the caches and clocks of the device, then a
+number of repetitions whose times are summarised, along with the
+GFLOP/s and GB/s achieved and their fraction of the peak of the device.
+
+Vulkan reports neither the peak arithmetic rate nor the peak bandwidth
+of a device, so the peak bandwidth is measured with buffer copies, and
+the peak arithmetic rate is provided by the user, such as from the
+datasheet of the device.)doc";
+
+static const char *__doc_kp_Benchmark_Benchmark =
+R"doc(Constructor for a harness of the device of a manager.
+
+Parameter ``manager``:
+    The manager creating the resources of the peak bandwidth
+    measurement
+
+Parameter ``warmup``:
+    Number of evaluations before the timed ones
+
+Parameter ``repetitions``:
+    Number of timed evaluations, at least 1)doc";
+
+static const char *__doc_kp_Benchmark_Result = R"doc(Summary of the times of the repetitions of a run.)doc";
+
+static const char *__doc_kp_Benchmark_Result_gbps = R"doc(At the median time, 0 without bytes)doc";
+
+static const char *__doc_kp_Benchmark_Result_gflops = R"doc(At the median time, 0 without flops)doc";
+
+static const char *__doc_kp_Benchmark_Result_label = R"doc(Operations timed, all if empty)doc";
+
+static const char *__doc_kp_Benchmark_Result_maxNs = R"doc(Slowest repetition)doc";
+
+static const char *__doc_kp_Benchmark_Result_meanNs = R"doc(Mean of the repetitions)doc";
+
+static const char *__doc_kp_Benchmark_Result_medianNs = R"doc(Median repetition)doc";
+
+static const char *__doc_kp_Benchmark_Result_minNs = R"doc(Fastest repetition)doc";
+
+static const char *__doc_kp_Benchmark_Result_peakGbpsFraction = R"doc(Of gbps, 0 without a peak)doc";
+
+static const char *__doc_kp_Benchmark_Result_peakGflopsFraction = R"doc(Of gflops, 0 without a peak)doc";
+
+static const char *__doc_kp_Benchmark_Result_repetitions = R"doc(Number of times summarised)doc";
+
+static const char *__doc_kp_Benchmark_Result_stddevNs = R"doc(Standard deviation of the repetitions)doc";
+
+static const char *__doc_kp_Benchmark_mManager = R"doc()doc";
+
+static const char *__doc_kp_Benchmark_mPeakGbps = R"doc()doc";
+
+static const char *__doc_kp_Benchmark_mPeakGflops = R"doc()doc";
+
+static const char *__doc_kp_Benchmark_mRepetitions = R"doc()doc";
+
+static const char *__doc_kp_Benchmark_mWarmup = R"doc()doc";
+
+static const char *__doc_kp_Benchmark_measurePeakBandwidth =
+R"doc(Measures the peak bandwidth of the device by timing copies between two
+device tensors, counting the bytes read and written, and uses it as the
+peak of the results of later runs.
+
+Parameter ``bytes``:
+    Size of the tensors copied
+
+Returns:
+    The bandwidth measured, in GB/s)doc";
+
+static const char *__doc_kp_Benchmark_peakGbps =
+R"doc(Peak bandwidth the results are compared against.
+
+Returns:
+    GB/s, or 0 if unknown)doc";
+
+static const char *__doc_kp_Benchmark_peakGflops =
+R"doc(Peak arithmetic rate the results are compared against.
+
+Returns:
+    GFLOP/s, or 0 if unknown)doc";
+
+static const char *__doc_kp_Benchmark_run =
+R"doc(Times a sequence already recorded, which must have been created with
+at least as many timestamps as operations. The time of a repetition is
+the sum of the GPU time of the operations with the label provided,
+which lets the sync operations of the sequence be left out.
+
+Parameter ``sequence``:
+    The sequence to evaluate
+
+Parameter ``flops``:
+    Floating point operations of an evaluation, for GFLOP/s
+
+Parameter ``bytes``:
+    Bytes read and written by an evaluation, for GB/s
+
+Parameter ``label``:
+    (Optional) Label of the operations to time, given when they were
+    recorded, or all the operations if empty
+
+Returns:
+    Summary of the times of the repetitions)doc";
+
+static const char *__doc_kp_Benchmark_runHost =
+R"doc(Times a function running on the host with the wall clock, with the
+same warmup and repetitions as the sequences, to compare the device
+against a host implementation such as numpy.
+
+Parameter ``function``:
+    The function to time
+
+Parameter ``flops``:
+    Floating point operations of a call, for GFLOP/s
+
+Parameter ``bytes``:
+    Bytes read and written by a call, for GB/s
+
+Returns:
+    Summary of the times of the repetitions, without the fractions of
+    the peak of the device)doc";
+
+static const char *__doc_kp_Benchmark_setPeak =
+R"doc(Sets the peaks the results of later runs are compared against.
+
+Parameter ``gflops``:
+    Peak arithmetic rate in GFLOP/s, or 0 if unknown
+
+Parameter ``gbps``:
+    Peak bandwidth in GB/s, or 0 if unknown)doc";
+
+static const char *__doc_kp_Benchmark_summarize = R"doc()doc";
+
+static const char *__doc_kp_Block =
+R"doc(Block of operations recorded once into a secondary command buffer,
+which can then be recorded into any number of sequences as a single
+operation that executes the secondary command buffer. This allows
+composing sequences out of prebuilt blocks without recording their
+operations again.
+
+Each block owns its command pool, so separate blocks can be recorded
+in parallel from different threads as long as they do not share
+algorithms. The barriers between the operations of the block are
+recorded within the block, and the block acts as an operation with
+undeclared accesses in the sequences it is recorded into.)doc";
+
+static const char *__doc_kp_Block_Block =
+R"doc(Main constructor for the block which creates its command pool and
+secondary command buffer.
+
+@param device Vulkan logical device @param queueIndex Index of the
+queue family of the sequences the block will be recorded into)doc";
+
+static const char *__doc_kp_Block_begin =
+R"doc(Begins recording the secondary command buffer, discarding the
+operations the block contained.)doc";
+
+static const char *__doc_kp_Block_destroy =
+R"doc(Destroys and frees the GPU resources which include the secondary
+command buffer and the command pool. Sequences containing the block
+must have completed.)doc";
+
+static const char *__doc_kp_Block_end =
+R"doc(Ends recording the secondary command buffer. This is called when the
+block is recorded into a sequence, so it only needs to be called
+explicitly before recording the block from another thread.)doc";
+
+static const char *__doc_kp_Block_isInit =
+R"doc(Returns true if the block has been initialised, and it's based on the
+GPU resources being referenced.
+
+@return Boolean stating if is initialized)doc";
+
+static const char *__doc_kp_Block_isRecording =
+R"doc(Returns true if the block is currently in recording activated.
+
+@return Boolean stating if recording ongoing.)doc";
+
+static const char *__doc_kp_Block_operationCount =
+R"doc(Returns the number of operations recorded into the block.
+
+@return Number of operations of the block)doc";
+
+static const char *__doc_kp_Block_postEval =
+R"doc(Runs the postEval of all the operations of the block.
+
+@param commandBuffer The command buffer to record the command into.)doc";
+
+static const char *__doc_kp_Block_preEval =
+R"doc(Runs the preEval of all the operations of the block.
+
+@param commandBuffer The command buffer to record the command into.)doc";
+
+static const char *__doc_kp_Block_record =
+R"doc(Record function for operation to be added to the block. If the block
+is not recording it begins recording, discarding the operations it
+contained. Sequences that contain the block need to be re-recorded
+after the block is recorded again, and must not be running.
+
+@param op Object derived from kp::BaseOp that will be recorded by the
+block. @return shared_ptr<Block> of the Block class itself)doc";
+
+static const char *__doc_kp_Block_record_2 =
+R"doc(Record function for operation to be added to the block.
+
+@param tensors Vector of tensors to use for the operation @param TArgs
+Template parameters that are used to initialise operation which allows
+for extensible configurations on initialisation. @return
+shared_ptr<Block> of the Block class itself)doc";
+
+static const char *__doc_kp_Block_record_3 =
+R"doc(Record function for operation to be added to the block.
+
+@param algorithm Algorithm to use for the record often used for OpAlgo
+operations @param TArgs Template parameters that are used to
+initialise operation which allows for extensible configurations on
+initialisation. @return shared_ptr<Block> of the Block class itself)doc";
+
+static const char *__doc_kp_Block_record_4 =
+R"doc(Records the execution of the secondary command buffer of the block,
+ending its recording if required.
+
+@param commandBuffer The command buffer to record the command into.)doc";
+
+static const char *__doc_kp_Expression =
+R"doc(Elementwise expression over float tensors of the same size, built with
+the arithmetic operators and the functions of this header, which
+OpExpression evaluates in a single fused dispatch instead of one
+dispatch and one intermediate tensor per operation.
+
+The GLSL of an expression is generated from its signature, which
+identifies the operations and the positions of the tensors and constants
+but not which tensors or constant values are used, and compiled in the
+process by kp::Shader, which caches the SPIR-V by source. Expressions
+with the same structure then share the same SPIR-V, and the pipeline of
+the ShaderCache of the manager. The constants are passed as push
+constants. Compiling requires Kompute to be built with
+KOMPUTE_OPT_ENABLE_SHADER_COMPILER, unless the SPIR-V is already in the
+on-disk cache of kp::Shader.)doc";
+
+static const char *__doc_kp_Expression_Expression =
+R"doc(Constructor of an expression reading the elements of a tensor, which
+also converts tensors to expressions in the operators.
+
+@param tensor The float tensor to read)doc";
+
+static const char *__doc_kp_Expression_Expression_2 =
+R"doc(Constructor of an expression reading the elements of a tensor.
+
+@param tensor The float tensor to read)doc";
+
+static const char *__doc_kp_Expression_Expression_3 =
+R"doc(Constructor of a constant expression, whose value is passed as a push
+constant.
+
+@param constant The value of the constant)doc";
+
+static const char *__doc_kp_Expression_Expression_4 =
+R"doc(Constructor of an operation on one or two expressions.
+
+@param operation The operation of the node @param left The first
+operand @param right The second operand of binary operations)doc";
+
+static const char *__doc_kp_Expression_Expression_5 = R"doc()doc";
+
+static const char *__doc_kp_Expression_Node = R"doc()doc";
+
+static const char *__doc_kp_Expression_Node_constant = R"doc()doc";
+
+static const char *__doc_kp_Expression_Node_left = R"doc()doc";
+
+static const char *__doc_kp_Expression_Node_operation = R"doc()doc";
+
+static const char *__doc_kp_Expression_Node_right = R"doc()doc";
+
+static const char *__doc_kp_Expression_Node_tensor = R"doc()doc";
+
+static const char *__doc_kp_Expression_Operation =
+R"doc(Operation of a node of the expression.)doc";
+
+static const char *__doc_kp_Expression_Operation_eAbs = R"doc()doc";
+
+static const char *__doc_kp_Expression_Operation_eAdd = R"doc()doc";
+
+static const char *__doc_kp_Expression_Operation_eConstant = R"doc()doc";
+
+static const char *__doc_kp_Expression_Operation_eDivide = R"doc()doc";
+
+static const char *__doc_kp_Expression_Operation_eExp = R"doc()doc";
+
+static const char *__doc_kp_Expression_Operation_eLog = R"doc()doc";
+
+static const char *__doc_kp_Expression_Operation_eMax = R"doc()doc";
+
+static const char *__doc_kp_Expression_Operation_eMin = R"doc()doc";
+
+static const char *__doc_kp_Expression_Operation_eMultiply = R"doc()doc";
+
+static const char *__doc_kp_Expression_Operation_eNegate = R"doc()doc";
+
+static const char *__doc_kp_Expression_Operation_eSqrt = R"doc()doc";
+
+static const char *__doc_kp_Expression_Operation_eSubtract = R"doc()doc";
+
+static const char *__doc_kp_Expression_Operation_eTensor = R"doc()doc";
+
+static const char *__doc_kp_Expression_constants =
+R"doc(Returns the values of the constants of the expression, in the order of
+their push constants.
+
+@return The constants of the expression)doc";
+
+static const char *__doc_kp_Expression_glsl =
+R"doc(Returns the GLSL of a compute shader that evaluates the expression into
+the tensor at binding 0, with one invocation per element and the local
+size x specialized through the specialization constant 0.
+
+@return The GLSL source of the fused shader)doc";
+
+static const char *__doc_kp_Expression_mNode = R"doc()doc";
+
+static const char *__doc_kp_Expression_signature =
+R"doc(Returns the signature of the expression, such as mul(t0,add(t1,c0))
+where t are the distinct tensors and c the constants.
+
+@return The signature of the expression)doc";
+
+static const char *__doc_kp_Expression_spirv =
+R"doc(Returns the SPIR-V of the shader of glsl, compiled through
+kp::Shader::compile the first time a signature is used and then served
+from its cache.
+
+@return The SPIR-V of the fused shader)doc";
+
+static const char *__doc_kp_Expression_tensors =
+R"doc(Returns the distinct tensors read by the expression, in the order they
+are first read which is the order of their bindings after the output.
+
+@return The tensors of the expression)doc";
+
+static const char *__doc_kp_Graph =
+R"doc(Graph of operations whose dependencies are derived from the tensors
+they read and write, compiled into sequences spread across several
+queues and replayed without recording them again while the graph does
+not change.
+
+Each operation depends on the last operation writing a tensor it reads
+or writes, and on the operations reading a tensor it writes since the
+last write. The operations are assigned to the queues so that chains of
+dependent operations stay on one queue, and independent chains run on
+different queues. The operations of a queue are split into sequences
+where they wait for or are waited on by another queue, and the
+sequences depending on each other are chained with timeline semaphores.
+The barriers within a sequence are recorded from the accesses of the
+operations.)doc";
+
+static const char *__doc_kp_Graph_Graph =
+R"doc(Constructor from the queues to spread the operations across.
+
+@param queueIndices The indices of the queues the operations can run
+on, all of which must support compute @param sequenceFactory The
+function creating the sequences of the compiled graph)doc";
+
+static const char *__doc_kp_Graph_add =
+R"doc(Adds an operation reading and writing the tensors provided, after the
+operations added before. The graph is compiled again on its next run.
+
+@param op The operation to add @param inputs The tensors read by the
+operation @param outputs The tensors written by the operation @return
+Index of the operation in the graph)doc";
+
+static const char *__doc_kp_Graph_add_2 =
+R"doc(Adds an operation whose inputs and outputs are the tensors of the
+accesses it declares, the tensors with a write access being outputs.
+
+@param op The operation to add, which must declare its accesses
+@return Index of the operation in the graph)doc";
+
+static const char *__doc_kp_Graph_await = R"doc(Waits for the run in flight, if any, to complete.)doc";
+
+static const char *__doc_kp_Graph_compile =
+R"doc(Assigns the operations to the queues and records the sequences of the
+graph, waiting for the run in flight first. Called by run when the
+graph changed since it was last compiled.)doc";
+
+static const char *__doc_kp_Graph_compileCount =
+R"doc(Returns the number of times the sequences of the graph were recorded,
+which only increases when the graph changed between runs.
+
+@return Number of compiles)doc";
+
+static const char *__doc_kp_Graph_dependencies =
+R"doc(Returns the indices of the operations each operation depends on.
+
+@param operationIndex The index of the operation @return Indices of
+the operations it depends on)doc";
+
+static const char *__doc_kp_Graph_destroy =
+R"doc(Waits for the run in flight and releases the operations and sequences
+of the graph.)doc";
+
+static const char *__doc_kp_Graph_isCompiled =
+R"doc(Checks whether the graph has been compiled since its last change.
+
+@return Boolean stating whether the graph is compiled)doc";
+
+static const char *__doc_kp_Graph_operationCount =
+R"doc(Returns the number of operations added to the graph.
+
+@return Number of operations)doc";
+
+static const char *__doc_kp_Graph_operationQueues =
+R"doc(Returns the queue each operation was assigned to by the last compile.
+
+@return Index of the queue of each operation, from the queue indices
+of the graph)doc";
+
+static const char *__doc_kp_Graph_run = R"doc(Runs the graph and waits for it to complete.)doc";
+
+static const char *__doc_kp_Graph_runAsync =
+R"doc(Submits the sequences of the graph, compiling it first if it changed.
+A previous run still in flight is awaited first.)doc";
+
+static const char *__doc_kp_Graph_sequenceCount =
+R"doc(Returns the number of sequences the graph was compiled into.
+
+@return Number of sequences)doc";
+
+static const char *__doc_kp_HostAllocator =
+R"doc(Host allocation callbacks passed to every Vulkan create and destroy
+call of the components created by a manager, which track the memory
+the driver allocates on the host so it can be measured around any
+operation.
+
+The allocations are served by the heap, or by the callbacks provided
+by the user, such as those of an engine's own allocator. Allocations
+with the command scope, which only live during a single Vulkan command
+such as a pipeline creation or a submission, can be served by a bump
+arena instead, whose offset is rewound once all of them are freed.)doc";
+
+static const char *__doc_kp_HostAllocator_HostAllocator =
+R"doc(Constructor for an allocator over the heap.
+
+Parameter ``arenaSize``:
+    Size of the arena of the command scope allocations, or 0 to serve
+    them from the heap)doc";
+
+static const char *__doc_kp_HostAllocator_HostAllocator_2 =
+R"doc(Constructor for an allocator forwarding to callbacks provided by the
+user, which are tracked the same way. The internal allocation
+notifications are forwarded as well.
+
+Parameter ``callbacks``:
+    The callbacks the allocations are forwarded to, which must outlive
+    the allocator
+
+Parameter ``arenaSize``:
+    Size of the arena of the command scope allocations, or 0 to forward
+    them too)doc";
+
+static const char *__doc_kp_HostAllocator_Stats = R"doc(Values of the counters of the allocator at a point in time.)doc";
+
+static const char *__doc_kp_HostAllocator_allocationCallbacks =
+R"doc(The callbacks passed to Vulkan, pointing to this allocator.
+
+Returns:
+    Reference to the callbacks of the allocator)doc";
+
+static const char *__doc_kp_HostAllocator_callbacks =
+R"doc(The callbacks of an allocator in the form taken by the Vulkan create
+and destroy calls, used by the components for their own objects.
+
+Parameter ``hostAllocator``:
+    The allocator, which can be null
+
+Returns:
+    The callbacks, or null for the default allocation of the driver)doc";
+
+static const char *__doc_kp_HostAllocator_resetStats =
+R"doc(Sets the cumulative counters back to zero and the peak back to the
+live bytes, for example before the operation to measure.)doc";
+
+static const char *__doc_kp_HostAllocator_stats =
+R"doc(Reads the counters. They are read one after the other, so the stats
+may miss the allocations made while they are read.
+
+Returns:
+    The values of the counters)doc";
+
 static const char *__doc_kp_Manager =
 R"doc(Base orchestrator which creates and manages device and child
 components)doc";
 
+static const char *__doc_kp_Manager_QueueRole =
+R"doc(Role of a queue of the manager, which selects the queue a sequence is
+submitted to without knowing the queue families of the device. A role
+without a dedicated queue family falls back to the compute queue.)doc";
+
+static const char *__doc_kp_Manager_QueueRole_eAsyncCompute = R"doc(Compute queue family without graphics)doc";
+
+static const char *__doc_kp_Manager_QueueRole_eCompute = R"doc(First queue family supporting compute)doc";
+
+static const char *__doc_kp_Manager_QueueRole_eHighPriority = R"doc(Compute queue with the highest priority)doc";
+
+static const char *__doc_kp_Manager_QueueRole_eTransfer = R"doc(Transfer queue family without compute)doc";
+
+static const char *__doc_kp_Manager_QueuePriority =
+R"doc(Priority of a queue requested by the manager. The priority orders the
+queues of the device, while the global priority orders the queues of
+the device against the queues of other processes, and is requested
+through VK_KHR_global_priority or VK_EXT_global_priority when the
+device supports one of them. Vulkan applies the global priority to a
+queue family, so a family gets the highest global priority among its
+queues.)doc";
+
+static const char *__doc_kp_Manager_QueuePriority_globalPriority = R"doc(Relative to other processes)doc";
+
+static const char *__doc_kp_Manager_QueuePriority_priority = R"doc(From 0 to 1, relative to the device queues)doc";
+
+static const char *__doc_kp_Manager_DeviceRequirements =
+R"doc(Requirements of the physical device to select by capabilities rather
+than by index, see Manager::selectDevice.)doc";
+
+static const char *__doc_kp_Manager_DeviceRequirements_allowCpu = R"doc(Whether CPU devices such as llvmpipe count)doc";
+
+static const char *__doc_kp_Manager_DeviceRequirements_extensions = R"doc(Required, and enabled)doc";
+
+static const char *__doc_kp_Manager_DeviceRequirements_features = R"doc(Features set are required)doc";
+
+static const char *__doc_kp_Manager_DeviceRequirements_minSubgroupSize = R"doc(Minimum subgroup size)doc";
+
+static const char *__doc_kp_Manager_DeviceRequirements_subgroupOperations = R"doc(Required in compute)doc";
+
 static const char *__doc_kp_Manager_Manager =
 R"doc(Base constructor and default used which creates the base resources
 including choosing the device 0 by default.)doc";
@@ -186,17 +790,54 @@ use when creating the Vulkan resources.
 
 @param physicalDeviceIndex The index of the physical device to use
 @param familyQueueIndices (Optional) List of queue indices to add for
-explicit allocation @param desiredExtensions The desired extensions to
-load from physicalDevice)doc";
+explicit allocation. If empty, a queue of the first compute family is
+created along with a queue of the dedicated compute family and of the
+transfer only family when the device has them, see QueueRole @param
+desiredExtensions The desired extensions to load from physicalDevice
+@param pipelineCachePath (Optional) File
+previously written by savePipelineCache to preload the pipeline cache
+from, which is ignored if missing or created for a different device
+@param queuePriorities (Optional) Priority of each queue, in the order
+of the family queue indices or of the queues created by default. If
+empty, every queue has a priority of 1 and the default global priority
+@param hostAllocator (Optional) Host allocation callbacks to create and
+destroy every Vulkan object of the manager and its components with,
+including the instance and the device)doc";
 
 static const char *__doc_kp_Manager_Manager_3 =
+R"doc(Constructor selecting the physical device with the highest score for
+the requirements provided, instead of a device index, see
+selectDevice. The extensions of the requirements are enabled on the
+device.
+
+@param requirements The requirements of the physical device to select
+@param familyQueueIndices (Optional) List of queue indices to add for
+explicit allocation, see the constructor with a device index @param
+desiredExtensions The desired extensions to load from physicalDevice
+in addition to the required ones @param pipelineCachePath (Optional)
+File previously written by savePipelineCache to preload the pipeline
+cache from @param queuePriorities (Optional) Priority of each queue,
+see the constructor with a device index @param hostAllocator
+(Optional) Host allocation callbacks to create and destroy every
+Vulkan object of the manager and its components with, including the
+instance and the device)doc";
+
+static const char *__doc_kp_Manager_Manager_4 =
 R"doc(Manager constructor which allows your own vulkan application to
 integrate with the kompute use.
 
 @param instance Vulkan compute instance to base this application
 @param physicalDevice Vulkan physical device to use for application
 @param device Vulkan logical device to use for all base resources
-@param physicalDeviceIndex Index for vulkan physical device used)doc";
+@param physicalDeviceIndex Index for vulkan physical device used
+@param pipelineCachePath (Optional) File previously written by
+savePipelineCache to preload the pipeline cache from
+@param hostAllocator (Optional) Host allocation callbacks to create and
+destroy every Vulkan object of the manager and its components with,
+which should be the callbacks the device was created with
+@param enabledFeatures (Optional) Core features the device was created
+with, such as pipelineStatisticsQuery for the pipeline statistics of
+sequences. Features left out are treated as disabled.)doc";
 
 static const char *__doc_kp_Manager_algorithm =
 R"doc(Create a managed algorithm that will be destroyed by this manager if
@@ -211,6 +852,31 @@ defaults to an empty constant @param pushConstants (optional)
 kp::Constant to use for push constants, and defaults to an empty
 constant @returns Shared pointer with initialised algorithm)doc";
 
+static const char *__doc_kp_Manager_algorithmAsync =
+R"doc(Create a managed algorithm like algorithm, whose resources are created
+and its pipeline compiled on a pool of worker threads owned by the
+manager, so many algorithms can be compiled in parallel. The algorithm
+is returned right away, and its functions block until it is built the
+first time they are called, rethrowing the exception of the build if
+it failed.
+
+@param tensors The tensors to initialise the algorithm with @param
+spirv The spirv bytes for the shader to run @param workgroup
+(optional) kp::Workgroup for number of dispatches @param
+specializationConstants (optional) templatable vector parameter to use
+for specialization constants, and defaults to an empty constant
+@param pushConstants (optional) templatable vector parameter to use
+for push constants, and defaults to an empty constant @returns Shared
+pointer with the algorithm being built)doc";
+
+static const char *__doc_kp_Manager_block =
+R"doc(Create a managed block of operations recorded into a secondary
+command buffer, which can be recorded into the sequences of the same
+queue without recording its operations again.
+
+@param queueIndex The queue of the sequences the block is recorded
+into @returns Shared pointer with initialised block)doc";
+
 static const char *__doc_kp_Manager_clear =
 R"doc(Run a pseudo-garbage collection to release all the managed resources
 that have been already freed due to these reaching to zero ref count.)doc";
@@ -221,6 +887,106 @@ static const char *__doc_kp_Manager_createInstance = R"doc()doc";
 
 static const char *__doc_kp_Manager_destroy = R"doc(Destroy the GPU resources and all managed resources by manager.)doc";
 
+static const char *__doc_kp_Manager_evalAsync =
+R"doc(Submits the recorded operations of the sequence as with evalAsync, and
+runs the callback once the submission completes and has been awaited.
+The fences of all the sequences submitted this way are waited for by a
+single thread owned by the manager, which also runs the callbacks. The
+sequence must not be used until the callback runs.
+
+@param sequence The sequence to submit @param callback The function to
+run with the sequence once completed)doc";
+
+static const char *__doc_kp_Manager_evalAsync_2 =
+R"doc(Submits the recorded operations of the sequence as with evalAsync,
+returning a future that becomes ready once the submission completes
+and has been awaited by the thread owned by the manager. The sequence
+must not be used until the future is ready.
+
+@param sequence The sequence to submit @returns Future holding the
+sequence, or the exception of evalAwait)doc";
+
+static const char *__doc_kp_Manager_evalAsync_3 =
+R"doc(Submits the recorded operations of the sequence as with evalAsync, and
+runs the completion once the submission completes and has been awaited,
+with the exception of evalAwait if any. Like the callback it runs on
+the thread owned by the manager, which lets bindings forward the result
+to another thread, such as to the future of an event loop.
+
+@param sequence The sequence to submit @param completion The function
+to run with the sequence and the exception, null if none, once
+completed)doc";
+
+static const char *__doc_kp_Manager_getDefaultLocalSize =
+R"doc(The local size chosen for the device that algorithms specialize the
+local_size_x_id of their shaders with when dispatched without an
+explicit workgroup. It is KOMPUTE_DEFAULT_LOCAL_SIZE_X rounded up to a
+multiple of the subgroup size and clamped to the workgroup size limits
+of the device.
+
+@return The default local size of the algorithms of the manager)doc";
+
+static const char *__doc_kp_Manager_getSubgroupProperties =
+R"doc(Information about the subgroups of the device, such as their size and
+the subgroup operations supported in each shader stage.
+
+@return Vulkan subgroup properties of the physical device)doc";
+
+static const char *__doc_kp_Manager_graph =
+R"doc(Create a graph of operations compiled into sequences of the manager
+spread across the queues provided. The graph must not be compiled once
+the manager is destroyed.
+
+@param queueIndices (Optional) The queues the operations can run on,
+which must support compute. If empty, all the queues of the manager
+supporting compute are used when the device supports timeline
+semaphores, and the compute queue otherwise @returns Shared pointer
+with initialised graph)doc";
+
+static const char *__doc_kp_Manager_hasBufferDeviceAddress =
+R"doc(Check whether tensors created by the manager have device addresses,
+which algorithms built with BindingModes::eDeviceAddresses pass to their
+shaders instead of binding descriptor sets. This requires
+VK_KHR_buffer_device_address to be provided in the desired extensions of
+the manager.
+
+@return Boolean stating whether buffer device addresses are enabled)doc";
+
+static const char *__doc_kp_Manager_hasDebugUtils =
+R"doc(Check whether VK_EXT_debug_utils is enabled, in which case the names
+set on the tensors, algorithms and sequences of the manager name their
+Vulkan objects, and the commands of each operation of the sequences
+are labelled. The extension is enabled on the instance created by the
+manager in debug builds, or when the KOMPUTE_ENV_DEBUG_UTILS
+environment variable is set to a value other than 0, provided the
+Vulkan loader or a layer supports it.
+
+Returns:
+    Boolean stating whether debug utils are enabled)doc";
+
+static const char *__doc_kp_Manager_hasGlobalPriority =
+R"doc(Check whether the global priorities of the queues were granted, which
+requires VK_KHR_global_priority or VK_EXT_global_priority to be
+supported by the device, and the process to be allowed the priorities
+above the default one by the driver.
+
+@return Boolean stating whether global priorities are enabled)doc";
+
+static const char *__doc_kp_Manager_hasTimelineSemaphores =
+R"doc(Check whether the sequences created by the manager signal timeline
+semaphores, which allows them to be passed as dependencies to the
+evalAsync of other sequences. This requires VK_KHR_timeline_semaphore
+to be provided in the desired extensions of the manager.
+
+@return Boolean stating whether timeline semaphores are enabled)doc";
+
+static const char *__doc_kp_Manager_hostAllocator =
+R"doc(The host allocation callbacks provided on construction, whose stats
+can be read around an operation to measure the host memory the driver
+allocates for it.
+
+@return The host allocator of the manager, null if none was provided)doc";
+
 static const char *__doc_kp_Manager_mComputeQueueFamilyIndices = R"doc()doc";
 
 static const char *__doc_kp_Manager_mComputeQueues = R"doc()doc";
@@ -243,19 +1009,226 @@ static const char *__doc_kp_Manager_mManagedTensors = R"doc()doc";
 
 static const char *__doc_kp_Manager_mPhysicalDevice = R"doc()doc";
 
+static const char *__doc_kp_Manager_memoryStats =
+R"doc(Reports the usage and budget of each memory heap, together with the
+live tensors and the size of their buffers. The tensors are only
+tracked when the manager manages its resources, which is not the case
+when it is created from an existing vulkan device.
+
+@return Memory statistics of the device and the tensors)doc";
+
+static const char *__doc_kp_Manager_metrics =
+R"doc(Reads the counters of the work done by the tensors, algorithms and
+sequences created by the manager, along with the number of them alive.
+The counters are always updated, and the resources are only counted
+when the manager manages its resources.
+
+@return Snapshot of the counters and the live resources)doc";
+
+static const char *__doc_kp_Manager_queueIndex =
+R"doc(Index of the queue used for a role, which can be passed to the
+functions taking a queue index.
+
+@param queueRole The role of the queue @returns Index of the queue,
+the index of the compute queue if the device has no dedicated queue
+family for the role)doc";
+
+static const char *__doc_kp_Manager_queuePriority =
+R"doc(Priority requested for a queue when the manager created the device.
+
+@param queueIndex The queue from the available queues @returns
+Priority of the queue)doc";
+
+static const char *__doc_kp_Manager_resetMetrics =
+R"doc(Sets the counters returned by metrics back to zero. The live resource
+counts are not affected.)doc";
+
+static const char *__doc_kp_Manager_savePipelineCache =
+R"doc(Writes the contents of the pipeline cache shared by the algorithms of
+the manager to a file, so the pipelines compiled so far can be
+preloaded by passing the file to the constructor of a later manager.
+
+@param path The file to write the pipeline cache data to)doc";
+
+static const char *__doc_kp_Manager_scheduler =
+R"doc(Create a scheduler distributing the operations of independent
+sequences across all the queues of the manager supporting compute,
+with sequences of its own on each queue. The submissions are awaited
+by the thread owned by the manager that also awaits evalAsync.
+
+@param sequencesPerQueue The number of submissions each queue can run
+at the same time @returns Shared pointer with initialised scheduler)doc";
+
+static const char *__doc_kp_Manager_scoreDevice =
+R"doc(Score a physical device against requirements. Discrete GPUs score
+above integrated, virtual and CPU devices, then devices with more
+device local memory score higher, then devices with larger subgroups.
+
+@param physicalDevice The physical device to score @param requirements
+The requirements of the physical device @return The score of the
+device, or -1 if it does not meet the requirements)doc";
+
+static const char *__doc_kp_Manager_selectDevice =
+R"doc(Select the device of the instance with the highest score for the
+requirements provided, see scoreDevice.
+
+@param requirements The requirements of the physical device @return
+Index of the selected device in listDevices)doc";
+
 static const char *__doc_kp_Manager_sequence =
 R"doc(Create a managed sequence that will be destroyed by this manager if it
 hasn't been destroyed by its reference count going to zero.
 
 @param queueIndex The queue to use from the available queues @param
 nrOfTimestamps The maximum number of timestamps to allocate. If zero
-(default), disables latching of timestamps. @returns Shared pointer
-with initialised sequence)doc";
+(default), disables latching of timestamps. @param inFlightDepth The
+number of evalAsync submissions the sequence can have in flight at the
+same time, 1 by default @param shareCommandPool Whether to allocate
+the command buffers from a command pool shared by the sequences of the
+same queue family, owned by the manager, instead of creating a pool
+for the sequence. Sequences sharing a pool must not be recorded from
+different threads at once. @param totalPipelineStatistics The number
+of operations whose compute shader invocations are counted when they
+dispatch an algorithm, see Sequence::getOpTimings. If zero (default),
+disables the statistics. @returns Shared pointer with initialised
+sequence)doc";
+
+static const char *__doc_kp_Manager_sequence_2 =
+R"doc(Create a managed sequence submitted to the queue of a role. Sequences
+of the transfer role can only record operations that copy or sync
+tensors, as their queue may not support compute.
+
+@param queueRole The role of the queue to use @param nrOfTimestamps
+The maximum number of timestamps to allocate. If zero (default),
+disables latching of timestamps. @param inFlightDepth The number of
+evalAsync submissions the sequence can have in flight at the same
+time, 1 by default @param shareCommandPool Whether to allocate the
+command buffers from a command pool shared by the sequences of the
+same queue family @param totalPipelineStatistics The number of
+operations whose compute shader invocations are counted when they
+dispatch an algorithm @returns Shared pointer with initialised
+sequence)doc";
+
+static const char *__doc_kp_Manager_sparseTensor =
+R"doc(Create a sparse CSR matrix made of three managed tensors, holding the
+row pointers, the column indices and the values of the non zeros. The
+arrays are checked to describe a valid matrix and copied into the host
+memory of the tensors, which have to be synced to the device with
+OpTensorSyncDevice before shaders access them.
+
+@param rows The number of rows of the matrix @param columns The number
+of columns of the matrix @param nonZeroCount The number of non zeros of
+the matrix @param rowPointers Array of rows + 1 indices of the first non
+zero of each row, followed by the number of non zeros @param
+columnIndices Array of the column of each non zero @param values Array
+of the value of each non zero @param tensorType The type of the tensors,
+eDevice or eHost @returns Shared pointer with initialised sparse tensor)doc";
+
+static const char *__doc_kp_Manager_sparseTensor_2 = R"doc()doc";
+
+static const char *__doc_kp_Manager_streamPipeline =
+R"doc(Create a pipeline streaming chunks of host data through an algorithm,
+with the tensors, algorithm and sequences of each chunk in flight. The
+uploads and downloads run on the transfer queue, overlapping with the
+dispatches, when the device has a dedicated transfer queue and
+timeline semaphores.
+
+@param spirv The spirv bytes of the shader run on each chunk, whose
+bindings are the inputs followed by the outputs @param chunkSize The
+number of elements of each tensor of a chunk @param inputCount
+(optional) The number of input tensors of a chunk @param outputCount
+(optional) The number of output tensors of a chunk @param depth
+(optional) The number of chunks in flight at the same time, three to
+overlap an upload, a dispatch and a download @param workgroup
+(optional) kp::Workgroup of the algorithm, which defaults to
+(chunkSize, 1, 1) @param specializationConstants (optional)
+templatable vector parameter to use for specialization constants
+@param pushConstants (optional) templatable vector parameter to use
+for push constants @returns Shared pointer with initialised stream
+pipeline)doc";
+
+static const char *__doc_kp_Manager_submit =
+R"doc(Submits the recorded operations of several sequences at once. The
+sequences targeting the same queue are grouped into a single queue
+submit signaling a single fence, which reduces the submission overhead
+when many small sequences are sent together.
+
+@param sequences The sequences to submit, each as with evalAsync
+@returns Shared pointer to the batch which can be awaited as a group)doc";
+
+static const char *__doc_kp_Manager_setConcurrentSharing =
+R"doc(Sets whether the buffers of the tensors created after this call are
+shared concurrently between the queue families of the manager, which
+is the default. This lets sequences of different queues, such as the
+transfer and compute roles, access the same tensors without queue
+family ownership transfers. Tensors used from a single queue family
+can disable it, as exclusive buffers may be faster on some devices.
+
+@param concurrentSharing Whether to share the buffers concurrently)doc";
+
+static const char *__doc_kp_Manager_setDeviceMemoryLimit =
+R"doc(Sets a soft limit on the device local memory that the manager can
+allocate for its tensors. Allocations exceeding the limit throw before
+reaching the driver, so the available headroom can be relied upon.
+
+@param limit The limit in bytes applied to every device local heap, or
+0 to remove the limit)doc";
+
+static const char *__doc_kp_Manager_supportsDataType =
+R"doc(Check whether shaders of the device can access tensors of the data
+type provided in storage buffers. The half, 8 and 16 bit integer types
+require the 8 or 16 bit storage features, which are enabled when the
+manager creates the device and they are supported, while tensors of
+any data type can be created and synced regardless.
+
+@param dataType The data type of the tensors @return Boolean stating
+whether shaders can access the data type)doc";
+
+static const char *__doc_kp_Manager_supportsSubgroupOperations =
+R"doc(Check whether compute shaders of the device support the subgroup
+operations provided, which allows selecting the subgroup variants of
+the built-in operations at runtime.
+
+@param operations The subgroup operations required @return Boolean
+stating whether all the operations are supported in compute shaders)doc";
 
 static const char *__doc_kp_Manager_tensor = R"doc()doc";
 
 static const char *__doc_kp_Manager_tensor_2 = R"doc()doc";
 
+static const char *__doc_kp_Manager_tensor_3 =
+R"doc(Create a managed tensor that only allocates its GPU memory, without
+any host data to initialise it from. This is intended for output and
+scratch tensors, including tensors of type eStorage, and for tensors
+whose data is written directly in their mapped host memory through
+rawData, which avoids copying it from an intermediate buffer.
+
+@param elementTotalCount The number of elements of the tensor @param
+dataType The data type of the elements of the tensor @param tensorType
+The type of tensor to initialize @param zeroInitialise Whether to zero
+the memory, which is done on the GPU with a fill command rather than on
+the host @param hostMemoryType The type of host visible memory to use
+@returns Shared pointer with initialised tensor)doc";
+
+static const char *__doc_kp_Manager_tensorFromDlpack =
+R"doc(Create a managed tensor from a DLPack capsule, or from an object
+implementing the __dlpack__ protocol such as a numpy array or a PyTorch
+CPU tensor. Strided data is gathered straight into the mapped host
+memory of the tensor, and contiguous data is imported without a copy
+when the host memory type is imported and the device supports it.
+
+Parameter ``source``:
+    The capsule or object holding host memory
+
+Parameter ``tensorType``:
+    The type of tensor to initialize
+
+Parameter ``hostMemoryType``:
+    The type of host visible memory to use
+
+Returns:
+    Shared pointer with initialised tensor)doc";
+
 static const char *__doc_kp_Manager_tensorT =
 R"doc(Create a managed tensor that will be destroyed by this manager if it
 hasn't been destroyed by its reference count going to zero.
@@ -264,6 +1237,16 @@ hasn't been destroyed by its reference count going to zero.
 The type of tensor to initialize @returns Shared pointer with
 initialised tensor)doc";
 
+static const char *__doc_kp_Manager_tensorView =
+R"doc(Create a managed view that aliases a range of elements of a parent
+tensor, sharing its buffers and memory so operations and algorithms can
+run in place on slices of a larger allocation.
+
+@param parent The tensor owning the memory to alias @param offset Index
+of the first element of the parent in the view @param count Number of
+elements of the view @returns Shared pointer with initialised tensor
+view)doc";
+
 static const char *__doc_kp_OpAlgoDispatch =
 R"doc(Operation that provides a general abstraction that simplifies the use
 of algorithm and parameter components which can be used with shaders.
@@ -301,6 +1284,66 @@ read by the host.
 
 @param commandBuffer The command buffer to record the command into.)doc";
 
+static const char *__doc_kp_OpAlgoDispatchBatch =
+R"doc(Operation that dispatches an algorithm several times with different
+push constants, binding the pipeline and descriptor set only once and
+then recording a push constants and dispatch pair for each set of push
+constants of a contiguous array.)doc";
+
+static const char *__doc_kp_OpAlgoDispatchBatch_OpAlgoDispatchBatch =
+R"doc(Constructor that stores the algorithm to use as well as a copy of the
+push constants of all the dispatches.
+
+@param algorithm The algorithm object to use for dispatch @param
+pushConstants The push constants of all the dispatches one after the
+other, which can be an array of structs matching the push constants
+block of the shader @param constantsPerDispatch The number of elements
+of pushConstants used by each dispatch @param barrierBetweenDispatches
+Whether to record a memory barrier between consecutive dispatches,
+which is required if a dispatch reads the results of the previous one)doc";
+
+static const char *__doc_kp_OpAlgoDispatchBatch_dispatchCount =
+R"doc(Returns the number of dispatches recorded by the operation.
+
+@return Number of dispatches)doc";
+
+static const char *__doc_kp_OpAlgoDispatchBatch_record =
+R"doc(This records the commands that are to be sent to the GPU, binding the
+algorithm once and then recording the push constants and dispatch of
+each of the dispatches, separated by memory barriers if requested.
+
+@param commandBuffer The command buffer to record the command into.)doc";
+
+static const char *__doc_kp_OpAlgoDispatchIndirect =
+R"doc(Operation that dispatches an algorithm with the workgroup counts read
+from a VkDispatchIndirectCommand stored in a tensor, so a previous
+shader can decide the size of the dispatch without a round trip to the
+host.)doc";
+
+static const char *__doc_kp_OpAlgoDispatchIndirect_OpAlgoDispatchIndirect =
+R"doc(Constructor that stores the algorithm to use, the tensor holding the
+dispatch command as well as the relevant push constants to override
+when recording.
+
+@param algorithm The algorithm object to use for dispatch @param
+indirectTensor Tensor holding the three uint32 workgroup counts @param
+offset Offset in bytes of the dispatch command in the tensor, which has
+to be a multiple of 4 @param pushConstants The push constants to use for
+override)doc";
+
+static const char *__doc_kp_OpAlgoDispatchIndirect_record =
+R"doc(This records the commands that are to be sent to the GPU, binding the
+algorithm and recording the indirect dispatch which reads the workgroup
+counts from the indirect tensor on execution.
+
+@param commandBuffer The command buffer to record the command into.)doc";
+
+static const char *__doc_kp_OpAlgoDispatchIndirect_tensorAccesses =
+R"doc(Declares the accesses of the dispatch to the tensors of the algorithm
+as well as the indirect command read of the indirect tensor.
+
+@return Accesses of the dispatch to its tensors)doc";
+
 static const char *__doc_kp_OpBase =
 R"doc(Base Operation which provides the high level interface that Kompute
 operations implement in order to perform a set of actions in the GPU.
@@ -336,18 +1379,464 @@ submitted as a batch into the GPU.
 
 @param commandBuffer The command buffer to record the command into.)doc";
 
+static const char *__doc_kp_OpCompact =
+R"doc(Operation that compacts the elements of a 32-bit tensor whose flag is
+not zero into the front of an output tensor, keeping their order, so a
+filtering stage doesn't have to read its results back to the host.
+
+The destination of every element kept is found with the reduce-then-
+scan passes of OpScan on the flags. The number of elements kept is
+written to a count tensor of at least 4 uint32 elements: the first 3
+are a VkDispatchIndirectCommand with one invocation per element kept
+for a local size of indirectLocalSize, which can be passed as it is to
+OpAlgoDispatchIndirect, and the fourth is the number of elements kept.)doc";
+
+static const char *__doc_kp_OpCompact_OpCompact =
+R"doc(Constructor that overrides the algorithm with the compaction shader
+and the tensors provided.
+
+@param tensors Tensors that are to be used in this operation, which
+are expected to be the 32-bit values, the int32 or uint32 flags of the
+same size, the output of the data type of the values and at least
+their size, the uint32 count tensor and the 32-bit partials tensor of
+at least OpScan::partialsSize elements @param algorithm An algorithm
+that will be overridden with the OpCompact shader data and the tensors
+provided @param indirectLocalSize The local size of the algorithm
+dispatched with the dispatch command of the count tensor, usually its
+Algorithm::getLocalSizeX)doc";
+
+static const char *__doc_kp_OpConv2D =
+R"doc(Operation that computes the two dimensional convolution of a batch of
+float images, with an optional bias and a fused relu or leaky relu
+activation, as an implicit matrix multiplication that gathers the
+input windows while loading the shared memory tiles of the OpMatMul
+shader design, so the images are never expanded in memory.
+
+The images are stored NCHW or NHWC. The weights are stored
+[outChannels][inChannels][kernelHeight][kernelWidth] for NCHW images
+and [outChannels][kernelHeight][kernelWidth][inChannels] for NHWC
+images, and the bias holds one value per output channel.)doc";
+
+static const char *__doc_kp_OpConv2D_Activation =
+R"doc(Activation applied to the outputs of the convolution.)doc";
+
+static const char *__doc_kp_OpConv2D_Activation_eLeakyRelu = R"doc()doc";
+
+static const char *__doc_kp_OpConv2D_Activation_eNone = R"doc()doc";
+
+static const char *__doc_kp_OpConv2D_Activation_eRelu = R"doc()doc";
+
+static const char *__doc_kp_OpConv2D_Layout =
+R"doc(Memory layout of the input and output images.)doc";
+
+static const char *__doc_kp_OpConv2D_Layout_eNCHW = R"doc()doc";
+
+static const char *__doc_kp_OpConv2D_Layout_eNHWC = R"doc()doc";
+
+static const char *__doc_kp_OpConv2D_OpConv2D =
+R"doc(Constructor that overrides the algorithm with the convolution shader,
+specialized for the kernel size, layout and activation, and the
+tensors provided.
+
+@param tensors Tensors that are to be used in this operation, which
+are expected to be the float input, weights, optionally bias and
+output @param algorithm An algorithm that will be overridden with the
+OpConv2D shader data and the tensors provided @param batch The number
+of images of the input and output @param inChannels The channels of
+the input images @param inHeight The height of the input images @param
+inWidth The width of the input images @param outChannels The channels
+of the output images @param kernelHeight The height of the kernel
+window @param kernelWidth The width of the kernel window @param stride
+The step of the kernel window along both dimensions @param padding The
+zeros added around the input images along both dimensions @param
+layout The memory layout of the input and output images @param
+activation The activation applied to the outputs @param alpha The
+slope of the negative outputs of eLeakyRelu @param tileSize The size
+of the square tiles of output pixels by output channels computed by
+each workgroup, as described by OpMatMul, or 0 for
+KOMPUTE_MATMUL_DEFAULT_TILE_SIZE)doc";
+
+static const char *__doc_kp_OpConv2D_mTensors = R"doc()doc";
+
+static const char *__doc_kp_OpConv2D_outputSize =
+R"doc(Returns the size of a dimension of the output images.
+
+@param inSize The size of the dimension of the input images @param
+kernelSize The size of the kernel window along the dimension @param
+stride The step of the kernel window @param padding The zeros added on
+both sides of the dimension @return The size of the dimension of the
+output, 0 when the kernel window is larger than the padded input)doc";
+
+static const char *__doc_kp_OpConv2D_tensorAccesses =
+R"doc(Declares the shader reads of the input, weights and bias as well as
+the shader write of the output.
+
+@return Accesses of the convolution to its tensors)doc";
+
+static const char *__doc_kp_OpExpression =
+R"doc(Operation that evaluates an elementwise Expression into a float tensor
+in a single dispatch of a shader generated for the expression, so
+chains of elementwise operations neither dispatch once per operation
+nor write their intermediate results to memory.)doc";
+
+static const char *__doc_kp_OpExpression_OpExpression =
+R"doc(Constructor that overrides the algorithm with the shader of the
+expression, the output tensor and the tensors of the expression.
+
+@param tensors Tensors that are to be used in this operation, which
+are expected to be the float output of the expression, which can also
+be read by the expression @param algorithm An algorithm that will be
+overridden with the shader generated for the expression and its
+tensors @param expression The expression to evaluate, whose tensors
+must be float tensors of the size of the output)doc";
+
+static const char *__doc_kp_OpExpression_mInputs = R"doc()doc";
+
+static const char *__doc_kp_OpExpression_mOutput = R"doc()doc";
+
+static const char *__doc_kp_OpExpression_tensorAccesses =
+R"doc(Declares the shader reads of the tensors of the expression and the
+shader write of the output.
+
+@return Accesses of the expression to its tensors)doc";
+
+static const char *__doc_kp_OpLogisticRegression =
+R"doc(Operation that trains a logistic regression with full batch gradient
+descent for several epochs in a single dispatch, so the weights stay on
+the device between epochs and only the trained weights, bias and loss
+have to be read back by the host.
+
+The training runs in one workgroup that keeps the weights in shared
+memory, and reduces the gradients of the samples in shared memory every
+epoch before updating the weights.)doc";
+
+static const char *__doc_kp_OpLogisticRegression_OpLogisticRegression =
+R"doc(Constructor that overrides the algorithm with the training shader and
+the tensors provided.
+
+@param tensors Tensors that are to be used in this operation, which are
+expected to be the float samples stored row by row, the labels of 0 or
+1 of each sample, the weights of each feature, the bias and the loss.
+The weights and bias hold the initial values and are overwritten with
+the trained values, and the loss receives the mean cross entropy of
+the last epoch @param algorithm An algorithm that will be overridden
+with the OpLogisticRegression shader data and the tensors provided
+@param epochs The number of gradient descent steps over all samples
+@param learningRate The step size of the updates of the weights)doc";
+
+static const char *__doc_kp_OpLogisticRegression_mTensors = R"doc()doc";
+
+static const char *__doc_kp_OpLogisticRegression_tensorAccesses =
+R"doc(Declares the shader reads of the samples and labels, the shader reads
+and writes of the weights and bias and the shader write of the loss.
+
+@return Accesses of the training to its tensors)doc";
+
+static const char *__doc_kp_OpMatMul =
+R"doc(Operation that multiplies two row-major float matrices, or two batches
+of matrices, into a third tensor with a tiled shader that stages blocks
+of the inputs in shared memory and accumulates several outputs per
+invocation in registers.
+
+The output C is M x N and is computed as op(A) * op(B), where op(A) is
+M x K and op(B) is K x N. A transposed input is stored with its
+dimensions swapped, for example A of K x M when transposeA is set. The
+matrices of a batch are stored one after the other in each tensor.
+
+Only the tile size of C and the local size are specialization
+constants. The shared memory tiles of A and B are arrays of a fixed
+KOMPUTE_MATMUL_MAX_TILE_SIZE x KOMPUTE_MATMUL_MAX_TILE_SIZE floats, so
+every tile size reserves 8 KB of shared memory per workgroup, and tiles
+larger than 32 x 32 require changing the shader.)doc";
+
+static const char *__doc_kp_OpMatMul_OpMatMul =
+R"doc(Constructor that overrides the algorithm with the matrix
+multiplication shader, specialized for the tile size, and the tensors
+provided.
+
+@param tensors Tensors that are to be used in this operation, which
+are expected to be the float tensors A, B and C @param algorithm An
+algorithm that will be overridden with the OpMatMul shader data and the
+tensors provided @param m Rows of op(A) and C @param n Columns of op(B)
+and C @param k Columns of op(A) and rows of op(B) @param transposeA
+Whether A is stored transposed as a K x M matrix @param transposeB
+Whether B is stored transposed as a N x K matrix @param batchCount The
+number of matrix multiplications of the batch @param tileSize The size
+of the square tiles of C computed by each workgroup, a power of two
+between KOMPUTE_MATMUL_WORK_PER_THREAD and KOMPUTE_MATMUL_MAX_TILE_SIZE,
+or 0 for KOMPUTE_MATMUL_DEFAULT_TILE_SIZE. The largest size supported
+by a device is returned by tileSizeForDevice.)doc";
+
+static const char *__doc_kp_OpMatMul_tensorAccesses =
+R"doc(Declares the shader reads of A and B as well as the shader write of C.
+
+@return Accesses of the matrix multiplication to its tensors)doc";
+
+static const char *__doc_kp_OpMatMul_tileSizeForDevice =
+R"doc(Returns the largest tile size whose workgroups fit the compute limits
+of a device, which is the fastest on most devices.
+
+@param properties The properties of the physical device @return The
+tile size to provide to the constructor)doc";
+
 static const char *__doc_kp_OpMult =
-R"doc(Operation that performs multiplication on two tensors and outpus on
-third tensor.)doc";
+R"doc(Operation that performs elementwise multiplication on two float tensors
+and outputs on a third tensor.
+
+When Kompute is built with the shader compiler, a vectorized shader is
+compiled in process, where each invocation multiplies four elements at a
+time through vec4 loads and stores in a grid-stride loop, with the local
+size of the algorithm and at most KOMPUTE_MULT_MAX_WORKGROUPS
+workgroups. Either input can then hold a single value that is multiplied
+with every element of the other input. Otherwise the prebuilt shader
+multiplies one element per workgroup and the inputs need the size of the
+output.)doc";
 
 static const char *__doc_kp_OpMult_OpMult =
 R"doc(Default constructor with parameters that provides the bare minimum
 requirements for the operations to be able to create and manage their
 sub-components.
 
-@param tensors Tensors that are to be used in this operation @param
-algorithm An algorithm that will be overridden with the OpMult shader
-data and the tensors provided which are expected to be 3)doc";
+@param tensors Tensors that are to be used in this operation, which are
+expected to be the lhs, rhs and output float tensors, where the lhs and
+rhs have either the size of the output or, with the shader compiler, a
+single element @param algorithm An algorithm that will be overridden
+with the OpMult shader data and the tensors provided)doc";
+
+static const char *__doc_kp_OpMult_tensorAccesses =
+R"doc(Declares the shader reads of the inputs and the shader write of the
+output.
+
+@return Accesses of the multiplication to its tensors)doc";
+
+static const char *__doc_kp_OpReduce =
+R"doc(Operation that reduces all the elements of a float tensor into a small
+output tensor, so only the result has to be read back by the host.
+
+Each workgroup reduces a strided slice of the input and combines its
+partial result atomically into the output, which the operation
+initialises with the identity of the reduction. The workgroup reduction
+either uses subgroup arithmetic, which requires the device to support
+the basic and arithmetic subgroup operations in compute shaders as
+reported by Manager::supportsSubgroupOperations, or a fallback
+reduction in shared memory that runs on any device.)doc";
+
+static const char *__doc_kp_OpReduce_OpReduce =
+R"doc(Constructor that overrides the algorithm with the reduction shader and
+the tensors provided.
+
+@param tensors Tensors that are to be used in this operation, which
+are expected to be the float input and output of the reduction, or a
+uint32 output of at least 2 elements for eArgmax @param algorithm An
+algorithm that will be overridden with the OpReduce shader data and the
+tensors provided @param operation The reduction to perform @param
+subgroupArithmetic Whether to use the subgroup arithmetic variant of
+the shader, which is only valid if the device supports it @param
+syncLocal Whether to also read the output back into the host memory of
+the tensor, as an OpTensorSyncLocal recorded after the reduction would)doc";
+
+static const char *__doc_kp_OpReduce_Operation = R"doc(Reduction performed by the operation.)doc";
+
+static const char *__doc_kp_OpReduce_Operation_eArgmax =
+R"doc(Stores the float bits of the maximum in the first element of a uint32
+output and the first index of the maximum in the second element)doc";
+
+static const char *__doc_kp_OpReduce_Operation_eMax = R"doc()doc";
+
+static const char *__doc_kp_OpReduce_Operation_eMin = R"doc()doc";
+
+static const char *__doc_kp_OpReduce_Operation_eSum = R"doc()doc";
+
+static const char *__doc_kp_OpReduce_postEval =
+R"doc(Makes the output available in the host memory of the tensor if
+syncLocal was set.
+
+@param commandBuffer The command buffer to record the command into.)doc";
+
+static const char *__doc_kp_OpReduce_record =
+R"doc(Records the initialisation of the output with the identity of the
+reduction, which the workgroups then combine their partial results
+with, followed by the dispatch of the reduction. For eArgmax a second
+dispatch finds the index of the maximum. The copy of the output to the
+host is recorded last if syncLocal was set.
+
+@param commandBuffer The command buffer to record the command into.)doc";
+
+static const char *__doc_kp_OpReduce_tensorAccesses =
+R"doc(Declares the shader read of the input as well as the transfer write
+and shader accesses of the output, and its transfer or host read if
+syncLocal was set.
+
+@return Accesses of the reduction to its tensors)doc";
+
+static const char *__doc_kp_OpScan =
+R"doc(Operation that computes the inclusive or exclusive prefix sum of a
+32-bit float, int32 or uint32 tensor.
+
+The scan uses a reduce-then-scan in three dispatches of the same
+pipeline, which runs on any device: the first reduces every block of
+KOMPUTE_SCAN_BLOCK_SIZE elements into a partials tensor, the second
+scans the partials with a single workgroup and the third scans every
+block again starting from its partial. The partials tensor is scratch
+memory provided by the caller, of at least partialsSize elements of
+the input.)doc";
+
+static const char *__doc_kp_OpScan_OpScan =
+R"doc(Constructor that overrides the algorithm with the scan shader and the
+tensors provided.
+
+@param tensors Tensors that are to be used in this operation, which
+are expected to be the input, the output of the same data type and at
+least the same size, and the 32-bit partials tensor. The input and the
+output can be the same tensor to scan in place @param algorithm An
+algorithm that will be overridden with the OpScan shader data and the
+tensors provided @param inclusive Whether every output element
+includes the input element at the same index, otherwise the scan is
+exclusive and the first output element is zero)doc";
+
+static const char *__doc_kp_OpScan_OpScan_2 =
+R"doc(Constructor for the operations that run the passes of the scan with a
+shader of their own, which have to call setupPasses once the algorithm
+is rebuilt.
+
+@param algorithm The algorithm object to use for dispatch)doc";
+
+static const char *__doc_kp_OpScan_mBlockWorkgroup = R"doc()doc";
+
+static const char *__doc_kp_OpScan_mPartials = R"doc()doc";
+
+static const char *__doc_kp_OpScan_mPassPushConstants = R"doc()doc";
+
+static const char *__doc_kp_OpScan_partialsSize =
+R"doc(Returns the number of elements of the partials tensor required to scan
+an input of the size provided, which is one per block.
+
+@param size The number of elements of the input @return The minimum
+number of elements of the partials tensor)doc";
+
+static const char *__doc_kp_OpScan_record =
+R"doc(Records the three passes of the scan, with barriers on the partials
+tensor in between.
+
+@param commandBuffer The command buffer to record the command into.)doc";
+
+static const char *__doc_kp_OpScan_setupPasses =
+R"doc(Validates the partials tensor and sizes the dispatches of the block
+passes for an input of the size provided.
+
+@param partials The partials tensor of the scan @param size The number
+of elements of the input @param pushConstants The push constants of
+the shader, of which the first is set to the index of each pass when
+recording @param name The name of the operation used in errors)doc";
+
+static const char *__doc_kp_OpSort =
+R"doc(Operation that sorts a uint32, int32 or float tensor of keys in
+ascending order, optionally reordering a 32-bit payload tensor of the
+same size with the keys. The sort is stable, so equal keys keep the
+order of their payloads.
+
+It is a least significant digit radix sort of KOMPUTE_SORT_RADIX_BITS
+per digit, where every digit counts the digits of every block of keys
+into histograms, scans them with an OpScan and scatters the keys to
+their destinations, all recorded into the same command buffer. The
+operation creates and owns the scratch tensors it needs, which are
+eStorage tensors of the manager, so it holds memory for about twice
+the keys and payload.)doc";
+
+static const char *__doc_kp_OpSort_OpSort =
+R"doc(Constructor that creates the algorithms and scratch tensors of the
+sort with the manager provided.
+
+@param tensors Tensors that are to be used in this operation, which
+are expected to be the keys and optionally the payload @param manager
+The manager used to create the algorithms and scratch tensors, which
+is only used in the constructor)doc";
+
+static const char *__doc_kp_OpSort_mHistograms = R"doc()doc";
+
+static const char *__doc_kp_OpSort_mKeys = R"doc()doc";
+
+static const char *__doc_kp_OpSort_mKeysScratch = R"doc()doc";
+
+static const char *__doc_kp_OpSort_mPartials = R"doc()doc";
+
+static const char *__doc_kp_OpSort_mPayload = R"doc()doc";
+
+static const char *__doc_kp_OpSort_mPayloadScratch = R"doc()doc";
+
+static const char *__doc_kp_OpSort_mScan = R"doc()doc";
+
+static const char *__doc_kp_OpSort_record =
+R"doc(Records the histogram, scan and scatter passes of every digit, with
+memory barriers in between.
+
+@param commandBuffer The command buffer to record the command into.)doc";
+
+static const char *__doc_kp_OpSort_recordPass = R"doc()doc";
+
+static const char *__doc_kp_OpSort_tensorAccesses =
+R"doc(Declares the shader reads and writes of the keys and the payload, as
+the scratch tensors are private to the operation.
+
+@return Accesses of the sort to its tensors)doc";
+
+static const char *__doc_kp_OpSpMM =
+R"doc(Operation that multiplies a sparse CSR matrix A by a dense row-major
+float matrix B into a dense row-major float matrix C, as C = A * B. Each
+invocation computes an element of C from the non zeros of its row of A,
+and the invocations of a workgroup cover consecutive columns so they
+read consecutive elements of B. Narrow matrices put several rows of C in
+each workgroup instead of leaving invocations idle.)doc";
+
+static const char *__doc_kp_OpSpMM_OpSpMM =
+R"doc(Constructor that overrides the algorithm with the sparse matrix product
+shader and the tensors provided.
+
+@param matrix The sparse matrix A of rows x columns @param tensors
+Tensors that are to be used in this operation, which are expected to be
+the float tensors B, of columns x n elements, and C, of rows x n
+elements @param algorithm An algorithm that will be overridden with the
+OpSpMM shader data and the tensors provided @param n Columns of B and C)doc";
+
+static const char *__doc_kp_OpSpMM_tensorAccesses =
+R"doc(Declares the shader reads of the matrix and B as well as the shader
+write of C.
+
+@return Accesses of the product to its tensors)doc";
+
+static const char *__doc_kp_OpSpMV =
+R"doc(Operation that multiplies a sparse CSR matrix A by a dense float vector
+x into a float vector y, as y = A * x. The rows are split across the
+invocations of the workgroups, each row being reduced by a group of
+invocations that stride over its non zeros, so rows with many non zeros
+are spread over several invocations while short rows share a workgroup.)doc";
+
+static const char *__doc_kp_OpSpMV_OpSpMV =
+R"doc(Constructor that overrides the algorithm with the sparse matrix vector
+product shader and the tensors provided.
+
+@param matrix The sparse matrix A of rows x columns @param tensors
+Tensors that are to be used in this operation, which are expected to be
+the float tensors x, of at least columns elements, and y, of at least
+rows elements @param algorithm An algorithm that will be overridden with
+the OpSpMV shader data and the tensors provided @param lanesPerRow The
+invocations reducing each row, a power of two of at most
+KOMPUTE_SPMV_LOCAL_SIZE, or 0 to choose it from the average non zeros
+per row)doc";
+
+static const char *__doc_kp_OpSpMV_tensorAccesses =
+R"doc(Declares the shader reads of the matrix and x as well as the shader
+write of y.
+
+@return Accesses of the product to its tensors)doc";
+
+static const char *__doc_kp_OpSpMV_lanesPerRowFor =
+R"doc(Returns the invocations reducing each row chosen for a matrix, which is
+the power of two closest above its average non zeros per row, up to
+KOMPUTE_SPMV_MAX_LANES_PER_ROW.
+
+@param rows The number of rows of the matrix @param nonZeroCount The
+number of non zeros of the matrix @return The invocations per row)doc";
 
 static const char *__doc_kp_OpTensorCopy =
 R"doc(Operation that copies the data from the first tensor to the rest of
@@ -355,17 +1844,30 @@ the tensors provided, using a record command for all the vectors. This
 operation does not own/manage the memory of the tensors passed to it.
 The operation must only receive tensors of type)doc";
 
+static const char *__doc_kp_OpTensorCopy_HostUpdate =
+R"doc(Update of the host data of the tensors copied into after each
+evaluation.)doc";
+
+static const char *__doc_kp_OpTensorCopy_HostUpdate_eMirror = R"doc()doc";
+
+static const char *__doc_kp_OpTensorCopy_HostUpdate_eNone = R"doc()doc";
+
 static const char *__doc_kp_OpTensorCopy_OpTensorCopy =
 R"doc(Default constructor with parameters that provides the core vulkan
 resources and the tensors that will be used in the operation.
 
-@param tensors Tensors that will be used to create in operation.)doc";
+@param tensors Tensors that will be used to create in operation. @param
+ranges Element ranges to copy into each tensor, the whole tensors if
+empty @param hostUpdate Whether the host data of the first tensor is
+also copied on the host into the other tensors after each evaluation,
+which eNone avoids for copies broadcasting to many tensors whose host
+data is not read)doc";
 
 static const char *__doc_kp_OpTensorCopy_mTensors = R"doc()doc";
 
 static const char *__doc_kp_OpTensorCopy_postEval =
 R"doc(Copies the local vectors for all the tensors to sync the data with the
-gpu.
+gpu, unless the host update is eNone.
 
 @param commandBuffer The command buffer to record the command into.)doc";
 
@@ -376,10 +1878,25 @@ R"doc(Does not perform any preEval commands.
 
 static const char *__doc_kp_OpTensorCopy_record =
 R"doc(Records the copy commands from the first tensor into all the other
-tensors provided. Also optionally records a barrier.
+tensors provided, computing the copy regions once for all of them.
 
 @param commandBuffer The command buffer to record the command into.)doc";
 
+static const char *__doc_kp_OpTensorFill =
+R"doc(Operation that fills the GPU memory of the tensors provided with a
+repeated 32-bit value, using a record command for all the tensors so no
+host data is required. This is intended to clear output and scratch
+tensors, including tensors of type eStorage. This operation does not
+own/manage the memory of the tensors passed to it.)doc";
+
+static const char *__doc_kp_OpTensorFill_OpTensorFill =
+R"doc(Default constructor with parameters that provides the tensors that
+will be filled and the value to fill them with.
+
+@param tensors Tensors that will be used to create in operation.
+@param data The 32-bit pattern written repeatedly into the tensors,
+which defaults to zero)doc";
+
 static const char *__doc_kp_OpTensorSyncDevice =
 R"doc(Operation that syncs tensor's device by mapping local data into the
 device memory. For TensorTypes::eDevice it will use a record operation
@@ -430,27 +1947,85 @@ tensors provided cannot be of type TensorTypes::eStorage.
 
 @param tensors Tensors that will be used to create in operation.)doc";
 
-static const char *__doc_kp_OpTensorSyncLocal_mTensors = R"doc()doc";
+static const char *__doc_kp_OpTensorSyncLocal_mTensors = R"doc()doc";
+
+static const char *__doc_kp_OpTensorSyncLocal_postEval =
+R"doc(For host tensors it performs the map command from the host memory into
+local memory.
+
+@param commandBuffer The command buffer to record the command into.)doc";
+
+static const char *__doc_kp_OpTensorSyncLocal_preEval =
+R"doc(Does not perform any preEval commands.
+
+@param commandBuffer The command buffer to record the command into.)doc";
+
+static const char *__doc_kp_OpTensorSyncLocal_record =
+R"doc(For device tensors, it records the copy command for the tensor to copy
+the data from its device to staging memory.
+
+@param commandBuffer The command buffer to record the command into.)doc";
+
+static const char *__doc_kp_Scheduler =
+R"doc(Scheduler distributing independent sequences across several queues,
+so they run in parallel without being assigned to a queue by hand.
+
+The operations of each sequence submitted are recorded into one of the
+sequences the scheduler owns on each queue. A submission goes to the
+queue with the least outstanding work, and a queue left without
+pending work steals the most recently submitted work of the busiest
+queue. Submissions are awaited through the fences of their sequences
+by a CompletionWaiter, and complete in no particular order.)doc";
+
+static const char *__doc_kp_Scheduler_await = R"doc(Waits until all the submissions so far have completed.)doc";
+
+static const char *__doc_kp_Scheduler_completedCounts =
+R"doc(Returns the number of submissions completed by each queue.
+
+@return Number of completed submissions, indexed by queue)doc";
+
+static const char *__doc_kp_Scheduler_destroy =
+R"doc(Waits for the submissions still outstanding and releases the
+sequences of the scheduler.)doc";
+
+static const char *__doc_kp_Scheduler_outstandingCount =
+R"doc(Returns the number of submissions pending or running that have not
+completed yet.
+
+@return Number of outstanding submissions)doc";
 
-static const char *__doc_kp_OpTensorSyncLocal_postEval =
-R"doc(For host tensors it performs the map command from the host memory into
-local memory.
+static const char *__doc_kp_Scheduler_queueCount =
+R"doc(Returns the number of queues the submissions are distributed across.
 
-@param commandBuffer The command buffer to record the command into.)doc";
+@return Number of queues)doc";
 
-static const char *__doc_kp_OpTensorSyncLocal_preEval =
-R"doc(Does not perform any preEval commands.
+static const char *__doc_kp_Scheduler_stolenCount =
+R"doc(Returns the number of submissions run by a queue other than the queue
+they were first assigned to.
 
-@param commandBuffer The command buffer to record the command into.)doc";
+@return Number of stolen submissions)doc";
 
-static const char *__doc_kp_OpTensorSyncLocal_record =
-R"doc(For device tensors, it records the copy command for the tensor to copy
-the data from its device to staging memory.
+static const char *__doc_kp_Scheduler_submit =
+R"doc(Submits the operations recorded by the sequence to one of the queues.
+The sequence itself is not submitted, and may be recorded again or
+submitted again straight away.
 
-@param commandBuffer The command buffer to record the command into.)doc";
+@param sequence The sequence whose operations to run @param completion
+The function to run once the operations completed, from the thread of
+the completion waiter)doc";
 
 static const char *__doc_kp_Sequence = R"doc(Container of operations that can be sent to GPU as batch)doc";
 
+static const char *__doc_kp_Sequence_OpTiming =
+R"doc(GPU time of an operation, measured from the timestamps latched before
+and after it.)doc";
+
+static const char *__doc_kp_Sequence_OpTiming_computeInvocations = R"doc(Of dispatches with statistics)doc";
+
+static const char *__doc_kp_Sequence_OpTiming_durationNs = R"doc(Nanoseconds since the previous timestamp)doc";
+
+static const char *__doc_kp_Sequence_OpTiming_label = R"doc(Label recorded, or the operation type)doc";
+
 static const char *__doc_kp_Sequence_Sequence =
 R"doc(Main constructor for sequence which requires core vulkan components to
 generate all dependent resources.
@@ -458,7 +2033,24 @@ generate all dependent resources.
 @param physicalDevice Vulkan physical device @param device Vulkan
 logical device @param computeQueue Vulkan compute queue @param
 queueIndex Vulkan compute queue index in device @param totalTimestamps
-Maximum number of timestamps to allocate)doc";
+Maximum number of timestamps to allocate @param inFlightDepth Maximum
+number of submissions running at the same time, timestamps are only
+supported with a single submission @param timelineSemaphore Whether to
+signal a timeline semaphore with every submission so other sequences
+can depend on it, which requires the timelineSemaphore feature of
+VK_KHR_timeline_semaphore @param commandPool Command pool of the queue
+family to allocate the command buffers from, which is not destroyed by
+the sequence. A new pool owned by the sequence is created if null.
+Sequences sharing a pool must not be recorded from different threads
+at the same time.)doc";
+
+static const char *__doc_kp_Sequence_barrierCount =
+R"doc(Returns the number of pipeline barriers recorded by the sequence
+between the operations of the current recording, based on the tensor
+accesses the operations declare. The barriers required by the tensors
+of an operation are recorded as a single pipeline barrier.
+
+@return Number of barriers recorded for the tracked tensor accesses)doc";
 
 static const char *__doc_kp_Sequence_begin =
 R"doc(Begins recording commands for commands to be submitted into the
@@ -536,6 +2128,19 @@ correctly.
 @return Boolean stating whether execution was successful.)doc";
 
 static const char *__doc_kp_Sequence_evalAsync_3 =
+R"doc(Eval Async sends all the recorded and stored operations like
+evalAsync(), with the GPU waiting for the last submission of each of
+the sequences provided before executing them. The dependencies are
+resolved on the GPU through timeline semaphores, so sequences on
+different queues can be chained without waiting on the host.
+EvalAwait() must ALWAYS be called after to ensure the sequence is
+terminated correctly.
+
+@param waitSequences Sequences whose last submission has to complete
+before this submission executes, all created with timeline semaphores
+@return shared_ptr<Sequence> of the Sequence class itself)doc";
+
+static const char *__doc_kp_Sequence_evalAsync_4 =
 R"doc(Eval sends all the recorded and stored operations in the vector of
 operations into the gpu as a submit job with a barrier.
 
@@ -544,7 +2149,7 @@ Template parameters that are used to initialise operation which allows
 for extensible configurations on initialisation. @return
 shared_ptr<Sequence> of the Sequence class itself)doc";
 
-static const char *__doc_kp_Sequence_evalAsync_4 =
+static const char *__doc_kp_Sequence_evalAsync_5 =
 R"doc(Eval sends all the recorded and stored operations in the vector of
 operations into the gpu as a submit job with a barrier.
 
@@ -561,9 +2166,44 @@ finishes, it runs the postEval of all operations.
 @param waitFor Number of milliseconds to wait before timing out.
 @return shared_ptr<Sequence> of the Sequence class itself)doc";
 
+static const char *__doc_kp_Sequence_getOpTimings =
+R"doc(Returns the GPU time of each operation during the last eval() call, in
+nanoseconds, along with the compute shader invocations of the
+dispatches when pipeline statistics are collected. The queries are
+reset at the start of every submission, so the sequence can be
+evaluated again and the timings retrieved after each eval. The
+durations are zero when the sequence has no timestamps.
+
+@param wait Whether to wait for the timestamps to be available, which
+they are once the submission completed @return Timing of each
+operation with a timestamp or statistics, or an empty vector if wait
+is false and the results are not available yet)doc";
+
 static const char *__doc_kp_Sequence_getTimestamps =
 R"doc(Return the timestamps that were latched at the beginning and after
-each operation during the last eval() call.)doc";
+each operation during the last eval() call, in ticks of the
+timestampPeriod of the device. Waits for the timestamps to be
+available.)doc";
+
+static const char *__doc_kp_Sequence_isComplete =
+R"doc(Checks without blocking whether the oldest submission in flight of the
+sequence has finished executing on the GPU. The postEval of the
+operations is only run by evalAwait, which returns straight away once
+this is true.
+
+@return Boolean stating whether the GPU has finished the submission)doc";
+
+static const char *__doc_kp_Sequence_inFlightCount =
+R"doc(Returns the number of submissions that have been sent with evalAsync
+and not yet retired with evalAwait.
+
+@return Number of submissions in flight)doc";
+
+static const char *__doc_kp_Sequence_inFlightDepth =
+R"doc(Returns the maximum number of submissions of the sequence that can be
+in flight at the same time.
+
+@return Maximum number of submissions in flight)doc";
 
 static const char *__doc_kp_Sequence_isInit =
 R"doc(Returns true if the sequence has been initialised, and it's based on
@@ -606,6 +2246,18 @@ static const char *__doc_kp_Sequence_mQueueIndex = R"doc()doc";
 
 static const char *__doc_kp_Sequence_mRecording = R"doc()doc";
 
+static const char *__doc_kp_Sequence_name =
+R"doc(Retrieve the name of the sequence set with setName.
+
+Returns:
+    Name of the sequence, empty if it was not named)doc";
+
+static const char *__doc_kp_Sequence_operations =
+R"doc(Returns the operations of the current recording, in the order they
+were recorded.
+
+@return The operations recorded)doc";
+
 static const char *__doc_kp_Sequence_record =
 R"doc(Record function for operation to be added to the GPU queue in batch.
 This template requires classes to be derived from the OpBase class.
@@ -617,6 +2269,42 @@ sequence which will be used when the operation is evaluated. @return
 shared_ptr<Sequence> of the Sequence class itself)doc";
 
 static const char *__doc_kp_Sequence_record_2 =
+R"doc(Record function for an operation like record, which labels the timing
+of the operation returned by getOpTimings.
+
+@param op Object derived from kp::BaseOp that will be recoreded by the
+sequence which will be used when the operation is evaluated. @param
+label Label of the operation in its timing @return
+shared_ptr<Sequence> of the Sequence class itself)doc";
+
+static const char *__doc_kp_Sequence_record_3 =
+R"doc(Record function for several operations at once, like calling record
+for each of them in order, which begins the recording and reserves the
+storage of the operations only once. This is intended for long
+sequences built by the bindings, which record them in a single call.
+
+@param ops Objects derived from kp::BaseOp that will be recorded by the
+sequence in order @return shared_ptr<Sequence> of the Sequence class
+itself)doc";
+
+static const char *__doc_kp_Sequence_recordDispatches =
+R"doc(Record the dispatches of an algorithm with one row of push constants
+each, as a single OpAlgoDispatchBatch operation, which records a
+sequence of thousands of dispatches in a single call.
+
+Parameter ``algorithm``:
+    The algorithm to dispatch
+
+Parameter ``pushConsts``:
+    Array of the push constants with one row per dispatch
+
+Parameter ``barrierBetweenDispatches``:
+    Whether to record a memory barrier between consecutive dispatches
+
+Returns:
+    The sequence itself)doc";
+
+static const char *__doc_kp_Sequence_record_4 =
 R"doc(Record function for operation to be added to the GPU queue in batch.
 This template requires classes to be derived from the OpBase class.
 This function also requires the Sequence to be recording, otherwise it
@@ -627,7 +2315,7 @@ Template parameters that are used to initialise operation which allows
 for extensible configurations on initialisation. @return
 shared_ptr<Sequence> of the Sequence class itself)doc";
 
-static const char *__doc_kp_Sequence_record_3 =
+static const char *__doc_kp_Sequence_record_5 =
 R"doc(Record function for operation to be added to the GPU queue in batch.
 This template requires classes to be derived from the OpBase class.
 This function also requires the Sequence to be recording, otherwise it
@@ -642,38 +2330,261 @@ itself)doc";
 static const char *__doc_kp_Sequence_rerecord =
 R"doc(Clears command buffer and triggers re-record of all the current
 operations saved, which is useful if the underlying kp::Tensors or
-kp::Algorithms are modified and need to be re-recorded.)doc";
+kp::Algorithms are modified and need to be re-recorded. Submissions call
+it on their own when tensors of the operations were rebuilt since the
+operations were recorded.)doc";
+
+static const char *__doc_kp_Sequence_reset =
+R"doc(Resets the command buffers of the sequence and discards the operations
+recorded, keeping the command buffers allocated so the sequence can be
+recorded again cheaply. The sequence must not be running, and
+submissions whose wait timed out are waited for.)doc";
+
+static const char *__doc_kp_Sequence_setName =
+R"doc(Sets the name of the sequence, which names its command buffers and
+query pools through VK_EXT_debug_utils so they can be identified in
+captures of debugging and profiling tools. The commands of each
+operation are labelled with the label of the operation, or its type,
+whether the sequence is named or not.
+
+Parameter ``name``:
+    The name of the sequence)doc";
+
+static const char *__doc_kp_Sequence_timedOperationCount =
+R"doc(Returns the number of operations whose GPU time is latched, which is
+the number of timestamps the sequence was created with.
+
+Returns:
+    Number of operations timed, 0 without timestamps)doc";
 
 static const char *__doc_kp_Sequence_timestampQueryPool = R"doc()doc";
 
-static const char *__doc_kp_Shader = R"doc(Shader utily class with functions to compile and process glsl files.)doc";
-
-static const char *__doc_kp_Shader_compileSource =
-R"doc(Compile a single glslang source from string value. Currently this
-function uses the glslang C++ interface which is not thread safe so
-this funciton should not be called from multiple threads concurrently.
-If you have a online shader processing multithreading use-case that
-can't use offline compilation please open an issue.
-
-@param source An individual raw glsl shader in string format @param
-entryPoint The function name to use as entry point @param definitions
-List of pairs containing key value definitions @param resourcesLimit A
-list that contains the resource limits for the GLSL compiler @return
-The compiled SPIR-V binary in unsigned int32 format)doc";
-
-static const char *__doc_kp_Shader_compileSources =
-R"doc(Compile multiple sources with optional filenames. Currently this
-function uses the glslang C++ interface which is not thread safe so
-this funciton should not be called from multiple threads concurrently.
-If you have a online shader processing multithreading use-case that
-can't use offline compilation please open an issue.
-
-@param sources A list of raw glsl shaders in string format @param
-files A list of file names respective to each of the sources @param
-entryPoint The function name to use as entry point @param definitions
-List of pairs containing key value definitions @param resourcesLimit A
-list that contains the resource limits for the GLSL compiler @return
-The compiled SPIR-V binary in unsigned int32 format)doc";
+static const char *__doc_kp_Shader =
+R"doc(Compiles GLSL or HLSL compute shaders into SPIR-V within the process
+through the glslang library, which is linked when Kompute is built with
+KOMPUTE_OPT_ENABLE_SHADER_COMPILER.
+
+The SPIR-V is cached in memory, and optionally on disk, by a hash of the
+source together with the compile options, so a shader generated again
+with the same source is only compiled once. The on-disk cache is also
+read when the compiler is not linked, so shaders compiled ahead of time
+can be shipped in the cache directory. All the functions are thread
+safe.)doc";
+
+static const char *__doc_kp_Shader_Language = R"doc(Language of the source of a shader.)doc";
+
+static const char *__doc_kp_Shader_Language_eGlsl = R"doc()doc";
+
+static const char *__doc_kp_Shader_Language_eHlsl = R"doc()doc";
+
+static const char *__doc_kp_Shader_cacheDirectory =
+R"doc(Gets the directory of the on-disk cache.
+
+@return The directory of the cache, empty if disabled)doc";
+
+static const char *__doc_kp_Shader_clearCache =
+R"doc(Removes every shader from the in-memory cache, leaving the on-disk
+cache untouched.)doc";
+
+static const char *__doc_kp_Shader_compile =
+R"doc(Compiles a compute shader into SPIR-V for the Vulkan version of
+KOMPUTE_VK_API_VERSION, or returns the cached SPIR-V of the same
+source and options.
+
+@param source The source of the compute shader @param definitions The
+preprocessor definitions as pairs of names and values, defined in
+order before the source @param language The language of the source
+@param entryPoint The name of the entry point function @return The
+compiled SPIR-V)doc";
+
+static const char *__doc_kp_Shader_compilerAvailable =
+R"doc(Whether Kompute was built with the glslang compiler, without which
+only the shaders already in the on-disk cache can be compiled.
+
+@return Boolean stating whether shaders can be compiled)doc";
+
+static const char *__doc_kp_Shader_key =
+R"doc(Builds the key of the compiled SPIR-V in the caches, made of the hex
+digits of a hash of the source, the definitions, the language, the
+entry point and the target Vulkan version.
+
+@param source The source of the compute shader @param definitions The
+preprocessor definitions @param language The language of the source
+@param entryPoint The name of the entry point function @return The key
+of the SPIR-V, which is also its file name in the on-disk cache)doc";
+
+static const char *__doc_kp_Shader_setCacheDirectory =
+R"doc(Sets the directory of the on-disk cache, which has to exist, where
+the SPIR-V of every compiled shader is stored as a <key>.spv file.
+
+@param directory The directory of the cache, or an empty string to
+disable the on-disk cache, which is disabled by default)doc";
+
+static const char *__doc_kp_SparseTensor =
+R"doc(Sparse matrix in compressed sparse row (CSR) format, made of three
+tensors: the row pointers, holding the index of the first non zero of
+each row followed by the number of non zeros, the column index of each
+non zero and the value of each non zero. Only the non zeros are stored
+and transferred, which is what makes very sparse matrices cheaper than
+dense tensors.
+
+The tensors are synced like any other tensor, for example recording
+OpTensorSyncDevice with the tensors returned by tensors().)doc";
+
+static const char *__doc_kp_SparseTensor_SparseTensor =
+R"doc(Constructor from the tensors of a CSR matrix, which are not copied.
+
+@param rowPointers Unsigned int tensor of at least rows + 1 elements
+@param columnIndices Unsigned int tensor of the column of each non zero
+@param values Float tensor of the value of each non zero @param rows The
+number of rows of the matrix @param columns The number of columns of the
+matrix @param nonZeroCount The number of non zeros of the matrix, which
+the column indices and values tensors hold at least, or a single element
+for matrices without non zeros)doc";
+
+static const char *__doc_kp_SparseTensor_rowPointers =
+R"doc(Retrieve the row pointers tensor.
+
+@return Tensor of the index of the first non zero of each row)doc";
+
+static const char *__doc_kp_SparseTensor_columnIndices =
+R"doc(Retrieve the column indices tensor.
+
+@return Tensor of the column of each non zero)doc";
+
+static const char *__doc_kp_SparseTensor_values =
+R"doc(Retrieve the values tensor.
+
+@return Tensor of the value of each non zero)doc";
+
+static const char *__doc_kp_SparseTensor_tensors =
+R"doc(Retrieve the tensors of the matrix, to sync them or bind them to an
+algorithm.
+
+@return The row pointers, column indices and values tensors)doc";
+
+static const char *__doc_kp_SparseTensor_rows =
+R"doc(Retrieve the number of rows of the matrix.
+
+@return Number of rows)doc";
+
+static const char *__doc_kp_SparseTensor_columns =
+R"doc(Retrieve the number of columns of the matrix.
+
+@return Number of columns)doc";
+
+static const char *__doc_kp_SparseTensor_nonZeroCount =
+R"doc(Retrieve the number of non zeros of the matrix.
+
+@return Number of non zeros)doc";
+
+static const char *__doc_kp_SparseTensor_validate =
+R"doc(Checks that host arrays describe a valid CSR matrix, with row pointers
+starting at 0, never decreasing and ending at the number of non zeros,
+and column indices within the columns, so shaders never read out of the
+bounds of the tensors.
+
+@param rows The number of rows of the matrix @param columns The number
+of columns of the matrix @param nonZeroCount The number of non zeros of
+the matrix @param rowPointers Array of rows + 1 row pointers @param
+columnIndices Array of nonZeroCount column indices)doc";
+
+static const char *__doc_kp_StreamPipeline =
+R"doc(Pipeline streaming data larger than the memory of the device through
+an algorithm in chunks, so the transfers of a chunk overlap with the
+dispatch of the others instead of leaving the device idle.
+
+Each slot of the pipeline holds the tensors of a chunk and an algorithm
+bound to them. Up to one chunk per slot is in flight, so with three
+slots the upload of a chunk, the dispatch of the previous one and the
+download of the one before can run at the same time. When the slots
+have sequences on a transfer queue, the uploads and downloads run on
+that queue and are chained to the dispatches on the compute queue by
+timeline semaphores. Otherwise each chunk runs as a single sequence,
+and only the host side of the transfers overlaps with the device.)doc";
+
+static const char *__doc_kp_StreamPipeline_Slot = R"doc(Resources of one chunk in flight.)doc";
+
+static const char *__doc_kp_StreamPipeline_StreamPipeline =
+R"doc(Constructor recording the operations of each slot into its sequences.
+The uploads and downloads are recorded into the compute sequence of
+the slots without upload and download sequences.
+
+@param slots The resources of the chunks that can be in flight at the
+same time, usually two or three @param chunkSize The number of
+elements of each tensor of the slots)doc";
+
+static const char *__doc_kp_StreamPipeline_chunkSize =
+R"doc(Returns the number of elements of each tensor of a chunk.
+
+@return Number of elements per chunk)doc";
+
+static const char *__doc_kp_StreamPipeline_depth =
+R"doc(Returns the number of chunks that can be in flight at the same time.
+
+@return Number of slots)doc";
+
+static const char *__doc_kp_StreamPipeline_destroy =
+R"doc(Waits for the chunks in flight and releases the resources of the
+slots.)doc";
+
+static const char *__doc_kp_StreamPipeline_hasTransferQueue =
+R"doc(Checks whether the transfers run on a queue of their own, so they
+overlap with the dispatches on the device.
+
+@return Boolean stating whether the slots have transfer sequences)doc";
+
+static const char *__doc_kp_StreamPipeline_run =
+R"doc(Streams the chunks of the source through the algorithm until the
+source is exhausted, passing the outputs of each chunk to the sink.
+The elements of the inputs past the count returned by the source are
+set to zero. An exception thrown by the source or the sink is rethrown
+once the chunks in flight completed.
+
+@param source The function filling the inputs of each chunk @param
+sink The function consuming the outputs of each chunk @return Number
+of chunks processed)doc";
+
+static const char *__doc_kp_SubmitBatch =
+R"doc(Handle to a group of sequences submitted together, which can be
+awaited as a whole instead of calling evalAwait on each of the
+sequences.
+
+The sequences targeting the same queue are sent with a single queue
+submit containing one submit info per sequence, and signal a single
+fence.)doc";
+
+static const char *__doc_kp_SubmitBatch_await =
+R"doc(Waits for every submission of the batch to finish processing and then
+runs the postEval of the operations of each sequence, retiring their
+submissions as evalAwait would.
+
+@param waitFor Number of nanoseconds to wait before timing out @return
+Boolean stating whether the batch completed within the timeout)doc";
+
+static const char *__doc_kp_SubmitBatch_destroy =
+R"doc(Waits for the submissions of the batch and destroys its fences. The
+submissions remain in flight on their sequences until awaited.)doc";
+
+static const char *__doc_kp_SubmitBatch_isComplete =
+R"doc(Checks without blocking whether every submission of the batch has
+finished executing on the GPU.
+
+@return Boolean stating whether the GPU has finished the batch)doc";
+
+static const char *__doc_kp_SubmitBatch_queueSubmitCount =
+R"doc(Returns the number of queue submits performed by the batch, one for
+each distinct queue targeted by its sequences.
+
+@return Number of queue submits of the batch)doc";
+
+static const char *__doc_kp_SubmitBatch_submit =
+R"doc(Submits the recorded operations of every sequence provided, grouped in
+a single queue submit per queue. Each sequence is submitted as with
+evalAsync, so it must have a free submission within its in flight
+depth.
+
+@param sequences The sequences to submit, in the order of submission)doc";
 
 static const char *__doc_kp_Tensor =
 R"doc(Structured data used in GPU operations.
@@ -683,6 +2594,92 @@ across GPUs. Each tensor would have a respective Vulkan memory and
 buffer, which would be used to store their respective data. The
 tensors can be used for GPU data storage or transfer.)doc";
 
+static const char *__doc_kp_TensorArchive =
+R"doc(Archive of named tensors in a single file, such as the weights of a
+model, which is memory mapped when opened so the data of the tensors is
+copied straight from the page cache into their host visible memory.
+
+The file starts with a header holding the name, data type, shape, offset
+and size of each entry, followed by the data of the entries, each
+starting at an offset aligned to KOMPUTE_TENSOR_ARCHIVE_ALIGNMENT bytes.
+All the values are stored in the byte order of the host.)doc";
+
+static const char *__doc_kp_TensorArchive_Entry = R"doc(Description of a tensor stored in the archive.)doc";
+
+static const char *__doc_kp_TensorArchive_Entry_dataType = R"doc(Data type of the elements)doc";
+
+static const char *__doc_kp_TensorArchive_Entry_name = R"doc(Unique name of the tensor)doc";
+
+static const char *__doc_kp_TensorArchive_Entry_offset = R"doc(Offset in bytes of the data)doc";
+
+static const char *__doc_kp_TensorArchive_Entry_shape = R"doc(Extents in row major order)doc";
+
+static const char *__doc_kp_TensorArchive_Entry_size = R"doc(Size in bytes of the data)doc";
+
+static const char *__doc_kp_TensorArchive_TensorArchive =
+R"doc(Constructor which maps the file of the archive and reads its header. The
+data of the entries is only read from disk when it is accessed.
+
+@param path The file of the archive)doc";
+
+static const char *__doc_kp_TensorArchive_close =
+R"doc(Unmaps the file of the archive. Pointers returned by data are no longer
+valid, while tensors loaded from the archive are not affected.)doc";
+
+static const char *__doc_kp_TensorArchive_data =
+R"doc(Returns the mapped data of an entry, which remains valid until the
+archive is closed.
+
+@param entry An entry of the archive @return Pointer to the data of the
+entry)doc";
+
+static const char *__doc_kp_TensorArchive_entries =
+R"doc(Returns the entries of the archive, in the order they were written.
+
+@return The entries of the archive)doc";
+
+static const char *__doc_kp_TensorArchive_find =
+R"doc(Looks up the entry of a tensor by name.
+
+@param name The name of the tensor @param entry The entry to fill if
+found @return Boolean stating whether the archive holds the tensor)doc";
+
+static const char *__doc_kp_TensorArchive_isOpen =
+R"doc(Returns true while the file of the archive is mapped.
+
+@return Boolean stating whether the archive is open)doc";
+
+static const char *__doc_kp_TensorArchive_load =
+R"doc(Creates a tensor of the manager for each entry, or for the entries
+named, copying their data from the mapped file into the host visible
+memory of the tensors sub-allocated from the memory pool of the manager.
+Device tensors are then uploaded together by a single
+OpTensorSyncDevice, so the data is copied once on the host and
+transferred in one submission.
+
+@param manager The manager creating the tensors @param tensorType The
+type of the tensors, eDevice or eHost @param hostMemoryType The type of
+host visible memory of the tensors @param names (Optional) The names of
+the tensors to load, all the entries when empty @return The tensors
+created, by name)doc";
+
+static const char *__doc_kp_TensorArchive_write =
+R"doc(Writes an archive holding the data provided. The offsets and sizes of
+the entries are ignored and computed from their shapes and data types.
+
+@param path The file to write @param entries The name, data type and
+shape of each tensor @param data The data of each tensor, in the order
+of the entries)doc";
+
+static const char *__doc_kp_TensorArchive_write_2 =
+R"doc(Writes an archive holding the host data of tensors, which has to be
+synced with OpTensorSyncLocal first for device tensors.
+
+@param path The file to write @param names The unique name of each
+tensor @param tensors The tensors to store @param shapes (Optional) The
+shape of each tensor, a single extent of the size of the tensor when not
+provided)doc";
+
 static const char *__doc_kp_TensorT = R"doc()doc";
 
 static const char *__doc_kp_TensorT_TensorT = R"doc()doc";
@@ -715,15 +2712,39 @@ static const char *__doc_kp_Tensor_TensorDataTypes_eDouble = R"doc()doc";
 
 static const char *__doc_kp_Tensor_TensorDataTypes_eFloat = R"doc()doc";
 
+static const char *__doc_kp_Tensor_TensorDataTypes_eHalf = R"doc(kp::Half, requires 16 bit storage in shaders)doc";
+
 static const char *__doc_kp_Tensor_TensorDataTypes_eInt = R"doc()doc";
 
+static const char *__doc_kp_Tensor_TensorDataTypes_eInt16 = R"doc(int16_t, requires 16 bit storage in shaders)doc";
+
+static const char *__doc_kp_Tensor_TensorDataTypes_eInt8 = R"doc(int8_t, requires 8 bit storage in shaders)doc";
+
 static const char *__doc_kp_Tensor_TensorDataTypes_eUnsignedInt = R"doc()doc";
 
+static const char *__doc_kp_Tensor_TensorDataTypes_eUnsignedInt8 = R"doc(uint8_t, requires 8 bit storage in shaders)doc";
+
+static const char *__doc_kp_Tensor_HostMemoryTypes =
+R"doc(Type of host visible memory used for the staging memory of device
+tensors, or the primary memory of host tensors. Cached memory speeds up
+reading the data on the host after a sync, at the cost of explicitly
+flushing and invalidating the memory when it is not coherent. Imported
+memory uses the data pointer provided directly as the memory of the
+tensor, in which case the pointer must outlive the tensor.)doc";
+
+static const char *__doc_kp_Tensor_HostMemoryTypes_eCached = R"doc(< Host cached memory, falls back to coherent memory)doc";
+
+static const char *__doc_kp_Tensor_HostMemoryTypes_eImported = R"doc(< Data pointer imported, falls back to a copy)doc";
+
+static const char *__doc_kp_Tensor_HostMemoryTypes_eCoherent = R"doc(< Host coherent memory, usually uncached for reads)doc";
+
 static const char *__doc_kp_Tensor_TensorTypes =
 R"doc(Type for tensors created: Device allows memory to be transferred from
 staging buffers. Staging are host memory visible. Storage are device
 visible but are not set up to transfer or receive data (only for
-shader storage).)doc";
+shader storage). Uniform are host coherent memory read by shaders as a
+uniform buffer, so parameters written on the host before a submission
+are seen by sequences recorded once, without syncing or re-recording.)doc";
 
 static const char *__doc_kp_Tensor_TensorTypes_eDevice = R"doc(< Type is device memory, source and destination)doc";
 
@@ -731,10 +2752,18 @@ static const char *__doc_kp_Tensor_TensorTypes_eHost = R"doc(< Type is host memo
 
 static const char *__doc_kp_Tensor_TensorTypes_eStorage = R"doc(< Type is Device memory (only))doc";
 
+static const char *__doc_kp_Tensor_TensorTypes_eUniform = R"doc(< Type is host memory bound as a uniform buffer)doc";
+
 static const char *__doc_kp_Tensor_allocateBindMemory = R"doc()doc";
 
 static const char *__doc_kp_Tensor_allocateMemoryCreateGPUResources = R"doc()doc";
 
+static const char *__doc_kp_Tensor_capacity =
+R"doc(Returns the number of elements the buffers and memory of the tensor
+can hold, which is never smaller than the size of the tensor.
+
+@return Unsigned integer representing the capacity in elements)doc";
+
 static const char *__doc_kp_Tensor_constructDescriptorBufferInfo =
 R"doc(Constructs a vulkan descriptor buffer info which can be used to
 specify and reference the underlying buffer component of the tensor
@@ -753,9 +2782,47 @@ R"doc(Retrieve the underlying data type of the Tensor
 
 static const char *__doc_kp_Tensor_dataTypeMemorySize = R"doc()doc";
 
+static const char *__doc_kp_Tensor_descriptorType =
+R"doc(Retrieve the type of descriptor the tensor is bound with by
+algorithms, which is a uniform buffer for uniform tensors and a storage
+buffer otherwise.
+
+@return Descriptor type of the buffer of the tensor)doc";
+
 static const char *__doc_kp_Tensor_destroy =
 R"doc(Destroys and frees the GPU resources which include the buffer and
-memory.)doc";
+memory. The views aliasing the tensor are destroyed first.)doc";
+
+static const char *__doc_kp_Tensor_deviceAddress =
+R"doc(Retrieve the device address of the tensor data, offset for views, which
+shaders dereference through GL_EXT_buffer_reference. This requires the
+manager to be created with VK_KHR_buffer_device_address in its desired
+extensions, and is not supported by image tensors.
+
+@return Device address of the first element of the tensor)doc";
+
+static const char *__doc_kp_Tensor_dlpack =
+R"doc(Export the host memory of the tensor as a DLPack capsule, so
+libraries such as numpy or PyTorch can wrap it without a copy. The
+memory of device tensors is their staging memory, which holds the data
+of the last OpTensorSyncLocal. The capsule keeps the tensor alive.
+
+Returns:
+    DLPack capsule of the host memory of the tensor)doc";
+
+static const char *__doc_kp_Tensor_dlpackDevice =
+R"doc(Retrieve the DLPack device of the memory exported by __dlpack__,
+which is always host memory.
+
+Returns:
+    Tuple of the DLPack device type and device index)doc";
+
+static const char *__doc_kp_Tensor_generation =
+R"doc(Returns a counter incremented whenever the size or buffers of the
+tensor change, which allows the algorithms bound to the tensor to find
+out whether their descriptors have to be refreshed.
+
+@return Unsigned integer identifying the current buffers and size)doc";
 
 static const char *__doc_kp_Tensor_getPrimaryBufferUsageFlags = R"doc()doc";
 
@@ -765,6 +2832,17 @@ static const char *__doc_kp_Tensor_getStagingBufferUsageFlags = R"doc()doc";
 
 static const char *__doc_kp_Tensor_getStagingMemoryPropertyFlags = R"doc()doc";
 
+static const char *__doc_kp_Tensor_hostMemoryType =
+R"doc(Retrieve the host memory type requested for the Tensor
+
+@return Host memory type of tensor)doc";
+
+static const char *__doc_kp_Tensor_isView =
+R"doc(Check whether the tensor is a view aliasing the memory of a parent
+tensor.
+
+@return Boolean stating whether the tensor is a view)doc";
+
 static const char *__doc_kp_Tensor_isInit =
 R"doc(Check whether tensor is initialized based on the created gpu
 resources.
@@ -805,14 +2883,53 @@ static const char *__doc_kp_Tensor_mapRawData = R"doc()doc";
 
 static const char *__doc_kp_Tensor_memorySize = R"doc()doc";
 
+static const char *__doc_kp_Tensor_name =
+R"doc(Retrieve the name of the tensor set with setName.
+
+Returns:
+    Name of the tensor, empty if it was not named)doc";
+
+static const char *__doc_kp_Tensor_parent =
+R"doc(Retrieve the tensor owning the memory a view aliases. Views of views
+share the same parent.
+
+@return Parent tensor of the view, null if the tensor is not a view)doc";
+
+static const char *__doc_kp_Tensor_queueFamilyIndices =
+R"doc(Retrieve the queue families the buffers of the tensor are shared
+between with concurrent sharing.
+
+@return Distinct queue family indices, empty if the buffers are
+exclusive to a single queue family)doc";
+
 static const char *__doc_kp_Tensor_rawData = R"doc()doc";
 
 static const char *__doc_kp_Tensor_rebuild =
 R"doc(Function to trigger reinitialisation of the tensor buffer and memory
-with new data as well as new potential device type.
-
-@param data Vector of data to use to initialise vector from @param
-tensorType The type to use for the tensor)doc";
+with new data as well as new potential device type. Similar to
+std::vector, the buffers and memory are kept when the new data fits
+within the capacity of the tensor, in which case only the size and data
+are updated. Sequences recorded with the tensor must not be running
+during a rebuild, and record their operations again when they are next
+submitted. Algorithms bound to the tensor then rewrite their descriptor
+set in place, so no sequence that recorded them may be running at that
+point either. Tensors aliased by views can only be rebuilt within their
+capacity.
+
+@param data Pointer to the data to initialise the tensor with, which can
+be null to leave the memory uninitialised @param elementTotalCount
+Number of elements of the tensor @param elementMemorySize Size in bytes
+of a single element)doc";
+
+static const char *__doc_kp_Tensor_reserve =
+R"doc(Grows the capacity of the tensor to fit at least the number of elements
+provided, so later rebuilds up to that size keep the same buffers. The
+host data is preserved, but the device memory is reallocated without
+copying its contents. Does nothing if the capacity is already enough.
+Sequences recorded with the tensor are subject to the same restrictions
+as for rebuild. Tensors aliased by views cannot grow.
+
+@param elementCapacity Number of elements to reserve memory for)doc";
 
 static const char *__doc_kp_Tensor_recordBufferMemoryBarrier =
 R"doc(Records the buffer memory barrier into the command buffer which
@@ -836,6 +2953,18 @@ a staging buffer transfer, or to gather output (between others).
 createBarrier Whether to create a barrier that ensures the data is
 copied before further operations. Default is true.)doc";
 
+static const char *__doc_kp_Tensor_recordCopyTo =
+R"doc(Records copies from the memory of the current tensor into several
+tensors, as recordCopyFrom does for each of them, but computing the copy
+regions of the ranges once and only moving their destination offset for
+each buffer, so broadcasting to many tensors only records the copy
+commands. The current tensor is skipped if it is one of the tensors
+provided.
+
+@param commandBuffer Vulkan Command Buffer to record the commands into
+@param copyToTensors Tensors to copy the data into @param ranges Element
+ranges to copy, the whole tensor if empty)doc";
+
 static const char *__doc_kp_Tensor_recordCopyFromDeviceToStaging =
 R"doc(Records a copy from the internal device memory to the staging memory
 using an optional barrier to wait for the operation. This function
@@ -854,6 +2983,16 @@ would only be relevant for kp::Tensors of type eDevice.
 @param createBarrier Whether to create a barrier that ensures the data
 is copied before further operations. Default is true.)doc";
 
+static const char *__doc_kp_Tensor_setName =
+R"doc(Sets the name of the tensor, which names its buffers through
+VK_EXT_debug_utils so they can be identified in captures of debugging
+and profiling tools. The staging buffer is named with a " (staging)"
+suffix, and the buffers keep the name through rebuilds. Views do not
+own their buffers, so their name is only stored.
+
+Parameter ``name``:
+    The name of the tensor)doc";
+
 static const char *__doc_kp_Tensor_setRawData =
 R"doc(Sets / resets the vector data of the tensor. This function does not
 perform any copies into GPU memory and is only performed on the host.)doc";
@@ -873,6 +3012,267 @@ static const char *__doc_kp_Tensor_unmapRawData = R"doc()doc";
 
 static const char *__doc_kp_Tensor_vector = R"doc()doc";
 
+static const char *__doc_kp_Tracer =
+R"doc(Process wide tracer recording the CPU spans of the record, submission
+and rebuild functions of Kompute, together with the GPU spans of the
+operations of the sequences with timestamps, on one timeline written
+as a Chrome trace that can be opened in Perfetto or chrome://tracing.
+
+The tracer is disabled by default, in which case a span costs a
+relaxed atomic load. The GPU spans are recorded when a sequence
+created with timestamps is awaited through evalAwait. Their timestamps
+are converted to the host clock with VK_EXT_calibrated_timestamps when
+the extension is enabled on the device, and otherwise by aligning the
+end of the last operation with the time its fence was seen signaled,
+which is the upper bound of its completion.)doc";
+
+static const char *__doc_kp_Tracer_Span =
+R"doc(Guard recording a CPU span from its construction to its destruction
+on the current thread, when the tracer is enabled at construction.)doc";
+
+static const char *__doc_kp_Tracer_Span_Span =
+R"doc(Starts the span.
+
+Parameter ``name``:
+    Name of the span, which must outlive the tracer events such as a
+    string literal)doc";
+
+static const char *__doc_kp_Tracer_chromeTrace =
+R"doc(Returns the spans recorded as a Chrome trace, in the JSON object
+format of the Trace Event Format, with the CPU spans grouped by thread
+and the GPU spans grouped by queue family.
+
+Returns:
+    JSON of the trace)doc";
+
+static const char *__doc_kp_Tracer_eventCount =
+R"doc(Returns the number of spans recorded since the last start.
+
+Returns:
+    Number of spans)doc";
+
+static const char *__doc_kp_Tracer_isEnabled =
+R"doc(Checks whether the tracer is recording.
+
+Returns:
+    Boolean stating whether the tracer is enabled)doc";
+
+static const char *__doc_kp_Tracer_now =
+R"doc(Current time of the clock of the spans, which is the steady clock of
+the host.
+
+Returns:
+    Nanoseconds since the epoch of the steady clock)doc";
+
+static const char *__doc_kp_Tracer_recordCpuSpan =
+R"doc(Records a span of the current thread.
+
+Parameter ``name``:
+    Name of the span, which must outlive the tracer events
+
+Parameter ``startNs``:
+    Start of the span, from now
+
+Parameter ``endNs``:
+    End of the span, from now)doc";
+
+static const char *__doc_kp_Tracer_recordGpuSpan =
+R"doc(Records a span of work of a queue of the device.
+
+Parameter ``name``:
+    Name of the span
+
+Parameter ``queueFamilyIndex``:
+    The queue family the work ran on, which is the track of the span
+
+Parameter ``startNs``:
+    Start of the span on the host clock, from now
+
+Parameter ``endNs``:
+    End of the span on the host clock, from now)doc";
+
+static const char *__doc_kp_Tracer_start =
+R"doc(Clears the events recorded and starts recording.)doc";
+
+static const char *__doc_kp_Tracer_stop =
+R"doc(Stops recording, keeping the events recorded until the next start.)doc";
+
+static const char *__doc_kp_Tracer_writeChromeTrace =
+R"doc(Writes the spans recorded as a Chrome trace, see chromeTrace.
+
+Parameter ``path``:
+    The file to write the trace to)doc";
+
+static const char *__doc_kp_Tuner =
+R"doc(Auto-tuner choosing the workgroup and specialization constants of an
+algorithm, such as its local size or tile size, for an input shape.
+Each candidate is built and timed with the GPU timestamps of a sequence
+through the benchmark harness, and the algorithm is left built with the
+fastest.
+
+The choices are kept in a tuning database keyed by the device, the name
+of the algorithm and the shape, which is loaded from a file when the
+tuner is created and written back after each new choice. Later runs of
+the application on the same device and driver reuse the choices without
+timing the candidates again.)doc";
+
+static const char *__doc_kp_Tuner_Candidate = R"doc(Configuration of the algorithm tried by the tuner.)doc";
+
+static const char *__doc_kp_Tuner_Candidate_specializationConstants = R"doc(Raw 32 bit values)doc";
+
+static const char *__doc_kp_Tuner_Candidate_workgroup = R"doc(Computed by the algorithm if all zero)doc";
+
+static const char *__doc_kp_Tuner_Result = R"doc(Choice of the tuner for an algorithm and shape.)doc";
+
+static const char *__doc_kp_Tuner_Result_cached = R"doc(Whether it was found in the database)doc";
+
+static const char *__doc_kp_Tuner_Result_candidate = R"doc(Fastest candidate)doc";
+
+static const char *__doc_kp_Tuner_Result_medianNs = R"doc(Median GPU time of the fastest candidate)doc";
+
+static const char *__doc_kp_Tuner_Tuner =
+R"doc(Constructor for a tuner of the device of a manager, loading the
+database if a path is provided.
+
+Parameter ``manager``:
+    The manager creating the sequences timing the candidates
+
+Parameter ``databasePath``:
+    (Optional) File of the tuning database, loaded if it exists and
+    written after each new choice
+
+Parameter ``warmup``:
+    Number of evaluations of a candidate before the timed ones
+
+Parameter ``repetitions``:
+    Number of timed evaluations of a candidate)doc";
+
+static const char *__doc_kp_Tuner_candidate =
+R"doc(Builds a candidate from specialization constants of any 32 bit type,
+which are stored as their raw values.
+
+Parameter ``workgroup``:
+    The workgroup of the dispatch, computed by the algorithm if all zero
+
+Parameter ``specializationConstants``:
+    The specialization constants, or empty to keep the ones of the
+    algorithm
+
+Returns:
+    The candidate)doc";
+
+static const char *__doc_kp_Tuner_deviceKey =
+R"doc(Identifier of the device in the database, made of its vendor, device
+and driver version, as the fastest configuration depends on all three.
+
+Returns:
+    The identifier of the device of the manager)doc";
+
+static const char *__doc_kp_Tuner_find =
+R"doc(Looks up the choice of the database for the device, name and shape.
+
+Parameter ``name``:
+    Name of the algorithm in the database
+
+Parameter ``shape``:
+    Shape of the input the choice was made for
+
+Parameter ``result``:
+    The result to fill with the choice if found
+
+Returns:
+    Boolean stating whether there is a choice)doc";
+
+static const char *__doc_kp_Tuner_load =
+R"doc(Loads the choices of a database file, replacing the ones with the same
+device, name and shape. The choices of other devices are kept so they
+are written back when saving.
+
+Parameter ``path``:
+    The file to load, which is ignored if it does not exist)doc";
+
+static const char *__doc_kp_Tuner_save =
+R"doc(Writes the choices of all devices to a database file.
+
+Parameter ``path``:
+    The file to write, or the database path of the tuner if empty)doc";
+
+static const char *__doc_kp_Tuner_size =
+R"doc(Returns the number of choices of the database, of all devices.
+
+Returns:
+    Number of choices)doc";
+
+static const char *__doc_kp_Tuner_tune =
+R"doc(Chooses the fastest candidate for the algorithm and shape, and
+rebuilds the algorithm with it. The choice of the database is used if
+there is one for the device, name and shape, otherwise each candidate
+is timed dispatching the algorithm with its current tensors and push
+constants. Candidates exceeding the limits of the device, or whose
+pipeline fails to build, are skipped.
+
+Parameter ``algorithm``:
+    The algorithm to tune, left built with the choice
+
+Parameter ``name``:
+    Name of the algorithm in the database, such as the name of its
+    shader
+
+Parameter ``shape``:
+    Shape of the input the choice is made for
+
+Parameter ``candidates``:
+    The candidates to try
+
+Parameter ``retune``:
+    Whether to time the candidates even if the database has a choice
+    already
+
+Returns:
+    The choice for the algorithm and shape)doc";
+
+static const char *__doc_kp_abs = R"doc()doc";
+
+static const char *__doc_kp_exp = R"doc()doc";
+
+static const char *__doc_kp_expr =
+R"doc(Starts an expression from a tensor, as in kp::expr(a) * b + c.
+
+@param tensor The float tensor to read @return Expression reading the
+tensor)doc";
+
+static const char *__doc_kp_log = R"doc()doc";
+
+static const char *__doc_kp_logLevel =
+R"doc(Runtime level of the messages logged without spdlog, which are neither
+formatted nor passed to the sink below it. It is a spdlog level, and
+defaults to SPDLOG_ACTIVE_LEVEL.
+
+Returns:
+    The level, shared by all the translation units)doc";
+
+static const char *__doc_kp_max = R"doc()doc";
+
+static const char *__doc_kp_min = R"doc()doc";
+
+static const char *__doc_kp_operator_add = R"doc()doc";
+
+static const char *__doc_kp_operator_div = R"doc()doc";
+
+static const char *__doc_kp_operator_mul = R"doc()doc";
+
+static const char *__doc_kp_operator_sub = R"doc()doc";
+
+static const char *__doc_kp_setLogLevel =
+R"doc(Sets the runtime level of the messages logged without spdlog, the
+equivalent of spdlog::set_level. Levels below SPDLOG_ACTIVE_LEVEL are
+compiled out regardless.
+
+Parameter ``level``:
+    A spdlog level, such as SPDLOG_LEVEL_WARN)doc";
+
+static const char *__doc_kp_sqrt = R"doc()doc";
+
 #if defined(__GNUG__)
 #pragma GCC diagnostic pop
 #endif
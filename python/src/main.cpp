@@ -1,5 +1,6 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <pybind11/functional.h>
 #include <pybind11/numpy.h>
 
 #include <kompute/Kompute.hpp>
@@ -7,6 +8,7 @@
 #include "fmt/ranges.h"
 
 #include "utils.hpp"
+#include "dlpack.hpp"
 #include "docstrings.hpp"
 
 namespace py = pybind11;
@@ -39,6 +41,73 @@ std::unique_ptr<kp::OpAlgoDispatch> opAlgoDispatchPyInit(
     }
 }
 
+std::unique_ptr<kp::OpAlgoDispatchBatch> opAlgoDispatchBatchPyInit(
+                        std::shared_ptr<kp::Algorithm>& algorithm,
+                        const py::array& push_consts,
+                        uint32_t constants_per_dispatch,
+                        bool barrier_between_dispatches) {
+    // Each row of a 2D array holds the push constants of a dispatch
+    if (push_consts.ndim() == 2) {
+        if (constants_per_dispatch != 1 && (py::ssize_t)constants_per_dispatch != push_consts.shape(1)) {
+            throw std::runtime_error(fmt::format(
+              "Kompute Python push_consts rows of {} elements do not match constants_per_dispatch {}",
+              push_consts.shape(1), constants_per_dispatch));
+        }
+        constants_per_dispatch = push_consts.shape(1);
+    } else if (push_consts.ndim() > 2) {
+        throw std::runtime_error("Kompute Python push_consts must have one or two dimensions");
+    }
+    const py::array contiguous = py::array::ensure(push_consts, py::array::c_style);
+    const py::buffer_info info        = contiguous.request();
+    KP_LOG_DEBUG("Kompute Python creating OpAlgoDispatchBatch with push_consts size {} dtype {}",
+            push_consts.size(), std::string(py::str(push_consts.dtype())));
+
+    if (push_consts.dtype() == py::dtype::of<std::float_t>()) {
+        std::vector<float> dataVec((float*)info.ptr, ((float*)info.ptr) + info.size);
+        return std::unique_ptr<kp::OpAlgoDispatchBatch>{new kp::OpAlgoDispatchBatch(
+          algorithm, dataVec, constants_per_dispatch, barrier_between_dispatches)};
+    } else if (push_consts.dtype() == py::dtype::of<std::uint32_t>()) {
+        std::vector<uint32_t> dataVec((uint32_t*)info.ptr, ((uint32_t*)info.ptr) + info.size);
+        return std::unique_ptr<kp::OpAlgoDispatchBatch>{new kp::OpAlgoDispatchBatch(
+          algorithm, dataVec, constants_per_dispatch, barrier_between_dispatches)};
+    } else if (push_consts.dtype() == py::dtype::of<std::int32_t>()) {
+        std::vector<int32_t> dataVec((int32_t*)info.ptr, ((int32_t*)info.ptr) + info.size);
+        return std::unique_ptr<kp::OpAlgoDispatchBatch>{new kp::OpAlgoDispatchBatch(
+          algorithm, dataVec, constants_per_dispatch, barrier_between_dispatches)};
+    } else if (push_consts.dtype() == py::dtype::of<std::double_t>()) {
+        std::vector<double> dataVec((double*)info.ptr, ((double*)info.ptr) + info.size);
+        return std::unique_ptr<kp::OpAlgoDispatchBatch>{new kp::OpAlgoDispatchBatch(
+          algorithm, dataVec, constants_per_dispatch, barrier_between_dispatches)};
+    } else {
+        throw std::runtime_error("Kompute Python no valid dtype supported");
+    }
+}
+
+py::object tensorFromBuffer(kp::Manager& manager,
+                            const py::array& data,
+                            const py::buffer_info& info,
+                            kp::Tensor::TensorDataTypes dataType,
+                            kp::Tensor::TensorTypes tensorType,
+                            kp::Tensor::HostMemoryTypes hostMemoryType) {
+    std::vector<int64_t> shape(info.shape.begin(), info.shape.end());
+    std::vector<int64_t> byteStrides(info.strides.begin(), info.strides.end());
+
+    // The data is copied to the device without the GIL, as the array is kept alive
+    std::shared_ptr<kp::Tensor> tensor;
+    {
+        py::gil_scoped_release release;
+        tensor = kp::py::tensorFromStrided(
+          manager, info.ptr, shape, byteStrides, dataType, tensorType, hostMemoryType);
+    }
+
+    // Imported memory is the memory of the array, which must outlive the tensor
+    py::object result = py::cast(tensor);
+    if (tensor->isHostMemoryImported()) {
+        py::detail::keep_alive_impl(result, data);
+    }
+    return result;
+}
+
 PYBIND11_MODULE(kp, m) {
 
     // The logging modules are used in the Kompute.hpp file
@@ -50,14 +119,36 @@ PYBIND11_MODULE(kp, m) {
     kp_error             = kp_logger.attr("error");
     logging.attr("basicConfig")();
 
+    // The messages below the level of the logger are skipped before being
+    // formatted, with the Python levels being ten times the spdlog levels
+    kp::setLogLevel(kp_logger.attr("getEffectiveLevel")().cast<int>() / 10);
+
     py::module_ np = py::module_::import("numpy");
 
     py::enum_<kp::Tensor::TensorTypes>(m, "TensorTypes")
         .value("device", kp::Tensor::TensorTypes::eDevice, DOC(kp, Tensor, TensorTypes, eDevice))
         .value("host", kp::Tensor::TensorTypes::eHost, DOC(kp, Tensor, TensorTypes, eHost))
         .value("storage", kp::Tensor::TensorTypes::eStorage, DOC(kp, Tensor, TensorTypes, eStorage))
+        .value("uniform", kp::Tensor::TensorTypes::eUniform, DOC(kp, Tensor, TensorTypes, eUniform))
+        .export_values();
+
+    py::enum_<kp::Tensor::HostMemoryTypes>(m, "HostMemoryTypes")
+        .value("coherent", kp::Tensor::HostMemoryTypes::eCoherent, DOC(kp, Tensor, HostMemoryTypes, eCoherent))
+        .value("cached", kp::Tensor::HostMemoryTypes::eCached, DOC(kp, Tensor, HostMemoryTypes, eCached))
+        .value("imported", kp::Tensor::HostMemoryTypes::eImported, DOC(kp, Tensor, HostMemoryTypes, eImported))
         .export_values();
 
+    py::enum_<kp::Tensor::TensorDataTypes>(m, "DataTypes")
+        .value("bool", kp::Tensor::TensorDataTypes::eBool, DOC(kp, Tensor, TensorDataTypes, eBool))
+        .value("int", kp::Tensor::TensorDataTypes::eInt, DOC(kp, Tensor, TensorDataTypes, eInt))
+        .value("uint", kp::Tensor::TensorDataTypes::eUnsignedInt, DOC(kp, Tensor, TensorDataTypes, eUnsignedInt))
+        .value("float", kp::Tensor::TensorDataTypes::eFloat, DOC(kp, Tensor, TensorDataTypes, eFloat))
+        .value("double", kp::Tensor::TensorDataTypes::eDouble, DOC(kp, Tensor, TensorDataTypes, eDouble))
+        .value("half", kp::Tensor::TensorDataTypes::eHalf, DOC(kp, Tensor, TensorDataTypes, eHalf))
+        .value("int8", kp::Tensor::TensorDataTypes::eInt8, DOC(kp, Tensor, TensorDataTypes, eInt8))
+        .value("uint8", kp::Tensor::TensorDataTypes::eUnsignedInt8, DOC(kp, Tensor, TensorDataTypes, eUnsignedInt8))
+        .value("int16", kp::Tensor::TensorDataTypes::eInt16, DOC(kp, Tensor, TensorDataTypes, eInt16));
+
     py::class_<kp::OpBase, std::shared_ptr<kp::OpBase>>(m, "OpBase", DOC(kp, OpBase));
 
     py::class_<kp::OpTensorSyncDevice, std::shared_ptr<kp::OpTensorSyncDevice>>(
@@ -68,9 +159,26 @@ PYBIND11_MODULE(kp, m) {
             m, "OpTensorSyncLocal", py::base<kp::OpBase>(), DOC(kp, OpTensorSyncLocal))
         .def(py::init<const std::vector<std::shared_ptr<kp::Tensor>>&>(), DOC(kp, OpTensorSyncLocal, OpTensorSyncLocal));
 
+    py::enum_<kp::OpTensorCopy::HostUpdate>(m, "CopyHostUpdate", DOC(kp, OpTensorCopy, HostUpdate))
+        .value("none", kp::OpTensorCopy::HostUpdate::eNone, DOC(kp, OpTensorCopy, HostUpdate, eNone))
+        .value("mirror", kp::OpTensorCopy::HostUpdate::eMirror, DOC(kp, OpTensorCopy, HostUpdate, eMirror))
+        .export_values();
+
     py::class_<kp::OpTensorCopy, std::shared_ptr<kp::OpTensorCopy>>(
             m, "OpTensorCopy", py::base<kp::OpBase>(), DOC(kp, OpTensorCopy))
-        .def(py::init<const std::vector<std::shared_ptr<kp::Tensor>>&>(), DOC(kp, OpTensorCopy, OpTensorCopy));
+        .def(py::init([](const std::vector<std::shared_ptr<kp::Tensor>>& tensors,
+                         kp::OpTensorCopy::HostUpdate host_update) {
+                return std::make_shared<kp::OpTensorCopy>(
+                  tensors, std::vector<kp::Tensor::Range>(), host_update);
+            }),
+            DOC(kp, OpTensorCopy, OpTensorCopy),
+            py::arg("tensors"), py::arg("host_update") = kp::OpTensorCopy::HostUpdate::eMirror);
+
+    py::class_<kp::OpTensorFill, std::shared_ptr<kp::OpTensorFill>>(
+            m, "OpTensorFill", py::base<kp::OpBase>(), DOC(kp, OpTensorFill))
+        .def(py::init<const std::vector<std::shared_ptr<kp::Tensor>>&, uint32_t>(),
+                DOC(kp, OpTensorFill, OpTensorFill),
+                py::arg("tensors"), py::arg("data") = 0);
 
     py::class_<kp::OpAlgoDispatch, std::shared_ptr<kp::OpAlgoDispatch>>(
             m, "OpAlgoDispatch", py::base<kp::OpBase>(), DOC(kp, OpAlgoDispatch))
@@ -81,16 +189,263 @@ PYBIND11_MODULE(kp, m) {
                 DOC(kp, OpAlgoDispatch, OpAlgoDispatch),
                 py::arg("algorithm"), py::arg("push_consts"));
 
+    py::class_<kp::OpAlgoDispatchIndirect, std::shared_ptr<kp::OpAlgoDispatchIndirect>>(
+            m, "OpAlgoDispatchIndirect", py::base<kp::OpBase>(), DOC(kp, OpAlgoDispatchIndirect))
+        .def(py::init<const std::shared_ptr<kp::Algorithm>&,
+                      const std::shared_ptr<kp::Tensor>&,
+                      vk::DeviceSize,
+                      const std::vector<float>&>(),
+                DOC(kp, OpAlgoDispatchIndirect, OpAlgoDispatchIndirect),
+                py::arg("algorithm"), py::arg("indirect_tensor"),
+                py::arg("offset") = 0, py::arg("push_consts") = std::vector<float>());
+
+    py::class_<kp::OpAlgoDispatchBatch, std::shared_ptr<kp::OpAlgoDispatchBatch>>(
+            m, "OpAlgoDispatchBatch", py::base<kp::OpBase>(), DOC(kp, OpAlgoDispatchBatch))
+        .def(py::init<const std::shared_ptr<kp::Algorithm>&,
+                      const std::vector<float>&,
+                      uint32_t,
+                      bool>(),
+                DOC(kp, OpAlgoDispatchBatch, OpAlgoDispatchBatch),
+                py::arg("algorithm"), py::arg("push_consts"),
+                py::arg("constants_per_dispatch") = 1,
+                py::arg("barrier_between_dispatches") = false)
+        .def(py::init(&opAlgoDispatchBatchPyInit),
+                DOC(kp, OpAlgoDispatchBatch, OpAlgoDispatchBatch),
+                py::arg("algorithm"), py::arg("push_consts"),
+                py::arg("constants_per_dispatch") = 1,
+                py::arg("barrier_between_dispatches") = false)
+        .def("dispatch_count", &kp::OpAlgoDispatchBatch::dispatchCount,
+                DOC(kp, OpAlgoDispatchBatch, dispatchCount));
+
     py::class_<kp::OpMult, std::shared_ptr<kp::OpMult>>(
             m, "OpMult", py::base<kp::OpBase>(), DOC(kp, OpMult))
         .def(py::init<const std::vector<std::shared_ptr<kp::Tensor>>&,const std::shared_ptr<kp::Algorithm>&>(),
                 DOC(kp, OpMult, OpMult));
 
+    py::class_<kp::OpMatMul, std::shared_ptr<kp::OpMatMul>>(
+            m, "OpMatMul", py::base<kp::OpBase>(), DOC(kp, OpMatMul))
+        .def(py::init<const std::vector<std::shared_ptr<kp::Tensor>>&,
+                      const std::shared_ptr<kp::Algorithm>&,
+                      uint32_t, uint32_t, uint32_t,
+                      bool, bool, uint32_t, uint32_t>(),
+                DOC(kp, OpMatMul, OpMatMul),
+                py::arg("tensors"), py::arg("algorithm"),
+                py::arg("m"), py::arg("n"), py::arg("k"),
+                py::arg("transpose_a") = false, py::arg("transpose_b") = false,
+                py::arg("batch_count") = 1, py::arg("tile_size") = 0)
+        .def_static("tile_size_for_device", [](kp::Manager& manager) {
+            return kp::OpMatMul::tileSizeForDevice(manager.getDeviceProperties());
+        }, DOC(kp, OpMatMul, tileSizeForDevice), py::arg("manager"));
+
+    py::enum_<kp::OpConv2D::Layout>(m, "ConvLayout")
+        .value("nchw", kp::OpConv2D::Layout::eNCHW, DOC(kp, OpConv2D, Layout, eNCHW))
+        .value("nhwc", kp::OpConv2D::Layout::eNHWC, DOC(kp, OpConv2D, Layout, eNHWC))
+        .export_values();
+
+    py::enum_<kp::OpConv2D::Activation>(m, "ConvActivation")
+        .value("none", kp::OpConv2D::Activation::eNone, DOC(kp, OpConv2D, Activation, eNone))
+        .value("relu", kp::OpConv2D::Activation::eRelu, DOC(kp, OpConv2D, Activation, eRelu))
+        .value("leaky_relu", kp::OpConv2D::Activation::eLeakyRelu, DOC(kp, OpConv2D, Activation, eLeakyRelu))
+        .export_values();
+
+    py::class_<kp::OpConv2D, std::shared_ptr<kp::OpConv2D>>(
+            m, "OpConv2D", py::base<kp::OpBase>(), DOC(kp, OpConv2D))
+        .def(py::init<const std::vector<std::shared_ptr<kp::Tensor>>&,
+                      const std::shared_ptr<kp::Algorithm>&,
+                      uint32_t, uint32_t, uint32_t, uint32_t, uint32_t,
+                      uint32_t, uint32_t, uint32_t, uint32_t,
+                      kp::OpConv2D::Layout, kp::OpConv2D::Activation,
+                      float, uint32_t>(),
+                DOC(kp, OpConv2D, OpConv2D),
+                py::arg("tensors"), py::arg("algorithm"), py::arg("batch"),
+                py::arg("in_channels"), py::arg("in_height"), py::arg("in_width"),
+                py::arg("out_channels"), py::arg("kernel_height"), py::arg("kernel_width"),
+                py::arg("stride") = 1, py::arg("padding") = 0,
+                py::arg("layout") = kp::OpConv2D::Layout::eNCHW,
+                py::arg("activation") = kp::OpConv2D::Activation::eNone,
+                py::arg("alpha") = 0.01f, py::arg("tile_size") = 0)
+        .def_static("output_size", &kp::OpConv2D::outputSize,
+                DOC(kp, OpConv2D, outputSize),
+                py::arg("in_size"), py::arg("kernel_size"),
+                py::arg("stride") = 1, py::arg("padding") = 0);
+
+    py::class_<kp::OpSpMV, std::shared_ptr<kp::OpSpMV>>(
+            m, "OpSpMV", py::base<kp::OpBase>(), DOC(kp, OpSpMV))
+        .def(py::init<const std::shared_ptr<kp::SparseTensor>&,
+                      const std::vector<std::shared_ptr<kp::Tensor>>&,
+                      const std::shared_ptr<kp::Algorithm>&,
+                      uint32_t>(),
+                DOC(kp, OpSpMV, OpSpMV),
+                py::arg("matrix"), py::arg("tensors"), py::arg("algorithm"),
+                py::arg("lanes_per_row") = 0)
+        .def_static("lanes_per_row_for", &kp::OpSpMV::lanesPerRowFor,
+                DOC(kp, OpSpMV, lanesPerRowFor),
+                py::arg("rows"), py::arg("non_zero_count"));
+
+    py::class_<kp::OpSpMM, std::shared_ptr<kp::OpSpMM>>(
+            m, "OpSpMM", py::base<kp::OpBase>(), DOC(kp, OpSpMM))
+        .def(py::init<const std::shared_ptr<kp::SparseTensor>&,
+                      const std::vector<std::shared_ptr<kp::Tensor>>&,
+                      const std::shared_ptr<kp::Algorithm>&,
+                      uint32_t>(),
+                DOC(kp, OpSpMM, OpSpMM),
+                py::arg("matrix"), py::arg("tensors"), py::arg("algorithm"),
+                py::arg("n"));
+
+    py::class_<kp::OpLogisticRegression, std::shared_ptr<kp::OpLogisticRegression>>(
+            m, "OpLogisticRegression", py::base<kp::OpBase>(), DOC(kp, OpLogisticRegression))
+        .def(py::init<const std::vector<std::shared_ptr<kp::Tensor>>&,
+                      const std::shared_ptr<kp::Algorithm>&,
+                      uint32_t,
+                      float>(),
+                DOC(kp, OpLogisticRegression, OpLogisticRegression),
+                py::arg("tensors"), py::arg("algorithm"), py::arg("epochs"),
+                py::arg("learning_rate") = 0.1f);
+
+    py::enum_<kp::OpReduce::Operation>(m, "ReduceOperation")
+        .value("sum", kp::OpReduce::Operation::eSum, DOC(kp, OpReduce, Operation, eSum))
+        .value("min", kp::OpReduce::Operation::eMin, DOC(kp, OpReduce, Operation, eMin))
+        .value("max", kp::OpReduce::Operation::eMax, DOC(kp, OpReduce, Operation, eMax))
+        .value("argmax", kp::OpReduce::Operation::eArgmax, DOC(kp, OpReduce, Operation, eArgmax))
+        .export_values();
+
+    py::class_<kp::OpReduce, std::shared_ptr<kp::OpReduce>>(
+            m, "OpReduce", py::base<kp::OpBase>(), DOC(kp, OpReduce))
+        .def(py::init<const std::vector<std::shared_ptr<kp::Tensor>>&,
+                      const std::shared_ptr<kp::Algorithm>&,
+                      kp::OpReduce::Operation,
+                      bool,
+                      bool>(),
+                DOC(kp, OpReduce, OpReduce),
+                py::arg("tensors"), py::arg("algorithm"),
+                py::arg("operation") = kp::OpReduce::Operation::eSum,
+                py::arg("subgroup_arithmetic") = false,
+                py::arg("sync_local") = false);
+
+    py::class_<kp::OpScan, std::shared_ptr<kp::OpScan>>(
+            m, "OpScan", py::base<kp::OpBase>(), DOC(kp, OpScan))
+        .def(py::init<const std::vector<std::shared_ptr<kp::Tensor>>&,
+                      const std::shared_ptr<kp::Algorithm>&,
+                      bool>(),
+                DOC(kp, OpScan, OpScan),
+                py::arg("tensors"), py::arg("algorithm"),
+                py::arg("inclusive") = true)
+        .def_static("partials_size", &kp::OpScan::partialsSize,
+                DOC(kp, OpScan, partialsSize), py::arg("size"));
+
+    py::class_<kp::OpCompact, std::shared_ptr<kp::OpCompact>>(
+            m, "OpCompact", py::base<kp::OpScan>(), DOC(kp, OpCompact))
+        .def(py::init<const std::vector<std::shared_ptr<kp::Tensor>>&,
+                      const std::shared_ptr<kp::Algorithm>&,
+                      uint32_t>(),
+                DOC(kp, OpCompact, OpCompact),
+                py::arg("tensors"), py::arg("algorithm"),
+                py::arg("indirect_local_size") = 1);
+
+    py::class_<kp::OpSort, std::shared_ptr<kp::OpSort>>(
+            m, "OpSort", py::base<kp::OpBase>(), DOC(kp, OpSort))
+        .def(py::init<const std::vector<std::shared_ptr<kp::Tensor>>&, kp::Manager&>(),
+                DOC(kp, OpSort, OpSort),
+                py::arg("tensors"), py::arg("manager"));
+
+    py::class_<kp::Expression>(m, "Expression", DOC(kp, Expression))
+        .def(py::init<const std::shared_ptr<kp::Tensor>&>(),
+                DOC(kp, Expression, Expression_2), py::arg("tensor"))
+        .def(py::init<float>(), DOC(kp, Expression, Expression_3),
+                py::arg("constant"))
+        .def("tensors", &kp::Expression::tensors, DOC(kp, Expression, tensors))
+        .def("constants", &kp::Expression::constants, DOC(kp, Expression, constants))
+        .def("signature", &kp::Expression::signature, DOC(kp, Expression, signature))
+        .def("__add__", [](const kp::Expression& self, const kp::Expression& other) { return self + other; })
+        .def("__add__", [](const kp::Expression& self, float other) { return self + other; })
+        .def("__radd__", [](const kp::Expression& self, float other) { return other + self; })
+        .def("__sub__", [](const kp::Expression& self, const kp::Expression& other) { return self - other; })
+        .def("__sub__", [](const kp::Expression& self, float other) { return self - other; })
+        .def("__rsub__", [](const kp::Expression& self, float other) { return other - self; })
+        .def("__mul__", [](const kp::Expression& self, const kp::Expression& other) { return self * other; })
+        .def("__mul__", [](const kp::Expression& self, float other) { return self * other; })
+        .def("__rmul__", [](const kp::Expression& self, float other) { return other * self; })
+        .def("__truediv__", [](const kp::Expression& self, const kp::Expression& other) { return self / other; })
+        .def("__truediv__", [](const kp::Expression& self, float other) { return self / other; })
+        .def("__rtruediv__", [](const kp::Expression& self, float other) { return other / self; })
+        .def("__neg__", [](const kp::Expression& self) { return -self; })
+        .def("__abs__", [](const kp::Expression& self) { return kp::abs(self); })
+        .def("min", [](const kp::Expression& self, const kp::Expression& other) { return kp::min(self, other); },
+                py::arg("other"))
+        .def("max", [](const kp::Expression& self, const kp::Expression& other) { return kp::max(self, other); },
+                py::arg("other"))
+        .def("abs", [](const kp::Expression& self) { return kp::abs(self); })
+        .def("sqrt", [](const kp::Expression& self) { return kp::sqrt(self); })
+        .def("exp", [](const kp::Expression& self) { return kp::exp(self); })
+        .def("log", [](const kp::Expression& self) { return kp::log(self); });
+
+    m.def("expr", &kp::expr, DOC(kp, expr), py::arg("tensor"));
+
+    m.def("set_log_level", [kp_logger](int level) {
+            kp_logger.attr("setLevel")(level);
+            kp::setLogLevel(level / 10);
+        }, DOC(kp, setLogLevel), py::arg("level"));
+
+    py::class_<kp::OpExpression, std::shared_ptr<kp::OpExpression>>(
+            m, "OpExpression", py::base<kp::OpBase>(), DOC(kp, OpExpression))
+        .def(py::init<const std::vector<std::shared_ptr<kp::Tensor>>&,
+                      const std::shared_ptr<kp::Algorithm>&,
+                      const kp::Expression&>(),
+                DOC(kp, OpExpression, OpExpression),
+                py::arg("tensors"), py::arg("algorithm"), py::arg("expression"));
+
+    py::enum_<kp::Algorithm::BindingModes>(m, "BindingModes", DOC(kp, Algorithm, BindingModes))
+        .value("descriptors", kp::Algorithm::BindingModes::eDescriptors, DOC(kp, Algorithm, BindingModes, eDescriptors))
+        .value("device_addresses", kp::Algorithm::BindingModes::eDeviceAddresses, DOC(kp, Algorithm, BindingModes, eDeviceAddresses))
+        .export_values();
+
     py::class_<kp::Algorithm, std::shared_ptr<kp::Algorithm>>(m, "Algorithm", DOC(kp, Algorithm, Algorithm))
         .def("get_tensors", &kp::Algorithm::getTensors, DOC(kp, Algorithm, getTensors))
+        .def("set_tensors", &kp::Algorithm::setTensors, DOC(kp, Algorithm, setTensors),
+                py::arg("tensors"))
+        .def("get_local_size_x", &kp::Algorithm::getLocalSizeX, DOC(kp, Algorithm, getLocalSizeX))
+        .def("get_workgroup", &kp::Algorithm::getWorkgroup, DOC(kp, Algorithm, getWorkgroup))
+        .def("get_spirv", [](kp::Algorithm& self) {
+                const std::vector<uint32_t>& spirv = self.getSpirv();
+                return py::bytes((const char*)spirv.data(), spirv.size() * sizeof(uint32_t));
+            }, DOC(kp, Algorithm, getSpirv))
+        .def("set_name", &kp::Algorithm::setName, DOC(kp, Algorithm, setName),
+                py::arg("name"))
+        .def("name", &kp::Algorithm::name, DOC(kp, Algorithm, name))
+        .def("binding_mode", &kp::Algorithm::bindingMode, DOC(kp, Algorithm, bindingMode))
         .def("destroy", &kp::Algorithm::destroy, DOC(kp, Algorithm, destroy))
         .def("is_init", &kp::Algorithm::isInit, DOC(kp, Algorithm, isInit));
 
+    py::enum_<kp::Shader::Language>(m, "ShaderLanguage", DOC(kp, Shader, Language))
+        .value("glsl", kp::Shader::Language::eGlsl, DOC(kp, Shader, Language, eGlsl))
+        .value("hlsl", kp::Shader::Language::eHlsl, DOC(kp, Shader, Language, eHlsl))
+        .export_values();
+
+    py::class_<kp::Shader>(m, "Shader", DOC(kp, Shader))
+        .def_static("compile", [](const std::string& source,
+                                  const std::vector<std::pair<std::string, std::string>>& definitions,
+                                  kp::Shader::Language language,
+                                  const std::string& entryPoint) {
+                // Returned as bytes as the algorithms take the SPIR-V as bytes
+                std::vector<uint32_t> spirv = kp::Shader::compile(source, definitions, language, entryPoint);
+                return py::bytes((const char*)spirv.data(), spirv.size() * sizeof(uint32_t));
+            }, DOC(kp, Shader, compile),
+                py::arg("source"),
+                py::arg("definitions") = std::vector<std::pair<std::string, std::string>>(),
+                py::arg("language") = kp::Shader::Language::eGlsl,
+                py::arg("entry_point") = "main")
+        .def_static("key", &kp::Shader::key, DOC(kp, Shader, key),
+                py::arg("source"),
+                py::arg("definitions") = std::vector<std::pair<std::string, std::string>>(),
+                py::arg("language") = kp::Shader::Language::eGlsl,
+                py::arg("entry_point") = "main")
+        .def_static("set_cache_directory", &kp::Shader::setCacheDirectory,
+                DOC(kp, Shader, setCacheDirectory), py::arg("directory"))
+        .def_static("cache_directory", &kp::Shader::cacheDirectory, DOC(kp, Shader, cacheDirectory))
+        .def_static("clear_cache", &kp::Shader::clearCache, DOC(kp, Shader, clearCache))
+        .def_static("compiler_available", &kp::Shader::compilerAvailable,
+                DOC(kp, Shader, compilerAvailable));
+
     py::class_<kp::Tensor, std::shared_ptr<kp::Tensor>>(m, "Tensor", DOC(kp, Tensor))
         .def("data", [](kp::Tensor& self) {
                 // Non-owning container exposing the underlying pointer
@@ -105,127 +460,863 @@ PYBIND11_MODULE(kp, m) {
                     return py::array(self.size(), self.data<double>(), py::cast(&self));
                 case kp::Tensor::TensorDataTypes::eBool:
                     return py::array(self.size(), self.data<bool>(), py::cast(&self));
+                case kp::Tensor::TensorDataTypes::eHalf:
+                    return py::array(py::dtype("float16"), { self.size() }, {}, self.data<kp::Half>(), py::cast(&self));
+                case kp::Tensor::TensorDataTypes::eInt8:
+                    return py::array(self.size(), self.data<int8_t>(), py::cast(&self));
+                case kp::Tensor::TensorDataTypes::eUnsignedInt8:
+                    return py::array(self.size(), self.data<uint8_t>(), py::cast(&self));
+                case kp::Tensor::TensorDataTypes::eInt16:
+                    return py::array(self.size(), self.data<int16_t>(), py::cast(&self));
                 default:
                     throw std::runtime_error("Kompute Python data type not supported");
                 }
             }, DOC(kp, Tensor, data))
+        .def("__dlpack__", [](std::shared_ptr<kp::Tensor> self, py::kwargs kwargs) {
+                if (!self->rawData()) {
+                    throw std::runtime_error("Kompute Python DLPack requires a tensor with host memory");
+                }
+
+                // The managed tensor owns a reference to the tensor, and the
+                // shape, so the memory stays valid until the consumer is done
+                struct Context {
+                    std::shared_ptr<kp::Tensor> tensor;
+                    int64_t shape;
+                };
+                Context* context = new Context{ self, (int64_t)self->size() };
+                DLManagedTensor* managed = new DLManagedTensor();
+                managed->dl_tensor.data = self->rawData();
+                managed->dl_tensor.device = { kp::py::kDLCPU, 0 };
+                managed->dl_tensor.ndim = 1;
+                managed->dl_tensor.dtype = kp::py::dlDataType(self->dataType());
+                managed->dl_tensor.shape = &context->shape;
+                managed->dl_tensor.strides = nullptr;
+                managed->dl_tensor.byte_offset = 0;
+                managed->manager_ctx = context;
+                managed->deleter = [](DLManagedTensor* managed) {
+                    delete (Context*)managed->manager_ctx;
+                    delete managed;
+                };
+
+                // The consumer renames the capsule, otherwise it was never used
+                return py::capsule(managed, "dltensor", [](PyObject* capsule) {
+                    if (PyCapsule_IsValid(capsule, "dltensor")) {
+                        DLManagedTensor* managed =
+                          (DLManagedTensor*)PyCapsule_GetPointer(capsule, "dltensor");
+                        managed->deleter(managed);
+                    }
+                });
+            }, DOC(kp, Tensor, dlpack))
+        .def("__dlpack_device__", [](kp::Tensor& self) {
+                return py::make_tuple((int)kp::py::kDLCPU, 0);
+            }, DOC(kp, Tensor, dlpackDevice))
         .def("size", &kp::Tensor::size, DOC(kp, Tensor, size))
         .def("__len__", &kp::Tensor::size, DOC(kp, Tensor, size))
+        .def("capacity", &kp::Tensor::capacity, DOC(kp, Tensor, capacity))
+        .def("reserve", &kp::Tensor::reserve, DOC(kp, Tensor, reserve),
+                py::arg("capacity"))
         .def("tensor_type", &kp::Tensor::tensorType, DOC(kp, Tensor, tensorType))
+        .def("host_memory_type", &kp::Tensor::hostMemoryType, DOC(kp, Tensor, hostMemoryType))
         .def("data_type", &kp::Tensor::dataType, DOC(kp, Tensor, dataType))
         .def("is_init", &kp::Tensor::isInit, DOC(kp, Tensor, isInit))
+        .def("is_view", &kp::Tensor::isView, DOC(kp, Tensor, isView))
+        .def("device_address", &kp::Tensor::deviceAddress, DOC(kp, Tensor, deviceAddress))
+        .def("queue_family_indices", &kp::Tensor::queueFamilyIndices, DOC(kp, Tensor, queueFamilyIndices))
+        .def("set_name", &kp::Tensor::setName, DOC(kp, Tensor, setName),
+                py::arg("name"))
+        .def("name", &kp::Tensor::name, DOC(kp, Tensor, name))
         .def("destroy", &kp::Tensor::destroy, DOC(kp, Tensor, destroy));
 
+    // Tensors can be used directly as the leaves of expressions
+    py::implicitly_convertible<kp::Tensor, kp::Expression>();
+
+    py::class_<kp::SparseTensor, std::shared_ptr<kp::SparseTensor>>(
+            m, "SparseTensor", DOC(kp, SparseTensor))
+        .def("row_pointers", &kp::SparseTensor::rowPointers, DOC(kp, SparseTensor, rowPointers))
+        .def("column_indices", &kp::SparseTensor::columnIndices, DOC(kp, SparseTensor, columnIndices))
+        .def("values", &kp::SparseTensor::values, DOC(kp, SparseTensor, values))
+        .def("tensors", &kp::SparseTensor::tensors, DOC(kp, SparseTensor, tensors))
+        .def("rows", &kp::SparseTensor::rows, DOC(kp, SparseTensor, rows))
+        .def("columns", &kp::SparseTensor::columns, DOC(kp, SparseTensor, columns))
+        .def("non_zero_count", &kp::SparseTensor::nonZeroCount, DOC(kp, SparseTensor, nonZeroCount))
+        .def_property_readonly("shape", [](kp::SparseTensor& self) {
+                return py::make_tuple(self.rows(), self.columns());
+            });
+
+    py::class_<kp::TensorArchive::Entry>(m, "TensorArchiveEntry", DOC(kp, TensorArchive, Entry))
+        .def_readonly("name", &kp::TensorArchive::Entry::name, DOC(kp, TensorArchive, Entry, name))
+        .def_readonly("data_type", &kp::TensorArchive::Entry::dataType,
+                DOC(kp, TensorArchive, Entry, dataType))
+        .def_readonly("shape", &kp::TensorArchive::Entry::shape, DOC(kp, TensorArchive, Entry, shape))
+        .def_readonly("offset", &kp::TensorArchive::Entry::offset, DOC(kp, TensorArchive, Entry, offset))
+        .def_readonly("size", &kp::TensorArchive::Entry::size, DOC(kp, TensorArchive, Entry, size))
+        .def("__repr__", [](const kp::TensorArchive::Entry& self) {
+                    return fmt::format("TensorArchiveEntry({}, shape {}, {} bytes)",
+                                       self.name, self.shape, self.size);
+                });
+
+    py::class_<kp::TensorArchive, std::shared_ptr<kp::TensorArchive>>(
+            m, "TensorArchive", DOC(kp, TensorArchive))
+        .def(py::init<const std::string&>(), DOC(kp, TensorArchive, TensorArchive), py::arg("path"))
+        .def_static("write", [](const std::string& path, const py::dict& arrays) {
+                    std::vector<kp::TensorArchive::Entry> entries;
+                    std::vector<py::array> contiguous;
+                    std::vector<const void*> data;
+                    for (const auto& item : arrays) {
+                        // The dtype is matched through its DLPack code and
+                        // bits, and other layouts are copied once here
+                        py::array array = py::array::ensure(item.second, py::array::c_style);
+                        if (!array) {
+                            throw std::runtime_error("Kompute Python TensorArchive values must be arrays");
+                        }
+                        const std::string kinds = "iufb";
+                        const uint8_t codes[] = { kp::py::kDLInt, kp::py::kDLUInt,
+                                                  kp::py::kDLFloat, kp::py::kDLBool };
+                        size_t kind = kinds.find(array.dtype().kind());
+                        DLDataType dtype = { kind < kinds.size() ? codes[kind] : (uint8_t)255,
+                                             (uint8_t)(array.itemsize() * 8), 1 };
+
+                        kp::TensorArchive::Entry entry;
+                        entry.name = item.first.cast<std::string>();
+                        entry.dataType = kp::py::tensorDataType(dtype);
+                        entry.shape.assign(array.shape(), array.shape() + array.ndim());
+                        entries.push_back(entry);
+                        data.push_back(array.data());
+                        contiguous.push_back(array);
+                    }
+                    py::gil_scoped_release release;
+                    kp::TensorArchive::write(path, entries, data);
+                }, DOC(kp, TensorArchive, write), py::arg("path"), py::arg("arrays"))
+        .def("entries", &kp::TensorArchive::entries, DOC(kp, TensorArchive, entries))
+        .def("find", [](const kp::TensorArchive& self, const std::string& name) -> py::object {
+                    kp::TensorArchive::Entry entry;
+                    if (!self.find(name, entry)) {
+                        return py::none();
+                    }
+                    return py::cast(entry);
+                }, DOC(kp, TensorArchive, find), py::arg("name"))
+        .def("load", &kp::TensorArchive::load, DOC(kp, TensorArchive, load),
+                py::arg("manager"), py::arg("tensor_type") = kp::Tensor::TensorTypes::eDevice,
+                py::arg("host_memory_type") = kp::Tensor::HostMemoryTypes::eCoherent,
+                py::arg("names") = std::vector<std::string>(),
+                py::call_guard<py::gil_scoped_release>())
+        .def("close", &kp::TensorArchive::close, DOC(kp, TensorArchive, close))
+        .def("is_open", &kp::TensorArchive::isOpen, DOC(kp, TensorArchive, isOpen));
+
+    py::class_<kp::Tracer>(m, "Tracer", DOC(kp, Tracer))
+        .def_static("start", &kp::Tracer::start, DOC(kp, Tracer, start))
+        .def_static("stop", &kp::Tracer::stop, DOC(kp, Tracer, stop))
+        .def_static("is_enabled", &kp::Tracer::isEnabled, DOC(kp, Tracer, isEnabled))
+        .def_static("event_count", &kp::Tracer::eventCount, DOC(kp, Tracer, eventCount))
+        .def_static("chrome_trace", &kp::Tracer::chromeTrace, DOC(kp, Tracer, chromeTrace))
+        .def_static("write_chrome_trace", &kp::Tracer::writeChromeTrace,
+                DOC(kp, Tracer, writeChromeTrace), py::arg("path"));
+
+    py::module_ benchmark = m.def_submodule("benchmark", DOC(kp, Benchmark));
+
+    py::class_<kp::Benchmark::Result>(benchmark, "Result", DOC(kp, Benchmark, Result))
+        .def_readonly("label", &kp::Benchmark::Result::label, DOC(kp, Benchmark, Result, label))
+        .def_readonly("repetitions", &kp::Benchmark::Result::repetitions,
+                DOC(kp, Benchmark, Result, repetitions))
+        .def_readonly("min_ns", &kp::Benchmark::Result::minNs, DOC(kp, Benchmark, Result, minNs))
+        .def_readonly("median_ns", &kp::Benchmark::Result::medianNs, DOC(kp, Benchmark, Result, medianNs))
+        .def_readonly("mean_ns", &kp::Benchmark::Result::meanNs, DOC(kp, Benchmark, Result, meanNs))
+        .def_readonly("stddev_ns", &kp::Benchmark::Result::stddevNs, DOC(kp, Benchmark, Result, stddevNs))
+        .def_readonly("max_ns", &kp::Benchmark::Result::maxNs, DOC(kp, Benchmark, Result, maxNs))
+        .def_readonly("gflops", &kp::Benchmark::Result::gflops, DOC(kp, Benchmark, Result, gflops))
+        .def_readonly("gbps", &kp::Benchmark::Result::gbps, DOC(kp, Benchmark, Result, gbps))
+        .def_readonly("peak_gflops_fraction", &kp::Benchmark::Result::peakGflopsFraction,
+                DOC(kp, Benchmark, Result, peakGflopsFraction))
+        .def_readonly("peak_gbps_fraction", &kp::Benchmark::Result::peakGbpsFraction,
+                DOC(kp, Benchmark, Result, peakGbpsFraction))
+        .def("__repr__", [](const kp::Benchmark::Result& self) {
+                    return fmt::format("Result({}, median {:.0f} ns, {:.2f} GFLOP/s, {:.2f} GB/s)",
+                                       self.label, self.medianNs, self.gflops, self.gbps);
+                });
+
+    py::class_<kp::Benchmark>(benchmark, "Benchmark", DOC(kp, Benchmark))
+        .def(py::init<std::shared_ptr<kp::Manager>, uint32_t, uint32_t>(),
+                DOC(kp, Benchmark, Benchmark), py::arg("manager"),
+                py::arg("warmup") = 3, py::arg("repetitions") = 10)
+        .def("run", &kp::Benchmark::run, DOC(kp, Benchmark, run), py::arg("sequence"),
+                py::arg("flops") = 0, py::arg("bytes") = 0, py::arg("label") = "",
+                py::call_guard<py::gil_scoped_release>())
+        .def("run_host", &kp::Benchmark::runHost, DOC(kp, Benchmark, runHost), py::arg("function"),
+                py::arg("flops") = 0, py::arg("bytes") = 0)
+        .def("measure_peak_bandwidth", &kp::Benchmark::measurePeakBandwidth,
+                DOC(kp, Benchmark, measurePeakBandwidth), py::arg("bytes") = 64 * 1024 * 1024,
+                py::call_guard<py::gil_scoped_release>())
+        .def("set_peak", &kp::Benchmark::setPeak, DOC(kp, Benchmark, setPeak),
+                py::arg("gflops"), py::arg("gbps"))
+        .def("peak_gflops", &kp::Benchmark::peakGflops, DOC(kp, Benchmark, peakGflops))
+        .def("peak_gbps", &kp::Benchmark::peakGbps, DOC(kp, Benchmark, peakGbps));
+
+    py::class_<kp::Tuner::Candidate>(benchmark, "Candidate", DOC(kp, Tuner, Candidate))
+        .def(py::init([](const kp::Workgroup& workgroup, const py::array& spec_consts) {
+                    // Specialization constants are stored as their raw 32 bit values
+                    const py::buffer_info specInfo = spec_consts.request();
+                    if (specInfo.itemsize != sizeof(uint32_t)) {
+                        throw std::runtime_error(fmt::format(
+                          "Kompute Tuner specialization constants must be 32 bit values, got {} bytes",
+                          specInfo.itemsize));
+                    }
+                    std::vector<uint32_t> specConstsVec((uint32_t*)specInfo.ptr,
+                                                        ((uint32_t*)specInfo.ptr) + specInfo.size);
+                    return kp::Tuner::candidate(workgroup, specConstsVec);
+                }),
+                DOC(kp, Tuner, candidate), py::arg("workgroup"), py::arg("spec_consts").noconvert())
+        .def(py::init([](const kp::Workgroup& workgroup, const std::vector<float>& spec_consts) {
+                    return kp::Tuner::candidate(workgroup, spec_consts);
+                }),
+                DOC(kp, Tuner, candidate), py::arg("workgroup"),
+                py::arg("spec_consts") = std::vector<float>())
+        .def_readonly("workgroup", &kp::Tuner::Candidate::workgroup,
+                DOC(kp, Tuner, Candidate, workgroup))
+        .def_readonly("spec_consts", &kp::Tuner::Candidate::specializationConstants,
+                DOC(kp, Tuner, Candidate, specializationConstants));
+
+    py::class_<kp::Tuner::Result>(benchmark, "TunerResult", DOC(kp, Tuner, Result))
+        .def_readonly("candidate", &kp::Tuner::Result::candidate, DOC(kp, Tuner, Result, candidate))
+        .def_readonly("median_ns", &kp::Tuner::Result::medianNs, DOC(kp, Tuner, Result, medianNs))
+        .def_readonly("cached", &kp::Tuner::Result::cached, DOC(kp, Tuner, Result, cached))
+        .def("__repr__", [](const kp::Tuner::Result& self) {
+                    return fmt::format("TunerResult(workgroup ({}, {}, {}), median {:.0f} ns{})",
+                                       self.candidate.workgroup[0], self.candidate.workgroup[1],
+                                       self.candidate.workgroup[2], self.medianNs,
+                                       self.cached ? ", cached" : "");
+                });
+
+    py::class_<kp::Tuner>(benchmark, "Tuner", DOC(kp, Tuner))
+        .def(py::init<std::shared_ptr<kp::Manager>, const std::string&, uint32_t, uint32_t>(),
+                DOC(kp, Tuner, Tuner), py::arg("manager"), py::arg("database_path") = "",
+                py::arg("warmup") = 2, py::arg("repetitions") = 5)
+        .def("tune", &kp::Tuner::tune, DOC(kp, Tuner, tune), py::arg("algorithm"),
+                py::arg("name"), py::arg("shape"), py::arg("candidates"), py::arg("retune") = false,
+                py::call_guard<py::gil_scoped_release>())
+        .def("find", [](const kp::Tuner& self, const std::string& name, const std::vector<uint32_t>& shape)
+                -> py::object {
+                    kp::Tuner::Result result;
+                    if (!self.find(name, shape, result)) {
+                        return py::none();
+                    }
+                    return py::cast(result);
+                }, DOC(kp, Tuner, find), py::arg("name"), py::arg("shape"))
+        .def("load", &kp::Tuner::load, DOC(kp, Tuner, load), py::arg("path"))
+        .def("save", &kp::Tuner::save, DOC(kp, Tuner, save), py::arg("path") = "")
+        .def("size", &kp::Tuner::size, DOC(kp, Tuner, size))
+        .def("device_key", &kp::Tuner::deviceKey, DOC(kp, Tuner, deviceKey));
+
+    py::class_<kp::Sequence::OpTiming>(m, "OpTiming", DOC(kp, Sequence, OpTiming))
+        .def_readonly("label", &kp::Sequence::OpTiming::label,
+                DOC(kp, Sequence, OpTiming, label))
+        .def_readonly("duration_ns", &kp::Sequence::OpTiming::durationNs,
+                DOC(kp, Sequence, OpTiming, durationNs))
+        .def_readonly("compute_invocations", &kp::Sequence::OpTiming::computeInvocations,
+                DOC(kp, Sequence, OpTiming, computeInvocations))
+        .def("__repr__", [](const kp::Sequence::OpTiming& self) {
+                    return fmt::format("OpTiming({}, {} ns, {} invocations)",
+                                       self.label, self.durationNs, self.computeInvocations);
+                });
+
     py::class_<kp::Sequence, std::shared_ptr<kp::Sequence>>(m, "Sequence")
         .def("record", [](kp::Sequence& self, std::shared_ptr<kp::OpBase> op) { return self.record(op); },
                 DOC(kp, Sequence, record))
+        .def("record", [](kp::Sequence& self, std::shared_ptr<kp::OpBase> op, const std::string& label) {
+                    return self.record(op, label);
+                }, DOC(kp, Sequence, record_2), py::arg("op"), py::arg("label"))
+        .def("record_many", [](kp::Sequence& self, const std::vector<std::shared_ptr<kp::OpBase>>& ops) {
+                    return self.record(ops);
+                }, DOC(kp, Sequence, record_3), py::arg("ops"), py::call_guard<py::gil_scoped_release>())
+        .def("record_dispatches", [](kp::Sequence& self,
+                                     std::shared_ptr<kp::Algorithm> algorithm,
+                                     const py::array& push_consts,
+                                     bool barrier_between_dispatches) {
+                    std::shared_ptr<kp::OpBase> op = opAlgoDispatchBatchPyInit(
+                      algorithm, push_consts, 1, barrier_between_dispatches);
+                    py::gil_scoped_release release;
+                    return self.record(op);
+                }, DOC(kp, Sequence, recordDispatches),
+                py::arg("algorithm"), py::arg("push_consts"),
+                py::arg("barrier_between_dispatches") = false)
+        // The submissions and waits run without the GIL so other Python threads run meanwhile
         .def("eval", [](kp::Sequence& self) { return self.eval(); },
-                DOC(kp, Sequence, eval))
+                DOC(kp, Sequence, eval), py::call_guard<py::gil_scoped_release>())
         .def("eval", [](kp::Sequence& self, std::shared_ptr<kp::OpBase> op) { return self.eval(op); },
-                DOC(kp, Sequence, eval_2))
-        .def("eval_async", [](kp::Sequence& self) { return self.eval(); },
-                DOC(kp, Sequence, evalAwait))
+                DOC(kp, Sequence, eval_2), py::call_guard<py::gil_scoped_release>())
+        .def("eval_async", [](kp::Sequence& self) { return self.evalAsync(); },
+                DOC(kp, Sequence, evalAsync), py::call_guard<py::gil_scoped_release>())
         .def("eval_async", [](kp::Sequence& self, std::shared_ptr<kp::OpBase> op) { return self.evalAsync(op); },
-                DOC(kp, Sequence, evalAsync))
+                DOC(kp, Sequence, evalAsync_2), py::call_guard<py::gil_scoped_release>())
+        .def("eval_async", [](kp::Sequence& self, const std::vector<std::shared_ptr<kp::Sequence>>& wait_sequences) {
+                    return self.evalAsync(wait_sequences);
+                }, DOC(kp, Sequence, evalAsync_3), py::arg("wait_sequences"),
+                py::call_guard<py::gil_scoped_release>())
         .def("eval_await", [](kp::Sequence& self) { return self.evalAwait(); },
-                DOC(kp, Sequence, evalAwait))
+                DOC(kp, Sequence, evalAwait), py::call_guard<py::gil_scoped_release>())
         .def("eval_await", [](kp::Sequence& self, uint32_t wait) { return self.evalAwait(wait); },
-                DOC(kp, Sequence, evalAwait))
+                DOC(kp, Sequence, evalAwait), py::call_guard<py::gil_scoped_release>())
         .def("is_recording", &kp::Sequence::isRecording,
                 DOC(kp, Sequence, isRecording))
         .def("is_running", &kp::Sequence::isRunning,
                 DOC(kp, Sequence, isRunning))
+        .def("is_complete", &kp::Sequence::isComplete,
+                DOC(kp, Sequence, isComplete))
+        .def("in_flight_count", &kp::Sequence::inFlightCount,
+                DOC(kp, Sequence, inFlightCount))
+        .def("in_flight_depth", &kp::Sequence::inFlightDepth,
+                DOC(kp, Sequence, inFlightDepth))
+        .def("barrier_count", &kp::Sequence::barrierCount,
+                DOC(kp, Sequence, barrierCount))
+        .def("operations", &kp::Sequence::operations,
+                DOC(kp, Sequence, operations))
         .def("is_init", &kp::Sequence::isInit,
                 DOC(kp, Sequence, isInit))
         .def("clear", &kp::Sequence::clear,
                 DOC(kp, Sequence, clear))
         .def("rerecord", &kp::Sequence::rerecord,
                 DOC(kp, Sequence, rerecord))
-        .def("get_timestamps", &kp::Sequence::getTimestamps,
+        .def("reset", &kp::Sequence::reset,
+                DOC(kp, Sequence, reset))
+        .def("get_timestamps", [](kp::Sequence& self, bool wait) -> py::object {
+                    std::vector<kp::Sequence::OpTiming> timings;
+                    {
+                        py::gil_scoped_release release;
+                        timings = self.getOpTimings(wait);
+                    }
+                    if (timings.empty() && !wait) {
+                        return py::none();
+                    }
+                    return py::cast(timings);
+                }, DOC(kp, Sequence, getOpTimings), py::arg("wait") = true)
+        .def("get_raw_timestamps", &kp::Sequence::getTimestamps,
             DOC(kp, Sequence, getTimestamps))
+        .def("set_name", &kp::Sequence::setName,
+                DOC(kp, Sequence, setName), py::arg("name"))
+        .def("name", &kp::Sequence::name,
+                DOC(kp, Sequence, name))
         .def("destroy", &kp::Sequence::destroy,
                 DOC(kp, Sequence, destroy));
 
+    py::class_<kp::Block, std::shared_ptr<kp::Block>>(
+            m, "Block", py::base<kp::OpBase>(), DOC(kp, Block))
+        .def("record", [](kp::Block& self, std::shared_ptr<kp::OpBase> op) { return self.record(op); },
+                DOC(kp, Block, record))
+        .def("begin", &kp::Block::begin,
+                DOC(kp, Block, begin))
+        .def("end", &kp::Block::end,
+                DOC(kp, Block, end))
+        .def("is_recording", &kp::Block::isRecording,
+                DOC(kp, Block, isRecording))
+        .def("is_init", &kp::Block::isInit,
+                DOC(kp, Block, isInit))
+        .def("operation_count", &kp::Block::operationCount,
+                DOC(kp, Block, operationCount))
+        .def("destroy", &kp::Block::destroy,
+                DOC(kp, Block, destroy));
+
+    py::class_<kp::SubmitBatch, std::shared_ptr<kp::SubmitBatch>>(m, "SubmitBatch", DOC(kp, SubmitBatch))
+        .def("wait", &kp::SubmitBatch::await,
+                DOC(kp, SubmitBatch, await), py::arg("wait_for") = UINT64_MAX,
+                py::call_guard<py::gil_scoped_release>())
+        .def("is_complete", &kp::SubmitBatch::isComplete,
+                DOC(kp, SubmitBatch, isComplete))
+        .def("queue_submit_count", &kp::SubmitBatch::queueSubmitCount,
+                DOC(kp, SubmitBatch, queueSubmitCount))
+        .def("destroy", &kp::SubmitBatch::destroy,
+                DOC(kp, SubmitBatch, destroy));
+
+    py::class_<kp::Scheduler, std::shared_ptr<kp::Scheduler>>(m, "Scheduler", DOC(kp, Scheduler))
+        .def("submit", [](kp::Scheduler& self,
+                          std::shared_ptr<kp::Sequence> sequence,
+                          std::function<void(std::shared_ptr<kp::Sequence>)> callback) {
+                    self.submit(sequence, [sequence, callback](std::exception_ptr exception) {
+                        if (exception) {
+                            std::rethrow_exception(exception);
+                        }
+                        callback(sequence);
+                    });
+                }, DOC(kp, Scheduler, submit),
+                py::arg("sequence"), py::arg("callback"))
+        .def("wait", &kp::Scheduler::await,
+                DOC(kp, Scheduler, await), py::call_guard<py::gil_scoped_release>())
+        .def("queue_count", &kp::Scheduler::queueCount,
+                DOC(kp, Scheduler, queueCount))
+        .def("outstanding_count", &kp::Scheduler::outstandingCount,
+                DOC(kp, Scheduler, outstandingCount))
+        .def("completed_counts", &kp::Scheduler::completedCounts,
+                DOC(kp, Scheduler, completedCounts))
+        .def("stolen_count", &kp::Scheduler::stolenCount,
+                DOC(kp, Scheduler, stolenCount))
+        .def("destroy", &kp::Scheduler::destroy,
+                DOC(kp, Scheduler, destroy), py::call_guard<py::gil_scoped_release>());
+
+    py::class_<kp::Graph, std::shared_ptr<kp::Graph>>(m, "Graph", DOC(kp, Graph))
+        .def("add", py::overload_cast<std::shared_ptr<kp::OpBase>,
+                        const std::vector<std::shared_ptr<kp::Tensor>>&,
+                        const std::vector<std::shared_ptr<kp::Tensor>>&>(&kp::Graph::add),
+                DOC(kp, Graph, add),
+                py::arg("op"), py::arg("inputs"), py::arg("outputs"))
+        .def("add", py::overload_cast<std::shared_ptr<kp::OpBase>>(&kp::Graph::add),
+                DOC(kp, Graph, add_2), py::arg("op"))
+        .def("compile", &kp::Graph::compile, DOC(kp, Graph, compile))
+        .def("run", &kp::Graph::run, DOC(kp, Graph, run))
+        .def("run_async", &kp::Graph::runAsync, DOC(kp, Graph, runAsync))
+        .def("wait", &kp::Graph::await,
+                DOC(kp, Graph, await), py::call_guard<py::gil_scoped_release>())
+        .def("is_compiled", &kp::Graph::isCompiled, DOC(kp, Graph, isCompiled))
+        .def("operation_count", &kp::Graph::operationCount,
+                DOC(kp, Graph, operationCount))
+        .def("dependencies", &kp::Graph::dependencies,
+                DOC(kp, Graph, dependencies), py::arg("operation_index"))
+        .def("operation_queues", &kp::Graph::operationQueues,
+                DOC(kp, Graph, operationQueues))
+        .def("sequence_count", &kp::Graph::sequenceCount,
+                DOC(kp, Graph, sequenceCount))
+        .def("compile_count", &kp::Graph::compileCount,
+                DOC(kp, Graph, compileCount))
+        .def("destroy", &kp::Graph::destroy, DOC(kp, Graph, destroy));
+
+    py::class_<kp::StreamPipeline, std::shared_ptr<kp::StreamPipeline>>(m, "StreamPipeline", DOC(kp, StreamPipeline))
+        .def("run", &kp::StreamPipeline::run, DOC(kp, StreamPipeline, run),
+                py::arg("source"), py::arg("sink"))
+        .def("chunk_size", &kp::StreamPipeline::chunkSize,
+                DOC(kp, StreamPipeline, chunkSize))
+        .def("depth", &kp::StreamPipeline::depth, DOC(kp, StreamPipeline, depth))
+        .def("has_transfer_queue", &kp::StreamPipeline::hasTransferQueue,
+                DOC(kp, StreamPipeline, hasTransferQueue))
+        .def("destroy", &kp::StreamPipeline::destroy, DOC(kp, StreamPipeline, destroy));
+
+    py::enum_<kp::Manager::QueueRole>(m, "QueueRole", DOC(kp, Manager, QueueRole))
+        .value("compute", kp::Manager::QueueRole::eCompute, DOC(kp, Manager, QueueRole, eCompute))
+        .value("async_compute", kp::Manager::QueueRole::eAsyncCompute, DOC(kp, Manager, QueueRole, eAsyncCompute))
+        .value("transfer", kp::Manager::QueueRole::eTransfer, DOC(kp, Manager, QueueRole, eTransfer))
+        .value("high_priority", kp::Manager::QueueRole::eHighPriority, DOC(kp, Manager, QueueRole, eHighPriority))
+        .export_values();
+
+    py::enum_<vk::QueueGlobalPriorityEXT>(m, "QueueGlobalPriority")
+        .value("low", vk::QueueGlobalPriorityEXT::eLow)
+        .value("medium", vk::QueueGlobalPriorityEXT::eMedium)
+        .value("high", vk::QueueGlobalPriorityEXT::eHigh)
+        .value("realtime", vk::QueueGlobalPriorityEXT::eRealtime);
+
+    py::class_<kp::Manager::QueuePriority>(m, "QueuePriority", DOC(kp, Manager, QueuePriority))
+        .def(py::init([](float priority, vk::QueueGlobalPriorityEXT globalPriority) {
+                    return kp::Manager::QueuePriority{ priority, globalPriority };
+                }),
+                py::arg("priority") = 1.0f,
+                py::arg("global_priority") = vk::QueueGlobalPriorityEXT::eMedium)
+        .def_readwrite("priority", &kp::Manager::QueuePriority::priority,
+                DOC(kp, Manager, QueuePriority, priority))
+        .def_readwrite("global_priority", &kp::Manager::QueuePriority::globalPriority,
+                DOC(kp, Manager, QueuePriority, globalPriority));
+
+    py::class_<kp::Manager::DeviceRequirements>(m, "DeviceRequirements", DOC(kp, Manager, DeviceRequirements))
+        .def(py::init<>())
+        .def_readwrite("extensions", &kp::Manager::DeviceRequirements::extensions,
+                DOC(kp, Manager, DeviceRequirements, extensions))
+        .def_readwrite("min_subgroup_size", &kp::Manager::DeviceRequirements::minSubgroupSize,
+                DOC(kp, Manager, DeviceRequirements, minSubgroupSize))
+        .def_readwrite("allow_cpu", &kp::Manager::DeviceRequirements::allowCpu,
+                DOC(kp, Manager, DeviceRequirements, allowCpu))
+        .def_property("shader_float64",
+            [](const kp::Manager::DeviceRequirements& self) { return bool(self.features.shaderFloat64); },
+            [](kp::Manager::DeviceRequirements& self, bool required) { self.features.shaderFloat64 = required; },
+            DOC(kp, Manager, DeviceRequirements, features))
+        .def_property("shader_int64",
+            [](const kp::Manager::DeviceRequirements& self) { return bool(self.features.shaderInt64); },
+            [](kp::Manager::DeviceRequirements& self, bool required) { self.features.shaderInt64 = required; },
+            DOC(kp, Manager, DeviceRequirements, features))
+        .def_property("shader_int16",
+            [](const kp::Manager::DeviceRequirements& self) { return bool(self.features.shaderInt16); },
+            [](kp::Manager::DeviceRequirements& self, bool required) { self.features.shaderInt16 = required; },
+            DOC(kp, Manager, DeviceRequirements, features))
+        .def_property("subgroup_arithmetic",
+            [](const kp::Manager::DeviceRequirements& self) {
+                return bool(self.subgroupOperations & vk::SubgroupFeatureFlagBits::eArithmetic);
+            },
+            [](kp::Manager::DeviceRequirements& self, bool required) {
+                self.subgroupOperations = required
+                  ? vk::SubgroupFeatureFlagBits::eBasic | vk::SubgroupFeatureFlagBits::eArithmetic
+                  : vk::SubgroupFeatureFlags();
+            },
+            DOC(kp, Manager, DeviceRequirements, subgroupOperations));
+
+    py::class_<kp::HostAllocator, std::shared_ptr<kp::HostAllocator>>(m, "HostAllocator", DOC(kp, HostAllocator))
+        .def(py::init<size_t>(), DOC(kp, HostAllocator, HostAllocator), py::arg("arena_size") = 0)
+        .def("stats", [](const kp::HostAllocator& self) {
+            return kp::py::hostAllocatorStatsToDict(self.stats());
+        }, DOC(kp, HostAllocator, stats))
+        .def("reset_stats", &kp::HostAllocator::resetStats, DOC(kp, HostAllocator, resetStats));
+
     py::class_<kp::Manager, std::shared_ptr<kp::Manager>>(m, "Manager", DOC(kp, Manager))
         .def(py::init(), DOC(kp, Manager, Manager))
         .def(py::init<uint32_t>(), DOC(kp, Manager, Manager_2))
-        .def(py::init<uint32_t,const std::vector<uint32_t>&,const std::vector<std::string>&>(),
+        .def(py::init<uint32_t,const std::vector<uint32_t>&,const std::vector<std::string>&,const std::string&,
+                      const std::vector<kp::Manager::QueuePriority>&,std::shared_ptr<kp::HostAllocator>>(),
                 DOC(kp, Manager, Manager_2),
                 py::arg("device") = 0,
                 py::arg("family_queue_indices") = std::vector<uint32_t>(),
-                py::arg("desired_extensions") = std::vector<std::string>())
+                py::arg("desired_extensions") = std::vector<std::string>(),
+                py::arg("pipeline_cache_path") = std::string(),
+                py::arg("queue_priorities") = std::vector<kp::Manager::QueuePriority>(),
+                py::arg("host_allocator") = nullptr)
+        .def(py::init<const kp::Manager::DeviceRequirements&,const std::vector<uint32_t>&,const std::vector<std::string>&,const std::string&,
+                      const std::vector<kp::Manager::QueuePriority>&,std::shared_ptr<kp::HostAllocator>>(),
+                DOC(kp, Manager, Manager_3),
+                py::arg("requirements"),
+                py::arg("family_queue_indices") = std::vector<uint32_t>(),
+                py::arg("desired_extensions") = std::vector<std::string>(),
+                py::arg("pipeline_cache_path") = std::string(),
+                py::arg("queue_priorities") = std::vector<kp::Manager::QueuePriority>(),
+                py::arg("host_allocator") = nullptr)
         .def("destroy", &kp::Manager::destroy,
                 DOC(kp, Manager, destroy))
-        .def("sequence", &kp::Manager::sequence, DOC(kp, Manager, sequence),
-                py::arg("queue_index") = 0, py::arg("total_timestamps") = 0)
-        .def("tensor", [np](kp::Manager& self,
-                            const py::array_t<float>& data,
-                            kp::Tensor::TensorTypes tensor_type) {
-                const py::array_t<float>& flatdata = np.attr("ravel")(data);
-                const py::buffer_info info        = flatdata.request();
-                KP_LOG_DEBUG("Kompute Python Manager tensor() creating tensor float with data size {}", flatdata.size());
-                return self.tensor(
-                        info.ptr,
-                        flatdata.size(),
-                        sizeof(float),
-                        kp::Tensor::TensorDataTypes::eFloat,
-                        tensor_type);
+        .def("sequence", py::overload_cast<kp::Manager::QueueRole, uint32_t, uint32_t, bool, uint32_t>(&kp::Manager::sequence),
+                DOC(kp, Manager, sequence_2),
+                py::arg("queue_role"), py::arg("total_timestamps") = 0,
+                py::arg("in_flight_depth") = 1,
+                py::arg("share_command_pool") = false,
+                py::arg("total_pipeline_statistics") = 0)
+        .def("sequence", py::overload_cast<uint32_t, uint32_t, uint32_t, bool, uint32_t>(&kp::Manager::sequence),
+                DOC(kp, Manager, sequence),
+                py::arg("queue_index") = 0, py::arg("total_timestamps") = 0,
+                py::arg("in_flight_depth") = 1,
+                py::arg("share_command_pool") = false,
+                py::arg("total_pipeline_statistics") = 0)
+        .def("queue_index", &kp::Manager::queueIndex, DOC(kp, Manager, queueIndex),
+                py::arg("queue_role"))
+        .def("queue_priority", &kp::Manager::queuePriority, DOC(kp, Manager, queuePriority),
+                py::arg("queue_index"))
+        .def("eval_async", [](kp::Manager& self,
+                              std::shared_ptr<kp::Sequence> sequence,
+                              std::function<void(std::shared_ptr<kp::Sequence>)> callback) {
+                    // The callback takes the GIL itself when run by the completion thread
+                    py::gil_scoped_release release;
+                    self.evalAsync(sequence, callback);
+                }, DOC(kp, Manager, evalAsync),
+                py::arg("sequence"), py::arg("callback"))
+        .def("eval_asyncio", [](kp::Manager& self,
+                                std::shared_ptr<kp::Sequence> sequence,
+                                py::object loop) {
+                    if (loop.is_none()) {
+                        loop = py::module_::import("asyncio").attr("get_running_loop")();
+                    }
+                    py::object future = loop.attr("create_future")();
+                    py::object resolve = py::cpp_function([future](py::object result, py::object error) {
+                        // The future may have been cancelled while the sequence ran
+                        if (future.attr("done")().cast<bool>()) {
+                            return;
+                        }
+                        if (error.is_none()) {
+                            future.attr("set_result")(result);
+                        } else {
+                            future.attr("set_exception")(error);
+                        }
+                    });
+
+                    // The completion runs on the completion thread of the manager, so the future
+                    // is resolved on the thread of the loop, and the Python objects are released
+                    // with the GIL wherever the last copy of the completion is destroyed
+                    std::shared_ptr<py::object> state(
+                      new py::object(py::make_tuple(loop.attr("call_soon_threadsafe"), resolve)),
+                      [](py::object* state) {
+                          py::gil_scoped_acquire gil;
+                          delete state;
+                      });
+
+                    {
+                        py::gil_scoped_release release;
+                        self.evalAsync(sequence,
+                                       [state](std::shared_ptr<kp::Sequence> sequence,
+                                               std::exception_ptr exception) {
+                            py::gil_scoped_acquire gil;
+                            py::object error = py::none();
+                            if (exception) {
+                                try {
+                                    std::rethrow_exception(exception);
+                                } catch (const std::exception& e) {
+                                    error = py::module_::import("builtins").attr("RuntimeError")(e.what());
+                                } catch (...) {
+                                    error = py::module_::import("builtins").attr("RuntimeError")(
+                                      "Kompute Python eval_asyncio sequence failed");
+                                }
+                            }
+                            try {
+                                (*state)[py::int_(0)]((*state)[py::int_(1)], sequence, error);
+                            } catch (py::error_already_set& e) {
+                                // The loop was closed before the sequence completed
+                                KP_LOG_WARN("Kompute Python eval_asyncio could not resolve the future: {}",
+                                            e.what());
+                            }
+                        });
+                    }
+
+                    return future;
+                }, DOC(kp, Manager, evalAsync_3),
+                py::arg("sequence"), py::arg("loop") = py::none())
+        .def("block", &kp::Manager::block, DOC(kp, Manager, block),
+                py::arg("queue_index") = 0)
+        .def("submit", &kp::Manager::submit, DOC(kp, Manager, submit),
+                py::arg("sequences"))
+        .def("scheduler", &kp::Manager::scheduler, DOC(kp, Manager, scheduler),
+                py::arg("sequences_per_queue") = 2)
+        .def("graph", &kp::Manager::graph, DOC(kp, Manager, graph),
+                py::arg("queue_indices") = std::vector<uint32_t>())
+        .def("stream_pipeline", [](kp::Manager& self,
+                             const py::bytes& spirv,
+                             uint64_t chunk_size,
+                             uint32_t input_count,
+                             uint32_t output_count,
+                             uint32_t depth,
+                             const kp::Workgroup& workgroup,
+                             const std::vector<float>& spec_consts,
+                             const std::vector<float>& push_consts) {
+                    py::buffer_info info(py::buffer(spirv).request());
+                    const char *data = reinterpret_cast<const char *>(info.ptr);
+                    size_t length = static_cast<size_t>(info.size);
+                    std::vector<uint32_t> spirvVec((uint32_t*)data, (uint32_t*)(data + length));
+                    return self.streamPipeline<float>(spirvVec, chunk_size, input_count,
+                                                      output_count, depth, workgroup,
+                                                      spec_consts, push_consts);
+                },
+            DOC(kp, Manager, streamPipeline),
+            py::arg("spirv"),
+            py::arg("chunk_size"),
+            py::arg("input_count") = 1,
+            py::arg("output_count") = 1,
+            py::arg("depth") = 3,
+            py::arg("workgroup") = kp::Workgroup(),
+            py::arg("spec_consts") = std::vector<float>(),
+            py::arg("push_consts") = std::vector<float>())
+        .def("save_pipeline_cache", &kp::Manager::savePipelineCache,
+                DOC(kp, Manager, savePipelineCache), py::arg("path"))
+        .def("tensor", [](kp::Manager& self,
+                          const py::array_t<float>& data,
+                          kp::Tensor::TensorTypes tensor_type,
+                          kp::Tensor::HostMemoryTypes host_memory_type) {
+                const py::buffer_info info = data.request();
+                KP_LOG_DEBUG("Kompute Python Manager tensor() creating tensor float with data size {}", data.size());
+                return tensorFromBuffer(self, data, info, kp::Tensor::TensorDataTypes::eFloat,
+                                        tensor_type, host_memory_type);
             },
             DOC(kp, Manager, tensor),
-            py::arg("data"), py::arg("tensor_type") = kp::Tensor::TensorTypes::eDevice)
-        .def("tensor_t", [np](kp::Manager& self,
+            py::arg("data"), py::arg("tensor_type") = kp::Tensor::TensorTypes::eDevice,
+            py::arg("host_memory_type") = kp::Tensor::HostMemoryTypes::eCoherent)
+        .def("tensor_t", [](kp::Manager& self,
                             const py::array& data,
-                            kp::Tensor::TensorTypes tensor_type) {
-                // TODO: Suppport strides in numpy format
-                const py::array& flatdata = np.attr("ravel")(data);
-                const py::buffer_info info        = flatdata.request();
+                            kp::Tensor::TensorTypes tensor_type,
+                            kp::Tensor::HostMemoryTypes host_memory_type) {
+                const py::buffer_info info = data.request();
                 KP_LOG_DEBUG("Kompute Python Manager creating tensor_T with data size {} dtype {}",
-                        flatdata.size(), std::string(py::str(flatdata.dtype())));
-                if (flatdata.dtype() == py::dtype::of<std::float_t>()) {
-                    return self.tensor(
-                            info.ptr, flatdata.size(), sizeof(float), kp::Tensor::TensorDataTypes::eFloat, tensor_type);
-                } else if (flatdata.dtype() == py::dtype::of<std::uint32_t>()) {
-                    return self.tensor(
-                            info.ptr, flatdata.size(), sizeof(uint32_t), kp::Tensor::TensorDataTypes::eUnsignedInt, tensor_type);
-                } else if (flatdata.dtype() == py::dtype::of<std::int32_t>()) {
-                    return self.tensor(
-                            info.ptr, flatdata.size(), sizeof(int32_t), kp::Tensor::TensorDataTypes::eInt, tensor_type);
-                } else if (flatdata.dtype() == py::dtype::of<std::double_t>()) {
-                    return self.tensor(
-                            info.ptr, flatdata.size(), sizeof(double), kp::Tensor::TensorDataTypes::eDouble, tensor_type);
-                } else if (flatdata.dtype() == py::dtype::of<bool>()) {
-                    return self.tensor(
-                            info.ptr, flatdata.size(), sizeof(bool), kp::Tensor::TensorDataTypes::eBool, tensor_type);
+                        data.size(), std::string(py::str(data.dtype())));
+                kp::Tensor::TensorDataTypes dataType;
+                if (data.dtype() == py::dtype::of<std::float_t>()) {
+                    dataType = kp::Tensor::TensorDataTypes::eFloat;
+                } else if (data.dtype() == py::dtype::of<std::uint32_t>()) {
+                    dataType = kp::Tensor::TensorDataTypes::eUnsignedInt;
+                } else if (data.dtype() == py::dtype::of<std::int32_t>()) {
+                    dataType = kp::Tensor::TensorDataTypes::eInt;
+                } else if (data.dtype() == py::dtype::of<std::double_t>()) {
+                    dataType = kp::Tensor::TensorDataTypes::eDouble;
+                } else if (data.dtype() == py::dtype::of<bool>()) {
+                    dataType = kp::Tensor::TensorDataTypes::eBool;
+                } else if (data.dtype() == py::dtype("float16")) {
+                    dataType = kp::Tensor::TensorDataTypes::eHalf;
+                } else if (data.dtype() == py::dtype::of<std::int8_t>()) {
+                    dataType = kp::Tensor::TensorDataTypes::eInt8;
+                } else if (data.dtype() == py::dtype::of<std::uint8_t>()) {
+                    dataType = kp::Tensor::TensorDataTypes::eUnsignedInt8;
+                } else if (data.dtype() == py::dtype::of<std::int16_t>()) {
+                    dataType = kp::Tensor::TensorDataTypes::eInt16;
                 } else {
                     throw std::runtime_error("Kompute Python no valid dtype supported");
                 }
+                return tensorFromBuffer(self, data, info, dataType, tensor_type, host_memory_type);
             },
             DOC(kp, Manager, tensorT),
-            py::arg("data"), py::arg("tensor_type") = kp::Tensor::TensorTypes::eDevice)
+            py::arg("data"), py::arg("tensor_type") = kp::Tensor::TensorTypes::eDevice,
+            py::arg("host_memory_type") = kp::Tensor::HostMemoryTypes::eCoherent)
+        .def("tensor_empty", [](kp::Manager& self,
+                                uint64_t size,
+                                kp::Tensor::TensorDataTypes data_type,
+                                kp::Tensor::TensorTypes tensor_type,
+                                bool zero_initialise,
+                                kp::Tensor::HostMemoryTypes host_memory_type) {
+                return self.tensor(size, data_type, tensor_type, zero_initialise, host_memory_type);
+            },
+            DOC(kp, Manager, tensor_3),
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("size"), py::arg("data_type") = kp::Tensor::TensorDataTypes::eFloat,
+            py::arg("tensor_type") = kp::Tensor::TensorTypes::eDevice,
+            py::arg("zero_initialise") = false,
+            py::arg("host_memory_type") = kp::Tensor::HostMemoryTypes::eCoherent)
+        .def("tensor_from_dlpack", [](kp::Manager& self,
+                                      const py::object& source,
+                                      kp::Tensor::TensorTypes tensor_type,
+                                      kp::Tensor::HostMemoryTypes host_memory_type) {
+                // Objects implementing the protocol are asked for their capsule
+                py::capsule capsule = py::hasattr(source, "__dlpack__")
+                                        ? source.attr("__dlpack__")().cast<py::capsule>()
+                                        : source.cast<py::capsule>();
+                if (std::string(capsule.name() ? capsule.name() : "") != "dltensor") {
+                    throw std::runtime_error("Kompute Python DLPack capsule already consumed or invalid");
+                }
+                DLManagedTensor* managed = capsule.get_pointer<DLManagedTensor>();
+                const DLTensor& dlTensor = managed->dl_tensor;
+
+                if (dlTensor.device.device_type != kp::py::kDLCPU &&
+                    dlTensor.device.device_type != kp::py::kDLCUDAHost) {
+                    throw std::runtime_error(fmt::format(
+                      "Kompute Python DLPack device type {} is not host memory",
+                      dlTensor.device.device_type));
+                }
+                kp::Tensor::TensorDataTypes dataType = kp::py::tensorDataType(dlTensor.dtype);
+                uint32_t elementMemorySize = kp::Tensor::elementMemorySize(dataType);
+
+                // Strides are in elements, and absent for row major tensors
+                std::vector<int64_t> shape(dlTensor.shape, dlTensor.shape + dlTensor.ndim);
+                std::vector<int64_t> byteStrides(dlTensor.ndim);
+                int64_t stride = elementMemorySize;
+                for (int32_t d = dlTensor.ndim; d-- > 0;) {
+                    byteStrides[d] = dlTensor.strides ? dlTensor.strides[d] * elementMemorySize : stride;
+                    stride *= shape[d];
+                }
+
+                KP_LOG_DEBUG("Kompute Python Manager creating tensor from DLPack with {} dimensions",
+                             dlTensor.ndim);
+
+                std::shared_ptr<kp::Tensor> tensor;
+                {
+                    py::gil_scoped_release release;
+                    tensor = kp::py::tensorFromStrided(self,
+                                                       (uint8_t*)dlTensor.data + dlTensor.byte_offset,
+                                                       shape,
+                                                       byteStrides,
+                                                       dataType,
+                                                       tensor_type,
+                                                       host_memory_type);
+                }
+
+                // The capsule is consumed, and its deleter runs once the
+                // memory is not needed anymore, which is when the tensor is
+                // released if the memory was imported
+                PyCapsule_SetName(capsule.ptr(), "used_dltensor");
+                py::capsule owner(managed, [](void* pointer) {
+                    DLManagedTensor* managed = (DLManagedTensor*)pointer;
+                    if (managed->deleter) {
+                        managed->deleter(managed);
+                    }
+                });
+                py::object result = py::cast(tensor);
+                if (tensor->isHostMemoryImported()) {
+                    py::detail::keep_alive_impl(result, owner);
+                }
+                return result;
+            },
+            DOC(kp, Manager, tensorFromDlpack),
+            py::arg("source"), py::arg("tensor_type") = kp::Tensor::TensorTypes::eDevice,
+            py::arg("host_memory_type") = kp::Tensor::HostMemoryTypes::eCoherent)
+        .def("tensor_view", [](kp::Manager& self,
+                               std::shared_ptr<kp::Tensor> parent,
+                               uint32_t offset,
+                               uint32_t count) {
+                return self.tensorView(parent, offset, count);
+            },
+            DOC(kp, Manager, tensorView),
+            py::arg("parent"), py::arg("offset"), py::arg("count"))
+        .def("sparse_tensor", [](kp::Manager& self,
+                                 const py::object& matrix,
+                                 kp::Tensor::TensorTypes tensor_type) {
+                // Duck typed on the CSR attributes of scipy matrices and
+                // arrays, whose indices are converted only if they are not
+                // contiguous unsigned 32 bit integers already
+                typedef py::array_t<uint32_t, py::array::c_style | py::array::forcecast> IndexArray;
+                typedef py::array_t<float, py::array::c_style | py::array::forcecast> ValueArray;
+                py::tuple shape = matrix.attr("shape");
+                uint32_t rows = shape[0].cast<uint32_t>();
+                uint32_t columns = shape[1].cast<uint32_t>();
+                IndexArray rowPointers = IndexArray::ensure(matrix.attr("indptr"));
+                IndexArray columnIndices = IndexArray::ensure(matrix.attr("indices"));
+                ValueArray values = ValueArray::ensure(matrix.attr("data"));
+                if (!rowPointers || !columnIndices || !values) {
+                    throw std::runtime_error(
+                      "Kompute Python sparse tensor requires a CSR matrix with numeric "
+                      "indptr, indices and data arrays");
+                }
+                if ((uint64_t)rowPointers.size() != (uint64_t)rows + 1 ||
+                    columnIndices.size() != values.size()) {
+                    throw std::runtime_error(fmt::format(
+                      "Kompute Python sparse tensor of {} rows expects {} row pointers and "
+                      "as many column indices as values but got {}, {} and {}",
+                      rows, (uint64_t)rows + 1, rowPointers.size(),
+                      columnIndices.size(), values.size()));
+                }
+
+                uint32_t nonZeroCount = values.size();
+                const uint32_t* rowPointersData = rowPointers.data();
+                const uint32_t* columnIndicesData = columnIndices.data();
+                const float* valuesData = values.data();
+
+                py::gil_scoped_release release;
+                return self.sparseTensor(rows,
+                                         columns,
+                                         nonZeroCount,
+                                         rowPointersData,
+                                         columnIndicesData,
+                                         valuesData,
+                                         tensor_type);
+            },
+            DOC(kp, Manager, sparseTensor),
+            py::arg("matrix"), py::arg("tensor_type") = kp::Tensor::TensorTypes::eDevice)
+        .def("algorithm", [](kp::Manager& self) { return self.algorithm(); },
+            DOC(kp, Manager, algorithm))
         .def("algorithm", [](kp::Manager& self,
                              const std::vector<std::shared_ptr<kp::Tensor>>& tensors,
                              const py::bytes& spirv,
                              const kp::Workgroup& workgroup,
                              const std::vector<float>& spec_consts,
-                             const std::vector<float>& push_consts) {
+                             const std::vector<float>& push_consts,
+                             kp::Algorithm::BindingModes binding_mode) {
                     py::buffer_info info(py::buffer(spirv).request());
                     const char *data = reinterpret_cast<const char *>(info.ptr);
                     size_t length = static_cast<size_t>(info.size);
                     std::vector<uint32_t> spirvVec((uint32_t*)data, (uint32_t*)(data + length));
-                    return self.algorithm(tensors, spirvVec, workgroup, spec_consts, push_consts);
+                    return self.algorithm(tensors, spirvVec, workgroup, spec_consts, push_consts, binding_mode);
                 },
             DOC(kp, Manager, algorithm),
             py::arg("tensors"),
             py::arg("spirv"),
             py::arg("workgroup") = kp::Workgroup(),
             py::arg("spec_consts") = std::vector<float>(),
-            py::arg("push_consts") = std::vector<float>())
+            py::arg("push_consts") = std::vector<float>(),
+            py::arg("binding_mode") = kp::Algorithm::BindingModes::eDescriptors)
+        .def("algorithm_async", [](kp::Manager& self,
+                             const std::vector<std::shared_ptr<kp::Tensor>>& tensors,
+                             const py::bytes& spirv,
+                             const kp::Workgroup& workgroup,
+                             const std::vector<float>& spec_consts,
+                             const std::vector<float>& push_consts,
+                             kp::Algorithm::BindingModes binding_mode) {
+                    py::buffer_info info(py::buffer(spirv).request());
+                    const char *data = reinterpret_cast<const char *>(info.ptr);
+                    size_t length = static_cast<size_t>(info.size);
+                    std::vector<uint32_t> spirvVec((uint32_t*)data, (uint32_t*)(data + length));
+                    return self.algorithmAsync(tensors, spirvVec, workgroup, spec_consts, push_consts, binding_mode);
+                },
+            DOC(kp, Manager, algorithmAsync),
+            py::arg("tensors"),
+            py::arg("spirv"),
+            py::arg("workgroup") = kp::Workgroup(),
+            py::arg("spec_consts") = std::vector<float>(),
+            py::arg("push_consts") = std::vector<float>(),
+            py::arg("binding_mode") = kp::Algorithm::BindingModes::eDescriptors)
         .def("algorithm", [np](kp::Manager& self,
                              const std::vector<std::shared_ptr<kp::Tensor>>& tensors,
                              const py::bytes& spirv,
                              const kp::Workgroup& workgroup,
                              const py::array& spec_consts,
-                             const py::array& push_consts) {
+                             const py::array& push_consts,
+                             kp::Algorithm::BindingModes binding_mode) {
 
                 py::buffer_info info(py::buffer(spirv).request());
                 const char *data = reinterpret_cast<const char *>(info.ptr);
@@ -245,61 +1336,61 @@ PYBIND11_MODULE(kp, m) {
                     std::vector<float> specConstsVec((float*)specInfo.ptr, ((float*)specInfo.ptr) + specInfo.size);
                     if (spec_consts.dtype() == py::dtype::of<std::float_t>()) {
                         std::vector<float> pushConstsVec((float*)pushInfo.ptr, ((float*)pushInfo.ptr) + pushInfo.size);
-                        return self.algorithm(tensors, spirvVec, workgroup, specConstsVec, pushConstsVec);
+                        return self.algorithm(tensors, spirvVec, workgroup, specConstsVec, pushConstsVec, binding_mode);
                     } else if (spec_consts.dtype() == py::dtype::of<std::int32_t>()) {
                         std::vector<int32_t> pushConstsVec((int32_t*)pushInfo.ptr, ((int32_t*)pushInfo.ptr) + pushInfo.size);
-                        return self.algorithm(tensors, spirvVec, workgroup, specConstsVec, pushConstsVec);
+                        return self.algorithm(tensors, spirvVec, workgroup, specConstsVec, pushConstsVec, binding_mode);
                     } else if (spec_consts.dtype() == py::dtype::of<std::uint32_t>()) {
                         std::vector<uint32_t> pushConstsVec((uint32_t*)pushInfo.ptr, ((uint32_t*)pushInfo.ptr) + pushInfo.size);
-                        return self.algorithm(tensors, spirvVec, workgroup, specConstsVec, pushConstsVec);
+                        return self.algorithm(tensors, spirvVec, workgroup, specConstsVec, pushConstsVec, binding_mode);
                     } else if (spec_consts.dtype() == py::dtype::of<std::double_t>()) {
                         std::vector<double> pushConstsVec((double*)pushInfo.ptr, ((double*)pushInfo.ptr) + pushInfo.size);
-                        return self.algorithm(tensors, spirvVec, workgroup, specConstsVec, pushConstsVec);
+                        return self.algorithm(tensors, spirvVec, workgroup, specConstsVec, pushConstsVec, binding_mode);
                     }
                 } else if (spec_consts.dtype() == py::dtype::of<std::int32_t>()) {
                     std::vector<int32_t> specconstsvec((int32_t*)specInfo.ptr, ((int32_t*)specInfo.ptr) + specInfo.size);
                     if (spec_consts.dtype() == py::dtype::of<std::float_t>()) {
                         std::vector<float> pushconstsvec((float*)pushInfo.ptr, ((float*)pushInfo.ptr) + pushInfo.size);
-                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec);
+                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec, binding_mode);
                     } else if (spec_consts.dtype() == py::dtype::of<std::int32_t>()) {
                         std::vector<int32_t> pushconstsvec((int32_t*)pushInfo.ptr, ((int32_t*)pushInfo.ptr) + pushInfo.size);
-                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec);
+                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec, binding_mode);
                     } else if (spec_consts.dtype() == py::dtype::of<std::uint32_t>()) {
                         std::vector<uint32_t> pushconstsvec((uint32_t*)pushInfo.ptr, ((uint32_t*)pushInfo.ptr) + pushInfo.size);
-                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec);
+                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec, binding_mode);
                     } else if (spec_consts.dtype() == py::dtype::of<std::double_t>()) {
                         std::vector<double> pushconstsvec((double*)pushInfo.ptr, ((double*)pushInfo.ptr) + pushInfo.size);
-                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec);
+                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec, binding_mode);
                     }
                 } else if (spec_consts.dtype() == py::dtype::of<std::uint32_t>()) {
                     std::vector<uint32_t> specconstsvec((uint32_t*)specInfo.ptr, ((uint32_t*)specInfo.ptr) + specInfo.size);
                     if (spec_consts.dtype() == py::dtype::of<std::float_t>()) {
                         std::vector<float> pushconstsvec((float*)pushInfo.ptr, ((float*)pushInfo.ptr) + pushInfo.size);
-                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec);
+                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec, binding_mode);
                     } else if (spec_consts.dtype() == py::dtype::of<std::int32_t>()) {
                         std::vector<int32_t> pushconstsvec((int32_t*)pushInfo.ptr, ((int32_t*)pushInfo.ptr) + pushInfo.size);
-                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec);
+                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec, binding_mode);
                     } else if (spec_consts.dtype() == py::dtype::of<std::uint32_t>()) {
                         std::vector<uint32_t> pushconstsvec((uint32_t*)pushInfo.ptr, ((uint32_t*)pushInfo.ptr) + pushInfo.size);
-                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec);
+                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec, binding_mode);
                     } else if (spec_consts.dtype() == py::dtype::of<std::double_t>()) {
                         std::vector<double> pushconstsvec((double*)pushInfo.ptr, ((double*)pushInfo.ptr) + pushInfo.size);
-                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec);
+                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec, binding_mode);
                     }
                 } else if (spec_consts.dtype() == py::dtype::of<std::double_t>()) {
                     std::vector<double> specconstsvec((double*)specInfo.ptr, ((double*)specInfo.ptr) + specInfo.size);
                     if (spec_consts.dtype() == py::dtype::of<std::float_t>()) {
                         std::vector<float> pushconstsvec((float*)pushInfo.ptr, ((float*)pushInfo.ptr) + pushInfo.size);
-                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec);
+                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec, binding_mode);
                     } else if (spec_consts.dtype() == py::dtype::of<std::int32_t>()) {
                         std::vector<float> pushconstsvec((int32_t*)pushInfo.ptr, ((int32_t*)pushInfo.ptr) + pushInfo.size);
-                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec);
+                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec, binding_mode);
                     } else if (spec_consts.dtype() == py::dtype::of<std::uint32_t>()) {
                         std::vector<float> pushconstsvec((uint32_t*)pushInfo.ptr, ((uint32_t*)pushInfo.ptr) + pushInfo.size);
-                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec);
+                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec, binding_mode);
                     } else if (spec_consts.dtype() == py::dtype::of<std::double_t>()) {
                         std::vector<float> pushconstsvec((double*)pushInfo.ptr, ((double*)pushInfo.ptr) + pushInfo.size);
-                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec);
+                        return self.algorithm(tensors, spirvVec, workgroup, specconstsvec, pushconstsvec, binding_mode);
                     }
                 } else {
                     // If reach then no valid dtype supported
@@ -311,20 +1402,64 @@ PYBIND11_MODULE(kp, m) {
             py::arg("spirv"),
             py::arg("workgroup") = kp::Workgroup(),
             py::arg("spec_consts") = std::vector<float>(),
-            py::arg("push_consts") = std::vector<float>())
+            py::arg("push_consts") = std::vector<float>(),
+            py::arg("binding_mode") = kp::Algorithm::BindingModes::eDescriptors)
         .def("list_devices", [](kp::Manager& self){
             const std::vector<vk::PhysicalDevice> devices = self.listDevices();
             py::list list;
             for (const vk::PhysicalDevice& device : devices) {
-                list.append(kp::py::vkPropertiesToDict(device.getProperties()));
+                vk::PhysicalDeviceSubgroupProperties subgroupProperties;
+                vk::PhysicalDeviceProperties2 properties;
+                properties.pNext = &subgroupProperties;
+                device.getProperties2(&properties);
+                list.append(kp::py::vkPropertiesToDict(properties.properties, subgroupProperties));
             }
             return list;
         }, "Return a dict containing information about the device")
+        .def("select_device", &kp::Manager::selectDevice,
+                DOC(kp, Manager, selectDevice), py::arg("requirements"))
+        .def("device_scores", [](kp::Manager& self, const kp::Manager::DeviceRequirements& requirements){
+            py::list list;
+            for (const vk::PhysicalDevice& device : self.listDevices()) {
+                list.append(kp::Manager::scoreDevice(device, requirements));
+            }
+            return list;
+        }, DOC(kp, Manager, scoreDevice), py::arg("requirements"))
         .def("get_device_properties", [](kp::Manager& self){
             const vk::PhysicalDeviceProperties properties = self.getDeviceProperties();
 
-            return kp::py::vkPropertiesToDict(properties);
-        }, "Return a dict containing information about the device");
+            return kp::py::vkPropertiesToDict(properties, self.getSubgroupProperties());
+        }, "Return a dict containing information about the device")
+        .def("get_default_local_size", &kp::Manager::getDefaultLocalSize,
+                DOC(kp, Manager, getDefaultLocalSize))
+        .def("supports_subgroup_arithmetic", [](kp::Manager& self){
+            return self.supportsSubgroupOperations(
+              vk::SubgroupFeatureFlagBits::eBasic | vk::SubgroupFeatureFlagBits::eArithmetic);
+        }, DOC(kp, Manager, supportsSubgroupOperations))
+        .def("memory_stats", [](kp::Manager& self){
+            return kp::py::memoryStatsToDict(self.memoryStats());
+        }, DOC(kp, Manager, memoryStats))
+        .def("metrics", [](kp::Manager& self){
+            return kp::py::metricsToDict(self.metrics());
+        }, DOC(kp, Manager, metrics))
+        .def("reset_metrics", &kp::Manager::resetMetrics,
+                DOC(kp, Manager, resetMetrics))
+        .def("host_allocator", &kp::Manager::hostAllocator,
+                DOC(kp, Manager, hostAllocator))
+        .def("set_device_memory_limit", &kp::Manager::setDeviceMemoryLimit,
+                DOC(kp, Manager, setDeviceMemoryLimit), py::arg("limit"))
+        .def("set_concurrent_sharing", &kp::Manager::setConcurrentSharing,
+                DOC(kp, Manager, setConcurrentSharing), py::arg("concurrent_sharing"))
+        .def("has_timeline_semaphores", &kp::Manager::hasTimelineSemaphores,
+                DOC(kp, Manager, hasTimelineSemaphores))
+        .def("has_buffer_device_address", &kp::Manager::hasBufferDeviceAddress,
+                DOC(kp, Manager, hasBufferDeviceAddress))
+        .def("has_global_priority", &kp::Manager::hasGlobalPriority,
+                DOC(kp, Manager, hasGlobalPriority))
+        .def("has_debug_utils", &kp::Manager::hasDebugUtils,
+                DOC(kp, Manager, hasDebugUtils))
+        .def("supports_data_type", &kp::Manager::supportsDataType,
+                DOC(kp, Manager, supportsDataType), py::arg("data_type"));
 
     auto atexit = py::module_::import("atexit");
     atexit.attr("register")(py::cpp_function([](){
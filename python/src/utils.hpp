@@ -6,7 +6,30 @@ using namespace pybind11::literals; // for the `_a` literal
 
 namespace kp {
 namespace py {
-static pybind11::dict vkPropertiesToDict(const vk::PhysicalDeviceProperties& properties) {
+static pybind11::list vkSubgroupOperationsToList(const vk::SubgroupFeatureFlags& operations) {
+
+    const std::vector<std::pair<vk::SubgroupFeatureFlagBits, const char*>> names = {
+        { vk::SubgroupFeatureFlagBits::eBasic, "basic" },
+        { vk::SubgroupFeatureFlagBits::eVote, "vote" },
+        { vk::SubgroupFeatureFlagBits::eArithmetic, "arithmetic" },
+        { vk::SubgroupFeatureFlagBits::eBallot, "ballot" },
+        { vk::SubgroupFeatureFlagBits::eShuffle, "shuffle" },
+        { vk::SubgroupFeatureFlagBits::eShuffleRelative, "shuffle_relative" },
+        { vk::SubgroupFeatureFlagBits::eClustered, "clustered" },
+        { vk::SubgroupFeatureFlagBits::eQuad, "quad" },
+    };
+
+    pybind11::list list;
+    for (const auto& name : names) {
+        if (operations & name.first) {
+            list.append(name.second);
+        }
+    }
+    return list;
+}
+
+static pybind11::dict vkPropertiesToDict(const vk::PhysicalDeviceProperties& properties,
+                                         const vk::PhysicalDeviceSubgroupProperties& subgroupProperties) {
 
     pybind11::dict pyDict(
         "device_name"_a = std::string(properties.deviceName.data()),
@@ -17,7 +40,76 @@ static pybind11::dict vkPropertiesToDict(const vk::PhysicalDeviceProperties& pro
         "max_work_group_size"_a        = pybind11::make_tuple(properties.limits.maxComputeWorkGroupSize[0],
                                                         properties.limits.maxComputeWorkGroupSize[1],
                                                         properties.limits.maxComputeWorkGroupSize[2]),
-        "timestamps_supported"_a       = (bool)properties.limits.timestampComputeAndGraphics
+        "timestamps_supported"_a       = (bool)properties.limits.timestampComputeAndGraphics,
+        "subgroup_size"_a              = subgroupProperties.subgroupSize,
+        // Only the operations available in compute shaders are reported
+        "subgroup_operations"_a        = vkSubgroupOperationsToList(
+            (subgroupProperties.supportedStages & vk::ShaderStageFlagBits::eCompute)
+                ? subgroupProperties.supportedOperations
+                : vk::SubgroupFeatureFlags())
+    );
+
+    return pyDict;
+}
+
+static pybind11::dict memoryStatsToDict(const kp::Manager::MemoryStats& stats) {
+
+    pybind11::list heaps;
+    for (const kp::MemoryPool::HeapStats& heap : stats.heaps) {
+        heaps.append(pybind11::dict(
+            "device_local"_a = (bool)(heap.flags & vk::MemoryHeapFlagBits::eDeviceLocal),
+            "size"_a         = heap.size,
+            "budget"_a       = heap.budget,
+            "usage"_a        = heap.usage,
+            "allocated"_a    = heap.allocated,
+            "used"_a         = heap.used,
+            "limit"_a        = heap.limit
+        ));
+    }
+
+    pybind11::dict pyDict(
+        "heaps"_a               = heaps,
+        "tensor_count"_a        = stats.tensorCount,
+        "view_count"_a          = stats.viewCount,
+        "primary_memory_size"_a = stats.primaryMemorySize,
+        "staging_memory_size"_a = stats.stagingMemorySize
+    );
+
+    return pyDict;
+}
+
+static pybind11::dict metricsToDict(const kp::Metrics::Snapshot& metrics) {
+
+    pybind11::dict pyDict(
+        "submissions"_a               = metrics.submissions,
+        "command_buffers_recorded"_a  = metrics.commandBuffersRecorded,
+        "barriers"_a                  = metrics.barriers,
+        "bytes_uploaded"_a            = metrics.bytesUploaded,
+        "bytes_downloaded"_a          = metrics.bytesDownloaded,
+        "pipelines_created"_a         = metrics.pipelinesCreated,
+        "pipeline_cache_hits"_a       = metrics.pipelineCacheHits,
+        "descriptor_sets_allocated"_a = metrics.descriptorSetsAllocated,
+        "fence_waits"_a               = metrics.fenceWaits,
+        "fence_wait_ns"_a             = metrics.fenceWaitNs,
+        "tensor_count"_a              = metrics.tensorCount,
+        "algorithm_count"_a           = metrics.algorithmCount,
+        "sequence_count"_a            = metrics.sequenceCount
+    );
+
+    return pyDict;
+}
+
+static pybind11::dict hostAllocatorStatsToDict(const kp::HostAllocator::Stats& stats) {
+
+    pybind11::dict pyDict(
+        "allocations"_a          = stats.allocations,
+        "frees"_a                = stats.frees,
+        "arena_allocations"_a    = stats.arenaAllocations,
+        "live_bytes"_a           = stats.liveBytes,
+        "peak_bytes"_a           = stats.peakBytes,
+        "total_bytes"_a          = stats.totalBytes,
+        "internal_allocations"_a = stats.internalAllocations,
+        "internal_bytes"_a       = stats.internalBytes
     );
 
     return pyDict;
@@ -1,7 +1,12 @@
+import asyncio
+import json
 import os
+import threading
+import types
 
 import kp
 import numpy as np
+import pytest
 import logging
 import pyshader as ps
 
@@ -169,6 +174,265 @@ def test_sequence():
     assert tensor_out.is_init() == False
 
 
+def test_sequence_timestamps():
+    mgr = kp.Manager()
+
+    tensor_in = mgr.tensor([1, 2, 3])
+    tensor_out = mgr.tensor([0, 0, 0])
+
+    sq = mgr.sequence(0, 10)
+    sq.record(kp.OpTensorSyncDevice([tensor_in]))
+    sq.record(kp.OpTensorCopy([tensor_in, tensor_out]), "copy")
+    sq.record(kp.OpTensorSyncLocal([tensor_out]))
+
+    for _ in range(2):
+        sq.eval()
+        timings = sq.get_timestamps()
+
+        assert [timing.label for timing in timings] == ["OpTensorSyncDevice", "copy", "OpTensorSyncLocal"]
+        assert all(timing.duration_ns >= 0 for timing in timings)
+        assert len(sq.get_timestamps(wait=False)) == 3
+
+
+def test_debug_names():
+    mgr = kp.Manager()
+
+    tensor_in = mgr.tensor([1, 2, 3])
+    tensor_out = mgr.tensor([0, 0, 0])
+    tensor_in.set_name("input")
+    tensor_out.set_name("output")
+
+    sq = mgr.sequence()
+    sq.set_name("copy")
+    sq.record(kp.OpTensorSyncDevice([tensor_in]))
+    sq.record(kp.OpTensorCopy([tensor_in, tensor_out]), "copy")
+    sq.record(kp.OpTensorSyncLocal([tensor_out]))
+    sq.eval()
+
+    assert isinstance(mgr.has_debug_utils(), bool)
+    assert tensor_in.name() == "input"
+    assert sq.name() == "copy"
+    assert np.all(tensor_out.data() == tensor_in.data())
+
+
+def test_log_level(caplog):
+    level = kp_log.level
+
+    kp.set_log_level(logging.WARNING)
+    assert kp_log.level == logging.WARNING
+
+    mgr = kp.Manager()
+    tensor = mgr.tensor([1, 2, 3])
+    with caplog.at_level(logging.DEBUG, logger="kp"):
+        kp.set_log_level(logging.WARNING)
+        mgr.sequence().eval(kp.OpTensorSyncLocal([tensor]))
+    assert not [record for record in caplog.records if record.levelno < logging.WARNING]
+
+    kp.set_log_level(level)
+
+
+def test_metrics():
+    mgr = kp.Manager()
+
+    tensor_in = mgr.tensor([1, 2, 3])
+    tensor_out = mgr.tensor([0, 0, 0])
+
+    sq = mgr.sequence()
+    sq.record(kp.OpTensorSyncDevice([tensor_in]))
+    sq.record(kp.OpTensorCopy([tensor_in, tensor_out]))
+    sq.record(kp.OpTensorSyncLocal([tensor_out]))
+    sq.eval()
+
+    metrics = mgr.metrics()
+    assert metrics["submissions"] == 1
+    assert metrics["bytes_uploaded"] == 12
+    assert metrics["bytes_downloaded"] == 12
+    assert metrics["fence_waits"] == 1
+    assert metrics["tensor_count"] == 2
+    assert metrics["sequence_count"] == 1
+
+    sq.eval()
+    assert mgr.metrics()["submissions"] == 2
+    assert mgr.metrics()["bytes_uploaded"] == 24
+
+    mgr.reset_metrics()
+    assert mgr.metrics()["submissions"] == 0
+
+
+def test_host_allocator():
+    host_allocator = kp.HostAllocator(arena_size=64 * 1024)
+    mgr = kp.Manager(0, host_allocator=host_allocator)
+    assert mgr.host_allocator() is not None
+
+    tensor_in = mgr.tensor([1, 2, 3])
+    tensor_out = mgr.tensor([0, 0, 0])
+
+    host_allocator.reset_stats()
+    assert host_allocator.stats()["allocations"] == 0
+
+    sq = mgr.sequence()
+    sq.record(kp.OpTensorSyncDevice([tensor_in]))
+    sq.record(kp.OpTensorCopy([tensor_in, tensor_out]))
+    sq.record(kp.OpTensorSyncLocal([tensor_out]))
+    sq.eval()
+
+    stats = host_allocator.stats()
+    assert stats["peak_bytes"] >= stats["live_bytes"]
+    assert np.all(tensor_out.data() == tensor_in.data())
+
+    sq.destroy()
+    tensor_in.destroy()
+    tensor_out.destroy()
+    mgr.destroy()
+    assert host_allocator.stats()["live_bytes"] == 0
+
+
+def test_tracer():
+    mgr = kp.Manager()
+
+    tensor_in = mgr.tensor([1, 2, 3])
+    tensor_out = mgr.tensor([0, 0, 0])
+
+    kp.Tracer.start()
+    assert kp.Tracer.is_enabled()
+
+    sq = mgr.sequence(0, 10)
+    sq.record(kp.OpTensorSyncDevice([tensor_in]))
+    sq.record(kp.OpTensorCopy([tensor_in, tensor_out]), "copy")
+    sq.record(kp.OpTensorSyncLocal([tensor_out]))
+    sq.eval()
+
+    kp.Tracer.stop()
+    assert not kp.Tracer.is_enabled()
+
+    assert kp.Tracer.event_count() > 0
+    trace = json.loads(kp.Tracer.chrome_trace())
+    names = [event["name"] for event in trace["traceEvents"]]
+    assert "Sequence::evalAwait" in names
+    assert "copy" in names
+
+
+def test_benchmark():
+    mgr = kp.Manager()
+
+    tensor_in = mgr.tensor(np.arange(1024, dtype=np.float32))
+    tensor_out = mgr.tensor(np.zeros(1024, dtype=np.float32))
+
+    sq = mgr.sequence(0, 3)
+    sq.record(kp.OpTensorSyncDevice([tensor_in]))
+    sq.record(kp.OpTensorCopy([tensor_in, tensor_out]), "copy")
+    sq.record(kp.OpTensorSyncLocal([tensor_out]))
+
+    bench = kp.benchmark.Benchmark(mgr, warmup=1, repetitions=5)
+    result = bench.run(sq, bytes=2 * 1024 * 4, label="copy")
+    assert result.label == "copy"
+    assert result.repetitions == 5
+    assert result.min_ns <= result.median_ns <= result.max_ns
+    assert result.gbps >= 0
+
+    a = np.random.rand(64, 64).astype(np.float32)
+    host = bench.run_host(lambda: a @ a, flops=2 * 64 ** 3)
+    assert host.label == "host"
+    assert host.gflops > 0
+
+    assert np.all(tensor_out.data() == tensor_in.data())
+
+
+def test_tuner(tmp_path):
+    mgr = kp.Manager()
+
+    tensor = mgr.tensor(np.zeros(256, dtype=np.float32))
+
+    spirv = compile_source("""
+          #version 450
+          layout (local_size_x_id = 0) in;
+          layout(set = 0, binding = 0) buffer a { float pa[]; };
+          void main() {
+              uint index = gl_GlobalInvocationID.x;
+              pa[index] = float(index);
+          }
+        """)
+
+    algo = mgr.algorithm([tensor], spirv)
+
+    candidates = [
+        kp.benchmark.Candidate((256 // local_size, 1, 1), np.array([local_size], dtype=np.uint32))
+        for local_size in (8, 64, 256)
+    ]
+
+    path = str(tmp_path / "tuning.tsv")
+    tuner = kp.benchmark.Tuner(mgr, path, warmup=1, repetitions=3)
+    result = tuner.tune(algo, "fill", [256], candidates)
+    assert not result.cached
+    assert result.median_ns > 0
+    assert list(algo.get_workgroup()) == list(result.candidate.workgroup)
+
+    mgr.sequence().eval(kp.OpAlgoDispatch(algo)).eval(kp.OpTensorSyncLocal([tensor]))
+    assert np.all(tensor.data() == np.arange(256, dtype=np.float32))
+
+    # The choice is loaded from the database by later tuners
+    cached = kp.benchmark.Tuner(mgr, path).tune(algo, "fill", [256], [])
+    assert cached.cached
+    assert cached.candidate.spec_consts == result.candidate.spec_consts
+    assert tuner.find("fill", [128]) is None
+
+def test_eval_asyncio():
+    mgr = kp.Manager()
+
+    tensors_in = [mgr.tensor(np.full(1024, i, dtype=np.float32)) for i in range(4)]
+    tensors_out = [mgr.tensor(np.zeros(1024, dtype=np.float32)) for _ in range(4)]
+    sequences = [mgr.sequence()
+                 .record(kp.OpTensorSyncDevice([tensor_in]))
+                 .record(kp.OpTensorCopy([tensor_in, tensor_out]))
+                 .record(kp.OpTensorSyncLocal([tensor_out]))
+                 for tensor_in, tensor_out in zip(tensors_in, tensors_out)]
+
+    async def run():
+        # The loop keeps running other tasks while the sequences execute
+        ticks = 0
+
+        async def tick():
+            nonlocal ticks
+            while True:
+                ticks += 1
+                await asyncio.sleep(0)
+
+        ticker = asyncio.ensure_future(tick())
+        results = await asyncio.gather(*[mgr.eval_asyncio(sq) for sq in sequences])
+        ticker.cancel()
+        return results, ticks
+
+    results, ticks = asyncio.run(run())
+    assert results == sequences
+    assert ticks > 0
+    for i, tensor_out in enumerate(tensors_out):
+        assert np.all(tensor_out.data() == i)
+
+
+def test_eval_threads():
+    mgr = kp.Manager()
+
+    count = 4
+    tensors_in = [mgr.tensor(np.full(1024, i, dtype=np.float32)) for i in range(count)]
+    tensors_out = [mgr.tensor(np.zeros(1024, dtype=np.float32)) for _ in range(count)]
+
+    # Each thread evaluates its own sequence, the GIL being released while the GPU works
+    def run(i):
+        (mgr.sequence()
+            .record(kp.OpTensorSyncDevice([tensors_in[i]]))
+            .record(kp.OpTensorCopy([tensors_in[i], tensors_out[i]]))
+            .record(kp.OpTensorSyncLocal([tensors_out[i]]))
+            .eval())
+
+    threads = [threading.Thread(target=run, args=(i,)) for i in range(count)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    for i, tensor_out in enumerate(tensors_out):
+        assert np.all(tensor_out.data() == i)
+
 def test_pushconsts():
 
     spirv = compile_source("""
@@ -204,6 +468,43 @@ def test_pushconsts():
     assert np.allclose(tensor.data(), np.array([0.7, 0.6, 0.5], dtype=np.float32))
 
 
+def test_record_many():
+
+    spirv = compile_source("""
+          #version 450
+          layout(push_constant) uniform PushConstants {
+            float x;
+            float y;
+            float z;
+          } pcs;
+          layout (local_size_x = 1) in;
+          layout(set = 0, binding = 0) buffer a { float pa[]; };
+          void main() {
+              pa[0] += pcs.x;
+              pa[1] += pcs.y;
+              pa[2] += pcs.z;
+          }
+    """)
+
+    mgr = kp.Manager()
+
+    tensor = mgr.tensor([0, 0, 0])
+
+    algo = mgr.algorithm([tensor], spirv, (1, 1, 1), [], [0, 0, 0])
+
+    # Each row holds the push constants of a dispatch
+    rows = np.tile(np.array([1, 2, 3], dtype=np.float32), (1000, 1))
+
+    sq = mgr.sequence()
+    sq.record_many([kp.OpTensorSyncDevice([tensor])] + [kp.OpAlgoDispatch(algo, [1, 1, 1]) for _ in range(100)])
+    sq.record_dispatches(algo, rows, barrier_between_dispatches=True)
+    sq.record(kp.OpTensorSyncLocal([tensor]))
+    sq.eval()
+
+    assert len(sq.operations()) == 103
+    assert np.allclose(tensor.data(), np.array([1100, 2100, 3100], dtype=np.float32))
+
+
 def test_pushconsts_int():
 
     spirv = compile_source("""
@@ -285,3 +586,179 @@ def test_mgr_utils():
     assert len(devices) > 0
     assert "device_name" in devices[0]
 
+
+
+def test_mgr_select_device():
+    requirements = kp.DeviceRequirements()
+    mgr = kp.Manager(requirements)
+
+    scores = mgr.device_scores(requirements)
+    selected = mgr.select_device(requirements)
+
+    assert len(scores) == len(mgr.list_devices())
+    assert scores[selected] == max(scores)
+    assert mgr.get_device_properties()["device_name"] == mgr.list_devices()[selected]["device_name"]
+
+    requirements.extensions = ["VK_KP_missing_extension"]
+    assert all(score == -1 for score in mgr.device_scores(requirements))
+
+def test_mgr_queue_priorities():
+    priority = kp.QueuePriority(0.5, kp.QueueGlobalPriority.high)
+    mgr = kp.Manager(0, [0], queue_priorities=[priority])
+
+    assert mgr.queue_priority(0).priority == 0.5
+    assert mgr.queue_index(kp.QueueRole.high_priority) == 0
+
+    tensor_in = mgr.tensor([1, 2, 3])
+    tensor_out = mgr.tensor([0, 0, 0])
+
+    (mgr.sequence(kp.QueueRole.high_priority)
+        .record(kp.OpTensorSyncDevice([tensor_in]))
+        .record(kp.OpTensorCopy([tensor_in, tensor_out]))
+        .record(kp.OpTensorSyncLocal([tensor_out]))
+        .eval())
+
+    assert tensor_out.data().tolist() == [1, 2, 3]
+
+def test_graph():
+    mgr = kp.Manager()
+
+    tensor_in = mgr.tensor([1, 2, 3])
+    tensor_a = mgr.tensor([0, 0, 0])
+    tensor_b = mgr.tensor([0, 0, 0])
+
+    graph = mgr.graph()
+    graph.add(kp.OpTensorSyncDevice([tensor_in]))
+    graph.add(kp.OpTensorCopy([tensor_in, tensor_a]), [tensor_in], [tensor_a])
+    graph.add(kp.OpTensorCopy([tensor_in, tensor_b]), [tensor_in], [tensor_b])
+    graph.add(kp.OpTensorSyncLocal([tensor_a, tensor_b]), [tensor_a, tensor_b], [])
+
+    assert graph.dependencies(3) == [1, 2]
+
+    graph.run()
+    tensor_in.data()[:] = [4, 5, 6]
+    graph.run()
+
+    assert graph.compile_count() == 1
+    assert tensor_a.data().tolist() == [4, 5, 6]
+    assert tensor_b.data().tolist() == [4, 5, 6]
+
+def test_sparse_tensor():
+    mgr = kp.Manager()
+
+    dense = np.array([[1, 0, 2, 0],
+                      [0, 0, 0, 0],
+                      [0, 3, 0, 4]], dtype=np.float32)
+
+    # Same attributes and index dtype as a scipy.sparse.csr_matrix
+    csr = types.SimpleNamespace(
+        shape=dense.shape,
+        indptr=np.array([0, 2, 2, 4], dtype=np.int32),
+        indices=np.array([0, 2, 1, 3], dtype=np.int32),
+        data=np.array([1, 2, 3, 4], dtype=np.float32))
+
+    matrix = mgr.sparse_tensor(csr)
+    assert matrix.shape == (3, 4)
+    assert matrix.non_zero_count() == 4
+
+    x = np.array([1, 2, 3, 4], dtype=np.float32)
+    b = np.arange(8, dtype=np.float32).reshape(4, 2)
+    tensor_x = mgr.tensor(x)
+    tensor_y = mgr.tensor(np.zeros(3, dtype=np.float32))
+    tensor_b = mgr.tensor(b)
+    tensor_c = mgr.tensor(np.zeros(6, dtype=np.float32))
+
+    (mgr.sequence()
+        .record(kp.OpTensorSyncDevice(matrix.tensors() + [tensor_x, tensor_b]))
+        .record(kp.OpSpMV(matrix, [tensor_x, tensor_y], mgr.algorithm()))
+        .record(kp.OpSpMM(matrix, [tensor_b, tensor_c], mgr.algorithm(), 2))
+        .record(kp.OpTensorSyncLocal([tensor_y, tensor_c]))
+        .eval())
+
+    assert np.allclose(tensor_y.data(), dense @ x)
+    assert np.allclose(tensor_c.data(), (dense @ b).flatten())
+
+def test_tensor_copy_host_update():
+    mgr = kp.Manager()
+
+    tensor_in = mgr.tensor([1, 2, 3])
+    tensors_out = [mgr.tensor([0, 0, 0]) for _ in range(4)]
+
+    (mgr.sequence()
+        .record(kp.OpTensorSyncDevice([tensor_in]))
+        .record(kp.OpTensorCopy([tensor_in] + tensors_out, host_update=kp.CopyHostUpdate.none))
+        .eval())
+
+    # Only the device memory was copied
+    assert tensors_out[0].data().tolist() == [0, 0, 0]
+
+    mgr.sequence().eval(kp.OpTensorSyncLocal(tensors_out))
+
+    for tensor_out in tensors_out:
+        assert tensor_out.data().tolist() == [1, 2, 3]
+
+
+def test_tensor_archive(tmp_path):
+    mgr = kp.Manager()
+
+    path = str(tmp_path / "weights.kpta")
+    weight = np.arange(6, dtype=np.float32).reshape(2, 3)
+    bias = np.array([7, 8, 9], dtype=np.uint32)
+    kp.TensorArchive.write(path, {"weight": weight.T, "bias": bias})
+
+    archive = kp.TensorArchive(path)
+    assert [entry.name for entry in archive.entries()] == ["weight", "bias"]
+    assert archive.find("weight").shape == [3, 2]
+    assert archive.find("missing") is None
+
+    tensors = archive.load(mgr)
+    archive.close()
+    assert not archive.is_open()
+
+    # The tensors were uploaded while loading, so their host data is
+    # overwritten before syncing them back
+    tensors["weight"].data()[:] = 0
+    mgr.sequence().eval(kp.OpTensorSyncLocal(list(tensors.values())))
+
+    assert np.array_equal(tensors["weight"].data(), weight.T.flatten())
+    assert tensors["bias"].data().tolist() == [7, 8, 9]
+
+
+def test_buffer_device_address():
+    mgr = kp.Manager(0, [], ["VK_KHR_buffer_device_address"])
+
+    if not mgr.has_buffer_device_address():
+        pytest.skip("Device has no buffer device addresses")
+
+    spirv = compile_source("""
+          #version 450
+          #extension GL_EXT_buffer_reference : require
+          layout (local_size_x = 1) in;
+          layout(buffer_reference, std430, buffer_reference_align = 4)
+            buffer Values { float v[]; };
+          layout(push_constant) uniform PushConstants {
+            Values a;
+            Values b;
+            float scale;
+          } pcs;
+          void main() {
+              uint index = gl_GlobalInvocationID.x;
+              pcs.b.v[index] = pcs.a.v[index] * pcs.scale;
+          }
+    """)
+
+    tensor_in = mgr.tensor([1, 2, 3])
+    tensor_out = mgr.tensor([0, 0, 0])
+    assert tensor_in.device_address() != 0
+
+    algo = mgr.algorithm([tensor_in, tensor_out], spirv, (3, 1, 1), [], [2.0],
+                         binding_mode=kp.BindingModes.device_addresses)
+    assert algo.binding_mode() == kp.BindingModes.device_addresses
+
+    (mgr.sequence()
+        .record(kp.OpTensorSyncDevice([tensor_in, tensor_out]))
+        .record(kp.OpAlgoDispatch(algo))
+        .record(kp.OpTensorSyncLocal([tensor_out]))
+        .eval())
+
+    assert tensor_out.data().tolist() == [2, 4, 6]
@@ -101,3 +101,30 @@ def test_logistic_regression():
     assert tensor_w_in.data()[1] > 1.5
     assert tensor_b_in.data()[0] < 0.7
 
+
+
+def test_op_logistic_regression():
+
+    mgr = kp.Manager(0)
+
+    # Five samples of two features stored row by row
+    tensor_x = mgr.tensor(np.array([0.0, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0, 1.0, 1.0, 1.0]))
+    tensor_y = mgr.tensor(np.array([0.0, 0.0, 0.0, 1.0, 1.0]))
+
+    tensor_w = mgr.tensor(np.array([0.001, 0.001]))
+    tensor_b = mgr.tensor(np.array([0.0]))
+    tensor_l = mgr.tensor(np.array([0.0]))
+
+    params = [tensor_x, tensor_y, tensor_w, tensor_b, tensor_l]
+
+    # Every epoch runs on the GPU and only the results are synced back
+    (mgr.sequence()
+        .record(kp.OpTensorSyncDevice(params))
+        .record(kp.OpLogisticRegression(params, mgr.algorithm(), 100, 0.1))
+        .record(kp.OpTensorSyncLocal([tensor_w, tensor_b, tensor_l]))
+        .eval())
+
+    assert tensor_w.data()[0] < 0.01
+    assert tensor_w.data()[1] > 1.5
+    assert tensor_b.data()[0] < 0.0
+    assert tensor_l.data()[0] < 0.5
@@ -231,3 +231,89 @@ def test_tensor_numpy_ownership():
 
     assert td.base.is_init() == False
 
+
+def test_tensor_narrow_types():
+
+    mgr = kp.Manager()
+
+    arrays = [
+        np.array([0.5, -1.0, 2.0], dtype=np.float16),
+        np.array([-128, 0, 127, 3, 5], dtype=np.int8),
+        np.array([0, 255, 3], dtype=np.uint8),
+        np.array([-32768, 0, 32767], dtype=np.int16),
+    ]
+    tensors = [mgr.tensor_t(arr) for arr in arrays]
+
+    mgr.sequence().eval(kp.OpTensorSyncDevice(tensors))
+    for tensor in tensors:
+        tensor.data()[:] = 0
+    mgr.sequence().eval(kp.OpTensorSyncLocal(tensors))
+
+    for arr, tensor in zip(arrays, tensors):
+        assert tensor.data().dtype == arr.dtype
+        assert np.all(tensor.data() == arr)
+
+
+def test_tensor_strided():
+
+    mgr = kp.Manager()
+
+    arr = np.arange(24, dtype=np.float32).reshape(4, 6)
+    views = [arr.T, arr[::2, 1::2], arr[:, 3]]
+    tensors = [mgr.tensor(view) for view in views]
+    tensors.append(mgr.tensor_t(arr.astype(np.int16)[::-1]))
+
+    mgr.sequence().eval(kp.OpTensorSyncDevice(tensors))
+    for tensor in tensors:
+        tensor.data()[:] = 0
+    mgr.sequence().eval(kp.OpTensorSyncLocal(tensors))
+
+    for view, tensor in zip(views, tensors):
+        assert np.all(tensor.data() == np.ravel(view))
+    assert np.all(tensors[-1].data() == np.ravel(arr[::-1]))
+
+
+def test_tensor_empty():
+
+    mgr = kp.Manager()
+
+    tensor_in = mgr.tensor_empty(3, kp.DataTypes.uint, host_memory_type=kp.HostMemoryTypes.cached)
+    tensor_out = mgr.tensor_empty(3, kp.DataTypes.uint, zero_initialise=True)
+
+    assert tensor_in.data().dtype == np.uint32
+    assert np.all(tensor_out.data() == 0)
+
+    # The data is written straight into the mapped staging memory
+    np.copyto(tensor_in.data(), np.array([4, 5, 6], dtype=np.uint32))
+
+    (mgr.sequence()
+        .record(kp.OpTensorSyncDevice([tensor_in]))
+        .record(kp.OpTensorCopy([tensor_in, tensor_out]))
+        .record(kp.OpTensorSyncLocal([tensor_out]))
+        .eval())
+
+    assert np.all(tensor_out.data() == [4, 5, 6])
+
+
+@pytest.mark.skipif(not hasattr(np, "from_dlpack"), reason="numpy without DLPack support")
+def test_tensor_dlpack():
+
+    mgr = kp.Manager()
+
+    arr = np.arange(12, dtype=np.float32).reshape(3, 4)
+    tensor = mgr.tensor_from_dlpack(arr[:, ::2])
+    assert tensor.data_type() == kp.DataTypes.float
+    assert np.all(tensor.data() == np.ravel(arr[:, ::2]))
+
+    # The exported array wraps the memory of the tensor without a copy
+    exported = np.from_dlpack(tensor)
+    assert exported.dtype == np.float32
+    exported[0] = 42
+    assert tensor.data()[0] == 42
+
+    del tensor
+    assert exported[0] == 42
+
+    tensor_int = mgr.tensor_from_dlpack(np.array([1, -2, 3], dtype=np.int8))
+    assert tensor_int.data_type() == kp.DataTypes.int8
+    assert np.all(np.from_dlpack(tensor_int) == [1, -2, 3])
@@ -1,7 +1,11 @@
 import os
 
+import kp
+
 
 def compile_source(source):
+    if kp.Shader.compiler_available():
+        return kp.Shader.compile(source)
     open("tmp_kp_shader.comp", "w").write(source)
     os.system("glslangValidator -V tmp_kp_shader.comp -o tmp_kp_shader.comp.spv")
     return open("tmp_kp_shader.comp.spv", "rb").read()
@@ -6,6 +6,7 @@ import sys
 import logging
 import click
 import subprocess
+import tempfile
 
 logger = logging.getLogger(__name__)
 logger.addHandler(logging.StreamHandler())
@@ -60,6 +61,19 @@ SHADER_GENERATED_NOTICE = """/*
     required=False,
     help="The (optional) output file for the cpp header files",
 )
+@click.option(
+    "--check",
+    default=False,
+    is_flag=True,
+    help="Compile the shaders to a temporary directory, validate them and "
+    "fail if they differ from the binaries next to them, without writing",
+)
+@click.option(
+    "--validator-binary",
+    envvar="KOMPUTE_VALIDATOR_BINARY",
+    default="spirv-val",
+    help="The path for the spirv-val binary used by --check",
+)
 @click.option(
     "--verbose",
     "-v",
@@ -72,6 +86,8 @@ def run_cli(
     shader_path: str = None,
     shader_binary: str = None,
     header_path: bool = None,
+    check: bool = None,
+    validator_binary: str = None,
     verbose: bool = None,
 ):
     """
@@ -98,6 +114,10 @@ def run_cli(
 
     run_cmd = lambda *args: subprocess.check_output([*args]).decode()
 
+    if check:
+        check_shaders(shader_files, shader_binary, validator_binary, run_cmd)
+        return
+
     logger.debug(f"Output spirv path: {shader_path}")
     logger.debug(f"Converting files to spirv: {shader_files}")
 
@@ -105,7 +125,7 @@ def run_cli(
     for file in shader_files:
         logger.debug(f"Converting to spirv: {file}")
         spirv_file = f"{file}.spv"
-        run_cmd(shader_binary, "-V", file, "-o", spirv_file)
+        run_cmd(shader_binary, "-V", *target_env_args(file), file, "-o", spirv_file)
         spirv_files.append(spirv_file)
 
     # Create cpp files if header_path provided
@@ -144,5 +164,47 @@ def run_cli(
                 fstream.write(f"#endif // define {header_file_define}\n")
 
 
+def target_env_args(file):
+    """
+    Targets Vulkan 1.1 only for the subgroup shaders, which require SPIR-V
+    1.3, so the other shaders build to the same binaries as before
+    """
+
+    with open(file, "r") as fstream:
+        source = fstream.read()
+    if "GL_KHR_shader_subgroup" in source:
+        return ["--target-env", "vulkan1.1"]
+    return []
+
+
+def check_shaders(shader_files, shader_binary, validator_binary, run_cmd):
+    """
+    Compiles each shader the same way as the conversion, validates the
+    result and compares it with the committed binary, so binaries that were
+    not generated from their source are caught
+    """
+
+    mismatches = []
+    with tempfile.TemporaryDirectory() as tmp_dir:
+        for file in shader_files:
+            spirv_file = f"{file}.spv"
+            tmp_file = os.path.join(tmp_dir, os.path.basename(spirv_file))
+            logger.debug(f"Checking spirv: {spirv_file}")
+            run_cmd(shader_binary, "-V", *target_env_args(file), file, "-o", tmp_file)
+            run_cmd(validator_binary, "--target-env", "vulkan1.1", tmp_file)
+            with open(tmp_file, "rb") as compiled:
+                compiled_data = compiled.read()
+            if not os.path.exists(spirv_file):
+                mismatches.append(spirv_file)
+                continue
+            with open(spirv_file, "rb") as committed:
+                if committed.read() != compiled_data:
+                    mismatches.append(spirv_file)
+
+    if mismatches:
+        logger.error(f"Shader binaries differ from their source: {mismatches}")
+        sys.exit(1)
+
+
 if __name__ == "__main__":
     run_cli()
@@ -1,15 +1,62 @@
 #pragma once
 #include "kompute/shaders/shaderopmult.hpp"
+#include "kompute/shaders/shaderopmatmul.hpp"
 #include "kompute/shaders/shaderlogisticregression.hpp"
+#include "kompute/shaders/shaderopreduce.hpp"
+#include "kompute/shaders/shaderopreduce_subgroup.hpp"
+#include "kompute/shaders/shaderopscan.hpp"
+#include "kompute/shaders/shaderopcompact.hpp"
+#include "kompute/shaders/shaderopsort.hpp"
+#include "kompute/shaders/shaderopspmv.hpp"
+#include "kompute/shaders/shaderopspmm.hpp"
 #include "kompute/Core.hpp"
+#include "kompute/Tracer.hpp"
+#include "kompute/DebugUtils.hpp"
+#include "kompute/Metrics.hpp"
+#include "kompute/HostAllocator.hpp"
+#include "kompute/DeviceInfo.hpp"
+#include "kompute/MemoryPool.hpp"
+#include "kompute/StagingRing.hpp"
 #include "kompute/Tensor.hpp"
+#include "kompute/SparseTensor.hpp"
+#include "kompute/DescriptorAllocator.hpp"
+#include "kompute/ShaderCache.hpp"
+#include "kompute/Shader.hpp"
+#include "kompute/WorkerPool.hpp"
 #include "kompute/Algorithm.hpp"
+#include "kompute/Expression.hpp"
 #include "kompute/operations/OpBase.hpp"
 #include "kompute/operations/OpMemoryBarrier.hpp"
 #include "kompute/operations/OpTensorCopy.hpp"
+#include "kompute/operations/OpTensorFill.hpp"
 #include "kompute/operations/OpTensorSyncDevice.hpp"
 #include "kompute/operations/OpTensorSyncLocal.hpp"
 #include "kompute/operations/OpAlgoDispatch.hpp"
+#include "kompute/operations/OpAlgoDispatchIndirect.hpp"
+#include "kompute/operations/OpAlgoDispatchBatch.hpp"
 #include "kompute/operations/OpMult.hpp"
+#include "kompute/operations/OpMatMul.hpp"
+#include "kompute/operations/OpConv2D.hpp"
+#include "kompute/operations/OpSpMV.hpp"
+#include "kompute/operations/OpSpMM.hpp"
+#include "kompute/operations/OpReduce.hpp"
+#include "kompute/operations/OpScan.hpp"
+#include "kompute/operations/OpCompact.hpp"
+#include "kompute/operations/OpSort.hpp"
+#include "kompute/operations/OpLogisticRegression.hpp"
+#include "kompute/operations/OpExpression.hpp"
+#include "kompute/HazardTracker.hpp"
+#include "kompute/Block.hpp"
 #include "kompute/Sequence.hpp"
+#include "kompute/SubmitBatch.hpp"
+#include "kompute/ResourceRegistry.hpp"
+#include "kompute/CompletionWaiter.hpp"
+#include "kompute/Scheduler.hpp"
+#include "kompute/Graph.hpp"
+#include "kompute/StreamPipeline.hpp"
 #include "kompute/Manager.hpp"
+#include "kompute/ShardedTensor.hpp"
+#include "kompute/MultiManager.hpp"
+#include "kompute/Benchmark.hpp"
+#include "kompute/Tuner.hpp"
+#include "kompute/TensorArchive.hpp"
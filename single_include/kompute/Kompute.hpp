@@ -173,6 +173,512 @@ static const unsigned int shaders_glsl_opmult_comp_spv_len = 1464;
     limitations under the License.
 */
 
+#ifndef SHADEROP_SHADEROPMATMUL_HPP
+#define SHADEROP_SHADEROPMATMUL_HPP
+
+namespace kp {
+namespace shader_data {
+static const unsigned char shaders_glsl_opmatmul_comp_spv[] = {
+  0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x06, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73,
+  0x6f, 0x72, 0x41, 0x00, 0x06, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x41, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73,
+  0x6f, 0x72, 0x42, 0x00, 0x06, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x42, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73,
+  0x6f, 0x72, 0x43, 0x00, 0x06, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x43, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x50, 0x75, 0x73, 0x68,
+  0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x04, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x41, 0x4d, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x41, 0x4b, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x42, 0x4b, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x42, 0x4e, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x62, 0x61, 0x74, 0x63, 0x68, 0x53, 0x74, 0x72, 0x69, 0x64, 0x65, 0x41,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x62, 0x61, 0x74, 0x63, 0x68, 0x53, 0x74, 0x72,
+  0x69, 0x64, 0x65, 0x42, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x62, 0x61, 0x74, 0x63,
+  0x68, 0x53, 0x74, 0x72, 0x69, 0x64, 0x65, 0x43, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x70, 0x63, 0x73, 0x00,
+  0x05, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x4c,
+  0x6f, 0x63, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x49, 0x44, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x57, 0x6f, 0x72, 0x6b, 0x47,
+  0x72, 0x6f, 0x75, 0x70, 0x49, 0x44, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x57, 0x6f, 0x72, 0x6b, 0x47,
+  0x72, 0x6f, 0x75, 0x70, 0x53, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x57, 0x4f, 0x52, 0x4b,
+  0x5f, 0x50, 0x45, 0x52, 0x5f, 0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x74, 0x69, 0x6c, 0x65,
+  0x41, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x74, 0x69, 0x6c, 0x65, 0x42, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x61, 0x63, 0x63, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x6b, 0x30, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x6b, 0x6b, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x03, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x25, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x32, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x33, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x32, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x67, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x6a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x6a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x69, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x69, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x72, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x75, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x77, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x73, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x12, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x79, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x79, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x05, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x8a, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x8a, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x8e, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x89, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x8a, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x94, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x03, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x97, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x98, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xa1, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0xa2, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x79, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x04, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xa7, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0xab, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0xad, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x3e, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x12, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xb0, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0xb1, 0x00, 0x00, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xb3, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb3, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0xb5, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0xb5, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0xb1, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0xba, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00,
+  0xba, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0xbd, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0xbd, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0xbf, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0xc1, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb2, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0xc4, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x12, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xb1, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa6, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xa4, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xa5, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x04, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x74, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x12, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xc9, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xc9, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0xca, 0x00, 0x00, 0x00,
+  0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xcc, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xcc, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0xce, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0xce, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00,
+  0xca, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xcf, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0xd1, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0xd2, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0xd4, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0xa7, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x00, 0x00,
+  0xd4, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xd5, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0xd9, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00,
+  0xd9, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0xd0, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0xdc, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0xdd, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xd6, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xd6, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xcb, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xcb, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0xde, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0xdf, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xc9, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xca, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00,
+  0x38, 0x00, 0x01, 0x00
+};
+static const unsigned int shaders_glsl_opmatmul_comp_spv_len = 5680;
+}
+}
+#endif // define SHADEROP_SHADEROPMATMUL_HPP
+
+/*
+    THIS FILE HAS BEEN AUTOMATICALLY GENERATED - DO NOT EDIT
+
+    ---
+
+    Copyright 2020 The Institute for Ethical AI & Machine Learning
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
 #ifndef SHADEROP_SHADERLOGISTICREGRESSION_HPP
 #define SHADEROP_SHADERLOGISTICREGRESSION_HPP
 
@@ -587,6 +1093,2669 @@ static const unsigned int shaders_glsl_logisticregression_comp_spv_len = 4816;
 }
 #endif // define SHADEROP_SHADERLOGISTICREGRESSION_HPP
 
+/*
+    THIS FILE HAS BEEN AUTOMATICALLY GENERATED - DO NOT EDIT
+
+    ---
+
+    Copyright 2020 The Institute for Ethical AI & Machine Learning
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef SHADEROP_SHADEROPREDUCE_HPP
+#define SHADEROP_SHADEROPREDUCE_HPP
+
+namespace kp {
+namespace shader_data {
+static const unsigned char shaders_glsl_opreduce_comp_spv[] = {
+  0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x4f, 0x50, 0x45, 0x52, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x50, 0x75, 0x73, 0x68,
+  0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x70, 0x61, 0x73, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x70, 0x63, 0x73, 0x00, 0x05, 0x00, 0x04, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73,
+  0x6f, 0x72, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x06, 0x00, 0x06, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x73, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x4e, 0x75, 0x6d, 0x57, 0x6f,
+  0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x57,
+  0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x53, 0x69, 0x7a, 0x65,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61,
+  0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49,
+  0x44, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x4c, 0x6f, 0x63, 0x61, 0x6c,
+  0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x70, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6c, 0x73, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x11, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x00, 0x74, 0x6f, 0x74, 0x61,
+  0x6c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x70, 0x72, 0x65, 0x76, 0x69, 0x6f, 0x75, 0x73, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x00, 0x14, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73,
+  0x6f, 0x72, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x07, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x32, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x06, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x02, 0x00, 0x28, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x1c, 0x00, 0x04, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00,
+  0x1d, 0x00, 0x03, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x33, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7f, 0x2b, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff,
+  0x32, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x34, 0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x44, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x34, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x44, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x4a, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x03, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x55, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x32, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0xed, 0x00, 0x07, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x56, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x4b, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x43, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0x62, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x64, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x67, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x62, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x6a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x07, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x63, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x61, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x62, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x79, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x11, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x7f, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x7b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x82, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x05, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x8a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x8e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00,
+  0x8e, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x07, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x91, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x8e, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x8a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x8a, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x04, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0xc4, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x03, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x98, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x12, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x32, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x9e, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xa2, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0xa3, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x07, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0xa4, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0xa7, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0xe6, 0x00, 0x09, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xa1, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0xad, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xab, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0xad, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xaf, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00
+};
+static const unsigned int shaders_glsl_opreduce_comp_spv_len = 4424;
+}
+}
+#endif // define SHADEROP_SHADEROPREDUCE_HPP
+
+/*
+    THIS FILE HAS BEEN AUTOMATICALLY GENERATED - DO NOT EDIT
+
+    ---
+
+    Copyright 2020 The Institute for Ethical AI & Machine Learning
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef SHADEROP_SHADEROPREDUCE_SUBGROUP_HPP
+#define SHADEROP_SHADEROPREDUCE_SUBGROUP_HPP
+
+namespace kp {
+namespace shader_data {
+static const unsigned char shaders_glsl_opreduce_subgroup_comp_spv[] = {
+  0x03, 0x02, 0x23, 0x07, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x02, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64,
+  0x2e, 0x34, 0x35, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0b, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xc2, 0x01, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x47, 0x4c, 0x5f, 0x4b,
+  0x48, 0x52, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x73, 0x75,
+  0x62, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x61, 0x72, 0x69, 0x74, 0x68,
+  0x6d, 0x65, 0x74, 0x69, 0x63, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0x00,
+  0x47, 0x4c, 0x5f, 0x4b, 0x48, 0x52, 0x5f, 0x73, 0x68, 0x61, 0x64, 0x65,
+  0x72, 0x5f, 0x73, 0x75, 0x62, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x62,
+  0x61, 0x73, 0x69, 0x63, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x4f, 0x50, 0x45, 0x52,
+  0x41, 0x54, 0x49, 0x4f, 0x4e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x50, 0x75, 0x73, 0x68, 0x43, 0x6f, 0x6e, 0x73,
+  0x74, 0x61, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x73, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x70, 0x63, 0x73, 0x00, 0x05, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x73, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x49, 0x6e,
+  0x70, 0x75, 0x74, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x49, 0x6e,
+  0x70, 0x75, 0x74, 0x00, 0x05, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x67, 0x6c, 0x5f, 0x4e, 0x75, 0x6d, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72,
+  0x6f, 0x75, 0x70, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x57, 0x6f, 0x72, 0x6b, 0x47,
+  0x72, 0x6f, 0x75, 0x70, 0x53, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x72, 0x65, 0x73, 0x75,
+  0x6c, 0x74, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76,
+  0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x00, 0x05, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x53,
+  0x75, 0x62, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x49, 0x44, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x53,
+  0x75, 0x62, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x49, 0x6e, 0x76, 0x6f, 0x63,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x00, 0x05, 0x00, 0x06, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x4e, 0x75, 0x6d, 0x53, 0x75,
+  0x62, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x00, 0x05, 0x00, 0x06, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x53, 0x75, 0x62, 0x67, 0x72,
+  0x6f, 0x75, 0x70, 0x53, 0x69, 0x7a, 0x65, 0x00, 0x05, 0x00, 0x05, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6c, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x74, 0x6f, 0x74, 0x61, 0x6c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6f, 0x75, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x4f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x03, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x03, 0x00, 0x19, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x32, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x33, 0x00, 0x06, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x08, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x34, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x7f, 0x2b, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x32, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x06, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x06, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x03, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x45, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x35, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x53, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x05, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0xed, 0x00, 0x07, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0xfd, 0x00, 0x01, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x10, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x11, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x64, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x07, 0x00, 0x20, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x66, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x66, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x65, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x5e, 0x01, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x63, 0x01, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x66, 0x01, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x4d, 0x01, 0x04, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x7e, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x30, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x7f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x04, 0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x8c, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x8a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x8b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x9a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x8a, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x5e, 0x01, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x9e, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x63, 0x01, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x9f, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x66, 0x01, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xa1, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xa2, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0xa1, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xa2, 0x00, 0x00, 0x00, 0x4d, 0x01, 0x04, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0xa3, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xa3, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x15, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xab, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xab, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0xac, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xad, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0xad, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x07, 0x00, 0x20, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00,
+  0xb1, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xb3, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x09, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xab, 0x00, 0x05, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xb8, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xa9, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00
+};
+static const unsigned int shaders_glsl_opreduce_subgroup_comp_spv_len = 4832;
+}
+}
+#endif // define SHADEROP_SHADEROPREDUCE_SUBGROUP_HPP
+
+/*
+    THIS FILE HAS BEEN AUTOMATICALLY GENERATED - DO NOT EDIT
+
+    ---
+
+    Copyright 2020 The Institute for Ethical AI & Machine Learning
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef SHADEROP_SHADEROPSCAN_HPP
+#define SHADEROP_SHADEROPSCAN_HPP
+
+namespace kp {
+namespace shader_data {
+static const unsigned char shaders_glsl_opscan_comp_spv[] = {
+  0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x33, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73,
+  0x6f, 0x72, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x50, 0x61, 0x72, 0x74, 0x69, 0x61,
+  0x6c, 0x73, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6c, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x46, 0x4c, 0x4f, 0x41, 0x54, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x49, 0x4e, 0x43, 0x4c, 0x55, 0x53, 0x49, 0x56,
+  0x45, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x50, 0x75, 0x73, 0x68, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74,
+  0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x73, 0x73, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x70, 0x63, 0x73, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x73, 0x75, 0x6d, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x67, 0x6c, 0x5f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f,
+  0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x57,
+  0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x49, 0x44, 0x00, 0x00,
+  0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x4e,
+  0x75, 0x6d, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x02, 0x00, 0x12, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x08, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x32, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x06, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x34, 0x00, 0x06, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x44, 0x00, 0x05, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x86, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x52, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x58, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x63, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x58, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0x73, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x75, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x75, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x78, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0xae, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x79, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x7f, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x7b, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x30, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x74, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x05, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x8a, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x73, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0xac, 0x00, 0x05, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x30, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x37, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x8e, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x8e, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00,
+  0x9f, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xa4, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00,
+  0xa4, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xab, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xad, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0xad, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x06, 0x00, 0x14, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xb5, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0xb5, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x06, 0x00, 0x14, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x38, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xbc, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0xbd, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xbe, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00,
+  0xc2, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xc3, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0xc9, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xcb, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xcb, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xcc, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xcd, 0x00, 0x00, 0x00,
+  0xce, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xce, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xcf, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00,
+  0xcf, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xd3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xd2, 0x00, 0x00, 0x00,
+  0xd4, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xd4, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xd5, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00,
+  0xd5, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00,
+  0xd7, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xdb, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00,
+  0xdb, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xdd, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00,
+  0xd8, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0xdd, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xd3, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xca, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xca, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xdf, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xc9, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xe1, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xe2, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xe2, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0xe3, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xe5, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00,
+  0xe6, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xe7, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0xae, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xea, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xec, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0xe9, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0xee, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00,
+  0xee, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0xef, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xeb, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xeb, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x30, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xf3, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00,
+  0xf1, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xf5, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00,
+  0xf5, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xe4, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x05, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xe2, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0xac, 0x00, 0x05, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xfd, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xfe, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x06, 0x01, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x09, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x08, 0x01, 0x00, 0x00,
+  0x0a, 0x01, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x0a, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x0b, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x09, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x09, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x07, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00,
+  0x0f, 0x01, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x11, 0x01, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00,
+  0x7c, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00,
+  0x10, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x13, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00,
+  0x13, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x17, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x17, 0x01, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0x18, 0x01, 0x00, 0x00, 0x19, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x1a, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x1a, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00,
+  0x1b, 0x01, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x1c, 0x01, 0x00, 0x00, 0x1d, 0x01, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x1d, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x20, 0x01, 0x00, 0x00, 0x1e, 0x01, 0x00, 0x00, 0x1f, 0x01, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0x21, 0x01, 0x00, 0x00,
+  0x20, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x21, 0x01, 0x00, 0x00, 0x23, 0x01, 0x00, 0x00, 0x22, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x23, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x27, 0x01, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00,
+  0x7c, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00,
+  0x26, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x29, 0x01, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x2a, 0x01, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00,
+  0x29, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x2b, 0x01, 0x00, 0x00, 0x2a, 0x01, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x2b, 0x01, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x2d, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x2e, 0x01, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x2c, 0x01, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x2d, 0x01, 0x00, 0x00, 0x2e, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x22, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x22, 0x01, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x19, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x19, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x2f, 0x01, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x2f, 0x01, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x30, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x17, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x18, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x31, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0x31, 0x01, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x32, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00,
+  0x38, 0x00, 0x01, 0x00
+};
+static const unsigned int shaders_glsl_opscan_comp_spv_len = 7204;
+}
+}
+#endif // define SHADEROP_SHADEROPSCAN_HPP
+
+/*
+    THIS FILE HAS BEEN AUTOMATICALLY GENERATED - DO NOT EDIT
+
+    ---
+
+    Copyright 2020 The Institute for Ethical AI & Machine Learning
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef SHADEROP_SHADEROPCOMPACT_HPP
+#define SHADEROP_SHADEROPCOMPACT_HPP
+
+namespace kp {
+namespace shader_data {
+static const unsigned char shaders_glsl_opcompact_comp_spv[] = {
+  0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x00, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73,
+  0x6f, 0x72, 0x46, 0x6c, 0x61, 0x67, 0x73, 0x00, 0x06, 0x00, 0x05, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6c, 0x61, 0x67,
+  0x73, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x4f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x43, 0x6f,
+  0x75, 0x6e, 0x74, 0x00, 0x06, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73,
+  0x6f, 0x72, 0x50, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6c, 0x73, 0x00, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x70, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6c, 0x73, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x75, 0x73, 0x68,
+  0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x70, 0x61, 0x73, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x64, 0x69,
+  0x72, 0x65, 0x63, 0x74, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x69, 0x7a,
+  0x65, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x70, 0x63, 0x73, 0x00, 0x05, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x73, 0x75, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x4c, 0x6f, 0x63, 0x61, 0x6c,
+  0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x67, 0x6c, 0x5f, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70,
+  0x49, 0x44, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x67, 0x6c, 0x5f, 0x4e, 0x75, 0x6d, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72,
+  0x6f, 0x75, 0x70, 0x73, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x02, 0x00, 0x14, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x25, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x7f, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x44, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x86, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x54, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x5a, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x66, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x66, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x34, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x36, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x6f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x74, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x75, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0xae, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x37, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x03, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x77, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x82, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x7f, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00,
+  0x7f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x36, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x6f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xac, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x03, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x85, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x82, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x8a, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x8e, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x91, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x94, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x9e, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x9f, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x99, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xa1, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x3e, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x8e, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xa2, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0xa2, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xa7, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x03, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0xab, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00,
+  0xab, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xad, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0x86, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00,
+  0xac, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xb0, 0x00, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0xb1, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xb1, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xb2, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0xb3, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xb3, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0xb5, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xb9, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xba, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00,
+  0xbb, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0xbd, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0xbf, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xc1, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xc2, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xc3, 0x00, 0x00, 0x00,
+  0xc4, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xc4, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xc9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0xca, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xca, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0xcb, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xcc, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 0xab, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xce, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xcf, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00,
+  0xce, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0xd0, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xc9, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xc9, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xd2, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x3e, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xbf, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xd3, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xd4, 0x00, 0x00, 0x00,
+  0xd3, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xd5, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xd5, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0xd6, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xd8, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00,
+  0xd9, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xda, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0xae, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xdd, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0xdc, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0xe1, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00,
+  0xe1, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0xe2, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xde, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xde, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x34, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xe6, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0xe3, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xd7, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0xc4, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00,
+  0xe7, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xd5, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xd6, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x34, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x38, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x39, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xac, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xeb, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xed, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0xef, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0xef, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xec, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xec, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xf2, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x03, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0xf2, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00,
+  0xf5, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xf4, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xf6, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x23, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xfb, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xf7, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xf7, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xf3, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xf5, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0xfd, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0xfe, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+  0xf1, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x03, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x05, 0x01, 0x00, 0x00,
+  0x06, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x06, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x0b, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x0a, 0x01, 0x00, 0x00,
+  0x0c, 0x01, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x0c, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x0d, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x09, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x0e, 0x01, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0xab, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x10, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x0f, 0x01, 0x00, 0x00,
+  0x11, 0x01, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x11, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x12, 0x01, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x15, 0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x13, 0x01, 0x00, 0x00, 0x15, 0x01, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00,
+  0x12, 0x01, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x10, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x10, 0x01, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x0b, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x0b, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x17, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x17, 0x01, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xf3, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x19, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x00, 0x00,
+  0x19, 0x01, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb5, 0x00, 0x00, 0x00,
+  0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00
+};
+static const unsigned int shaders_glsl_opcompact_comp_spv_len = 7064;
+}
+}
+#endif // define SHADEROP_SHADEROPCOMPACT_HPP
+
+/*
+    THIS FILE HAS BEEN AUTOMATICALLY GENERATED - DO NOT EDIT
+
+    ---
+
+    Copyright 2020 The Institute for Ethical AI & Machine Learning
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef SHADEROP_SHADEROPSORT_HPP
+#define SHADEROP_SHADEROPSORT_HPP
+
+namespace kp {
+namespace shader_data {
+static const unsigned char shaders_glsl_opsort_comp_spv[] = {
+  0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x4b, 0x65, 0x79, 0x73, 0x00, 0x00,
+  0x06, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6b, 0x65, 0x79, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x4b, 0x65,
+  0x79, 0x73, 0x53, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6b, 0x65, 0x79, 0x73, 0x53, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73,
+  0x6f, 0x72, 0x50, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x50, 0x61,
+  0x79, 0x6c, 0x6f, 0x61, 0x64, 0x53, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x53,
+  0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x48, 0x69,
+  0x73, 0x74, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x68, 0x69, 0x73, 0x74, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x73, 0x00, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4b, 0x45, 0x59, 0x5f,
+  0x54, 0x59, 0x50, 0x45, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x48, 0x41, 0x53, 0x5f, 0x50, 0x41, 0x59, 0x4c,
+  0x4f, 0x41, 0x44, 0x00, 0x05, 0x00, 0x06, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x50, 0x75, 0x73, 0x68, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74,
+  0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x73, 0x73, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x05, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x73, 0x68, 0x69, 0x66, 0x74, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x70, 0x63, 0x73, 0x00, 0x05, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x73, 0x75, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x73, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x67, 0x6c, 0x5f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f,
+  0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x57,
+  0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x49, 0x44, 0x00, 0x00,
+  0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x4e,
+  0x75, 0x6d, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x03, 0x00, 0x18, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x08, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x36, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x32, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x06, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x34, 0x00, 0x06, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x34, 0x00, 0x06, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2b, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x2b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x44, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x45, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x44, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x86, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x62, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0x63, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x65, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x66, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x68, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x49, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x6a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x6a, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x73, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x6a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x79, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x7c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x7e, 0x00, 0x00, 0x00,
+  0x7f, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x7f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x8a, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x86, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x86, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x86, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0xc6, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0xab, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x06, 0x00, 0x19, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0xc6, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x06, 0x00, 0x19, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x06, 0x00, 0x19, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x06, 0x00, 0x19, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0xc2, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x9a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x84, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x7b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x9f, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x48, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x79, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xa1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xa0, 0x00, 0x00, 0x00,
+  0xa2, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xa2, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0xa4, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xa7, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xa9, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xac, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x37, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xad, 0x00, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x4b, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xb1, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xb3, 0x00, 0x00, 0x00,
+  0xb5, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xb5, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xb6, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xb9, 0x00, 0x00, 0x00,
+  0xba, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xa1, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xa1, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x04, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0xbb, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x03, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0xbb, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00,
+  0xbc, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xbd, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x48, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xbe, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0xbf, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xc1, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0xc3, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0xc3, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00,
+  0xbf, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xc4, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xc6, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00,
+  0xc6, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x03, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00,
+  0xc9, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xca, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x03, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
+  0xcd, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xcc, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00,
+  0xce, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0xcf, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xcb, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xcb, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xcb, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xd2, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xd4, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0xab, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x00, 0x00,
+  0xd4, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00,
+  0xd6, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xd8, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0xd3, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0xd8, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0xda, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xdd, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00,
+  0xdd, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00,
+  0xde, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00,
+  0xdd, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0xe5, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00,
+  0xe5, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xe7, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00,
+  0xe2, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0xab, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0xea, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x06, 0x00, 0x19, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00,
+  0xea, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0xc6, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00,
+  0xdb, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xee, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00,
+  0xdb, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xef, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00,
+  0xee, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00,
+  0xdb, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xf1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0xf2, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xf2, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xf4, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0xf5, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xf1, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xf3, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xf7, 0x00, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xf1, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xf1, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xf9, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xfb, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x03, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x02, 0x01, 0x00, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xf8, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xc9, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xc9, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xbe, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xbf, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xbc, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x64, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x62, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00
+};
+static const unsigned int shaders_glsl_opsort_comp_spv_len = 6488;
+}
+}
+#endif // define SHADEROP_SHADEROPSORT_HPP
+
 // SPDX-License-Identifier: Apache-2.0
 
 #if VK_USE_PLATFORM_ANDROID_KHR
@@ -601,6 +3770,16 @@ static const char* KOMPUTE_LOG_TAG = "KomputeLog";
 
 #include <vulkan/vulkan.hpp>
 
+// Android hardware buffers can be imported from API level 26, where the NDK
+// functions describing them were introduced
+#ifndef KOMPUTE_HARDWARE_BUFFER_IMPORT
+#if defined(VK_USE_PLATFORM_ANDROID_KHR) && __ANDROID_API__ >= 26
+#define KOMPUTE_HARDWARE_BUFFER_IMPORT 1
+#else
+#define KOMPUTE_HARDWARE_BUFFER_IMPORT 0
+#endif
+#endif
+
 // Typedefs to simplify interaction with core types
 namespace kp {
 typedef std::array<uint32_t, 3> Workgroup;
@@ -620,6 +3799,17 @@ typedef std::vector<float> Constants;
       KOMPUTE_VK_API_MAJOR_VERSION, KOMPUTE_VK_API_MINOR_VERSION, 0)
 #endif // KOMPUTE_VK_API_VERSION
 
+// Values of the spdlog levels, also used when spdlog is not enabled
+#ifndef SPDLOG_LEVEL_TRACE
+#define SPDLOG_LEVEL_TRACE 0
+#define SPDLOG_LEVEL_DEBUG 1
+#define SPDLOG_LEVEL_INFO 2
+#define SPDLOG_LEVEL_WARN 3
+#define SPDLOG_LEVEL_ERROR 4
+#define SPDLOG_LEVEL_CRITICAL 5
+#define SPDLOG_LEVEL_OFF 6
+#endif
+
 // SPDLOG_ACTIVE_LEVEL must be defined before spdlog.h import
 #ifndef SPDLOG_ACTIVE_LEVEL
 #if DEBUG
@@ -629,6 +3819,23 @@ typedef std::vector<float> Constants;
 #endif
 #endif
 
+// Messages of the paths run for every operation recorded, dispatched or
+// submitted, by subsystem. They are logged at the debug level when the
+// subsystem is enabled, and compiled out otherwise, which is the default in
+// release builds.
+#ifndef KOMPUTE_LOG_SEQUENCE
+#define KOMPUTE_LOG_SEQUENCE DEBUG
+#endif
+#ifndef KOMPUTE_LOG_ALGORITHM
+#define KOMPUTE_LOG_ALGORITHM DEBUG
+#endif
+#ifndef KOMPUTE_LOG_TENSOR
+#define KOMPUTE_LOG_TENSOR DEBUG
+#endif
+#ifndef KOMPUTE_LOG_OPERATION
+#define KOMPUTE_LOG_OPERATION DEBUG
+#endif
+
 #if defined(KOMPUTE_BUILD_PYTHON)
 #include <pybind11/pybind11.h>
 namespace py = pybind11;
@@ -644,1694 +3851,10654 @@ extern py::object kp_debug, kp_info, kp_warning, kp_error;
 #define KP_LOG_WARN(...) SPDLOG_WARN(__VA_ARGS__)
 #define KP_LOG_ERROR(...) SPDLOG_ERROR(__VA_ARGS__)
 #else
+#include <atomic>
 #include <iostream>
-#if SPDLOG_ACTIVE_LEVEL > 1
-#define KP_LOG_DEBUG(...)
-#else
-#if defined(VK_USE_PLATFORM_ANDROID_KHR)
-#define KP_LOG_DEBUG(...)                                                      \
-    ((void)__android_log_write(                                                \
-      ANDROID_LOG_DEBUG, KOMPUTE_LOG_TAG, fmt::format(__VA_ARGS__).c_str()))
-#elif defined(KOMPUTE_BUILD_PYTHON)
-#define KP_LOG_DEBUG(...) kp_debug(fmt::format(__VA_ARGS__))
-#else
-#define KP_LOG_DEBUG(...)                                                      \
-    fmt::print("[{} {}] [debug] [{}:{}] {}\n",                                 \
-               __DATE__,                                                       \
-               __TIME__,                                                       \
-               __FILE__,                                                       \
-               __LINE__,                                                       \
-               fmt::format(__VA_ARGS__))
-#endif // VK_USE_PLATFORM_ANDROID_KHR
-#endif // SPDLOG_ACTIVE_LEVEL > 1
 
-#if SPDLOG_ACTIVE_LEVEL > 2
-#define KP_LOG_INFO(...)
-#else
-#if defined(VK_USE_PLATFORM_ANDROID_KHR)
-#define KP_LOG_INFO(...)                                                       \
-    ((void)__android_log_write(                                                \
-      ANDROID_LOG_INFO, KOMPUTE_LOG_TAG, fmt::format(__VA_ARGS__).c_str()))
-#elif defined(KOMPUTE_BUILD_PYTHON)
-#define KP_LOG_INFO(...) kp_info(fmt::format(__VA_ARGS__))
-#else
-#define KP_LOG_INFO(...)                                                       \
-    fmt::print("[{} {}] [debug] [{}:{}] {}\n",                                 \
-               __DATE__,                                                       \
-               __TIME__,                                                       \
-               __FILE__,                                                       \
-               __LINE__,                                                       \
-               fmt::format(__VA_ARGS__))
-#endif // VK_USE_PLATFORM_ANDROID_KHR
-#endif // SPDLOG_ACTIVE_LEVEL > 2
+namespace kp {
 
-#if SPDLOG_ACTIVE_LEVEL > 3
-#define KP_LOG_WARN(...)
-#else
-#if defined(VK_USE_PLATFORM_ANDROID_KHR)
-#define KP_LOG_WARN(...)                                                       \
-    ((void)__android_log_write(                                                \
-      ANDROID_LOG_WARN, KOMPUTE_LOG_TAG, fmt::format(__VA_ARGS__).c_str()))
-#elif defined(KOMPUTE_BUILD_PYTHON)
-#define KP_LOG_WARN(...) kp_warning(fmt::format(__VA_ARGS__))
-#else
-#define KP_LOG_WARN(...)                                                       \
-    fmt::print("[{} {}] [debug] [{}:{}] {}\n",                                 \
-               __DATE__,                                                       \
-               __TIME__,                                                       \
-               __FILE__,                                                       \
-               __LINE__,                                                       \
-               fmt::format(__VA_ARGS__))
-#endif // VK_USE_PLATFORM_ANDROID_KHR
-#endif // SPDLOG_ACTIVE_LEVEL > 3
+/**
+ * Runtime level of the messages logged without spdlog, which are neither
+ * formatted nor passed to the sink below it. It is a spdlog level, and
+ * defaults to SPDLOG_ACTIVE_LEVEL.
+ *
+ * @return The level, shared by all the translation units
+ */
+inline std::atomic<int>&
+logLevel()
+{
+    static std::atomic<int> level{ SPDLOG_ACTIVE_LEVEL };
+    return level;
+}
+
+/**
+ * Sets the runtime level of the messages logged without spdlog, the
+ * equivalent of spdlog::set_level. Levels below SPDLOG_ACTIVE_LEVEL are
+ * compiled out regardless.
+ *
+ * @param level A spdlog level, such as SPDLOG_LEVEL_WARN
+ */
+inline void
+setLogLevel(int level)
+{
+    logLevel().store(level, std::memory_order_relaxed);
+}
+
+} // End namespace kp
+
+// Only formats the message and calls the sink when the level is enabled
+#define KP_LOG_AT(level, ...)                                                  \
+    do {                                                                       \
+        if ((level) >= kp::logLevel().load(std::memory_order_relaxed)) {       \
+            __VA_ARGS__;                                                       \
+        }                                                                      \
+    } while (0)
 
-#if SPDLOG_ACTIVE_LEVEL > 4
-#define KP_LOG_ERROR(...)
-#else
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
-#define KP_LOG_ERROR(...)                                                      \
-    ((void)__android_log_write(                                                \
-      ANDROID_LOG_ERROR, KOMPUTE_LOG_TAG, fmt::format(__VA_ARGS__).c_str()))
+#define KP_LOG_SINK(level, androidPriority, pythonSink, tag, ...)              \
+    KP_LOG_AT(level,                                                           \
+              __android_log_write(androidPriority,                             \
+                                  KOMPUTE_LOG_TAG,                             \
+                                  fmt::format(__VA_ARGS__).c_str()))
 #elif defined(KOMPUTE_BUILD_PYTHON)
-#define KP_LOG_ERROR(...) kp_error(fmt::format(__VA_ARGS__))
+namespace kp {
+
+/**
+ * Passes a message to a Python logger, taking the GIL as messages are logged
+ * from the threads of Kompute and from bindings that release the GIL.
+ *
+ * @param sink The function of the Python logger of the level
+ * @param message The formatted message
+ */
+inline void
+logPython(const py::object& sink, const std::string& message)
+{
+    py::gil_scoped_acquire gil;
+    sink(message);
+}
+
+} // End namespace kp
+
+#define KP_LOG_SINK(level, androidPriority, pythonSink, tag, ...)              \
+    KP_LOG_AT(level, kp::logPython(pythonSink, fmt::format(__VA_ARGS__)))
 #else
-#define KP_LOG_ERROR(...)                                                      \
-    fmt::print("[{} {}] [debug] [{}:{}] {}\n",                                 \
-               __DATE__,                                                       \
-               __TIME__,                                                       \
-               __FILE__,                                                       \
-               __LINE__,                                                       \
-               fmt::format(__VA_ARGS__))
+#define KP_LOG_SINK(level, androidPriority, pythonSink, tag, ...)              \
+    KP_LOG_AT(level,                                                           \
+              fmt::print("[{} {}] [{}] [{}:{}] {}\n",                          \
+                         __DATE__,                                             \
+                         __TIME__,                                             \
+                         tag,                                                  \
+                         __FILE__,                                             \
+                         __LINE__,                                             \
+                         fmt::format(__VA_ARGS__)))
 #endif // VK_USE_PLATFORM_ANDROID_KHR
-#endif // SPDLOG_ACTIVE_LEVEL > 4
+
+#if SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_DEBUG
+#define KP_LOG_DEBUG(...)
+#else
+#define KP_LOG_DEBUG(...)                                                      \
+    KP_LOG_SINK(SPDLOG_LEVEL_DEBUG,                                            \
+                ANDROID_LOG_DEBUG,                                             \
+                kp_debug,                                                      \
+                "debug",                                                       \
+                __VA_ARGS__)
+#endif // SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_DEBUG
+
+#if SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_INFO
+#define KP_LOG_INFO(...)
+#else
+#define KP_LOG_INFO(...)                                                       \
+    KP_LOG_SINK(SPDLOG_LEVEL_INFO,                                             \
+                ANDROID_LOG_INFO,                                              \
+                kp_info,                                                       \
+                "info",                                                        \
+                __VA_ARGS__)
+#endif // SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_INFO
+
+#if SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_WARN
+#define KP_LOG_WARN(...)
+#else
+#define KP_LOG_WARN(...)                                                       \
+    KP_LOG_SINK(SPDLOG_LEVEL_WARN,                                             \
+                ANDROID_LOG_WARN,                                              \
+                kp_warning,                                                    \
+                "warning",                                                     \
+                __VA_ARGS__)
+#endif // SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_WARN
+
+#if SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_ERROR
+#define KP_LOG_ERROR(...)
+#else
+#define KP_LOG_ERROR(...)                                                      \
+    KP_LOG_SINK(SPDLOG_LEVEL_ERROR,                                            \
+                ANDROID_LOG_ERROR,                                             \
+                kp_error,                                                      \
+                "error",                                                       \
+                __VA_ARGS__)
+#endif // SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_ERROR
 #endif // KOMPUTE_SPDLOG_ENABLED
 #endif // KOMPUTE_LOG_OVERRIDE
 
+#if KOMPUTE_LOG_SEQUENCE
+#define KP_LOG_SEQUENCE(...) KP_LOG_DEBUG(__VA_ARGS__)
+#else
+#define KP_LOG_SEQUENCE(...)
+#endif
+#if KOMPUTE_LOG_ALGORITHM
+#define KP_LOG_ALGORITHM(...) KP_LOG_DEBUG(__VA_ARGS__)
+#else
+#define KP_LOG_ALGORITHM(...)
+#endif
+#if KOMPUTE_LOG_TENSOR
+#define KP_LOG_TENSOR(...) KP_LOG_DEBUG(__VA_ARGS__)
+#else
+#define KP_LOG_TENSOR(...)
+#endif
+#if KOMPUTE_LOG_OPERATION
+#define KP_LOG_OPERATION(...) KP_LOG_DEBUG(__VA_ARGS__)
+#else
+#define KP_LOG_OPERATION(...)
+#endif
+
 // SPDX-License-Identifier: Apache-2.0
 
+#include <atomic>
+#include <cstdint>
+#include <string>
+
 namespace kp {
 
 /**
- * Structured data used in GPU operations.
+ * Process wide tracer recording the CPU spans of the record, submission and
+ * rebuild functions of Kompute, together with the GPU spans of the operations
+ * of the sequences with timestamps, on one timeline written as a Chrome trace
+ * that can be opened in Perfetto or chrome://tracing.
  *
- * Tensors are the base building block in Kompute to perform operations across
- * GPUs. Each tensor would have a respective Vulkan memory and buffer, which
- * would be used to store their respective data. The tensors can be used for GPU
- * data storage or transfer.
+ * The tracer is disabled by default, in which case a span costs a relaxed
+ * atomic load. The GPU spans are recorded when a sequence created with
+ * timestamps is awaited through evalAwait. Their timestamps are converted to
+ * the host clock with VK_EXT_calibrated_timestamps when the extension is
+ * enabled on the device and it calibrates against CLOCK_MONOTONIC, and
+ * otherwise by aligning the end of the last
+ * operation with the time its fence was seen signaled, which is the upper
+ * bound of its completion.
  */
-class Tensor
+class Tracer
 {
   public:
     /**
-     * Type for tensors created: Device allows memory to be transferred from
-     * staging buffers. Staging are host memory visible. Storage are device
-     * visible but are not set up to transfer or receive data (only for shader
-     * storage).
+     * Guard recording a CPU span from its construction to its destruction
+     * on the current thread, when the tracer is enabled at construction.
      */
-    enum class TensorTypes
-    {
-        eDevice = 0,  ///< Type is device memory, source and destination
-        eHost = 1,    ///< Type is host memory, source and destination
-        eStorage = 2, ///< Type is Device memory (only)
-    };
-    enum class TensorDataTypes
+    class Span
     {
-        eBool = 0,
-        eInt = 1,
-        eUnsignedInt = 2,
-        eFloat = 3,
-        eDouble = 4,
+      public:
+        /**
+         * Starts the span.
+         *
+         * @param name Name of the span, which must outlive the tracer events
+         * such as a string literal
+         */
+        Span(const char* name);
+
+        /**
+         * Ends the span and records it.
+         */
+        ~Span();
+
+      private:
+        const char* mName;
+        int64_t mStartNs;
     };
 
     /**
-     *  Constructor with data provided which would be used to create the
-     * respective vulkan buffer and memory.
-     *
-     *  @param physicalDevice The physical device to use to fetch properties
-     *  @param device The device to use to create the buffer and memory from
-     *  @param data Non-zero-sized vector of data that will be used by the
-     * tensor
-     *  @param tensorTypes Type for the tensor which is of type TensorTypes
+     * Clears the events recorded and starts recording.
      */
-    Tensor(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
-           std::shared_ptr<vk::Device> device,
-           void* data,
-           uint32_t elementTotalCount,
-           uint32_t elementMemorySize,
-           const TensorDataTypes& dataType,
-           const TensorTypes& tensorType = TensorTypes::eDevice);
+    static void start();
 
     /**
-     * Destructor which is in charge of freeing vulkan resources unless they
-     * have been provided externally.
+     * Stops recording, keeping the events recorded until the next start.
      */
-    virtual ~Tensor();
+    static void stop();
 
     /**
-     * Function to trigger reinitialisation of the tensor buffer and memory with
-     * new data as well as new potential device type.
+     * Checks whether the tracer is recording.
      *
-     * @param data Vector of data to use to initialise vector from
-     * @param tensorType The type to use for the tensor
-     */
-    void rebuild(void* data,
-                 uint32_t elementTotalCount,
-                 uint32_t elementMemorySize);
-
-    /**
-     * Destroys and frees the GPU resources which include the buffer and memory.
+     * @return Boolean stating whether the tracer is enabled
      */
-    void destroy();
+    static bool isEnabled()
+    {
+        return sEnabled.load(std::memory_order_relaxed);
+    }
 
     /**
-     * Check whether tensor is initialized based on the created gpu resources.
+     * Current time of the clock of the spans, which is the steady clock of
+     * the host.
      *
-     * @returns Boolean stating whether tensor is initialized
+     * @return Nanoseconds since the epoch of the steady clock
      */
-    bool isInit();
+    static int64_t now();
 
     /**
-     * Retrieve the tensor type of the Tensor
+     * Records a span of the current thread.
      *
-     * @return Tensor type of tensor
+     * @param name Name of the span, which must outlive the tracer events
+     * @param startNs Start of the span, from now
+     * @param endNs End of the span, from now
      */
-    TensorTypes tensorType();
+    static void recordCpuSpan(const char* name, int64_t startNs, int64_t endNs);
 
     /**
-     * Records a copy from the memory of the tensor provided to the current
-     * thensor. This is intended to pass memory into a processing, to perform
-     * a staging buffer transfer, or to gather output (between others).
+     * Records a span of work of a queue of the device.
      *
-     * @param commandBuffer Vulkan Command Buffer to record the commands into
-     * @param copyFromTensor Tensor to copy the data from
+     * @param name Name of the span
+     * @param queueFamilyIndex The queue family the work ran on, which is the
+     * track of the span
+     * @param startNs Start of the span on the host clock, from now
+     * @param endNs End of the span on the host clock, from now
      */
-    void recordCopyFrom(const vk::CommandBuffer& commandBuffer,
-                        std::shared_ptr<Tensor> copyFromTensor);
+    static void recordGpuSpan(const std::string& name,
+                              uint32_t queueFamilyIndex,
+                              int64_t startNs,
+                              int64_t endNs);
 
     /**
-     * Records a copy from the internal staging memory to the device memory
-     * using an optional barrier to wait for the operation. This function would
-     * only be relevant for kp::Tensors of type eDevice.
+     * Returns the number of spans recorded since the last start.
      *
-     * @param commandBuffer Vulkan Command Buffer to record the commands into
+     * @return Number of spans
      */
-    void recordCopyFromStagingToDevice(const vk::CommandBuffer& commandBuffer);
+    static uint64_t eventCount();
 
     /**
-     * Records a copy from the internal device memory to the staging memory
-     * using an optional barrier to wait for the operation. This function would
-     * only be relevant for kp::Tensors of type eDevice.
+     * Returns the spans recorded as a Chrome trace, in the JSON object format
+     * of the Trace Event Format, with the CPU spans grouped by thread and the
+     * GPU spans grouped by queue family.
      *
-     * @param commandBuffer Vulkan Command Buffer to record the commands into
+     * @return JSON of the trace
      */
-    void recordCopyFromDeviceToStaging(const vk::CommandBuffer& commandBuffer);
+    static std::string chromeTrace();
 
     /**
-     * Records the buffer memory barrier into the primary buffer and command
-     * buffer which ensures that relevant data transfers are carried out
-     * correctly.
-     *
-     * @param commandBuffer Vulkan Command Buffer to record the commands into
-     * @param srcAccessMask Access flags for source access mask
-     * @param dstAccessMask Access flags for destination access mask
-     * @param scrStageMask Pipeline stage flags for source stage mask
-     * @param dstStageMask Pipeline stage flags for destination stage mask
-     */
-    void recordPrimaryBufferMemoryBarrier(
-      const vk::CommandBuffer& commandBuffer,
-      vk::AccessFlagBits srcAccessMask,
-      vk::AccessFlagBits dstAccessMask,
-      vk::PipelineStageFlagBits srcStageMask,
-      vk::PipelineStageFlagBits dstStageMask);
-    /**
-     * Records the buffer memory barrier into the staging buffer and command
-     * buffer which ensures that relevant data transfers are carried out
-     * correctly.
+     * Writes the spans recorded as a Chrome trace, see chromeTrace.
      *
-     * @param commandBuffer Vulkan Command Buffer to record the commands into
-     * @param srcAccessMask Access flags for source access mask
-     * @param dstAccessMask Access flags for destination access mask
-     * @param scrStageMask Pipeline stage flags for source stage mask
-     * @param dstStageMask Pipeline stage flags for destination stage mask
+     * @param path The file to write the trace to
      */
-    void recordStagingBufferMemoryBarrier(
-      const vk::CommandBuffer& commandBuffer,
-      vk::AccessFlagBits srcAccessMask,
-      vk::AccessFlagBits dstAccessMask,
-      vk::PipelineStageFlagBits srcStageMask,
-      vk::PipelineStageFlagBits dstStageMask);
+    static void writeChromeTrace(const std::string& path);
+
+  private:
+    static std::atomic<bool> sEnabled;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <string>
 
+namespace kp {
+
+/**
+ * Functions of VK_EXT_debug_utils used to name the Vulkan objects of the
+ * tensors, algorithms and sequences, and to label the commands of each
+ * operation, so captures of tools such as RenderDoc and Nsight show the names
+ * given by the user instead of raw handles.
+ *
+ * The manager creates it when it enables the extension on the instance it
+ * creates, and shares it with the components it creates. Without the
+ * extension the components keep their names but skip the Vulkan calls.
+ */
+class DebugUtils
+{
+  public:
     /**
-     * Constructs a vulkan descriptor buffer info which can be used to specify
-     * and reference the underlying buffer component of the tensor without
-     * exposing it.
+     * Resolves the functions of the extension from an instance created with
+     * VK_EXT_debug_utils enabled.
      *
-     * @return Descriptor buffer info with own buffer
+     * @param instance The instance the extension is enabled on
      */
-    vk::DescriptorBufferInfo constructDescriptorBufferInfo();
+    DebugUtils(const vk::Instance& instance);
 
     /**
-     * Returns the size/magnitude of the Tensor, which will be the total number
-     * of elements across all dimensions
+     * Checks whether the functions of the extension were resolved.
      *
-     * @return Unsigned integer representing the total number of elements
+     * @return Boolean stating whether objects can be named and labelled
      */
-    uint32_t size();
+    bool isValid() const;
 
     /**
-     * Returns the total size of a single element of the respective data type
-     * that this tensor holds.
+     * Names a Vulkan object, which is ignored for an empty name or a null
+     * handle.
      *
-     * @return Unsigned integer representing the memory of a single element of
-     * the respective data type.
+     * @param device The device owning the object
+     * @param objectType The type of the object
+     * @param objectHandle The handle of the object cast to an integer
+     * @param name The name to give the object
      */
-    uint32_t dataTypeMemorySize();
+    void setObjectName(const vk::Device& device,
+                       vk::ObjectType objectType,
+                       uint64_t objectHandle,
+                       const std::string& name) const;
 
     /**
-     * Returns the total memory size of the data contained by the Tensor object
-     * which would equate to (this->size() * this->dataTypeMemorySize())
+     * Opens a labelled region of a command buffer, which must be closed with
+     * endLabel in the same command buffer.
      *
-     * @return Unsigned integer representing the memory of a single element of
-     * the respective data type.
+     * @param commandBuffer The command buffer being recorded
+     * @param label The label of the region
      */
-    uint32_t memorySize();
+    void beginLabel(const vk::CommandBuffer& commandBuffer,
+                    const std::string& label) const;
 
     /**
-     * Retrieve the data type of the tensor (host, device, storage)
+     * Closes the last region opened by beginLabel.
      *
-     * @return Data type of tensor of type kp::Tensor::TensorDataTypes
+     * @param commandBuffer The command buffer being recorded
      */
-    TensorDataTypes dataType();
+    void endLabel(const vk::CommandBuffer& commandBuffer) const;
+
+  private:
+    PFN_vkSetDebugUtilsObjectNameEXT mSetObjectName = nullptr;
+    PFN_vkCmdBeginDebugUtilsLabelEXT mCmdBeginLabel = nullptr;
+    PFN_vkCmdEndDebugUtilsLabelEXT mCmdEndLabel = nullptr;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
 
+namespace kp {
+
+/**
+ * Always-on counters of the work done by the components created by a
+ * manager, which they update with relaxed atomic additions so the counters
+ * can be read at any time from any thread, for example to export them to a
+ * monitoring system and catch regressions such as algorithms rebuilt for
+ * every request.
+ *
+ * The counters only grow, so rates are derived by the reader from two
+ * snapshots, and are shared by every thread using the components.
+ */
+class Metrics
+{
+  public:
     /**
-     * Retrieve the raw data via the pointer to the memory that contains the raw
-     * memory of this current tensor. This tensor gets changed to a nullptr when
-     * the Tensor is removed.
-     *
-     * @return Pointer to raw memory containing raw bytes data of Tensor.
+     * Counters updated by the components of the manager.
      */
-    void* rawData();
+    enum class Counter
+    {
+        eSubmissions = 0,             ///< Sequences submitted to a queue
+        eCommandBuffersRecorded = 1,  ///< Command buffers recorded
+        eBarriers = 2,                ///< Pipeline barriers recorded
+        eBytesUploaded = 3,           ///< Bytes copied to device tensors
+        eBytesDownloaded = 4,         ///< Bytes copied from device tensors
+        ePipelinesCreated = 5,        ///< Pipelines compiled, cache misses
+        ePipelineCacheHits = 6,       ///< Pipelines reused from the cache
+        eDescriptorSetsAllocated = 7, ///< Descriptor sets of algorithms
+        eFenceWaits = 8,              ///< Waits for a submission to complete
+        eFenceWaitNs = 9,             ///< Time spent in those waits
+        eCount = 10,
+    };
 
     /**
-     * Sets / resets the data of the tensor which is directly done on the GPU
-     * host visible memory available by the tensor.
+     * Values of the counters at a point in time, along with the resources
+     * alive at that time, which the manager fills in.
      */
-    void setRawData(const void* data);
+    struct Snapshot
+    {
+        uint64_t submissions = 0;
+        uint64_t commandBuffersRecorded = 0;
+        uint64_t barriers = 0;
+        uint64_t bytesUploaded = 0;
+        uint64_t bytesDownloaded = 0;
+        uint64_t pipelinesCreated = 0;
+        uint64_t pipelineCacheHits = 0;
+        uint64_t descriptorSetsAllocated = 0;
+        uint64_t fenceWaits = 0;
+        uint64_t fenceWaitNs = 0;
+        uint32_t tensorCount = 0;    ///< Live tensors, including views
+        uint32_t algorithmCount = 0; ///< Live algorithms
+        uint32_t sequenceCount = 0;  ///< Live sequences
+    };
 
     /**
-     * Template to return the pointer data converted by specific type, which
-     * would be any of the supported types including float, double, int32,
-     * uint32 and bool.
+     * Adds a value to a counter.
      *
-     * @return Pointer to raw memory containing raw bytes data of Tensor.
+     * @param counter The counter to update
+     * @param value The value to add, 1 by default
      */
-    template<typename T>
-    T* data()
+    void add(Counter counter, uint64_t value = 1)
     {
-        return (T*)this->mRawData;
+        this->mCounters[(size_t)counter].fetch_add(value,
+                                                   std::memory_order_relaxed);
     }
 
     /**
-     * Template to get the data of the current tensor as a vector of specific
-     * type, which would be any of the supported types including float, double,
-     * int32, uint32 and bool.
+     * Reads a counter.
      *
-     * @return Vector of type provided by template.
+     * @param counter The counter to read
+     * @return The value of the counter
      */
-    template<typename T>
-    std::vector<T> vector()
+    uint64_t get(Counter counter) const
     {
-        return { (T*)this->mRawData, ((T*)this->mRawData) + this->size() };
+        return this->mCounters[(size_t)counter].load(std::memory_order_relaxed);
     }
 
-  protected:
-    // -------------- ALWAYS OWNED RESOURCES
-    TensorTypes mTensorType;
-    TensorDataTypes mDataType;
-    uint32_t mSize;
-    uint32_t mDataTypeMemorySize;
-    void* mRawData;
+    /**
+     * Reads all the counters. They are read one after the other, so the
+     * snapshot may miss the updates made while it is taken.
+     *
+     * @return The values of the counters, without the resource counts
+     */
+    Snapshot snapshot() const;
 
-  private:
-    // -------------- NEVER OWNED RESOURCES
-    std::shared_ptr<vk::PhysicalDevice> mPhysicalDevice;
-    std::shared_ptr<vk::Device> mDevice;
+    /**
+     * Sets all the counters back to zero.
+     */
+    void reset();
 
-    // -------------- OPTIONALLY OWNED RESOURCES
-    std::shared_ptr<vk::Buffer> mPrimaryBuffer;
-    bool mFreePrimaryBuffer = false;
-    std::shared_ptr<vk::Buffer> mStagingBuffer;
-    bool mFreeStagingBuffer = false;
-    std::shared_ptr<vk::DeviceMemory> mPrimaryMemory;
-    bool mFreePrimaryMemory = false;
-    std::shared_ptr<vk::DeviceMemory> mStagingMemory;
-    bool mFreeStagingMemory = false;
+  private:
+    std::array<std::atomic<uint64_t>, (size_t)Counter::eCount> mCounters{};
+};
 
-    void allocateMemoryCreateGPUResources(); // Creates the vulkan buffer
-    void createBuffer(std::shared_ptr<vk::Buffer> buffer,
-                      vk::BufferUsageFlags bufferUsageFlags);
-    void allocateBindMemory(std::shared_ptr<vk::Buffer> buffer,
-                            std::shared_ptr<vk::DeviceMemory> memory,
-                            vk::MemoryPropertyFlags memoryPropertyFlags);
-    void recordCopyBuffer(const vk::CommandBuffer& commandBuffer,
-                          std::shared_ptr<vk::Buffer> bufferFrom,
-                          std::shared_ptr<vk::Buffer> bufferTo,
-                          vk::DeviceSize bufferSize,
-                          vk::BufferCopy copyRegion);
-    void recordBufferMemoryBarrier(const vk::CommandBuffer& commandBuffer,
-                                   const vk::Buffer& buffer,
-                                   vk::AccessFlagBits srcAccessMask,
-                                   vk::AccessFlagBits dstAccessMask,
-                                   vk::PipelineStageFlagBits srcStageMask,
-                                   vk::PipelineStageFlagBits dstStageMask);
+} // End namespace kp
 
-    // Private util functions
-    vk::BufferUsageFlags getPrimaryBufferUsageFlags();
-    vk::MemoryPropertyFlags getPrimaryMemoryPropertyFlags();
-    vk::BufferUsageFlags getStagingBufferUsageFlags();
-    vk::MemoryPropertyFlags getStagingMemoryPropertyFlags();
+// SPDX-License-Identifier: Apache-2.0
 
-    void mapRawData();
-    void unmapRawData();
-};
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
 
-template<typename T>
-class TensorT : public Tensor
-{
+namespace kp {
 
+/**
+ * Host allocation callbacks passed to every Vulkan create and destroy call
+ * of the components created by a manager, which track the memory the driver
+ * allocates on the host so it can be measured around any operation.
+ *
+ * The allocations are served by the heap, or by the callbacks provided by
+ * the user, such as those of an engine's own allocator. Allocations with the
+ * command scope, which only live during a single Vulkan command such as a
+ * pipeline creation or a submission, can be served by a bump arena instead,
+ * whose offset is rewound once all of them are freed.
+ */
+class HostAllocator
+{
   public:
-    TensorT(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
-            std::shared_ptr<vk::Device> device,
-            const std::vector<T>& data,
-            const TensorTypes& tensorType = TensorTypes::eDevice)
-      : Tensor(physicalDevice,
-               device,
-               (void*)data.data(),
-               data.size(),
-               sizeof(T),
-               this->dataType(),
-               tensorType)
+    /**
+     * Values of the counters of the allocator at a point in time.
+     */
+    struct Stats
     {
-        KP_LOG_DEBUG("Kompute TensorT constructor with data size {}",
-                     data.size());
-    }
+        uint64_t allocations = 0;         ///< Including reallocations
+        uint64_t frees = 0;               ///< Including reallocations
+        uint64_t arenaAllocations = 0;    ///< Served by the arena
+        uint64_t liveBytes = 0;           ///< Allocated and not yet freed
+        uint64_t peakBytes = 0;           ///< Highest liveBytes
+        uint64_t totalBytes = 0;          ///< Allocated since the reset
+        uint64_t internalAllocations = 0; ///< Notified by the driver
+        uint64_t internalBytes = 0;       ///< Live internal allocations
+    };
 
-    ~TensorT() { KP_LOG_DEBUG("Kompute TensorT destructor"); }
+    /**
+     * Constructor for an allocator over the heap.
+     *
+     * @param arenaSize Size of the arena of the command scope allocations, or
+     * 0 to serve them from the heap
+     */
+    HostAllocator(size_t arenaSize = 0);
 
-    T* data() { return (T*)this->mRawData; }
+    /**
+     * Constructor for an allocator forwarding to callbacks provided by the
+     * user, which are tracked the same way. The internal allocation
+     * notifications are forwarded as well.
+     *
+     * @param callbacks The callbacks the allocations are forwarded to, which
+     * must outlive the allocator
+     * @param arenaSize Size of the arena of the command scope allocations, or
+     * 0 to forward them too
+     */
+    HostAllocator(const vk::AllocationCallbacks& callbacks,
+                  size_t arenaSize = 0);
 
-    std::vector<T> vector()
-    {
-        return { (T*)this->mRawData, ((T*)this->mRawData) + this->size() };
-    }
+    /**
+     * Destructor which frees the arena. The objects created with the
+     * allocator must have been destroyed.
+     */
+    ~HostAllocator();
 
-    T& operator[](int index) { return *(((T*)this->mRawData) + index); }
+    HostAllocator(const HostAllocator&) = delete;
+    HostAllocator& operator=(const HostAllocator&) = delete;
 
-    void setData(const std::vector<T>& data)
-    {
+    /**
+     * The callbacks passed to Vulkan, pointing to this allocator.
+     *
+     * @return Reference to the callbacks of the allocator
+     */
+    const vk::AllocationCallbacks& allocationCallbacks() const;
 
-        KP_LOG_DEBUG("Kompute TensorT setting data with data size {}",
-                     data.size());
+    /**
+     * The callbacks of an allocator in the form taken by the Vulkan create
+     * and destroy calls, used by the components for their own objects.
+     *
+     * @param hostAllocator The allocator, which can be null
+     * @return The callbacks, or null for the default allocation of the driver
+     */
+    static vk::Optional<const vk::AllocationCallbacks> callbacks(
+      const std::shared_ptr<HostAllocator>& hostAllocator);
 
-        if (data.size() != this->mSize) {
-            throw std::runtime_error(
-              "Kompute TensorT Cannot set data of different sizes");
-        }
+    /**
+     * Reads the counters. They are read one after the other, so the stats
+     * may miss the allocations made while they are read.
+     *
+     * @return The values of the counters
+     */
+    Stats stats() const;
 
-        Tensor::setRawData(data.data());
-    }
+    /**
+     * Sets the cumulative counters back to zero and the peak back to the
+     * live bytes, for example before the operation to measure.
+     */
+    void resetStats();
 
-    TensorDataTypes dataType();
+  private:
+    struct Header;
+
+    vk::AllocationCallbacks mCallbacks;
+    vk::AllocationCallbacks mUpstream;
+    bool mHasUpstream = false;
+
+    // -------------- ARENA OF THE COMMAND SCOPE
+    std::mutex mArenaMutex;
+    std::vector<char> mArena;
+    size_t mArenaOffset = 0;
+    size_t mArenaLiveCount = 0;
+
+    // -------------- COUNTERS
+    std::atomic<uint64_t> mAllocations{ 0 };
+    std::atomic<uint64_t> mFrees{ 0 };
+    std::atomic<uint64_t> mArenaAllocations{ 0 };
+    std::atomic<uint64_t> mLiveBytes{ 0 };
+    std::atomic<uint64_t> mPeakBytes{ 0 };
+    std::atomic<uint64_t> mTotalBytes{ 0 };
+    std::atomic<uint64_t> mInternalAllocations{ 0 };
+    std::atomic<uint64_t> mInternalBytes{ 0 };
+
+    void* allocate(size_t size,
+                   size_t alignment,
+                   VkSystemAllocationScope allocationScope);
+    void* reallocate(void* original,
+                     size_t size,
+                     size_t alignment,
+                     VkSystemAllocationScope allocationScope);
+    void deallocate(void* memory);
+    void* allocateArena(size_t size, size_t alignment);
+
+    static VKAPI_ATTR void* VKAPI_CALL allocateCallback(
+      void* userData,
+      size_t size,
+      size_t alignment,
+      VkSystemAllocationScope allocationScope);
+    static VKAPI_ATTR void* VKAPI_CALL reallocateCallback(
+      void* userData,
+      void* original,
+      size_t size,
+      size_t alignment,
+      VkSystemAllocationScope allocationScope);
+    static VKAPI_ATTR void VKAPI_CALL freeCallback(void* userData,
+                                                   void* memory);
+    static VKAPI_ATTR void VKAPI_CALL internalAllocationCallback(
+      void* userData,
+      size_t size,
+      VkInternalAllocationType allocationType,
+      VkSystemAllocationScope allocationScope);
+    static VKAPI_ATTR void VKAPI_CALL internalFreeCallback(
+      void* userData,
+      size_t size,
+      VkInternalAllocationType allocationType,
+      VkSystemAllocationScope allocationScope);
 };
 
 } // End namespace kp
 
 // SPDX-License-Identifier: Apache-2.0
 
+#include <vector>
+
 namespace kp {
 
 /**
-    Abstraction for compute shaders that are run on top of tensors grouped via
-   ParameterGroups (which group descriptorsets)
-*/
-class Algorithm
+ * Properties of a physical device queried once when the manager selects it,
+ * and shared with the components it creates instead of each of them querying
+ * the driver again, such as every sequence for its queue family. They do not
+ * change while the device exists.
+ */
+class DeviceInfo
 {
   public:
     /**
-     *  Main constructor for algorithm with configuration parameters to create
-     *  the underlying resources.
+     * Constructor querying the properties of a physical device.
      *
-     *  @param device The Vulkan device to use for creating resources
-     *  @param tensors (optional) The tensors to use to create the descriptor
-     * resources
-     *  @param spirv (optional) The spirv code to use to create the algorithm
-     *  @param workgroup (optional) The kp::Workgroup to use for the dispatch
-     * which defaults to kp::Workgroup(tensor[0].size(), 1, 1) if not set.
-     *  @param specializationConstants (optional) The templatable param is to be used to
-     * initialize the specialization constants which cannot be changed once set.
-     *  @param pushConstants (optional) This templatable param is to be used when
-     * initializing the pipeline, which set the size of the push constants -
-     * these can be modified but all new values must have the same data type and length
-     * as otherwise it will result in errors.
+     * @param physicalDevice The physical device to query
      */
-    template<typename S = float, typename P = float>
-    Algorithm(std::shared_ptr<vk::Device> device,
-              const std::vector<std::shared_ptr<Tensor>>& tensors = {},
-              const std::vector<uint32_t>& spirv = {},
-              const Workgroup& workgroup = {},
-              const std::vector<S>& specializationConstants = {},
-              const std::vector<P>& pushConstants = {})
-    {
-        KP_LOG_DEBUG("Kompute Algorithm Constructor with device");
-
-        this->mDevice = device;
-
-        if (tensors.size() && spirv.size()) {
-            KP_LOG_INFO("Kompute Algorithm initialising with tensor size: {} and "
-                        "spirv size: {}",
-                        tensors.size(),
-                        spirv.size());
-            this->rebuild(
-              tensors, spirv, workgroup, specializationConstants, pushConstants);
-        } else {
-            KP_LOG_INFO("Kompute Algorithm constructor with empty tensors and or "
-                        "spirv so not rebuilding vulkan components");
-        }
-    }
+    DeviceInfo(const vk::PhysicalDevice& physicalDevice);
 
     /**
-     *  Rebuild function to reconstruct algorithm with configuration parameters
-     * to create the underlying resources.
+     * The general properties and limits of the device.
      *
-     *  @param tensors The tensors to use to create the descriptor resources
-     *  @param spirv The spirv code to use to create the algorithm
-     *  @param workgroup (optional) The kp::Workgroup to use for the dispatch
-     * which defaults to kp::Workgroup(tensor[0].size(), 1, 1) if not set.
-     *  @param specializationConstants (optional) The std::vector<float> to use to
-     * initialize the specialization constants which cannot be changed once set.
-     *  @param pushConstants (optional) The std::vector<float> to use when
-     * initializing the pipeline, which set the size of the push constants -
-     * these can be modified but all new values must have the same vector size
-     * as this initial value.
+     * @return Reference to the properties of the device
      */
-    template<typename S = float, typename P = float>
-    void rebuild(const std::vector<std::shared_ptr<Tensor>>& tensors,
-                 const std::vector<uint32_t>& spirv,
-                 const Workgroup& workgroup = {},
-                 const std::vector<S>& specializationConstants = {},
-                 const std::vector<P>& pushConstants = {})
-    {
-        KP_LOG_DEBUG("Kompute Algorithm rebuild started");
-
-        this->mTensors = tensors;
-        this->mSpirv = spirv;
-
-        if (specializationConstants.size()) {
-            if (this->mSpecializationConstantsData) {
-                free(this->mSpecializationConstantsData);
-            }
-            uint32_t memorySize = sizeof(decltype(specializationConstants.back()));
-            uint32_t size = specializationConstants.size();
-            uint32_t totalSize = size * memorySize;
-            this->mSpecializationConstantsData = malloc(totalSize);
-            memcpy(this->mSpecializationConstantsData, specializationConstants.data(), totalSize);
-            this->mSpecializationConstantsDataTypeMemorySize = memorySize;
-            this->mSpecializationConstantsSize = size;
-        }
-
-        if (pushConstants.size()) {
-            if (this->mPushConstantsData) {
-                free(this->mPushConstantsData);
-            }
-            uint32_t memorySize = sizeof(decltype(pushConstants.back()));
-            uint32_t size = pushConstants.size();
-            uint32_t totalSize = size * memorySize;
-            this->mPushConstantsData = malloc(totalSize);
-            memcpy(this->mPushConstantsData, pushConstants.data(), totalSize);
-            this->mPushConstantsDataTypeMemorySize = memorySize;
-            this->mPushConstantsSize = size;
-        }
-
-        this->setWorkgroup(workgroup,
-                           this->mTensors.size() ? this->mTensors[0]->size() : 1);
-
-        // Descriptor pool is created first so if available then destroy all before
-        // rebuild
-        if (this->isInit()) {
-            this->destroy();
-        }
-
-        this->createParameters();
-        this->createShaderModule();
-        this->createPipeline();
-    }
+    const vk::PhysicalDeviceProperties& properties() const;
 
     /**
-     * Destructor for Algorithm which is responsible for freeing and desroying
-     * respective pipelines and owned parameter groups.
+     * The subgroup properties of the device, with a null pNext.
+     *
+     * @return Reference to the subgroup properties of the device
      */
-    ~Algorithm();
+    const vk::PhysicalDeviceSubgroupProperties& subgroupProperties() const;
 
     /**
-     * Records the dispatch function with the provided template parameters or
-     * alternatively using the size of the tensor by default.
+     * The memory types and heaps of the device.
      *
-     * @param commandBuffer Command buffer to record the algorithm resources to
+     * @return Reference to the memory properties of the device
      */
-    void recordDispatch(const vk::CommandBuffer& commandBuffer);
+    const vk::PhysicalDeviceMemoryProperties& memoryProperties() const;
 
     /**
-     * Records command that binds the "core" algorithm components which consist
-     * of binding the pipeline and binding the descriptorsets.
+     * The properties of the queue families of the device, by family index.
      *
-     * @param commandBuffer Command buffer to record the algorithm resources to
+     * @return Reference to the queue family properties of the device
      */
-    void recordBindCore(const vk::CommandBuffer& commandBuffer);
+    const std::vector<vk::QueueFamilyProperties>& queueFamilyProperties()
+      const;
 
     /**
-     * Records command that binds the push constants to the command buffer
-     * provided
-     * - it is required that the pushConstants provided are of the same size as
-     * the ones provided during initialization.
+     * The core features enabled on the logical device, which may be fewer
+     * than the features the physical device supports. None are reported
+     * until the manager records them with setEnabledFeatures.
      *
-     * @param commandBuffer Command buffer to record the algorithm resources to
+     * @return Reference to the features enabled on the device
      */
-    void recordBindPush(const vk::CommandBuffer& commandBuffer);
+    const vk::PhysicalDeviceFeatures& enabledFeatures() const;
 
     /**
-     * function that checks all the gpu resource components to verify if these
-     * have been created and returns true if all are valid.
+     * Record the core features the logical device was created with, before
+     * the info is shared with the components of the manager.
      *
-     * @returns returns true if the algorithm is currently initialized.
+     * @param enabledFeatures The features enabled on the device
      */
-    bool isInit();
+    void setEnabledFeatures(const vk::PhysicalDeviceFeatures& enabledFeatures);
 
     /**
-     * Sets the work group to use in the recordDispatch
+     * Whether device timestamps can be calibrated against CLOCK_MONOTONIC,
+     * which requires VK_EXT_calibrated_timestamps to be enabled on the
+     * logical device and both time domains to be calibrateable. False until
+     * the manager records it with setCalibratedTimestamps.
      *
-     * @param workgroup The kp::Workgroup value to use to update the algorithm.
-     * It must have a value greater than 1 on the x value (index 1) otherwise it
-     * will be initialized on the size of the first tensor (ie.
-     * this->mTensor[0]->size())
+     * @return Boolean stating whether timestamps can be calibrated
      */
-    void setWorkgroup(const Workgroup& workgroup, uint32_t minSize = 1);
+    bool hasCalibratedTimestamps() const;
+
     /**
-     * Sets the push constants to the new value provided to use in the next
-     * bindPush()
+     * Record whether device timestamps can be calibrated against
+     * CLOCK_MONOTONIC, before the info is shared with the components of the
+     * manager.
      *
-     * @param pushConstants The templatable vector is to be used to set the push constants to use in the
-     * next bindPush(...) calls. The constants provided must be of the same size
-     * as the ones created during initialization.
+     * @param calibratedTimestamps Whether timestamps can be calibrated
      */
-    template<typename T>
-    void setPushConstants(const std::vector<T>& pushConstants)
+    void setCalibratedTimestamps(bool calibratedTimestamps);
+
+  private:
+    vk::PhysicalDeviceProperties mProperties;
+    vk::PhysicalDeviceSubgroupProperties mSubgroupProperties;
+    vk::PhysicalDeviceMemoryProperties mMemoryProperties;
+    std::vector<vk::QueueFamilyProperties> mQueueFamilyProperties;
+    vk::PhysicalDeviceFeatures mEnabledFeatures;
+    bool mCalibratedTimestamps = false;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <map>
+#include <mutex>
+#include <string>
+
+#ifndef KOMPUTE_MEMORY_POOL_BLOCK_SIZE
+#define KOMPUTE_MEMORY_POOL_BLOCK_SIZE (64 * 1024 * 1024)
+#endif
+
+namespace kp {
+
+/**
+ * Sub-allocating pool of device memory shared across the tensors created by
+ * a manager.
+ *
+ * Instead of performing a vkAllocateMemory call for every buffer, the pool
+ * allocates large blocks of vk::DeviceMemory per memory type index and hands
+ * out aligned ranges within them. Host visible blocks are mapped once when
+ * created, as Vulkan does not allow mapping the same memory object more than
+ * once, and each allocation exposes its pointer into that mapping. Ranges of
+ * non-coherent memory are aligned to the non-coherent atom size so they can
+ * be flushed and invalidated without affecting their neighbours.
+ *
+ * When enabled, the pool can also import existing host allocations through
+ * VK_EXT_external_memory_host, and Android hardware buffers through
+ * VK_ANDROID_external_memory_android_hardware_buffer, each into a dedicated
+ * block of its own.
+ *
+ * The pool reports the usage of each memory heap, with the budget of the
+ * process when VK_EXT_memory_budget is supported, and can enforce a soft limit
+ * per heap so allocations fail before the driver runs out of memory.
+ */
+class MemoryPool
+{
+  public:
+    /**
+     * Range of device memory handed out by the pool. The memory handle is
+     * owned by the pool and must not be freed by the holder of the allocation.
+     */
+    struct Allocation
     {
-        uint32_t memorySize = sizeof(decltype(pushConstants.back()));
-        uint32_t size = pushConstants.size();
+        vk::DeviceMemory memory;
+        vk::DeviceSize offset = 0;
+        vk::DeviceSize size = 0;
+        uint32_t memoryTypeIndex = 0;
+        void* mappedData = nullptr; ///< Host pointer, null if not host visible
+    };
 
-        this->setPushConstants(pushConstants.data(), size, memorySize);
-    }
+    /**
+     * Usage of a memory heap of the device. Without VK_EXT_memory_budget the
+     * budget is the size of the heap and the usage is the memory of the pool.
+     */
+    struct HeapStats
+    {
+        vk::MemoryHeapFlags flags;
+        vk::DeviceSize size = 0;      ///< Total size of the heap
+        vk::DeviceSize budget = 0;    ///< Memory the process can allocate
+        vk::DeviceSize usage = 0;     ///< Memory the process has allocated
+        vk::DeviceSize allocated = 0; ///< Size of the blocks of the pool
+        vk::DeviceSize used = 0;      ///< Size of the ranges handed out
+        vk::DeviceSize limit = 0;     ///< Soft limit of the pool, 0 if none
+    };
 
     /**
-     * Sets the push constants to the new value provided to use in the next
-     * bindPush() with the raw memory block location and memory size to be used.
+     * Constructor for the memory pool which will allocate blocks lazily as
+     * memory is requested.
      *
-     * @param data The raw data point to copy the data from, without modifying the pointer.
-     * @param size The number of data elements provided in the data
-     * @param memorySize The memory size of each of the data elements in bytes.
+     * @param physicalDevice The physical device to use to fetch properties
+     * @param device The device to use to allocate the memory blocks from
+     * @param blockSize The size of the blocks allocated by the pool, requests
+     * larger than half a block receive a dedicated block of their own
+     * @param hostAllocator (Optional) Host allocation callbacks to allocate
+     * and free the memory blocks with
+     * @param deviceInfo (Optional) Properties of the physical device already
+     * queried by the manager, queried from the device if null
      */
-    void setPushConstants(void* data, uint32_t size, uint32_t memorySize) {
+    MemoryPool(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
+               std::shared_ptr<vk::Device> device,
+               vk::DeviceSize blockSize = KOMPUTE_MEMORY_POOL_BLOCK_SIZE,
+               std::shared_ptr<HostAllocator> hostAllocator = nullptr,
+               std::shared_ptr<DeviceInfo> deviceInfo = nullptr);
 
-        uint32_t totalSize = memorySize * size;
-        uint32_t previousTotalSize = this->mPushConstantsDataTypeMemorySize * this->mPushConstantsSize;
+    /**
+     * Destructor which frees all the blocks allocated by the pool.
+     */
+    ~MemoryPool();
 
-        if (totalSize != previousTotalSize) {
-            throw std::runtime_error(
-              fmt::format("Kompute Algorithm push "
-                          "constant total memory size provided is {} but expected {} bytes",
-                          totalSize,
-                          previousTotalSize));
-        }
-        if (this->mPushConstantsData) {
-            free(this->mPushConstantsData);
-        }
+    /**
+     * Sub-allocates a range matching the memory requirements with the first
+     * memory type that supports the memory property flags provided.
+     *
+     * @param memoryRequirements The requirements of the resource to bind
+     * @param memoryPropertyFlags The properties required for the memory
+     * @return Allocation describing the memory and offset to bind to
+     */
+    Allocation allocate(const vk::MemoryRequirements& memoryRequirements,
+                        const vk::MemoryPropertyFlags& memoryPropertyFlags);
 
-        this->mPushConstantsData = malloc(totalSize);
-        memcpy(this->mPushConstantsData, data, totalSize);
-        this->mPushConstantsDataTypeMemorySize = memorySize;
-        this->mPushConstantsSize = size;
-    }
+    /**
+     * Enables importing host pointers with VK_EXT_external_memory_host, which
+     * must have been enabled when the device was created.
+     *
+     * @param instance The instance to load the extension functions with
+     */
+    void enableHostPointerImport(const vk::Instance& instance);
 
     /**
-     * Gets the current workgroup from the algorithm.
+     * Check whether a host pointer can be imported by the pool, which
+     * requires the import to be enabled and the pointer and size to be
+     * aligned to minImportedHostPointerAlignment.
      *
-     * @param The kp::Constant to use to set the push constants to use in the
-     * next bindPush(...) calls. The constants provided must be of the same size
-     * as the ones created during initialization.
+     * @param hostPointer The host pointer to import
+     * @param size The size in bytes of the host allocation
+     * @return Boolean stating whether the pointer can be imported
      */
-    const Workgroup& getWorkgroup();
+    bool canImportHostPointer(const void* hostPointer, vk::DeviceSize size);
+
     /**
-     * Gets the specialization constants of the current algorithm.
+     * Imports a host allocation as device memory in a dedicated block, so the
+     * device accesses the host memory directly without any copy. The host
+     * allocation must outlive the returned allocation.
      *
-     * @returns The std::vector<float> currently set for specialization constants
+     * @param memoryRequirements The requirements of the resource to bind
+     * @param memoryPropertyFlags The properties required for the memory
+     * @param hostPointer The host pointer to import
+     * @param size The size in bytes of the host allocation
+     * @param allocation Allocation set to the imported memory on success
+     * @return Boolean stating whether the import succeeded, the caller is
+     * expected to fall back to a regular allocation otherwise
      */
-    template<typename T>
-    const std::vector<T> getSpecializationConstants()
-    {
-        return { (T*)this->mSpecializationConstantsData,
-            ((T*)this->mSpecializationConstantsData) + this->mSpecializationConstantsSize };
-    }
+    bool importHostPointer(const vk::MemoryRequirements& memoryRequirements,
+                           const vk::MemoryPropertyFlags& memoryPropertyFlags,
+                           void* hostPointer,
+                           vk::DeviceSize size,
+                           Allocation& allocation);
+
     /**
-     * Gets the specialization constants of the current algorithm.
+     * Enables VK_KHR_buffer_device_address, which must have been enabled
+     * with its bufferDeviceAddress feature when the device was created. The
+     * memory allocated by the pool from then on can back buffers whose
+     * device address is retrieved by bufferDeviceAddress.
      *
-     * @returns The std::vector<float> currently set for push constants
+     * @param instance The instance to load the extension functions with
      */
-    template<typename T>
-    const std::vector<T> getPushConstants()
-    {
-        return { (T*)this->mPushConstantsData,
-            ((T*)this->mPushConstantsData) + this->mPushConstantsSize };
-    }
+    void enableBufferDeviceAddress(const vk::Instance& instance);
+
     /**
-     * Gets the current tensors that are used in the algorithm.
+     * Check whether the memory of the pool is allocated with device
+     * addresses, so buffers can be created with the shader device address
+     * usage.
      *
-     * @returns The list of tensors used in the algorithm.
+     * @return Boolean stating whether buffer device addresses are enabled
      */
-    const std::vector<std::shared_ptr<Tensor>>& getTensors();
-
-    void destroy();
-
-  private:
-    // -------------- NEVER OWNED RESOURCES
-    std::shared_ptr<vk::Device> mDevice;
-    std::vector<std::shared_ptr<Tensor>> mTensors;
-
-    // -------------- OPTIONALLY OWNED RESOURCES
-    std::shared_ptr<vk::DescriptorSetLayout> mDescriptorSetLayout;
-    bool mFreeDescriptorSetLayout = false;
-    std::shared_ptr<vk::DescriptorPool> mDescriptorPool;
-    bool mFreeDescriptorPool = false;
-    std::shared_ptr<vk::DescriptorSet> mDescriptorSet;
-    bool mFreeDescriptorSet = false;
-    std::shared_ptr<vk::ShaderModule> mShaderModule;
-    bool mFreeShaderModule = false;
-    std::shared_ptr<vk::PipelineLayout> mPipelineLayout;
-    bool mFreePipelineLayout = false;
-    std::shared_ptr<vk::PipelineCache> mPipelineCache;
-    bool mFreePipelineCache = false;
-    std::shared_ptr<vk::Pipeline> mPipeline;
-    bool mFreePipeline = false;
-
-    // -------------- ALWAYS OWNED RESOURCES
-    std::vector<uint32_t> mSpirv;
-    void* mSpecializationConstantsData = nullptr;
-    uint32_t mSpecializationConstantsDataTypeMemorySize = 0;
-    uint32_t mSpecializationConstantsSize = 0;
-    void* mPushConstantsData = nullptr;
-    uint32_t mPushConstantsDataTypeMemorySize = 0;
-    uint32_t mPushConstantsSize = 0;
-    Workgroup mWorkgroup;
-
-    // Create util functions
-    void createShaderModule();
-    void createPipeline();
-
-    // Parameters
-    void createParameters();
-};
-
-} // End namespace kp
-
-// SPDX-License-Identifier: Apache-2.0
-
-namespace kp {
-
-/**
- *  Base Operation which provides the high level interface that Kompute
- *  operations implement in order to perform a set of actions in the GPU.
- *
- *  Operations can perform actions on tensors, and optionally can also own an
- *  Algorithm with respective parameters. kp::Operations with kp::Algorithms
- *  would inherit from kp::OpBaseAlgo.
- */
-class OpBase
-{
-  public:
+    bool hasBufferDeviceAddress();
 
     /**
-     * Default destructor for OpBase class. This OpBase destructor class should
-     * always be called to destroy and free owned resources unless it is
-     * intended to destroy the resources in the parent class.
+     * Retrieve the device address of a buffer bound to memory of the pool,
+     * which shaders can dereference through GL_EXT_buffer_reference.
+     *
+     * @param buffer The buffer created with the shader device address usage
+     * @return The device address of the start of the buffer
      */
-    virtual ~OpBase()
-    {
-        KP_LOG_DEBUG("Kompute OpBase destructor started");
-    }
+    vk::DeviceAddress bufferDeviceAddress(const vk::Buffer& buffer);
 
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
     /**
-     * The record function is intended to only send a record command or run
-     * commands that are expected to record operations that are to be submitted
-     * as a batch into the GPU.
+     * Enables importing Android hardware buffers with
+     * VK_ANDROID_external_memory_android_hardware_buffer, which must have
+     * been enabled when the device was created.
      *
-     * @param commandBuffer The command buffer to record the command into.
+     * @param instance The instance to load the extension functions with
      */
-    virtual void record(const vk::CommandBuffer& commandBuffer) = 0;
+    void enableHardwareBufferImport(const vk::Instance& instance);
 
     /**
-     * Pre eval is called before the Sequence has called eval and submitted the commands to
-     * the GPU for processing, and can be used to perform any per-eval setup steps
-     * required as the computation iteration begins. It's worth noting that 
-     * there are situations where eval can be called multiple times, so the 
-     * resources that are created should be idempotent in case it's called multiple
-     * times in a row.
+     * Check whether Android hardware buffers can be imported by the pool.
      *
-     * @param commandBuffer The command buffer to record the command into.
+     * @return Boolean stating whether the import is enabled
      */
-    virtual void preEval(const vk::CommandBuffer& commandBuffer) = 0;
+    bool canImportHardwareBuffer();
 
     /**
-     * Post eval is called after the Sequence has called eval and submitted the commands to
-     * the GPU for processing, and can be used to perform any tear-down steps
-     * required as the computation iteration finishes. It's worth noting that 
-     * there are situations where eval can be called multiple times, so the 
-     * resources that are destroyed should not require a re-init unless explicitly
-     * provided by the user.
+     * Imports an Android hardware buffer as device memory in a dedicated
+     * block, so the device accesses the memory of the buffer directly without
+     * any copy. The memory is mapped when the buffer has a host visible
+     * memory type, which is the case for buffers allocated with CPU usage.
+     * The import holds a reference to the hardware buffer until the
+     * allocation is freed.
      *
-     * @param commandBuffer The command buffer to record the command into.
+     * @param memoryRequirements The requirements of the resource to bind
+     * @param hardwareBuffer The hardware buffer to import
+     * @param allocation Allocation set to the imported memory on success
+     * @return Boolean stating whether the import succeeded
      */
-    virtual void postEval(const vk::CommandBuffer& commandBuffer) = 0;
-};
-
-} // End namespace kp
-
-// SPDX-License-Identifier: Apache-2.0
+    bool importHardwareBuffer(const vk::MemoryRequirements& memoryRequirements,
+                              AHardwareBuffer* hardwareBuffer,
+                              Allocation& allocation);
+#endif
 
-namespace kp {
+    /**
+     * Returns the range of an allocation back to the pool so it can be
+     * reused. Dedicated blocks are freed straight away.
+     *
+     * @param allocation The allocation previously returned by allocate
+     */
+    void free(const Allocation& allocation);
 
-/**
- * Operation that provides a general abstraction that simplifies the use of 
- * algorithm and parameter components which can be used with shaders.
- * It exposes the pipeline barrier functionality specifically for memory
- * barriers that can be configured through the respective source and destination
- * masks
- */
-class OpMemoryBarrier : public OpBase
-{
-  public:
+    /**
+     * Frees all the blocks owned by the pool. Allocations handed out before
+     * this call become invalid.
+     */
+    void destroy();
 
     /**
-     * Constructor that stores tensors as well as memory barrier parameters to be
-     * used to create a pipeline barrier on the respective primary or staging tensor.
+     * Total number of vk::DeviceMemory blocks currently allocated by the pool.
      *
-     * @param tensors The tensors to apply the memory barriers on
-     * @param srcAccessMask The kp::AccessFlagBits for the source access mask
-     * @param dstAccessMask The kp::AccessFlagBits for the destination access mask
-     * @param srcStageMask The kp::PipelineStageFlagBits for the source stage mask
-     * @param dstStageMask The kp::PipelineStageFlagBits for the destination stage mask
-     * @param barrierOnPrimary Boolean to select primary or secondary buffers on tensors
+     * @return Total number of blocks across all memory types
      */
-    OpMemoryBarrier(
-            const std::vector<std::shared_ptr<Tensor>>& tensors,
-            const vk::AccessFlagBits& srcAccessMask,
-            const vk::AccessFlagBits& dstAccessMask,
-            const vk::PipelineStageFlagBits& srcStageMask,
-            const vk::PipelineStageFlagBits& dstStageMask,
-            bool barrierOnPrimary = true);
+    uint32_t blockCount();
 
     /**
-     * Default destructor, which is in charge of destroying the reference to the tensors
-     * and all the relevant access / stage masks created
+     * Total size of the vk::DeviceMemory blocks currently allocated by the
+     * pool, including the ranges that are not in use.
+     *
+     * @return Total size in bytes of all the blocks
      */
-    virtual ~OpMemoryBarrier() override;
+    vk::DeviceSize allocatedSize();
 
     /**
-     * This records the memory barrier with the access and stage masks provided
-     * across all relevant tensors.
+     * Retrieve the usage of every memory heap of the device, including the
+     * budget reported by the driver when VK_EXT_memory_budget is supported.
      *
-     * @param commandBuffer The command buffer to record the command into.
+     * @return Usage of the heaps indexed by heap index
      */
-    virtual void record(const vk::CommandBuffer& commandBuffer) override;
+    std::vector<HeapStats> heapStats();
 
     /**
-     * Does not perform any preEval commands.
+     * Check whether the heap budget and usage are reported by the driver
+     * through VK_EXT_memory_budget.
      *
-     * @param commandBuffer The command buffer to record the command into.
+     * @return Boolean stating whether the memory budget is available
      */
-    virtual void preEval(const vk::CommandBuffer& commandBuffer) override;
+    bool hasMemoryBudget();
 
     /**
-     * Does not perform any postEval commands.
+     * Sets a soft limit on the memory the pool allocates from a heap. Once
+     * reached, allocations throw instead of allocating further blocks, which
+     * leaves headroom before the driver itself runs out of memory.
      *
-     * @param commandBuffer The command buffer to record the command into.
+     * @param heapIndex The index of the heap to limit
+     * @param limit The maximum size in bytes of the blocks allocated from the
+     * heap, or 0 to remove the limit
      */
-    virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
+    void setHeapLimit(uint32_t heapIndex, vk::DeviceSize limit);
 
-private:
-    const vk::AccessFlagBits mSrcAccessMask;
-    const vk::AccessFlagBits mDstAccessMask;
-    const vk::PipelineStageFlagBits mSrcStageMask;
-    const vk::PipelineStageFlagBits mDstStageMask;
-    const bool mBarrierOnPrimary;
-    const std::vector<std::shared_ptr<Tensor>> mTensors;
+  private:
+    struct Block
+    {
+        vk::DeviceMemory memory;
+        vk::DeviceSize size = 0;
+        void* mappedData = nullptr;
+        bool dedicated = false;
+        bool imported = false; ///< Memory backed by a host allocation
+        // Free ranges as offset to size, kept merged with their neighbours
+        std::map<vk::DeviceSize, vk::DeviceSize> freeRanges;
+    };
+
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<vk::PhysicalDevice> mPhysicalDevice;
+    std::shared_ptr<vk::Device> mDevice;
+    std::shared_ptr<HostAllocator> mHostAllocator;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::map<uint32_t, std::vector<std::unique_ptr<Block>>> mBlocks;
+    vk::PhysicalDeviceMemoryProperties mMemoryProperties;
+    vk::DeviceSize mNonCoherentAtomSize;
+    vk::DeviceSize mBlockSize;
+    std::mutex mMutex;
+    vk::DispatchLoaderDynamic mDispatcher;
+    bool mHostPointerImport = false;
+    vk::DeviceSize mHostPointerAlignment = 0;
+    bool mHardwareBufferImport = false;
+    bool mBufferDeviceAddress = false;
+    bool mMemoryBudget = false;
+    std::map<uint32_t, vk::DeviceSize> mHeapLimits;
+
+    int32_t findMemoryTypeIndex(
+      uint32_t memoryTypeBits,
+      const vk::MemoryPropertyFlags& memoryPropertyFlags);
+    Block* createBlock(uint32_t memoryTypeIndex,
+                       vk::DeviceSize size,
+                       bool dedicated);
+    void freeBlock(Block& block);
+    void checkHeapLimit(uint32_t memoryTypeIndex, vk::DeviceSize size);
+    bool allocateFromBlock(Block& block,
+                           const vk::MemoryRequirements& memoryRequirements,
+                           Allocation& allocation);
 };
 
 } // End namespace kp
 
 // SPDX-License-Identifier: Apache-2.0
 
+#include <mutex>
+
+#ifndef KOMPUTE_STAGING_RING_SIZE
+#define KOMPUTE_STAGING_RING_SIZE (16 * 1024 * 1024)
+#endif
+
+#ifndef KOMPUTE_STAGING_RING_SLOTS
+#define KOMPUTE_STAGING_RING_SLOTS 4
+#endif
+
 namespace kp {
 
 /**
- * Operation that copies the data from the first tensor to the rest of the tensors 
- * provided, using a record command for all the vectors. This operation does not 
- * own/manage the memory of the tensors passed to it. The operation must only 
- * receive tensors of type 
-*/
-class OpTensorCopy : public OpBase
+ * Fixed size host visible buffer shared by device tensors to transfer data
+ * to and from their device memory, instead of each tensor keeping its own
+ * staging buffer.
+ *
+ * The ring is split into slots which each have their own command buffer and
+ * fence, so transfers larger than a slot are streamed in chunks while the
+ * host copies the next chunk into a free slot.
+ */
+class StagingRing
 {
   public:
     /**
-     * Default constructor with parameters that provides the core vulkan resources 
-     * and the tensors that will be used in the operation.
-     *
-     * @param tensors Tensors that will be used to create in operation.
-     */
-    OpTensorCopy(const std::vector<std::shared_ptr<Tensor>>& tensors);
-
-    /**
-     * Default destructor. This class does not manage memory so it won't be 
-     * expecting the parent to perform a release.
-     */
-    ~OpTensorCopy() override;
-
-    /**
-     * Records the copy commands from the first tensor into all the other 
-     * tensors provided. Also optionally records a barrier.
+     * Constructor for the staging ring which creates the host visible buffer
+     * and the command buffers used to submit the transfers.
      *
-     * @param commandBuffer The command buffer to record the command into.
+     * @param physicalDevice The physical device to use to fetch properties
+     * @param device The device to use to create the buffer and commands from
+     * @param computeQueue The queue to submit the transfers to
+     * @param queueIndex The index of the family of the queue provided
+     * @param memoryPool The pool to allocate the ring memory from
+     * @param ringSize The total size in bytes of the ring
+     * @param slotCount The number of slots the ring is split into
+     * @param queueMutex (Optional) Mutex held while submitting to the queue,
+     * shared with the other users of the queue
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy the buffer, command pool and fences of the ring with
      */
-    void record(const vk::CommandBuffer& commandBuffer) override;
+    StagingRing(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
+                std::shared_ptr<vk::Device> device,
+                std::shared_ptr<vk::Queue> computeQueue,
+                uint32_t queueIndex,
+                std::shared_ptr<MemoryPool> memoryPool,
+                vk::DeviceSize ringSize = KOMPUTE_STAGING_RING_SIZE,
+                uint32_t slotCount = KOMPUTE_STAGING_RING_SLOTS,
+                std::shared_ptr<std::mutex> queueMutex = nullptr,
+                std::shared_ptr<HostAllocator> hostAllocator = nullptr);
 
     /**
-     * Does not perform any preEval commands.
-     *
-     * @param commandBuffer The command buffer to record the command into.
+     * Destructor which waits for pending transfers and frees the vulkan
+     * resources of the ring.
      */
-    virtual void preEval(const vk::CommandBuffer& commandBuffer) override;
+    ~StagingRing();
 
     /**
-     * Copies the local vectors for all the tensors to sync the data with the gpu.
+     * Copies host data into the buffer provided through the ring. The copies
+     * are submitted before returning, and later submissions to the same queue
+     * are expected to synchronise with them via their own barriers.
      *
-     * @param commandBuffer The command buffer to record the command into.
+     * @param data Pointer to the host data to upload
+     * @param dstBuffer Buffer to copy the data into
+     * @param dstOffset Offset in bytes into the destination buffer
+     * @param size Size in bytes of the data to upload
      */
-    virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
-
-  private:
-    // -------------- ALWAYS OWNED RESOURCES
-    std::vector<std::shared_ptr<Tensor>> mTensors;
-};
-
-} // End namespace kp
-
-// SPDX-License-Identifier: Apache-2.0
+    void upload(const void* data,
+                const vk::Buffer& dstBuffer,
+                vk::DeviceSize dstOffset,
+                vk::DeviceSize size);
 
-namespace kp {
-
-/**
- * Operation that syncs tensor's device by mapping local data into the device memory. 
- * For TensorTypes::eDevice it will use a record operation for the memory to be syncd 
- * into GPU memory which means that the operation will be done in sync with GPU commands. 
- * For TensorTypes::eHost it will only map the data into host memory which will 
- * happen during preEval before the recorded commands are dispatched.
-*/
-class OpTensorSyncDevice : public OpBase
-{
-  public:
     /**
-     * Default constructor with parameters that provides the core vulkan resources 
-     * and the tensors that will be used in the operation. The tensos provided cannot 
-     * be of type TensorTypes::eStorage.
+     * Copies the contents of the buffer provided into host memory through the
+     * ring, waiting for all the transfers to complete before returning.
      *
-     * @param tensors Tensors that will be used to create in operation.
+     * @param srcBuffer Buffer to copy the data from
+     * @param srcOffset Offset in bytes into the source buffer
+     * @param data Pointer to the host memory to download into
+     * @param size Size in bytes of the data to download
      */
-    OpTensorSyncDevice(const std::vector<std::shared_ptr<Tensor>>& tensors);
+    void download(const vk::Buffer& srcBuffer,
+                  vk::DeviceSize srcOffset,
+                  void* data,
+                  vk::DeviceSize size);
 
     /**
-     * Default destructor. This class does not manage memory so it won't be expecting the parent to perform a release.
+     * Waits for all the transfers in flight to complete.
      */
-    ~OpTensorSyncDevice() override;
+    void waitIdle();
 
     /**
-     * For device tensors, it records the copy command for the tensor to copy the 
-     * data from its staging to device memory.
-     *
-     * @param commandBuffer The command buffer to record the command into.
+     * Destroys the vulkan resources of the ring after waiting for any pending
+     * transfers.
      */
-    void record(const vk::CommandBuffer& commandBuffer) override;
+    void destroy();
 
     /**
-     * Does not perform any preEval commands.
+     * Total size in bytes of the ring.
      *
-     * @param commandBuffer The command buffer to record the command into.
+     * @return Size of the ring buffer
      */
-    virtual void preEval(const vk::CommandBuffer& commandBuffer) override;
+    vk::DeviceSize size();
 
     /**
-     * Does not perform any postEval commands.
+     * Queue the transfers of the ring are submitted to.
      *
-     * @param commandBuffer The command buffer to record the command into.
+     * @return Queue of the ring
      */
-    virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
+    std::shared_ptr<vk::Queue> queue();
 
   private:
+    struct Slot
+    {
+        vk::DeviceSize offset = 0;
+        vk::CommandBuffer commandBuffer;
+        vk::Fence fence;
+        bool pending = false;
+        // Host destination of a download waiting on the fence of the slot
+        void* readbackData = nullptr;
+        vk::DeviceSize readbackSize = 0;
+    };
+
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<vk::PhysicalDevice> mPhysicalDevice;
+    std::shared_ptr<vk::Device> mDevice;
+    std::shared_ptr<vk::Queue> mComputeQueue;
+    std::shared_ptr<std::mutex> mQueueMutex;
+    std::shared_ptr<MemoryPool> mMemoryPool;
+    std::shared_ptr<HostAllocator> mHostAllocator;
+    // Stages of previous submissions the copies wait for, which exclude
+    // the compute shader stage on transfer queues
+    vk::PipelineStageFlags mWaitStageMask;
+
     // -------------- ALWAYS OWNED RESOURCES
-    std::vector<std::shared_ptr<Tensor>> mTensors;
+    vk::Buffer mBuffer;
+    MemoryPool::Allocation mAllocation;
+    vk::CommandPool mCommandPool;
+    std::vector<Slot> mSlots;
+    uint32_t mNextSlot = 0;
+    vk::DeviceSize mSlotSize = 0;
+    vk::DeviceSize mSize = 0;
+    std::mutex mMutex;
+
+    Slot& acquireSlot();
+    void completeSlot(Slot& slot);
+    void submitSlot(Slot& slot,
+                    const vk::Buffer& srcBuffer,
+                    const vk::Buffer& dstBuffer,
+                    const vk::BufferCopy& copyRegion,
+                    bool readback);
 };
 
 } // End namespace kp
 
 // SPDX-License-Identifier: Apache-2.0
 
+#ifndef KOMPUTE_TENSOR_MAX_DIRTY_RANGES
+#define KOMPUTE_TENSOR_MAX_DIRTY_RANGES 64
+#endif
+
 namespace kp {
 
 /**
- * Operation that syncs tensor's local memory by mapping device data into the 
- * local CPU memory. For TensorTypes::eDevice it will use a record operation 
- * for the memory to be syncd into GPU memory which means that the operation 
- * will be done in sync with GPU commands. For TensorTypes::eHost it will 
- * only map the data into host memory which will happen during preEval before 
- * the recorded commands are dispatched.
-*/
-class OpTensorSyncLocal : public OpBase
+ * IEEE 754 half precision float, the element type of eHalf tensors. Only the
+ * bits of the value are stored, which are converted from and to float on the
+ * host with round to nearest even, while shaders access them as float16_t.
+ */
+struct Half
+{
+    uint16_t bits = 0;
+
+    Half() = default;
+    Half(float value);
+    operator float() const;
+};
+
+/**
+ * Structured data used in GPU operations.
+ *
+ * Tensors are the base building block in Kompute to perform operations across
+ * GPUs. Each tensor would have a respective Vulkan memory and buffer, which
+ * would be used to store their respective data. The tensors can be used for GPU
+ * data storage or transfer.
+ */
+class Tensor
+{
+  public:
+    /**
+     * Type for tensors created: Device allows memory to be transferred from
+     * staging buffers. Staging are host memory visible. Storage are device
+     * visible but are not set up to transfer or receive data (only for shader
+     * storage). Uniform are host coherent memory read by shaders as a uniform
+     * buffer, so parameters written on the host before a submission are seen
+     * by sequences recorded once, without syncing or re-recording. Image are
+     * device memory 2D images bound as storage images, transferred through a
+     * staging buffer like device tensors.
+     */
+    enum class TensorTypes
+    {
+        eDevice = 0,  ///< Type is device memory, source and destination
+        eHost = 1,    ///< Type is host memory, source and destination
+        eStorage = 2, ///< Type is Device memory (only)
+        eUniform = 3, ///< Type is host memory bound as a uniform buffer
+        eImage = 4,   ///< Type is device memory bound as a storage image
+    };
+    /**
+     * Type of host visible memory used for the staging memory of device
+     * tensors, or the primary memory of host tensors. Cached memory speeds up
+     * reading the data on the host after a sync, at the cost of explicitly
+     * flushing and invalidating the memory when it is not coherent. Imported
+     * memory uses the data pointer provided directly as the memory of the
+     * tensor, in which case the pointer must outlive the tensor.
+     */
+    enum class HostMemoryTypes
+    {
+        eCoherent = 0, ///< Host coherent memory, usually uncached for reads
+        eCached = 1,   ///< Host cached memory, falls back to coherent memory
+        eImported = 2, ///< Data pointer imported, falls back to a copy
+    };
+    enum class TensorDataTypes
+    {
+        eBool = 0,
+        eInt = 1,
+        eUnsignedInt = 2,
+        eFloat = 3,
+        eDouble = 4,
+        eHalf = 5,          ///< kp::Half, requires 16 bit storage in shaders
+        eInt8 = 6,          ///< int8_t, requires 8 bit storage in shaders
+        eUnsignedInt8 = 7,  ///< uint8_t, requires 8 bit storage in shaders
+        eInt16 = 8,         ///< int16_t, requires 16 bit storage in shaders
+    };
+
+    /**
+     * Contiguous range of elements of a tensor, used to restrict transfers to
+     * the parts of the tensor that have changed.
+     */
+    struct Range
+    {
+        uint64_t offset = 0; ///< Index of the first element of the range
+        uint64_t count = 0;  ///< Number of elements in the range
+    };
+
+    /**
+     *  Constructor with data provided which would be used to create the
+     * respective vulkan buffer and memory.
+     *
+     *  @param physicalDevice The physical device to use to fetch properties
+     *  @param device The device to use to create the buffer and memory from
+     *  @param data Non-zero-sized vector of data that will be used by the
+     * tensor
+     *  @param tensorTypes Type for the tensor which is of type TensorTypes
+     *  @param hostMemoryType Type of the host visible memory of the tensor
+     *  @param memoryPool (Optional) Pool to sub-allocate the memory from, if
+     * not provided each buffer will get its own device memory allocation
+     *  @param stagingRing (Optional) Shared ring to transfer data through for
+     * device tensors, in which case no staging buffer is created and the
+     * tensor data is held in host memory
+     *  @param queueFamilyIndices (Optional) Queue families the buffers are
+     * accessed from, which are created with concurrent sharing when there
+     * are several so that no ownership transfer is needed between the
+     * queues. The buffers are exclusive to a single queue family otherwise.
+     *  @param debugUtils (Optional) Functions of VK_EXT_debug_utils to name
+     * the buffers of the tensor with, see setName
+     *  @param metrics (Optional) Counters to add the bytes transferred and
+     * the barriers recorded by the tensor to
+     *  @param hostAllocator (Optional) Host allocation callbacks to create
+     * and destroy the buffers and memory of the tensor with
+     *  @param deviceInfo (Optional) Properties of the physical device already
+     * queried by the manager, queried from the device if null
+     */
+    Tensor(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
+           std::shared_ptr<vk::Device> device,
+           void* data,
+           uint64_t elementTotalCount,
+           uint32_t elementMemorySize,
+           const TensorDataTypes& dataType,
+           const TensorTypes& tensorType = TensorTypes::eDevice,
+           const HostMemoryTypes& hostMemoryType = HostMemoryTypes::eCoherent,
+           std::shared_ptr<MemoryPool> memoryPool = nullptr,
+           std::shared_ptr<StagingRing> stagingRing = nullptr,
+           const std::vector<uint32_t>& queueFamilyIndices = {},
+           std::shared_ptr<DebugUtils> debugUtils = nullptr,
+           std::shared_ptr<Metrics> metrics = nullptr,
+           std::shared_ptr<HostAllocator> hostAllocator = nullptr,
+           std::shared_ptr<DeviceInfo> deviceInfo = nullptr);
+
+    /**
+     *  Constructor for a view that aliases a range of elements of a parent
+     * tensor. The view shares the buffers and memory of the parent without
+     * copying, and exposes its own offset and size to descriptors, copies and
+     * barriers. The view holds a reference to the parent, which cannot be
+     * reallocated while the view exists, and is destroyed along with the
+     * parent if the parent is destroyed explicitly.
+     *
+     *  @param parent Tensor that owns the memory aliased by the view
+     *  @param offset Index of the first element of the parent in the view
+     *  @param count Number of elements of the view
+     */
+    Tensor(std::shared_ptr<Tensor> parent, uint64_t offset, uint64_t count);
+
+    /**
+     *  Constructor for a tensor of type eImage, holding its data in a 2D
+     * image with optimal tiling instead of a buffer. Shaders access it as a
+     * storage image with imageLoad and imageStore, whose caches are laid out
+     * for 2D locality, and the image can be sampled by a renderer sharing
+     * the device. The elements are stored in row major order with the
+     * channels of a texel interleaved, and the format is derived from the
+     * data type and the number of channels, see imageFormat. The image is
+     * kept in the general layout, and its contents are undefined until it
+     * is synced with OpTensorSyncDevice or filled with OpTensorFill.
+     *
+     *  @param physicalDevice The physical device to use to fetch properties
+     *  @param device The device to use to create the image and memory from
+     *  @param data Data of width * height * channels elements, or null to
+     * leave the host data uninitialised
+     *  @param width Width of the image in texels
+     *  @param height Height of the image in texels
+     *  @param channels Number of channels of a texel, which is 1, 2 or 4
+     *  @param dataType The data type of the channels
+     *  @param hostMemoryType Type of the host visible staging memory
+     *  @param memoryPool (Optional) Pool to sub-allocate the memory from
+     *  @param queueFamilyIndices (Optional) Queue families the image is
+     * accessed from, see the data constructor
+     *  @param debugUtils (Optional) Functions of VK_EXT_debug_utils to name
+     * the image and buffer of the tensor with, see setName
+     *  @param metrics (Optional) Counters to add the bytes transferred and
+     * the barriers recorded by the tensor to
+     *  @param hostAllocator (Optional) Host allocation callbacks to create
+     * and destroy the image, buffer and memory of the tensor with
+     *  @param deviceInfo (Optional) Properties of the physical device already
+     * queried by the manager, queried from the device if null
+     */
+    Tensor(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
+           std::shared_ptr<vk::Device> device,
+           void* data,
+           uint32_t width,
+           uint32_t height,
+           uint32_t channels,
+           const TensorDataTypes& dataType,
+           const HostMemoryTypes& hostMemoryType = HostMemoryTypes::eCoherent,
+           std::shared_ptr<MemoryPool> memoryPool = nullptr,
+           const std::vector<uint32_t>& queueFamilyIndices = {},
+           std::shared_ptr<DebugUtils> debugUtils = nullptr,
+           std::shared_ptr<Metrics> metrics = nullptr,
+           std::shared_ptr<HostAllocator> hostAllocator = nullptr,
+           std::shared_ptr<DeviceInfo> deviceInfo = nullptr);
+
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+    /**
+     *  Constructor importing the memory of an Android hardware buffer, such
+     * as a camera or neural network input frame, so shaders access it
+     * without copying it through host memory. The buffer must have the
+     * AHARDWAREBUFFER_FORMAT_BLOB format and the
+     * AHARDWAREBUFFER_USAGE_GPU_DATA_BUFFER usage, and its width in bytes
+     * sets the size of the tensor. The tensor is of type eHost when the
+     * memory can be mapped, which is the case for buffers allocated with CPU
+     * usage, and of type eStorage otherwise. It holds a reference to the
+     * hardware buffer until it is destroyed, and cannot be rebuilt.
+     *
+     *  @param physicalDevice The physical device to use to fetch properties
+     *  @param device The device to import the memory with
+     *  @param hardwareBuffer The hardware buffer to import
+     *  @param dataType The data type of the elements of the buffer
+     *  @param memoryPool Pool with hardware buffer import enabled, see
+     * MemoryPool::enableHardwareBufferImport
+     *  @param queueFamilyIndices (Optional) Queue families the buffer is
+     * accessed from, see the data constructor
+     *  @param debugUtils (Optional) Functions of VK_EXT_debug_utils to name
+     * the buffer of the tensor with, see setName
+     *  @param metrics (Optional) Counters to add the bytes transferred and
+     * the barriers recorded by the tensor to
+     *  @param hostAllocator (Optional) Host allocation callbacks to create
+     * and destroy the buffer of the tensor with
+     *  @param deviceInfo (Optional) Properties of the physical device already
+     * queried by the manager, queried from the device if null
+     */
+    Tensor(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
+           std::shared_ptr<vk::Device> device,
+           AHardwareBuffer* hardwareBuffer,
+           const TensorDataTypes& dataType,
+           std::shared_ptr<MemoryPool> memoryPool,
+           const std::vector<uint32_t>& queueFamilyIndices = {},
+           std::shared_ptr<DebugUtils> debugUtils = nullptr,
+           std::shared_ptr<Metrics> metrics = nullptr,
+           std::shared_ptr<HostAllocator> hostAllocator = nullptr,
+           std::shared_ptr<DeviceInfo> deviceInfo = nullptr);
+
+    /**
+     * Retrieve the Android hardware buffer the memory of the tensor was
+     * imported from.
+     *
+     * @return The hardware buffer, null if the tensor was not created from
+     * one
+     */
+    AHardwareBuffer* hardwareBuffer();
+#endif
+
+    /**
+     * Destructor which is in charge of freeing vulkan resources unless they
+     * have been provided externally.
+     */
+    virtual ~Tensor();
+
+    /**
+     * Function to trigger reinitialisation of the tensor buffer and memory with
+     * new data as well as new potential device type. Similar to std::vector,
+     * the buffers and memory are kept when the new data fits within the
+     * capacity of the tensor, in which case only the size and data are
+     * updated. Sequences recorded with the tensor must not be running during
+     * a rebuild, and record their operations again when they are next
+     * submitted. Algorithms bound to the tensor then rewrite their descriptor
+     * set in place, so no sequence that recorded them may be running at that
+     * point either. Tensors aliased by views can only be rebuilt within their
+     * capacity.
+     *
+     * @param data Pointer to the data to initialise the tensor with, which
+     * can be null to leave the memory uninitialised
+     * @param elementTotalCount Number of elements of the tensor
+     * @param elementMemorySize Size in bytes of a single element
+     */
+    void rebuild(void* data,
+                 uint64_t elementTotalCount,
+                 uint32_t elementMemorySize);
+
+    /**
+     * Grows the capacity of the tensor to fit at least the number of elements
+     * provided, so later rebuilds up to that size keep the same buffers. The
+     * host data is preserved, but the device memory is reallocated without
+     * copying its contents. Does nothing if the capacity is already enough.
+     * Sequences recorded with the tensor are subject to the same
+     * restrictions as for rebuild. Tensors aliased by views cannot grow.
+     *
+     * @param elementCapacity Number of elements to reserve memory for
+     */
+    void reserve(uint64_t elementCapacity);
+
+    /**
+     * Returns the number of elements the buffers and memory of the tensor can
+     * hold, which is never smaller than the size of the tensor.
+     *
+     * @return Unsigned integer representing the capacity in elements
+     */
+    uint64_t capacity();
+
+    /**
+     * Returns a counter incremented whenever the size or buffers of the
+     * tensor change, which allows the algorithms bound to the tensor to find
+     * out whether their descriptors have to be refreshed.
+     *
+     * @return Unsigned integer identifying the current buffers and size
+     */
+    uint64_t generation();
+
+    /**
+     * Destroys and frees the GPU resources which include the buffer and memory.
+     * The views aliasing the tensor are destroyed first.
+     */
+    void destroy();
+
+    /**
+     * Check whether tensor is initialized based on the created gpu resources.
+     *
+     * @returns Boolean stating whether tensor is initialized
+     */
+    bool isInit();
+
+    /**
+     * Retrieve the tensor type of the Tensor
+     *
+     * @return Tensor type of tensor
+     */
+    TensorTypes tensorType();
+
+    /**
+     * Retrieve the type of host visible memory requested for the Tensor
+     *
+     * @return Host memory type of tensor
+     */
+    HostMemoryTypes hostMemoryType();
+
+    /**
+     * Check whether the tensor is a view aliasing the memory of a parent
+     * tensor.
+     *
+     * @return Boolean stating whether the tensor is a view
+     */
+    bool isView();
+
+    /**
+     * Retrieve the tensor owning the memory a view aliases. Views of views
+     * share the same parent.
+     *
+     * @return Parent tensor of the view, null if the tensor is not a view
+     */
+    std::shared_ptr<Tensor> parent();
+
+    /**
+     * Check whether the host visible memory of the tensor is the data
+     * pointer it was created with, imported via VK_EXT_external_memory_host.
+     *
+     * @return Boolean stating whether the host memory was imported
+     */
+    bool isHostMemoryImported();
+
+    /**
+     * Retrieve the offset in bytes of the tensor data within its buffers,
+     * which is only non-zero for views.
+     *
+     * @return Offset of the tensor in its buffers
+     */
+    vk::DeviceSize bufferOffset();
+
+    /**
+     * Retrieve the device address of the tensor data, offset for views,
+     * which shaders dereference through GL_EXT_buffer_reference. This
+     * requires the manager to be created with VK_KHR_buffer_device_address
+     * in its desired extensions, and is not supported by image tensors.
+     *
+     * @return Device address of the first element of the tensor
+     */
+    vk::DeviceAddress deviceAddress();
+
+    /**
+     * Retrieve the queue families the buffers of the tensor are shared
+     * between with concurrent sharing.
+     *
+     * @return Distinct queue family indices, empty if the buffers are
+     * exclusive to a single queue family
+     */
+    const std::vector<uint32_t>& queueFamilyIndices();
+
+    /**
+     * Retrieve the image holding the data of a tensor of type eImage, which
+     * is in the general layout outside of the sync and fill operations.
+     *
+     * @return The image, null if the tensor is not an image
+     */
+    std::shared_ptr<vk::Image> image();
+
+    /**
+     * Retrieve the 2D view of the whole image of a tensor of type eImage,
+     * which shaders and renderers bind the image with.
+     *
+     * @return The image view, null if the tensor is not an image
+     */
+    std::shared_ptr<vk::ImageView> imageView();
+
+    /**
+     * Retrieve the extent of the image of a tensor of type eImage.
+     *
+     * @return Width and height of the image in texels, with a depth of 1
+     */
+    vk::Extent3D imageExtent();
+
+    /**
+     * Retrieve the format of the image of a tensor of type eImage.
+     *
+     * @return Format of the image, eUndefined if the tensor is not an image
+     */
+    vk::Format imageFormat();
+
+    /**
+     * Returns the format of the images holding channels of a data type. 8
+     * and 16 bit unsigned and signed integers map to normalized formats
+     * read as floats by shaders, except eInt16 which stays an integer, and
+     * other types map to the format of the same bit width. Booleans and
+     * doubles have no image format.
+     *
+     * @param dataType The data type of the channels
+     * @param channels Number of channels of a texel, which is 1, 2 or 4
+     * @return Format of the image
+     */
+    static vk::Format imageFormat(const TensorDataTypes& dataType,
+                                  uint32_t channels);
+
+    /**
+     * Check whether the tensor has a staging buffer of its own to transfer
+     * its data with, which is the case for tensors of type eDevice without a
+     * staging ring and for tensors of type eImage.
+     *
+     * @return Boolean stating whether the tensor has a staging buffer
+     */
+    bool hasStagingBuffer();
+
+    /**
+     * Sets the name of the tensor, which names its buffers through
+     * VK_EXT_debug_utils so they can be identified in captures of debugging
+     * and profiling tools. The staging buffer is named with a " (staging)"
+     * suffix, and the buffers keep the name through rebuilds. Views do not
+     * own their buffers, so their name is only stored.
+     *
+     * @param name The name of the tensor
+     */
+    void setName(const std::string& name);
+
+    /**
+     * Retrieve the name of the tensor set with setName.
+     *
+     * @return Name of the tensor, empty if it was not named
+     */
+    const std::string& name();
+
+    /**
+     * Records a copy from the memory of the tensor provided to the current
+     * thensor. This is intended to pass memory into a processing, to perform
+     * a staging buffer transfer, or to gather output (between others). Image
+     * tensors are copied whole from and to the buffers of other tensors,
+     * with tightly packed rows, which copies the output of a shader into a
+     * texture and back. Copies between two images are not supported.
+     *
+     * @param commandBuffer Vulkan Command Buffer to record the commands into
+     * @param copyFromTensor Tensor to copy the data from
+     * @param ranges Element ranges to copy, the whole tensor if empty
+     */
+    void recordCopyFrom(const vk::CommandBuffer& commandBuffer,
+                        std::shared_ptr<Tensor> copyFromTensor,
+                        const std::vector<Range>& ranges = {});
+
+    /**
+     * Records copies from the memory of the current tensor into several
+     * tensors, as recordCopyFrom does for each of them, but computing the
+     * copy regions of the ranges once and only moving their destination
+     * offset for each buffer, so broadcasting to many tensors only records
+     * the copy commands. The current tensor is skipped if it is one of the
+     * tensors provided.
+     *
+     * @param commandBuffer Vulkan Command Buffer to record the commands into
+     * @param copyToTensors Tensors to copy the data into
+     * @param ranges Element ranges to copy, the whole tensor if empty
+     */
+    void recordCopyTo(const vk::CommandBuffer& commandBuffer,
+                      const std::vector<std::shared_ptr<Tensor>>& copyToTensors,
+                      const std::vector<Range>& ranges = {});
+
+    /**
+     * Records a copy from the internal staging memory to the device memory
+     * using an optional barrier to wait for the operation. This function would
+     * only be relevant for kp::Tensors of type eDevice and eImage, where
+     * images are always copied whole.
+     *
+     * @param commandBuffer Vulkan Command Buffer to record the commands into
+     * @param ranges Element ranges to copy, the whole tensor if empty
+     */
+    void recordCopyFromStagingToDevice(const vk::CommandBuffer& commandBuffer,
+                                       const std::vector<Range>& ranges = {});
+
+    /**
+     * Records a copy from the internal device memory to the staging memory
+     * using an optional barrier to wait for the operation. This function would
+     * only be relevant for kp::Tensors of type eDevice and eImage, where
+     * images are always copied whole.
+     *
+     * @param commandBuffer Vulkan Command Buffer to record the commands into
+     * @param ranges Element ranges to copy, the whole tensor if empty
+     */
+    void recordCopyFromDeviceToStaging(const vk::CommandBuffer& commandBuffer,
+                                       const std::vector<Range>& ranges = {});
+
+    /**
+     * Records a fill of the device memory of the tensor with a repeated 32-bit
+     * value, which does not require any host data. Views must have a memory
+     * size that is a multiple of 4 bytes. Images are cleared with the value
+     * in every channel, converted to the format of the image, so the pattern
+     * is only kept as is for 32 bit formats.
+     *
+     * @param commandBuffer Vulkan Command Buffer to record the commands into
+     * @param data The 32-bit pattern to fill the memory with
+     */
+    void recordFill(const vk::CommandBuffer& commandBuffer, uint32_t data);
+
+    /**
+     * Flushes the host writes to the host visible memory of the tensor so
+     * they are available to the device. This only has an effect when the
+     * memory is not host coherent.
+     */
+    void flushMappedMemory();
+
+    /**
+     * Invalidates the host visible memory of the tensor so writes by the
+     * device are visible to the host. This only has an effect when the memory
+     * is not host coherent.
+     */
+    void invalidateMappedMemory();
+
+    /**
+     * Check whether the tensor transfers its data through a shared staging
+     * ring instead of its own staging buffer. This is only the case for
+     * kp::Tensors of type eDevice created with a staging ring.
+     *
+     * @returns Boolean stating whether the staging ring is used
+     */
+    bool usesStagingRing();
+
+    /**
+     * Staging ring the tensor transfers its data through.
+     *
+     * @returns The staging ring, or nullptr if usesStagingRing is false
+     */
+    std::shared_ptr<StagingRing> stagingRing();
+
+    /**
+     * Uploads the host data of the tensor into its device memory through the
+     * staging ring. The transfers are submitted immediately, so this is
+     * expected to be called before the commands using the tensor are
+     * submitted to the same queue.
+     *
+     * @param ranges Element ranges to upload, the whole tensor if empty
+     */
+    void syncDeviceWithStagingRing(const std::vector<Range>& ranges = {});
+
+    /**
+     * Downloads the device memory of the tensor into its host data through
+     * the staging ring, waiting until the data is available.
+     *
+     * @param ranges Element ranges to download, the whole tensor if empty
+     */
+    void syncLocalWithStagingRing(const std::vector<Range>& ranges = {});
+
+    /**
+     * Adds the bytes of element ranges to a transfer counter of the metrics
+     * the tensor was created with. The sync operations call it for every
+     * submission of the copies they record, as a command buffer recorded
+     * once can be submitted several times.
+     *
+     * @param counter The counter to add to, such as eBytesUploaded
+     * @param ranges Element ranges transferred, the whole tensor if empty
+     */
+    void countTransfer(Metrics::Counter counter,
+                       const std::vector<Range>& ranges = {});
+
+    /**
+     * Records the buffer memory barrier into the primary buffer and command
+     * buffer which ensures that relevant data transfers are carried out
+     * correctly.
+     *
+     * @param commandBuffer Vulkan Command Buffer to record the commands into
+     * @param srcAccessMask Access flags for source access mask
+     * @param dstAccessMask Access flags for destination access mask
+     * @param scrStageMask Pipeline stage flags for source stage mask
+     * @param dstStageMask Pipeline stage flags for destination stage mask
+     */
+    void recordPrimaryBufferMemoryBarrier(
+      const vk::CommandBuffer& commandBuffer,
+      vk::AccessFlags srcAccessMask,
+      vk::AccessFlags dstAccessMask,
+      vk::PipelineStageFlags srcStageMask,
+      vk::PipelineStageFlags dstStageMask);
+    /**
+     * Records the buffer memory barrier into the staging buffer and command
+     * buffer which ensures that relevant data transfers are carried out
+     * correctly.
+     *
+     * @param commandBuffer Vulkan Command Buffer to record the commands into
+     * @param srcAccessMask Access flags for source access mask
+     * @param dstAccessMask Access flags for destination access mask
+     * @param scrStageMask Pipeline stage flags for source stage mask
+     * @param dstStageMask Pipeline stage flags for destination stage mask
+     */
+    void recordStagingBufferMemoryBarrier(
+      const vk::CommandBuffer& commandBuffer,
+      vk::AccessFlags srcAccessMask,
+      vk::AccessFlags dstAccessMask,
+      vk::PipelineStageFlags srcStageMask,
+      vk::PipelineStageFlags dstStageMask);
+
+    /**
+     * Constructs a buffer memory barrier for the range of the primary buffer
+     * used by the tensor, so barriers on several tensors can be recorded with
+     * a single pipeline barrier command.
+     *
+     * @param srcAccessMask Access flags for source access mask
+     * @param dstAccessMask Access flags for destination access mask
+     * @return Buffer memory barrier on the primary buffer
+     */
+    vk::BufferMemoryBarrier createPrimaryBufferMemoryBarrier(
+      vk::AccessFlags srcAccessMask,
+      vk::AccessFlags dstAccessMask);
+    /**
+     * Constructs a buffer memory barrier for the range of the staging buffer
+     * used by the tensor, so barriers on several tensors can be recorded with
+     * a single pipeline barrier command.
+     *
+     * @param srcAccessMask Access flags for source access mask
+     * @param dstAccessMask Access flags for destination access mask
+     * @return Buffer memory barrier on the staging buffer
+     */
+    vk::BufferMemoryBarrier createStagingBufferMemoryBarrier(
+      vk::AccessFlags srcAccessMask,
+      vk::AccessFlags dstAccessMask);
+    /**
+     * Constructs an image memory barrier for the image of a tensor of type
+     * eImage, which stays in the general layout. Barriers on the primary
+     * memory of images must be recorded with it instead of a buffer memory
+     * barrier.
+     *
+     * @param srcAccessMask Access flags for source access mask
+     * @param dstAccessMask Access flags for destination access mask
+     * @param oldLayout Layout of the image before the barrier
+     * @return Image memory barrier on the image
+     */
+    vk::ImageMemoryBarrier createImageMemoryBarrier(
+      vk::AccessFlags srcAccessMask,
+      vk::AccessFlags dstAccessMask,
+      vk::ImageLayout oldLayout = vk::ImageLayout::eGeneral);
+
+    /**
+     * Constructs a vulkan descriptor buffer info which can be used to specify
+     * and reference the underlying buffer component of the tensor without
+     * exposing it.
+     *
+     * @return Descriptor buffer info with own buffer
+     */
+    vk::DescriptorBufferInfo constructDescriptorBufferInfo();
+
+    /**
+     * Constructs a vulkan descriptor image info referencing the image view
+     * of a tensor of type eImage in the general layout.
+     *
+     * @return Descriptor image info with own image view
+     */
+    vk::DescriptorImageInfo constructDescriptorImageInfo();
+
+    /**
+     * Retrieve the type of descriptor the tensor is bound with by algorithms,
+     * which is a uniform buffer for uniform tensors, a storage image for
+     * image tensors and a storage buffer otherwise.
+     *
+     * @return Descriptor type of the buffer of the tensor
+     */
+    vk::DescriptorType descriptorType();
+
+    /**
+     * Returns the size/magnitude of the Tensor, which will be the total number
+     * of elements across all dimensions
+     *
+     * @return Unsigned integer representing the total number of elements
+     */
+    uint64_t size();
+
+    /**
+     * Returns the total size of a single element of the respective data type
+     * that this tensor holds.
+     *
+     * @return Unsigned integer representing the memory of a single element of
+     * the respective data type.
+     */
+    uint32_t dataTypeMemorySize();
+
+    /**
+     * Returns the total memory size of the data contained by the Tensor object
+     * which would equate to (this->size() * this->dataTypeMemorySize())
+     *
+     * @return Unsigned integer representing the memory of a single element of
+     * the respective data type.
+     */
+    vk::DeviceSize memorySize();
+
+    /**
+     * Returns the size of the primary buffer owned by the tensor, which is
+     * zero for views as they share the buffer of their parent.
+     *
+     * @return Size in bytes of the primary buffer of the tensor
+     */
+    vk::DeviceSize primaryMemorySize();
+
+    /**
+     * Returns the size of the staging buffer owned by the tensor, which is
+     * zero for views and for tensors without a staging buffer.
+     *
+     * @return Size in bytes of the staging buffer of the tensor
+     */
+    vk::DeviceSize stagingMemorySize();
+
+    /**
+     * Returns the size in bytes of a single element of the data type provided.
+     *
+     * @param dataType The data type of the element
+     * @return Size in bytes of an element of the data type
+     */
+    static uint32_t elementMemorySize(const TensorDataTypes& dataType);
+
+    /**
+     * Retrieve the data type of the tensor (host, device, storage)
+     *
+     * @return Data type of tensor of type kp::Tensor::TensorDataTypes
+     */
+    TensorDataTypes dataType();
+
+    /**
+     * Retrieve the raw data via the pointer to the memory that contains the raw
+     * memory of this current tensor. This tensor gets changed to a nullptr when
+     * the Tensor is removed.
+     *
+     * @return Pointer to raw memory containing raw bytes data of Tensor.
+     */
+    void* rawData();
+
+    /**
+     * Sets / resets the data of the tensor which is directly done on the GPU
+     * host visible memory available by the tensor. The whole tensor is marked
+     * as dirty.
+     */
+    void setRawData(const void* data);
+
+    /**
+     * Sets the data of a range of elements of the tensor, marking only that
+     * range as dirty.
+     *
+     * @param data Pointer to the data of the elements in the range
+     * @param offset Index of the first element to set
+     * @param count Number of elements to set
+     */
+    void setRawData(const void* data, uint64_t offset, uint64_t count);
+
+    /**
+     * Marks a range of elements as modified on the host, for when the data is
+     * written directly through the pointer returned by rawData or data.
+     *
+     * @param offset Index of the first element modified
+     * @param count Number of elements modified
+     */
+    void markDirty(uint64_t offset, uint64_t count);
+
+    /**
+     * Retrieve the ranges of elements modified through setRawData or
+     * markDirty since the ranges were last cleared. Overlapping and adjacent
+     * ranges are merged, so they can be passed directly to the sync and copy
+     * operations.
+     *
+     * @return Sorted ranges of elements modified on the host
+     */
+    const std::vector<Range>& dirtyRanges();
+
+    /**
+     * Clears the ranges of elements marked as dirty, usually once they have
+     * been synced to the device.
+     */
+    void clearDirtyRanges();
+
+    /**
+     * Template to return the pointer data converted by specific type, which
+     * would be any of the supported types including float, double, int32,
+     * uint32 and bool.
+     *
+     * @return Pointer to raw memory containing raw bytes data of Tensor.
+     */
+    template<typename T>
+    T* data()
+    {
+        return (T*)this->mRawData;
+    }
+
+    /**
+     * Template to get the data of the current tensor as a vector of specific
+     * type, which would be any of the supported types including float, double,
+     * int32, uint32 and bool.
+     *
+     * @return Vector of type provided by template.
+     */
+    template<typename T>
+    std::vector<T> vector()
+    {
+        return { (T*)this->mRawData, ((T*)this->mRawData) + this->size() };
+    }
+
+  protected:
+    // -------------- ALWAYS OWNED RESOURCES
+    TensorTypes mTensorType;
+    HostMemoryTypes mHostMemoryType;
+    TensorDataTypes mDataType;
+    uint64_t mSize;
+    uint64_t mCapacity = 0;
+    uint64_t mGeneration = 0;
+    uint32_t mDataTypeMemorySize;
+    void* mRawData = nullptr;
+    std::vector<Range> mDirtyRanges;
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<vk::PhysicalDevice> mPhysicalDevice;
+    std::shared_ptr<vk::Device> mDevice;
+    std::shared_ptr<MemoryPool> mMemoryPool;
+    std::shared_ptr<StagingRing> mStagingRing;
+    std::shared_ptr<Tensor> mParent;
+    // Live views aliasing the memory of the tensor, which hold a reference
+    // to it and remove themselves when they are destroyed
+    std::vector<Tensor*> mViews;
+    std::vector<uint32_t> mQueueFamilyIndices;
+    std::shared_ptr<DebugUtils> mDebugUtils;
+    std::shared_ptr<Metrics> mMetrics;
+    std::shared_ptr<HostAllocator> mHostAllocator;
+    std::shared_ptr<DeviceInfo> mDeviceInfo;
+
+    // -------------- OPTIONALLY OWNED RESOURCES
+    std::shared_ptr<vk::Buffer> mPrimaryBuffer;
+    bool mFreePrimaryBuffer = false;
+    std::shared_ptr<vk::Buffer> mStagingBuffer;
+    bool mFreeStagingBuffer = false;
+    std::shared_ptr<vk::DeviceMemory> mPrimaryMemory;
+    bool mFreePrimaryMemory = false;
+    std::shared_ptr<vk::DeviceMemory> mStagingMemory;
+    bool mFreeStagingMemory = false;
+    MemoryPool::Allocation mPrimaryAllocation;
+    MemoryPool::Allocation mStagingAllocation;
+    bool mFreeRawData = false;
+    bool mHostMemoryCoherent = true;
+    bool mHostMemoryImported = false;
+    std::shared_ptr<vk::Image> mImage;
+    std::shared_ptr<vk::ImageView> mImageView;
+    bool mFreeImage = false;
+    vk::Extent3D mImageExtent;
+    uint32_t mImageChannels = 0;
+    vk::DeviceSize mBufferOffset = 0;
+    std::string mName;
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+    AHardwareBuffer* mHardwareBuffer = nullptr;
+#endif
+
+    void allocateMemoryCreateGPUResources(
+      void* data); // Creates the vulkan buffer
+    void createBuffer(
+      std::shared_ptr<vk::Buffer> buffer,
+      vk::BufferUsageFlags bufferUsageFlags,
+      vk::ExternalMemoryHandleTypeFlags externalHandleTypes = {});
+    bool importBindHostMemory(std::shared_ptr<vk::Buffer> buffer,
+                              std::shared_ptr<vk::DeviceMemory> memory,
+                              MemoryPool::Allocation& allocation,
+                              vk::BufferUsageFlags bufferUsageFlags,
+                              void* data);
+    void createImage();
+    void allocateBindMemory(std::shared_ptr<vk::Buffer> buffer,
+                            std::shared_ptr<vk::DeviceMemory> memory,
+                            MemoryPool::Allocation& allocation,
+                            vk::MemoryPropertyFlags memoryPropertyFlags);
+    vk::DeviceSize allocateMemory(
+      std::shared_ptr<vk::DeviceMemory> memory,
+      MemoryPool::Allocation& allocation,
+      const vk::MemoryRequirements& memoryRequirements,
+      vk::MemoryPropertyFlags memoryPropertyFlags);
+    int32_t findMemoryTypeIndex(
+      const vk::PhysicalDeviceMemoryProperties& memoryProperties,
+      const vk::MemoryRequirements& memoryRequirements,
+      const vk::MemoryPropertyFlags& memoryPropertyFlags);
+    void recordCopyBuffer(const vk::CommandBuffer& commandBuffer,
+                          std::shared_ptr<vk::Buffer> bufferFrom,
+                          std::shared_ptr<vk::Buffer> bufferTo,
+                          vk::DeviceSize bufferFromOffset,
+                          const std::vector<Range>& ranges);
+    void recordImageCopy(const vk::CommandBuffer& commandBuffer,
+                         const vk::Buffer& buffer,
+                         vk::DeviceSize bufferOffset,
+                         bool toImage);
+    vk::BufferMemoryBarrier createBufferMemoryBarrier(
+      const vk::Buffer& buffer,
+      vk::AccessFlags srcAccessMask,
+      vk::AccessFlags dstAccessMask);
+    void recordBufferMemoryBarrier(const vk::CommandBuffer& commandBuffer,
+                                   const vk::Buffer& buffer,
+                                   vk::AccessFlags srcAccessMask,
+                                   vk::AccessFlags dstAccessMask,
+                                   vk::PipelineStageFlags srcStageMask,
+                                   vk::PipelineStageFlags dstStageMask);
+    void recordImageMemoryBarrier(const vk::CommandBuffer& commandBuffer,
+                                  vk::AccessFlags srcAccessMask,
+                                  vk::AccessFlags dstAccessMask,
+                                  vk::PipelineStageFlags srcStageMask,
+                                  vk::PipelineStageFlags dstStageMask,
+                                  vk::ImageLayout oldLayout);
+
+    // Private util functions
+    std::vector<vk::BufferCopy> copyRegions(const std::vector<Range>& ranges,
+                                            vk::DeviceSize srcOffset,
+                                            vk::DeviceSize dstOffset);
+    vk::BufferUsageFlags getPrimaryBufferUsageFlags();
+    vk::MemoryPropertyFlags getPrimaryMemoryPropertyFlags();
+    vk::BufferUsageFlags getStagingBufferUsageFlags();
+    vk::MemoryPropertyFlags getStagingMemoryPropertyFlags();
+    vk::MemoryPropertyFlags getHostVisibleMemoryPropertyFlags();
+    vk::DeviceSize capacityMemorySize();
+    void reallocate(void* data, uint64_t elementCapacity);
+
+    void mapRawData();
+    void unmapRawData();
+    void setObjectNames();
+    void setQueueFamilyIndices(const std::vector<uint32_t>& queueFamilyIndices);
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+    void importHardwareBuffer();
+#endif
+    vk::MappedMemoryRange hostVisibleMemoryRange();
+};
+
+template<typename T>
+class TensorT : public Tensor
+{
+
+  public:
+    TensorT(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
+            std::shared_ptr<vk::Device> device,
+            const std::vector<T>& data,
+            const TensorTypes& tensorType = TensorTypes::eDevice,
+            const HostMemoryTypes& hostMemoryType = HostMemoryTypes::eCoherent,
+            std::shared_ptr<MemoryPool> memoryPool = nullptr,
+            std::shared_ptr<StagingRing> stagingRing = nullptr,
+            const std::vector<uint32_t>& queueFamilyIndices = {},
+            std::shared_ptr<DebugUtils> debugUtils = nullptr,
+            std::shared_ptr<Metrics> metrics = nullptr,
+            std::shared_ptr<HostAllocator> hostAllocator = nullptr,
+            std::shared_ptr<DeviceInfo> deviceInfo = nullptr)
+      : Tensor(physicalDevice,
+               device,
+               (void*)data.data(),
+               data.size(),
+               sizeof(T),
+               this->dataType(),
+               tensorType,
+               hostMemoryType,
+               memoryPool,
+               stagingRing,
+               queueFamilyIndices,
+               debugUtils,
+               metrics,
+               hostAllocator,
+               deviceInfo)
+    {
+        KP_LOG_DEBUG("Kompute TensorT constructor with data size {}",
+                     data.size());
+    }
+
+    TensorT(std::shared_ptr<TensorT<T>> parent, uint64_t offset, uint64_t count)
+      : Tensor(parent, offset, count)
+    {
+        KP_LOG_DEBUG("Kompute TensorT view constructor with offset {} and "
+                     "size {}",
+                     offset,
+                     count);
+    }
+
+    ~TensorT() { KP_LOG_DEBUG("Kompute TensorT destructor"); }
+
+    T* data() { return (T*)this->mRawData; }
+
+    std::vector<T> vector()
+    {
+        return { (T*)this->mRawData, ((T*)this->mRawData) + this->size() };
+    }
+
+    T& operator[](int index) { return *(((T*)this->mRawData) + index); }
+
+    void setData(const std::vector<T>& data)
+    {
+
+        KP_LOG_DEBUG("Kompute TensorT setting data with data size {}",
+                     data.size());
+
+        if (data.size() != this->mSize) {
+            throw std::runtime_error(
+              "Kompute TensorT Cannot set data of different sizes");
+        }
+
+        Tensor::setRawData(data.data());
+    }
+
+    TensorDataTypes dataType();
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+namespace kp {
+
+/**
+ * Sparse matrix in compressed sparse row (CSR) format, made of three
+ * tensors: the row pointers, holding the index of the first non zero of each
+ * row followed by the number of non zeros, the column index of each non zero
+ * and the value of each non zero. Only the non zeros are stored and
+ * transferred, which is what makes very sparse matrices cheaper than dense
+ * tensors.
+ *
+ * The tensors are synced like any other tensor, for example recording
+ * OpTensorSyncDevice with the tensors returned by tensors().
+ */
+class SparseTensor
+{
+  public:
+    /**
+     * Constructor from the tensors of a CSR matrix, which are not copied.
+     *
+     * @param rowPointers Unsigned int tensor of at least rows + 1 elements
+     * @param columnIndices Unsigned int tensor of the column of each non zero
+     * @param values Float tensor of the value of each non zero
+     * @param rows The number of rows of the matrix
+     * @param columns The number of columns of the matrix
+     * @param nonZeroCount The number of non zeros of the matrix, which the
+     * column indices and values tensors hold at least, or a single element
+     * for matrices without non zeros
+     */
+    SparseTensor(std::shared_ptr<Tensor> rowPointers,
+                 std::shared_ptr<Tensor> columnIndices,
+                 std::shared_ptr<Tensor> values,
+                 uint32_t rows,
+                 uint32_t columns,
+                 uint32_t nonZeroCount);
+
+    /**
+     * Destructor which does not destroy the tensors, which are owned by the
+     * manager that created them.
+     */
+    ~SparseTensor();
+
+    /**
+     * Retrieve the row pointers tensor.
+     *
+     * @return Tensor of the index of the first non zero of each row
+     */
+    std::shared_ptr<Tensor> rowPointers();
+
+    /**
+     * Retrieve the column indices tensor.
+     *
+     * @return Tensor of the column of each non zero
+     */
+    std::shared_ptr<Tensor> columnIndices();
+
+    /**
+     * Retrieve the values tensor.
+     *
+     * @return Tensor of the value of each non zero
+     */
+    std::shared_ptr<Tensor> values();
+
+    /**
+     * Retrieve the tensors of the matrix, to sync them or bind them to an
+     * algorithm.
+     *
+     * @return The row pointers, column indices and values tensors
+     */
+    std::vector<std::shared_ptr<Tensor>> tensors();
+
+    /**
+     * Retrieve the number of rows of the matrix.
+     *
+     * @return Number of rows
+     */
+    uint32_t rows();
+
+    /**
+     * Retrieve the number of columns of the matrix.
+     *
+     * @return Number of columns
+     */
+    uint32_t columns();
+
+    /**
+     * Retrieve the number of non zeros of the matrix.
+     *
+     * @return Number of non zeros
+     */
+    uint32_t nonZeroCount();
+
+    /**
+     * Checks that host arrays describe a valid CSR matrix, with row pointers
+     * starting at 0, never decreasing and ending at the number of non zeros,
+     * and column indices within the columns, so shaders never read out of
+     * the bounds of the tensors.
+     *
+     * @param rows The number of rows of the matrix
+     * @param columns The number of columns of the matrix
+     * @param nonZeroCount The number of non zeros of the matrix
+     * @param rowPointers Array of rows + 1 row pointers
+     * @param columnIndices Array of nonZeroCount column indices
+     */
+    static void validate(uint32_t rows,
+                         uint32_t columns,
+                         uint32_t nonZeroCount,
+                         const uint32_t* rowPointers,
+                         const uint32_t* columnIndices);
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<Tensor> mRowPointers;
+    std::shared_ptr<Tensor> mColumnIndices;
+    std::shared_ptr<Tensor> mValues;
+
+    uint32_t mRows;
+    uint32_t mColumns;
+    uint32_t mNonZeroCount;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mutex>
+
+// Descriptor sets and descriptors of each type in a pool of the allocator
+#ifndef KOMPUTE_DESCRIPTOR_POOL_MAX_SETS
+#define KOMPUTE_DESCRIPTOR_POOL_MAX_SETS 256
+#endif
+#ifndef KOMPUTE_DESCRIPTOR_POOL_DESCRIPTORS
+#define KOMPUTE_DESCRIPTOR_POOL_DESCRIPTORS 1024
+#endif
+
+namespace kp {
+
+/**
+ * Growable allocator of descriptor sets shared by the algorithms created by
+ * a manager.
+ *
+ * Instead of creating a descriptor pool for every algorithm, the sets are
+ * allocated from large pools created with eFreeDescriptorSet, so the sets of
+ * destroyed algorithms are returned to their pool and reused. A new pool is
+ * created whenever none of the existing ones can fit a set.
+ */
+class DescriptorAllocator
+{
+  public:
+    /**
+     * Descriptor set handed out by the allocator, together with the pool it
+     * was allocated from which is owned by the allocator.
+     */
+    struct Allocation
+    {
+        vk::DescriptorPool pool;
+        vk::DescriptorSet set;
+    };
+
+    /**
+     * Constructor for the allocator of the descriptor sets of a device.
+     *
+     * @param device The device the descriptor pools are created with
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy the descriptor pools with
+     */
+    DescriptorAllocator(std::shared_ptr<vk::Device> device,
+                        std::shared_ptr<HostAllocator> hostAllocator = nullptr);
+
+    /**
+     * Destructor which destroys the descriptor pools.
+     */
+    ~DescriptorAllocator();
+
+    /**
+     * Allocates a descriptor set from the first pool able to fit it,
+     * creating a new pool if none can.
+     *
+     * @param layout The layout of the descriptor set
+     * @param storageBufferCount The storage buffer descriptors of the layout
+     * @param uniformBufferCount The uniform buffer descriptors of the layout
+     * @param storageImageCount The storage image descriptors of the layout
+     * @return The allocated descriptor set and its pool
+     */
+    Allocation allocate(const vk::DescriptorSetLayout& layout,
+                        uint32_t storageBufferCount,
+                        uint32_t uniformBufferCount,
+                        uint32_t storageImageCount = 0);
+
+    /**
+     * Returns a descriptor set to its pool. Command buffers using the set
+     * must have completed.
+     *
+     * @param allocation The allocation returned by allocate
+     */
+    void free(const Allocation& allocation);
+
+    /**
+     * Returns the number of descriptor pools created by the allocator.
+     *
+     * @return Number of descriptor pools
+     */
+    uint32_t poolCount();
+
+    /**
+     * Returns the number of descriptor sets currently allocated.
+     *
+     * @return Number of allocated descriptor sets
+     */
+    uint32_t allocatedSetCount();
+
+    /**
+     * Destroys the descriptor pools, which frees all the descriptor sets
+     * allocated from them.
+     */
+    void destroy();
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<vk::Device> mDevice;
+    std::shared_ptr<HostAllocator> mHostAllocator;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<vk::DescriptorPool> mPools;
+    uint32_t mAllocatedSetCount = 0;
+    std::mutex mMutex;
+
+    vk::DescriptorPool createPool(uint32_t storageBufferCount,
+                                  uint32_t uniformBufferCount,
+                                  uint32_t storageImageCount);
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace kp {
+
+/**
+ * Content addressed cache of the immutable pipeline resources of algorithms,
+ * shared by the algorithms created by a manager.
+ *
+ * Algorithms built from the same SPIR-V, specialization constants, push
+ * constant range and descriptor types share the same shader module,
+ * descriptor set layout, pipeline layout and pipeline, and only own their
+ * descriptor pool and descriptor set. The resources are owned by the cache
+ * and are only destroyed through prune or destroy.
+ */
+class ShaderCache
+{
+  public:
+    /**
+     * Pipeline resources of an entry of the cache, which must not be
+     * destroyed by the algorithms using them.
+     */
+    struct Entry
+    {
+        std::shared_ptr<vk::ShaderModule> shaderModule;
+        std::shared_ptr<vk::DescriptorSetLayout> descriptorSetLayout;
+        std::shared_ptr<vk::PipelineLayout> pipelineLayout;
+        std::shared_ptr<vk::Pipeline> pipeline;
+    };
+
+    /**
+     * Constructor for the cache of the pipeline resources of a device.
+     *
+     * @param device The device the resources are created with
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy the resources of the entries with
+     */
+    ShaderCache(std::shared_ptr<vk::Device> device,
+                std::shared_ptr<HostAllocator> hostAllocator = nullptr);
+
+    /**
+     * Destructor which destroys the resources of all the entries.
+     */
+    ~ShaderCache();
+
+    /**
+     * Builds the key of the resources of an algorithm, made of a hash of the
+     * SPIR-V together with the bytes of the specialization constants, the
+     * size of the push constant range, the descriptor types of the bindings
+     * and the specialized local size.
+     *
+     * @param spirv The SPIR-V of the shader
+     * @param specializationConstantsData The specialization constant bytes
+     * @param specializationConstantsDataTypeMemorySize The size in bytes of
+     * each specialization constant
+     * @param specializationConstantsSize The number of specialization
+     * constants
+     * @param pushConstantsRangeSize The size in bytes of the push constants
+     * @param descriptorTypes The descriptor type of each binding
+     * @param localSizeX The local size x specialized by the algorithm, or 0
+     * @return The key identifying the resources in the cache
+     */
+    static std::string key(const std::vector<uint32_t>& spirv,
+                           const void* specializationConstantsData,
+                           uint32_t specializationConstantsDataTypeMemorySize,
+                           uint32_t specializationConstantsSize,
+                           uint32_t pushConstantsRangeSize,
+                           const std::vector<vk::DescriptorType>& descriptorTypes,
+                           uint32_t localSizeX = 0);
+
+    /**
+     * Looks up the resources stored with the key.
+     *
+     * @param key The key built with ShaderCache::key
+     * @param entry The entry to fill with the resources if found
+     * @return Boolean stating whether the resources were found
+     */
+    bool find(const std::string& key, Entry& entry);
+
+    /**
+     * Stores resources with the key, transferring their ownership to the
+     * cache. If resources were stored for the key meanwhile, the ones
+     * provided are destroyed and the entry is replaced with the stored ones.
+     *
+     * @param key The key built with ShaderCache::key
+     * @param entry The resources to store, replaced with the stored ones
+     */
+    void insert(const std::string& key, Entry& entry);
+
+    /**
+     * Destroys the resources of the entries no longer used by any algorithm.
+     */
+    void prune();
+
+    /**
+     * Returns the number of entries of the cache.
+     *
+     * @return Number of entries
+     */
+    uint32_t size();
+
+    /**
+     * Destroys the resources of all the entries. Algorithms using them must
+     * have been destroyed.
+     */
+    void destroy();
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<vk::Device> mDevice;
+    std::shared_ptr<HostAllocator> mHostAllocator;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::unordered_map<std::string, Entry> mEntries;
+    std::mutex mMutex;
+
+    void destroyEntry(const Entry& entry);
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace kp {
+
+/**
+ * Compiles GLSL or HLSL compute shaders into SPIR-V within the process
+ * through the glslang library, which is linked when Kompute is built with
+ * KOMPUTE_OPT_ENABLE_SHADER_COMPILER.
+ *
+ * The SPIR-V is cached in memory, and optionally on disk, by a hash of the
+ * source together with the compile options, so a shader generated again
+ * with the same source is only compiled once. The on-disk cache is also
+ * read when the compiler is not linked, so shaders compiled ahead of time
+ * can be shipped in the cache directory. All the functions are thread safe.
+ */
+class Shader
+{
+  public:
+    /**
+     * Language of the source of a shader.
+     */
+    enum class Language
+    {
+        eGlsl = 0,
+        eHlsl = 1,
+    };
+
+    /**
+     * Compiles a compute shader into SPIR-V for the Vulkan version of
+     * KOMPUTE_VK_API_VERSION, or returns the cached SPIR-V of the same
+     * source and options.
+     *
+     * @param source The source of the compute shader
+     * @param definitions The preprocessor definitions as pairs of names and
+     * values, defined in order before the source
+     * @param language The language of the source
+     * @param entryPoint The name of the entry point function
+     * @return The compiled SPIR-V
+     */
+    static std::vector<uint32_t> compile(
+      const std::string& source,
+      const std::vector<std::pair<std::string, std::string>>& definitions = {},
+      Language language = Language::eGlsl,
+      const std::string& entryPoint = "main");
+
+    /**
+     * Builds the key of the compiled SPIR-V in the caches, made of the hex
+     * digits of a hash of the source, the definitions, the language, the
+     * entry point and the target Vulkan version.
+     *
+     * @param source The source of the compute shader
+     * @param definitions The preprocessor definitions
+     * @param language The language of the source
+     * @param entryPoint The name of the entry point function
+     * @return The key of the SPIR-V, which is also its file name in the
+     * on-disk cache
+     */
+    static std::string key(
+      const std::string& source,
+      const std::vector<std::pair<std::string, std::string>>& definitions = {},
+      Language language = Language::eGlsl,
+      const std::string& entryPoint = "main");
+
+    /**
+     * Sets the directory of the on-disk cache, which has to exist, where
+     * the SPIR-V of every compiled shader is stored as a <key>.spv file.
+     *
+     * @param directory The directory of the cache, or an empty string to
+     * disable the on-disk cache, which is disabled by default
+     */
+    static void setCacheDirectory(const std::string& directory);
+
+    /**
+     * Gets the directory of the on-disk cache.
+     *
+     * @return The directory of the cache, empty if disabled
+     */
+    static std::string cacheDirectory();
+
+    /**
+     * Removes every shader from the in-memory cache, leaving the on-disk
+     * cache untouched.
+     */
+    static void clearCache();
+
+    /**
+     * Whether Kompute was built with the glslang compiler, without which
+     * only the shaders already in the on-disk cache can be compiled.
+     *
+     * @return Boolean stating whether shaders can be compiled
+     */
+    static bool compilerAvailable();
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+
+namespace kp {
+
+/**
+ * Fixed set of worker threads running the tasks submitted to the pool in
+ * submission order, used by the manager to build algorithms in parallel.
+ */
+class WorkerPool
+{
+  public:
+    /**
+     * Constructor which starts the worker threads.
+     *
+     * @param threadCount The number of worker threads, which defaults to the
+     * number of hardware threads if 0
+     */
+    WorkerPool(uint32_t threadCount = 0);
+
+    /**
+     * Destructor which runs the tasks still pending before stopping.
+     */
+    ~WorkerPool();
+
+    /**
+     * Queues a task to be run by the first worker thread available.
+     *
+     * @param task The function to run
+     * @return Future completed once the task has run, holding the exception
+     * thrown by the task if any
+     */
+    std::shared_future<void> submit(std::function<void()> task);
+
+    /**
+     * Returns the number of worker threads of the pool.
+     *
+     * @return Number of worker threads
+     */
+    uint32_t threadCount();
+
+    /**
+     * Runs the tasks still pending and then stops the worker threads.
+     */
+    void destroy();
+
+  private:
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<std::thread> mThreads;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::deque<std::packaged_task<void()>> mTasks;
+    bool mStopping = false;
+
+    void run();
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <array>
+#include <cstring>
+#include <type_traits>
+
+// Bytes of push constants stored inline by algorithms and dispatches, which
+// is the largest maxPushConstantsSize of common devices
+#ifndef KOMPUTE_MAX_PUSH_CONSTANTS_SIZE
+#define KOMPUTE_MAX_PUSH_CONSTANTS_SIZE 256
+#endif
+
+// Local size of shaders with a specialized local_size_x when the workgroup is
+// computed automatically, rounded to a multiple of the subgroup size
+#ifndef KOMPUTE_DEFAULT_LOCAL_SIZE_X
+#define KOMPUTE_DEFAULT_LOCAL_SIZE_X 64
+#endif
+
+namespace kp {
+
+/**
+    Abstraction for compute shaders that are run on top of tensors grouped via
+   ParameterGroups (which group descriptorsets)
+*/
+class Algorithm
+{
+  public:
+    /**
+     * How the tensors of the algorithm are passed to its shader.
+     */
+    enum class BindingModes
+    {
+        eDescriptors,     ///< Bound to one descriptor set, a binding each
+        eDeviceAddresses, ///< Addresses at the start of the push constants
+    };
+
+    /**
+     *  Main constructor for algorithm with configuration parameters to create
+     *  the underlying resources.
+     *
+     *  @param device The Vulkan device to use for creating resources
+     *  @param tensors (optional) The tensors to use to create the descriptor
+     * resources
+     *  @param spirv (optional) The spirv code to use to create the algorithm
+     *  @param workgroup (optional) The kp::Workgroup to use for the dispatch
+     * which defaults to kp::Workgroup(tensor[0].size(), 1, 1) if not set, or
+     * to enough workgroups of the local size for tensor[0].size() invocations
+     * if the local_size_x of the shader is a specialization constant.
+     *  @param specializationConstants (optional) The templatable param is to be used to
+     * initialize the specialization constants which cannot be changed once set.
+     *  @param pushConstants (optional) This templatable param is to be used when
+     * initializing the pipeline, which set the size of the push constants -
+     * these can be modified but all new values must have the same data type and length
+     * as otherwise it will result in errors.
+     *  @param pipelineCache (optional) The pipeline cache to create the
+     * pipeline with, which is not owned by the algorithm. An owned cache is
+     * created for the algorithm if not provided.
+     *  @param shaderCache (optional) The cache to share the shader module,
+     * pipeline and layouts through with the algorithms built from the same
+     * spirv, specialization constants, push constant size and descriptor
+     * types. The algorithm creates its own if not provided.
+     *  @param descriptorAllocator (optional) The allocator to allocate the
+     * descriptor set from. The algorithm creates a descriptor pool of its own
+     * if not provided.
+     *  @param defaultLocalSize (optional) The local size to specialize the
+     * local_size_x_id of the shader with when its id is not one of the
+     * specialization constants provided, which is chosen for the device by
+     * the manager and defaults to KOMPUTE_DEFAULT_LOCAL_SIZE_X.
+     *  @param debugUtils (optional) Functions of VK_EXT_debug_utils to name
+     * the pipeline of the algorithm with, see setName
+     *  @param metrics (optional) Counters to add the pipelines created or
+     * reused and the descriptor sets allocated by the algorithm to
+     *  @param hostAllocator (optional) Host allocation callbacks to create
+     * and destroy the pipeline resources of the algorithm with
+     *  @param bindingMode (optional) How the tensors are passed to the
+     * shader. With BindingModes::eDeviceAddresses no descriptor set is
+     * allocated, and the device address of each tensor is pushed as a 64 bit
+     * value at the start of the push constants, followed by the push
+     * constants of the algorithm, so the shader declares the tensors as
+     * GL_EXT_buffer_reference members of its push constant block. This
+     * requires the manager to have buffer device addresses enabled.
+     *  @param maxPushConstantsSize (optional) The maxPushConstantsSize limit
+     * of the device, which the manager provides and which may be as low as
+     * 128 bytes. The push constants, including the tensor addresses, are
+     * checked against it and against KOMPUTE_MAX_PUSH_CONSTANTS_SIZE, or
+     * only against the latter if zero.
+     */
+    template<typename S = float, typename P = float>
+    Algorithm(std::shared_ptr<vk::Device> device,
+              const std::vector<std::shared_ptr<Tensor>>& tensors = {},
+              const std::vector<uint32_t>& spirv = {},
+              const Workgroup& workgroup = {},
+              const std::vector<S>& specializationConstants = {},
+              const std::vector<P>& pushConstants = {},
+              std::shared_ptr<vk::PipelineCache> pipelineCache = nullptr,
+              std::shared_ptr<ShaderCache> shaderCache = nullptr,
+              std::shared_ptr<DescriptorAllocator> descriptorAllocator = nullptr,
+              uint32_t defaultLocalSize = 0,
+              std::shared_ptr<DebugUtils> debugUtils = nullptr,
+              std::shared_ptr<Metrics> metrics = nullptr,
+              std::shared_ptr<HostAllocator> hostAllocator = nullptr,
+              BindingModes bindingMode = BindingModes::eDescriptors,
+              uint32_t maxPushConstantsSize = 0)
+    {
+        KP_LOG_DEBUG("Kompute Algorithm Constructor with device");
+
+        this->mDevice = device;
+        this->mBindingMode = bindingMode;
+        if (maxPushConstantsSize) {
+            this->mMaxPushConstantsSize = std::min<uint32_t>(
+              maxPushConstantsSize, KOMPUTE_MAX_PUSH_CONSTANTS_SIZE);
+        }
+        this->mDebugUtils = debugUtils;
+        this->mMetrics = metrics;
+        this->mHostAllocator = hostAllocator;
+        this->mPipelineCache = pipelineCache;
+        this->mShaderCache = shaderCache;
+        this->mDescriptorAllocator = descriptorAllocator;
+        this->mDefaultLocalSize =
+          defaultLocalSize ? defaultLocalSize : KOMPUTE_DEFAULT_LOCAL_SIZE_X;
+
+        if (tensors.size() && spirv.size()) {
+            KP_LOG_DEBUG(
+              "Kompute Algorithm initialising with tensor size: {} and "
+              "spirv size: {}",
+              tensors.size(),
+              spirv.size());
+            this->rebuild(
+              tensors, spirv, workgroup, specializationConstants, pushConstants);
+        } else {
+            KP_LOG_DEBUG(
+              "Kompute Algorithm constructor with empty tensors and or "
+              "spirv so not rebuilding vulkan components");
+        }
+    }
+
+    /**
+     *  Rebuild function to reconstruct algorithm with configuration parameters
+     * to create the underlying resources.
+     *
+     *  @param tensors The tensors to use to create the descriptor resources
+     *  @param spirv The spirv code to use to create the algorithm
+     *  @param workgroup (optional) The kp::Workgroup to use for the dispatch
+     * which defaults to kp::Workgroup(tensor[0].size(), 1, 1) if not set.
+     *  @param specializationConstants (optional) The std::vector<float> to use to
+     * initialize the specialization constants which cannot be changed once set.
+     *  @param pushConstants (optional) The std::vector<float> to use when
+     * initializing the pipeline, which set the size of the push constants -
+     * these can be modified but all new values must have the same vector size
+     * as this initial value.
+     */
+    template<typename S = float, typename P = float>
+    void rebuild(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                 const std::vector<uint32_t>& spirv,
+                 const Workgroup& workgroup = {},
+                 const std::vector<S>& specializationConstants = {},
+                 const std::vector<P>& pushConstants = {})
+    {
+        Tracer::Span span("Algorithm::rebuild");
+
+        this->awaitBuild();
+        this->build(
+          tensors, spirv, workgroup, specializationConstants, pushConstants);
+    }
+
+    /**
+     * Rebuild function which reconstructs the underlying resources of the
+     * algorithm on a thread of the worker pool, returning without waiting for
+     * the pipeline to be compiled. The functions of the algorithm wait for
+     * the rebuild to complete when called, and rethrow the exception thrown
+     * by the rebuild if any.
+     *
+     *  @param workerPool The worker pool to run the rebuild on
+     *  @param tensors The tensors to use to create the descriptor resources
+     *  @param spirv The spirv code to use to create the algorithm
+     *  @param workgroup (optional) The kp::Workgroup to use for the dispatch
+     * which defaults to kp::Workgroup(tensor[0].size(), 1, 1) if not set.
+     *  @param specializationConstants (optional) The std::vector to use to
+     * initialize the specialization constants.
+     *  @param pushConstants (optional) The std::vector to use when
+     * initializing the pipeline, which set the size of the push constants.
+     */
+    template<typename S = float, typename P = float>
+    void rebuildAsync(WorkerPool& workerPool,
+                      const std::vector<std::shared_ptr<Tensor>>& tensors,
+                      const std::vector<uint32_t>& spirv,
+                      const Workgroup& workgroup = {},
+                      const std::vector<S>& specializationConstants = {},
+                      const std::vector<P>& pushConstants = {})
+    {
+        this->awaitBuild();
+
+        // The destructor waits for the build so the algorithm outlives it
+        this->mBuild = workerPool.submit([this,
+                                          tensors,
+                                          spirv,
+                                          workgroup,
+                                          specializationConstants,
+                                          pushConstants]() {
+            this->build(
+              tensors, spirv, workgroup, specializationConstants, pushConstants);
+        });
+    }
+
+    /**
+     * Destructor for Algorithm which is responsible for freeing and desroying
+     * respective pipelines and owned parameter groups.
+     */
+    ~Algorithm();
+
+    /**
+     * Records the dispatch function with the provided template parameters or
+     * alternatively using the size of the tensor by default.
+     *
+     * @param commandBuffer Command buffer to record the algorithm resources to
+     */
+    void recordDispatch(const vk::CommandBuffer& commandBuffer);
+
+    /**
+     * Records a dispatch with the workgroup counts provided instead of the
+     * workgroup of the algorithm, which allows the passes of a multi pass
+     * operation to dispatch different grids of the same pipeline.
+     *
+     * @param commandBuffer Command buffer to record the algorithm resources to
+     * @param workgroup The workgroup counts of the dispatch, which are used as
+     * they are so a count of zero records an empty dispatch
+     */
+    void recordDispatch(const vk::CommandBuffer& commandBuffer,
+                        const Workgroup& workgroup);
+
+    /**
+     * Records an indirect dispatch which reads the workgroup counts from a
+     * VkDispatchIndirectCommand stored in a tensor when the command buffer
+     * is executed, instead of using the workgroup of the algorithm.
+     *
+     * @param commandBuffer Command buffer to record the algorithm resources to
+     * @param tensor Tensor holding the dispatch command
+     * @param offset Offset in bytes of the dispatch command in the tensor
+     */
+    void recordDispatchIndirect(const vk::CommandBuffer& commandBuffer,
+                                std::shared_ptr<Tensor> tensor,
+                                vk::DeviceSize offset = 0);
+
+    /**
+     * Records command that binds the "core" algorithm components which consist
+     * of binding the pipeline and binding the descriptorsets. The descriptors
+     * are refreshed first if any of the tensors has been rebuilt since they
+     * were last written.
+     *
+     * @param commandBuffer Command buffer to record the algorithm resources to
+     */
+    void recordBindCore(const vk::CommandBuffer& commandBuffer);
+
+    /**
+     * Records command that binds the push constants to the command buffer
+     * provided
+     * - it is required that the pushConstants provided are of the same size as
+     * the ones provided during initialization.
+     *
+     * @param commandBuffer Command buffer to record the algorithm resources to
+     */
+    void recordBindPush(const vk::CommandBuffer& commandBuffer);
+
+    /**
+     * Records command that binds push constants provided as raw memory
+     * instead of the push constants stored in the algorithm, which allows
+     * recording several dispatches with different push constants without
+     * updating the algorithm in between.
+     *
+     * @param commandBuffer Command buffer to record the algorithm resources to
+     * @param data The raw data of the push constants
+     * @param size The size of the data in bytes, which has to be the memory
+     * size of the push constants provided during initialization
+     */
+    void recordPushConstants(const vk::CommandBuffer& commandBuffer,
+                             const void* data,
+                             uint32_t size);
+
+    /**
+     * function that checks all the gpu resource components to verify if these
+     * have been created and returns true if all are valid.
+     *
+     * @returns returns true if the algorithm is currently initialized.
+     */
+    bool isInit();
+
+    /**
+     * Sets the work group to use in the recordDispatch
+     *
+     * @param workgroup The kp::Workgroup value to use to update the algorithm.
+     * It must have a value greater than 1 on the x value (index 1) otherwise it
+     * will be initialized on the size of the first tensor (ie.
+     * this->mTensor[0]->size()), divided by the local size rounding up if the
+     * local size of the shader is specialized
+     */
+    void setWorkgroup(const Workgroup& workgroup, uint32_t minSize = 1);
+    /**
+     * Sets the push constants to the new value provided to use in the next
+     * bindPush()
+     *
+     * @param pushConstants The templatable vector is to be used to set the push constants to use in the
+     * next bindPush(...) calls. The constants provided must be of the same size
+     * as the ones created during initialization.
+     */
+    template<typename T>
+    void setPushConstants(const std::vector<T>& pushConstants)
+    {
+        uint32_t memorySize = sizeof(decltype(pushConstants.back()));
+        uint32_t size = pushConstants.size();
+
+        this->setPushConstants(pushConstants.data(), size, memorySize);
+    }
+
+    /**
+     * Sets the push constants from a fixed size array, whose size is checked
+     * against the inline storage of the push constants at compile time.
+     *
+     * @param pushConstants The push constants to use in the next bindPush(...)
+     * calls, of the same total size as the ones created during initialization.
+     */
+    template<typename T, size_t N>
+    void setPushConstants(const std::array<T, N>& pushConstants)
+    {
+        static_assert(sizeof(T) * N <= KOMPUTE_MAX_PUSH_CONSTANTS_SIZE,
+                      "Kompute Algorithm push constants exceed "
+                      "KOMPUTE_MAX_PUSH_CONSTANTS_SIZE");
+
+        this->setPushConstants(pushConstants.data(), N, sizeof(T));
+    }
+
+    /**
+     * Writes a single push constant in place for the next bindPush(...)
+     * calls.
+     *
+     * @param index The index of the push constant to write
+     * @param value The value of the push constant, which must be of the size
+     * of the push constants created during initialization
+     */
+    template<typename T>
+    void setPushConstant(uint32_t index, const T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "Kompute Algorithm push constants must be trivially "
+                      "copyable");
+
+        this->awaitBuild();
+
+        if (sizeof(T) != this->mPushConstantsDataTypeMemorySize ||
+            index >= this->mPushConstantsSize) {
+            throw std::runtime_error(
+              fmt::format("Kompute Algorithm push constant {} of {} bytes "
+                          "provided but there are {} of {} bytes",
+                          index,
+                          sizeof(T),
+                          this->mPushConstantsSize,
+                          this->mPushConstantsDataTypeMemorySize));
+        }
+
+        memcpy(this->mPushConstantsData + index * sizeof(T), &value, sizeof(T));
+    }
+
+    /**
+     * Sets the push constants to the new value provided to use in the next
+     * bindPush() with the raw memory block location and memory size to be used.
+     *
+     * @param data The raw data point to copy the data from, without modifying the pointer.
+     * @param size The number of data elements provided in the data
+     * @param memorySize The memory size of each of the data elements in bytes.
+     */
+    void setPushConstants(const void* data, uint32_t size, uint32_t memorySize) {
+
+        this->awaitBuild();
+
+        uint32_t totalSize = memorySize * size;
+        uint32_t previousTotalSize = this->mPushConstantsDataTypeMemorySize * this->mPushConstantsSize;
+
+        if (totalSize != previousTotalSize) {
+            throw std::runtime_error(
+              fmt::format("Kompute Algorithm push "
+                          "constant total memory size provided is {} but expected {} bytes",
+                          totalSize,
+                          previousTotalSize));
+        }
+
+        // The push constants are written in place without reallocating
+        memcpy(this->mPushConstantsData, data, totalSize);
+        this->mPushConstantsDataTypeMemorySize = memorySize;
+        this->mPushConstantsSize = size;
+    }
+
+    /**
+     * Gets the current workgroup from the algorithm.
+     *
+     * @param The kp::Constant to use to set the push constants to use in the
+     * next bindPush(...) calls. The constants provided must be of the same size
+     * as the ones created during initialization.
+     */
+    const Workgroup& getWorkgroup();
+
+    /**
+     * Gets the local size the local_size_x_id of the shader was specialized
+     * with, which the group count of automatic workgroups is based on.
+     *
+     * @returns The specialized local size, or 0 if the local size of the
+     * shader is not specialized by the algorithm
+     */
+    uint32_t getLocalSizeX();
+    /**
+     * Gets the specialization constants of the current algorithm.
+     *
+     * @returns The std::vector<float> currently set for specialization constants
+     */
+    template<typename T>
+    const std::vector<T> getSpecializationConstants()
+    {
+        this->awaitBuild();
+        return { (T*)this->mSpecializationConstantsData,
+            ((T*)this->mSpecializationConstantsData) + this->mSpecializationConstantsSize };
+    }
+    /**
+     * Gets the specialization constants of the current algorithm.
+     *
+     * @returns The std::vector<float> currently set for push constants
+     */
+    template<typename T>
+    const std::vector<T> getPushConstants()
+    {
+        this->awaitBuild();
+        return { (T*)this->mPushConstantsData,
+            ((T*)this->mPushConstantsData) + this->mPushConstantsSize };
+    }
+    /**
+     * Gets the current tensors that are used in the algorithm.
+     *
+     * @returns The list of tensors used in the algorithm.
+     */
+    const std::vector<std::shared_ptr<Tensor>>& getTensors();
+
+    /**
+     * Gets the SPIR-V the algorithm was built from, which allows rebuilding
+     * it with other workgroups or specialization constants.
+     *
+     * @returns The SPIR-V of the shader of the algorithm.
+     */
+    const std::vector<uint32_t>& getSpirv();
+
+    /**
+     * Binds other tensors to the algorithm by rewriting its descriptor set,
+     * or only the device addresses it pushes with
+     * BindingModes::eDeviceAddresses, keeping the shader module and pipeline.
+     * The tensors must match the number of bindings and the descriptor type
+     * of each binding. Sequences that recorded the algorithm must not be
+     * running, and need to be recorded again to use the new tensors.
+     *
+     * @param tensors The tensors to bind, one per binding
+     */
+    void setTensors(const std::vector<std::shared_ptr<Tensor>>& tensors);
+
+    /**
+     * Sets the name of the algorithm, which names its pipeline, pipeline
+     * layout and descriptor set through VK_EXT_debug_utils so they can be
+     * identified in captures of debugging and profiling tools. The resources
+     * keep the name through rebuilds. Pipelines shared through the shader
+     * cache take the name of the last algorithm named.
+     *
+     * @param name The name of the algorithm
+     */
+    void setName(const std::string& name);
+
+    /**
+     * Retrieve the name of the algorithm set with setName.
+     *
+     * @return Name of the algorithm, empty if it was not named
+     */
+    const std::string& name();
+
+    /**
+     * Retrieve how the tensors of the algorithm are passed to its shader.
+     *
+     * @return The binding mode the algorithm was created with
+     */
+    BindingModes bindingMode();
+
+    void destroy();
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<vk::Device> mDevice;
+    std::vector<std::shared_ptr<Tensor>> mTensors;
+    std::vector<uint64_t> mTensorGenerations;
+    std::vector<vk::DeviceAddress> mTensorAddresses;
+    std::shared_ptr<ShaderCache> mShaderCache;
+    std::shared_ptr<DescriptorAllocator> mDescriptorAllocator;
+    std::shared_ptr<DebugUtils> mDebugUtils;
+    std::shared_ptr<Metrics> mMetrics;
+    std::shared_ptr<HostAllocator> mHostAllocator;
+
+    // -------------- OPTIONALLY OWNED RESOURCES
+    std::shared_ptr<vk::DescriptorSetLayout> mDescriptorSetLayout;
+    bool mFreeDescriptorSetLayout = false;
+    std::shared_ptr<vk::DescriptorPool> mDescriptorPool;
+    bool mFreeDescriptorPool = false;
+    std::shared_ptr<vk::DescriptorSet> mDescriptorSet;
+    bool mFreeDescriptorSet = false;
+    std::shared_ptr<vk::ShaderModule> mShaderModule;
+    bool mFreeShaderModule = false;
+    std::shared_ptr<vk::PipelineLayout> mPipelineLayout;
+    bool mFreePipelineLayout = false;
+    std::shared_ptr<vk::PipelineCache> mPipelineCache;
+    bool mFreePipelineCache = false;
+    std::shared_ptr<vk::Pipeline> mPipeline;
+    bool mFreePipeline = false;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<uint32_t> mSpirv;
+    void* mSpecializationConstantsData = nullptr;
+    uint32_t mSpecializationConstantsDataTypeMemorySize = 0;
+    uint32_t mSpecializationConstantsSize = 0;
+    alignas(16) uint8_t mPushConstantsData[KOMPUTE_MAX_PUSH_CONSTANTS_SIZE];
+    uint32_t mPushConstantsDataTypeMemorySize = 0;
+    uint32_t mPushConstantsSize = 0;
+    uint32_t mMaxPushConstantsSize = KOMPUTE_MAX_PUSH_CONSTANTS_SIZE;
+    Workgroup mWorkgroup;
+    uint32_t mDefaultLocalSize = KOMPUTE_DEFAULT_LOCAL_SIZE_X;
+    uint32_t mLocalSizeX = 0;
+    uint32_t mLocalSizeXSpecializationId = 0;
+    std::string mName;
+    BindingModes mBindingMode = BindingModes::eDescriptors;
+    // Pending asynchronous build, valid until awaited
+    std::shared_future<void> mBuild;
+
+    // Build functions, run on the thread of the worker pool when rebuilding
+    // asynchronously
+    template<typename S, typename P>
+    void build(const std::vector<std::shared_ptr<Tensor>>& tensors,
+               const std::vector<uint32_t>& spirv,
+               const Workgroup& workgroup,
+               const std::vector<S>& specializationConstants,
+               const std::vector<P>& pushConstants)
+    {
+        KP_LOG_DEBUG("Kompute Algorithm build started");
+
+        this->mTensors = tensors;
+        this->mSpirv = spirv;
+
+        if (specializationConstants.size()) {
+            if (this->mSpecializationConstantsData) {
+                free(this->mSpecializationConstantsData);
+            }
+            uint32_t memorySize = sizeof(decltype(specializationConstants.back()));
+            uint32_t size = specializationConstants.size();
+            uint32_t totalSize = size * memorySize;
+            this->mSpecializationConstantsData = malloc(totalSize);
+            memcpy(this->mSpecializationConstantsData, specializationConstants.data(), totalSize);
+            this->mSpecializationConstantsDataTypeMemorySize = memorySize;
+            this->mSpecializationConstantsSize = size;
+        }
+
+        if (pushConstants.size()) {
+            uint32_t memorySize = sizeof(decltype(pushConstants.back()));
+            uint32_t size = pushConstants.size();
+            uint32_t totalSize = size * memorySize;
+            // Devices may only guarantee the 128 bytes required by the spec
+            if (totalSize > this->mMaxPushConstantsSize) {
+                throw std::runtime_error(fmt::format(
+                  "Kompute Algorithm push constants of {} bytes exceed the "
+                  "maximum of {} bytes of the device",
+                  totalSize,
+                  this->mMaxPushConstantsSize));
+            }
+            memcpy(this->mPushConstantsData, pushConstants.data(), totalSize);
+            this->mPushConstantsDataTypeMemorySize = memorySize;
+            this->mPushConstantsSize = size;
+        }
+
+        this->updateLocalSize();
+        this->updateWorkgroup(
+          workgroup,
+          this->mTensors.size()
+            ? static_cast<uint32_t>(this->mTensors[0]->size())
+            : 1);
+
+        // Descriptor pool is created first so if available then destroy all before
+        // rebuild
+        if (this->hasResources()) {
+            this->destroyResources();
+        }
+
+        this->createPipelineResources();
+        this->createParameters();
+        this->setObjectNames();
+    }
+
+    void awaitBuild();
+    bool hasResources();
+    void destroyResources();
+    void updateLocalSize();
+    void updateWorkgroup(const Workgroup& workgroup, uint32_t minSize);
+    void setObjectNames();
+
+    // Create util functions
+    void createPipelineResources();
+    void createDescriptorSetLayout();
+    void createShaderModule();
+    void createPipeline();
+
+    // Parameters
+    void createParameters();
+    void updateDescriptors();
+    uint32_t pushConstantsOffset();
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <string>
+#include <type_traits>
+
+namespace kp {
+
+/**
+ * Elementwise expression over float tensors of the same size, built with the
+ * arithmetic operators and the functions of this header, which OpExpression
+ * evaluates in a single fused dispatch instead of one dispatch and one
+ * intermediate tensor per operation.
+ *
+ * The GLSL of an expression is generated from its signature, which
+ * identifies the operations and the positions of the tensors and constants
+ * but not which tensors or constant values are used, and compiled in the
+ * process by kp::Shader, which caches the SPIR-V by source. Expressions with
+ * the same structure then share the same SPIR-V, and the pipeline of the
+ * ShaderCache of the manager. The constants are passed as push constants.
+ * Compiling requires Kompute to be built with
+ * KOMPUTE_OPT_ENABLE_SHADER_COMPILER, unless the SPIR-V is already in the
+ * on-disk cache of kp::Shader.
+ */
+class Expression
+{
+  public:
+    /**
+     * Operation of a node of the expression.
+     */
+    enum class Operation
+    {
+        eTensor = 0,
+        eConstant = 1,
+        eAdd = 2,
+        eSubtract = 3,
+        eMultiply = 4,
+        eDivide = 5,
+        eMin = 6,
+        eMax = 7,
+        eNegate = 8,
+        eAbs = 9,
+        eSqrt = 10,
+        eExp = 11,
+        eLog = 12,
+    };
+
+    /**
+     * Constructor of an expression reading the elements of a tensor, which
+     * also converts tensors to expressions in the operators.
+     *
+     * @param tensor The float tensor to read
+     */
+    template<typename T,
+             typename = typename std::enable_if<
+               std::is_base_of<Tensor, T>::value>::type>
+    Expression(const std::shared_ptr<T>& tensor)
+      : Expression(std::static_pointer_cast<Tensor>(tensor))
+    {
+    }
+
+    /**
+     * Constructor of an expression reading the elements of a tensor.
+     *
+     * @param tensor The float tensor to read
+     */
+    Expression(const std::shared_ptr<Tensor>& tensor);
+
+    /**
+     * Constructor of a constant expression, whose value is passed as a push
+     * constant.
+     *
+     * @param constant The value of the constant
+     */
+    explicit Expression(float constant);
+
+    /**
+     * Constructor of an operation on one or two expressions.
+     *
+     * @param operation The operation of the node
+     * @param left The first operand
+     * @param right The second operand of binary operations
+     */
+    Expression(Operation operation,
+               const Expression& left,
+               const Expression& right);
+    Expression(Operation operation, const Expression& operand);
+
+    /**
+     * Returns the distinct tensors read by the expression, in the order they
+     * are first read which is the order of their bindings after the output.
+     *
+     * @return The tensors of the expression
+     */
+    std::vector<std::shared_ptr<Tensor>> tensors() const;
+
+    /**
+     * Returns the values of the constants of the expression, in the order of
+     * their push constants.
+     *
+     * @return The constants of the expression
+     */
+    std::vector<float> constants() const;
+
+    /**
+     * Returns the signature of the expression, such as mul(t0,add(t1,c0))
+     * where t are the distinct tensors and c the constants.
+     *
+     * @return The signature of the expression
+     */
+    std::string signature() const;
+
+    /**
+     * Returns the GLSL of a compute shader that evaluates the expression
+     * into the tensor at binding 0, with one invocation per element and the
+     * local size x specialized through the specialization constant 0.
+     *
+     * @return The GLSL source of the fused shader
+     */
+    std::string glsl() const;
+
+    /**
+     * Returns the SPIR-V of the shader of glsl, compiled through
+     * kp::Shader::compile the first time a signature is used and then
+     * served from its cache.
+     *
+     * @return The SPIR-V of the fused shader
+     */
+    std::vector<uint32_t> spirv() const;
+
+  private:
+    struct Node
+    {
+        Operation operation;
+        std::shared_ptr<Tensor> tensor;
+        float constant;
+        std::shared_ptr<const Node> left;
+        std::shared_ptr<const Node> right;
+    };
+
+    std::shared_ptr<const Node> mNode;
+};
+
+/**
+ * Starts an expression from a tensor, as in kp::expr(a) * b + c.
+ *
+ * @param tensor The float tensor to read
+ * @return Expression reading the tensor
+ */
+inline Expression
+expr(const std::shared_ptr<Tensor>& tensor)
+{
+    return Expression(tensor);
+}
+
+Expression
+operator+(const Expression& left, const Expression& right);
+Expression
+operator+(const Expression& left, float right);
+Expression
+operator+(float left, const Expression& right);
+Expression
+operator-(const Expression& left, const Expression& right);
+Expression
+operator-(const Expression& left, float right);
+Expression
+operator-(float left, const Expression& right);
+Expression
+operator*(const Expression& left, const Expression& right);
+Expression
+operator*(const Expression& left, float right);
+Expression
+operator*(float left, const Expression& right);
+Expression
+operator/(const Expression& left, const Expression& right);
+Expression
+operator/(const Expression& left, float right);
+Expression
+operator/(float left, const Expression& right);
+Expression
+operator-(const Expression& operand);
+
+Expression
+min(const Expression& left, const Expression& right);
+Expression
+max(const Expression& left, const Expression& right);
+Expression
+abs(const Expression& operand);
+Expression
+sqrt(const Expression& operand);
+Expression
+exp(const Expression& operand);
+Expression
+log(const Expression& operand);
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+namespace kp {
+
+/**
+ *  Base Operation which provides the high level interface that Kompute
+ *  operations implement in order to perform a set of actions in the GPU.
+ *
+ *  Operations can perform actions on tensors, and optionally can also own an
+ *  Algorithm with respective parameters. kp::Operations with kp::Algorithms
+ *  would inherit from kp::OpBaseAlgo.
+ */
+class OpBase
+{
+  public:
+    /**
+     * Access of an operation to the memory of a tensor on the GPU, used by
+     * the sequence to record the barriers required between the operations.
+     */
+    struct TensorAccess
+    {
+        std::shared_ptr<Tensor> tensor;
+        vk::PipelineStageFlags stageMask;
+        vk::AccessFlags accessMask;
+    };
+
+    /**
+     * Default destructor for OpBase class. This OpBase destructor class should
+     * always be called to destroy and free owned resources unless it is
+     * intended to destroy the resources in the parent class.
+     */
+    virtual ~OpBase()
+    {
+        KP_LOG_DEBUG("Kompute OpBase destructor started");
+    }
+
+    /**
+     * The record function is intended to only send a record command or run
+     * commands that are expected to record operations that are to be submitted
+     * as a batch into the GPU.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void record(const vk::CommandBuffer& commandBuffer) = 0;
+
+    /**
+     * Pre eval is called before the Sequence has called eval and submitted the commands to
+     * the GPU for processing, and can be used to perform any per-eval setup steps
+     * required as the computation iteration begins. It's worth noting that 
+     * there are situations where eval can be called multiple times, so the 
+     * resources that are created should be idempotent in case it's called multiple
+     * times in a row.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void preEval(const vk::CommandBuffer& commandBuffer) = 0;
+
+    /**
+     * Post eval is called after the Sequence has called eval and submitted the commands to
+     * the GPU for processing, and can be used to perform any tear-down steps
+     * required as the computation iteration finishes. It's worth noting that 
+     * there are situations where eval can be called multiple times, so the 
+     * resources that are destroyed should not require a re-init unless explicitly
+     * provided by the user.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void postEval(const vk::CommandBuffer& commandBuffer) = 0;
+
+    /**
+     * Declares the accesses of the commands recorded by the operation to the
+     * memory of its tensors. The sequence records the barriers these accesses
+     * require against the operations recorded before, so the operation does
+     * not record barriers of its own. Operations that declare no accesses are
+     * expected to record their own barriers, and the sequence assumes they
+     * may have written to any tensor.
+     *
+     * @return Accesses of the operation to the memory of its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() { return {}; }
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+namespace kp {
+
+/**
+ * Operation that provides a general abstraction that simplifies the use of 
+ * algorithm and parameter components which can be used with shaders.
+ * It exposes the pipeline barrier functionality specifically for memory
+ * barriers that can be configured through the respective source and destination
+ * masks
+ */
+class OpMemoryBarrier : public OpBase
+{
+  public:
+
+    /**
+     * Constructor that stores tensors as well as memory barrier parameters to be
+     * used to create a pipeline barrier on the respective primary or staging tensor.
+     *
+     * @param tensors The tensors to apply the memory barriers on
+     * @param srcAccessMask The kp::AccessFlagBits for the source access mask
+     * @param dstAccessMask The kp::AccessFlagBits for the destination access mask
+     * @param srcStageMask The kp::PipelineStageFlagBits for the source stage mask
+     * @param dstStageMask The kp::PipelineStageFlagBits for the destination stage mask
+     * @param barrierOnPrimary Boolean to select primary or secondary buffers on tensors
+     */
+    OpMemoryBarrier(
+            const std::vector<std::shared_ptr<Tensor>>& tensors,
+            const vk::AccessFlagBits& srcAccessMask,
+            const vk::AccessFlagBits& dstAccessMask,
+            const vk::PipelineStageFlagBits& srcStageMask,
+            const vk::PipelineStageFlagBits& dstStageMask,
+            bool barrierOnPrimary = true);
+
+    /**
+     * Default destructor, which is in charge of destroying the reference to the tensors
+     * and all the relevant access / stage masks created
+     */
+    virtual ~OpMemoryBarrier() override;
+
+    /**
+     * This records the memory barrier with the access and stage masks provided
+     * across all relevant tensors, as a single pipeline barrier command with
+     * one buffer memory barrier per tensor.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Does not perform any preEval commands.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void preEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Does not perform any postEval commands.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
+
+private:
+    const vk::AccessFlagBits mSrcAccessMask;
+    const vk::AccessFlagBits mDstAccessMask;
+    const vk::PipelineStageFlagBits mSrcStageMask;
+    const vk::PipelineStageFlagBits mDstStageMask;
+    const bool mBarrierOnPrimary;
+    const std::vector<std::shared_ptr<Tensor>> mTensors;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+namespace kp {
+
+/**
+ * Operation that copies the data from the first tensor to the rest of the tensors 
+ * provided, using a record command for all the vectors. This operation does not 
+ * own/manage the memory of the tensors passed to it. The operation must only 
+ * receive tensors of type 
+ * When element ranges are provided only those ranges are copied.
+*/
+class OpTensorCopy : public OpBase
+{
+  public:
+    /**
+     * Update of the host data of the tensors copied into after each
+     * evaluation.
+     */
+    enum class HostUpdate
+    {
+        eNone = 0,   ///< Only the device memory is copied, and the host data
+                     ///< is read back with OpTensorSyncLocal when needed
+        eMirror = 1, ///< The host data of the first tensor is copied into
+                     ///< the host data of the others, which for device
+                     ///< tensors is their staging memory as last synced
+    };
+
+    /**
+     * Default constructor with parameters that provides the core vulkan resources 
+     * and the tensors that will be used in the operation.
+     *
+     * @param tensors Tensors that will be used to create in operation.
+     * @param ranges Element ranges to copy into each tensor, the whole
+     * tensors if empty
+     * @param hostUpdate Whether the host data of the first tensor is also
+     * copied on the host into the other tensors after each evaluation, which
+     * eNone avoids for copies broadcasting to many tensors whose host data
+     * is not read
+     */
+    OpTensorCopy(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                  const std::vector<Tensor::Range>& ranges = {},
+                  HostUpdate hostUpdate = HostUpdate::eMirror);
+
+    /**
+     * Default destructor. This class does not manage memory so it won't be 
+     * expecting the parent to perform a release.
+     */
+    ~OpTensorCopy() override;
+
+    /**
+     * Records the copy commands from the first tensor into all the other 
+     * tensors provided, computing the copy regions once for all of them.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Does not perform any preEval commands.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void preEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Copies the local vectors for all the tensors to sync the data with the
+     * gpu, unless the host update is eNone.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Declares a transfer read of the first tensor and transfer writes to the
+     * tensors copied into.
+     *
+     * @return Accesses of the operation to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+    /**
+     * Staging ring that the tensors of the operation transfer through. Its
+     * transfers are submitted before the command buffer of the sequence.
+     *
+     * @return The staging ring, or nullptr if no tensor uses one
+     */
+    std::shared_ptr<StagingRing> stagingRing();
+
+  private:
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mTensors;
+    std::vector<Tensor::Range> mRanges;
+    HostUpdate mHostUpdate;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+namespace kp {
+
+/**
+ * Operation that fills the GPU memory of the tensors provided with a repeated
+ * 32-bit value, using a record command for all the tensors so no host data is
+ * required. This is intended to clear output and scratch tensors, including
+ * tensors of type eStorage. This operation does not own/manage the memory of
+ * the tensors passed to it.
+*/
+class OpTensorFill : public OpBase
+{
+  public:
+    /**
+     * Default constructor with parameters that provides the tensors that will
+     * be filled and the value to fill them with.
+     *
+     * @param tensors Tensors that will be used to create in operation.
+     * @param data The 32-bit pattern written repeatedly into the tensors,
+     * which defaults to zero
+     */
+    OpTensorFill(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                 uint32_t data = 0);
+
+    /**
+     * Default destructor. This class does not manage memory so it won't be 
+     * expecting the parent to perform a release.
+     */
+    ~OpTensorFill() override;
+
+    /**
+     * Records the fill commands for all the tensors provided.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Does not perform any preEval commands.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void preEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Fills the local data of the tensors that hold a separate host copy, and
+     * invalidates the memory of host tensors, to keep the data in sync with
+     * the gpu.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Declares transfer writes to the tensors filled.
+     *
+     * @return Accesses of the operation to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+    /**
+     * Staging ring that the tensors of the operation transfer through. Its
+     * transfers are submitted after the command buffer of the sequence.
+     *
+     * @return The staging ring, or nullptr if no tensor uses one
+     */
+    std::shared_ptr<StagingRing> stagingRing();
+
+  private:
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mTensors;
+    uint32_t mData;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+namespace kp {
+
+/**
+ * Operation that syncs tensor's device by mapping local data into the device memory. 
+ * For TensorTypes::eDevice it will use a record operation for the memory to be syncd 
+ * into GPU memory which means that the operation will be done in sync with GPU commands. 
+ * For TensorTypes::eHost it will only map the data into host memory which will 
+ * happen during preEval before the recorded commands are dispatched.
+ * For device tensors that use a staging ring the data is uploaded through the
+ * ring during preEval, before the recorded commands are submitted.
+ * When element ranges are provided only those ranges are transferred, such as
+ * the ranges returned by Tensor::dirtyRanges. Tensors of type eImage are
+ * copied whole from their staging buffer, which leaves the image in the
+ * general layout shaders access it in.
+*/
+class OpTensorSyncDevice : public OpBase
+{
+  public:
+    /**
+     * Default constructor with parameters that provides the core vulkan resources 
+     * and the tensors that will be used in the operation. The tensos provided cannot 
+     * be of type TensorTypes::eStorage.
+     *
+     * @param tensors Tensors that will be used to create in operation.
+     * @param ranges Element ranges to sync in each tensor, the whole
+     * tensors if empty
+     */
+    OpTensorSyncDevice(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                        const std::vector<Tensor::Range>& ranges = {});
+
+    /**
+     * Default destructor. This class does not manage memory so it won't be expecting the parent to perform a release.
+     */
+    ~OpTensorSyncDevice() override;
+
+    /**
+     * For device tensors, it records the copy command for the tensor to copy the 
+     * data from its staging to device memory.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * For device tensors that use a staging ring, it uploads the data through
+     * the ring into device memory. Other tensors with non-coherent host memory
+     * have their mapped memory flushed before the commands are submitted.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void preEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Does not perform any postEval commands.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Declares transfer writes to the device tensors synced.
+     *
+     * @return Accesses of the operation to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  private:
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mTensors;
+    std::vector<Tensor::Range> mRanges;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+namespace kp {
+
+/**
+ * Operation that syncs tensor's local memory by mapping device data into the 
+ * local CPU memory. For TensorTypes::eDevice it will use a record operation 
+ * for the memory to be syncd into GPU memory which means that the operation 
+ * will be done in sync with GPU commands. For TensorTypes::eHost it will 
+ * only map the data into host memory which will happen during preEval before 
+ * the recorded commands are dispatched. For device tensors that use a staging 
+ * ring the data is downloaded through the ring during postEval, once the 
+ * recorded commands have completed. When element ranges are provided only
+ * those ranges are transferred, while tensors of type eImage are always
+ * copied whole.
+*/
+class OpTensorSyncLocal : public OpBase
+{
+  public:
+    /**
+     * Default constructor with parameters that provides the core vulkan resources 
+     * and the tensors that will be used in the operation. The tensors provided 
+     * cannot be of type TensorTypes::eStorage.
+     *
+     * @param tensors Tensors that will be used to create in operation.
+     * @param ranges Element ranges to sync in each tensor, the whole
+     * tensors if empty
+     */
+    OpTensorSyncLocal(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                       const std::vector<Tensor::Range>& ranges = {});
+
+    /**
+     * Default destructor. This class does not manage memory so it won't be expecting 
+     * the parent to perform a release.
+     */
+    ~OpTensorSyncLocal() override;
+
+    /**
+     * For device tensors, it records the copy command for the tensor to copy the 
+     * data from its device to staging memory.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Does not perform any preEval commands.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void preEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * For host tensors it performs the map command from the host memory into local memory.
+     * For device tensors that use a staging ring it downloads the data through the ring.
+     * Other tensors with non-coherent host memory have their mapped memory invalidated.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Declares transfer reads of device tensors and host reads of host
+     * visible tensors, so the data is available once the sequence completes.
+     *
+     * @return Accesses of the operation to the tensors synced
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  private:
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mTensors;
+    std::vector<Tensor::Range> mRanges;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <array>
+
+namespace kp {
+
+/**
+ * Operation that provides a general abstraction that simplifies the use of 
+ * algorithm and parameter components which can be used with shaders.
+ * By default it enables the user to provide a dynamic number of tensors
+ * which are then passed as inputs.
+ */
+class OpAlgoDispatch : public OpBase
+{
+  public:
+
+    /**
+     * Constructor that stores the algorithm to use as well as the relevant
+     * push constants to override when recording.
+     *
+     * @param algorithm The algorithm object to use for dispatch
+     * @param pushConstants The push constants to use for override
+     */
+    template<typename T = float>
+    OpAlgoDispatch(const std::shared_ptr<kp::Algorithm>& algorithm,
+            const std::vector<T>& pushConstants = {})
+    {
+        KP_LOG_DEBUG("Kompute OpAlgoDispatch constructor");
+
+        this->mAlgorithm = algorithm;
+
+        if (pushConstants.size()) {
+            this->setPushConstants(pushConstants.data(),
+                                   pushConstants.size(),
+                                   sizeof(decltype(pushConstants.back())));
+        }
+    }
+
+    /**
+     * Constructor that stores the algorithm to use as well as push constants
+     * of fixed size, checked against the inline storage at compile time.
+     *
+     * @param algorithm The algorithm object to use for dispatch
+     * @param pushConstants The push constants to use for override
+     */
+    template<typename T, size_t N>
+    OpAlgoDispatch(const std::shared_ptr<kp::Algorithm>& algorithm,
+                   const std::array<T, N>& pushConstants)
+    {
+        static_assert(sizeof(T) * N <= KOMPUTE_MAX_PUSH_CONSTANTS_SIZE,
+                      "Kompute OpAlgoDispatch push constants exceed "
+                      "KOMPUTE_MAX_PUSH_CONSTANTS_SIZE");
+
+        KP_LOG_DEBUG("Kompute OpAlgoDispatch constructor");
+
+        this->mAlgorithm = algorithm;
+        this->setPushConstants(pushConstants.data(), N, sizeof(T));
+    }
+
+    /**
+     * Default destructor, which is in charge of destroying the algorithm
+     * components but does not destroy the underlying tensors
+     */
+    virtual ~OpAlgoDispatch() override;
+
+    /**
+     * This records the commands that are to be sent to the GPU, binding the
+     * algorithm and recording the dispatch operation that sends the shader
+     * processing to the gpu. The barriers that ensure the memory is available
+     * to the shader are recorded by the sequence from tensorAccesses.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Does not perform any preEval commands.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void preEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Does not perform any postEval commands.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Declares shader reads and writes to every tensor of the algorithm, or
+     * uniform reads for uniform tensors.
+     *
+     * @return Accesses of the dispatch to the tensors of the algorithm
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  protected:
+    // -------------- ALWAYS OWNED RESOURCES
+    std::shared_ptr<Algorithm> mAlgorithm;
+    alignas(16) uint8_t mPushConstantsData[KOMPUTE_MAX_PUSH_CONSTANTS_SIZE];
+    uint32_t mPushConstantsDataTypeMemorySize = 0;
+    uint32_t mPushConstantsSize = 0;
+
+    void setPushConstants(const void* data, uint32_t size, uint32_t memorySize);
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+namespace kp {
+
+/**
+ * Operation that dispatches an algorithm with the workgroup counts read from
+ * a VkDispatchIndirectCommand stored in a tensor, so a previous shader can
+ * decide the size of the dispatch without a round trip to the host.
+ */
+class OpAlgoDispatchIndirect : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that stores the algorithm to use, the tensor holding the
+     * dispatch command as well as the relevant push constants to override
+     * when recording.
+     *
+     * @param algorithm The algorithm object to use for dispatch
+     * @param indirectTensor Tensor holding the three uint32 workgroup counts
+     * @param offset Offset in bytes of the dispatch command in the tensor,
+     * which has to be a multiple of 4
+     * @param pushConstants The push constants to use for override
+     */
+    template<typename T = float>
+    OpAlgoDispatchIndirect(const std::shared_ptr<kp::Algorithm>& algorithm,
+                           const std::shared_ptr<Tensor>& indirectTensor,
+                           vk::DeviceSize offset = 0,
+                           const std::vector<T>& pushConstants = {})
+      : OpAlgoDispatch(algorithm, pushConstants)
+    {
+        KP_LOG_DEBUG("Kompute OpAlgoDispatchIndirect constructor");
+
+        if (!indirectTensor) {
+            throw std::runtime_error(
+              "Kompute OpAlgoDispatchIndirect indirect tensor is null");
+        }
+        if (indirectTensor->tensorType() == Tensor::TensorTypes::eUniform ||
+            indirectTensor->tensorType() == Tensor::TensorTypes::eImage) {
+            throw std::runtime_error("Kompute OpAlgoDispatchIndirect indirect "
+                                     "tensor cannot be a uniform or image "
+                                     "tensor");
+        }
+        if (offset % 4) {
+            throw std::runtime_error(
+              fmt::format("Kompute OpAlgoDispatchIndirect offset {} is not a "
+                          "multiple of 4",
+                          offset));
+        }
+        if (indirectTensor->memorySize() <
+            offset + sizeof(VkDispatchIndirectCommand)) {
+            throw std::runtime_error(
+              fmt::format("Kompute OpAlgoDispatchIndirect indirect tensor of "
+                          "{} bytes cannot hold a dispatch command at offset "
+                          "{}",
+                          indirectTensor->memorySize(),
+                          offset));
+        }
+
+        this->mIndirectTensor = indirectTensor;
+        this->mOffset = offset;
+    }
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpAlgoDispatchIndirect() override;
+
+    /**
+     * This records the commands that are to be sent to the GPU, binding the
+     * algorithm and recording the indirect dispatch which reads the
+     * workgroup counts from the indirect tensor on execution.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Declares the accesses of the dispatch to the tensors of the algorithm
+     * as well as the indirect command read of the indirect tensor.
+     *
+     * @return Accesses of the dispatch to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<Tensor> mIndirectTensor;
+    vk::DeviceSize mOffset = 0;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+namespace kp {
+
+/**
+ * Operation that dispatches an algorithm several times with different push
+ * constants, binding the pipeline and descriptor set only once and then
+ * recording a push constants and dispatch pair for each set of push
+ * constants of a contiguous array.
+ */
+class OpAlgoDispatchBatch : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that stores the algorithm to use as well as a copy of the
+     * push constants of all the dispatches.
+     *
+     * @param algorithm The algorithm object to use for dispatch
+     * @param pushConstants The push constants of all the dispatches one after
+     * the other, which can be an array of structs matching the push constants
+     * block of the shader
+     * @param constantsPerDispatch The number of elements of pushConstants
+     * used by each dispatch
+     * @param barrierBetweenDispatches Whether to record a memory barrier
+     * between consecutive dispatches, which is required if a dispatch reads
+     * the results of the previous one
+     */
+    template<typename T = float>
+    OpAlgoDispatchBatch(const std::shared_ptr<kp::Algorithm>& algorithm,
+                        const std::vector<T>& pushConstants,
+                        uint32_t constantsPerDispatch = 1,
+                        bool barrierBetweenDispatches = false)
+      : OpAlgoDispatch(algorithm)
+    {
+        KP_LOG_DEBUG("Kompute OpAlgoDispatchBatch constructor");
+
+        if (!constantsPerDispatch ||
+            pushConstants.size() % constantsPerDispatch) {
+            throw std::runtime_error(
+              fmt::format("Kompute OpAlgoDispatchBatch {} push constants "
+                          "cannot be split into dispatches of {}",
+                          pushConstants.size(),
+                          constantsPerDispatch));
+        }
+
+        uint32_t dispatchMemorySize = constantsPerDispatch * sizeof(T);
+        if (dispatchMemorySize > KOMPUTE_MAX_PUSH_CONSTANTS_SIZE) {
+            throw std::runtime_error(
+              fmt::format("Kompute OpAlgoDispatchBatch push constants of {} "
+                          "bytes exceed the maximum of {} bytes",
+                          dispatchMemorySize,
+                          KOMPUTE_MAX_PUSH_CONSTANTS_SIZE));
+        }
+
+        this->mPushConstantsBatch.assign(
+          (const uint8_t*)pushConstants.data(),
+          (const uint8_t*)(pushConstants.data() + pushConstants.size()));
+        this->mDispatchMemorySize = dispatchMemorySize;
+        this->mDispatchCount = pushConstants.size() / constantsPerDispatch;
+        this->mBarrierBetweenDispatches = barrierBetweenDispatches;
+    }
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpAlgoDispatchBatch() override;
+
+    /**
+     * This records the commands that are to be sent to the GPU, binding the
+     * algorithm once and then recording the push constants and dispatch of
+     * each of the dispatches, separated by memory barriers if requested.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Returns the number of dispatches recorded by the operation.
+     *
+     * @return Number of dispatches
+     */
+    uint32_t dispatchCount();
+
+  private:
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<uint8_t> mPushConstantsBatch;
+    uint32_t mDispatchMemorySize = 0;
+    uint32_t mDispatchCount = 0;
+    bool mBarrierBetweenDispatches = false;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+// Largest number of workgroups dispatched by the vectorized OpMult shader,
+// which is the minimum workgroup count limit of every device. The
+// invocations loop over the remaining elements of larger tensors.
+#ifndef KOMPUTE_MULT_MAX_WORKGROUPS
+#define KOMPUTE_MULT_MAX_WORKGROUPS 65535
+#endif
+
+namespace kp {
+
+/**
+ * Operation that performs elementwise multiplication on two float tensors
+ * and outputs on a third tensor.
+ *
+ * When Kompute is built with the shader compiler, a vectorized shader is
+ * compiled in process, where each invocation multiplies four elements at a
+ * time through vec4 loads and stores in a grid-stride loop, with the local
+ * size of the algorithm and at most KOMPUTE_MULT_MAX_WORKGROUPS workgroups.
+ * Either input can then hold a single value that is multiplied with every
+ * element of the other input. Otherwise the prebuilt shader multiplies one
+ * element per workgroup and the inputs need the size of the output.
+ */
+class OpMult : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Default constructor with parameters that provides the bare minimum
+     * requirements for the operations to be able to create and manage their
+     * sub-components.
+     *
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the lhs, rhs and output float tensors, where the lhs and
+     * rhs have either the size of the output or, with the shader compiler, a
+     * single element
+     * @param algorithm An algorithm that will be overridden with the OpMult
+     * shader data and the tensors provided
+     */
+    OpMult(std::vector<std::shared_ptr<Tensor>> tensors,
+           std::shared_ptr<Algorithm> algorithm);
+
+    /**
+     * Default destructor, which is in charge of destroying the algorithm
+     * components but does not destroy the underlying tensors
+     */
+    virtual ~OpMult() override;
+
+    /**
+     * Declares the shader reads of the inputs and the shader write of the
+     * output.
+     *
+     * @return Accesses of the multiplication to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mTensors;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+// Rows of the output accumulated in registers by each invocation, which has
+// to be at most 8 and a power of two
+#ifndef KOMPUTE_MATMUL_WORK_PER_THREAD
+#define KOMPUTE_MATMUL_WORK_PER_THREAD 4
+#endif
+
+// Tile size used when none is provided, which fits the minimum workgroup
+// limits of every device
+#ifndef KOMPUTE_MATMUL_DEFAULT_TILE_SIZE
+#define KOMPUTE_MATMUL_DEFAULT_TILE_SIZE 16
+#endif
+
+// Size of the shared memory tiles of the matrix multiplication shader, which
+// are declared with this fixed size whatever the tile size specialized
+#define KOMPUTE_MATMUL_MAX_TILE_SIZE 32
+
+namespace kp {
+
+/**
+ * Operation that multiplies two row-major float matrices, or two batches of
+ * matrices, into a third tensor with a tiled shader that stages blocks of
+ * the inputs in shared memory and accumulates several outputs per
+ * invocation in registers.
+ *
+ * The output C is M x N and is computed as op(A) * op(B), where op(A) is
+ * M x K and op(B) is K x N. A transposed input is stored with its
+ * dimensions swapped, for example A of K x M when transposeA is set. The
+ * matrices of a batch are stored one after the other in each tensor.
+ *
+ * Only the tile size of C and the local size are specialization constants.
+ * The shared memory tiles of A and B are arrays of a fixed
+ * KOMPUTE_MATMUL_MAX_TILE_SIZE x KOMPUTE_MATMUL_MAX_TILE_SIZE floats, so
+ * every tile size reserves 8 KB of shared memory per workgroup, and tiles
+ * larger than 32 x 32 require changing the shader.
+ */
+class OpMatMul : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that overrides the algorithm with the matrix
+     * multiplication shader, specialized for the tile size, and the tensors
+     * provided.
+     *
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the float tensors A, B and C
+     * @param algorithm An algorithm that will be overridden with the OpMatMul
+     * shader data and the tensors provided
+     * @param m Rows of op(A) and C
+     * @param n Columns of op(B) and C
+     * @param k Columns of op(A) and rows of op(B)
+     * @param transposeA Whether A is stored transposed as a K x M matrix
+     * @param transposeB Whether B is stored transposed as a N x K matrix
+     * @param batchCount The number of matrix multiplications of the batch
+     * @param tileSize The size of the square tiles of C computed by each
+     * workgroup, a power of two between KOMPUTE_MATMUL_WORK_PER_THREAD and
+     * KOMPUTE_MATMUL_MAX_TILE_SIZE, or 0 for
+     * KOMPUTE_MATMUL_DEFAULT_TILE_SIZE. The largest size supported by a
+     * device is returned by tileSizeForDevice.
+     */
+    OpMatMul(const std::vector<std::shared_ptr<Tensor>>& tensors,
+             const std::shared_ptr<Algorithm>& algorithm,
+             uint32_t m,
+             uint32_t n,
+             uint32_t k,
+             bool transposeA = false,
+             bool transposeB = false,
+             uint32_t batchCount = 1,
+             uint32_t tileSize = 0);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpMatMul() override;
+
+    /**
+     * Declares the shader reads of A and B as well as the shader write of C.
+     *
+     * @return Accesses of the matrix multiplication to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+    /**
+     * Returns the largest tile size whose workgroups fit the compute limits
+     * of a device, which is the fastest on most devices.
+     *
+     * @param properties The properties of the physical device
+     * @return The tile size to provide to the constructor
+     */
+    static uint32_t tileSizeForDevice(
+      const vk::PhysicalDeviceProperties& properties);
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mTensors;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+/*
+    THIS FILE HAS BEEN AUTOMATICALLY GENERATED - DO NOT EDIT
+
+    ---
+
+    Copyright 2020 The Institute for Ethical AI & Machine Learning
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef SHADEROP_SHADEROPCONV2D_HPP
+#define SHADEROP_SHADEROPCONV2D_HPP
+
+namespace kp {
+namespace shader_data {
+static const unsigned char shaders_glsl_opconv2d_comp_spv[] = {
+  0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x39, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73,
+  0x6f, 0x72, 0x57, 0x65, 0x69, 0x67, 0x68, 0x74, 0x73, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x57, 0x65, 0x69, 0x67, 0x68, 0x74,
+  0x73, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x42, 0x69, 0x61, 0x73, 0x00, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x42, 0x69, 0x61, 0x73, 0x00, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73,
+  0x6f, 0x72, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x50, 0x75, 0x73, 0x68, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74,
+  0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x43, 0x00, 0x06, 0x00, 0x04, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x48, 0x00,
+  0x06, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x69, 0x6e, 0x57, 0x00, 0x06, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x43, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x6f, 0x75, 0x74, 0x48, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x57,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x59, 0x00,
+  0x06, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x58, 0x00, 0x06, 0x00, 0x05, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x70, 0x61, 0x64, 0x59,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x70, 0x61, 0x64, 0x58, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x70, 0x63, 0x73, 0x00,
+  0x05, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x4c,
+  0x6f, 0x63, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x49, 0x44, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x57, 0x6f, 0x72, 0x6b, 0x47,
+  0x72, 0x6f, 0x75, 0x70, 0x49, 0x44, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x4e, 0x75, 0x6d, 0x57, 0x6f,
+  0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x07, 0x00, 0x10, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x57,
+  0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x53, 0x69, 0x7a, 0x65,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x57, 0x4f, 0x52, 0x4b, 0x5f, 0x50, 0x45, 0x52, 0x5f, 0x54, 0x48, 0x52,
+  0x45, 0x41, 0x44, 0x00, 0x05, 0x00, 0x05, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x4b, 0x45, 0x52, 0x4e, 0x45, 0x4c, 0x5f, 0x48, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x4b, 0x45, 0x52, 0x4e,
+  0x45, 0x4c, 0x5f, 0x57, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x43, 0x48, 0x41, 0x4e, 0x4e, 0x45, 0x4c, 0x53,
+  0x5f, 0x4c, 0x41, 0x53, 0x54, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x41, 0x43, 0x54, 0x49, 0x56, 0x41, 0x54, 0x49,
+  0x4f, 0x4e, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x48, 0x41, 0x53, 0x5f, 0x42, 0x49, 0x41, 0x53, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x74, 0x69, 0x6c, 0x65,
+  0x41, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x74, 0x69, 0x6c, 0x65, 0x42, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x61, 0x63, 0x63, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x6b, 0x30, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x6b, 0x6b, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x72, 0x6f, 0x77, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x02, 0x00, 0x24, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x04, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x03, 0x00, 0x20, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x0e, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x35, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x08, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x32, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x32, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x33, 0x00, 0x06, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x32, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x32, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x32, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x32, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x32, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x35, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x35, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x35, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x35, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x35, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x35, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x35, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x35, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x35, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x35, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x35, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x36, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x79, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x63, 0x00, 0x00, 0x00, 0xab, 0x00, 0x05, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x7f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0xab, 0x00, 0x05, 0x00, 0x29, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x05, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x82, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x84, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x83, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x87, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0xab, 0x00, 0x05, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x89, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0x8a, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x8c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x8f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x91, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0x92, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x94, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x29, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x97, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x91, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x9f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xa1, 0x00, 0x00, 0x00,
+  0xa2, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xa2, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0xa4, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xa6, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xa7, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xa9, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0xac, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0xab, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0xb1, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0xa7, 0x00, 0x05, 0x00, 0x29, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xb3, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb3, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x03, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0xb2, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb5, 0x00, 0x00, 0x00,
+  0x86, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0xaf, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x86, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x89, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x86, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x89, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x89, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xbc, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00,
+  0x7f, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00,
+  0x86, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0xb6, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x89, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0xbf, 0x00, 0x00, 0x00, 0x86, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xc1, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0xc1, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x89, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xc4, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00,
+  0xc4, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00,
+  0xbd, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x82, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0xc6, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0xae, 0x00, 0x05, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0xca, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0xa7, 0x00, 0x05, 0x00, 0x29, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00,
+  0xc9, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0xae, 0x00, 0x05, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0xcd, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0xa7, 0x00, 0x05, 0x00, 0x29, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
+  0xcc, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x05, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00,
+  0xce, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xd0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xcf, 0x00, 0x00, 0x00,
+  0xd1, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xd1, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xd2, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00,
+  0xd2, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xd5, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00,
+  0xba, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xd8, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00,
+  0xd8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0xd5, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0xda, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0xdc, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0xdb, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0xdd, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xd0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xd0, 0x00, 0x00, 0x00,
+  0xf5, 0x00, 0x07, 0x00, 0x28, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00,
+  0xdd, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0xb5, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00,
+  0xd0, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00,
+  0xad, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0xe2, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0xe2, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0xe5, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0xa7, 0x00, 0x05, 0x00, 0x29, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00,
+  0xe4, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xe6, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xea, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x33, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00,
+  0xeb, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xe7, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00,
+  0xe8, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00,
+  0xad, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xf1, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0xf2, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xf3, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0xf4, 0x00, 0x00, 0x00,
+  0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xf6, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xf6, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00,
+  0xf4, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xf9, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0xfb, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
+  0xfb, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0xfe, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xff, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x29, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x03, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x08, 0x01, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x0b, 0x01, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x00,
+  0x85, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00,
+  0x0d, 0x01, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x00,
+  0x10, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x0e, 0x01, 0x00, 0x00,
+  0x11, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x01, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x01, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00,
+  0x12, 0x01, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xf5, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x14, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x15, 0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xf3, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x9e, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x9e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x16, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x17, 0x01, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x17, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x18, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0x19, 0x01, 0x00, 0x00, 0x1a, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x1b, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x29, 0x00, 0x00, 0x00, 0x1d, 0x01, 0x00, 0x00,
+  0x1c, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x1d, 0x01, 0x00, 0x00, 0x1e, 0x01, 0x00, 0x00, 0x19, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x1e, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00,
+  0x1f, 0x01, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x21, 0x01, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x20, 0x01, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x22, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x21, 0x01, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x29, 0x00, 0x00, 0x00, 0x23, 0x01, 0x00, 0x00,
+  0x22, 0x01, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x05, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0x23, 0x01, 0x00, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x25, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x24, 0x01, 0x00, 0x00,
+  0x26, 0x01, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x26, 0x01, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x27, 0x01, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00,
+  0x27, 0x01, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x29, 0x01, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0xb8, 0x00, 0x05, 0x00, 0x29, 0x00, 0x00, 0x00, 0x2a, 0x01, 0x00, 0x00,
+  0x29, 0x01, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x05, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x2b, 0x01, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x2a, 0x01, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x2c, 0x01, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x00, 0x2d, 0x01, 0x00, 0x00,
+  0x2b, 0x01, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2e, 0x01, 0x00, 0x00,
+  0x22, 0x01, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x2f, 0x01, 0x00, 0x00, 0x2e, 0x01, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x30, 0x01, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0x31, 0x01, 0x00, 0x00,
+  0x30, 0x01, 0x00, 0x00, 0x22, 0x01, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x2f, 0x01, 0x00, 0x00, 0x31, 0x01, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x32, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x34, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x33, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x34, 0x01, 0x00, 0x00,
+  0x2d, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x25, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x25, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x1a, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x1a, 0x01, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x36, 0x01, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x18, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x19, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x8b, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x37, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00,
+  0x37, 0x01, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x8a, 0x00, 0x00, 0x00,
+  0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00
+};
+static const unsigned int shaders_glsl_opconv2d_comp_spv_len = 7940;
+}
+}
+#endif // define SHADEROP_SHADEROPCONV2D_HPP
+
+// Largest number of workgroups dispatched along the pixels of an image,
+// which is the minimum workgroup count limit of every device. The
+// workgroups loop over the remaining tiles of larger images.
+#ifndef KOMPUTE_CONV2D_MAX_WORKGROUPS
+#define KOMPUTE_CONV2D_MAX_WORKGROUPS 65535
+#endif
+
+namespace kp {
+
+/**
+ * Operation that computes the two dimensional convolution of a batch of
+ * float images, with an optional bias and a fused relu or leaky relu
+ * activation, as an implicit matrix multiplication that gathers the input
+ * windows while loading the shared memory tiles of the OpMatMul shader
+ * design, so the images are never expanded in memory.
+ *
+ * The images are stored NCHW or NHWC. The weights are stored
+ * [outChannels][inChannels][kernelHeight][kernelWidth] for NCHW images and
+ * [outChannels][kernelHeight][kernelWidth][inChannels] for NHWC images,
+ * and the bias holds one value per output channel.
+ */
+class OpConv2D : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Memory layout of the input and output images.
+     */
+    enum class Layout
+    {
+        eNCHW = 0,
+        eNHWC = 1,
+    };
+
+    /**
+     * Activation applied to the outputs of the convolution.
+     */
+    enum class Activation
+    {
+        eNone = 0,
+        eRelu = 1,
+        eLeakyRelu = 2,
+    };
+
+    /**
+     * Constructor that overrides the algorithm with the convolution shader,
+     * specialized for the kernel size, layout and activation, and the
+     * tensors provided.
+     *
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the float input, weights, optionally bias and output
+     * @param algorithm An algorithm that will be overridden with the
+     * OpConv2D shader data and the tensors provided
+     * @param batch The number of images of the input and output
+     * @param inChannels The channels of the input images
+     * @param inHeight The height of the input images
+     * @param inWidth The width of the input images
+     * @param outChannels The channels of the output images
+     * @param kernelHeight The height of the kernel window
+     * @param kernelWidth The width of the kernel window
+     * @param stride The step of the kernel window along both dimensions
+     * @param padding The zeros added around the input images along both
+     * dimensions
+     * @param layout The memory layout of the input and output images
+     * @param activation The activation applied to the outputs
+     * @param alpha The slope of the negative outputs of eLeakyRelu
+     * @param tileSize The size of the square tiles of output pixels by
+     * output channels computed by each workgroup, as described by OpMatMul,
+     * or 0 for KOMPUTE_MATMUL_DEFAULT_TILE_SIZE
+     */
+    OpConv2D(const std::vector<std::shared_ptr<Tensor>>& tensors,
+             const std::shared_ptr<Algorithm>& algorithm,
+             uint32_t batch,
+             uint32_t inChannels,
+             uint32_t inHeight,
+             uint32_t inWidth,
+             uint32_t outChannels,
+             uint32_t kernelHeight,
+             uint32_t kernelWidth,
+             uint32_t stride = 1,
+             uint32_t padding = 0,
+             Layout layout = Layout::eNCHW,
+             Activation activation = Activation::eNone,
+             float alpha = 0.01,
+             uint32_t tileSize = 0);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpConv2D() override;
+
+    /**
+     * Declares the shader reads of the input, weights and bias as well as
+     * the shader write of the output.
+     *
+     * @return Accesses of the convolution to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+    /**
+     * Returns the size of a dimension of the output images.
+     *
+     * @param inSize The size of the dimension of the input images
+     * @param kernelSize The size of the kernel window along the dimension
+     * @param stride The step of the kernel window
+     * @param padding The zeros added on both sides of the dimension
+     * @return The size of the dimension of the output, 0 when the kernel
+     * window is larger than the padded input
+     */
+    static uint32_t outputSize(uint32_t inSize,
+                               uint32_t kernelSize,
+                               uint32_t stride = 1,
+                               uint32_t padding = 0);
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mTensors;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+/*
+    THIS FILE HAS BEEN AUTOMATICALLY GENERATED - DO NOT EDIT
+
+    ---
+
+    Copyright 2020 The Institute for Ethical AI & Machine Learning
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef SHADEROP_SHADEROPSPMV_HPP
+#define SHADEROP_SHADEROPSPMV_HPP
+
+namespace kp {
+namespace shader_data {
+static const unsigned char shaders_glsl_opspmv_comp_spv[] = {
+  0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x52, 0x6f, 0x77, 0x50, 0x6f, 0x69,
+  0x6e, 0x74, 0x65, 0x72, 0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x6f, 0x77, 0x50,
+  0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x43, 0x6f,
+  0x6c, 0x75, 0x6d, 0x6e, 0x49, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x00,
+  0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x49, 0x6e, 0x64, 0x69, 0x63, 0x65,
+  0x73, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x00, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73,
+  0x6f, 0x72, 0x58, 0x00, 0x06, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x58, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73,
+  0x6f, 0x72, 0x59, 0x00, 0x06, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x59, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x75, 0x73, 0x68,
+  0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x72, 0x6f, 0x77, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x70, 0x63, 0x73, 0x00, 0x05, 0x00, 0x05, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6c, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x67, 0x6c, 0x5f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f,
+  0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x4e,
+  0x75, 0x6d, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x67, 0x6c, 0x5f, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70,
+  0x49, 0x44, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x67, 0x6c, 0x5f, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72, 0x6f, 0x75, 0x70,
+  0x53, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x03, 0x00, 0x19, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x03, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x32, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x32, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x32, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x33, 0x00, 0x06, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x25, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x86, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x47, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x58, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0xf5, 0x00, 0x07, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x61, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x62, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x31, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x5b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x69, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x6a, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xac, 0x00, 0x05, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x6f, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x6a, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x73, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x46, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x71, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x86, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x6a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x05, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x7b, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x7b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x7a, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00,
+  0x38, 0x00, 0x01, 0x00
+};
+static const unsigned int shaders_glsl_opspmv_comp_spv_len = 3568;
+}
+}
+#endif // define SHADEROP_SHADEROPSPMV_HPP
+
+// Invocations of the workgroups of the sparse matrix vector product, which
+// is the size of the shared memory of the shader
+#define KOMPUTE_SPMV_LOCAL_SIZE 64
+
+// Invocations reducing a row when none is provided are chosen from the
+// average non zeros per row, up to this limit
+#ifndef KOMPUTE_SPMV_MAX_LANES_PER_ROW
+#define KOMPUTE_SPMV_MAX_LANES_PER_ROW 32
+#endif
+
+// Largest number of workgroups dispatched along the rows, which is the
+// minimum workgroup count limit of every device. The workgroups loop over
+// the remaining rows of larger matrices.
+#ifndef KOMPUTE_SPMV_MAX_WORKGROUPS
+#define KOMPUTE_SPMV_MAX_WORKGROUPS 65535
+#endif
+
+namespace kp {
+
+/**
+ * Operation that multiplies a sparse CSR matrix A by a dense float vector x
+ * into a float vector y, as y = A * x. The rows are split across the
+ * invocations of the workgroups, each row being reduced by a group of
+ * invocations that stride over its non zeros, so rows with many non zeros
+ * are spread over several invocations while short rows share a workgroup.
+ */
+class OpSpMV : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that overrides the algorithm with the sparse matrix vector
+     * product shader and the tensors provided.
+     *
+     * @param matrix The sparse matrix A of rows x columns
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the float tensors x, of at least columns elements, and
+     * y, of at least rows elements
+     * @param algorithm An algorithm that will be overridden with the OpSpMV
+     * shader data and the tensors provided
+     * @param lanesPerRow The invocations reducing each row, a power of two of
+     * at most KOMPUTE_SPMV_LOCAL_SIZE, or 0 to choose it from the average
+     * non zeros per row
+     */
+    OpSpMV(const std::shared_ptr<SparseTensor>& matrix,
+           const std::vector<std::shared_ptr<Tensor>>& tensors,
+           const std::shared_ptr<Algorithm>& algorithm,
+           uint32_t lanesPerRow = 0);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpSpMV() override;
+
+    /**
+     * Declares the shader reads of the matrix and x as well as the shader
+     * write of y.
+     *
+     * @return Accesses of the product to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+    /**
+     * Returns the invocations reducing each row chosen for a matrix, which
+     * is the power of two closest above its average non zeros per row, up
+     * to KOMPUTE_SPMV_MAX_LANES_PER_ROW.
+     *
+     * @param rows The number of rows of the matrix
+     * @param nonZeroCount The number of non zeros of the matrix
+     * @return The invocations per row
+     */
+    static uint32_t lanesPerRowFor(uint32_t rows, uint32_t nonZeroCount);
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mTensors;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+/*
+    THIS FILE HAS BEEN AUTOMATICALLY GENERATED - DO NOT EDIT
+
+    ---
+
+    Copyright 2020 The Institute for Ethical AI & Machine Learning
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef SHADEROP_SHADEROPSPMM_HPP
+#define SHADEROP_SHADEROPSPMM_HPP
+
+namespace kp {
+namespace shader_data {
+static const unsigned char shaders_glsl_opspmm_comp_spv[] = {
+  0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x06, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73,
+  0x6f, 0x72, 0x52, 0x6f, 0x77, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72,
+  0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x72, 0x6f, 0x77, 0x50, 0x6f, 0x69, 0x6e, 0x74,
+  0x65, 0x72, 0x73, 0x00, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x43, 0x6f, 0x6c, 0x75, 0x6d, 0x6e,
+  0x49, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x00, 0x06, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6c, 0x75,
+  0x6d, 0x6e, 0x49, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73,
+  0x6f, 0x72, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x42, 0x00,
+  0x06, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x42, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x43, 0x00,
+  0x06, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x43, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x50, 0x75, 0x73, 0x68, 0x43, 0x6f, 0x6e, 0x73,
+  0x74, 0x61, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x6f, 0x77, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x70, 0x63, 0x73, 0x00, 0x05, 0x00, 0x08, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61,
+  0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49,
+  0x44, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x67, 0x6c, 0x5f, 0x4e, 0x75, 0x6d, 0x57, 0x6f, 0x72, 0x6b, 0x47, 0x72,
+  0x6f, 0x75, 0x70, 0x73, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x57, 0x6f, 0x72, 0x6b, 0x47,
+  0x72, 0x6f, 0x75, 0x70, 0x53, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x02, 0x00, 0x16, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x04, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x04, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x32, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x33, 0x00, 0x06, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0xf5, 0x00, 0x07, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0x42, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0xf5, 0x00, 0x07, 0x00, 0x18, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x4e, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x53, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x25, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x40, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x35, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00,
+  0x38, 0x00, 0x01, 0x00
+};
+static const unsigned int shaders_glsl_opspmm_comp_spv_len = 2824;
+}
+}
+#endif // define SHADEROP_SHADEROPSPMM_HPP
+
+// Invocations of the workgroups of the sparse matrix product, spread over
+// the columns and rows of the output
+#define KOMPUTE_SPMM_LOCAL_SIZE 64
+
+// Largest number of workgroups dispatched along the rows, which is the
+// minimum workgroup count limit of every device. The workgroups loop over
+// the remaining rows of larger matrices.
+#ifndef KOMPUTE_SPMM_MAX_WORKGROUPS
+#define KOMPUTE_SPMM_MAX_WORKGROUPS 65535
+#endif
+
+namespace kp {
+
+/**
+ * Operation that multiplies a sparse CSR matrix A by a dense row-major float
+ * matrix B into a dense row-major float matrix C, as C = A * B. Each
+ * invocation computes an element of C from the non zeros of its row of A,
+ * and the invocations of a workgroup cover consecutive columns so they read
+ * consecutive elements of B. Narrow matrices put several rows of C in each
+ * workgroup instead of leaving invocations idle.
+ */
+class OpSpMM : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that overrides the algorithm with the sparse matrix
+     * product shader and the tensors provided.
+     *
+     * @param matrix The sparse matrix A of rows x columns
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the float tensors B, of columns x n elements, and C, of
+     * rows x n elements
+     * @param algorithm An algorithm that will be overridden with the OpSpMM
+     * shader data and the tensors provided
+     * @param n Columns of B and C
+     */
+    OpSpMM(const std::shared_ptr<SparseTensor>& matrix,
+           const std::vector<std::shared_ptr<Tensor>>& tensors,
+           const std::shared_ptr<Algorithm>& algorithm,
+           uint32_t n);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpSpMM() override;
+
+    /**
+     * Declares the shader reads of the matrix and B as well as the shader
+     * write of C.
+     *
+     * @return Accesses of the product to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mTensors;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+// Upper bound of the workgroups dispatched by a reduction, past which every
+// invocation accumulates several elements before the workgroup reduction
+#ifndef KOMPUTE_REDUCE_MAX_WORKGROUPS
+#define KOMPUTE_REDUCE_MAX_WORKGROUPS 1024
+#endif
+
+// Size of the shared memory partials array of the reduction shaders
+#define KOMPUTE_REDUCE_MAX_LOCAL_SIZE 1024
+
+namespace kp {
+
+/**
+ * Operation that reduces all the elements of a float tensor into a small
+ * output tensor, so only the result has to be read back by the host.
+ *
+ * Each workgroup reduces a strided slice of the input and combines its
+ * partial result atomically into the output, which the operation
+ * initialises with the identity of the reduction. The workgroup reduction
+ * either uses subgroup arithmetic, which requires the device to support the
+ * basic and arithmetic subgroup operations in compute shaders as reported by
+ * Manager::supportsSubgroupOperations, or a fallback reduction in shared
+ * memory that runs on any device.
+ */
+class OpReduce : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Reduction performed by the operation.
+     */
+    enum class Operation
+    {
+        eSum = 0,
+        eMin = 1,
+        eMax = 2,
+        eArgmax = 3, ///< Stores the float bits of the maximum in the first
+                     ///< element of a uint32 output and the first index of
+                     ///< the maximum in the second element
+    };
+
+    /**
+     * Constructor that overrides the algorithm with the reduction shader and
+     * the tensors provided.
+     *
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the float input and output of the reduction, or a uint32
+     * output of at least 2 elements for eArgmax
+     * @param algorithm An algorithm that will be overridden with the OpReduce
+     * shader data and the tensors provided
+     * @param operation The reduction to perform
+     * @param subgroupArithmetic Whether to use the subgroup arithmetic variant
+     * of the shader, which is only valid if the device supports it
+     * @param syncLocal Whether to also read the output back into the host
+     * memory of the tensor, as an OpTensorSyncLocal recorded after the
+     * reduction would
+     */
+    OpReduce(const std::vector<std::shared_ptr<Tensor>>& tensors,
+             const std::shared_ptr<Algorithm>& algorithm,
+             Operation operation = Operation::eSum,
+             bool subgroupArithmetic = false,
+             bool syncLocal = false);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpReduce() override;
+
+    /**
+     * Records the initialisation of the output with the identity of the
+     * reduction, which the workgroups then combine their partial results
+     * with, followed by the dispatch of the reduction. For eArgmax a second
+     * dispatch finds the index of the maximum. The copy of the output to the
+     * host is recorded last if syncLocal was set.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Makes the output available in the host memory of the tensor if
+     * syncLocal was set.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Declares the shader read of the input as well as the transfer write
+     * and shader accesses of the output, and its transfer or host read if
+     * syncLocal was set.
+     *
+     * @return Accesses of the reduction to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<Tensor> mInput;
+    std::shared_ptr<Tensor> mOutput;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    Operation mOperation;
+    bool mSyncLocal;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+// Upper bound of the workgroups dispatched by the block passes of a scan,
+// past which every workgroup processes several blocks
+#ifndef KOMPUTE_SCAN_MAX_WORKGROUPS
+#define KOMPUTE_SCAN_MAX_WORKGROUPS 1024
+#endif
+
+// Elements scanned by a workgroup in a block, which is fixed by the local
+// size and elements per invocation of the scan shaders
+#define KOMPUTE_SCAN_BLOCK_SIZE 1024
+
+namespace kp {
+
+/**
+ * Operation that computes the inclusive or exclusive prefix sum of a 32-bit
+ * float, int32 or uint32 tensor.
+ *
+ * The scan uses a reduce-then-scan in three dispatches of the same pipeline,
+ * which runs on any device: the first reduces every block of
+ * KOMPUTE_SCAN_BLOCK_SIZE elements into a partials tensor, the second scans
+ * the partials with a single workgroup and the third scans every block again
+ * starting from its partial. The partials tensor is scratch memory provided
+ * by the caller, of at least partialsSize elements of the input.
+ */
+class OpScan : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that overrides the algorithm with the scan shader and the
+     * tensors provided.
+     *
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the input, the output of the same data type and at least
+     * the same size, and the 32-bit partials tensor. The input and the output
+     * can be the same tensor to scan in place
+     * @param algorithm An algorithm that will be overridden with the OpScan
+     * shader data and the tensors provided
+     * @param inclusive Whether every output element includes the input
+     * element at the same index, otherwise the scan is exclusive and the
+     * first output element is zero
+     */
+    OpScan(const std::vector<std::shared_ptr<Tensor>>& tensors,
+           const std::shared_ptr<Algorithm>& algorithm,
+           bool inclusive = true);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpScan() override;
+
+    /**
+     * Records the three passes of the scan, with barriers on the partials
+     * tensor in between.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Returns the number of elements of the partials tensor required to scan
+     * an input of the size provided, which is one per block.
+     *
+     * @param size The number of elements of the input
+     * @return The minimum number of elements of the partials tensor
+     */
+    static uint32_t partialsSize(uint32_t size);
+
+  protected:
+    /**
+     * Constructor for the operations that run the passes of the scan with a
+     * shader of their own, which have to call setupPasses once the algorithm
+     * is rebuilt.
+     *
+     * @param algorithm The algorithm object to use for dispatch
+     */
+    OpScan(const std::shared_ptr<Algorithm>& algorithm);
+
+    /**
+     * Validates the partials tensor and sizes the dispatches of the block
+     * passes for an input of the size provided.
+     *
+     * @param partials The partials tensor of the scan
+     * @param size The number of elements of the input
+     * @param pushConstants The push constants of the shader, of which the
+     * first is set to the index of each pass when recording
+     * @param name The name of the operation used in errors
+     */
+    void setupPasses(const std::shared_ptr<Tensor>& partials,
+                     uint32_t size,
+                     const std::vector<uint32_t>& pushConstants,
+                     const std::string& name);
+
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<Tensor> mPartials;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    Workgroup mBlockWorkgroup;
+    std::vector<uint32_t> mPassPushConstants;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+namespace kp {
+
+/**
+ * Operation that compacts the elements of a 32-bit tensor whose flag is not
+ * zero into the front of an output tensor, keeping their order, so a
+ * filtering stage doesn't have to read its results back to the host.
+ *
+ * The destination of every element kept is found with the reduce-then-scan
+ * passes of OpScan on the flags. The number of elements kept is written to a
+ * count tensor of at least 4 uint32 elements: the first 3 are a
+ * VkDispatchIndirectCommand with one invocation per element kept for a local
+ * size of indirectLocalSize, which can be passed as it is to
+ * OpAlgoDispatchIndirect, and the fourth is the number of elements kept.
+ */
+class OpCompact : public OpScan
+{
+  public:
+    /**
+     * Constructor that overrides the algorithm with the compaction shader and
+     * the tensors provided.
+     *
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the 32-bit values, the int32 or uint32 flags of the same
+     * size, the output of the data type of the values and at least their
+     * size, the uint32 count tensor and the 32-bit partials tensor of at least
+     * OpScan::partialsSize elements
+     * @param algorithm An algorithm that will be overridden with the
+     * OpCompact shader data and the tensors provided
+     * @param indirectLocalSize The local size of the algorithm dispatched
+     * with the dispatch command of the count tensor, usually its
+     * Algorithm::getLocalSizeX
+     */
+    OpCompact(const std::vector<std::shared_ptr<Tensor>>& tensors,
+              const std::shared_ptr<Algorithm>& algorithm,
+              uint32_t indirectLocalSize = 1);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpCompact() override;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+// Upper bound of the workgroups dispatched by the passes of a sort, past
+// which every workgroup sorts several blocks
+#ifndef KOMPUTE_SORT_MAX_WORKGROUPS
+#define KOMPUTE_SORT_MAX_WORKGROUPS 1024
+#endif
+
+// Bits of the keys sorted by every digit of the sort shader
+#define KOMPUTE_SORT_RADIX_BITS 4
+
+namespace kp {
+
+class Manager;
+
+/**
+ * Operation that sorts a uint32, int32 or float tensor of keys in ascending
+ * order, optionally reordering a 32-bit payload tensor of the same size with
+ * the keys. The sort is stable, so equal keys keep the order of their
+ * payloads.
+ *
+ * It is a least significant digit radix sort of KOMPUTE_SORT_RADIX_BITS per
+ * digit, where every digit counts the digits of every block of keys into
+ * histograms, scans them with an OpScan and scatters the keys to their
+ * destinations, all recorded into the same command buffer. The operation
+ * creates and owns the scratch tensors it needs, which are eStorage tensors
+ * of the manager, so it holds memory for about twice the keys and payload.
+ */
+class OpSort : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that creates the algorithms and scratch tensors of the
+     * sort with the manager provided.
+     *
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the keys and optionally the payload
+     * @param manager The manager used to create the algorithms and scratch
+     * tensors, which is only used in the constructor
+     */
+    OpSort(const std::vector<std::shared_ptr<Tensor>>& tensors,
+           Manager& manager);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors but
+     * releases the scratch tensors of the operation
+     */
+    virtual ~OpSort() override;
+
+    /**
+     * Records the histogram, scan and scatter passes of every digit, with
+     * memory barriers in between.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Declares the shader reads and writes of the keys and the payload, as
+     * the scratch tensors are private to the operation.
+     *
+     * @return Accesses of the sort to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<Tensor> mKeys;
+    std::shared_ptr<Tensor> mPayload;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::shared_ptr<Tensor> mKeysScratch;
+    std::shared_ptr<Tensor> mPayloadScratch;
+    std::shared_ptr<Tensor> mHistograms;
+    std::shared_ptr<Tensor> mPartials;
+    std::shared_ptr<OpScan> mScan;
+
+    void recordPass(const vk::CommandBuffer& commandBuffer,
+                    uint32_t pass,
+                    uint32_t shift);
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+/*
+    THIS FILE HAS BEEN AUTOMATICALLY GENERATED - DO NOT EDIT
+
+    ---
+
+    Copyright 2020 The Institute for Ethical AI & Machine Learning
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#ifndef SHADEROP_SHADEROPLOGISTICREGRESSION_HPP
+#define SHADEROP_SHADEROPLOGISTICREGRESSION_HPP
+
+namespace kp {
+namespace shader_data {
+static const unsigned char shaders_glsl_oplogisticregression_comp_spv[] = {
+  0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xc2, 0x01, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x4c,
+  0x6f, 0x63, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x49, 0x44, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x00,
+  0x05, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x46, 0x45, 0x41, 0x54,
+  0x55, 0x52, 0x45, 0x53, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x57, 0x6f, 0x72, 0x6b, 0x47,
+  0x72, 0x6f, 0x75, 0x70, 0x53, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 0x61,
+  0x6d, 0x65, 0x74, 0x65, 0x72, 0x73, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6c, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x50, 0x75, 0x73, 0x68, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74,
+  0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x73, 0x00, 0x00,
+  0x06, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x6c, 0x65, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x52, 0x61, 0x74, 0x65,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x70, 0x63, 0x73, 0x00, 0x05, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x67, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x73, 0x73,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x73, 0x63, 0x61, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x58, 0x00,
+  0x06, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x58, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x59, 0x00,
+  0x06, 0x00, 0x05, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x59, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x57, 0x65,
+  0x69, 0x67, 0x68, 0x74, 0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x73, 0x57, 0x65, 0x69, 0x67, 0x68, 0x74, 0x73, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x03, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73,
+  0x6f, 0x72, 0x42, 0x69, 0x61, 0x73, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x73, 0x42, 0x69, 0x61, 0x73, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x4c, 0x6f,
+  0x73, 0x73, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x4c, 0x6f,
+  0x73, 0x73, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x05, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x02, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x25, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x08, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f,
+  0x1d, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x03, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x31, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x32, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x03, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x33, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x34, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x32, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x32, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x33, 0x00, 0x06, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x34, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x38, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x3d, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x04, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x3b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x44, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0xb2, 0x00, 0x05, 0x00, 0x21, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x52, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x53, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x59, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x35, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x5a, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x55, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0x56, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x4f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x4f, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+  0x51, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x4d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x4e, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x04, 0x00, 0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x62, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x62, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x63, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x66, 0x00, 0x00, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x68, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x6b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x05, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x6a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x6a, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x43, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x68, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x69, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x71, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x74, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x76, 0x00, 0x00, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x79, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x45, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x7b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x7b, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x7e, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x7d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x7d, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00,
+  0x7f, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x7b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x46, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x93, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x96, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x96, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x98, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x98, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x94, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00,
+  0x7a, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x9f, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x95, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0xa1, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x93, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x94, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xa3, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00,
+  0x92, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xa2, 0x00, 0x00, 0x00,
+  0xa4, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xa5, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xa7, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00,
+  0x7f, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0xa9, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xab, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00,
+  0xa7, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00,
+  0xae, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x73, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00,
+  0x75, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x47, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0xb5, 0x00, 0x00, 0x00,
+  0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x05, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0xb9, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0xb9, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00,
+  0xb5, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xba, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0xbd, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x48, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xbe, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0xbf, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xc1, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0xc3, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0xc3, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00,
+  0xbf, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xc4, 0x00, 0x00, 0x00,
+  0xc4, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00,
+  0xc2, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x05, 0x00, 0x21, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xc2, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0xca, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0xa7, 0x00, 0x05, 0x00, 0x21, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xcb, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xcf, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0xc9, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xd1, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00,
+  0xd1, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xce, 0x00, 0x00, 0x00,
+  0xd2, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xcc, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0xd3, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x48, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xbf, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0xd4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0xf7, 0x00, 0x03, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00,
+  0xd5, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xd6, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x3b, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xdb, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00,
+  0xd9, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xda, 0x00, 0x00, 0x00,
+  0xdc, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xd5, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xd5, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xb6, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb6, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb5, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00,
+  0x63, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00,
+  0x65, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xe0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xdf, 0x00, 0x00, 0x00,
+  0xe1, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xe1, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xe2, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xe3, 0x00, 0x00, 0x00,
+  0xe2, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xe4, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xe4, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x04, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xe7, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x21, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00,
+  0xe8, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xe9, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xea, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x05, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0xec, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0xef, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x21, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0xef, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x05, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xf2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xf1, 0x00, 0x00, 0x00,
+  0xf3, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xf3, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0xf4, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00,
+  0xf4, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0xf2, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0xf2, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x04, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xe6, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xe6, 0x00, 0x00, 0x00,
+  0xc4, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00,
+  0xe8, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x49, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xe4, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xe5, 0x00, 0x00, 0x00,
+  0xaa, 0x00, 0x05, 0x00, 0x21, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+  0x3b, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xfe, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+  0xb3, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x35, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xfb, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0xe0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xe0, 0x00, 0x00, 0x00,
+  0xe0, 0x00, 0x04, 0x00, 0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x61, 0x00, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x61, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x5f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x03, 0x01, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x06, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x06, 0x01, 0x00, 0x00,
+  0x3d, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x05, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x08, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x04, 0x00, 0x08, 0x01, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x09, 0x01, 0x00, 0x00,
+  0x41, 0x00, 0x05, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00,
+  0xb0, 0x00, 0x05, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+  0x0d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+  0x0c, 0x01, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+  0x10, 0x01, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+  0x0d, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x00,
+  0x41, 0x00, 0x06, 0x00, 0x35, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x03, 0x00, 0x11, 0x01, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00,
+  0xf9, 0x00, 0x02, 0x00, 0x0d, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+  0x0d, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x05, 0x01, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x4a, 0x00, 0x00, 0x00,
+  0x12, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00,
+  0xf8, 0x00, 0x02, 0x00, 0x04, 0x01, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00,
+  0x38, 0x00, 0x01, 0x00
+};
+static const unsigned int shaders_glsl_oplogisticregression_comp_spv_len = 6916;
+}
+}
+#endif // define SHADEROP_SHADEROPLOGISTICREGRESSION_HPP
+
+// Size of the shared memory partials array of the training shader
+#define KOMPUTE_LOGISTIC_REGRESSION_MAX_LOCAL_SIZE 1024
+
+namespace kp {
+
+/**
+ * Operation that trains a logistic regression with full batch gradient
+ * descent for several epochs in a single dispatch, so the weights stay on
+ * the device between epochs and only the trained weights, bias and loss
+ * have to be read back by the host.
+ *
+ * The training runs in one workgroup that keeps the weights in shared
+ * memory, and reduces the gradients of the samples in shared memory every
+ * epoch before updating the weights.
+ */
+class OpLogisticRegression : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that overrides the algorithm with the training shader and
+     * the tensors provided.
+     *
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the float samples stored row by row, the labels of 0 or
+     * 1 of each sample, the weights of each feature, the bias and the loss.
+     * The weights and bias hold the initial values and are overwritten with
+     * the trained values, and the loss receives the mean cross entropy of
+     * the last epoch
+     * @param algorithm An algorithm that will be overridden with the
+     * OpLogisticRegression shader data and the tensors provided
+     * @param epochs The number of gradient descent steps over all samples
+     * @param learningRate The step size of the updates of the weights
+     */
+    OpLogisticRegression(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                         const std::shared_ptr<Algorithm>& algorithm,
+                         uint32_t epochs,
+                         float learningRate = 0.1);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpLogisticRegression() override;
+
+    /**
+     * Declares the shader reads of the samples and labels, the shader reads
+     * and writes of the weights and bias and the shader write of the loss.
+     *
+     * @return Accesses of the training to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mTensors;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+namespace kp {
+
+/**
+ * Operation that evaluates an elementwise Expression into a float tensor in
+ * a single dispatch of a shader generated for the expression, so chains of
+ * elementwise operations neither dispatch once per operation nor write their
+ * intermediate results to memory.
+ */
+class OpExpression : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that overrides the algorithm with the shader of the
+     * expression, the output tensor and the tensors of the expression.
+     *
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the float output of the expression, which can also be
+     * read by the expression
+     * @param algorithm An algorithm that will be overridden with the shader
+     * generated for the expression and its tensors
+     * @param expression The expression to evaluate, whose tensors must be
+     * float tensors of the size of the output
+     */
+    OpExpression(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                 const std::shared_ptr<Algorithm>& algorithm,
+                 const Expression& expression);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpExpression() override;
+
+    /**
+     * Declares the shader reads of the tensors of the expression and the
+     * shader write of the output.
+     *
+     * @return Accesses of the expression to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<Tensor> mOutput;
+    std::vector<std::shared_ptr<Tensor>> mInputs;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <unordered_map>
+
+namespace kp {
+
+/**
+ * Tracks the last accesses to the memory of each tensor while a command
+ * buffer is recorded, and records only the barriers that the accesses of the
+ * next operation require: read after write, write after write and write after
+ * read hazards.
+ *
+ * Views are tracked as the tensor that owns their memory. Accesses from
+ * previous submissions are unknown, so the first access to a tensor waits for
+ * any shader or transfer write made before.
+ */
+class HazardTracker
+{
+  public:
+    /**
+     * Constructor for the tracker of a command buffer.
+     *
+     * @param computeSupported Whether the queue of the command buffer
+     * supports compute, without which the first access to a tensor only
+     * waits for transfer writes, as barriers of transfer queues cannot
+     * reference the compute shader stage
+     */
+    HazardTracker(bool computeSupported = true);
+
+    /**
+     * Records the barriers needed before the accesses of an operation and
+     * updates the state of the tensors accessed. Accesses of the same
+     * operation to the same tensor are combined, as no barrier can be
+     * recorded between them. The barriers of all the tensors are recorded
+     * with a single pipeline barrier, which uses a global memory barrier
+     * when every tensor accessed requires one.
+     *
+     * @param commandBuffer The command buffer to record the barriers into
+     * @param accesses The accesses of the operation to record next
+     */
+    void recordBarriers(const vk::CommandBuffer& commandBuffer,
+                        const std::vector<OpBase::TensorAccess>& accesses);
+
+    /**
+     * Records an operation along with the barriers its accesses require. An
+     * operation that declares no accesses records its own barriers, and resets
+     * the state of the tensors as it may have accessed any of them.
+     *
+     * @param commandBuffer The command buffer to record the operation into
+     * @param op The operation to record
+     */
+    void recordOperation(const vk::CommandBuffer& commandBuffer,
+                         std::shared_ptr<OpBase> op);
+
+    /**
+     * Forgets the state of all the tensors, so their next access waits for
+     * any write made before, as when an operation with undeclared accesses
+     * is recorded.
+     */
+    void reset();
+
+    /**
+     * Total number of pipeline barrier commands recorded since the tracker
+     * was created.
+     *
+     * @return Number of pipeline barriers recorded
+     */
+    uint64_t barrierCount();
+
+  private:
+    struct State
+    {
+        // Write not yet made visible to every later access
+        vk::PipelineStageFlags writeStageMask;
+        vk::AccessFlags writeAccessMask;
+        // Stages and accesses the last write has been made visible to
+        vk::PipelineStageFlags visibleStageMask;
+        vk::AccessFlags visibleAccessMask;
+        // Stages that read the tensor since the last write
+        vk::PipelineStageFlags readStageMask;
+    };
+
+    std::unordered_map<Tensor*, State> mStates;
+    uint64_t mBarrierCount = 0;
+    bool mComputeSupported = true;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+namespace kp {
+
+/**
+ * Block of operations recorded once into a secondary command buffer, which
+ * can then be recorded into any number of sequences as a single operation
+ * that executes the secondary command buffer. This allows composing
+ * sequences out of prebuilt blocks without recording their operations again.
+ *
+ * Each block owns its command pool, so separate blocks can be recorded in
+ * parallel from different threads as long as they do not share algorithms.
+ * The barriers between the operations of the block are recorded within the
+ * block, and the block acts as an operation with undeclared accesses in the
+ * sequences it is recorded into.
+ */
+class Block
+  : public OpBase
+  , public std::enable_shared_from_this<Block>
+{
+  public:
+    /**
+     * Main constructor for the block which creates its command pool and
+     * secondary command buffer.
+     *
+     * @param device Vulkan logical device
+     * @param queueIndex Index of the queue family of the sequences the block
+     * will be recorded into
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy the command pool of the block with
+     */
+    Block(std::shared_ptr<vk::Device> device,
+          uint32_t queueIndex,
+          std::shared_ptr<HostAllocator> hostAllocator = nullptr);
+
+    /**
+     * Destructor for the block which frees its command buffer and pool.
+     */
+    ~Block() override;
+
+    /**
+     * Record function for operation to be added to the block. If the block
+     * is not recording it begins recording, discarding the operations it
+     * contained. Sequences that contain the block need to be re-recorded
+     * after the block is recorded again, and must not be running.
+     *
+     * @param op Object derived from kp::BaseOp that will be recorded by the
+     * block.
+     * @return shared_ptr<Block> of the Block class itself
+     */
+    std::shared_ptr<Block> record(std::shared_ptr<OpBase> op);
+
+    /**
+     * Record function for operation to be added to the block.
+     *
+     * @param tensors Vector of tensors to use for the operation
+     * @param TArgs Template parameters that are used to initialise operation
+     * which allows for extensible configurations on initialisation.
+     * @return shared_ptr<Block> of the Block class itself
+     */
+    template<typename T, typename... TArgs>
+    std::shared_ptr<Block> record(std::vector<std::shared_ptr<Tensor>> tensors,
+                                  TArgs&&... params)
+    {
+        std::shared_ptr<T> op{ new T(tensors, std::forward<TArgs>(params)...) };
+        return this->record(op);
+    }
+    /**
+     * Record function for operation to be added to the block.
+     *
+     * @param algorithm Algorithm to use for the record often used for OpAlgo
+     * operations
+     * @param TArgs Template parameters that are used to initialise operation
+     * which allows for extensible configurations on initialisation.
+     * @return shared_ptr<Block> of the Block class itself
+     */
+    template<typename T, typename... TArgs>
+    std::shared_ptr<Block> record(std::shared_ptr<Algorithm> algorithm,
+                                  TArgs&&... params)
+    {
+        std::shared_ptr<T> op{ new T(algorithm,
+                                     std::forward<TArgs>(params)...) };
+        return this->record(op);
+    }
+
+    /**
+     * Begins recording the secondary command buffer, discarding the
+     * operations the block contained.
+     */
+    void begin();
+
+    /**
+     * Ends recording the secondary command buffer. This is called when the
+     * block is recorded into a sequence, so it only needs to be called
+     * explicitly before recording the block from another thread.
+     */
+    void end();
+
+    /**
+     * Records the execution of the secondary command buffer of the block,
+     * ending its recording if required.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Runs the preEval of all the operations of the block.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    void preEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Runs the postEval of all the operations of the block.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    void postEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Returns true if the block is currently in recording activated.
+     *
+     * @return Boolean stating if recording ongoing.
+     */
+    bool isRecording();
+
+    /**
+     * Returns true if the block has been initialised, and it's based on the
+     * GPU resources being referenced.
+     *
+     * @return Boolean stating if is initialized
+     */
+    bool isInit();
+
+    /**
+     * Returns the number of operations recorded into the block.
+     *
+     * @return Number of operations of the block
+     */
+    uint32_t operationCount();
+
+    /**
+     * Destroys and frees the GPU resources which include the secondary
+     * command buffer and the command pool. Sequences containing the block
+     * must have completed.
+     */
+    void destroy();
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<vk::Device> mDevice = nullptr;
+    uint32_t mQueueIndex = -1;
+    std::shared_ptr<HostAllocator> mHostAllocator = nullptr;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::shared_ptr<vk::CommandPool> mCommandPool = nullptr;
+    std::shared_ptr<vk::CommandBuffer> mCommandBuffer = nullptr;
+    std::vector<std::shared_ptr<OpBase>> mOperations;
+    HazardTracker mHazardTracker;
+
+    // State
+    bool mRecording = false;
+    bool mRecorded = false;
+
+    // Create functions
+    void createCommandPool();
+    void createCommandBuffer();
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <deque>
+#include <mutex>
+
+namespace kp {
+
+class SubmitBatch;
+
+/**
+ *  Container of operations that can be sent to GPU as batch. A sequence can
+ *  keep several submissions of its operations in flight, each with its own
+ *  command buffer and fence, so the next submission can be queued while the
+ *  previous ones are still running on the GPU.
+ */
+class Sequence : public std::enable_shared_from_this<Sequence>
+{
+  public:
+    /**
+     * GPU time of an operation, measured from the timestamps latched before
+     * and after it.
+     */
+    struct OpTiming
+    {
+        std::string label;     ///< Label recorded, or the operation type
+        double durationNs = 0; ///< Nanoseconds since the previous timestamp
+        uint64_t computeInvocations = 0; ///< Of dispatches with statistics
+    };
+
+    /**
+     * Main constructor for sequence which requires core vulkan components to
+     * generate all dependent resources.
+     *
+     * @param physicalDevice Vulkan physical device
+     * @param device Vulkan logical device
+     * @param computeQueue Vulkan compute queue
+     * @param queueIndex Vulkan compute queue index in device
+     * @param totalTimestamps Maximum number of timestamps to allocate
+     * @param inFlightDepth Maximum number of submissions running at the same
+     * time, timestamps are only supported with a single submission
+     * @param timelineSemaphore Whether to signal a timeline semaphore with
+     * every submission so other sequences can depend on it, which requires
+     * the timelineSemaphore feature of VK_KHR_timeline_semaphore
+     * @param commandPool Command pool of the queue family to allocate the
+     * command buffers from, which is not destroyed by the sequence. A new
+     * pool owned by the sequence is created if null. Sequences sharing a
+     * pool must not be recorded from different threads at the same time.
+     * @param queueMutex (Optional) Mutex held while submitting to the queue,
+     * shared by all the sequences of the queue so it is submitted to by one
+     * thread at a time, as Vulkan requires
+     * @param totalPipelineStatistics (Optional) Number of operations, from
+     * the first one recorded, whose compute shader invocations are counted
+     * by a pipeline statistics query when they dispatch an algorithm, which
+     * requires the pipelineStatisticsQuery feature to be enabled on the
+     * device, see DeviceInfo::enabledFeatures
+     * @param debugUtils (Optional) Functions of VK_EXT_debug_utils to label
+     * the commands of each operation with, and to name the command buffers
+     * of the sequence with, see setName
+     * @param metrics (Optional) Counters to add the submissions, command
+     * buffers, barriers and fence waits of the sequence to
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy the command pool, fences, semaphore and query pools with
+     * @param deviceInfo (Optional) Properties of the physical device queried
+     * once by the manager, which are queried by the sequence if null
+     */
+    Sequence(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
+             std::shared_ptr<vk::Device> device,
+             std::shared_ptr<vk::Queue> computeQueue,
+             uint32_t queueIndex,
+             uint32_t totalTimestamps = 0,
+             uint32_t inFlightDepth = 1,
+             bool timelineSemaphore = false,
+             std::shared_ptr<vk::CommandPool> commandPool = nullptr,
+             std::shared_ptr<std::mutex> queueMutex = nullptr,
+             uint32_t totalPipelineStatistics = 0,
+             std::shared_ptr<DebugUtils> debugUtils = nullptr,
+             std::shared_ptr<Metrics> metrics = nullptr,
+             std::shared_ptr<HostAllocator> hostAllocator = nullptr,
+             std::shared_ptr<DeviceInfo> deviceInfo = nullptr);
+    /**
+     * Destructor for sequence which is responsible for cleaning all subsequent
+     * owned operations.
+     */
+    ~Sequence();
+
+    /**
+     * Record function for operation to be added to the GPU queue in batch. This
+     * template requires classes to be derived from the OpBase class. This
+     * function also requires the Sequence to be recording, otherwise it will
+     * not be able to add the operation.
+     *
+     * @param op Object derived from kp::BaseOp that will be recoreded by the
+     * sequence which will be used when the operation is evaluated.
+     * @return shared_ptr<Sequence> of the Sequence class itself
+     */
+    std::shared_ptr<Sequence> record(std::shared_ptr<OpBase> op);
+
+    /**
+     * Record function for an operation like record, which labels the timing
+     * of the operation returned by getOpTimings.
+     *
+     * @param op Object derived from kp::BaseOp that will be recoreded by the
+     * sequence which will be used when the operation is evaluated.
+     * @param label Label of the operation in its timing
+     * @return shared_ptr<Sequence> of the Sequence class itself
+     */
+    std::shared_ptr<Sequence> record(std::shared_ptr<OpBase> op,
+                                     const std::string& label);
+
+    /**
+     * Record function for several operations at once, like calling record
+     * for each of them in order, which begins the recording and reserves the
+     * storage of the operations only once. This is intended for long
+     * sequences built by the bindings, which record them in a single call.
+     *
+     * @param ops Objects derived from kp::BaseOp that will be recorded by the
+     * sequence in order
+     * @return shared_ptr<Sequence> of the Sequence class itself
+     */
+    std::shared_ptr<Sequence> record(
+      const std::vector<std::shared_ptr<OpBase>>& ops);
+
+    /**
+     * Record function for operation to be added to the GPU queue in batch. This
+     * template requires classes to be derived from the OpBase class. This
+     * function also requires the Sequence to be recording, otherwise it will
+     * not be able to add the operation.
+     *
+     * @param tensors Vector of tensors to use for the operation
+     * @param TArgs Template parameters that are used to initialise operation
+     * which allows for extensible configurations on initialisation.
+     * @return shared_ptr<Sequence> of the Sequence class itself
+     */
+    template<typename T, typename... TArgs>
+    std::shared_ptr<Sequence> record(
+      std::vector<std::shared_ptr<Tensor>> tensors,
+      TArgs&&... params)
+    {
+        std::shared_ptr<T> op{ new T(tensors, std::forward<TArgs>(params)...) };
+        return this->record(op);
+    }
+    /**
+     * Record function for operation to be added to the GPU queue in batch. This
+     * template requires classes to be derived from the OpBase class. This
+     * function also requires the Sequence to be recording, otherwise it will
+     * not be able to add the operation.
+     *
+     * @param algorithm Algorithm to use for the record often used for OpAlgo
+     * operations
+     * @param TArgs Template parameters that are used to initialise operation
+     * which allows for extensible configurations on initialisation.
+     * @return shared_ptr<Sequence> of the Sequence class itself
+     */
+    template<typename T, typename... TArgs>
+    std::shared_ptr<Sequence> record(std::shared_ptr<Algorithm> algorithm,
+                                     TArgs&&... params)
+    {
+        std::shared_ptr<T> op{ new T(algorithm,
+                                     std::forward<TArgs>(params)...) };
+        return this->record(op);
+    }
+
+    /**
+     * Eval sends all the recorded and stored operations in the vector of
+     * operations into the gpu as a submit job synchronously (with a barrier).
+     *
+     * @return shared_ptr<Sequence> of the Sequence class itself
+     */
+    std::shared_ptr<Sequence> eval();
+
+    /**
+     * Resets all the recorded and stored operations, records the operation
+     * provided and submits into the gpu as a submit job synchronously (with a
+     * barrier).
+     *
+     * @return shared_ptr<Sequence> of the Sequence class itself
+     */
+    std::shared_ptr<Sequence> eval(std::shared_ptr<OpBase> op);
+
+    /**
+     * Eval sends all the recorded and stored operations in the vector of
+     * operations into the gpu as a submit job with a barrier.
+     *
+     * @param tensors Vector of tensors to use for the operation
+     * @param TArgs Template parameters that are used to initialise operation
+     * which allows for extensible configurations on initialisation.
+     * @return shared_ptr<Sequence> of the Sequence class itself
+     */
+    template<typename T, typename... TArgs>
+    std::shared_ptr<Sequence> eval(std::vector<std::shared_ptr<Tensor>> tensors,
+                                   TArgs&&... params)
+    {
+        std::shared_ptr<T> op{ new T(tensors, std::forward<TArgs>(params)...) };
+        return this->eval(op);
+    }
+    /**
+     * Eval sends all the recorded and stored operations in the vector of
+     * operations into the gpu as a submit job with a barrier.
+     *
+     * @param algorithm Algorithm to use for the record often used for OpAlgo
+     * operations
+     * @param TArgs Template parameters that are used to initialise operation
+     * which allows for extensible configurations on initialisation.
+     * @return shared_ptr<Sequence> of the Sequence class itself
+     */
+    template<typename T, typename... TArgs>
+    std::shared_ptr<Sequence> eval(std::shared_ptr<Algorithm> algorithm,
+                                   TArgs&&... params)
+    {
+        std::shared_ptr<T> op{ new T(algorithm,
+                                     std::forward<TArgs>(params)...) };
+        return this->eval(op);
+    }
+
+    /**
+     * Eval Async sends all the recorded and stored operations in the vector of
+     * operations into the gpu as a submit job without a barrier. EvalAwait()
+     * must ALWAYS be called after to ensure the sequence is terminated
+     * correctly. Up to the in flight depth of the sequence, repeated calls
+     * queue further submissions of the same operations, which are retired in
+     * order by evalAwait().
+     *
+     * @return Boolean stating whether execution was successful.
+     */
+    std::shared_ptr<Sequence> evalAsync();
+    /**
+     * Clears currnet operations to record provided one in the vector of
+     * operations into the gpu as a submit job without a barrier. EvalAwait()
+     * must ALWAYS be called after to ensure the sequence is terminated
+     * correctly.
+     *
+     * @return Boolean stating whether execution was successful.
+     */
+    std::shared_ptr<Sequence> evalAsync(std::shared_ptr<OpBase> op);
+    /**
+     * Eval Async sends all the recorded and stored operations like
+     * evalAsync(), with the GPU waiting for the last submission of each of
+     * the sequences provided before executing them. The dependencies are
+     * resolved on the GPU through timeline semaphores, so sequences on
+     * different queues can be chained without waiting on the host.
+     * EvalAwait() must ALWAYS be called after to ensure the sequence is
+     * terminated correctly.
+     *
+     * @param waitSequences Sequences whose last submission has to complete
+     * before this submission executes, all created with timeline semaphores
+     * @return shared_ptr<Sequence> of the Sequence class itself
+     */
+    std::shared_ptr<Sequence> evalAsync(
+      const std::vector<std::shared_ptr<Sequence>>& waitSequences);
+    /**
+     * Eval sends all the recorded and stored operations in the vector of
+     * operations into the gpu as a submit job with a barrier.
+     *
+     * @param tensors Vector of tensors to use for the operation
+     * @param TArgs Template parameters that are used to initialise operation
+     * which allows for extensible configurations on initialisation.
+     * @return shared_ptr<Sequence> of the Sequence class itself
+     */
+    template<typename T, typename... TArgs>
+    std::shared_ptr<Sequence> evalAsync(
+      std::vector<std::shared_ptr<Tensor>> tensors,
+      TArgs&&... params)
+    {
+        std::shared_ptr<T> op{ new T(tensors, std::forward<TArgs>(params)...) };
+        return this->evalAsync(op);
+    }
+    /**
+     * Eval sends all the recorded and stored operations in the vector of
+     * operations into the gpu as a submit job with a barrier.
+     *
+     * @param algorithm Algorithm to use for the record often used for OpAlgo
+     * operations
+     * @param TArgs Template parameters that are used to initialise operation
+     * which allows for extensible configurations on initialisation.
+     * @return shared_ptr<Sequence> of the Sequence class itself
+     */
+    template<typename T, typename... TArgs>
+    std::shared_ptr<Sequence> evalAsync(std::shared_ptr<Algorithm> algorithm,
+                                        TArgs&&... params)
+    {
+        std::shared_ptr<T> op{ new T(algorithm,
+                                     std::forward<TArgs>(params)...) };
+        return this->evalAsync(op);
+    }
+
+    /**
+     * Eval Await waits for the fence of the oldest submission in flight to
+     * finish processing and then once it finishes, it runs the postEval of
+     * all operations.
+     *
+     * @param waitFor Number of milliseconds to wait before timing out.
+     * @return shared_ptr<Sequence> of the Sequence class itself
+     */
+    std::shared_ptr<Sequence> evalAwait(uint64_t waitFor = UINT64_MAX);
+
+    /**
+     * Checks without blocking whether the oldest submission in flight of the
+     * sequence has finished executing on the GPU. The postEval of the
+     * operations is only run by evalAwait, which returns straight away once
+     * this is true.
+     *
+     * @return Boolean stating whether the GPU has finished the submission
+     */
+    bool isComplete();
+
+    /**
+     * Returns the number of submissions that have been sent with evalAsync
+     * and not yet retired with evalAwait.
+     *
+     * @return Number of submissions in flight
+     */
+    uint32_t inFlightCount();
+
+    /**
+     * Returns the maximum number of submissions of the sequence that can be
+     * in flight at the same time.
+     *
+     * @return Maximum number of submissions in flight
+     */
+    uint32_t inFlightDepth();
+
+    /**
+     * Returns the number of pipeline barriers recorded by the sequence
+     * between the operations of the current recording, based on the tensor
+     * accesses the operations declare. The barriers required by the tensors
+     * of an operation are recorded as a single pipeline barrier.
+     *
+     * @return Number of barriers recorded for the tracked tensor accesses
+     */
+    uint64_t barrierCount();
+
+    /**
+     * Returns the operations of the current recording, in the order they
+     * were recorded.
+     *
+     * @return The operations recorded
+     */
+    const std::vector<std::shared_ptr<OpBase>>& operations();
+
+    /**
+     * Clear function clears all operations currently recorded and starts
+     * recording again.
+     */
+    void clear();
+
+    /**
+     * Resets the command buffers of the sequence and discards the operations
+     * recorded, keeping the command buffers allocated so the sequence can be
+     * recorded again cheaply. The sequence must not be running, and
+     * submissions whose wait timed out are waited for.
+     */
+    void reset();
+
+    /**
+     * Return the timestamps that were latched at the beginning and
+     * after each operation during the last eval() call, in ticks of the
+     * timestampPeriod of the device. Waits for the timestamps to be
+     * available.
+     */
+    std::vector<std::uint64_t> getTimestamps();
+
+    /**
+     * Returns the number of operations whose GPU time is latched, which is
+     * the number of timestamps the sequence was created with.
+     *
+     * @return Number of operations timed, 0 without timestamps
+     */
+    uint32_t timedOperationCount();
+
+    /**
+     * Returns the GPU time of each operation during the last eval() call, in
+     * nanoseconds, along with the compute shader invocations of the
+     * dispatches when pipeline statistics are collected. The queries are
+     * reset at the start of every submission, so the sequence can be
+     * evaluated again and the timings retrieved after each eval. The
+     * durations are zero when the sequence has no timestamps.
+     *
+     * @param wait Whether to wait for the timestamps to be available, which
+     * they are once the submission completed
+     * @return Timing of each operation with a timestamp or statistics, or
+     * an empty vector if wait is false and the results are not available
+     * yet
+     */
+    std::vector<OpTiming> getOpTimings(bool wait = true);
+
+    /**
+     * Sets the name of the sequence, which names its command buffers and
+     * query pools through VK_EXT_debug_utils so they can be identified in
+     * captures of debugging and profiling tools. The commands of each
+     * operation are labelled with the label of the operation, or its type,
+     * whether the sequence is named or not.
+     *
+     * @param name The name of the sequence
+     */
+    void setName(const std::string& name);
+
+    /**
+     * Retrieve the name of the sequence set with setName.
+     *
+     * @return Name of the sequence, empty if it was not named
+     */
+    const std::string& name();
+
+    /**
+     * Begins recording commands for commands to be submitted into the command
+     * buffer, replacing the operations recorded previously.
+     *
+     * @return Boolean stating whether execution was successful.
+     */
+    void begin();
+
+    /**
+     * Ends the recording and stops recording commands when the record command
+     * is sent.
+     *
+     * @return Boolean stating whether execution was successful.
+     */
+    void end();
+
+    /**
+     * Returns true if the sequence is currently in recording activated.
+     *
+     * @return Boolean stating if recording ongoing.
+     */
+    bool isRecording();
+
+    /**
+     * Returns true if the sequence has been initialised, and it's based on the
+     * GPU resources being refrenced.
+     *
+     * @return Boolean stating if is initialized
+     */
+    bool isInit();
+
+    /**
+     * Clears command buffer and triggers re-record of all the current
+     * operations saved, which is useful if the underlying kp::Tensors or
+     * kp::Algorithms are modified and need to be re-recorded. Submissions
+     * call it on their own when tensors of the operations were rebuilt since
+     * the operations were recorded.
+     */
+    void rerecord();
+
+    /**
+     * Returns true if the sequence is currently running - mostly used for async
+     * workloads.
+     *
+     * @return Boolean stating if currently running.
+     */
+    bool isRunning();
+
+    /**
+     * Destroys and frees the GPU resources which include the buffer and memory
+     * and sets the sequence as init=False.
+     */
+    void destroy();
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<vk::PhysicalDevice> mPhysicalDevice = nullptr;
+    std::shared_ptr<vk::Device> mDevice = nullptr;
+    std::shared_ptr<vk::Queue> mComputeQueue = nullptr;
+    std::shared_ptr<std::mutex> mQueueMutex = nullptr;
+    std::shared_ptr<DebugUtils> mDebugUtils = nullptr;
+    std::shared_ptr<Metrics> mMetrics = nullptr;
+    std::shared_ptr<HostAllocator> mHostAllocator = nullptr;
+    std::shared_ptr<DeviceInfo> mDeviceInfo = nullptr;
+    uint32_t mQueueIndex = -1;
+    // Whether the queue family supports compute or only transfers
+    bool mComputeSupported = true;
+
+    // -------------- OPTIONALLY OWNED RESOURCES
+    std::shared_ptr<vk::CommandPool> mCommandPool = nullptr;
+    bool mFreeCommandPool = false;
+    std::shared_ptr<vk::CommandBuffer> mCommandBuffer = nullptr;
+    bool mFreeCommandBuffer = false;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    struct Submission
+    {
+        std::shared_ptr<vk::CommandBuffer> commandBuffer;
+        vk::Fence fence;
+        bool fencePending = false;
+        // Submitted by a batch, which signals one of its fences instead
+        bool batched = false;
+        std::weak_ptr<SubmitBatch> batch;
+        uint32_t batchFenceIndex = 0;
+        // Version of the operations recorded, the maximum if never recorded
+        uint64_t recordedVersion = UINT64_MAX;
+    };
+    // Storage referenced by the submit info of a submission
+    struct SubmitData
+    {
+        vk::SubmitInfo submitInfo;
+        vk::TimelineSemaphoreSubmitInfo timelineSubmitInfo;
+        std::vector<vk::Semaphore> waitSemaphores;
+        std::vector<uint64_t> waitValues;
+        std::vector<vk::PipelineStageFlags> waitStages;
+        uint64_t signalValue = 0;
+    };
+    std::vector<Submission> mSubmissions;
+    std::vector<std::shared_ptr<OpBase>> mOperations;
+    HazardTracker mHazardTracker;
+    std::shared_ptr<vk::QueryPool> timestampQueryPool = nullptr;
+    uint32_t mTimestampCount = 0;
+    // Valid bits of the timestamps of the queue family, and ticks to ns
+    uint64_t mTimestampMask = UINT64_MAX;
+    double mTimestampPeriod = 1.0;
+    std::shared_ptr<vk::QueryPool> mPipelineStatisticsQueryPool = nullptr;
+    uint32_t mPipelineStatisticsCount = 0;
+    // Label of each operation recorded, empty for the operation type
+    std::vector<std::string> mOperationLabels;
+    // Tensors of the operations recorded, with their generation at the time
+    std::vector<std::pair<std::shared_ptr<Tensor>, uint64_t>>
+      mRecordedGenerations;
+    // Resolved on the first trace, null unless the device enabled
+    // VK_EXT_calibrated_timestamps and calibrates CLOCK_MONOTONIC
+    PFN_vkGetCalibratedTimestampsEXT mGetCalibratedTimestamps = nullptr;
+    bool mCalibrationResolved = false;
+    vk::Semaphore mTimelineSemaphore;
+    std::string mName;
+
+    // State
+    bool mRecording = false;
+    std::deque<uint32_t> mInFlight;
+    uint32_t mNextSubmission = 0;
+    uint64_t mRecordVersion = 0;
+    // Value signaled by the last submission on the timeline semaphore
+    uint64_t mTimelineValue = 0;
+
+    // Create functions
+    void createCommandPool();
+    void createCommandBuffer();
+    void createFences();
+    void createTimelineSemaphore();
+    void recordSubmission(Submission& submission);
+    void waitPendingSubmission(Submission& submission);
+    vk::Result waitSubmission(Submission& submission, uint64_t waitFor);
+    bool isSubmissionComplete(const Submission& submission);
+    Submission& prepareSubmit(
+      const std::vector<std::shared_ptr<Sequence>>& waitSequences,
+      SubmitData& submitData,
+      std::shared_ptr<SubmitBatch> batch = nullptr,
+      uint32_t batchFenceIndex = 0);
+    void createTimestampQueryPool(uint32_t totalTimestamps);
+    void createPipelineStatisticsQueryPool(uint32_t totalPipelineStatistics);
+    void writeTimestamp(const vk::CommandBuffer& commandBuffer,
+                        uint32_t query);
+    void resetQueries(const vk::CommandBuffer& commandBuffer);
+    std::string operationLabel(size_t operationIndex);
+    void traceTimestamps(int64_t completedNs);
+    void recordOperation(const vk::CommandBuffer& commandBuffer,
+                         HazardTracker& hazardTracker,
+                         uint32_t operationIndex);
+    void checkStagingRingOrder(const std::shared_ptr<OpBase>& op);
+    void trackTensorGenerations(const std::shared_ptr<OpBase>& op);
+    bool tensorsRebuilt();
+    std::unique_lock<std::mutex> lockQueue();
+
+    friend class SubmitBatch;
+    friend class CompletionWaiter;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+namespace kp {
+
+/**
+ * Handle to a group of sequences submitted together, which can be awaited as
+ * a whole instead of calling evalAwait on each of the sequences.
+ *
+ * The sequences targeting the same queue are sent with a single queue submit
+ * containing one submit info per sequence, and signal a single fence.
+ */
+class SubmitBatch : public std::enable_shared_from_this<SubmitBatch>
+{
+  public:
+    /**
+     * Constructor for the batch, which is created empty and then submitted
+     * with submit.
+     *
+     * @param device The device to create the fences of the batch with
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy the fences of the batch with
+     */
+    SubmitBatch(std::shared_ptr<vk::Device> device,
+                std::shared_ptr<HostAllocator> hostAllocator = nullptr);
+
+    /**
+     * Destructor which waits for the submissions of the batch and frees its
+     * fences.
+     */
+    ~SubmitBatch();
+
+    /**
+     * Submits the recorded operations of every sequence provided, grouped in
+     * a single queue submit per queue. Each sequence is submitted as with
+     * evalAsync, so it must have a free submission within its in flight depth.
+     *
+     * @param sequences The sequences to submit, in the order of submission
+     */
+    void submit(const std::vector<std::shared_ptr<Sequence>>& sequences);
+
+    /**
+     * Waits for every submission of the batch to finish processing and then
+     * runs the postEval of the operations of each sequence, retiring their
+     * submissions as evalAwait would.
+     *
+     * @param waitFor Number of nanoseconds to wait before timing out
+     * @return Boolean stating whether the batch completed within the timeout
+     */
+    bool await(uint64_t waitFor = UINT64_MAX);
+
+    /**
+     * Checks without blocking whether every submission of the batch has
+     * finished executing on the GPU.
+     *
+     * @return Boolean stating whether the GPU has finished the batch
+     */
+    bool isComplete();
+
+    /**
+     * Returns the number of queue submits performed by the batch, one for
+     * each distinct queue targeted by its sequences.
+     *
+     * @return Number of queue submits of the batch
+     */
+    uint32_t queueSubmitCount();
+
+    /**
+     * Waits for the submissions of the batch and destroys its fences. The
+     * submissions remain in flight on their sequences until awaited.
+     */
+    void destroy();
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<vk::Device> mDevice;
+    std::shared_ptr<HostAllocator> mHostAllocator;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<vk::Fence> mFences;
+    std::vector<std::shared_ptr<Sequence>> mSequences;
+
+    vk::Result waitFence(uint32_t fenceIndex, uint64_t waitFor);
+    vk::Result fenceStatus(uint32_t fenceIndex);
+    bool hasPendingSubmission(Sequence& sequence);
+
+    friend class Sequence;
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// Nanoseconds to wait for the fences before picking up new submissions
+#ifndef KOMPUTE_COMPLETION_WAITER_TIMEOUT
+#define KOMPUTE_COMPLETION_WAITER_TIMEOUT 1000000
+#endif
+
+namespace kp {
+
+/**
+ * Background thread that waits for the submissions of many sequences at the
+ * same time, running evalAwait on each sequence once its submission
+ * completes and then notifying the completion, so no thread has to block on
+ * each of the submissions.
+ *
+ * The completions are run on the thread of the waiter. Until a sequence
+ * completes it must not be used by other threads.
+ */
+class CompletionWaiter
+{
+  public:
+    /**
+     * Completion run once the submission has been awaited, with the
+     * exception thrown by evalAwait if any.
+     */
+    typedef std::function<void(std::exception_ptr)> Completion;
+
+    /**
+     * Constructor which starts the thread of the waiter.
+     *
+     * @param device The device the fences of the sequences belong to
+     */
+    CompletionWaiter(std::shared_ptr<vk::Device> device);
+
+    /**
+     * Destructor which waits for the submissions still pending.
+     */
+    ~CompletionWaiter();
+
+    /**
+     * Waits in the background for the last submission of the sequence, which
+     * must have been submitted with evalAsync. Submissions of a batch are
+     * awaited through the batch instead.
+     *
+     * @param sequence The sequence whose last submission to wait for
+     * @param completion The function to run once the submission is awaited
+     */
+    void watch(std::shared_ptr<Sequence> sequence, Completion completion);
+
+    /**
+     * Returns the number of submissions the waiter is waiting for.
+     *
+     * @return Number of pending submissions
+     */
+    uint32_t pendingCount();
+
+    /**
+     * Waits for the pending submissions and their completions, and then
+     * stops the thread of the waiter.
+     */
+    void destroy();
+
+  private:
+    struct Pending
+    {
+        std::shared_ptr<Sequence> sequence;
+        vk::Fence fence;
+        Completion completion;
+    };
+
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<vk::Device> mDevice;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::thread mThread;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::vector<Pending> mPending;
+    bool mStopping = false;
+
+    void run();
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+
+namespace kp {
+
+/**
+ * Scheduler distributing independent sequences across several queues, so
+ * they run in parallel without being assigned to a queue by hand.
+ *
+ * The operations of each sequence submitted are recorded into one of the
+ * sequences the scheduler owns on each queue. A submission goes to the queue
+ * with the least outstanding work, and a queue left without pending work
+ * steals the most recently submitted work of the busiest queue. Submissions
+ * are awaited through the fences of their sequences by a CompletionWaiter,
+ * and complete in no particular order.
+ */
+class Scheduler
+{
+  public:
+    /**
+     * Completion run once the operations of a sequence submitted have been
+     * awaited, with the exception thrown while submitting or awaiting them
+     * if any.
+     */
+    typedef std::function<void(std::exception_ptr)> Completion;
+
+    /**
+     * Constructor from the sequences to run the submissions with.
+     *
+     * @param queueSequences For each queue, the sequences created on that
+     * queue, whose count is the number of submissions the queue can run at
+     * the same time
+     * @param completionWaiter The waiter for the fences of the sequences,
+     * which runs the completions
+     */
+    Scheduler(
+      const std::vector<std::vector<std::shared_ptr<Sequence>>>& queueSequences,
+      std::shared_ptr<CompletionWaiter> completionWaiter);
+
+    /**
+     * Destructor which waits for the submissions still outstanding.
+     */
+    ~Scheduler();
+
+    /**
+     * Submits the operations recorded by the sequence to one of the queues.
+     * The sequence itself is not submitted, and may be recorded again or
+     * submitted again straight away.
+     *
+     * @param sequence The sequence whose operations to run
+     * @param completion The function to run once the operations completed,
+     * from the thread of the completion waiter
+     */
+    void submit(std::shared_ptr<Sequence> sequence, Completion completion);
+
+    /**
+     * Submits the operations recorded by the sequence to one of the queues,
+     * returning a future that becomes ready once they completed.
+     *
+     * @param sequence The sequence whose operations to run
+     * @returns Future holding the sequence, or the exception raised while
+     * running its operations
+     */
+    std::future<std::shared_ptr<Sequence>> submit(
+      std::shared_ptr<Sequence> sequence);
+
+    /**
+     * Waits until all the submissions so far have completed.
+     */
+    void await();
+
+    /**
+     * Returns the number of queues the submissions are distributed across.
+     *
+     * @return Number of queues
+     */
+    uint32_t queueCount();
+
+    /**
+     * Returns the number of submissions pending or running that have not
+     * completed yet.
+     *
+     * @return Number of outstanding submissions
+     */
+    uint32_t outstandingCount();
+
+    /**
+     * Returns the number of submissions completed by each queue.
+     *
+     * @return Number of completed submissions, indexed by queue
+     */
+    std::vector<uint64_t> completedCounts();
+
+    /**
+     * Returns the number of submissions run by a queue other than the queue
+     * they were first assigned to.
+     *
+     * @return Number of stolen submissions
+     */
+    uint64_t stolenCount();
+
+    /**
+     * Waits for the submissions still outstanding and releases the
+     * sequences of the scheduler.
+     */
+    void destroy();
+
+  private:
+    struct Task
+    {
+        std::shared_ptr<Sequence> sequence;
+        std::vector<std::shared_ptr<OpBase>> operations;
+        Completion completion;
+    };
+    struct Queue
+    {
+        std::deque<Task> pending;
+        std::vector<std::shared_ptr<Sequence>> idleSequences;
+        uint32_t running = 0;
+        uint64_t completed = 0;
+    };
+
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<CompletionWaiter> mCompletionWaiter;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<Queue> mQueues;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    uint32_t mOutstanding = 0;
+    uint64_t mStolen = 0;
+
+    void dispatch(uint32_t queueIndex, std::unique_lock<std::mutex>& lock);
+    void complete(uint32_t queueIndex,
+                  std::shared_ptr<Sequence> sequence,
+                  const Task& task,
+                  std::exception_ptr exception);
+    void finish(const Task& task,
+                std::exception_ptr exception,
+                std::unique_lock<std::mutex>& lock);
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// Number of independently locked shards the registrations are spread over
+#ifndef KOMPUTE_RESOURCE_REGISTRY_SHARDS
+#define KOMPUTE_RESOURCE_REGISTRY_SHARDS 16
+#endif
+
+namespace kp {
+
+/**
+ * Registry of weak references to the resources created by a manager, where
+ * each resource removes itself in constant time when it is released, so the
+ * registry only holds the resources alive.
+ *
+ * The resources are registered in slot maps whose free slots are reused.
+ * The registry is split into shards chosen by the registering thread, each
+ * with its own lock, so threads creating resources at the same time rarely
+ * wait for each other. The registry must be owned by a shared pointer, which
+ * the resources only hold weakly so they can outlive it.
+ */
+template<typename T>
+class ResourceRegistry
+  : public std::enable_shared_from_this<ResourceRegistry<T>>
+{
+  public:
+    /**
+     * Takes ownership of a resource and registers it, returning the shared
+     * pointer to the resource that removes it from the registry when the
+     * resource is released.
+     *
+     * @param resource The resource to register, deleted on failure
+     * @return Shared pointer owning the resource
+     */
+    template<typename U>
+    std::shared_ptr<U> add(U* resource)
+    {
+        Handle handle;
+        try {
+            handle = this->allocate();
+        } catch (...) {
+            delete resource;
+            throw;
+        }
+
+        std::weak_ptr<ResourceRegistry<T>> registry = this->shared_from_this();
+        std::shared_ptr<U> shared(resource, [registry, handle](U* resource) {
+            if (std::shared_ptr<ResourceRegistry<T>> owner = registry.lock()) {
+                owner->remove(handle);
+            }
+            delete resource;
+        });
+
+        Shard& shard = this->mShards[handle.shard];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        Slot& slot = shard.slots[handle.index];
+        if (slot.generation == handle.generation) {
+            slot.resource = shared;
+        }
+        return shared;
+    }
+
+    /**
+     * Returns the resources of the registry that are still alive.
+     *
+     * @return The resources alive
+     */
+    std::vector<std::shared_ptr<T>> resources()
+    {
+        std::vector<std::shared_ptr<T>> resources;
+        for (Shard& shard : this->mShards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (const Slot& slot : shard.slots) {
+                // The resources are released after the lock, as releasing
+                // the last reference removes the resource from its shard
+                if (std::shared_ptr<T> resource = slot.resource.lock()) {
+                    resources.push_back(resource);
+                }
+            }
+        }
+        return resources;
+    }
+
+    /**
+     * Removes all the resources from the registry, returning the ones still
+     * alive.
+     *
+     * @return The resources alive
+     */
+    std::vector<std::shared_ptr<T>> take()
+    {
+        std::vector<std::shared_ptr<T>> resources;
+        for (Shard& shard : this->mShards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (Slot& slot : shard.slots) {
+                if (std::shared_ptr<T> resource = slot.resource.lock()) {
+                    resources.push_back(resource);
+                }
+            }
+            // The slots are dropped, so resources released later find their
+            // slot gone from the generation of the shard
+            shard.generation++;
+            shard.slots.clear();
+            shard.freeSlots.clear();
+            shard.size = 0;
+        }
+        return resources;
+    }
+
+    /**
+     * Returns the number of resources registered, which are the resources
+     * alive that have not been taken.
+     *
+     * @return Number of resources registered
+     */
+    size_t size()
+    {
+        size_t size = 0;
+        for (Shard& shard : this->mShards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            size += shard.size;
+        }
+        return size;
+    }
+
+    /**
+     * Returns the number of slots allocated by the registry, which is the
+     * highest number of resources registered at the same time since the last
+     * take.
+     *
+     * @return Number of slots allocated
+     */
+    size_t capacity()
+    {
+        size_t capacity = 0;
+        for (Shard& shard : this->mShards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            capacity += shard.slots.size();
+        }
+        return capacity;
+    }
+
+  private:
+    struct Handle
+    {
+        uint32_t shard = 0;
+        uint32_t index = 0;
+        uint64_t generation = 0;
+    };
+    struct Slot
+    {
+        std::weak_ptr<T> resource;
+        uint64_t generation = 0;
+    };
+    struct Shard
+    {
+        std::mutex mutex;
+        std::vector<Slot> slots;
+        std::vector<uint32_t> freeSlots;
+        // Increased when the slots are dropped, so old handles never match
+        uint64_t generation = 0;
+        size_t size = 0;
+    };
+
+    Shard mShards[KOMPUTE_RESOURCE_REGISTRY_SHARDS];
+
+    Handle allocate()
+    {
+        Handle handle;
+        handle.shard = std::hash<std::thread::id>()(std::this_thread::get_id()) %
+                       KOMPUTE_RESOURCE_REGISTRY_SHARDS;
+
+        Shard& shard = this->mShards[handle.shard];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.freeSlots.size()) {
+            handle.index = shard.freeSlots.back();
+            shard.freeSlots.pop_back();
+        } else {
+            handle.index = shard.slots.size();
+            shard.slots.emplace_back();
+        }
+        // Each use of a slot gets a distinct generation across drops
+        shard.generation++;
+        shard.slots[handle.index].generation = shard.generation;
+        handle.generation = shard.generation;
+        shard.size++;
+        return handle;
+    }
+
+    void remove(const Handle& handle)
+    {
+        Shard& shard = this->mShards[handle.shard];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (handle.index >= shard.slots.size() ||
+            shard.slots[handle.index].generation != handle.generation) {
+            return;
+        }
+        shard.slots[handle.index] = Slot();
+        shard.freeSlots.push_back(handle.index);
+        shard.size--;
+    }
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <functional>
+#include <unordered_map>
+
+namespace kp {
+
+/**
+ * Graph of operations whose dependencies are derived from the tensors they
+ * read and write, compiled into sequences spread across several queues and
+ * replayed without recording them again while the graph does not change.
+ *
+ * Each operation depends on the last operation writing a tensor it reads or
+ * writes, and on the operations reading a tensor it writes since the last
+ * write. The operations are assigned to the queues so that chains of
+ * dependent operations stay on one queue, and independent chains run on
+ * different queues. The operations of a queue are split into sequences
+ * where they wait for or are waited on by another queue, and the sequences
+ * depending on each other are chained with timeline semaphores. The barriers
+ * within a sequence are recorded from the accesses of the operations.
+ */
+class Graph
+{
+  public:
+    /**
+     * Function creating a sequence on the queue of the index provided, with
+     * a timeline semaphore when the graph uses several queues.
+     */
+    typedef std::function<std::shared_ptr<Sequence>(uint32_t queueIndex)>
+      SequenceFactory;
+
+    /**
+     * Constructor from the queues to spread the operations across.
+     *
+     * @param queueIndices The indices of the queues the operations can run
+     * on, all of which must support compute
+     * @param sequenceFactory The function creating the sequences of the
+     * compiled graph
+     */
+    Graph(const std::vector<uint32_t>& queueIndices,
+          SequenceFactory sequenceFactory);
+
+    /**
+     * Destructor which waits for the run in flight and releases the
+     * sequences of the graph.
+     */
+    ~Graph();
+
+    /**
+     * Adds an operation reading and writing the tensors provided, after the
+     * operations added before. The graph is compiled again on its next run.
+     *
+     * @param op The operation to add
+     * @param inputs The tensors read by the operation
+     * @param outputs The tensors written by the operation
+     * @return Index of the operation in the graph
+     */
+    uint32_t add(std::shared_ptr<OpBase> op,
+                 const std::vector<std::shared_ptr<Tensor>>& inputs,
+                 const std::vector<std::shared_ptr<Tensor>>& outputs);
+
+    /**
+     * Adds an operation whose inputs and outputs are the tensors of the
+     * accesses it declares, the tensors with a write access being outputs.
+     *
+     * @param op The operation to add, which must declare its accesses
+     * @return Index of the operation in the graph
+     */
+    uint32_t add(std::shared_ptr<OpBase> op);
+
+    /**
+     * Assigns the operations to the queues and records the sequences of the
+     * graph, waiting for the run in flight first. Called by run when the
+     * graph changed since it was last compiled.
+     */
+    void compile();
+
+    /**
+     * Runs the graph and waits for it to complete.
+     */
+    void run();
+
+    /**
+     * Submits the sequences of the graph, compiling it first if it changed.
+     * A previous run still in flight is awaited first.
+     */
+    void runAsync();
+
+    /**
+     * Waits for the run in flight, if any, to complete.
+     */
+    void await();
+
+    /**
+     * Checks whether the graph has been compiled since its last change.
+     *
+     * @return Boolean stating whether the graph is compiled
+     */
+    bool isCompiled();
+
+    /**
+     * Returns the number of operations added to the graph.
+     *
+     * @return Number of operations
+     */
+    uint32_t operationCount();
+
+    /**
+     * Returns the indices of the operations each operation depends on.
+     *
+     * @param operationIndex The index of the operation
+     * @return Indices of the operations it depends on
+     */
+    const std::vector<uint32_t>& dependencies(uint32_t operationIndex);
+
+    /**
+     * Returns the queue each operation was assigned to by the last compile.
+     *
+     * @return Index of the queue of each operation, from the queue indices
+     * of the graph
+     */
+    std::vector<uint32_t> operationQueues();
+
+    /**
+     * Returns the number of sequences the graph was compiled into.
+     *
+     * @return Number of sequences
+     */
+    uint32_t sequenceCount();
+
+    /**
+     * Returns the number of times the sequences of the graph were recorded,
+     * which only increases when the graph changed between runs.
+     *
+     * @return Number of compiles
+     */
+    uint64_t compileCount();
+
+    /**
+     * Waits for the run in flight and releases the operations and sequences
+     * of the graph.
+     */
+    void destroy();
+
+  private:
+    struct Node
+    {
+        std::shared_ptr<OpBase> op;
+        std::vector<std::shared_ptr<Tensor>> tensors;
+        std::vector<uint32_t> dependencies;
+        uint32_t queue = 0;
+        uint32_t segment = 0;
+    };
+    struct Segment
+    {
+        uint32_t queue = 0;
+        std::vector<uint32_t> nodes;
+        std::vector<uint32_t> waitSegments;
+        std::shared_ptr<Sequence> sequence;
+    };
+    struct TensorState
+    {
+        int64_t lastWriter = -1;
+        std::vector<uint32_t> readers;
+    };
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<uint32_t> mQueueIndices;
+    SequenceFactory mSequenceFactory;
+    std::vector<Node> mNodes;
+    std::vector<Segment> mSegments;
+    // Accesses since the last write to each tensor, views as their parent
+    std::unordered_map<Tensor*, TensorState> mTensorStates;
+    bool mCompiled = false;
+    bool mRunning = false;
+    uint64_t mCompileCount = 0;
+
+    void assignQueues();
+    void createSegments();
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <functional>
+
+namespace kp {
+
+/**
+ * Pipeline streaming data larger than the memory of the device through an
+ * algorithm in chunks, so the transfers of a chunk overlap with the dispatch
+ * of the others instead of leaving the device idle.
+ *
+ * Each slot of the pipeline holds the tensors of a chunk and an algorithm
+ * bound to them. Up to one chunk per slot is in flight, so with three slots
+ * the upload of a chunk, the dispatch of the previous one and the download of
+ * the one before can run at the same time. When the slots have sequences on
+ * a transfer queue, the uploads and downloads run on that queue and are
+ * chained to the dispatches on the compute queue by timeline semaphores.
+ * Otherwise each chunk runs as a single sequence, and only the host side of
+ * the transfers overlaps with the device.
+ */
+class StreamPipeline
+{
+  public:
+    /**
+     * Function filling the host data of the input tensors with a chunk,
+     * returning the number of elements written to each of them, which is
+     * zero once the source is exhausted.
+     */
+    typedef std::function<uint64_t(
+      uint64_t chunkIndex,
+      const std::vector<std::shared_ptr<Tensor>>& inputs)>
+      Source;
+
+    /**
+     * Function consuming the host data of the output tensors of a chunk,
+     * called in the order of the chunks with the number of elements the
+     * source wrote for that chunk.
+     */
+    typedef std::function<void(
+      uint64_t chunkIndex,
+      const std::vector<std::shared_ptr<Tensor>>& outputs,
+      uint64_t elementCount)>
+      Sink;
+
+    /**
+     * Resources of one chunk in flight.
+     */
+    struct Slot
+    {
+        std::vector<std::shared_ptr<Tensor>> inputs; ///< Filled by the source
+        std::vector<std::shared_ptr<Tensor>> outputs; ///< Read by the sink
+        std::shared_ptr<Algorithm> algorithm; ///< Bound to the tensors
+        std::shared_ptr<Sequence> compute;    ///< Dispatches the algorithm
+        std::shared_ptr<Sequence> upload;     ///< Optional, transfer queue
+        std::shared_ptr<Sequence> download;   ///< Optional, transfer queue
+    };
+
+    /**
+     * Constructor recording the operations of each slot into its sequences.
+     * The uploads and downloads are recorded into the compute sequence of
+     * the slots without upload and download sequences.
+     *
+     * @param slots The resources of the chunks that can be in flight at the
+     * same time, usually two or three
+     * @param chunkSize The number of elements of each tensor of the slots
+     */
+    StreamPipeline(const std::vector<Slot>& slots, uint64_t chunkSize);
+
+    /**
+     * Destructor which waits for the chunks in flight and releases the
+     * resources of the slots.
+     */
+    ~StreamPipeline();
+
+    /**
+     * Streams the chunks of the source through the algorithm until the
+     * source is exhausted, passing the outputs of each chunk to the sink.
+     * The elements of the inputs past the count returned by the source are
+     * set to zero. An exception thrown by the source or the sink is rethrown
+     * once the chunks in flight completed.
+     *
+     * @param source The function filling the inputs of each chunk
+     * @param sink The function consuming the outputs of each chunk
+     * @return Number of chunks processed
+     */
+    uint64_t run(Source source, Sink sink);
+
+    /**
+     * Returns the number of elements of each tensor of a chunk.
+     *
+     * @return Number of elements per chunk
+     */
+    uint64_t chunkSize();
+
+    /**
+     * Returns the number of chunks that can be in flight at the same time.
+     *
+     * @return Number of slots
+     */
+    uint32_t depth();
+
+    /**
+     * Checks whether the transfers run on a queue of their own, so they
+     * overlap with the dispatches on the device.
+     *
+     * @return Boolean stating whether the slots have transfer sequences
+     */
+    bool hasTransferQueue();
+
+    /**
+     * Waits for the chunks in flight and releases the resources of the
+     * slots.
+     */
+    void destroy();
+
+  private:
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<Slot> mSlots;
+    uint64_t mChunkSize = 0;
+    // Chunk in flight in each slot, or -1, and the number of its elements
+    std::vector<int64_t> mSlotChunks;
+    std::vector<uint64_t> mSlotCounts;
+
+    void submit(uint32_t slotIndex);
+    void await(uint32_t slotIndex);
+};
+
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+#include <future>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+
+#define KP_DEFAULT_SESSION "DEFAULT"
+
+namespace kp {
+
+/**
+    Base orchestrator which creates and manages device and child components
+
+    Tensors, algorithms, sequences and blocks can be created from several
+    threads at the same time, and clear() can run alongside them. Each queue
+    is submitted to by one thread at a time, as Vulkan requires, by the
+    sequences, batches and staging ring of the manager. A sequence itself,
+    and the sequences sharing a command pool, must still be recorded and
+    evaluated by one thread at a time.
+*/
+class Manager
 {
   public:
     /**
-     * Default constructor with parameters that provides the core vulkan resources 
-     * and the tensors that will be used in the operation. The tensors provided 
-     * cannot be of type TensorTypes::eStorage.
+     * Memory usage of the device and of the tensors created by the manager.
+     */
+    struct MemoryStats
+    {
+        std::vector<MemoryPool::HeapStats> heaps; ///< Indexed by heap index
+        uint32_t tensorCount = 0; ///< Live tensors owning their memory
+        uint32_t viewCount = 0;   ///< Live views aliasing other tensors
+        vk::DeviceSize primaryMemorySize = 0; ///< Bytes of primary buffers
+        vk::DeviceSize stagingMemorySize = 0; ///< Bytes of staging buffers
+    };
+
+    /**
+     * Role of a queue of the manager, which selects the queue a sequence is
+     * submitted to without knowing the queue families of the device. A role
+     * without a dedicated queue family falls back to the compute queue.
+     */
+    enum class QueueRole
+    {
+        eCompute = 0,      ///< First queue family supporting compute
+        eAsyncCompute = 1, ///< Compute queue family without graphics
+        eTransfer = 2,     ///< Transfer queue family without compute
+        eHighPriority = 3, ///< Compute queue with the highest priority
+    };
+
+    /**
+     * Priority of a queue requested by the manager. The priority orders the
+     * queues of the device, while the global priority orders the queues of
+     * the device against the queues of other processes, and is requested
+     * through VK_KHR_global_priority or VK_EXT_global_priority when the
+     * device supports one of them. Vulkan applies the global priority to a
+     * queue family, so a family gets the highest global priority among its
+     * queues.
+     */
+    struct QueuePriority
+    {
+        float priority = 1.0f; ///< From 0 to 1, relative to the device queues
+        vk::QueueGlobalPriorityEXT globalPriority =
+          vk::QueueGlobalPriorityEXT::eMedium; ///< Relative to other processes
+    };
+
+    /**
+     * Requirements of the physical device to select by capabilities rather
+     * than by index, see Manager::selectDevice.
+     */
+    struct DeviceRequirements
+    {
+        std::vector<std::string> extensions; ///< Required, and enabled
+        vk::PhysicalDeviceFeatures features; ///< Features set are required
+        uint32_t minSubgroupSize = 0; ///< Minimum subgroup size
+        vk::SubgroupFeatureFlags subgroupOperations; ///< Required in compute
+        bool allowCpu = true; ///< Whether CPU devices such as llvmpipe count
+    };
+
+    /**
+        Base constructor and default used which creates the base resources
+       including choosing the device 0 by default.
+    */
+    Manager();
+
+    /**
+     * Similar to base constructor but allows for further configuration to use
+     * when creating the Vulkan resources.
+     *
+     * The Vulkan instance is shared by the managers of the process created
+     * without host allocator, which skips its creation and the enumeration of
+     * the layers and extensions for all but the first of them. It is
+     * destroyed along with the last of them.
+     *
+     * @param physicalDeviceIndex The index of the physical device to use
+     * @param familyQueueIndices (Optional) List of queue indices to add for
+     * explicit allocation. If empty, a queue of the first compute family is
+     * created along with a queue of the dedicated compute family and of the
+     * transfer only family when the device has them, see QueueRole
+     * @param desiredExtensions The desired extensions to load from
+     * physicalDevice
+     * @param pipelineCachePath (Optional) File previously written by
+     * savePipelineCache to preload the pipeline cache from, which is ignored
+     * if missing or created for a different device
+     * @param queuePriorities (Optional) Priority of each queue, in the order
+     * of the family queue indices or of the queues created by default. If
+     * empty, every queue has a priority of 1 and the default global priority
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy every Vulkan object of the manager and its components with,
+     * including the instance and the device
+     */
+    Manager(uint32_t physicalDeviceIndex,
+            const std::vector<uint32_t>& familyQueueIndices = {},
+            const std::vector<std::string>& desiredExtensions = {},
+            const std::string& pipelineCachePath = "",
+            const std::vector<QueuePriority>& queuePriorities = {},
+            std::shared_ptr<HostAllocator> hostAllocator = nullptr);
+
+    /**
+     * Constructor selecting the physical device with the highest score for
+     * the requirements provided, instead of a device index, see selectDevice.
+     * The extensions of the requirements are enabled on the device.
+     *
+     * @param requirements The requirements of the physical device to select
+     * @param familyQueueIndices (Optional) List of queue indices to add for
+     * explicit allocation, see the constructor with a device index
+     * @param desiredExtensions The desired extensions to load from
+     * physicalDevice in addition to the required ones
+     * @param pipelineCachePath (Optional) File previously written by
+     * savePipelineCache to preload the pipeline cache from
+     * @param queuePriorities (Optional) Priority of each queue, see the
+     * constructor with a device index
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy every Vulkan object of the manager and its components with,
+     * including the instance and the device
+     */
+    Manager(const DeviceRequirements& requirements,
+            const std::vector<uint32_t>& familyQueueIndices = {},
+            const std::vector<std::string>& desiredExtensions = {},
+            const std::string& pipelineCachePath = "",
+            const std::vector<QueuePriority>& queuePriorities = {},
+            std::shared_ptr<HostAllocator> hostAllocator = nullptr);
+
+    /**
+     * Manager constructor which allows your own vulkan application to integrate
+     * with the kompute use.
+     *
+     * @param instance Vulkan compute instance to base this application
+     * @param physicalDevice Vulkan physical device to use for application
+     * @param device Vulkan logical device to use for all base resources
+     * @param physicalDeviceIndex Index for vulkan physical device used
+     * @param pipelineCachePath (Optional) File previously written by
+     * savePipelineCache to preload the pipeline cache from
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy every Vulkan object of the manager and its components with,
+     * which should be the callbacks the device was created with
+     * @param enabledFeatures (Optional) Core features the device was created
+     * with, such as pipelineStatisticsQuery for the pipeline statistics of
+     * sequences. Features left out are treated as disabled.
+     */
+    Manager(std::shared_ptr<vk::Instance> instance,
+            std::shared_ptr<vk::PhysicalDevice> physicalDevice,
+            std::shared_ptr<vk::Device> device,
+            const std::string& pipelineCachePath = "",
+            std::shared_ptr<HostAllocator> hostAllocator = nullptr,
+            const vk::PhysicalDeviceFeatures& enabledFeatures = {});
+
+    /**
+     * Manager destructor which would ensure all owned resources are destroyed
+     * unless explicitly stated that resources should not be destroyed or freed.
+     */
+    ~Manager();
+
+    /**
+     * Create a managed sequence that will be destroyed by this manager
+     * if it hasn't been destroyed by its reference count going to zero.
+     *
+     * @param queueIndex The queue to use from the available queues
+     * @param nrOfTimestamps The maximum number of timestamps to allocate.
+     * If zero (default), disables latching of timestamps.
+     * @param inFlightDepth The number of evalAsync submissions the sequence
+     * can have in flight at the same time, 1 by default
+     * @param shareCommandPool Whether to allocate the command buffers from a
+     * command pool shared by the sequences of the same queue family, owned by
+     * the manager, instead of creating a pool for the sequence. Sequences
+     * sharing a pool must not be recorded from different threads at once.
+     * @param totalPipelineStatistics The number of operations whose compute
+     * shader invocations are counted when they dispatch an algorithm, see
+     * Sequence::getOpTimings. If zero (default), disables the statistics.
+     * @returns Shared pointer with initialised sequence
+     */
+    std::shared_ptr<Sequence> sequence(uint32_t queueIndex = 0,
+                                       uint32_t totalTimestamps = 0,
+                                       uint32_t inFlightDepth = 1,
+                                       bool shareCommandPool = false,
+                                       uint32_t totalPipelineStatistics = 0);
+
+    /**
+     * Create a managed sequence submitted to the queue of a role. Sequences
+     * of the transfer role can only record operations that copy or sync
+     * tensors, as their queue may not support compute.
+     *
+     * @param queueRole The role of the queue to use
+     * @param nrOfTimestamps The maximum number of timestamps to allocate.
+     * If zero (default), disables latching of timestamps.
+     * @param inFlightDepth The number of evalAsync submissions the sequence
+     * can have in flight at the same time, 1 by default
+     * @param shareCommandPool Whether to allocate the command buffers from a
+     * command pool shared by the sequences of the same queue family
+     * @param totalPipelineStatistics The number of operations whose compute
+     * shader invocations are counted when they dispatch an algorithm
+     * @returns Shared pointer with initialised sequence
+     */
+    std::shared_ptr<Sequence> sequence(QueueRole queueRole,
+                                       uint32_t totalTimestamps = 0,
+                                       uint32_t inFlightDepth = 1,
+                                       bool shareCommandPool = false,
+                                       uint32_t totalPipelineStatistics = 0);
+
+    /**
+     * Index of the queue used for a role, which can be passed to the
+     * functions taking a queue index.
+     *
+     * @param queueRole The role of the queue
+     * @returns Index of the queue, the index of the compute queue if the
+     * device has no dedicated queue family for the role
+     */
+    uint32_t queueIndex(QueueRole queueRole);
+
+    /**
+     * Priority requested for a queue when the manager created the device.
+     *
+     * @param queueIndex The queue from the available queues
+     * @returns Priority of the queue
+     */
+    QueuePriority queuePriority(uint32_t queueIndex);
+
+    /**
+     * Submits the recorded operations of the sequence as with evalAsync, and
+     * runs the callback once the submission completes and has been awaited.
+     * The fences of all the sequences submitted this way are waited for by a
+     * single thread owned by the manager, which also runs the callbacks.
+     * The sequence must not be used until the callback runs.
+     *
+     * @param sequence The sequence to submit
+     * @param callback The function to run with the sequence once completed
+     */
+    void evalAsync(std::shared_ptr<Sequence> sequence,
+                   std::function<void(std::shared_ptr<Sequence>)> callback);
+
+    /**
+     * Submits the recorded operations of the sequence as with evalAsync,
+     * returning a future that becomes ready once the submission completes
+     * and has been awaited by the thread owned by the manager. The sequence
+     * must not be used until the future is ready.
+     *
+     * @param sequence The sequence to submit
+     * @returns Future holding the sequence, or the exception of evalAwait
+     */
+    std::future<std::shared_ptr<Sequence>> evalAsync(
+      std::shared_ptr<Sequence> sequence);
+
+    /**
+     * Submits the recorded operations of the sequence as with evalAsync, and
+     * runs the completion once the submission completes and has been awaited,
+     * with the exception of evalAwait if any. Like the callback it runs on
+     * the thread owned by the manager, which lets bindings forward the result
+     * to another thread, such as to the future of an event loop.
+     *
+     * @param sequence The sequence to submit
+     * @param completion The function to run with the sequence and the
+     * exception, null if none, once completed
+     */
+    void evalAsync(
+      std::shared_ptr<Sequence> sequence,
+      std::function<void(std::shared_ptr<Sequence>, std::exception_ptr)>
+        completion);
+
+    /**
+     * Create a managed block of operations recorded into a secondary command
+     * buffer, which can be recorded into the sequences of the same queue
+     * without recording its operations again.
+     *
+     * @param queueIndex The queue of the sequences the block is recorded into
+     * @returns Shared pointer with initialised block
+     */
+    std::shared_ptr<Block> block(uint32_t queueIndex = 0);
+
+    /**
+     * Submits the recorded operations of several sequences at once. The
+     * sequences targeting the same queue are grouped into a single queue
+     * submit signaling a single fence, which reduces the submission overhead
+     * when many small sequences are sent together.
+     *
+     * @param sequences The sequences to submit, each as with evalAsync
+     * @returns Shared pointer to the batch which can be awaited as a group
+     */
+    std::shared_ptr<SubmitBatch> submit(
+      const std::vector<std::shared_ptr<Sequence>>& sequences);
+
+    /**
+     * Create a scheduler distributing the operations of independent
+     * sequences across all the queues of the manager supporting compute,
+     * with sequences of its own on each queue. The submissions are awaited
+     * by the thread owned by the manager that also awaits evalAsync.
+     *
+     * @param sequencesPerQueue The number of submissions each queue can run
+     * at the same time
+     * @returns Shared pointer with initialised scheduler
+     */
+    std::shared_ptr<Scheduler> scheduler(uint32_t sequencesPerQueue = 2);
+
+    /**
+     * Create a graph of operations compiled into sequences of the manager
+     * spread across the queues provided. The graph must not be compiled once
+     * the manager is destroyed.
+     *
+     * @param queueIndices (Optional) The queues the operations can run on,
+     * which must support compute. If empty, all the queues of the manager
+     * supporting compute are used when the device supports timeline
+     * semaphores, and the compute queue otherwise
+     * @returns Shared pointer with initialised graph
+     */
+    std::shared_ptr<Graph> graph(
+      const std::vector<uint32_t>& queueIndices = {});
+
+    /**
+     * Create a managed tensor that will be destroyed by this manager
+     * if it hasn't been destroyed by its reference count going to zero.
+     *
+     * @param data The data to initialize the tensor with
+     * @param tensorType The type of tensor to initialize
+     * @param hostMemoryType The type of host visible memory to use
+     * @returns Shared pointer with initialised tensor
+     */
+    template<typename T>
+    std::shared_ptr<TensorT<T>> tensorT(
+      const std::vector<T>& data,
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice,
+      Tensor::HostMemoryTypes hostMemoryType =
+        Tensor::HostMemoryTypes::eCoherent)
+    {
+        KP_LOG_DEBUG("Kompute Manager tensor creation triggered");
+
+        return this->manage(
+          *this->mManagedTensors,
+          new kp::TensorT<T>(this->mPhysicalDevice,
+                             this->mDevice,
+                             data,
+                             tensorType,
+                             hostMemoryType,
+                             this->mMemoryPool,
+                             this->mStagingRing,
+                             this->sharedQueueFamilyIndices(),
+                             this->mDebugUtils,
+                             this->mMetrics,
+                             this->mHostAllocator,
+                             this->mDeviceInfo));
+    }
+
+    std::shared_ptr<TensorT<float>> tensor(
+      const std::vector<float>& data,
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice,
+      Tensor::HostMemoryTypes hostMemoryType =
+        Tensor::HostMemoryTypes::eCoherent)
+    {
+        return this->tensorT<float>(data, tensorType, hostMemoryType);
+    }
+
+    std::shared_ptr<Tensor> tensor(
+      void* data,
+      uint64_t elementTotalCount,
+      uint32_t elementMemorySize,
+      const Tensor::TensorDataTypes& dataType,
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice,
+      Tensor::HostMemoryTypes hostMemoryType =
+        Tensor::HostMemoryTypes::eCoherent)
+    {
+        return this->manage(
+          *this->mManagedTensors,
+          new kp::Tensor(this->mPhysicalDevice,
+                         this->mDevice,
+                         data,
+                         elementTotalCount,
+                         elementMemorySize,
+                         dataType,
+                         tensorType,
+                         hostMemoryType,
+                         this->mMemoryPool,
+                         this->mStagingRing,
+                         this->sharedQueueFamilyIndices(),
+                         this->mDebugUtils,
+                         this->mMetrics,
+                         this->mHostAllocator,
+                         this->mDeviceInfo));
+    }
+
+    /**
+     * Create a managed tensor that only allocates its GPU memory, without any
+     * host data to initialise it from. This is intended for output and
+     * scratch tensors, including tensors of type eStorage, and for tensors
+     * whose data is written directly in their mapped host memory through
+     * rawData, which avoids copying it from an intermediate buffer.
+     *
+     * @param elementTotalCount The number of elements of the tensor
+     * @param dataType The data type of the elements of the tensor
+     * @param tensorType The type of tensor to initialize
+     * @param zeroInitialise Whether to zero the memory, which is done on the
+     * GPU with a fill command rather than on the host
+     * @param hostMemoryType The type of host visible memory to use
+     * @returns Shared pointer with initialised tensor
+     */
+    std::shared_ptr<Tensor> tensor(
+      uint64_t elementTotalCount,
+      const Tensor::TensorDataTypes& dataType,
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice,
+      bool zeroInitialise = false,
+      Tensor::HostMemoryTypes hostMemoryType =
+        Tensor::HostMemoryTypes::eCoherent);
+
+    /**
+     * Create a managed tensor of type eImage, holding its data in a 2D image
+     * bound as a storage image by algorithms. When the manager was created
+     * from the device of a renderer, the image can be sampled by the
+     * renderer without copying it. The data must be synced to the image with
+     * OpTensorSyncDevice, or the image filled with OpTensorFill, before
+     * shaders access it.
+     *
+     * @param data Data of width * height * channels elements in row major
+     * order, or null to leave the host data uninitialised
+     * @param width Width of the image in texels
+     * @param height Height of the image in texels
+     * @param channels Number of channels of a texel, which is 1, 2 or 4
+     * @param dataType The data type of the channels
+     * @param hostMemoryType The type of host visible memory to use
+     * @returns Shared pointer with initialised tensor
+     */
+    std::shared_ptr<Tensor> image(void* data,
+                                  uint32_t width,
+                                  uint32_t height,
+                                  uint32_t channels,
+                                  const Tensor::TensorDataTypes& dataType,
+                                  Tensor::HostMemoryTypes hostMemoryType =
+                                    Tensor::HostMemoryTypes::eCoherent);
+
+    /**
+     * Create a sparse CSR matrix made of three managed tensors, holding the
+     * row pointers, the column indices and the values of the non zeros. The
+     * arrays are checked to describe a valid matrix and copied into the host
+     * memory of the tensors, which have to be synced to the device with
+     * OpTensorSyncDevice before shaders access them.
+     *
+     * @param rows The number of rows of the matrix
+     * @param columns The number of columns of the matrix
+     * @param nonZeroCount The number of non zeros of the matrix
+     * @param rowPointers Array of rows + 1 indices of the first non zero of
+     * each row, followed by the number of non zeros
+     * @param columnIndices Array of the column of each non zero
+     * @param values Array of the value of each non zero
+     * @param tensorType The type of the tensors, eDevice or eHost
+     * @returns Shared pointer with initialised sparse tensor
+     */
+    std::shared_ptr<SparseTensor> sparseTensor(
+      uint32_t rows,
+      uint32_t columns,
+      uint32_t nonZeroCount,
+      const uint32_t* rowPointers,
+      const uint32_t* columnIndices,
+      const float* values,
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice);
+
+    std::shared_ptr<SparseTensor> sparseTensor(
+      uint32_t rows,
+      uint32_t columns,
+      const std::vector<uint32_t>& rowPointers,
+      const std::vector<uint32_t>& columnIndices,
+      const std::vector<float>& values,
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice);
+
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+    /**
+     * Create a managed tensor importing the memory of an Android hardware
+     * buffer, such as a camera frame, which shaders then read without it
+     * being copied into a vector and a staging buffer first. The manager
+     * must have been created with the
+     * VK_ANDROID_external_memory_android_hardware_buffer extension, and the
+     * buffer must be a blob with GPU data buffer usage.
+     *
+     * @param hardwareBuffer The hardware buffer to import, referenced by the
+     * tensor until it is destroyed
+     * @param dataType The data type of the elements of the buffer
+     * @returns Shared pointer with initialised tensor, of type eHost if the
+     * buffer can be mapped and eStorage otherwise
+     */
+    std::shared_ptr<Tensor> tensor(AHardwareBuffer* hardwareBuffer,
+                                   const Tensor::TensorDataTypes& dataType);
+#endif
+
+    /**
+     * Default non-template function that can be used to create algorithm objects
+     * which provides default types to the push and spec constants as floats.
      *
-     * @param tensors Tensors that will be used to create in operation.
+     * @param tensors (optional) The tensors to initialise the algorithm with
+     * @param spirv (optional) The SPIRV bytes for the algorithm to dispatch
+     * @param workgroup (optional) kp::Workgroup for algorithm to use, and
+     * defaults to (tensor[0].size(), 1, 1)
+     * @param specializationConstants (optional) float vector to use for
+     * specialization constants, and defaults to an empty constant
+     * @param pushConstants (optional) float vector to use for push constants,
+     * and defaults to an empty constant
+     * @param bindingMode (optional) How the tensors are passed to the shader,
+     * see Algorithm::BindingModes
+     * @returns Shared pointer with initialised algorithm
      */
-    OpTensorSyncLocal(const std::vector<std::shared_ptr<Tensor>>& tensors);
+    std::shared_ptr<Algorithm> algorithm(
+      const std::vector<std::shared_ptr<Tensor>>& tensors = {},
+      const std::vector<uint32_t>& spirv = {},
+      const Workgroup& workgroup = {},
+      const std::vector<float>& specializationConstants = {},
+      const std::vector<float>& pushConstants = {},
+      Algorithm::BindingModes bindingMode =
+        Algorithm::BindingModes::eDescriptors)
+    {
+        return this->algorithm<>(tensors,
+                                 spirv,
+                                 workgroup,
+                                 specializationConstants,
+                                 pushConstants,
+                                 bindingMode);
+    }
 
     /**
-     * Default destructor. This class does not manage memory so it won't be expecting 
-     * the parent to perform a release.
+     * Create a managed view that aliases a range of elements of a parent
+     * tensor, sharing its buffers and memory so operations and algorithms
+     * can run in place on slices of a larger allocation.
+     *
+     * @param parent The tensor owning the memory to alias
+     * @param offset Index of the first element of the parent in the view
+     * @param count Number of elements of the view
+     * @returns Shared pointer with initialised tensor view
      */
-    ~OpTensorSyncLocal() override;
+    template<typename T>
+    std::shared_ptr<TensorT<T>> tensorView(std::shared_ptr<TensorT<T>> parent,
+                                           uint64_t offset,
+                                           uint64_t count)
+    {
+        KP_LOG_DEBUG("Kompute Manager tensor view creation triggered");
+
+        return this->manage(*this->mManagedTensors,
+                            new kp::TensorT<T>(parent, offset, count));
+    }
+
+    std::shared_ptr<Tensor> tensorView(std::shared_ptr<Tensor> parent,
+                                       uint64_t offset,
+                                       uint64_t count)
+    {
+        KP_LOG_DEBUG("Kompute Manager tensor view creation triggered");
+
+        return this->manage(*this->mManagedTensors,
+                            new kp::Tensor(parent, offset, count));
+    }
 
     /**
-     * For device tensors, it records the copy command for the tensor to copy the 
-     * data from its device to staging memory.
+     * Create a managed algorithm that will be destroyed by this manager
+     * if it hasn't been destroyed by its reference count going to zero.
      *
-     * @param commandBuffer The command buffer to record the command into.
+     * @param tensors (optional) The tensors to initialise the algorithm with
+     * @param spirv (optional) The SPIRV bytes for the algorithm to dispatch
+     * @param workgroup (optional) kp::Workgroup for algorithm to use, and
+     * defaults to (tensor[0].size(), 1, 1)
+     * @param specializationConstants (optional) templatable vector parameter to use for
+     * specialization constants, and defaults to an empty constant
+     * @param pushConstants (optional) templatable vector parameter to use for push constants,
+     * and defaults to an empty constant
+     * @param bindingMode (optional) How the tensors are passed to the shader,
+     * with BindingModes::eDeviceAddresses requiring hasBufferDeviceAddress
+     * @returns Shared pointer with initialised algorithm
      */
-    void record(const vk::CommandBuffer& commandBuffer) override;
+    template<typename S = float, typename P = float>
+    std::shared_ptr<Algorithm> algorithm(
+      const std::vector<std::shared_ptr<Tensor>>& tensors,
+      const std::vector<uint32_t>& spirv,
+      const Workgroup& workgroup,
+      const std::vector<S>& specializationConstants,
+      const std::vector<P>& pushConstants,
+      Algorithm::BindingModes bindingMode =
+        Algorithm::BindingModes::eDescriptors)
+    {
+
+        KP_LOG_DEBUG("Kompute Manager algorithm creation triggered");
+
+        uint32_t maxPushConstantsSize =
+          this->mDeviceInfo->properties().limits.maxPushConstantsSize;
+        return this->manage(*this->mManagedAlgorithms,
+                            new kp::Algorithm(this->mDevice,
+                                              tensors,
+                                              spirv,
+                                              workgroup,
+                                              specializationConstants,
+                                              pushConstants,
+                                              this->mPipelineCache,
+                                              this->mShaderCache,
+                                              this->mDescriptorAllocator,
+                                              this->mDefaultLocalSize,
+                                              this->mDebugUtils,
+                                              this->mMetrics,
+                                              this->mHostAllocator,
+                                              bindingMode,
+                                              maxPushConstantsSize));
+    }
 
     /**
-     * Does not perform any preEval commands.
+     * Create a managed algorithm like algorithm, whose resources are created
+     * and its pipeline compiled on a pool of worker threads owned by the
+     * manager, so many algorithms can be compiled in parallel. The algorithm
+     * is returned right away, and its functions block until it is built the
+     * first time they are called, rethrowing the exception of the build if
+     * it failed.
      *
-     * @param commandBuffer The command buffer to record the command into.
+     * @param tensors The tensors to initialise the algorithm with
+     * @param spirv The spirv bytes for the shader to run
+     * @param workgroup (optional) kp::Workgroup for number of dispatches
+     * @param specializationConstants (optional) templatable vector parameter to
+     * use for specialization constants, and defaults to an empty constant
+     * @param pushConstants (optional) templatable vector parameter to use for
+     * push constants, and defaults to an empty constant
+     * @param bindingMode (optional) How the tensors are passed to the shader,
+     * see Algorithm::BindingModes
+     * @returns Shared pointer with the algorithm being built
      */
-    virtual void preEval(const vk::CommandBuffer& commandBuffer) override;
+    template<typename S = float, typename P = float>
+    std::shared_ptr<Algorithm> algorithmAsync(
+      const std::vector<std::shared_ptr<Tensor>>& tensors,
+      const std::vector<uint32_t>& spirv,
+      const Workgroup& workgroup = {},
+      const std::vector<S>& specializationConstants = {},
+      const std::vector<P>& pushConstants = {},
+      Algorithm::BindingModes bindingMode =
+        Algorithm::BindingModes::eDescriptors)
+    {
+        KP_LOG_DEBUG("Kompute Manager asynchronous algorithm creation "
+                     "triggered");
+
+        uint32_t maxPushConstantsSize =
+          this->mDeviceInfo->properties().limits.maxPushConstantsSize;
+        std::shared_ptr<Algorithm> algorithm =
+          this->manage(*this->mManagedAlgorithms,
+                       new kp::Algorithm(this->mDevice,
+                                         {},
+                                         {},
+                                         {},
+                                         std::vector<S>(),
+                                         std::vector<P>(),
+                                         this->mPipelineCache,
+                                         this->mShaderCache,
+                                         this->mDescriptorAllocator,
+                                         this->mDefaultLocalSize,
+                                         this->mDebugUtils,
+                                         this->mMetrics,
+                                         this->mHostAllocator,
+                                         bindingMode,
+                                         maxPushConstantsSize));
+
+        algorithm->rebuildAsync(*this->workerPool(),
+                                tensors,
+                                spirv,
+                                workgroup,
+                                specializationConstants,
+                                pushConstants);
+
+        return algorithm;
+    }
 
     /**
-     * For host tensors it performs the map command from the host memory into local memory.
+     * Create a pipeline streaming chunks of host data through an algorithm,
+     * with the tensors, algorithm and sequences of each chunk in flight. The
+     * uploads and downloads run on the transfer queue, overlapping with the
+     * dispatches, when the device has a dedicated transfer queue and
+     * timeline semaphores.
      *
-     * @param commandBuffer The command buffer to record the command into.
+     * @param spirv The spirv bytes of the shader run on each chunk, whose
+     * bindings are the inputs followed by the outputs
+     * @param chunkSize The number of elements of each tensor of a chunk
+     * @param inputCount (optional) The number of input tensors of a chunk
+     * @param outputCount (optional) The number of output tensors of a chunk
+     * @param depth (optional) The number of chunks in flight at the same
+     * time, three to overlap an upload, a dispatch and a download
+     * @param workgroup (optional) kp::Workgroup of the algorithm, which
+     * defaults to (chunkSize, 1, 1)
+     * @param specializationConstants (optional) templatable vector parameter
+     * to use for specialization constants
+     * @param pushConstants (optional) templatable vector parameter to use for
+     * push constants
+     * @returns Shared pointer with initialised stream pipeline
      */
-    virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
+    template<typename T, typename S = float, typename P = float>
+    std::shared_ptr<StreamPipeline> streamPipeline(
+      const std::vector<uint32_t>& spirv,
+      uint64_t chunkSize,
+      uint32_t inputCount = 1,
+      uint32_t outputCount = 1,
+      uint32_t depth = 3,
+      const Workgroup& workgroup = {},
+      const std::vector<S>& specializationConstants = {},
+      const std::vector<P>& pushConstants = {})
+    {
+        KP_LOG_DEBUG("Kompute Manager stream pipeline creation triggered");
 
-  private:
-    // -------------- ALWAYS OWNED RESOURCES
-    std::vector<std::shared_ptr<Tensor>> mTensors;
-};
+        if (!depth || !chunkSize) {
+            throw std::runtime_error(
+              "Kompute Manager stream pipeline requires a depth and a chunk "
+              "size");
+        }
 
-} // End namespace kp
+        // Transfers only overlap with the dispatches on a queue of their own
+        uint32_t computeQueue = this->queueIndex(QueueRole::eCompute);
+        uint32_t transferQueue = this->queueIndex(QueueRole::eTransfer);
+        bool transferSequences =
+          this->mTimelineSemaphores && transferQueue != computeQueue;
+
+        std::vector<StreamPipeline::Slot> slots(depth);
+        for (StreamPipeline::Slot& slot : slots) {
+            for (uint32_t i = 0; i < inputCount; i++) {
+                slot.inputs.push_back(
+                  this->tensorT<T>(std::vector<T>(chunkSize)));
+            }
+            for (uint32_t i = 0; i < outputCount; i++) {
+                slot.outputs.push_back(
+                  this->tensorT<T>(std::vector<T>(chunkSize)));
+            }
 
-// SPDX-License-Identifier: Apache-2.0
+            std::vector<std::shared_ptr<Tensor>> tensors = slot.inputs;
+            tensors.insert(
+              tensors.end(), slot.outputs.begin(), slot.outputs.end());
+            slot.algorithm = this->algorithm(tensors,
+                                             spirv,
+                                             workgroup,
+                                             specializationConstants,
+                                             pushConstants);
+
+            slot.compute = this->sequence(computeQueue);
+            if (transferSequences) {
+                slot.upload = this->sequence(transferQueue);
+                slot.download = this->sequence(transferQueue);
+            }
+        }
 
-namespace kp {
+        return std::make_shared<StreamPipeline>(slots, chunkSize);
+    }
 
-/**
- * Operation that provides a general abstraction that simplifies the use of 
- * algorithm and parameter components which can be used with shaders.
- * By default it enables the user to provide a dynamic number of tensors
- * which are then passed as inputs.
- */
-class OpAlgoDispatch : public OpBase
-{
-  public:
+    /**
+     * Destroy the GPU resources and all managed resources by manager.
+     **/
+    void destroy();
+    /**
+     * Release the cached resources no longer in use, such as the shader
+     * modules of destroyed algorithms. Managed resources remove themselves
+     * from the manager once their reference count reaches zero.
+     **/
+    void clear();
 
     /**
-     * Constructor that stores the algorithm to use as well as the relevant
-     * push constants to override when recording.
+     * Information about the current device.
      *
-     * @param algorithm The algorithm object to use for dispatch
-     * @param pushConstants The push constants to use for override
-     */
-    template<typename T = float>
-    OpAlgoDispatch(const std::shared_ptr<kp::Algorithm>& algorithm,
-            const std::vector<T>& pushConstants = {})
-    {
-        KP_LOG_DEBUG("Kompute OpAlgoDispatch constructor");
+     * @return vk::PhysicalDeviceProperties containing information about the device
+     **/
+    vk::PhysicalDeviceProperties getDeviceProperties() const;
 
-        this->mAlgorithm = algorithm;
+    /**
+     * List the devices available in the current vulkan instance.
+     *
+     * @return vector of physical devices containing their respective properties
+     **/
+    std::vector<vk::PhysicalDevice> listDevices() const;
 
-        if (pushConstants.size()) {
-            uint32_t memorySize = sizeof(decltype(pushConstants.back()));
-            uint32_t size = pushConstants.size();
-            uint32_t totalSize = size * memorySize;
-            this->mPushConstantsData = malloc(totalSize);
-            memcpy(this->mPushConstantsData, pushConstants.data(), totalSize);
-            this->mPushConstantsDataTypeMemorySize = memorySize;
-            this->mPushConstantsSize = size;
+    /**
+     * Select the device of the instance with the highest score for the
+     * requirements provided, see scoreDevice.
+     *
+     * @param requirements The requirements of the physical device
+     * @return Index of the selected device in listDevices
+     **/
+    uint32_t selectDevice(const DeviceRequirements& requirements) const;
+
+    /**
+     * Score a physical device against requirements. Discrete GPUs score above
+     * integrated, virtual and CPU devices, then devices with more device
+     * local memory score higher, then devices with larger subgroups.
+     *
+     * @param physicalDevice The physical device to score
+     * @param requirements The requirements of the physical device
+     * @return The score of the device, or -1 if it does not meet the
+     * requirements
+     **/
+    static int64_t scoreDevice(const vk::PhysicalDevice& physicalDevice,
+                               const DeviceRequirements& requirements);
+
+    /**
+     * Information about the subgroups of the device, such as their size and
+     * the subgroup operations supported in each shader stage.
+     *
+     * @return Vulkan subgroup properties of the physical device
+     **/
+    vk::PhysicalDeviceSubgroupProperties getSubgroupProperties() const;
+
+    /**
+     * Check whether compute shaders of the device support the subgroup
+     * operations provided, which allows selecting the subgroup variants of
+     * the built-in operations at runtime.
+     *
+     * @param operations The subgroup operations required
+     * @return Boolean stating whether all the operations are supported in
+     * compute shaders
+     **/
+    bool supportsSubgroupOperations(vk::SubgroupFeatureFlags operations) const;
+
+    /**
+     * The local size chosen for the device that algorithms specialize the
+     * local_size_x_id of their shaders with when dispatched without an
+     * explicit workgroup. It is KOMPUTE_DEFAULT_LOCAL_SIZE_X rounded up to a
+     * multiple of the subgroup size and clamped to the workgroup size limits
+     * of the device.
+     *
+     * @return The default local size of the algorithms of the manager
+     **/
+    uint32_t getDefaultLocalSize() const;
+
+    /**
+     * The memory pool that the tensors created by this manager sub-allocate
+     * their device memory from.
+     *
+     * @return Shared pointer to the memory pool of the manager
+     **/
+    std::shared_ptr<MemoryPool> memoryPool() const;
+
+    /**
+     * The cache through which the algorithms created by this manager share
+     * their shader modules, pipelines and layouts.
+     *
+     * @return Shared pointer to the shader cache of the manager
+     **/
+    std::shared_ptr<ShaderCache> shaderCache() const;
+
+    /**
+     * The allocator that the algorithms created by this manager allocate
+     * their descriptor sets from.
+     *
+     * @return Shared pointer to the descriptor allocator of the manager
+     **/
+    std::shared_ptr<DescriptorAllocator> descriptorAllocator() const;
+
+    /**
+     * Check whether the sequences created by the manager signal timeline
+     * semaphores, which allows them to be passed as dependencies to the
+     * evalAsync of other sequences. This requires VK_KHR_timeline_semaphore
+     * to be provided in the desired extensions of the manager.
+     *
+     * @return Boolean stating whether timeline semaphores are enabled
+     **/
+    bool hasTimelineSemaphores() const;
+
+    /**
+     * Check whether tensors created by the manager have device addresses,
+     * which algorithms built with BindingModes::eDeviceAddresses pass to
+     * their shaders instead of binding descriptor sets. This requires
+     * VK_KHR_buffer_device_address to be provided in the desired extensions
+     * of the manager.
+     *
+     * @return Boolean stating whether buffer device addresses are enabled
+     **/
+    bool hasBufferDeviceAddress() const;
+
+    /**
+     * Check whether the global priorities of the queues were granted, which
+     * requires VK_KHR_global_priority or VK_EXT_global_priority to be
+     * supported by the device, and the process to be allowed the priorities
+     * above the default one by the driver.
+     *
+     * @return Boolean stating whether global priorities are enabled
+     **/
+    bool hasGlobalPriority() const;
+
+    /**
+     * Check whether VK_EXT_debug_utils is enabled, in which case the names
+     * set on the tensors, algorithms and sequences of the manager name their
+     * Vulkan objects, and the commands of each operation of the sequences
+     * are labelled. The extension is enabled on the instance created by the
+     * manager in debug builds, or when the KOMPUTE_ENV_DEBUG_UTILS
+     * environment variable is set to a value other than 0, provided the
+     * Vulkan loader or a layer supports it.
+     *
+     * @return Boolean stating whether debug utils are enabled
+     **/
+    bool hasDebugUtils() const;
+
+    /**
+     * Check whether shaders of the device can access tensors of the data type
+     * provided in storage buffers. The half, 8 and 16 bit integer types
+     * require the 8 or 16 bit storage features, which are enabled when the
+     * manager creates the device and they are supported, while tensors of
+     * any data type can be created and synced regardless.
+     *
+     * @param dataType The data type of the tensors
+     * @return Boolean stating whether shaders can access the data type
+     **/
+    bool supportsDataType(const Tensor::TensorDataTypes& dataType) const;
+
+    /**
+     * Reports the usage and budget of each memory heap, together with the
+     * live tensors and the size of their buffers. The tensors are only
+     * tracked when the manager manages its resources, which is not the case
+     * when it is created from an existing vulkan device.
+     *
+     * @return Memory statistics of the device and the tensors
+     **/
+    MemoryStats memoryStats();
+
+    /**
+     * Reads the counters of the work done by the tensors, algorithms and
+     * sequences created by the manager, along with the number of them alive.
+     * The counters are always updated, and the resources are only counted
+     * when the manager manages its resources.
+     *
+     * @return Snapshot of the counters and the live resources
+     **/
+    Metrics::Snapshot metrics();
+
+    /**
+     * Sets the counters returned by metrics back to zero. The live resource
+     * counts are not affected.
+     **/
+    void resetMetrics();
+
+    /**
+     * The host allocation callbacks provided on construction, whose stats
+     * can be read around an operation to measure the host memory the driver
+     * allocates for it.
+     *
+     * @return The host allocator of the manager, null if none was provided
+     **/
+    std::shared_ptr<HostAllocator> hostAllocator();
+
+    /**
+     * Sets a soft limit on the device local memory that the manager can
+     * allocate for its tensors. Allocations exceeding the limit throw before
+     * reaching the driver, so the available headroom can be relied upon.
+     *
+     * @param limit The limit in bytes applied to every device local heap, or
+     * 0 to remove the limit
+     **/
+    void setDeviceMemoryLimit(vk::DeviceSize limit);
+
+    /**
+     * Enables a shared staging ring of fixed size for all the device tensors
+     * created after this call, which then don't hold a staging buffer of
+     * their own. Their data is kept in host memory, uploaded through the ring
+     * before a sequence with OpTensorSyncDevice is submitted, and downloaded
+     * after a sequence with OpTensorSyncLocal completes. Sequences recording
+     * these syncs must run on the queue of the ring, with the syncs to device
+     * first and the syncs to local last.
+     *
+     * @param ringSize The total size in bytes of the staging ring
+     * @param queueIndex The queue to submit the ring transfers to
+     **/
+    void enableStagingRing(vk::DeviceSize ringSize = KOMPUTE_STAGING_RING_SIZE,
+                           uint32_t queueIndex = 0);
+
+    /**
+     * Sets whether the buffers of the tensors created after this call are
+     * shared concurrently between the queue families of the manager, which
+     * is the default. This lets sequences of different queues, such as the
+     * transfer and compute roles, access the same tensors without queue
+     * family ownership transfers. Tensors used from a single queue family
+     * can disable it, as exclusive buffers may be faster on some devices.
+     *
+     * @param concurrentSharing Whether to share the buffers concurrently
+     **/
+    void setConcurrentSharing(bool concurrentSharing);
+
+    /**
+     * Writes the contents of the pipeline cache shared by the algorithms of
+     * the manager to a file, so the pipelines compiled so far can be
+     * preloaded by passing the file to the constructor of a later manager.
+     *
+     * @param path The file to write the pipeline cache data to
+     **/
+    void savePipelineCache(const std::string& path);
+
+  private:
+    // -------------- OPTIONALLY OWNED RESOURCES
+    std::shared_ptr<vk::Instance> mInstance = nullptr;
+    bool mFreeInstance = false;
+    std::shared_ptr<vk::PhysicalDevice> mPhysicalDevice = nullptr;
+    std::shared_ptr<vk::Device> mDevice = nullptr;
+    bool mFreeDevice = false;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    // Properties of the physical device, queried once when it is selected
+    std::shared_ptr<DeviceInfo> mDeviceInfo = nullptr;
+    std::shared_ptr<MemoryPool> mMemoryPool = nullptr;
+    std::shared_ptr<StagingRing> mStagingRing = nullptr;
+    std::shared_ptr<CompletionWaiter> mCompletionWaiter = nullptr;
+    // Pipeline cache shared by the algorithms created by the manager
+    std::shared_ptr<vk::PipelineCache> mPipelineCache = nullptr;
+    std::shared_ptr<ShaderCache> mShaderCache = nullptr;
+    std::shared_ptr<DescriptorAllocator> mDescriptorAllocator = nullptr;
+    std::shared_ptr<WorkerPool> mWorkerPool = nullptr;
+    // Functions of VK_EXT_debug_utils, null when the extension is disabled
+    std::shared_ptr<DebugUtils> mDebugUtils = nullptr;
+    // Counters shared by the components created by the manager
+    std::shared_ptr<Metrics> mMetrics = std::make_shared<Metrics>();
+    // Host allocation callbacks of every Vulkan object, null for the default
+    std::shared_ptr<HostAllocator> mHostAllocator = nullptr;
+    // Resources deregister themselves from the registries when released
+    std::shared_ptr<ResourceRegistry<Tensor>> mManagedTensors =
+      std::make_shared<ResourceRegistry<Tensor>>();
+    std::shared_ptr<ResourceRegistry<Sequence>> mManagedSequences =
+      std::make_shared<ResourceRegistry<Sequence>>();
+    std::shared_ptr<ResourceRegistry<Block>> mManagedBlocks =
+      std::make_shared<ResourceRegistry<Block>>();
+    std::shared_ptr<ResourceRegistry<Algorithm>> mManagedAlgorithms =
+      std::make_shared<ResourceRegistry<Algorithm>>();
+    // Command pools shared by sequences, by queue family index
+    std::unordered_map<uint32_t, std::shared_ptr<vk::CommandPool>>
+      mSharedCommandPools;
+    std::mutex mSharedCommandPoolsMutex;
+    // Guards the creation of the completion waiter and worker pool
+    std::mutex mLazyResourcesMutex;
+
+    std::vector<uint32_t> mComputeQueueFamilyIndices;
+    std::vector<std::shared_ptr<vk::Queue>> mComputeQueues;
+    // Serialises the submissions to each queue, by queue index
+    std::vector<std::shared_ptr<std::mutex>> mComputeQueueMutexes;
+    // Index of the queue of each role, by QueueRole value
+    std::vector<uint32_t> mQueueRoleIndices = { 0, 0, 0, 0 };
+    std::vector<QueuePriority> mQueuePriorities;
+
+    bool mManageResources = false;
+    bool mTimelineSemaphores = false;
+    bool mGlobalPriority = false;
+    bool mConcurrentSharing = true;
+    bool mStorage16Bit = false;
+    bool mStorage8Bit = false;
+    uint32_t mDefaultLocalSize = KOMPUTE_DEFAULT_LOCAL_SIZE_X;
+
+#if DEBUG
+#ifndef KOMPUTE_DISABLE_VK_DEBUG_LAYERS
+    vk::DebugReportCallbackEXT mDebugReportCallback;
+    vk::DispatchLoaderDynamic mDebugDispatcher;
+#endif
+#endif
+
+    // Create functions
+    void createInstance();
+    void createInstanceDebug(bool debugUtils, bool validationLayers);
+    void createDevice(const std::vector<uint32_t>& familyQueueIndices = {},
+                      uint32_t hysicalDeviceIndex = 0,
+                      const std::vector<std::string>& desiredExtensions = {},
+                      const std::vector<QueuePriority>& queuePriorities = {});
+    void createPipelineCache(const std::string& pipelineCachePath);
+    bool hasMonotonicTimeDomain();
+    void updateDefaultLocalSize();
+    std::shared_ptr<WorkerPool> workerPool();
+    std::shared_ptr<CompletionWaiter> completionWaiter();
+    std::vector<uint32_t> sharedQueueFamilyIndices();
+
+    // Takes ownership of a resource created, registered to be destroyed with
+    // the manager if it manages its resources
+    template<typename T, typename U>
+    std::shared_ptr<U> manage(ResourceRegistry<T>& registry, U* resource)
+    {
+        if (this->mManageResources) {
+            return registry.add(resource);
         }
+        return std::shared_ptr<U>(resource);
     }
+};
 
+} // End namespace kp
+
+// SPDX-License-Identifier: Apache-2.0
+
+namespace kp {
+
+/**
+ * Tensor distributed across the devices of a MultiManager, made of one
+ * tensor per device. The shards either hold consecutive blocks of rows of
+ * the tensor, or each hold a full replica of it.
+ */
+class ShardedTensor
+{
+  public:
     /**
-     * Default destructor, which is in charge of destroying the algorithm
-     * components but does not destroy the underlying tensors
+     * Distribution of the elements of the tensor across the shards.
      */
-    virtual ~OpAlgoDispatch() override;
+    enum class Layout
+    {
+        eRows = 0,       ///< Each shard holds a block of consecutive rows
+        eReplicated = 1, ///< Each shard holds all the elements
+    };
 
     /**
-     * This records the commands that are to be sent to the GPU. This includes
-     * the barriers that ensure the memory has been copied before going in and
-     * out of the shader, as well as the dispatch operation that sends the
-     * shader processing to the gpu. This function also records the GPU memory
-     * copy of the output data for the staging buffer so it can be read by the
-     * host.
+     * Constructor from the tensors of the shards, which are not copied.
      *
-     * @param commandBuffer The command buffer to record the command into.
+     * @param shards The tensor of each device, in the order of the devices
+     * @param offsets The index in the full tensor of the first element of
+     * each shard
+     * @param size The number of elements of the full tensor
+     * @param layout The distribution of the elements across the shards
      */
-    virtual void record(const vk::CommandBuffer& commandBuffer) override;
+    ShardedTensor(const std::vector<std::shared_ptr<Tensor>>& shards,
+                  const std::vector<uint64_t>& offsets,
+                  uint64_t size,
+                  Layout layout);
 
     /**
-     * Does not perform any preEval commands.
-     *
-     * @param commandBuffer The command buffer to record the command into.
+     * Destructor which does not destroy the shards, which are owned by the
+     * managers of their devices.
      */
-    virtual void preEval(const vk::CommandBuffer& commandBuffer) override;
+    ~ShardedTensor();
 
     /**
-     * Does not perform any postEval commands.
+     * Retrieve the tensors of the shards.
      *
-     * @param commandBuffer The command buffer to record the command into.
+     * @return The tensor of each device, in the order of the devices
      */
-    virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
+    const std::vector<std::shared_ptr<Tensor>>& shards();
 
-private:
-    // -------------- ALWAYS OWNED RESOURCES
-    std::shared_ptr<Algorithm> mAlgorithm;
-    void* mPushConstantsData = nullptr;
-    uint32_t mPushConstantsDataTypeMemorySize = 0;
-    uint32_t mPushConstantsSize = 0;
-};
-
-} // End namespace kp
-
-// SPDX-License-Identifier: Apache-2.0
+    /**
+     * Retrieve the tensor of the shard of a device.
+     *
+     * @param deviceIndex The index of the device in the MultiManager
+     * @return The tensor of the shard
+     */
+    std::shared_ptr<Tensor> shard(uint32_t deviceIndex);
 
-#include <fstream>
+    /**
+     * Retrieve the index in the full tensor of the first element of the
+     * shard of a device, which is 0 for replicated tensors.
+     *
+     * @param deviceIndex The index of the device in the MultiManager
+     * @return The offset of the shard in elements
+     */
+    uint64_t shardOffset(uint32_t deviceIndex);
 
-namespace kp {
+    /**
+     * Retrieve the number of elements of the full tensor.
+     *
+     * @return Number of elements of the full tensor
+     */
+    uint64_t size();
 
-/**
- * Operation that performs multiplication on two tensors and outpus on third
- * tensor.
- */
-class OpMult : public OpAlgoDispatch
-{
-  public:
+    /**
+     * Retrieve the distribution of the elements across the shards.
+     *
+     * @return The layout of the tensor
+     */
+    Layout layout();
 
     /**
-     * Default constructor with parameters that provides the bare minimum
-     * requirements for the operations to be able to create and manage their
-     * sub-components.
+     * Retrieve the host data of the full tensor, concatenating the host data
+     * of the shards of rows, or taken from the first shard if replicated.
+     * The host data of the shards is only updated by syncLocal.
      *
-     * @param tensors Tensors that are to be used in this operation
-     * @param algorithm An algorithm that will be overridden with the OpMult
-     * shader data and the tensors provided which are expected to be 3
+     * @return Vector with the elements of the full tensor
      */
-    OpMult(std::vector<std::shared_ptr<Tensor>> tensors, std::shared_ptr<Algorithm> algorithm)
-        : OpAlgoDispatch(algorithm)
+    template<typename T>
+    std::vector<T> vector()
     {
-        KP_LOG_DEBUG("Kompute OpMult constructor with params");
-
-        if (tensors.size() != 3) {
-            throw std::runtime_error("Kompute OpMult expected 3 tensors but got " + tensors.size());
+        if (this->mLayout == Layout::eReplicated) {
+            return this->mShards[0]->vector<T>();
         }
 
-        std::vector<uint32_t> spirv(
-          (uint32_t*)shader_data::shaders_glsl_opmult_comp_spv,
-          (uint32_t*)(shader_data::shaders_glsl_opmult_comp_spv +
-            kp::shader_data::shaders_glsl_opmult_comp_spv_len));
-
-        algorithm->rebuild<>(tensors, spirv);
+        std::vector<T> data;
+        data.reserve(this->mSize);
+        for (const std::shared_ptr<Tensor>& shard : this->mShards) {
+            std::vector<T> shardData = shard->vector<T>();
+            data.insert(data.end(), shardData.begin(), shardData.end());
+        }
+        return data;
     }
 
-    /**
-     * Default destructor, which is in charge of destroying the algorithm
-     * components but does not destroy the underlying tensors
-     */
-    virtual ~OpMult() override {
-        KP_LOG_DEBUG("Kompute OpMult destructor started");
-    }
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mShards;
+
+    std::vector<uint64_t> mOffsets;
+    uint64_t mSize;
+    Layout mLayout;
 };
 
 } // End namespace kp
 
 // SPDX-License-Identifier: Apache-2.0
 
+#include <functional>
+
 namespace kp {
 
 /**
- *  Container of operations that can be sent to GPU as batch
+ * Orchestrator of several devices, with a manager for each device, which
+ * shards tensors across the devices and dispatches an algorithm on every
+ * shard at the same time.
+ *
+ * The data exchanged between the devices, such as by gather and allReduce,
+ * goes through the host visible staging memory of the shards.
  */
-class Sequence : public std::enable_shared_from_this<Sequence>
+class MultiManager
 {
   public:
     /**
-     * Main constructor for sequence which requires core vulkan components to
-     * generate all dependent resources.
+     * Constructor creating a manager for each of the physical devices.
      *
-     * @param physicalDevice Vulkan physical device
-     * @param device Vulkan logical device
-     * @param computeQueue Vulkan compute queue
-     * @param queueIndex Vulkan compute queue index in device
-     * @param totalTimestamps Maximum number of timestamps to allocate
+     * @param physicalDeviceIndices (Optional) The indices of the physical
+     * devices to use, which are all the devices of the instance if empty. A
+     * device can be listed more than once, in which case it gets several
+     * managers of its own.
+     * @param desiredExtensions The desired extensions to load from each
+     * physical device
      */
-    Sequence(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
-             std::shared_ptr<vk::Device> device,
-             std::shared_ptr<vk::Queue> computeQueue,
-             uint32_t queueIndex,
-             uint32_t totalTimestamps = 0);
+    MultiManager(const std::vector<uint32_t>& physicalDeviceIndices = {},
+                 const std::vector<std::string>& desiredExtensions = {});
+
     /**
-     * Destructor for sequence which is responsible for cleaning all subsequent
-     * owned operations.
+     * Destructor which destroys the managers of the devices along with their
+     * resources.
      */
-    ~Sequence();
+    ~MultiManager();
 
     /**
-     * Record function for operation to be added to the GPU queue in batch. This
-     * template requires classes to be derived from the OpBase class. This
-     * function also requires the Sequence to be recording, otherwise it will
-     * not be able to add the operation.
+     * Retrieve the number of devices, which is the number of shards of the
+     * sharded tensors.
      *
-     * @param op Object derived from kp::BaseOp that will be recoreded by the
-     * sequence which will be used when the operation is evaluated.
-     * @return shared_ptr<Sequence> of the Sequence class itself
+     * @return Number of devices
      */
-    std::shared_ptr<Sequence> record(std::shared_ptr<OpBase> op);
+    uint32_t deviceCount();
 
     /**
-     * Record function for operation to be added to the GPU queue in batch. This
-     * template requires classes to be derived from the OpBase class. This
-     * function also requires the Sequence to be recording, otherwise it will
-     * not be able to add the operation.
+     * Retrieve the manager of a device, to create resources only on that
+     * device.
      *
-     * @param tensors Vector of tensors to use for the operation
-     * @param TArgs Template parameters that are used to initialise operation
-     * which allows for extensible configurations on initialisation.
-     * @return shared_ptr<Sequence> of the Sequence class itself
+     * @param deviceIndex The index of the device
+     * @return The manager of the device
      */
-    template<typename T, typename... TArgs>
-    std::shared_ptr<Sequence> record(
-      std::vector<std::shared_ptr<Tensor>> tensors,
-      TArgs&&... params)
-    {
-        std::shared_ptr<T> op{ new T(tensors, std::forward<TArgs>(params)...) };
-        return this->record(op);
-    }
+    std::shared_ptr<Manager> manager(uint32_t deviceIndex);
+
     /**
-     * Record function for operation to be added to the GPU queue in batch. This
-     * template requires classes to be derived from the OpBase class. This
-     * function also requires the Sequence to be recording, otherwise it will
-     * not be able to add the operation.
+     * Create a tensor sharded by rows, where each device holds a block of
+     * consecutive rows. The rows are split as evenly as possible, with the
+     * first devices holding one more row when they cannot be split evenly.
      *
-     * @param algorithm Algorithm to use for the record often used for OpAlgo
-     * operations
-     * @param TArgs Template parameters that are used to initialise operation
-     * which allows for extensible configurations on initialisation.
-     * @return shared_ptr<Sequence> of the Sequence class itself
+     * @param data The data of the full tensor, stored row by row
+     * @param rowSize The number of elements of each row
+     * @param tensorType The type of the tensors of the shards
+     * @return Shared pointer with the sharded tensor
      */
-    template<typename T, typename... TArgs>
-    std::shared_ptr<Sequence> record(std::shared_ptr<Algorithm> algorithm,
-                                     TArgs&&... params)
+    template<typename T>
+    std::shared_ptr<ShardedTensor> shardRows(
+      const std::vector<T>& data,
+      uint64_t rowSize = 1,
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice)
     {
-        std::shared_ptr<T> op{ new T(algorithm,
-                                     std::forward<TArgs>(params)...) };
-        return this->record(op);
+        KP_LOG_DEBUG("Kompute MultiManager sharding {} elements by rows of {}",
+                     data.size(),
+                     rowSize);
+
+        if (rowSize == 0 || data.size() % rowSize) {
+            throw std::runtime_error(fmt::format(
+              "Kompute MultiManager tensor of {} elements is not made of "
+              "rows of {} elements",
+              data.size(),
+              rowSize));
+        }
+        uint64_t rows = data.size() / rowSize;
+        uint64_t deviceCount = this->mManagers.size();
+        if (rows < deviceCount) {
+            throw std::runtime_error(
+              fmt::format("Kompute MultiManager cannot shard {} rows across "
+                          "{} devices",
+                          rows,
+                          deviceCount));
+        }
+
+        std::vector<std::shared_ptr<Tensor>> shards;
+        std::vector<uint64_t> offsets;
+        uint64_t row = 0;
+        for (uint64_t i = 0; i < deviceCount; i++) {
+            uint64_t shardRows = rows / deviceCount + (i < rows % deviceCount);
+            std::vector<T> shardData(data.begin() + row * rowSize,
+                                     data.begin() +
+                                       (row + shardRows) * rowSize);
+            shards.push_back(
+              this->mManagers[i]->tensorT<T>(shardData, tensorType));
+            offsets.push_back(row * rowSize);
+            row += shardRows;
+        }
+
+        return std::make_shared<ShardedTensor>(
+          shards, offsets, data.size(), ShardedTensor::Layout::eRows);
     }
 
     /**
-     * Eval sends all the recorded and stored operations in the vector of
-     * operations into the gpu as a submit job synchronously (with a barrier).
+     * Create a tensor replicated on every device, such as the weights of a
+     * model whose inputs are sharded.
      *
-     * @return shared_ptr<Sequence> of the Sequence class itself
+     * @param data The data of the tensor
+     * @param tensorType The type of the tensors of the shards
+     * @return Shared pointer with the sharded tensor
      */
-    std::shared_ptr<Sequence> eval();
+    template<typename T>
+    std::shared_ptr<ShardedTensor> replicate(
+      const std::vector<T>& data,
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice)
+    {
+        KP_LOG_DEBUG("Kompute MultiManager replicating {} elements",
+                     data.size());
 
-    /**
-     * Resets all the recorded and stored operations, records the operation
-     * provided and submits into the gpu as a submit job synchronously (with a
-     * barrier).
-     *
-     * @return shared_ptr<Sequence> of the Sequence class itself
-     */
-    std::shared_ptr<Sequence> eval(std::shared_ptr<OpBase> op);
+        std::vector<std::shared_ptr<Tensor>> shards;
+        for (const std::shared_ptr<Manager>& manager : this->mManagers) {
+            shards.push_back(manager->tensorT<T>(data, tensorType));
+        }
+
+        return std::make_shared<ShardedTensor>(
+          shards,
+          std::vector<uint64_t>(shards.size(), 0),
+          data.size(),
+          ShardedTensor::Layout::eReplicated);
+    }
 
     /**
-     * Eval sends all the recorded and stored operations in the vector of
-     * operations into the gpu as a submit job with a barrier.
+     * Create an algorithm on each device, which runs on the shards of the
+     * tensors of that device.
      *
-     * @param tensors Vector of tensors to use for the operation
-     * @param TArgs Template parameters that are used to initialise operation
-     * which allows for extensible configurations on initialisation.
-     * @return shared_ptr<Sequence> of the Sequence class itself
+     * @param tensors The sharded tensors to bind, in the order of their
+     * bindings
+     * @param spirv The SPIRV bytes of the shader
+     * @param workgroup (optional) kp::Workgroup of the algorithms, which
+     * defaults to the size of the first shard of each device
+     * @param specializationConstants (optional) float vector to use for
+     * specialization constants
+     * @param pushConstants (optional) float vector to use for push constants
+     * @returns The algorithm of each device, in the order of the devices
      */
-    template<typename T, typename... TArgs>
-    std::shared_ptr<Sequence> eval(std::vector<std::shared_ptr<Tensor>> tensors,
-                                   TArgs&&... params)
-    {
-        std::shared_ptr<T> op{ new T(tensors, std::forward<TArgs>(params)...) };
-        return this->eval(op);
-    }
+    std::vector<std::shared_ptr<Algorithm>> algorithm(
+      const std::vector<std::shared_ptr<ShardedTensor>>& tensors,
+      const std::vector<uint32_t>& spirv,
+      const Workgroup& workgroup = {},
+      const std::vector<float>& specializationConstants = {},
+      const std::vector<float>& pushConstants = {});
+
     /**
-     * Eval sends all the recorded and stored operations in the vector of
-     * operations into the gpu as a submit job with a barrier.
+     * Copies the host data of the shards to their devices, on every device
+     * at the same time.
      *
-     * @param algorithm Algorithm to use for the record often used for OpAlgo
-     * operations
-     * @param TArgs Template parameters that are used to initialise operation
-     * which allows for extensible configurations on initialisation.
-     * @return shared_ptr<Sequence> of the Sequence class itself
+     * @param tensors The sharded tensors to copy
      */
-    template<typename T, typename... TArgs>
-    std::shared_ptr<Sequence> eval(std::shared_ptr<Algorithm> algorithm,
-                                   TArgs&&... params)
-    {
-        std::shared_ptr<T> op{ new T(algorithm,
-                                     std::forward<TArgs>(params)...) };
-        return this->eval(op);
-    }
+    void syncDevice(const std::vector<std::shared_ptr<ShardedTensor>>& tensors);
 
     /**
-     * Eval Async sends all the recorded and stored operations in the vector of
-     * operations into the gpu as a submit job without a barrier. EvalAwait()
-     * must ALWAYS be called after to ensure the sequence is terminated
-     * correctly.
+     * Copies the data of the shards from their devices to their host data,
+     * on every device at the same time.
      *
-     * @return Boolean stating whether execution was successful.
+     * @param tensors The sharded tensors to copy
      */
-    std::shared_ptr<Sequence> evalAsync();
+    void syncLocal(const std::vector<std::shared_ptr<ShardedTensor>>& tensors);
+
     /**
-     * Clears currnet operations to record provided one in the vector of
-     * operations into the gpu as a submit job without a barrier. EvalAwait()
-     * must ALWAYS be called after to ensure the sequence is terminated
-     * correctly.
+     * Dispatches the algorithm of each device, on every device at the same
+     * time, and waits for all of them to complete.
      *
-     * @return Boolean stating whether execution was successful.
+     * @param algorithms The algorithm of each device, as created by
+     * MultiManager::algorithm
      */
-    std::shared_ptr<Sequence> evalAsync(std::shared_ptr<OpBase> op);
+    void dispatch(const std::vector<std::shared_ptr<Algorithm>>& algorithms);
+
     /**
-     * Eval sends all the recorded and stored operations in the vector of
-     * operations into the gpu as a submit job with a barrier.
+     * Copies the shards of a tensor from their devices and gathers them into
+     * the full tensor on the host.
      *
-     * @param tensors Vector of tensors to use for the operation
-     * @param TArgs Template parameters that are used to initialise operation
-     * which allows for extensible configurations on initialisation.
-     * @return shared_ptr<Sequence> of the Sequence class itself
+     * @param tensor The sharded tensor to gather
+     * @return Vector with the elements of the full tensor
      */
-    template<typename T, typename... TArgs>
-    std::shared_ptr<Sequence> evalAsync(
-      std::vector<std::shared_ptr<Tensor>> tensors,
-      TArgs&&... params)
+    template<typename T>
+    std::vector<T> gather(std::shared_ptr<ShardedTensor> tensor)
     {
-        std::shared_ptr<T> op{ new T(tensors, std::forward<TArgs>(params)...) };
-        return this->evalAsync(op);
+        this->syncLocal({ tensor });
+        return tensor->vector<T>();
     }
+
     /**
-     * Eval sends all the recorded and stored operations in the vector of
-     * operations into the gpu as a submit job with a barrier.
+     * Sums the replicas of a replicated tensor element by element, and
+     * writes the sum to every replica, such as to combine the gradients
+     * computed by each device. The replicas are summed on the host.
      *
-     * @param algorithm Algorithm to use for the record often used for OpAlgo
-     * operations
-     * @param TArgs Template parameters that are used to initialise operation
-     * which allows for extensible configurations on initialisation.
-     * @return shared_ptr<Sequence> of the Sequence class itself
+     * @param tensor The replicated tensor to reduce
      */
-    template<typename T, typename... TArgs>
-    std::shared_ptr<Sequence> evalAsync(std::shared_ptr<Algorithm> algorithm,
-                                        TArgs&&... params)
+    template<typename T>
+    void allReduce(std::shared_ptr<ShardedTensor> tensor)
     {
-        std::shared_ptr<T> op{ new T(algorithm,
-                                     std::forward<TArgs>(params)...) };
-        return this->evalAsync(op);
+        KP_LOG_DEBUG("Kompute MultiManager all reduce of {} elements",
+                     tensor->size());
+
+        if (tensor->layout() != ShardedTensor::Layout::eReplicated) {
+            throw std::runtime_error(
+              "Kompute MultiManager all reduce requires a replicated tensor");
+        }
+
+        this->syncLocal({ tensor });
+
+        std::vector<T> sum(tensor->size(), T(0));
+        for (const std::shared_ptr<Tensor>& shard : tensor->shards()) {
+            std::vector<T> shardData = shard->vector<T>();
+            for (size_t i = 0; i < sum.size(); i++) {
+                sum[i] += shardData[i];
+            }
+        }
+        for (const std::shared_ptr<Tensor>& shard : tensor->shards()) {
+            shard->setRawData(sum.data());
+        }
+
+        this->syncDevice({ tensor });
     }
 
     /**
-     * Eval Await waits for the fence to finish processing and then once it
-     * finishes, it runs the postEval of all operations.
-     *
-     * @param waitFor Number of milliseconds to wait before timing out.
-     * @return shared_ptr<Sequence> of the Sequence class itself
+     * Destroys the managers of the devices along with their resources.
      */
-    std::shared_ptr<Sequence> evalAwait(uint64_t waitFor = UINT64_MAX);
+    void destroy();
 
-    /**
-     * Clear function clears all operations currently recorded and starts
-     * recording again.
-     */
-    void clear();
+  private:
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<std::shared_ptr<Manager>> mManagers;
+
+    std::vector<std::shared_ptr<Tensor>> deviceShards(
+      const std::vector<std::shared_ptr<ShardedTensor>>& tensors,
+      uint32_t deviceIndex);
+    void evalOnDevices(
+      const std::function<void(uint32_t, std::shared_ptr<Sequence>)>& record);
+};
+
+} // End namespace kp
 
+// SPDX-License-Identifier: Apache-2.0
+
+#include <functional>
+
+namespace kp {
+
+/**
+ * Harness timing the operations of sequences with their GPU timestamps
+ * rather than the wall clock, so the time of the submission and of the wait
+ * for completion are left out. Each run evaluates the sequence a number of
+ * times to warm up the caches and clocks of the device, then a number of
+ * repetitions whose times are summarised, along with the GFLOP/s and GB/s
+ * achieved and their fraction of the peak of the device.
+ *
+ * Vulkan reports neither the peak arithmetic rate nor the peak bandwidth of
+ * a device, so the peak bandwidth is measured with buffer copies, and the
+ * peak arithmetic rate is provided by the user, such as from the datasheet
+ * of the device.
+ */
+class Benchmark
+{
+  public:
     /**
-     * Return the timestamps that were latched at the beginning and
-     * after each operation during the last eval() call.
+     * Summary of the times of the repetitions of a run.
      */
-    std::vector<std::uint64_t> getTimestamps();
+    struct Result
+    {
+        std::string label;        ///< Operations timed, all if empty
+        uint32_t repetitions = 0; ///< Number of times summarised
+        double minNs = 0;         ///< Fastest repetition
+        double medianNs = 0;      ///< Median repetition
+        double meanNs = 0;        ///< Mean of the repetitions
+        double stddevNs = 0;      ///< Standard deviation of the repetitions
+        double maxNs = 0;         ///< Slowest repetition
+        double gflops = 0;        ///< At the median time, 0 without flops
+        double gbps = 0;          ///< At the median time, 0 without bytes
+        double peakGflopsFraction = 0; ///< Of gflops, 0 without a peak
+        double peakGbpsFraction = 0;   ///< Of gbps, 0 without a peak
+    };
 
     /**
-     * Begins recording commands for commands to be submitted into the command
-     * buffer.
+     * Constructor for a harness of the device of a manager.
      *
-     * @return Boolean stating whether execution was successful.
+     * @param manager The manager creating the resources of the peak
+     * bandwidth measurement
+     * @param warmup Number of evaluations before the timed ones
+     * @param repetitions Number of timed evaluations, at least 1
      */
-    void begin();
+    Benchmark(std::shared_ptr<Manager> manager,
+              uint32_t warmup = 3,
+              uint32_t repetitions = 10);
 
     /**
-     * Ends the recording and stops recording commands when the record command
-     * is sent.
+     * Times a sequence already recorded, which must have been created with
+     * at least as many timestamps as operations. The time of a repetition is
+     * the sum of the GPU time of the operations with the label provided,
+     * which lets the sync operations of the sequence be left out.
      *
-     * @return Boolean stating whether execution was successful.
+     * @param sequence The sequence to evaluate
+     * @param flops Floating point operations of an evaluation, for GFLOP/s
+     * @param bytes Bytes read and written by an evaluation, for GB/s
+     * @param label (Optional) Label of the operations to time, given when
+     * they were recorded, or all the operations if empty
+     * @return Summary of the times of the repetitions
      */
-    void end();
+    Result run(std::shared_ptr<Sequence> sequence,
+               double flops = 0,
+               double bytes = 0,
+               const std::string& label = "");
 
     /**
-     * Returns true if the sequence is currently in recording activated.
+     * Times a function running on the host with the wall clock, with the
+     * same warmup and repetitions as the sequences, to compare the device
+     * against a host implementation such as numpy.
      *
-     * @return Boolean stating if recording ongoing.
+     * @param function The function to time
+     * @param flops Floating point operations of a call, for GFLOP/s
+     * @param bytes Bytes read and written by a call, for GB/s
+     * @return Summary of the times of the repetitions, without the
+     * fractions of the peak of the device
      */
-    bool isRecording();
+    Result runHost(const std::function<void()>& function,
+                   double flops = 0,
+                   double bytes = 0);
 
     /**
-     * Returns true if the sequence has been initialised, and it's based on the
-     * GPU resources being refrenced.
+     * Measures the peak bandwidth of the device by timing copies between
+     * two device tensors, counting the bytes read and written, and uses it
+     * as the peak of the results of later runs.
      *
-     * @return Boolean stating if is initialized
+     * @param bytes Size of the tensors copied
+     * @return The bandwidth measured, in GB/s
      */
-    bool isInit();
+    double measurePeakBandwidth(uint64_t bytes = 64 * 1024 * 1024);
 
     /**
-     * Clears command buffer and triggers re-record of all the current
-     * operations saved, which is useful if the underlying kp::Tensors or
-     * kp::Algorithms are modified and need to be re-recorded.
+     * Sets the peaks the results of later runs are compared against.
+     *
+     * @param gflops Peak arithmetic rate in GFLOP/s, or 0 if unknown
+     * @param gbps Peak bandwidth in GB/s, or 0 if unknown
      */
-    void rerecord();
+    void setPeak(double gflops, double gbps);
 
     /**
-     * Returns true if the sequence is currently running - mostly used for async
-     * workloads.
+     * Peak arithmetic rate the results are compared against.
      *
-     * @return Boolean stating if currently running.
+     * @return GFLOP/s, or 0 if unknown
      */
-    bool isRunning();
+    double peakGflops() const;
 
     /**
-     * Destroys and frees the GPU resources which include the buffer and memory
-     * and sets the sequence as init=False.
+     * Peak bandwidth the results are compared against.
+     *
+     * @return GB/s, or 0 if unknown
      */
-    void destroy();
+    double peakGbps() const;
 
   private:
     // -------------- NEVER OWNED RESOURCES
-    std::shared_ptr<vk::PhysicalDevice> mPhysicalDevice = nullptr;
-    std::shared_ptr<vk::Device> mDevice = nullptr;
-    std::shared_ptr<vk::Queue> mComputeQueue = nullptr;
-    uint32_t mQueueIndex = -1;
-
-    // -------------- OPTIONALLY OWNED RESOURCES
-    std::shared_ptr<vk::CommandPool> mCommandPool = nullptr;
-    bool mFreeCommandPool = false;
-    std::shared_ptr<vk::CommandBuffer> mCommandBuffer = nullptr;
-    bool mFreeCommandBuffer = false;
-
-    // -------------- ALWAYS OWNED RESOURCES
-    vk::Fence mFence;
-    std::vector<std::shared_ptr<OpBase>> mOperations;
-    std::shared_ptr<vk::QueryPool> timestampQueryPool = nullptr;
+    std::shared_ptr<Manager> mManager;
 
-    // State
-    bool mRecording = false;
-    bool mIsRunning = false;
+    uint32_t mWarmup;
+    uint32_t mRepetitions;
+    double mPeakGflops = 0;
+    double mPeakGbps = 0;
 
-    // Create functions
-    void createCommandPool();
-    void createCommandBuffer();
-    void createTimestampQueryPool(uint32_t totalTimestamps);
+    Result summarize(const std::string& label,
+                     std::vector<double> samplesNs,
+                     double flops,
+                     double bytes);
 };
 
 } // End namespace kp
 
 // SPDX-License-Identifier: Apache-2.0
 
-#include <set>
-#include <unordered_map>
-
-#define KP_DEFAULT_SESSION "DEFAULT"
+#include <cstring>
+#include <map>
 
 namespace kp {
 
 /**
-    Base orchestrator which creates and manages device and child components
-*/
-class Manager
+ * Auto-tuner choosing the workgroup and specialization constants of an
+ * algorithm, such as its local size or tile size, for an input shape. Each
+ * candidate is built and timed with the GPU timestamps of a sequence through
+ * the benchmark harness, and the algorithm is left built with the fastest.
+ *
+ * The choices are kept in a tuning database keyed by the device, the name of
+ * the algorithm and the shape, which is loaded from a file when the tuner is
+ * created and written back after each new choice. Later runs of the
+ * application on the same device and driver reuse the choices without timing
+ * the candidates again.
+ */
+class Tuner
 {
   public:
     /**
-        Base constructor and default used which creates the base resources
-       including choosing the device 0 by default.
-    */
-    Manager();
+     * Configuration of the algorithm tried by the tuner.
+     */
+    struct Candidate
+    {
+        Workgroup workgroup; ///< Computed by the algorithm if all zero
+        std::vector<uint32_t> specializationConstants; ///< Raw 32 bit values
+    };
 
     /**
-     * Similar to base constructor but allows for further configuration to use
-     * when creating the Vulkan resources.
+     * Choice of the tuner for an algorithm and shape.
+     */
+    struct Result
+    {
+        Candidate candidate; ///< Fastest candidate
+        double medianNs = 0; ///< Median GPU time of the fastest candidate
+        bool cached = false; ///< Whether it was found in the database
+    };
+
+    /**
+     * Builds a candidate from specialization constants of any 32 bit type,
+     * which are stored as their raw values.
      *
-     * @param physicalDeviceIndex The index of the physical device to use
-     * @param familyQueueIndices (Optional) List of queue indices to add for
-     * explicit allocation
-     * @param desiredExtensions The desired extensions to load from
-     * physicalDevice
+     * @param workgroup The workgroup of the dispatch, computed by the
+     * algorithm if all zero
+     * @param specializationConstants The specialization constants, or empty
+     * to keep the ones of the algorithm
+     * @return The candidate
      */
-    Manager(uint32_t physicalDeviceIndex,
-            const std::vector<uint32_t>& familyQueueIndices = {},
-            const std::vector<std::string>& desiredExtensions = {});
+    template<typename S = float>
+    static Candidate candidate(
+      const Workgroup& workgroup,
+      const std::vector<S>& specializationConstants = {})
+    {
+        static_assert(sizeof(S) == sizeof(uint32_t),
+                      "Kompute Tuner specialization constants must be 32 "
+                      "bit values");
+
+        Candidate candidate;
+        candidate.workgroup = workgroup;
+        candidate.specializationConstants.resize(
+          specializationConstants.size());
+        memcpy(candidate.specializationConstants.data(),
+               specializationConstants.data(),
+               specializationConstants.size() * sizeof(S));
+        return candidate;
+    }
 
     /**
-     * Manager constructor which allows your own vulkan application to integrate
-     * with the kompute use.
+     * Constructor for a tuner of the device of a manager, loading the
+     * database if a path is provided.
      *
-     * @param instance Vulkan compute instance to base this application
-     * @param physicalDevice Vulkan physical device to use for application
-     * @param device Vulkan logical device to use for all base resources
-     * @param physicalDeviceIndex Index for vulkan physical device used
+     * @param manager The manager creating the sequences timing the candidates
+     * @param databasePath (Optional) File of the tuning database, loaded if it
+     * exists and written after each new choice
+     * @param warmup Number of evaluations of a candidate before the timed ones
+     * @param repetitions Number of timed evaluations of a candidate
      */
-    Manager(std::shared_ptr<vk::Instance> instance,
-            std::shared_ptr<vk::PhysicalDevice> physicalDevice,
-            std::shared_ptr<vk::Device> device);
+    Tuner(std::shared_ptr<Manager> manager,
+          const std::string& databasePath = "",
+          uint32_t warmup = 2,
+          uint32_t repetitions = 5);
 
     /**
-     * Manager destructor which would ensure all owned resources are destroyed
-     * unless explicitly stated that resources should not be destroyed or freed.
+     * Chooses the fastest candidate for the algorithm and shape, and rebuilds
+     * the algorithm with it. The choice of the database is used if there is
+     * one for the device, name and shape, otherwise each candidate is timed
+     * dispatching the algorithm with its current tensors and push constants.
+     * Candidates exceeding the limits of the device, or whose pipeline fails
+     * to build, are skipped.
+     *
+     * @param algorithm The algorithm to tune, left built with the choice
+     * @param name Name of the algorithm in the database, such as the name of
+     * its shader
+     * @param shape Shape of the input the choice is made for
+     * @param candidates The candidates to try
+     * @param retune Whether to time the candidates even if the database has a
+     * choice already
+     * @return The choice for the algorithm and shape
      */
-    ~Manager();
+    Result tune(std::shared_ptr<Algorithm> algorithm,
+                const std::string& name,
+                const std::vector<uint32_t>& shape,
+                const std::vector<Candidate>& candidates,
+                bool retune = false);
 
     /**
-     * Create a managed sequence that will be destroyed by this manager
-     * if it hasn't been destroyed by its reference count going to zero.
+     * Looks up the choice of the database for the device, name and shape.
      *
-     * @param queueIndex The queue to use from the available queues
-     * @param nrOfTimestamps The maximum number of timestamps to allocate.
-     * If zero (default), disables latching of timestamps.
-     * @returns Shared pointer with initialised sequence
+     * @param name Name of the algorithm in the database
+     * @param shape Shape of the input the choice was made for
+     * @param result The result to fill with the choice if found
+     * @return Boolean stating whether there is a choice
      */
-    std::shared_ptr<Sequence> sequence(uint32_t queueIndex = 0,
-                                       uint32_t totalTimestamps = 0);
+    bool find(const std::string& name,
+              const std::vector<uint32_t>& shape,
+              Result& result) const;
 
     /**
-     * Create a managed tensor that will be destroyed by this manager
-     * if it hasn't been destroyed by its reference count going to zero.
+     * Loads the choices of a database file, replacing the ones with the same
+     * device, name and shape. The choices of other devices are kept so they
+     * are written back when saving.
      *
-     * @param data The data to initialize the tensor with
-     * @param tensorType The type of tensor to initialize
-     * @returns Shared pointer with initialised tensor
+     * @param path The file to load, which is ignored if it does not exist
      */
-    template<typename T>
-    std::shared_ptr<TensorT<T>> tensorT(
-      const std::vector<T>& data,
-      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice)
-    {
-        KP_LOG_DEBUG("Kompute Manager tensor creation triggered");
+    void load(const std::string& path);
 
-        std::shared_ptr<TensorT<T>> tensor{ new kp::TensorT<T>(
-          this->mPhysicalDevice, this->mDevice, data, tensorType) };
+    /**
+     * Writes the choices of all devices to a database file.
+     *
+     * @param path The file to write, or the database path of the tuner if
+     * empty
+     */
+    void save(const std::string& path = "");
 
-        if (this->mManageResources) {
-            this->mManagedTensors.push_back(tensor);
-        }
+    /**
+     * Returns the number of choices of the database, of all devices.
+     *
+     * @return Number of choices
+     */
+    size_t size() const;
 
-        return tensor;
-    }
+    /**
+     * Identifier of the device in the database, made of its vendor, device
+     * and driver version, as the fastest configuration depends on all three.
+     *
+     * @return The identifier of the device of the manager
+     */
+    const std::string& deviceKey() const;
 
-    std::shared_ptr<TensorT<float>> tensor(
-      const std::vector<float>& data,
-      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice)
-    {
-        return this->tensorT<float>(data, tensorType);
-    }
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<Manager> mManager;
 
-    std::shared_ptr<Tensor> tensor(
-      void* data,
-      uint32_t elementTotalCount,
-      uint32_t elementMemorySize,
-      const Tensor::TensorDataTypes& dataType,
-      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice)
-    {
-        std::shared_ptr<Tensor> tensor{ new kp::Tensor(this->mPhysicalDevice,
-                                                       this->mDevice,
-                                                       data,
-                                                       elementTotalCount,
-                                                       elementMemorySize,
-                                                       dataType,
-                                                       tensorType) };
+    // -------------- ALWAYS OWNED RESOURCES
+    Benchmark mBenchmark;
+    std::string mDatabasePath;
+    std::string mDeviceKey;
+    std::map<std::string, Result> mEntries;
+
+    std::string key(const std::string& name,
+                    const std::vector<uint32_t>& shape) const;
+    bool isSupported(std::shared_ptr<Algorithm> algorithm) const;
+    void apply(std::shared_ptr<Algorithm> algorithm,
+               const Candidate& candidate);
+};
 
-        if (this->mManageResources) {
-            this->mManagedTensors.push_back(tensor);
-        }
+} // End namespace kp
 
-        return tensor;
-    }
+// SPDX-License-Identifier: Apache-2.0
+
+#include <map>
+
+#ifndef KOMPUTE_TENSOR_ARCHIVE_ALIGNMENT
+#define KOMPUTE_TENSOR_ARCHIVE_ALIGNMENT 256
+#endif
+
+namespace kp {
 
+/**
+ * Archive of named tensors in a single file, such as the weights of a model,
+ * which is memory mapped when opened so the data of the tensors is copied
+ * straight from the page cache into their host visible memory.
+ *
+ * The file starts with a header holding the name, data type, shape, offset
+ * and size of each entry, followed by the data of the entries, each starting
+ * at an offset aligned to KOMPUTE_TENSOR_ARCHIVE_ALIGNMENT bytes. All the
+ * values are stored in the byte order of the host.
+ */
+class TensorArchive
+{
+  public:
     /**
-     * Default non-template function that can be used to create algorithm objects
-     * which provides default types to the push and spec constants as floats.
-     *
-     * @param tensors (optional) The tensors to initialise the algorithm with
-     * @param spirv (optional) The SPIRV bytes for the algorithm to dispatch
-     * @param workgroup (optional) kp::Workgroup for algorithm to use, and
-     * defaults to (tensor[0].size(), 1, 1)
-     * @param specializationConstants (optional) float vector to use for
-     * specialization constants, and defaults to an empty constant
-     * @param pushConstants (optional) float vector to use for push constants,
-     * and defaults to an empty constant
-     * @returns Shared pointer with initialised algorithm
+     * Description of a tensor stored in the archive.
      */
-    std::shared_ptr<Algorithm> algorithm(
-      const std::vector<std::shared_ptr<Tensor>>& tensors = {},
-      const std::vector<uint32_t>& spirv = {},
-      const Workgroup& workgroup = {},
-      const std::vector<float>& specializationConstants = {},
-      const std::vector<float>& pushConstants = {})
+    struct Entry
     {
-        return this->algorithm<>(tensors, spirv, workgroup, specializationConstants, pushConstants);
-    }
+        std::string name;                 ///< Unique name of the tensor
+        Tensor::TensorDataTypes dataType; ///< Data type of the elements
+        std::vector<uint64_t> shape;      ///< Extents in row major order
+        uint64_t offset = 0;              ///< Offset in bytes of the data
+        uint64_t size = 0;                ///< Size in bytes of the data
+    };
 
     /**
-     * Create a managed algorithm that will be destroyed by this manager
-     * if it hasn't been destroyed by its reference count going to zero.
+     * Writes an archive holding the data provided. The offsets and sizes of
+     * the entries are ignored and computed from their shapes and data types.
      *
-     * @param tensors (optional) The tensors to initialise the algorithm with
-     * @param spirv (optional) The SPIRV bytes for the algorithm to dispatch
-     * @param workgroup (optional) kp::Workgroup for algorithm to use, and
-     * defaults to (tensor[0].size(), 1, 1)
-     * @param specializationConstants (optional) templatable vector parameter to use for
-     * specialization constants, and defaults to an empty constant
-     * @param pushConstants (optional) templatable vector parameter to use for push constants,
-     * and defaults to an empty constant
-     * @returns Shared pointer with initialised algorithm
+     * @param path The file to write
+     * @param entries The name, data type and shape of each tensor
+     * @param data The data of each tensor, in the order of the entries
      */
-    template<typename S = float, typename P = float>
-    std::shared_ptr<Algorithm> algorithm(
-      const std::vector<std::shared_ptr<Tensor>>& tensors,
-      const std::vector<uint32_t>& spirv,
-      const Workgroup& workgroup,
-      const std::vector<S>& specializationConstants,
-      const std::vector<P>& pushConstants)
-    {
-
-        KP_LOG_DEBUG("Kompute Manager algorithm creation triggered");
+    static void write(const std::string& path,
+                      const std::vector<Entry>& entries,
+                      const std::vector<const void*>& data);
 
-        std::shared_ptr<Algorithm> algorithm{ new kp::Algorithm(
-          this->mDevice,
-          tensors,
-          spirv,
-          workgroup,
-          specializationConstants,
-          pushConstants) };
+    /**
+     * Writes an archive holding the host data of tensors, which has to be
+     * synced with OpTensorSyncLocal first for device tensors.
+     *
+     * @param path The file to write
+     * @param names The unique name of each tensor
+     * @param tensors The tensors to store
+     * @param shapes (Optional) The shape of each tensor, a single extent of
+     * the size of the tensor when not provided
+     */
+    static void write(const std::string& path,
+                      const std::vector<std::string>& names,
+                      const std::vector<std::shared_ptr<Tensor>>& tensors,
+                      const std::vector<std::vector<uint64_t>>& shapes = {});
 
-        if (this->mManageResources) {
-            this->mManagedAlgorithms.push_back(algorithm);
-        }
+    /**
+     * Constructor which maps the file of the archive and reads its header.
+     * The data of the entries is only read from disk when it is accessed.
+     *
+     * @param path The file of the archive
+     */
+    TensorArchive(const std::string& path);
 
-        return algorithm;
-    }
+    TensorArchive(const TensorArchive&) = delete;
+    TensorArchive& operator=(const TensorArchive&) = delete;
 
     /**
-     * Destroy the GPU resources and all managed resources by manager.
-     **/
-    void destroy();
-    /**
-     * Run a pseudo-garbage collection to release all the managed resources
-     * that have been already freed due to these reaching to zero ref count.
-     **/
-    void clear();
+     * Destructor which unmaps the file of the archive.
+     */
+    ~TensorArchive();
 
     /**
-     * Information about the current device.
+     * Returns the entries of the archive, in the order they were written.
      *
-     * @return vk::PhysicalDeviceProperties containing information about the device
-     **/
-    vk::PhysicalDeviceProperties getDeviceProperties() const;
+     * @return The entries of the archive
+     */
+    const std::vector<Entry>& entries() const;
 
     /**
-     * List the devices available in the current vulkan instance.
+     * Looks up the entry of a tensor by name.
      *
-     * @return vector of physical devices containing their respective properties
-     **/
-    std::vector<vk::PhysicalDevice> listDevices() const;
+     * @param name The name of the tensor
+     * @param entry The entry to fill if found
+     * @return Boolean stating whether the archive holds the tensor
+     */
+    bool find(const std::string& name, Entry& entry) const;
 
-  private:
-    // -------------- OPTIONALLY OWNED RESOURCES
-    std::shared_ptr<vk::Instance> mInstance = nullptr;
-    bool mFreeInstance = false;
-    std::shared_ptr<vk::PhysicalDevice> mPhysicalDevice = nullptr;
-    std::shared_ptr<vk::Device> mDevice = nullptr;
-    bool mFreeDevice = false;
+    /**
+     * Returns the mapped data of an entry, which remains valid until the
+     * archive is closed.
+     *
+     * @param entry An entry of the archive
+     * @return Pointer to the data of the entry
+     */
+    const void* data(const Entry& entry) const;
 
-    // -------------- ALWAYS OWNED RESOURCES
-    std::vector<std::weak_ptr<Tensor>> mManagedTensors;
-    std::vector<std::weak_ptr<Sequence>> mManagedSequences;
-    std::vector<std::weak_ptr<Algorithm>> mManagedAlgorithms;
+    /**
+     * Creates a tensor of the manager for each entry, or for the entries
+     * named, copying their data from the mapped file into the host visible
+     * memory of the tensors sub-allocated from the memory pool of the
+     * manager. Device tensors are then uploaded together by a single
+     * OpTensorSyncDevice, so the data is copied once on the host and
+     * transferred in one submission.
+     *
+     * @param manager The manager creating the tensors
+     * @param tensorType The type of the tensors, eDevice or eHost
+     * @param hostMemoryType The type of host visible memory of the tensors
+     * @param names (Optional) The names of the tensors to load, all the
+     * entries when empty
+     * @return The tensors created, by name
+     */
+    std::map<std::string, std::shared_ptr<Tensor>> load(
+      std::shared_ptr<Manager> manager,
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice,
+      Tensor::HostMemoryTypes hostMemoryType =
+        Tensor::HostMemoryTypes::eCoherent,
+      const std::vector<std::string>& names = {}) const;
 
-    std::vector<uint32_t> mComputeQueueFamilyIndices;
-    std::vector<std::shared_ptr<vk::Queue>> mComputeQueues;
+    /**
+     * Unmaps the file of the archive. Pointers returned by data are no longer
+     * valid, while tensors loaded from the archive are not affected.
+     */
+    void close();
 
-    bool mManageResources = false;
+    /**
+     * Returns true while the file of the archive is mapped.
+     *
+     * @return Boolean stating whether the archive is open
+     */
+    bool isOpen() const;
 
-#if DEBUG
-#ifndef KOMPUTE_DISABLE_VK_DEBUG_LAYERS
-    vk::DebugReportCallbackEXT mDebugReportCallback;
-    vk::DispatchLoaderDynamic mDebugDispatcher;
-#endif
+  private:
+    // -------------- ALWAYS OWNED RESOURCES
+    std::string mPath;
+    const uint8_t* mMapping = nullptr;
+    uint64_t mMappingSize = 0;
+#if defined(_WIN32)
+    void* mFileHandle = nullptr;
+    void* mMappingHandle = nullptr;
 #endif
+    std::vector<Entry> mEntries;
+    std::map<std::string, size_t> mEntryIndices;
 
-    // Create functions
-    void createInstance();
-    void createDevice(const std::vector<uint32_t>& familyQueueIndices = {},
-                      uint32_t hysicalDeviceIndex = 0,
-                      const std::vector<std::string>& desiredExtensions = {});
+    void map(const std::string& path);
+    void readHeader();
 };
 
 } // End namespace kp
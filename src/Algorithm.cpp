@@ -1,5 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 #include <fstream>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "kompute/Algorithm.hpp"
 
@@ -15,13 +17,36 @@ Algorithm::~Algorithm()
 bool
 Algorithm::isInit()
 {
+    this->awaitBuild();
+
+    return this->hasResources();
+}
+
+bool
+Algorithm::hasResources()
+{
+    // Algorithms passing device addresses allocate no descriptor set
+    bool descriptors =
+      this->mBindingMode == BindingModes::eDeviceAddresses ||
+      (this->mDescriptorPool && this->mDescriptorSet);
     return this->mPipeline && this->mPipelineCache && this->mPipelineLayout &&
-           this->mDescriptorPool && this->mDescriptorSet &&
-           this->mDescriptorSetLayout && this->mShaderModule;
+           descriptors && this->mDescriptorSetLayout && this->mShaderModule;
 }
 
 void
 Algorithm::destroy()
+{
+    // Exceptions of the build are discarded as its resources are destroyed
+    if (this->mBuild.valid()) {
+        this->mBuild.wait();
+        this->mBuild = std::shared_future<void>();
+    }
+
+    this->destroyResources();
+}
+
+void
+Algorithm::destroyResources()
 {
     // We don't have to free memory on destroy as it's freed by the commandBuffer destructor
     // if (this->mPushConstantsData) {
@@ -45,7 +70,7 @@ Algorithm::destroy()
         }
         this->mDevice->destroy(
           *this->mPipeline,
-          (vk::Optional<const vk::AllocationCallbacks>)nullptr);
+          HostAllocator::callbacks(this->mHostAllocator));
         this->mPipeline = nullptr;
     }
 
@@ -57,7 +82,7 @@ Algorithm::destroy()
         }
         this->mDevice->destroy(
           *this->mPipelineCache,
-          (vk::Optional<const vk::AllocationCallbacks>)nullptr);
+          HostAllocator::callbacks(this->mHostAllocator));
         this->mPipelineCache = nullptr;
     }
 
@@ -69,7 +94,7 @@ Algorithm::destroy()
         }
         this->mDevice->destroy(
           *this->mPipelineLayout,
-          (vk::Optional<const vk::AllocationCallbacks>)nullptr);
+          HostAllocator::callbacks(this->mHostAllocator));
         this->mPipelineLayout = nullptr;
     }
 
@@ -81,10 +106,20 @@ Algorithm::destroy()
         }
         this->mDevice->destroy(
           *this->mShaderModule,
-          (vk::Optional<const vk::AllocationCallbacks>)nullptr);
+          HostAllocator::callbacks(this->mHostAllocator));
         this->mShaderModule = nullptr;
     }
 
+    // Descriptor sets of the shared allocator are returned to their pool
+    if (this->mDescriptorAllocator && this->mFreeDescriptorSet &&
+        this->mDescriptorSet) {
+        KP_LOG_DEBUG("Kompute Algorithm Freeing Descriptor Set to allocator");
+        this->mDescriptorAllocator->free(
+          { *this->mDescriptorPool, *this->mDescriptorSet });
+        this->mDescriptorSet = nullptr;
+        this->mDescriptorPool = nullptr;
+    }
+
     // We don't call freeDescriptorSet as the descriptor pool is not created
     // with VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT more at
     // (https://www.khronos.org/registry/vulkan/specs/1.0/html/vkspec.html#VUID-vkFreeDescriptorSets-descriptorPool-00312))
@@ -107,7 +142,7 @@ Algorithm::destroy()
         }
         this->mDevice->destroy(
           *this->mDescriptorSetLayout,
-          (vk::Optional<const vk::AllocationCallbacks>)nullptr);
+          HostAllocator::callbacks(this->mHostAllocator));
         this->mDescriptorSetLayout = nullptr;
     }
 
@@ -119,9 +154,26 @@ Algorithm::destroy()
         }
         this->mDevice->destroy(
           *this->mDescriptorPool,
-          (vk::Optional<const vk::AllocationCallbacks>)nullptr);
+          HostAllocator::callbacks(this->mHostAllocator));
         this->mDescriptorPool = nullptr;
     }
+
+    // Resources shared through the shader cache are only released, so the
+    // cache can destroy them once no algorithm uses them
+    if (this->mShaderCache) {
+        if (!this->mFreePipeline) {
+            this->mPipeline = nullptr;
+        }
+        if (!this->mFreePipelineLayout) {
+            this->mPipelineLayout = nullptr;
+        }
+        if (!this->mFreeShaderModule) {
+            this->mShaderModule = nullptr;
+        }
+        if (!this->mFreeDescriptorSetLayout) {
+            this->mDescriptorSetLayout = nullptr;
+        }
+    }
 }
 
 void
@@ -129,12 +181,68 @@ Algorithm::createParameters()
 {
     KP_LOG_DEBUG("Kompute Algorithm createParameters started");
 
-    std::vector<vk::DescriptorPoolSize> descriptorPoolSizes = {
-        vk::DescriptorPoolSize(
+    if (this->mBindingMode == BindingModes::eDeviceAddresses) {
+        this->updateDescriptors();
+        return;
+    }
+
+    // Uniform tensors are bound as uniform buffers, image tensors as
+    // storage images and the rest as storage buffers
+    uint32_t uniformTensorCount = 0;
+    uint32_t imageTensorCount = 0;
+    for (const std::shared_ptr<Tensor>& tensor : this->mTensors) {
+        if (tensor->descriptorType() == vk::DescriptorType::eUniformBuffer) {
+            uniformTensorCount++;
+        } else if (tensor->descriptorType() ==
+                   vk::DescriptorType::eStorageImage) {
+            imageTensorCount++;
+        }
+    }
+    uint32_t storageTensorCount = static_cast<uint32_t>(
+      this->mTensors.size() - uniformTensorCount - imageTensorCount);
+
+    if (this->mDescriptorAllocator) {
+        KP_LOG_DEBUG("Kompute Algorithm allocating descriptor set from "
+                     "shared allocator");
+        DescriptorAllocator::Allocation allocation =
+          this->mDescriptorAllocator->allocate(
+            *this->mDescriptorSetLayout,
+            storageTensorCount,
+            uniformTensorCount,
+            imageTensorCount);
+        this->mDescriptorPool =
+          std::make_shared<vk::DescriptorPool>(allocation.pool);
+        this->mFreeDescriptorPool = false;
+        this->mDescriptorSet =
+          std::make_shared<vk::DescriptorSet>(allocation.set);
+        this->mFreeDescriptorSet = true;
+        if (this->mMetrics) {
+            this->mMetrics->add(Metrics::Counter::eDescriptorSetsAllocated);
+        }
+
+        this->updateDescriptors();
+        return;
+    }
+
+    std::vector<vk::DescriptorPoolSize> descriptorPoolSizes;
+    if (storageTensorCount > 0) {
+        descriptorPoolSizes.push_back(vk::DescriptorPoolSize(
           vk::DescriptorType::eStorageBuffer,
-          static_cast<uint32_t>(this->mTensors.size()) // Descriptor count
-          )
-    };
+          storageTensorCount // Descriptor count
+          ));
+    }
+    if (uniformTensorCount > 0) {
+        descriptorPoolSizes.push_back(vk::DescriptorPoolSize(
+          vk::DescriptorType::eUniformBuffer,
+          uniformTensorCount // Descriptor count
+          ));
+    }
+    if (imageTensorCount > 0) {
+        descriptorPoolSizes.push_back(vk::DescriptorPoolSize(
+          vk::DescriptorType::eStorageImage,
+          imageTensorCount // Descriptor count
+          ));
+    }
 
     vk::DescriptorPoolCreateInfo descriptorPoolInfo(
       vk::DescriptorPoolCreateFlags(),
@@ -145,14 +253,42 @@ Algorithm::createParameters()
     KP_LOG_DEBUG("Kompute Algorithm creating descriptor pool");
     this->mDescriptorPool = std::make_shared<vk::DescriptorPool>();
     this->mDevice->createDescriptorPool(
-      &descriptorPoolInfo, nullptr, this->mDescriptorPool.get());
+      &descriptorPoolInfo,
+      HostAllocator::callbacks(this->mHostAllocator),
+      this->mDescriptorPool.get());
     this->mFreeDescriptorPool = true;
 
+    vk::DescriptorSetAllocateInfo descriptorSetAllocateInfo(
+      *this->mDescriptorPool,
+      1, // Descriptor set layout count
+      this->mDescriptorSetLayout.get());
+
+    KP_LOG_DEBUG("Kompute Algorithm allocating descriptor sets");
+    this->mDescriptorSet = std::make_shared<vk::DescriptorSet>();
+    this->mDevice->allocateDescriptorSets(&descriptorSetAllocateInfo,
+                                          this->mDescriptorSet.get());
+    this->mFreeDescriptorSet = true;
+    if (this->mMetrics) {
+        this->mMetrics->add(Metrics::Counter::eDescriptorSetsAllocated);
+    }
+
+    this->updateDescriptors();
+
+    KP_LOG_DEBUG("Kompue Algorithm successfully run init");
+}
+
+void
+Algorithm::createDescriptorSetLayout()
+{
+    // The layout is left empty when the tensors are passed by address
+    size_t bindingCount = this->mBindingMode == BindingModes::eDescriptors
+                            ? this->mTensors.size()
+                            : 0;
     std::vector<vk::DescriptorSetLayoutBinding> descriptorSetBindings;
-    for (size_t i = 0; i < this->mTensors.size(); i++) {
+    for (size_t i = 0; i < bindingCount; i++) {
         descriptorSetBindings.push_back(
           vk::DescriptorSetLayoutBinding(i, // Binding index
-                                         vk::DescriptorType::eStorageBuffer,
+                                         this->mTensors[i]->descriptorType(),
                                          1, // Descriptor count
                                          vk::ShaderStageFlagBits::eCompute));
     }
@@ -166,41 +302,132 @@ Algorithm::createParameters()
     KP_LOG_DEBUG("Kompute Algorithm creating descriptor set layout");
     this->mDescriptorSetLayout = std::make_shared<vk::DescriptorSetLayout>();
     this->mDevice->createDescriptorSetLayout(
-      &descriptorSetLayoutInfo, nullptr, this->mDescriptorSetLayout.get());
+      &descriptorSetLayoutInfo,
+      HostAllocator::callbacks(this->mHostAllocator),
+      this->mDescriptorSetLayout.get());
     this->mFreeDescriptorSetLayout = true;
+}
 
-    vk::DescriptorSetAllocateInfo descriptorSetAllocateInfo(
-      *this->mDescriptorPool,
-      1, // Descriptor set layout count
-      this->mDescriptorSetLayout.get());
+void
+Algorithm::createPipelineResources()
+{
+    uint32_t pushConstantsSize =
+      this->pushConstantsOffset() +
+      this->mPushConstantsDataTypeMemorySize * this->mPushConstantsSize;
+    // The push constants alone were checked by rebuild, but the tensor
+    // addresses ahead of them can take them past the limit of the device
+    if (pushConstantsSize > this->mMaxPushConstantsSize) {
+        throw std::runtime_error(
+          fmt::format("Kompute Algorithm addresses of {} tensors and push "
+                      "constants take {} bytes, more than the maximum of {}, "
+                      "pass the addresses through a tensor instead",
+                      this->mTensors.size(),
+                      pushConstantsSize,
+                      this->mMaxPushConstantsSize));
+    }
 
-    KP_LOG_DEBUG("Kompute Algorithm allocating descriptor sets");
-    this->mDescriptorSet = std::make_shared<vk::DescriptorSet>();
-    this->mDevice->allocateDescriptorSets(&descriptorSetAllocateInfo,
-                                          this->mDescriptorSet.get());
-    this->mFreeDescriptorSet = true;
+    if (!this->mShaderCache) {
+        this->createDescriptorSetLayout();
+        this->createShaderModule();
+        this->createPipeline();
+        return;
+    }
 
-    KP_LOG_DEBUG("Kompute Algorithm updating descriptor sets");
-    for (size_t i = 0; i < this->mTensors.size(); i++) {
-        std::vector<vk::WriteDescriptorSet> computeWriteDescriptorSets;
+    std::vector<vk::DescriptorType> descriptorTypes;
+    if (this->mBindingMode == BindingModes::eDescriptors) {
+        for (const std::shared_ptr<Tensor>& tensor : this->mTensors) {
+            descriptorTypes.push_back(tensor->descriptorType());
+        }
+    }
 
-        vk::DescriptorBufferInfo descriptorBufferInfo =
-          this->mTensors[i]->constructDescriptorBufferInfo();
+    std::string key = ShaderCache::key(
+      this->mSpirv,
+      this->mSpecializationConstantsData,
+      this->mSpecializationConstantsDataTypeMemorySize,
+      this->mSpecializationConstantsSize,
+      pushConstantsSize,
+      descriptorTypes,
+      this->mLocalSizeX);
+
+    ShaderCache::Entry entry;
+    if (!this->mShaderCache->find(key, entry)) {
+        KP_LOG_DEBUG("Kompute Algorithm pipeline not cached, creating it");
+
+        this->createDescriptorSetLayout();
+        this->createShaderModule();
+        this->createPipeline();
+
+        entry.shaderModule = this->mShaderModule;
+        entry.descriptorSetLayout = this->mDescriptorSetLayout;
+        entry.pipelineLayout = this->mPipelineLayout;
+        entry.pipeline = this->mPipeline;
+        this->mShaderCache->insert(key, entry);
+    } else if (this->mMetrics) {
+        this->mMetrics->add(Metrics::Counter::ePipelineCacheHits);
+    }
 
-        computeWriteDescriptorSets.push_back(
-          vk::WriteDescriptorSet(*this->mDescriptorSet,
-                                 i, // Destination binding
-                                 0, // Destination array element
-                                 1, // Descriptor count
-                                 vk::DescriptorType::eStorageBuffer,
-                                 nullptr, // Descriptor image info
-                                 &descriptorBufferInfo));
+    // The resources are owned by the cache from now on
+    this->mShaderModule = entry.shaderModule;
+    this->mFreeShaderModule = false;
+    this->mDescriptorSetLayout = entry.descriptorSetLayout;
+    this->mFreeDescriptorSetLayout = false;
+    this->mPipelineLayout = entry.pipelineLayout;
+    this->mFreePipelineLayout = false;
+    this->mPipeline = entry.pipeline;
+    this->mFreePipeline = false;
+}
 
-        this->mDevice->updateDescriptorSets(computeWriteDescriptorSets,
-                                            nullptr);
+void
+Algorithm::updateDescriptors()
+{
+    KP_LOG_ALGORITHM("Kompute Algorithm updating descriptor sets");
+
+    // The addresses are pushed with the push constants when binding instead
+    if (this->mBindingMode == BindingModes::eDeviceAddresses) {
+        this->mTensorGenerations.resize(this->mTensors.size());
+        this->mTensorAddresses.resize(this->mTensors.size());
+        for (size_t i = 0; i < this->mTensors.size(); i++) {
+            this->mTensorGenerations[i] = this->mTensors[i]->generation();
+            this->mTensorAddresses[i] = this->mTensors[i]->deviceAddress();
+        }
+        return;
     }
 
-    KP_LOG_DEBUG("Kompue Algorithm successfully run init");
+    // The buffer and image infos are constructed first so the writes can
+    // point to them, with one of the two left unused for each tensor
+    std::vector<vk::DescriptorBufferInfo> descriptorBufferInfos(
+      this->mTensors.size());
+    std::vector<vk::DescriptorImageInfo> descriptorImageInfos(
+      this->mTensors.size());
+    this->mTensorGenerations.resize(this->mTensors.size());
+    for (size_t i = 0; i < this->mTensors.size(); i++) {
+        this->mTensorGenerations[i] = this->mTensors[i]->generation();
+        if (this->mTensors[i]->descriptorType() ==
+            vk::DescriptorType::eStorageImage) {
+            descriptorImageInfos[i] =
+              this->mTensors[i]->constructDescriptorImageInfo();
+        } else {
+            descriptorBufferInfos[i] =
+              this->mTensors[i]->constructDescriptorBufferInfo();
+        }
+    }
+
+    std::vector<vk::WriteDescriptorSet> computeWriteDescriptorSets;
+    for (size_t i = 0; i < this->mTensors.size(); i++) {
+        bool image = this->mTensors[i]->descriptorType() ==
+                     vk::DescriptorType::eStorageImage;
+        computeWriteDescriptorSets.push_back(vk::WriteDescriptorSet(
+          *this->mDescriptorSet,
+          i, // Destination binding
+          0, // Destination array element
+          1, // Descriptor count
+          this->mTensors[i]->descriptorType(),
+          image ? &descriptorImageInfos[i] : nullptr,
+          image ? nullptr : &descriptorBufferInfos[i]));
+    }
+
+    // All the bindings are written with a single update
+    this->mDevice->updateDescriptorSets(computeWriteDescriptorSets, nullptr);
 }
 
 void
@@ -218,7 +445,9 @@ Algorithm::createShaderModule()
     this->mFreeShaderModule = true;
     this->mShaderModule = std::make_shared<vk::ShaderModule>();
     this->mDevice->createShaderModule(
-      &shaderModuleInfo, nullptr, this->mShaderModule.get());
+      &shaderModuleInfo,
+      HostAllocator::callbacks(this->mHostAllocator),
+      this->mShaderModule.get());
     this->mFreeShaderModule = true;
 
     KP_LOG_DEBUG("Kompute Algorithm create shader module success");
@@ -234,11 +463,14 @@ Algorithm::createPipeline()
       1, // Set layout count
       this->mDescriptorSetLayout.get());
 
+    uint32_t pushConstantsSize =
+      this->pushConstantsOffset() +
+      this->mPushConstantsDataTypeMemorySize * this->mPushConstantsSize;
     vk::PushConstantRange pushConstantRange;
-    if (this->mPushConstantsSize) {
+    if (pushConstantsSize) {
         pushConstantRange.setStageFlags(vk::ShaderStageFlagBits::eCompute);
         pushConstantRange.setOffset(0);
-        pushConstantRange.setSize(this->mPushConstantsDataTypeMemorySize * this->mPushConstantsSize);
+        pushConstantRange.setSize(pushConstantsSize);
 
         pipelineLayoutInfo.setPushConstantRangeCount(1);
         pipelineLayoutInfo.setPPushConstantRanges(&pushConstantRange);
@@ -246,7 +478,9 @@ Algorithm::createPipeline()
 
     this->mPipelineLayout = std::make_shared<vk::PipelineLayout>();
     this->mDevice->createPipelineLayout(
-      &pipelineLayoutInfo, nullptr, this->mPipelineLayout.get());
+      &pipelineLayoutInfo,
+      HostAllocator::callbacks(this->mHostAllocator),
+      this->mPipelineLayout.get());
     this->mFreePipelineLayout = true;
 
     std::vector<vk::SpecializationMapEntry> specializationEntries;
@@ -260,13 +494,34 @@ Algorithm::createPipeline()
         specializationEntries.push_back(specializationEntry);
     }
 
-    // This passes ownership of the memory so we remove ownership from
-    // specialization container by using "transferDataOwnership"
+    uint32_t specializationConstantsMemorySize =
+      this->mSpecializationConstantsDataTypeMemorySize *
+      this->mSpecializationConstantsSize;
+    std::vector<uint8_t> specializationData(
+      specializationConstantsMemorySize + sizeof(uint32_t));
+    if (specializationConstantsMemorySize) {
+        memcpy(specializationData.data(),
+               this->mSpecializationConstantsData,
+               specializationConstantsMemorySize);
+    }
+
+    // The local size follows the specialization constants of the user
+    if (this->mLocalSizeX) {
+        specializationEntries.push_back(
+          vk::SpecializationMapEntry(this->mLocalSizeXSpecializationId,
+                                     specializationConstantsMemorySize,
+                                     sizeof(uint32_t)));
+        memcpy(specializationData.data() + specializationConstantsMemorySize,
+               &this->mLocalSizeX,
+               sizeof(uint32_t));
+    }
+
     vk::SpecializationInfo specializationInfo(
       static_cast<uint32_t>(specializationEntries.size()),
       specializationEntries.data(),
-      this->mSpecializationConstantsDataTypeMemorySize * this->mSpecializationConstantsSize,
-      this->mSpecializationConstantsData);
+      specializationConstantsMemorySize +
+        (this->mLocalSizeX ? sizeof(uint32_t) : 0),
+      specializationData.data());
 
     vk::PipelineShaderStageCreateInfo shaderStage(
       vk::PipelineShaderStageCreateFlags(),
@@ -281,16 +536,24 @@ Algorithm::createPipeline()
                                                vk::Pipeline(),
                                                0);
 
-    vk::PipelineCacheCreateInfo pipelineCacheInfo =
-      vk::PipelineCacheCreateInfo();
-    this->mPipelineCache = std::make_shared<vk::PipelineCache>();
-    this->mDevice->createPipelineCache(
-      &pipelineCacheInfo, nullptr, this->mPipelineCache.get());
-    this->mFreePipelineCache = true;
+    // A pipeline cache provided on construction is kept through rebuilds
+    if (!this->mPipelineCache) {
+        vk::PipelineCacheCreateInfo pipelineCacheInfo =
+          vk::PipelineCacheCreateInfo();
+        this->mPipelineCache = std::make_shared<vk::PipelineCache>();
+        this->mDevice->createPipelineCache(
+          &pipelineCacheInfo,
+          HostAllocator::callbacks(this->mHostAllocator),
+          this->mPipelineCache.get());
+        this->mFreePipelineCache = true;
+    }
 
 #ifdef KOMPUTE_CREATE_PIPELINE_RESULT_VALUE
     vk::ResultValue<vk::Pipeline> pipelineResult =
-      this->mDevice->createComputePipeline(*this->mPipelineCache, pipelineInfo);
+      this->mDevice->createComputePipeline(*this->mPipelineCache,
+                                           pipelineInfo,
+                                           HostAllocator::callbacks(
+                                             this->mHostAllocator));
 
     if (pipelineResult.result != vk::Result::eSuccess) {
         throw std::runtime_error("Failed to create pipeline result: " +
@@ -302,11 +565,18 @@ Algorithm::createPipeline()
     this->mFreePipeline = true;
 #else
     vk::Pipeline pipeline =
-      this->mDevice->createComputePipeline(*this->mPipelineCache, pipelineInfo);
+      this->mDevice->createComputePipeline(*this->mPipelineCache,
+                                           pipelineInfo,
+                                           HostAllocator::callbacks(
+                                             this->mHostAllocator));
     this->mPipeline = std::make_shared<vk::Pipeline>(pipeline);
     this->mFreePipeline = true;
 #endif
 
+    if (this->mMetrics) {
+        this->mMetrics->add(Metrics::Counter::ePipelinesCreated);
+    }
+
     // TODO: Update to consistent
     // this->mPipeline = std::make_shared<vk::Pipeline>();
     // this->mDevice->createComputePipelines(
@@ -319,12 +589,38 @@ Algorithm::createPipeline()
 void
 Algorithm::recordBindCore(const vk::CommandBuffer& commandBuffer)
 {
-    KP_LOG_DEBUG("Kompute Algorithm binding pipeline");
+    this->awaitBuild();
+
+    // Tensors rebuilt within their capacity keep their buffers but not their
+    // size, so only the descriptors need to be written again. The set is
+    // updated in place, which sequences that recorded the algorithm before
+    // pick up as they record again once they find the tensors rebuilt
+    for (size_t i = 0; i < this->mTensors.size(); i++) {
+        if (this->mTensors[i]->generation() != this->mTensorGenerations[i]) {
+            this->updateDescriptors();
+            break;
+        }
+    }
+
+    KP_LOG_ALGORITHM("Kompute Algorithm binding pipeline");
 
     commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute,
                                *this->mPipeline);
 
-    KP_LOG_DEBUG("Kompute Algorithm binding descriptor sets");
+    if (this->mBindingMode == BindingModes::eDeviceAddresses) {
+        KP_LOG_ALGORITHM("Kompute Algorithm pushing tensor addresses");
+
+        if (this->pushConstantsOffset()) {
+            commandBuffer.pushConstants(*this->mPipelineLayout,
+                                        vk::ShaderStageFlagBits::eCompute,
+                                        0,
+                                        this->pushConstantsOffset(),
+                                        this->mTensorAddresses.data());
+        }
+        return;
+    }
+
+    KP_LOG_ALGORITHM("Kompute Algorithm binding descriptor sets");
 
     commandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eCompute,
                                      *this->mPipelineLayout,
@@ -337,32 +633,170 @@ Algorithm::recordBindCore(const vk::CommandBuffer& commandBuffer)
 void
 Algorithm::recordBindPush(const vk::CommandBuffer& commandBuffer)
 {
+    this->awaitBuild();
+
     if (this->mPushConstantsSize) {
-        KP_LOG_DEBUG("Kompute Algorithm binding push constants memory size: {}",
-                     this->mPushConstantsSize * this->mPushConstantsDataTypeMemorySize);
+        KP_LOG_ALGORITHM(
+          "Kompute Algorithm binding push constants memory size: {}",
+          this->mPushConstantsSize * this->mPushConstantsDataTypeMemorySize);
 
         commandBuffer.pushConstants(*this->mPipelineLayout,
                                     vk::ShaderStageFlagBits::eCompute,
-                                    0,
+                                    this->pushConstantsOffset(),
                                     this->mPushConstantsSize * this->mPushConstantsDataTypeMemorySize,
                                     this->mPushConstantsData);
     }
 }
 
+void
+Algorithm::recordPushConstants(const vk::CommandBuffer& commandBuffer,
+                               const void* data,
+                               uint32_t size)
+{
+    this->awaitBuild();
+
+    uint32_t expectedSize =
+      this->mPushConstantsSize * this->mPushConstantsDataTypeMemorySize;
+    if (size != expectedSize) {
+        throw std::runtime_error(
+          fmt::format("Kompute Algorithm push constant total memory size "
+                      "provided is {} but expected {} bytes",
+                      size,
+                      expectedSize));
+    }
+
+    if (size) {
+        commandBuffer.pushConstants(*this->mPipelineLayout,
+                                    vk::ShaderStageFlagBits::eCompute,
+                                    this->pushConstantsOffset(),
+                                    size,
+                                    data);
+    }
+}
+
 void
 Algorithm::recordDispatch(const vk::CommandBuffer& commandBuffer)
 {
-    KP_LOG_DEBUG("Kompute Algorithm recording dispatch");
+    this->awaitBuild();
+
+    KP_LOG_ALGORITHM("Kompute Algorithm recording dispatch");
 
     commandBuffer.dispatch(
       this->mWorkgroup[0], this->mWorkgroup[1], this->mWorkgroup[2]);
 }
 
+void
+Algorithm::recordDispatch(const vk::CommandBuffer& commandBuffer,
+                          const Workgroup& workgroup)
+{
+    this->awaitBuild();
+
+    KP_LOG_ALGORITHM(
+      "Kompute Algorithm recording dispatch of {}x{}x{} workgroups",
+      workgroup[0],
+      workgroup[1],
+      workgroup[2]);
+
+    commandBuffer.dispatch(workgroup[0], workgroup[1], workgroup[2]);
+}
+
+void
+Algorithm::recordDispatchIndirect(const vk::CommandBuffer& commandBuffer,
+                                  std::shared_ptr<Tensor> tensor,
+                                  vk::DeviceSize offset)
+{
+    this->awaitBuild();
+
+    KP_LOG_ALGORITHM("Kompute Algorithm recording indirect dispatch");
+
+    vk::DescriptorBufferInfo bufferInfo =
+      tensor->constructDescriptorBufferInfo();
+    commandBuffer.dispatchIndirect(bufferInfo.buffer,
+                                   bufferInfo.offset + offset);
+}
+
 void
 Algorithm::setWorkgroup(const Workgroup& workgroup, uint32_t minSize)
+{
+    this->awaitBuild();
+    this->updateWorkgroup(workgroup, minSize);
+}
+
+void
+Algorithm::updateLocalSize()
+{
+    this->mLocalSizeX = 0;
+
+    // SPIR-V opcodes, decorations and built-ins of the workgroup size
+    const uint32_t opSpecConstant = 50;
+    const uint32_t opSpecConstantComposite = 51;
+    const uint32_t opDecorate = 71;
+    const uint32_t decorationSpecId = 1;
+    const uint32_t decorationBuiltIn = 11;
+    const uint32_t builtInWorkgroupSize = 25;
+
+    // The local_size_x_id of the shader is the specialization constant
+    // making up the x value of the WorkgroupSize built-in
+    std::unordered_map<uint32_t, uint32_t> specializationIds;
+    std::unordered_map<uint32_t, uint32_t> compositeXIds;
+    std::unordered_set<uint32_t> specializationConstantIds;
+    uint32_t workgroupSizeId = 0;
+
+    const std::vector<uint32_t>& spirv = this->mSpirv;
+    for (size_t i = 5; i < spirv.size();) {
+        uint32_t wordCount = spirv[i] >> 16;
+        uint32_t opcode = spirv[i] & 0xffff;
+        if (!wordCount || i + wordCount > spirv.size()) {
+            KP_LOG_WARN("Kompute Algorithm invalid spirv instruction at word "
+                        "{}, not specializing the local size",
+                        i);
+            return;
+        }
+
+        if (opcode == opDecorate && wordCount >= 4) {
+            if (spirv[i + 2] == decorationSpecId) {
+                specializationIds[spirv[i + 1]] = spirv[i + 3];
+            } else if (spirv[i + 2] == decorationBuiltIn &&
+                       spirv[i + 3] == builtInWorkgroupSize) {
+                workgroupSizeId = spirv[i + 1];
+            }
+        } else if (opcode == opSpecConstant && wordCount >= 3) {
+            specializationConstantIds.insert(spirv[i + 2]);
+        } else if (opcode == opSpecConstantComposite && wordCount >= 4) {
+            compositeXIds[spirv[i + 2]] = spirv[i + 3];
+        }
+
+        i += wordCount;
+    }
+
+    auto compositeX = compositeXIds.find(workgroupSizeId);
+    if (!workgroupSizeId || compositeX == compositeXIds.end() ||
+        !specializationConstantIds.count(compositeX->second)) {
+        return;
+    }
+    auto specializationId = specializationIds.find(compositeX->second);
+    if (specializationId == specializationIds.end()) {
+        return;
+    }
+
+    // Constants provided by the user take precedence
+    if (specializationId->second < this->mSpecializationConstantsSize) {
+        return;
+    }
+
+    this->mLocalSizeXSpecializationId = specializationId->second;
+    this->mLocalSizeX = this->mDefaultLocalSize;
+
+    KP_LOG_DEBUG("Kompute Algorithm specializing local size x with id {} to {}",
+                 this->mLocalSizeXSpecializationId,
+                 this->mLocalSizeX);
+}
+
+void
+Algorithm::updateWorkgroup(const Workgroup& workgroup, uint32_t minSize)
 {
 
-    KP_LOG_INFO("Kompute OpAlgoCreate setting dispatch size");
+    KP_LOG_ALGORITHM("Kompute OpAlgoCreate setting dispatch size");
 
     // The dispatch size is set up based on either explicitly provided template
     // parameters or by default it would take the shape and size of the tensors
@@ -372,26 +806,159 @@ Algorithm::setWorkgroup(const Workgroup& workgroup, uint32_t minSize)
         this->mWorkgroup = { workgroup[0],
                              workgroup[1] > 0 ? workgroup[1] : 1,
                              workgroup[2] > 0 ? workgroup[2] : 1 };
+    } else if (this->mLocalSizeX) {
+        // The shader is expected to skip the invocations past minSize in the
+        // last workgroup
+        this->mWorkgroup = {
+            (minSize + this->mLocalSizeX - 1) / this->mLocalSizeX, 1, 1
+        };
     } else {
         this->mWorkgroup = { minSize, 1, 1 };
     }
 
-    KP_LOG_INFO("Kompute OpAlgoCreate set dispatch size X: {}, Y: {}, Z: {}",
-                this->mWorkgroup[0],
-                this->mWorkgroup[1],
-                this->mWorkgroup[2]);
+    KP_LOG_ALGORITHM(
+      "Kompute OpAlgoCreate set dispatch size X: {}, Y: {}, Z: {}",
+      this->mWorkgroup[0],
+      this->mWorkgroup[1],
+      this->mWorkgroup[2]);
 }
 
 const Workgroup&
 Algorithm::getWorkgroup()
 {
+    this->awaitBuild();
     return this->mWorkgroup;
 }
 
+uint32_t
+Algorithm::getLocalSizeX()
+{
+    this->awaitBuild();
+    return this->mLocalSizeX;
+}
+
 const std::vector<std::shared_ptr<Tensor>>&
 Algorithm::getTensors()
 {
+    this->awaitBuild();
     return this->mTensors;
 }
 
+const std::vector<uint32_t>&
+Algorithm::getSpirv()
+{
+    this->awaitBuild();
+    return this->mSpirv;
+}
+
+void
+Algorithm::setName(const std::string& name)
+{
+    this->awaitBuild();
+    this->mName = name;
+    this->setObjectNames();
+}
+
+const std::string&
+Algorithm::name()
+{
+    return this->mName;
+}
+
+Algorithm::BindingModes
+Algorithm::bindingMode()
+{
+    return this->mBindingMode;
+}
+
+uint32_t
+Algorithm::pushConstantsOffset()
+{
+    // The push constants of the algorithm follow the tensor addresses
+    if (this->mBindingMode == BindingModes::eDeviceAddresses) {
+        return static_cast<uint32_t>(this->mTensors.size() *
+                                     sizeof(vk::DeviceAddress));
+    }
+    return 0;
+}
+
+void
+Algorithm::setObjectNames()
+{
+    if (!this->mDebugUtils || !this->mDevice) {
+        return;
+    }
+
+    if (this->mPipeline) {
+        this->mDebugUtils->setObjectName(*this->mDevice,
+                                         vk::ObjectType::ePipeline,
+                                         (uint64_t)(VkPipeline)*this->mPipeline,
+                                         this->mName);
+    }
+    if (this->mPipelineLayout) {
+        this->mDebugUtils->setObjectName(
+          *this->mDevice,
+          vk::ObjectType::ePipelineLayout,
+          (uint64_t)(VkPipelineLayout)*this->mPipelineLayout,
+          this->mName);
+    }
+    if (this->mDescriptorSet) {
+        this->mDebugUtils->setObjectName(
+          *this->mDevice,
+          vk::ObjectType::eDescriptorSet,
+          (uint64_t)(VkDescriptorSet)*this->mDescriptorSet,
+          this->mName);
+    }
+}
+
+void
+Algorithm::setTensors(const std::vector<std::shared_ptr<Tensor>>& tensors)
+{
+    KP_LOG_DEBUG("Kompute Algorithm setting {} tensors", tensors.size());
+
+    this->awaitBuild();
+
+    if (!this->hasResources()) {
+        throw std::runtime_error(
+          "Kompute Algorithm setTensors called before it is initialised");
+    }
+
+    if (tensors.size() != this->mTensors.size()) {
+        throw std::runtime_error(
+          fmt::format("Kompute Algorithm setTensors provided {} tensors but "
+                      "the algorithm has {} bindings",
+                      tensors.size(),
+                      this->mTensors.size()));
+    }
+
+    for (size_t i = 0; i < tensors.size(); i++) {
+        if (!tensors[i] || !tensors[i]->isInit()) {
+            throw std::runtime_error(fmt::format(
+              "Kompute Algorithm setTensors tensor {} is not initialised", i));
+        }
+        if (tensors[i]->descriptorType() !=
+            this->mTensors[i]->descriptorType()) {
+            throw std::runtime_error(
+              fmt::format("Kompute Algorithm setTensors tensor {} has "
+                          "descriptor type {} but binding expects {}",
+                          i,
+                          vk::to_string(tensors[i]->descriptorType()),
+                          vk::to_string(this->mTensors[i]->descriptorType())));
+        }
+    }
+
+    this->mTensors = tensors;
+    this->updateDescriptors();
+}
+
+void
+Algorithm::awaitBuild()
+{
+    // A failed build keeps its future so every use rethrows its exception
+    if (this->mBuild.valid()) {
+        this->mBuild.get();
+        this->mBuild = std::shared_future<void>();
+    }
+}
+
 }
@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "kompute/Benchmark.hpp"
+#include "kompute/operations/OpTensorCopy.hpp"
+
+namespace kp {
+
+Benchmark::Benchmark(std::shared_ptr<Manager> manager,
+                     uint32_t warmup,
+                     uint32_t repetitions)
+{
+    KP_LOG_DEBUG("Kompute Benchmark constructor with {} warmup and {} "
+                 "repetitions",
+                 warmup,
+                 repetitions);
+
+    if (!manager) {
+        throw std::runtime_error("Kompute Benchmark manager is null");
+    }
+    if (repetitions < 1) {
+        throw std::runtime_error(
+          "Kompute Benchmark requires at least one repetition");
+    }
+
+    this->mManager = manager;
+    this->mWarmup = warmup;
+    this->mRepetitions = repetitions;
+}
+
+Benchmark::Result
+Benchmark::run(std::shared_ptr<Sequence> sequence,
+               double flops,
+               double bytes,
+               const std::string& label)
+{
+    KP_LOG_DEBUG("Kompute Benchmark running sequence for label '{}'", label);
+
+    if (!sequence) {
+        throw std::runtime_error("Kompute Benchmark sequence is null");
+    }
+    if (sequence->timedOperationCount() < sequence->operations().size()) {
+        throw std::runtime_error(fmt::format(
+          "Kompute Benchmark run requires a timestamp for each of the {} "
+          "operations of the sequence",
+          sequence->operations().size()));
+    }
+
+    for (uint32_t i = 0; i < this->mWarmup; i++) {
+        sequence->eval();
+    }
+
+    std::vector<double> samplesNs;
+    for (uint32_t i = 0; i < this->mRepetitions; i++) {
+        sequence->eval();
+
+        std::vector<Sequence::OpTiming> timings = sequence->getOpTimings();
+
+        double durationNs = 0;
+        bool found = false;
+        for (const Sequence::OpTiming& timing : timings) {
+            if (label.empty() || timing.label == label) {
+                durationNs += timing.durationNs;
+                found = true;
+            }
+        }
+        if (!found) {
+            throw std::runtime_error(fmt::format(
+              "Kompute Benchmark run found no operation with label '{}'",
+              label));
+        }
+        samplesNs.push_back(durationNs);
+    }
+
+    Result result = this->summarize(label, samplesNs, flops, bytes);
+    if (this->mPeakGflops > 0) {
+        result.peakGflopsFraction = result.gflops / this->mPeakGflops;
+    }
+    if (this->mPeakGbps > 0) {
+        result.peakGbpsFraction = result.gbps / this->mPeakGbps;
+    }
+    return result;
+}
+
+Benchmark::Result
+Benchmark::runHost(const std::function<void()>& function,
+                   double flops,
+                   double bytes)
+{
+    KP_LOG_DEBUG("Kompute Benchmark running host function");
+
+    for (uint32_t i = 0; i < this->mWarmup; i++) {
+        function();
+    }
+
+    std::vector<double> samplesNs;
+    for (uint32_t i = 0; i < this->mRepetitions; i++) {
+        std::chrono::steady_clock::time_point start =
+          std::chrono::steady_clock::now();
+        function();
+        samplesNs.push_back(
+          std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start)
+            .count());
+    }
+
+    return this->summarize("host", samplesNs, flops, bytes);
+}
+
+double
+Benchmark::measurePeakBandwidth(uint64_t bytes)
+{
+    KP_LOG_DEBUG("Kompute Benchmark measuring peak bandwidth with {} bytes",
+                 bytes);
+
+    uint64_t elementCount = bytes / sizeof(float);
+    if (elementCount == 0) {
+        throw std::runtime_error(
+          "Kompute Benchmark peak bandwidth requires at least 4 bytes");
+    }
+
+    std::shared_ptr<Tensor> source =
+      this->mManager->tensor(std::vector<float>(elementCount, 0));
+    std::shared_ptr<Tensor> destination =
+      this->mManager->tensor(std::vector<float>(elementCount, 0));
+
+    std::shared_ptr<Sequence> sequence = this->mManager->sequence(0, 1);
+    sequence->record(std::make_shared<OpTensorCopy>(
+      std::vector<std::shared_ptr<Tensor>>{ source, destination }));
+
+    // The copy reads and writes every byte
+    Result result = this->run(sequence, 0, 2.0 * elementCount * sizeof(float));
+    this->mPeakGbps = result.gbps;
+
+    KP_LOG_INFO("Kompute Benchmark measured peak bandwidth of {} GB/s",
+                result.gbps);
+
+    return result.gbps;
+}
+
+void
+Benchmark::setPeak(double gflops, double gbps)
+{
+    this->mPeakGflops = gflops;
+    this->mPeakGbps = gbps;
+}
+
+double
+Benchmark::peakGflops() const
+{
+    return this->mPeakGflops;
+}
+
+double
+Benchmark::peakGbps() const
+{
+    return this->mPeakGbps;
+}
+
+Benchmark::Result
+Benchmark::summarize(const std::string& label,
+                     std::vector<double> samplesNs,
+                     double flops,
+                     double bytes)
+{
+    std::sort(samplesNs.begin(), samplesNs.end());
+
+    Result result;
+    result.label = label;
+    result.repetitions = samplesNs.size();
+    result.minNs = samplesNs.front();
+    result.maxNs = samplesNs.back();
+
+    size_t middle = samplesNs.size() / 2;
+    result.medianNs = samplesNs.size() % 2
+                        ? samplesNs[middle]
+                        : (samplesNs[middle - 1] + samplesNs[middle]) / 2;
+
+    double sumNs = 0;
+    for (double sampleNs : samplesNs) {
+        sumNs += sampleNs;
+    }
+    result.meanNs = sumNs / samplesNs.size();
+
+    double squaredDeviations = 0;
+    for (double sampleNs : samplesNs) {
+        squaredDeviations +=
+          (sampleNs - result.meanNs) * (sampleNs - result.meanNs);
+    }
+    result.stddevNs = std::sqrt(squaredDeviations / samplesNs.size());
+
+    // Operations and bytes per nanosecond are GFLOP/s and GB/s
+    if (result.medianNs > 0) {
+        result.gflops = flops / result.medianNs;
+        result.gbps = bytes / result.medianNs;
+    }
+
+    return result;
+}
+
+}
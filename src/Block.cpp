@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "kompute/Block.hpp"
+
+namespace kp {
+
+Block::Block(std::shared_ptr<vk::Device> device,
+             uint32_t queueIndex,
+             std::shared_ptr<HostAllocator> hostAllocator)
+{
+    KP_LOG_DEBUG("Kompute Block Constructor with existing device");
+
+    this->mDevice = device;
+    this->mQueueIndex = queueIndex;
+    this->mHostAllocator = hostAllocator;
+
+    this->createCommandPool();
+    this->createCommandBuffer();
+}
+
+Block::~Block()
+{
+    KP_LOG_DEBUG("Kompute Block Destructor started");
+
+    if (this->mDevice) {
+        this->destroy();
+    }
+}
+
+std::shared_ptr<Block>
+Block::record(std::shared_ptr<OpBase> op)
+{
+    KP_LOG_DEBUG("Kompute Block record function started");
+
+    if (op.get() == this) {
+        throw std::runtime_error("Kompute Block cannot be recorded into itself");
+    }
+
+    this->begin();
+
+    this->mHazardTracker.recordOperation(*this->mCommandBuffer, op);
+
+    this->mOperations.push_back(op);
+
+    return shared_from_this();
+}
+
+void
+Block::begin()
+{
+    KP_LOG_DEBUG("Kompute Block called BEGIN");
+
+    if (this->isRecording()) {
+        KP_LOG_DEBUG("Kompute Block begin called when already recording");
+        return;
+    }
+
+    this->mOperations.clear();
+    this->mHazardTracker = HazardTracker();
+
+    // Compute blocks are recorded outside of render passes, and may be
+    // executed by several pending command buffers at the same time
+    vk::CommandBufferInheritanceInfo inheritanceInfo;
+    vk::CommandBufferBeginInfo beginInfo(
+      vk::CommandBufferUsageFlagBits::eSimultaneousUse, &inheritanceInfo);
+
+    KP_LOG_INFO("Kompute Block command now started recording");
+    this->mCommandBuffer->begin(beginInfo);
+    this->mRecording = true;
+    this->mRecorded = false;
+}
+
+void
+Block::end()
+{
+    KP_LOG_DEBUG("Kompute Block calling END");
+
+    if (!this->isRecording()) {
+        KP_LOG_WARN("Kompute Block end called when not recording");
+        return;
+    }
+
+    KP_LOG_INFO("Kompute Block command recording END");
+    this->mCommandBuffer->end();
+    this->mRecording = false;
+    this->mRecorded = true;
+}
+
+void
+Block::record(const vk::CommandBuffer& commandBuffer)
+{
+    KP_LOG_DEBUG("Kompute Block record called with {} operations",
+                 this->mOperations.size());
+
+    if (!this->mDevice) {
+        throw std::runtime_error(
+          "Kompute Block recorded into a sequence after being destroyed");
+    }
+
+    // A block without operations still needs a complete command buffer
+    if (!this->mRecorded) {
+        this->begin();
+    }
+    if (this->isRecording()) {
+        this->end();
+    }
+
+    commandBuffer.executeCommands(*this->mCommandBuffer);
+}
+
+void
+Block::preEval(const vk::CommandBuffer& commandBuffer)
+{
+    KP_LOG_DEBUG("Kompute Block preEval called");
+
+    for (size_t i = 0; i < this->mOperations.size(); i++) {
+        this->mOperations[i]->preEval(commandBuffer);
+    }
+}
+
+void
+Block::postEval(const vk::CommandBuffer& commandBuffer)
+{
+    KP_LOG_DEBUG("Kompute Block postEval called");
+
+    for (size_t i = 0; i < this->mOperations.size(); i++) {
+        this->mOperations[i]->postEval(commandBuffer);
+    }
+}
+
+bool
+Block::isRecording()
+{
+    return this->mRecording;
+}
+
+bool
+Block::isInit()
+{
+    return this->mDevice && this->mCommandPool && this->mCommandBuffer;
+}
+
+uint32_t
+Block::operationCount()
+{
+    return this->mOperations.size();
+}
+
+void
+Block::destroy()
+{
+    KP_LOG_DEBUG("Kompute Block destroy called");
+
+    if (!this->mDevice) {
+        KP_LOG_WARN("Kompute Block destroy called "
+                    "with null Device pointer");
+        return;
+    }
+
+    if (this->mCommandBuffer) {
+        this->mDevice->freeCommandBuffers(
+          *this->mCommandPool, 1, this->mCommandBuffer.get());
+        this->mCommandBuffer = nullptr;
+        KP_LOG_DEBUG("Kompute Block Freed CommandBuffer");
+    }
+
+    if (this->mCommandPool) {
+        this->mDevice->destroy(
+          *this->mCommandPool,
+          HostAllocator::callbacks(this->mHostAllocator));
+        this->mCommandPool = nullptr;
+        KP_LOG_DEBUG("Kompute Block Destroyed CommandPool");
+    }
+
+    if (this->mOperations.size()) {
+        KP_LOG_INFO("Kompute Block clearing operations buffer");
+        this->mOperations.clear();
+    }
+
+    this->mRecording = false;
+    this->mRecorded = false;
+    this->mDevice = nullptr;
+}
+
+void
+Block::createCommandPool()
+{
+    KP_LOG_DEBUG("Kompute Block creating command pool");
+
+    if (!this->mDevice) {
+        throw std::runtime_error("Kompute Block device is null");
+    }
+
+    // The command buffer is reset implicitly whenever the block is recorded
+    vk::CommandPoolCreateInfo commandPoolInfo(
+      vk::CommandPoolCreateFlagBits::eResetCommandBuffer, this->mQueueIndex);
+    this->mCommandPool = std::make_shared<vk::CommandPool>();
+    this->mDevice->createCommandPool(
+      &commandPoolInfo,
+      HostAllocator::callbacks(this->mHostAllocator),
+      this->mCommandPool.get());
+    KP_LOG_DEBUG("Kompute Block Command Pool Created");
+}
+
+void
+Block::createCommandBuffer()
+{
+    KP_LOG_DEBUG("Kompute Block creating command buffer");
+
+    if (!this->mCommandPool) {
+        throw std::runtime_error("Kompute Block command pool is null");
+    }
+
+    vk::CommandBufferAllocateInfo commandBufferAllocateInfo(
+      *this->mCommandPool, vk::CommandBufferLevel::eSecondary, 1);
+
+    this->mCommandBuffer = std::make_shared<vk::CommandBuffer>();
+    this->mDevice->allocateCommandBuffers(&commandBufferAllocateInfo,
+                                          this->mCommandBuffer.get());
+    KP_LOG_DEBUG("Kompute Block Secondary Command Buffer Created");
+}
+
+}
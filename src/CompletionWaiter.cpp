@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "kompute/CompletionWaiter.hpp"
+
+namespace kp {
+
+CompletionWaiter::CompletionWaiter(std::shared_ptr<vk::Device> device)
+{
+    KP_LOG_DEBUG("Kompute CompletionWaiter constructor");
+
+    if (!device) {
+        throw std::runtime_error("Kompute CompletionWaiter device is null");
+    }
+
+    this->mDevice = device;
+    this->mThread = std::thread(&CompletionWaiter::run, this);
+}
+
+CompletionWaiter::~CompletionWaiter()
+{
+    KP_LOG_DEBUG("Kompute CompletionWaiter destructor started");
+
+    if (this->mDevice) {
+        this->destroy();
+    }
+}
+
+void
+CompletionWaiter::watch(std::shared_ptr<Sequence> sequence,
+                        Completion completion)
+{
+    if (!sequence->isRunning()) {
+        throw std::runtime_error(
+          "Kompute CompletionWaiter watch called on a sequence not running");
+    }
+
+    const Sequence::Submission& submission =
+      sequence->mSubmissions[sequence->mInFlight.back()];
+    if (submission.batched) {
+        throw std::runtime_error("Kompute CompletionWaiter watch called on a "
+                                 "sequence submitted by a batch");
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->mMutex);
+        if (this->mStopping) {
+            throw std::runtime_error(
+              "Kompute CompletionWaiter watch called after destroy");
+        }
+        this->mPending.push_back({ sequence, submission.fence, completion });
+    }
+    this->mCondition.notify_one();
+}
+
+uint32_t
+CompletionWaiter::pendingCount()
+{
+    std::lock_guard<std::mutex> lock(this->mMutex);
+    return this->mPending.size();
+}
+
+void
+CompletionWaiter::destroy()
+{
+    KP_LOG_DEBUG("Kompute CompletionWaiter destroy called");
+
+    if (!this->mDevice) {
+        KP_LOG_WARN("Kompute CompletionWaiter destroy called "
+                    "with null Device pointer");
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->mMutex);
+        this->mStopping = true;
+    }
+    this->mCondition.notify_one();
+
+    if (this->mThread.joinable()) {
+        this->mThread.join();
+    }
+
+    this->mDevice = nullptr;
+}
+
+void
+CompletionWaiter::run()
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    while (true) {
+        this->mCondition.wait(lock, [this]() {
+            return this->mStopping || this->mPending.size();
+        });
+
+        // Pending submissions are drained before stopping
+        if (this->mPending.empty()) {
+            break;
+        }
+
+        std::vector<vk::Fence> fences;
+        for (const Pending& pending : this->mPending) {
+            fences.push_back(pending.fence);
+        }
+
+        lock.unlock();
+        // Wakes up periodically to include the submissions watched meanwhile
+        vk::Result result =
+          this->mDevice->waitForFences(fences.size(),
+                                       fences.data(),
+                                       VK_FALSE,
+                                       KOMPUTE_COMPLETION_WAITER_TIMEOUT);
+        lock.lock();
+
+        if (result == vk::Result::eTimeout) {
+            continue;
+        }
+
+        // Only the fences waited for are checked, the ones watched meanwhile
+        // are picked up in the next wait
+        std::vector<Pending> completed;
+        for (size_t i = 0; i < fences.size();) {
+            if (this->mDevice->getFenceStatus(this->mPending[i].fence) ==
+                vk::Result::eSuccess) {
+                completed.push_back(this->mPending[i]);
+                this->mPending.erase(this->mPending.begin() + i);
+                fences.erase(fences.begin() + i);
+            } else {
+                i++;
+            }
+        }
+
+        lock.unlock();
+        for (const Pending& pending : completed) {
+            KP_LOG_DEBUG("Kompute CompletionWaiter submission completed");
+
+            std::exception_ptr exception = nullptr;
+            try {
+                pending.sequence->evalAwait();
+            } catch (...) {
+                exception = std::current_exception();
+            }
+
+            try {
+                pending.completion(exception);
+            } catch (const std::exception& e) {
+                KP_LOG_ERROR("Kompute CompletionWaiter completion threw: {}",
+                             e.what());
+            } catch (...) {
+                KP_LOG_ERROR("Kompute CompletionWaiter completion threw");
+            }
+        }
+        lock.lock();
+    }
+}
+
+}
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "kompute/DebugUtils.hpp"
+
+namespace kp {
+
+DebugUtils::DebugUtils(const vk::Instance& instance)
+{
+    KP_LOG_DEBUG("Kompute DebugUtils resolving VK_EXT_debug_utils functions");
+
+    this->mSetObjectName =
+      (PFN_vkSetDebugUtilsObjectNameEXT)vkGetInstanceProcAddr(
+        instance, "vkSetDebugUtilsObjectNameEXT");
+    this->mCmdBeginLabel =
+      (PFN_vkCmdBeginDebugUtilsLabelEXT)vkGetInstanceProcAddr(
+        instance, "vkCmdBeginDebugUtilsLabelEXT");
+    this->mCmdEndLabel = (PFN_vkCmdEndDebugUtilsLabelEXT)vkGetInstanceProcAddr(
+      instance, "vkCmdEndDebugUtilsLabelEXT");
+}
+
+bool
+DebugUtils::isValid() const
+{
+    return this->mSetObjectName && this->mCmdBeginLabel && this->mCmdEndLabel;
+}
+
+void
+DebugUtils::setObjectName(const vk::Device& device,
+                          vk::ObjectType objectType,
+                          uint64_t objectHandle,
+                          const std::string& name) const
+{
+    if (!this->mSetObjectName || !objectHandle || name.empty()) {
+        return;
+    }
+
+    VkDebugUtilsObjectNameInfoEXT nameInfo = {};
+    nameInfo.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT;
+    nameInfo.objectType = (VkObjectType)objectType;
+    nameInfo.objectHandle = objectHandle;
+    nameInfo.pObjectName = name.c_str();
+    this->mSetObjectName(device, &nameInfo);
+}
+
+void
+DebugUtils::beginLabel(const vk::CommandBuffer& commandBuffer,
+                       const std::string& label) const
+{
+    if (!this->mCmdBeginLabel) {
+        return;
+    }
+
+    VkDebugUtilsLabelEXT labelInfo = {};
+    labelInfo.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
+    labelInfo.pLabelName = label.c_str();
+    this->mCmdBeginLabel(commandBuffer, &labelInfo);
+}
+
+void
+DebugUtils::endLabel(const vk::CommandBuffer& commandBuffer) const
+{
+    if (!this->mCmdEndLabel) {
+        return;
+    }
+
+    this->mCmdEndLabel(commandBuffer);
+}
+
+}
@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+
+#include "kompute/DescriptorAllocator.hpp"
+
+namespace kp {
+
+DescriptorAllocator::DescriptorAllocator(
+  std::shared_ptr<vk::Device> device,
+  std::shared_ptr<HostAllocator> hostAllocator)
+{
+    KP_LOG_DEBUG("Kompute DescriptorAllocator constructor");
+
+    if (!device) {
+        throw std::runtime_error("Kompute DescriptorAllocator device is null");
+    }
+
+    this->mDevice = device;
+    this->mHostAllocator = hostAllocator;
+}
+
+DescriptorAllocator::~DescriptorAllocator()
+{
+    KP_LOG_DEBUG("Kompute DescriptorAllocator destructor started");
+
+    if (this->mDevice) {
+        this->destroy();
+    }
+}
+
+DescriptorAllocator::Allocation
+DescriptorAllocator::allocate(const vk::DescriptorSetLayout& layout,
+                              uint32_t storageBufferCount,
+                              uint32_t uniformBufferCount,
+                              uint32_t storageImageCount)
+{
+    std::lock_guard<std::mutex> lock(this->mMutex);
+
+    if (!this->mDevice) {
+        throw std::runtime_error(
+          "Kompute DescriptorAllocator allocate called after destroy");
+    }
+
+    vk::DescriptorSetAllocateInfo descriptorSetAllocateInfo(
+      vk::DescriptorPool(),
+      1, // Descriptor set layout count
+      &layout);
+
+    Allocation allocation;
+
+    // Newest pools are tried first as they are the most likely to have space
+    for (auto it = this->mPools.rbegin(); it != this->mPools.rend(); ++it) {
+        descriptorSetAllocateInfo.descriptorPool = *it;
+        if (this->mDevice->allocateDescriptorSets(&descriptorSetAllocateInfo,
+                                                  &allocation.set) ==
+            vk::Result::eSuccess) {
+            allocation.pool = *it;
+            this->mAllocatedSetCount++;
+            return allocation;
+        }
+    }
+
+    KP_LOG_DEBUG("Kompute DescriptorAllocator creating descriptor pool {}",
+                 this->mPools.size());
+    allocation.pool = this->createPool(
+      storageBufferCount, uniformBufferCount, storageImageCount);
+
+    descriptorSetAllocateInfo.descriptorPool = allocation.pool;
+    vk::Result result = this->mDevice->allocateDescriptorSets(
+      &descriptorSetAllocateInfo, &allocation.set);
+    if (result != vk::Result::eSuccess) {
+        throw std::runtime_error(
+          fmt::format("Kompute DescriptorAllocator failed to allocate "
+                      "descriptor set from a new pool: {}",
+                      vk::to_string(result)));
+    }
+
+    this->mAllocatedSetCount++;
+    return allocation;
+}
+
+void
+DescriptorAllocator::free(const Allocation& allocation)
+{
+    std::lock_guard<std::mutex> lock(this->mMutex);
+
+    // Sets of destroyed pools were already freed with them
+    if (!this->mDevice) {
+        return;
+    }
+
+    this->mDevice->freeDescriptorSets(allocation.pool, 1, &allocation.set);
+    this->mAllocatedSetCount--;
+}
+
+uint32_t
+DescriptorAllocator::poolCount()
+{
+    std::lock_guard<std::mutex> lock(this->mMutex);
+    return this->mPools.size();
+}
+
+uint32_t
+DescriptorAllocator::allocatedSetCount()
+{
+    std::lock_guard<std::mutex> lock(this->mMutex);
+    return this->mAllocatedSetCount;
+}
+
+void
+DescriptorAllocator::destroy()
+{
+    KP_LOG_DEBUG("Kompute DescriptorAllocator destroy called");
+
+    std::lock_guard<std::mutex> lock(this->mMutex);
+
+    if (!this->mDevice) {
+        KP_LOG_WARN("Kompute DescriptorAllocator destroy called "
+                    "with null Device pointer");
+        return;
+    }
+
+    for (const vk::DescriptorPool& pool : this->mPools) {
+        this->mDevice->destroy(
+          pool, HostAllocator::callbacks(this->mHostAllocator));
+    }
+    this->mPools.clear();
+    this->mAllocatedSetCount = 0;
+
+    this->mDevice = nullptr;
+}
+
+vk::DescriptorPool
+DescriptorAllocator::createPool(uint32_t storageBufferCount,
+                                uint32_t uniformBufferCount,
+                                uint32_t storageImageCount)
+{
+    // Pools are large enough for at least the set being allocated
+    std::vector<vk::DescriptorPoolSize> descriptorPoolSizes = {
+        vk::DescriptorPoolSize(
+          vk::DescriptorType::eStorageBuffer,
+          std::max<uint32_t>(storageBufferCount,
+                             KOMPUTE_DESCRIPTOR_POOL_DESCRIPTORS)),
+        vk::DescriptorPoolSize(
+          vk::DescriptorType::eUniformBuffer,
+          std::max<uint32_t>(uniformBufferCount,
+                             KOMPUTE_DESCRIPTOR_POOL_DESCRIPTORS)),
+        vk::DescriptorPoolSize(
+          vk::DescriptorType::eStorageImage,
+          std::max<uint32_t>(storageImageCount,
+                             KOMPUTE_DESCRIPTOR_POOL_DESCRIPTORS)),
+    };
+
+    vk::DescriptorPoolCreateInfo descriptorPoolInfo(
+      vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet,
+      KOMPUTE_DESCRIPTOR_POOL_MAX_SETS,
+      static_cast<uint32_t>(descriptorPoolSizes.size()),
+      descriptorPoolSizes.data());
+
+    vk::DescriptorPool pool;
+    vk::Result result =
+      this->mDevice->createDescriptorPool(
+        &descriptorPoolInfo,
+        HostAllocator::callbacks(this->mHostAllocator),
+        &pool);
+    if (result != vk::Result::eSuccess) {
+        throw std::runtime_error(
+          fmt::format("Kompute DescriptorAllocator failed to create "
+                      "descriptor pool: {}",
+                      vk::to_string(result)));
+    }
+
+    this->mPools.push_back(pool);
+    return pool;
+}
+
+}
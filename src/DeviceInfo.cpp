@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "kompute/DeviceInfo.hpp"
+
+namespace kp {
+
+DeviceInfo::DeviceInfo(const vk::PhysicalDevice& physicalDevice)
+{
+    KP_LOG_DEBUG("Kompute DeviceInfo querying physical device properties");
+
+    vk::PhysicalDeviceProperties2 properties;
+    properties.pNext = &this->mSubgroupProperties;
+    physicalDevice.getProperties2(&properties);
+
+    this->mProperties = properties.properties;
+    this->mSubgroupProperties.pNext = nullptr;
+    this->mMemoryProperties = physicalDevice.getMemoryProperties();
+    this->mQueueFamilyProperties = physicalDevice.getQueueFamilyProperties();
+}
+
+const vk::PhysicalDeviceProperties&
+DeviceInfo::properties() const
+{
+    return this->mProperties;
+}
+
+const vk::PhysicalDeviceSubgroupProperties&
+DeviceInfo::subgroupProperties() const
+{
+    return this->mSubgroupProperties;
+}
+
+const vk::PhysicalDeviceMemoryProperties&
+DeviceInfo::memoryProperties() const
+{
+    return this->mMemoryProperties;
+}
+
+const std::vector<vk::QueueFamilyProperties>&
+DeviceInfo::queueFamilyProperties() const
+{
+    return this->mQueueFamilyProperties;
+}
+
+const vk::PhysicalDeviceFeatures&
+DeviceInfo::enabledFeatures() const
+{
+    return this->mEnabledFeatures;
+}
+
+void
+DeviceInfo::setEnabledFeatures(
+  const vk::PhysicalDeviceFeatures& enabledFeatures)
+{
+    this->mEnabledFeatures = enabledFeatures;
+}
+
+bool
+DeviceInfo::hasCalibratedTimestamps() const
+{
+    return this->mCalibratedTimestamps;
+}
+
+void
+DeviceInfo::setCalibratedTimestamps(bool calibratedTimestamps)
+{
+    this->mCalibratedTimestamps = calibratedTimestamps;
+}
+
+}
@@ -0,0 +1,354 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <functional>
+
+#include "kompute/Expression.hpp"
+#include "kompute/Shader.hpp"
+
+namespace kp {
+
+Expression::Expression(const std::shared_ptr<Tensor>& tensor)
+{
+    if (!tensor) {
+        throw std::runtime_error("Kompute Expression tensor is null");
+    }
+
+    std::shared_ptr<Node> node = std::make_shared<Node>();
+    node->operation = Operation::eTensor;
+    node->tensor = tensor;
+    node->constant = 0;
+    this->mNode = node;
+}
+
+Expression::Expression(float constant)
+{
+    std::shared_ptr<Node> node = std::make_shared<Node>();
+    node->operation = Operation::eConstant;
+    node->constant = constant;
+    this->mNode = node;
+}
+
+Expression::Expression(Operation operation,
+                       const Expression& left,
+                       const Expression& right)
+{
+    if (operation < Operation::eAdd || operation > Operation::eMax) {
+        throw std::runtime_error(
+          fmt::format("Kompute Expression operation {} is not binary",
+                      static_cast<uint32_t>(operation)));
+    }
+
+    std::shared_ptr<Node> node = std::make_shared<Node>();
+    node->operation = operation;
+    node->constant = 0;
+    node->left = left.mNode;
+    node->right = right.mNode;
+    this->mNode = node;
+}
+
+Expression::Expression(Operation operation, const Expression& operand)
+{
+    if (operation < Operation::eNegate || operation > Operation::eLog) {
+        throw std::runtime_error(
+          fmt::format("Kompute Expression operation {} is not unary",
+                      static_cast<uint32_t>(operation)));
+    }
+
+    std::shared_ptr<Node> node = std::make_shared<Node>();
+    node->operation = operation;
+    node->constant = 0;
+    node->left = operand.mNode;
+    this->mNode = node;
+}
+
+std::vector<std::shared_ptr<Tensor>>
+Expression::tensors() const
+{
+    std::vector<std::shared_ptr<Tensor>> tensors;
+    std::vector<const Node*> stack = { this->mNode.get() };
+    while (stack.size()) {
+        const Node* node = stack.back();
+        stack.pop_back();
+        if (node->operation == Operation::eTensor) {
+            if (std::find(tensors.begin(), tensors.end(), node->tensor) ==
+                tensors.end()) {
+                tensors.push_back(node->tensor);
+            }
+            continue;
+        }
+        // Left operands are visited first, as in the signature
+        if (node->right) {
+            stack.push_back(node->right.get());
+        }
+        if (node->left) {
+            stack.push_back(node->left.get());
+        }
+    }
+    return tensors;
+}
+
+std::vector<float>
+Expression::constants() const
+{
+    std::vector<float> constants;
+    std::vector<const Node*> stack = { this->mNode.get() };
+    while (stack.size()) {
+        const Node* node = stack.back();
+        stack.pop_back();
+        if (node->operation == Operation::eConstant) {
+            constants.push_back(node->constant);
+        }
+        if (node->right) {
+            stack.push_back(node->right.get());
+        }
+        if (node->left) {
+            stack.push_back(node->left.get());
+        }
+    }
+    return constants;
+}
+
+std::string
+Expression::signature() const
+{
+    static const char* names[] = { "t",   "c",   "add",  "sub", "mul",
+                                   "div", "min", "max",  "neg", "abs",
+                                   "sqrt", "exp", "log" };
+
+    std::vector<std::shared_ptr<Tensor>> tensors = this->tensors();
+    uint32_t constantIndex = 0;
+
+    std::function<std::string(const Node&)> write = [&](const Node& node) {
+        switch (node.operation) {
+            case Operation::eTensor:
+                return fmt::format(
+                  "t{}",
+                  std::find(tensors.begin(), tensors.end(), node.tensor) -
+                    tensors.begin());
+            case Operation::eConstant:
+                return fmt::format("c{}", constantIndex++);
+            default:
+                break;
+        }
+        std::string signature = names[static_cast<uint32_t>(node.operation)];
+        signature += "(" + write(*node.left);
+        if (node.right) {
+            signature += "," + write(*node.right);
+        }
+        return signature + ")";
+    };
+    return write(*this->mNode);
+}
+
+std::string
+Expression::glsl() const
+{
+    std::vector<std::shared_ptr<Tensor>> tensors = this->tensors();
+    uint32_t constantCount =
+      static_cast<uint32_t>(this->constants().size());
+
+    // The output is bound first, followed by the tensors of the expression,
+    // and the local size x is specialized by the algorithm through id 0
+    std::string source = "#version 450\n"
+                         "layout(local_size_x_id = 0) in;\n"
+                         "layout(set = 0, binding = 0) buffer Output "
+                         "{ float values[]; } tensorOutput;\n";
+    for (size_t i = 0; i < tensors.size(); i++) {
+        source += fmt::format("layout(set = 0, binding = {}) readonly buffer "
+                              "Input{} {{ float values[]; }} tensor{};\n",
+                              i + 1,
+                              i,
+                              i);
+    }
+    if (constantCount) {
+        source += fmt::format("layout(push_constant) uniform PushConstants "
+                              "{{ float values[{}]; }} constants;\n",
+                              constantCount);
+    }
+
+    // Operands are written in the order of the signature, and every tensor
+    // is loaded once
+    uint32_t constantIndex = 0;
+    std::function<std::string(const Node&)> write = [&](const Node& node) {
+        switch (node.operation) {
+            case Operation::eTensor:
+                return fmt::format(
+                  "t{}",
+                  std::find(tensors.begin(), tensors.end(), node.tensor) -
+                    tensors.begin());
+            case Operation::eConstant:
+                return fmt::format("constants.values[{}]", constantIndex++);
+            default:
+                break;
+        }
+        std::string left = write(*node.left);
+        std::string right = node.right ? write(*node.right) : "";
+        switch (node.operation) {
+            case Operation::eAdd:
+                return "(" + left + " + " + right + ")";
+            case Operation::eSubtract:
+                return "(" + left + " - " + right + ")";
+            case Operation::eMultiply:
+                return "(" + left + " * " + right + ")";
+            case Operation::eDivide:
+                return "(" + left + " / " + right + ")";
+            case Operation::eMin:
+                return "min(" + left + ", " + right + ")";
+            case Operation::eMax:
+                return "max(" + left + ", " + right + ")";
+            case Operation::eNegate:
+                return "(-" + left + ")";
+            case Operation::eAbs:
+                return "abs(" + left + ")";
+            case Operation::eSqrt:
+                return "sqrt(" + left + ")";
+            case Operation::eExp:
+                return "exp(" + left + ")";
+            case Operation::eLog:
+                return "log(" + left + ")";
+            default:
+                throw std::runtime_error(
+                  "Kompute Expression invalid operation");
+        }
+    };
+    std::string result = write(*this->mNode);
+
+    source += "void main() {\n"
+              "    uint index = gl_GlobalInvocationID.x;\n"
+              "    if (index >= tensorOutput.values.length()) {\n"
+              "        return;\n"
+              "    }\n";
+    for (size_t i = 0; i < tensors.size(); i++) {
+        source += fmt::format(
+          "    float t{} = tensor{}.values[index];\n", i, i);
+    }
+    source += "    tensorOutput.values[index] = " + result + ";\n}\n";
+    return source;
+}
+
+std::vector<uint32_t>
+Expression::spirv() const
+{
+    KP_LOG_DEBUG("Kompute Expression compiling {}", this->signature());
+
+    // The source only depends on the signature, so the SPIR-V cached by the
+    // shader compiler is shared by the expressions of the same structure
+    return Shader::compile(this->glsl());
+}
+
+Expression
+operator+(const Expression& left, const Expression& right)
+{
+    return Expression(Expression::Operation::eAdd, left, right);
+}
+
+Expression
+operator+(const Expression& left, float right)
+{
+    return left + Expression(right);
+}
+
+Expression
+operator+(float left, const Expression& right)
+{
+    return Expression(left) + right;
+}
+
+Expression
+operator-(const Expression& left, const Expression& right)
+{
+    return Expression(Expression::Operation::eSubtract, left, right);
+}
+
+Expression
+operator-(const Expression& left, float right)
+{
+    return left - Expression(right);
+}
+
+Expression
+operator-(float left, const Expression& right)
+{
+    return Expression(left) - right;
+}
+
+Expression
+operator*(const Expression& left, const Expression& right)
+{
+    return Expression(Expression::Operation::eMultiply, left, right);
+}
+
+Expression
+operator*(const Expression& left, float right)
+{
+    return left * Expression(right);
+}
+
+Expression
+operator*(float left, const Expression& right)
+{
+    return Expression(left) * right;
+}
+
+Expression
+operator/(const Expression& left, const Expression& right)
+{
+    return Expression(Expression::Operation::eDivide, left, right);
+}
+
+Expression
+operator/(const Expression& left, float right)
+{
+    return left / Expression(right);
+}
+
+Expression
+operator/(float left, const Expression& right)
+{
+    return Expression(left) / right;
+}
+
+Expression
+operator-(const Expression& operand)
+{
+    return Expression(Expression::Operation::eNegate, operand);
+}
+
+Expression
+min(const Expression& left, const Expression& right)
+{
+    return Expression(Expression::Operation::eMin, left, right);
+}
+
+Expression
+max(const Expression& left, const Expression& right)
+{
+    return Expression(Expression::Operation::eMax, left, right);
+}
+
+Expression
+abs(const Expression& operand)
+{
+    return Expression(Expression::Operation::eAbs, operand);
+}
+
+Expression
+sqrt(const Expression& operand)
+{
+    return Expression(Expression::Operation::eSqrt, operand);
+}
+
+Expression
+exp(const Expression& operand)
+{
+    return Expression(Expression::Operation::eExp, operand);
+}
+
+Expression
+log(const Expression& operand)
+{
+    return Expression(Expression::Operation::eLog, operand);
+}
+
+}
@@ -0,0 +1,346 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+
+#include "kompute/Graph.hpp"
+
+namespace kp {
+
+Graph::Graph(const std::vector<uint32_t>& queueIndices,
+             SequenceFactory sequenceFactory)
+{
+    KP_LOG_DEBUG("Kompute Graph constructor with {} queues",
+                 queueIndices.size());
+
+    if (queueIndices.empty()) {
+        throw std::runtime_error("Kompute Graph requires a queue");
+    }
+    if (!sequenceFactory) {
+        throw std::runtime_error("Kompute Graph sequence factory is null");
+    }
+
+    this->mQueueIndices = queueIndices;
+    this->mSequenceFactory = sequenceFactory;
+}
+
+Graph::~Graph()
+{
+    KP_LOG_DEBUG("Kompute Graph destructor started");
+
+    this->destroy();
+}
+
+uint32_t
+Graph::add(std::shared_ptr<OpBase> op,
+           const std::vector<std::shared_ptr<Tensor>>& inputs,
+           const std::vector<std::shared_ptr<Tensor>>& outputs)
+{
+    if (!op) {
+        throw std::runtime_error("Kompute Graph operation added is null");
+    }
+
+    uint32_t index = this->mNodes.size();
+    Node node;
+    node.op = op;
+
+    std::vector<uint32_t> dependencies;
+    for (const std::shared_ptr<Tensor>& tensor : inputs) {
+        if (!tensor) {
+            throw std::runtime_error("Kompute Graph input tensor is null");
+        }
+        TensorState& state = this->mTensorStates[
+          tensor->isView() ? tensor->parent().get() : tensor.get()];
+        if (state.lastWriter >= 0) {
+            dependencies.push_back(state.lastWriter);
+        }
+        state.readers.push_back(index);
+        node.tensors.push_back(tensor);
+    }
+    for (const std::shared_ptr<Tensor>& tensor : outputs) {
+        if (!tensor) {
+            throw std::runtime_error("Kompute Graph output tensor is null");
+        }
+        TensorState& state = this->mTensorStates[
+          tensor->isView() ? tensor->parent().get() : tensor.get()];
+        if (state.lastWriter >= 0) {
+            dependencies.push_back(state.lastWriter);
+        }
+        for (uint32_t reader : state.readers) {
+            if (reader != index) {
+                dependencies.push_back(reader);
+            }
+        }
+        state.lastWriter = index;
+        state.readers.clear();
+        node.tensors.push_back(tensor);
+    }
+
+    std::sort(dependencies.begin(), dependencies.end());
+    dependencies.erase(std::unique(dependencies.begin(), dependencies.end()),
+                       dependencies.end());
+    node.dependencies = dependencies;
+
+    KP_LOG_DEBUG("Kompute Graph added operation {} with {} dependencies",
+                 index,
+                 dependencies.size());
+
+    this->mNodes.push_back(node);
+    this->mCompiled = false;
+
+    return index;
+}
+
+uint32_t
+Graph::add(std::shared_ptr<OpBase> op)
+{
+    if (!op) {
+        throw std::runtime_error("Kompute Graph operation added is null");
+    }
+
+    std::vector<OpBase::TensorAccess> accesses = op->tensorAccesses();
+    if (accesses.empty()) {
+        throw std::runtime_error(
+          "Kompute Graph operation declares no tensor accesses, its inputs "
+          "and outputs must be provided");
+    }
+
+    const vk::AccessFlags writeMask =
+      vk::AccessFlagBits::eShaderWrite | vk::AccessFlagBits::eTransferWrite |
+      vk::AccessFlagBits::eHostWrite | vk::AccessFlagBits::eMemoryWrite;
+
+    std::vector<std::shared_ptr<Tensor>> inputs;
+    std::vector<std::shared_ptr<Tensor>> outputs;
+    for (const OpBase::TensorAccess& access : accesses) {
+        if (access.accessMask & writeMask) {
+            outputs.push_back(access.tensor);
+        } else {
+            inputs.push_back(access.tensor);
+        }
+    }
+
+    return this->add(op, inputs, outputs);
+}
+
+void
+Graph::compile()
+{
+    KP_LOG_DEBUG("Kompute Graph compiling {} operations", this->mNodes.size());
+
+    this->await();
+
+    for (Segment& segment : this->mSegments) {
+        segment.sequence->destroy();
+    }
+    this->mSegments.clear();
+
+    this->assignQueues();
+    this->createSegments();
+
+    for (Segment& segment : this->mSegments) {
+        segment.sequence =
+          this->mSequenceFactory(this->mQueueIndices[segment.queue]);
+        for (uint32_t nodeIndex : segment.nodes) {
+            segment.sequence->record(this->mNodes[nodeIndex].op);
+        }
+        segment.sequence->end();
+    }
+
+    KP_LOG_DEBUG("Kompute Graph compiled into {} sequences",
+                 this->mSegments.size());
+
+    this->mCompiled = true;
+    this->mCompileCount++;
+}
+
+void
+Graph::run()
+{
+    this->runAsync();
+    this->await();
+}
+
+void
+Graph::runAsync()
+{
+    this->await();
+
+    if (!this->mCompiled) {
+        this->compile();
+    }
+
+    this->mRunning = true;
+    for (const Segment& segment : this->mSegments) {
+        std::vector<std::shared_ptr<Sequence>> waitSequences;
+        for (uint32_t waitSegment : segment.waitSegments) {
+            waitSequences.push_back(this->mSegments[waitSegment].sequence);
+        }
+        segment.sequence->evalAsync(waitSequences);
+    }
+}
+
+void
+Graph::await()
+{
+    if (!this->mRunning) {
+        return;
+    }
+
+    for (const Segment& segment : this->mSegments) {
+        if (segment.sequence->isRunning()) {
+            segment.sequence->evalAwait();
+        }
+    }
+    this->mRunning = false;
+}
+
+bool
+Graph::isCompiled()
+{
+    return this->mCompiled;
+}
+
+uint32_t
+Graph::operationCount()
+{
+    return this->mNodes.size();
+}
+
+const std::vector<uint32_t>&
+Graph::dependencies(uint32_t operationIndex)
+{
+    if (operationIndex >= this->mNodes.size()) {
+        throw std::runtime_error(
+          fmt::format("Kompute Graph operation index {} out of range of {}",
+                      operationIndex,
+                      this->mNodes.size()));
+    }
+    return this->mNodes[operationIndex].dependencies;
+}
+
+std::vector<uint32_t>
+Graph::operationQueues()
+{
+    std::vector<uint32_t> operationQueues;
+    for (const Node& node : this->mNodes) {
+        operationQueues.push_back(this->mQueueIndices[node.queue]);
+    }
+    return operationQueues;
+}
+
+uint32_t
+Graph::sequenceCount()
+{
+    return this->mSegments.size();
+}
+
+uint64_t
+Graph::compileCount()
+{
+    return this->mCompileCount;
+}
+
+void
+Graph::destroy()
+{
+    KP_LOG_DEBUG("Kompute Graph destroy called");
+
+    this->await();
+
+    for (Segment& segment : this->mSegments) {
+        segment.sequence->destroy();
+    }
+    this->mSegments.clear();
+    this->mNodes.clear();
+    this->mTensorStates.clear();
+    this->mCompiled = false;
+}
+
+void
+Graph::assignQueues()
+{
+    std::vector<int64_t> lastNodes(this->mQueueIndices.size(), -1);
+    std::vector<uint32_t> loads(this->mQueueIndices.size(), 0);
+
+    for (uint32_t i = 0; i < this->mNodes.size(); i++) {
+        Node& node = this->mNodes[i];
+
+        // An operation continuing the chain of one of its dependencies stays
+        // on its queue, so the dependency needs no semaphore
+        int64_t queue = -1;
+        for (uint32_t dependency : node.dependencies) {
+            uint32_t dependencyQueue = this->mNodes[dependency].queue;
+            if (lastNodes[dependencyQueue] == dependency) {
+                queue = dependencyQueue;
+                break;
+            }
+        }
+        // Otherwise it starts a chain on the least loaded queue
+        if (queue < 0) {
+            queue = std::min_element(loads.begin(), loads.end()) -
+                    loads.begin();
+        }
+
+        node.queue = queue;
+        lastNodes[queue] = i;
+        loads[queue]++;
+    }
+}
+
+void
+Graph::createSegments()
+{
+    // Operations waited on by another queue end their sequence, so the
+    // semaphore signaled at its end follows them
+    std::vector<bool> waited(this->mNodes.size(), false);
+    for (const Node& node : this->mNodes) {
+        for (uint32_t dependency : node.dependencies) {
+            if (this->mNodes[dependency].queue != node.queue) {
+                waited[dependency] = true;
+            }
+        }
+    }
+
+    // Segments are created in the order of their first operation, which is
+    // an order where every segment comes after the segments it waits for
+    std::vector<int64_t> openSegments(this->mQueueIndices.size(), -1);
+    for (uint32_t i = 0; i < this->mNodes.size(); i++) {
+        Node& node = this->mNodes[i];
+
+        bool waits = false;
+        for (uint32_t dependency : node.dependencies) {
+            if (this->mNodes[dependency].queue != node.queue) {
+                waits = true;
+            }
+        }
+        // Operations waiting for another queue start a sequence, so the
+        // semaphore waited on at its start precedes them
+        if (openSegments[node.queue] < 0 || waits) {
+            openSegments[node.queue] = this->mSegments.size();
+            Segment segment;
+            segment.queue = node.queue;
+            this->mSegments.push_back(segment);
+        }
+
+        node.segment = openSegments[node.queue];
+        Segment& segment = this->mSegments[node.segment];
+        segment.nodes.push_back(i);
+
+        // Earlier sequences of the same queue are ordered by the barrier
+        // each sequence records before the first access to a tensor
+        for (uint32_t dependency : node.dependencies) {
+            uint32_t dependencySegment = this->mNodes[dependency].segment;
+            if (this->mNodes[dependency].queue != node.queue &&
+                std::find(segment.waitSegments.begin(),
+                          segment.waitSegments.end(),
+                          dependencySegment) == segment.waitSegments.end()) {
+                segment.waitSegments.push_back(dependencySegment);
+            }
+        }
+
+        if (waited[i]) {
+            openSegments[node.queue] = -1;
+        }
+    }
+}
+
+}
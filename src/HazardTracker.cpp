@@ -0,0 +1,184 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "kompute/HazardTracker.hpp"
+
+namespace kp {
+
+static const vk::AccessFlags WRITE_ACCESS_MASK =
+  vk::AccessFlagBits::eShaderWrite | vk::AccessFlagBits::eTransferWrite |
+  vk::AccessFlagBits::eHostWrite;
+
+HazardTracker::HazardTracker(bool computeSupported)
+{
+    this->mComputeSupported = computeSupported;
+}
+
+void
+HazardTracker::recordBarriers(const vk::CommandBuffer& commandBuffer,
+                              const std::vector<OpBase::TensorAccess>& accesses)
+{
+    // Accesses to views are combined into the tensor owning their memory
+    std::vector<std::pair<std::shared_ptr<Tensor>, OpBase::TensorAccess>>
+      tensorAccesses;
+    for (const OpBase::TensorAccess& access : accesses) {
+        std::shared_ptr<Tensor> tensor =
+          access.tensor->isView() ? access.tensor->parent() : access.tensor;
+
+        uint32_t index = 0;
+        while (index < tensorAccesses.size() &&
+               tensorAccesses[index].first != tensor) {
+            index++;
+        }
+        if (index == tensorAccesses.size()) {
+            tensorAccesses.push_back({ tensor, access });
+        } else {
+            tensorAccesses[index].second.stageMask |= access.stageMask;
+            tensorAccesses[index].second.accessMask |= access.accessMask;
+        }
+    }
+
+    // The barriers of all the tensors are recorded with a single command
+    std::vector<vk::BufferMemoryBarrier> bufferMemoryBarriers;
+    std::vector<vk::ImageMemoryBarrier> imageMemoryBarriers;
+    vk::PipelineStageFlags srcStageMask;
+    vk::PipelineStageFlags dstStageMask;
+    vk::AccessFlags srcAccessMask;
+    vk::AccessFlags dstAccessMask;
+
+    for (const auto& tensorAccess : tensorAccesses) {
+        const std::shared_ptr<Tensor>& tensor = tensorAccess.first;
+        vk::PipelineStageFlags stageMask = tensorAccess.second.stageMask;
+        vk::AccessFlags accessMask = tensorAccess.second.accessMask;
+
+        auto it = this->mStates.find(tensor.get());
+        if (it == this->mStates.end()) {
+            // Writes from previous submissions or untracked operations
+            State state;
+            state.writeStageMask = vk::PipelineStageFlagBits::eTransfer;
+            state.writeAccessMask = vk::AccessFlagBits::eTransferWrite;
+            if (this->mComputeSupported) {
+                state.writeStageMask |=
+                  vk::PipelineStageFlagBits::eComputeShader;
+                state.writeAccessMask |= vk::AccessFlagBits::eShaderWrite;
+            }
+            it = this->mStates.emplace(tensor.get(), state).first;
+        }
+        State& state = it->second;
+
+        vk::PipelineStageFlags barrierStageMask;
+        vk::AccessFlags barrierAccessMask;
+        vk::AccessFlags barrierDstAccessMask;
+
+        if (accessMask & WRITE_ACCESS_MASK) {
+            if (state.writeStageMask) {
+                // Write after write, also covering the reads in between
+                barrierStageMask = state.writeStageMask | state.readStageMask;
+                barrierAccessMask = state.writeAccessMask;
+                barrierDstAccessMask = accessMask;
+            } else if (state.readStageMask) {
+                // Write after read only requires an execution dependency
+                barrierStageMask = state.readStageMask;
+            }
+
+            state.writeStageMask = stageMask;
+            state.writeAccessMask = accessMask & WRITE_ACCESS_MASK;
+            state.visibleStageMask = vk::PipelineStageFlags();
+            state.visibleAccessMask = vk::AccessFlags();
+            state.readStageMask = vk::PipelineStageFlags();
+        } else {
+            bool visible = (state.visibleStageMask & stageMask) == stageMask &&
+                           (state.visibleAccessMask & accessMask) == accessMask;
+            if (state.writeStageMask && !visible) {
+                // Read after write
+                barrierStageMask = state.writeStageMask;
+                barrierAccessMask = state.writeAccessMask;
+                barrierDstAccessMask = accessMask;
+                state.visibleStageMask |= stageMask;
+                state.visibleAccessMask |= accessMask;
+            }
+            state.readStageMask |= stageMask;
+        }
+
+        if (barrierStageMask) {
+            if (tensor->tensorType() == Tensor::TensorTypes::eImage) {
+                imageMemoryBarriers.push_back(tensor->createImageMemoryBarrier(
+                  barrierAccessMask, barrierDstAccessMask));
+            } else {
+                bufferMemoryBarriers.push_back(
+                  tensor->createPrimaryBufferMemoryBarrier(
+                    barrierAccessMask, barrierDstAccessMask));
+            }
+            srcStageMask |= barrierStageMask;
+            dstStageMask |= stageMask;
+            srcAccessMask |= barrierAccessMask;
+            dstAccessMask |= barrierDstAccessMask;
+        }
+    }
+
+    size_t barrierCount =
+      bufferMemoryBarriers.size() + imageMemoryBarriers.size();
+    if (barrierCount == 0) {
+        return;
+    }
+
+    this->mBarrierCount++;
+
+    // A global barrier is cheaper when every tensor accessed needs one, and
+    // covers images as they stay in the same layout
+    if (barrierCount > 1 && barrierCount == tensorAccesses.size()) {
+        KP_LOG_DEBUG("Kompute HazardTracker recording global memory barrier "
+                     "for {} tensors",
+                     barrierCount);
+
+        vk::MemoryBarrier memoryBarrier(srcAccessMask, dstAccessMask);
+        commandBuffer.pipelineBarrier(srcStageMask,
+                                      dstStageMask,
+                                      vk::DependencyFlags(),
+                                      memoryBarrier,
+                                      nullptr,
+                                      nullptr);
+        return;
+    }
+
+    KP_LOG_DEBUG("Kompute HazardTracker recording {} buffer and {} image "
+                 "memory barriers",
+                 bufferMemoryBarriers.size(),
+                 imageMemoryBarriers.size());
+
+    commandBuffer.pipelineBarrier(srcStageMask,
+                                  dstStageMask,
+                                  vk::DependencyFlags(),
+                                  nullptr,
+                                  bufferMemoryBarriers,
+                                  imageMemoryBarriers);
+}
+
+void
+HazardTracker::recordOperation(const vk::CommandBuffer& commandBuffer,
+                               std::shared_ptr<OpBase> op)
+{
+    std::vector<OpBase::TensorAccess> accesses = op->tensorAccesses();
+
+    // Operations with undeclared accesses record their own barriers
+    if (accesses.empty()) {
+        this->reset();
+    } else {
+        this->recordBarriers(commandBuffer, accesses);
+    }
+
+    op->record(commandBuffer);
+}
+
+void
+HazardTracker::reset()
+{
+    this->mStates.clear();
+}
+
+uint64_t
+HazardTracker::barrierCount()
+{
+    return this->mBarrierCount;
+}
+
+}
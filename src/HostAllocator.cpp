@@ -0,0 +1,308 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include "kompute/HostAllocator.hpp"
+
+namespace kp {
+
+/**
+ * Stored right before the memory returned to the driver, to know how to free
+ * it and how many bytes it holds.
+ */
+struct HostAllocator::Header
+{
+    void* block; ///< Start of the memory obtained, freed with it
+    size_t size; ///< Size requested by the driver
+    bool arena;  ///< Whether the memory is in the arena
+};
+
+static size_t
+alignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+HostAllocator::HostAllocator(size_t arenaSize)
+{
+    KP_LOG_DEBUG("Kompute HostAllocator constructor with arena of {} bytes",
+                 arenaSize);
+
+    this->mCallbacks =
+      vk::AllocationCallbacks(this,
+                              &HostAllocator::allocateCallback,
+                              &HostAllocator::reallocateCallback,
+                              &HostAllocator::freeCallback,
+                              &HostAllocator::internalAllocationCallback,
+                              &HostAllocator::internalFreeCallback);
+    this->mArena.resize(arenaSize);
+}
+
+HostAllocator::HostAllocator(const vk::AllocationCallbacks& callbacks,
+                             size_t arenaSize)
+  : HostAllocator(arenaSize)
+{
+    if (!callbacks.pfnAllocation || !callbacks.pfnFree) {
+        throw std::runtime_error(
+          "Kompute HostAllocator callbacks require allocation and free");
+    }
+
+    this->mUpstream = callbacks;
+    this->mHasUpstream = true;
+}
+
+HostAllocator::~HostAllocator()
+{
+    KP_LOG_DEBUG("Kompute HostAllocator destructor");
+
+    if (this->mLiveBytes.load()) {
+        KP_LOG_WARN("Kompute HostAllocator destroyed with {} bytes still "
+                    "allocated",
+                    this->mLiveBytes.load());
+    }
+}
+
+const vk::AllocationCallbacks&
+HostAllocator::allocationCallbacks() const
+{
+    return this->mCallbacks;
+}
+
+vk::Optional<const vk::AllocationCallbacks>
+HostAllocator::callbacks(const std::shared_ptr<HostAllocator>& hostAllocator)
+{
+    if (!hostAllocator) {
+        return nullptr;
+    }
+    return hostAllocator->allocationCallbacks();
+}
+
+HostAllocator::Stats
+HostAllocator::stats() const
+{
+    Stats stats;
+    stats.allocations = this->mAllocations.load(std::memory_order_relaxed);
+    stats.frees = this->mFrees.load(std::memory_order_relaxed);
+    stats.arenaAllocations =
+      this->mArenaAllocations.load(std::memory_order_relaxed);
+    stats.liveBytes = this->mLiveBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = this->mPeakBytes.load(std::memory_order_relaxed);
+    stats.totalBytes = this->mTotalBytes.load(std::memory_order_relaxed);
+    stats.internalAllocations =
+      this->mInternalAllocations.load(std::memory_order_relaxed);
+    stats.internalBytes = this->mInternalBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void
+HostAllocator::resetStats()
+{
+    KP_LOG_DEBUG("Kompute HostAllocator reset stats");
+
+    this->mAllocations.store(0, std::memory_order_relaxed);
+    this->mFrees.store(0, std::memory_order_relaxed);
+    this->mArenaAllocations.store(0, std::memory_order_relaxed);
+    this->mTotalBytes.store(0, std::memory_order_relaxed);
+    this->mInternalAllocations.store(0, std::memory_order_relaxed);
+    this->mPeakBytes.store(this->mLiveBytes.load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
+}
+
+void*
+HostAllocator::allocate(size_t size,
+                        size_t alignment,
+                        VkSystemAllocationScope allocationScope)
+{
+    // The header is placed right before the memory returned, which keeps the
+    // alignment requested by the driver
+    alignment = std::max(alignment, alignof(Header));
+    size_t headerSize = alignUp(sizeof(Header), alignment);
+
+    void* block = nullptr;
+    char* base = nullptr;
+    bool arena = false;
+
+    if (allocationScope == VK_SYSTEM_ALLOCATION_SCOPE_COMMAND &&
+        !this->mArena.empty()) {
+        base = (char*)this->allocateArena(headerSize + size, alignment);
+        block = base;
+        arena = base != nullptr;
+    }
+    if (!block && this->mHasUpstream) {
+        block = this->mUpstream.pfnAllocation(this->mUpstream.pUserData,
+                                              headerSize + size,
+                                              alignment,
+                                              allocationScope);
+        base = (char*)block;
+    } else if (!block) {
+        block = std::malloc(headerSize + size + alignment - 1);
+        base = (char*)alignUp((size_t)block, alignment);
+    }
+    if (!block) {
+        return nullptr;
+    }
+
+    char* memory = base + headerSize;
+    Header* header = (Header*)(memory - sizeof(Header));
+    header->block = block;
+    header->size = size;
+    header->arena = arena;
+
+    this->mAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (arena) {
+        this->mArenaAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    this->mTotalBytes.fetch_add(size, std::memory_order_relaxed);
+    uint64_t liveBytes =
+      this->mLiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    uint64_t peakBytes = this->mPeakBytes.load(std::memory_order_relaxed);
+    while (liveBytes > peakBytes &&
+           !this->mPeakBytes.compare_exchange_weak(
+             peakBytes, liveBytes, std::memory_order_relaxed)) {
+    }
+
+    return memory;
+}
+
+void*
+HostAllocator::reallocate(void* original,
+                          size_t size,
+                          size_t alignment,
+                          VkSystemAllocationScope allocationScope)
+{
+    if (!original) {
+        return this->allocate(size, alignment, allocationScope);
+    }
+    if (size == 0) {
+        this->deallocate(original);
+        return nullptr;
+    }
+
+    // The original is left untouched when the allocation fails, as required
+    // by the specification
+    void* memory = this->allocate(size, alignment, allocationScope);
+    if (!memory) {
+        return nullptr;
+    }
+
+    Header* header = (Header*)((char*)original - sizeof(Header));
+    std::memcpy(memory, original, std::min(size, header->size));
+    this->deallocate(original);
+
+    return memory;
+}
+
+void
+HostAllocator::deallocate(void* memory)
+{
+    if (!memory) {
+        return;
+    }
+
+    Header* header = (Header*)((char*)memory - sizeof(Header));
+
+    this->mFrees.fetch_add(1, std::memory_order_relaxed);
+    this->mLiveBytes.fetch_sub(header->size, std::memory_order_relaxed);
+
+    if (header->arena) {
+        // The arena is rewound once all its allocations are freed, which
+        // happens at the end of every command using it
+        std::lock_guard<std::mutex> lock(this->mArenaMutex);
+        this->mArenaLiveCount--;
+        if (this->mArenaLiveCount == 0) {
+            this->mArenaOffset = 0;
+        }
+    } else if (this->mHasUpstream) {
+        this->mUpstream.pfnFree(this->mUpstream.pUserData, header->block);
+    } else {
+        std::free(header->block);
+    }
+}
+
+void*
+HostAllocator::allocateArena(size_t size, size_t alignment)
+{
+    std::lock_guard<std::mutex> lock(this->mArenaMutex);
+
+    size_t start = (size_t)this->mArena.data();
+    size_t offset = alignUp(start + this->mArenaOffset, alignment) - start;
+    if (offset + size > this->mArena.size()) {
+        return nullptr;
+    }
+
+    this->mArenaOffset = offset + size;
+    this->mArenaLiveCount++;
+    return this->mArena.data() + offset;
+}
+
+void*
+HostAllocator::allocateCallback(void* userData,
+                                size_t size,
+                                size_t alignment,
+                                VkSystemAllocationScope allocationScope)
+{
+    return ((HostAllocator*)userData)
+      ->allocate(size, alignment, allocationScope);
+}
+
+void*
+HostAllocator::reallocateCallback(void* userData,
+                                  void* original,
+                                  size_t size,
+                                  size_t alignment,
+                                  VkSystemAllocationScope allocationScope)
+{
+    return ((HostAllocator*)userData)
+      ->reallocate(original, size, alignment, allocationScope);
+}
+
+void
+HostAllocator::freeCallback(void* userData, void* memory)
+{
+    ((HostAllocator*)userData)->deallocate(memory);
+}
+
+void
+HostAllocator::internalAllocationCallback(
+  void* userData,
+  size_t size,
+  VkInternalAllocationType allocationType,
+  VkSystemAllocationScope allocationScope)
+{
+    HostAllocator* hostAllocator = (HostAllocator*)userData;
+    hostAllocator->mInternalAllocations.fetch_add(1,
+                                                  std::memory_order_relaxed);
+    hostAllocator->mInternalBytes.fetch_add(size, std::memory_order_relaxed);
+
+    if (hostAllocator->mHasUpstream &&
+        hostAllocator->mUpstream.pfnInternalAllocation) {
+        hostAllocator->mUpstream.pfnInternalAllocation(
+          hostAllocator->mUpstream.pUserData,
+          size,
+          allocationType,
+          allocationScope);
+    }
+}
+
+void
+HostAllocator::internalFreeCallback(void* userData,
+                                    size_t size,
+                                    VkInternalAllocationType allocationType,
+                                    VkSystemAllocationScope allocationScope)
+{
+    HostAllocator* hostAllocator = (HostAllocator*)userData;
+    hostAllocator->mInternalBytes.fetch_sub(size, std::memory_order_relaxed);
+
+    if (hostAllocator->mHasUpstream &&
+        hostAllocator->mUpstream.pfnInternalFree) {
+        hostAllocator->mUpstream.pfnInternalFree(
+          hostAllocator->mUpstream.pUserData,
+          size,
+          allocationType,
+          allocationScope);
+    }
+}
+
+}
@@ -1,11 +1,17 @@
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iterator>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
 
 #include "kompute/Manager.hpp"
+#include "kompute/operations/OpTensorFill.hpp"
 
 #include "fmt/ranges.h"
 
@@ -35,24 +41,88 @@ Manager::Manager()
 
 Manager::Manager(uint32_t physicalDeviceIndex,
                  const std::vector<uint32_t>& familyQueueIndices,
-                 const std::vector<std::string>& desiredExtensions)
+                 const std::vector<std::string>& desiredExtensions,
+                 const std::string& pipelineCachePath,
+                 const std::vector<QueuePriority>& queuePriorities,
+                 std::shared_ptr<HostAllocator> hostAllocator)
 {
     this->mManageResources = true;
+    this->mHostAllocator = hostAllocator;
 
     this->createInstance();
-    this->createDevice(
-      familyQueueIndices, physicalDeviceIndex, desiredExtensions);
+    this->createDevice(familyQueueIndices,
+                       physicalDeviceIndex,
+                       desiredExtensions,
+                       queuePriorities);
+    this->createPipelineCache(pipelineCachePath);
+    this->updateDefaultLocalSize();
+    this->mShaderCache =
+      std::make_shared<ShaderCache>(this->mDevice, this->mHostAllocator);
+    this->mDescriptorAllocator = std::make_shared<DescriptorAllocator>(
+      this->mDevice, this->mHostAllocator);
+}
+
+Manager::Manager(const DeviceRequirements& requirements,
+                 const std::vector<uint32_t>& familyQueueIndices,
+                 const std::vector<std::string>& desiredExtensions,
+                 const std::string& pipelineCachePath,
+                 const std::vector<QueuePriority>& queuePriorities,
+                 std::shared_ptr<HostAllocator> hostAllocator)
+{
+    this->mManageResources = true;
+    this->mHostAllocator = hostAllocator;
+
+    this->createInstance();
+
+    std::vector<std::string> extensions = requirements.extensions;
+    for (const std::string& ext : desiredExtensions) {
+        if (std::find(extensions.begin(), extensions.end(), ext) ==
+            extensions.end()) {
+            extensions.push_back(ext);
+        }
+    }
+
+    this->createDevice(familyQueueIndices,
+                       this->selectDevice(requirements),
+                       extensions,
+                       queuePriorities);
+    this->createPipelineCache(pipelineCachePath);
+    this->updateDefaultLocalSize();
+    this->mShaderCache =
+      std::make_shared<ShaderCache>(this->mDevice, this->mHostAllocator);
+    this->mDescriptorAllocator = std::make_shared<DescriptorAllocator>(
+      this->mDevice, this->mHostAllocator);
 }
 
 Manager::Manager(std::shared_ptr<vk::Instance> instance,
                  std::shared_ptr<vk::PhysicalDevice> physicalDevice,
-                 std::shared_ptr<vk::Device> device)
+                 std::shared_ptr<vk::Device> device,
+                 const std::string& pipelineCachePath,
+                 std::shared_ptr<HostAllocator> hostAllocator,
+                 const vk::PhysicalDeviceFeatures& enabledFeatures)
 {
     this->mManageResources = false;
+    this->mHostAllocator = hostAllocator;
 
     this->mInstance = instance;
     this->mPhysicalDevice = physicalDevice;
     this->mDevice = device;
+    this->mDeviceInfo = std::make_shared<DeviceInfo>(*this->mPhysicalDevice);
+    this->mDeviceInfo->setEnabledFeatures(enabledFeatures);
+
+    this->mMemoryPool =
+      std::make_shared<MemoryPool>(this->mPhysicalDevice,
+                                   this->mDevice,
+                                   KOMPUTE_MEMORY_POOL_BLOCK_SIZE,
+                                   this->mHostAllocator,
+                                   this->mDeviceInfo);
+
+    this->createPipelineCache(pipelineCachePath);
+    this->updateDefaultLocalSize();
+    this->mShaderCache =
+      std::make_shared<ShaderCache>(this->mDevice, this->mHostAllocator);
+    this->mDescriptorAllocator = std::make_shared<DescriptorAllocator>(
+      this->mDevice, this->mHostAllocator);
 }
 
 Manager::~Manager()
@@ -73,42 +143,121 @@ Manager::destroy()
         return;
     }
 
-    if (this->mManageResources && this->mManagedSequences.size()) {
+    // Pending completions still use the sequences
+    if (this->mCompletionWaiter) {
+        KP_LOG_DEBUG("Kompute Manager destroying completion waiter");
+        this->mCompletionWaiter->destroy();
+        this->mCompletionWaiter = nullptr;
+    }
+
+    if (this->mManageResources) {
         KP_LOG_DEBUG("Kompute Manager explicitly running destructor for "
                      "managed sequences");
-        for (const std::weak_ptr<Sequence>& weakSq : this->mManagedSequences) {
-            if (std::shared_ptr<Sequence> sq = weakSq.lock()) {
-                sq->destroy();
-            }
+        for (const std::shared_ptr<Sequence>& sq :
+             this->mManagedSequences->take()) {
+            sq->destroy();
         }
-        this->mManagedSequences.clear();
     }
 
-    if (this->mManageResources && this->mManagedAlgorithms.size()) {
+    // Blocks are destroyed once the sequences executing them have completed
+    if (this->mManageResources) {
+        KP_LOG_DEBUG("Kompute Manager explicitly running destructor for "
+                     "managed blocks");
+        for (const std::shared_ptr<Block>& block :
+             this->mManagedBlocks->take()) {
+            block->destroy();
+        }
+    }
+
+    // Command buffers of sequences still alive are freed with their pool
+    if (this->mSharedCommandPools.size()) {
+        KP_LOG_DEBUG("Kompute Manager destroying shared command pools");
+        for (const auto& sharedCommandPool : this->mSharedCommandPools) {
+            this->mDevice->destroy(
+              *sharedCommandPool.second,
+              HostAllocator::callbacks(this->mHostAllocator));
+        }
+        this->mSharedCommandPools.clear();
+    }
+
+    if (this->mManageResources) {
         KP_LOG_DEBUG("Kompute Manager explicitly freeing algorithms");
-        for (const std::weak_ptr<Algorithm>& weakAlgorithm :
-             this->mManagedAlgorithms) {
-            if (std::shared_ptr<Algorithm> algorithm = weakAlgorithm.lock()) {
-                algorithm->destroy();
-            }
+        for (const std::shared_ptr<Algorithm>& algorithm :
+             this->mManagedAlgorithms->take()) {
+            algorithm->destroy();
+        }
+    }
+
+    // Destroyed algorithms have waited for their builds, the others are
+    // completed before the worker threads stop
+    if (this->mWorkerPool) {
+        KP_LOG_DEBUG("Kompute Manager destroying worker pool");
+        this->mWorkerPool->destroy();
+        this->mWorkerPool = nullptr;
+    }
+
+    // Unmanaged algorithms keep the shader cache alive until destroyed
+    if (this->mShaderCache) {
+        if (this->mManageResources) {
+            KP_LOG_DEBUG("Kompute Manager destroying shader cache");
+            this->mShaderCache->destroy();
+        }
+        this->mShaderCache = nullptr;
+    }
+
+    if (this->mDescriptorAllocator) {
+        if (this->mManageResources) {
+            KP_LOG_DEBUG("Kompute Manager destroying descriptor allocator");
+            this->mDescriptorAllocator->destroy();
         }
-        this->mManagedAlgorithms.clear();
+        this->mDescriptorAllocator = nullptr;
     }
 
-    if (this->mManageResources && this->mManagedTensors.size()) {
+    // Pipelines created from the cache remain valid after it is destroyed
+    if (this->mPipelineCache) {
+        KP_LOG_DEBUG("Kompute Manager destroying pipeline cache");
+        this->mDevice->destroy(
+          *this->mPipelineCache,
+          HostAllocator::callbacks(this->mHostAllocator));
+        this->mPipelineCache = nullptr;
+    }
+
+    if (this->mManageResources) {
         KP_LOG_DEBUG("Kompute Manager explicitly freeing tensors");
-        for (const std::weak_ptr<Tensor>& weakTensor : this->mManagedTensors) {
-            if (std::shared_ptr<Tensor> tensor = weakTensor.lock()) {
-                tensor->destroy();
-            }
+        std::vector<std::shared_ptr<Tensor>> tensors =
+          this->mManagedTensors->take();
+        // Parents destroy their live views, so views are released first
+        std::stable_partition(tensors.begin(),
+                              tensors.end(),
+                              [](const std::shared_ptr<Tensor>& tensor) {
+                                  return tensor->isView();
+                              });
+        for (const std::shared_ptr<Tensor>& tensor : tensors) {
+            tensor->destroy();
+        }
+    }
+
+    if (this->mStagingRing) {
+        if (this->mManageResources) {
+            KP_LOG_DEBUG("Kompute Manager destroying staging ring");
+            this->mStagingRing->destroy();
+        }
+        this->mStagingRing = nullptr;
+    }
+
+    // Unmanaged tensors keep the pool alive until they are destroyed
+    if (this->mMemoryPool) {
+        if (this->mManageResources) {
+            KP_LOG_DEBUG("Kompute Manager destroying memory pool");
+            this->mMemoryPool->destroy();
         }
-        this->mManagedTensors.clear();
+        this->mMemoryPool = nullptr;
     }
 
     if (this->mFreeDevice) {
         KP_LOG_INFO("Destroying device");
         this->mDevice->destroy(
-          (vk::Optional<const vk::AllocationCallbacks>)nullptr);
+          HostAllocator::callbacks(this->mHostAllocator));
         this->mDevice = nullptr;
         KP_LOG_DEBUG("Kompute Manager Destroyed Device");
     }
@@ -123,7 +272,9 @@ Manager::destroy()
 #ifndef KOMPUTE_DISABLE_VK_DEBUG_LAYERS
     if (this->mDebugReportCallback) {
         this->mInstance->destroyDebugReportCallbackEXT(
-          this->mDebugReportCallback, nullptr, this->mDebugDispatcher);
+          this->mDebugReportCallback,
+          HostAllocator::callbacks(this->mHostAllocator),
+          this->mDebugDispatcher);
         KP_LOG_DEBUG("Kompute Manager Destroyed Debug Report Callback");
     }
 #endif
@@ -131,19 +282,47 @@ Manager::destroy()
 
     if (this->mFreeInstance) {
         this->mInstance->destroy(
-          (vk::Optional<const vk::AllocationCallbacks>)nullptr);
+          HostAllocator::callbacks(this->mHostAllocator));
         this->mInstance = nullptr;
         KP_LOG_DEBUG("Kompute Manager Destroyed Instance");
+    } else if (this->mManageResources) {
+        // The shared instance is destroyed once no manager holds it
+        this->mInstance = nullptr;
+        KP_LOG_DEBUG("Kompute Manager Released shared Instance");
     }
 }
 
+// Instance of the managers created without host allocator, so that only the
+// first of them creates it, which is destroyed along with the last of them
+static std::mutex sharedInstanceMutex;
+static std::weak_ptr<vk::Instance> sharedInstance;
+static bool sharedInstanceDebugUtils = false;
+static bool sharedInstanceValidationLayers = false;
+
 void
 Manager::createInstance()
 {
 
     KP_LOG_DEBUG("Kompute Manager creating instance");
 
-    this->mFreeInstance = true;
+    // Instances created with host allocation callbacks must be destroyed with
+    // the same callbacks, so they are not shared
+    bool shared = !this->mHostAllocator;
+    std::unique_lock<std::mutex> lock(sharedInstanceMutex, std::defer_lock);
+    if (shared) {
+        lock.lock();
+        this->mInstance = sharedInstance.lock();
+        if (this->mInstance) {
+            KP_LOG_DEBUG("Kompute Manager reusing shared instance");
+            this->mFreeInstance = false;
+            this->createInstanceDebug(sharedInstanceDebugUtils,
+                                      sharedInstanceValidationLayers);
+            return;
+        }
+    }
+
+    this->mFreeInstance = !shared;
+    bool validationLayers = false;
 
     vk::ApplicationInfo applicationInfo;
     applicationInfo.pApplicationName = "Kompute";
@@ -156,7 +335,32 @@ Manager::createInstance()
 
 #if DEBUG
     applicationExtensions.push_back(VK_EXT_DEBUG_REPORT_EXTENSION_NAME);
+    bool debugUtils = true;
+#else
+    const char* envDebugUtils = std::getenv("KOMPUTE_ENV_DEBUG_UTILS");
+    bool debugUtils = envDebugUtils != NULL && *envDebugUtils != '\0' &&
+                      std::strcmp(envDebugUtils, "0") != 0;
 #endif
+    // Names and labels are only seen by tools such as RenderDoc and Nsight,
+    // so the extension is skipped without failing when it is not supported
+    if (debugUtils) {
+        debugUtils = false;
+        for (const vk::ExtensionProperties& extension :
+             vk::enumerateInstanceExtensionProperties()) {
+            if (std::string(extension.extensionName.data()) ==
+                VK_EXT_DEBUG_UTILS_EXTENSION_NAME) {
+                debugUtils = true;
+                break;
+            }
+        }
+        if (debugUtils) {
+            KP_LOG_DEBUG("Kompute Manager enabling VK_EXT_debug_utils");
+            applicationExtensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+        } else {
+            KP_LOG_WARN("Kompute Manager VK_EXT_debug_utils not supported, "
+                        "objects will not be named");
+        }
+    }
 
     vk::InstanceCreateInfo computeInstanceCreateInfo;
     computeInstanceCreateInfo.pApplicationInfo = &applicationInfo;
@@ -212,6 +416,7 @@ Manager::createInstance()
         KP_LOG_DEBUG(
           "Kompute Manager Initializing instance with valid layers: {}",
           validLayerNames);
+        validationLayers = true;
         computeInstanceCreateInfo.enabledLayerCount =
           (uint32_t)validLayerNames.size();
         computeInstanceCreateInfo.ppEnabledLayerNames = validLayerNames.data();
@@ -222,15 +427,42 @@ Manager::createInstance()
 #endif
 #endif
 
-    this->mInstance = std::make_shared<vk::Instance>();
-    vk::createInstance(
-      &computeInstanceCreateInfo, nullptr, this->mInstance.get());
+    vk::Instance instance;
+    vk::createInstance(&computeInstanceCreateInfo,
+                       HostAllocator::callbacks(this->mHostAllocator),
+                       &instance);
+    if (shared) {
+        this->mInstance = std::shared_ptr<vk::Instance>(
+          new vk::Instance(instance), [](vk::Instance* instance) {
+              instance->destroy();
+              delete instance;
+              KP_LOG_DEBUG("Kompute Manager Destroyed shared Instance");
+          });
+        sharedInstance = this->mInstance;
+        sharedInstanceDebugUtils = debugUtils;
+        sharedInstanceValidationLayers = validationLayers;
+    } else {
+        this->mInstance = std::make_shared<vk::Instance>(instance);
+    }
     KP_LOG_DEBUG("Kompute Manager Instance Created");
 
+    this->createInstanceDebug(debugUtils, validationLayers);
+}
+
+void
+Manager::createInstanceDebug(bool debugUtils, bool validationLayers)
+{
+    if (debugUtils) {
+        this->mDebugUtils = std::make_shared<DebugUtils>(*this->mInstance);
+        if (!this->mDebugUtils->isValid()) {
+            this->mDebugUtils = nullptr;
+        }
+    }
+
 #if DEBUG
 #ifndef KOMPUTE_DISABLE_VK_DEBUG_LAYERS
     KP_LOG_DEBUG("Kompute Manager adding debug callbacks");
-    if (validLayerNames.size() > 0) {
+    if (validationLayers) {
         vk::DebugReportFlagsEXT debugFlags =
           vk::DebugReportFlagBitsEXT::eError |
           vk::DebugReportFlagBitsEXT::eWarning;
@@ -242,7 +474,9 @@ Manager::createInstance()
         this->mDebugDispatcher.init(*this->mInstance, &vkGetInstanceProcAddr);
         this->mDebugReportCallback =
           this->mInstance->createDebugReportCallbackEXT(
-            debugCreateInfo, nullptr, this->mDebugDispatcher);
+            debugCreateInfo,
+            HostAllocator::callbacks(this->mHostAllocator),
+            this->mDebugDispatcher);
     }
 #endif
 #endif
@@ -251,30 +485,17 @@ Manager::createInstance()
 void
 Manager::clear()
 {
-    if (this->mManageResources) {
-        this->mManagedTensors.erase(
-          std::remove_if(begin(this->mManagedTensors),
-                         end(this->mManagedTensors),
-                         [](std::weak_ptr<Tensor> t) { return t.expired(); }),
-          end(this->mManagedTensors));
-        this->mManagedAlgorithms.erase(
-          std::remove_if(
-            begin(this->mManagedAlgorithms),
-            end(this->mManagedAlgorithms),
-            [](std::weak_ptr<Algorithm> t) { return t.expired(); }),
-          end(this->mManagedAlgorithms));
-        this->mManagedSequences.erase(
-          std::remove_if(begin(this->mManagedSequences),
-                         end(this->mManagedSequences),
-                         [](std::weak_ptr<Sequence> t) { return t.expired(); }),
-          end(this->mManagedSequences));
+    // Released resources have already removed themselves from the registries
+    if (this->mShaderCache) {
+        this->mShaderCache->prune();
     }
 }
 
 void
 Manager::createDevice(const std::vector<uint32_t>& familyQueueIndices,
                       uint32_t physicalDeviceIndex,
-                      const std::vector<std::string>& desiredExtensions)
+                      const std::vector<std::string>& desiredExtensions,
+                      const std::vector<QueuePriority>& queuePriorities)
 {
 
     KP_LOG_DEBUG("Kompute Manager creating Device");
@@ -315,28 +536,39 @@ Manager::createDevice(const std::vector<uint32_t>& familyQueueIndices,
 
     this->mPhysicalDevice =
       std::make_shared<vk::PhysicalDevice>(physicalDevice);
+    this->mDeviceInfo = std::make_shared<DeviceInfo>(physicalDevice);
 
-    vk::PhysicalDeviceProperties physicalDeviceProperties =
-      physicalDevice.getProperties();
+    const vk::PhysicalDeviceProperties& physicalDeviceProperties =
+      this->mDeviceInfo->properties();
 
     KP_LOG_INFO("Using physical device index {} found {}",
                 physicalDeviceIndex,
                 physicalDeviceProperties.deviceName);
 
-    if (!familyQueueIndices.size()) {
-        // Find compute queue
-        std::vector<vk::QueueFamilyProperties> allQueueFamilyProperties =
-          physicalDevice.getQueueFamilyProperties();
+    const std::vector<vk::QueueFamilyProperties>& allQueueFamilyProperties =
+      this->mDeviceInfo->queueFamilyProperties();
 
-        uint32_t computeQueueFamilyIndex = -1;
+    if (!familyQueueIndices.size()) {
+        // The first compute family is usually the graphics and compute
+        // family, while a compute family without graphics and a transfer
+        // only family run on separate hardware queues alongside it
+        int32_t computeQueueFamilyIndex = -1;
+        int32_t asyncComputeQueueFamilyIndex = -1;
+        int32_t transferQueueFamilyIndex = -1;
         for (uint32_t i = 0; i < allQueueFamilyProperties.size(); i++) {
-            vk::QueueFamilyProperties queueFamilyProperties =
-              allQueueFamilyProperties[i];
-
-            if (queueFamilyProperties.queueFlags &
-                vk::QueueFlagBits::eCompute) {
-                computeQueueFamilyIndex = i;
-                break;
+            vk::QueueFlags queueFlags = allQueueFamilyProperties[i].queueFlags;
+
+            if (queueFlags & vk::QueueFlagBits::eCompute) {
+                if (computeQueueFamilyIndex < 0) {
+                    computeQueueFamilyIndex = i;
+                } else if (asyncComputeQueueFamilyIndex < 0 &&
+                           !(queueFlags & vk::QueueFlagBits::eGraphics)) {
+                    asyncComputeQueueFamilyIndex = i;
+                }
+            } else if (transferQueueFamilyIndex < 0 &&
+                       (queueFlags & vk::QueueFlagBits::eTransfer) &&
+                       !(queueFlags & vk::QueueFlagBits::eGraphics)) {
+                transferQueueFamilyIndex = i;
             }
         }
 
@@ -345,15 +577,122 @@ Manager::createDevice(const std::vector<uint32_t>& familyQueueIndices,
         }
 
         this->mComputeQueueFamilyIndices.push_back(computeQueueFamilyIndex);
+        if (asyncComputeQueueFamilyIndex >= 0) {
+            this->mComputeQueueFamilyIndices.push_back(
+              asyncComputeQueueFamilyIndex);
+        }
+        if (transferQueueFamilyIndex >= 0) {
+            this->mComputeQueueFamilyIndices.push_back(
+              transferQueueFamilyIndex);
+        }
     } else {
         this->mComputeQueueFamilyIndices = familyQueueIndices;
     }
 
+    // The roles are assigned from the queues requested, so they also apply
+    // to the family indices passed explicitly
+    for (uint32_t i = this->mComputeQueueFamilyIndices.size(); i-- > 0;) {
+        uint32_t familyIndex = this->mComputeQueueFamilyIndices[i];
+        if (familyIndex >= allQueueFamilyProperties.size()) {
+            throw std::runtime_error(fmt::format(
+              "Kompute Manager queue family index {} out of range",
+              familyIndex));
+        }
+        vk::QueueFlags queueFlags =
+          allQueueFamilyProperties[familyIndex].queueFlags;
+        if (queueFlags & vk::QueueFlagBits::eCompute) {
+            this->mQueueRoleIndices[(uint32_t)QueueRole::eCompute] = i;
+        }
+    }
+    uint32_t computeFamilyIndex = this->mComputeQueueFamilyIndices
+      [this->mQueueRoleIndices[(uint32_t)QueueRole::eCompute]];
+    this->mQueueRoleIndices[(uint32_t)QueueRole::eAsyncCompute] =
+      this->mQueueRoleIndices[(uint32_t)QueueRole::eCompute];
+    this->mQueueRoleIndices[(uint32_t)QueueRole::eTransfer] =
+      this->mQueueRoleIndices[(uint32_t)QueueRole::eCompute];
+    for (uint32_t i = this->mComputeQueueFamilyIndices.size(); i-- > 0;) {
+        uint32_t familyIndex = this->mComputeQueueFamilyIndices[i];
+        vk::QueueFlags queueFlags =
+          allQueueFamilyProperties[familyIndex].queueFlags;
+        if (familyIndex == computeFamilyIndex ||
+            (queueFlags & vk::QueueFlagBits::eGraphics)) {
+            continue;
+        }
+        if (queueFlags & vk::QueueFlagBits::eCompute) {
+            this->mQueueRoleIndices[(uint32_t)QueueRole::eAsyncCompute] = i;
+        } else if (queueFlags & vk::QueueFlagBits::eTransfer) {
+            this->mQueueRoleIndices[(uint32_t)QueueRole::eTransfer] = i;
+        }
+    }
+
+    if (queuePriorities.empty()) {
+        this->mQueuePriorities.assign(this->mComputeQueueFamilyIndices.size(),
+                                      QueuePriority());
+    } else if (queuePriorities.size() ==
+               this->mComputeQueueFamilyIndices.size()) {
+        this->mQueuePriorities = queuePriorities;
+    } else {
+        throw std::runtime_error(
+          fmt::format("Kompute Manager got {} queue priorities for {} queues",
+                      queuePriorities.size(),
+                      this->mComputeQueueFamilyIndices.size()));
+    }
+
+    // The high priority role goes to the compute queue with the highest
+    // global priority, then the highest priority, and to the compute queue
+    // when they are all equal
+    uint32_t highPriorityIndex =
+      this->mQueueRoleIndices[(uint32_t)QueueRole::eCompute];
+    for (uint32_t i = 0; i < this->mQueuePriorities.size(); i++) {
+        const QueuePriority& queuePriority = this->mQueuePriorities[i];
+        if (queuePriority.priority < 0.0f || queuePriority.priority > 1.0f) {
+            throw std::runtime_error(fmt::format(
+              "Kompute Manager queue {} priority {} is not between 0 and 1",
+              i,
+              queuePriority.priority));
+        }
+        const QueuePriority& highPriority =
+          this->mQueuePriorities[highPriorityIndex];
+        vk::QueueFlags queueFlags =
+          allQueueFamilyProperties[this->mComputeQueueFamilyIndices[i]]
+            .queueFlags;
+        if ((queueFlags & vk::QueueFlagBits::eCompute) &&
+            ((uint32_t)queuePriority.globalPriority >
+               (uint32_t)highPriority.globalPriority ||
+             ((uint32_t)queuePriority.globalPriority ==
+                (uint32_t)highPriority.globalPriority &&
+              queuePriority.priority > highPriority.priority))) {
+            highPriorityIndex = i;
+        }
+    }
+    this->mQueueRoleIndices[(uint32_t)QueueRole::eHighPriority] =
+      highPriorityIndex;
+
+    KP_LOG_INFO("Kompute Manager queue families {} with compute queue {} "
+                "async compute queue {} transfer queue {} high priority "
+                "queue {}",
+                this->mComputeQueueFamilyIndices,
+                this->mQueueRoleIndices[(uint32_t)QueueRole::eCompute],
+                this->mQueueRoleIndices[(uint32_t)QueueRole::eAsyncCompute],
+                this->mQueueRoleIndices[(uint32_t)QueueRole::eTransfer],
+                this->mQueueRoleIndices[(uint32_t)QueueRole::eHighPriority]);
+
     std::unordered_map<uint32_t, uint32_t> familyQueueCounts;
     std::unordered_map<uint32_t, std::vector<float>> familyQueuePriorities;
-    for (const auto& value : this->mComputeQueueFamilyIndices) {
-        familyQueueCounts[value]++;
-        familyQueuePriorities[value].push_back(1.0f);
+    std::unordered_map<uint32_t, vk::QueueGlobalPriorityEXT>
+      familyGlobalPriorities;
+    for (uint32_t i = 0; i < this->mComputeQueueFamilyIndices.size(); i++) {
+        uint32_t familyIndex = this->mComputeQueueFamilyIndices[i];
+        const QueuePriority& queuePriority = this->mQueuePriorities[i];
+        familyQueueCounts[familyIndex]++;
+        familyQueuePriorities[familyIndex].push_back(queuePriority.priority);
+        auto globalPriority = familyGlobalPriorities.find(familyIndex);
+        if (globalPriority == familyGlobalPriorities.end()) {
+            familyGlobalPriorities[familyIndex] = queuePriority.globalPriority;
+        } else if ((uint32_t)queuePriority.globalPriority >
+                   (uint32_t)globalPriority->second) {
+            globalPriority->second = queuePriority.globalPriority;
+        }
     }
 
     std::unordered_map<uint32_t, uint32_t> familyQueueIndexCount;
@@ -394,6 +733,75 @@ Manager::createDevice(const std::vector<uint32_t>& familyQueueIndices,
                      validExtensions);
     }
 
+    // Narrow tensor data types are accessed by shaders through the 8 and 16
+    // bit storage features, which are promoted to the core of newer devices
+    // and otherwise require their extensions
+    bool storage16BitAvailable =
+      physicalDeviceProperties.apiVersion >= VK_API_VERSION_1_1 ||
+      uniqueExtensionNames.count(VK_KHR_16BIT_STORAGE_EXTENSION_NAME);
+    bool storage8BitAvailable =
+      physicalDeviceProperties.apiVersion >= VK_API_VERSION_1_2 ||
+      uniqueExtensionNames.count(VK_KHR_8BIT_STORAGE_EXTENSION_NAME);
+    bool float16Int8Available =
+      physicalDeviceProperties.apiVersion >= VK_API_VERSION_1_2 ||
+      uniqueExtensionNames.count(VK_KHR_SHADER_FLOAT16_INT8_EXTENSION_NAME);
+
+    vk::PhysicalDevice16BitStorageFeatures storage16BitFeatures;
+    vk::PhysicalDevice8BitStorageFeatures storage8BitFeatures;
+    vk::PhysicalDeviceShaderFloat16Int8Features float16Int8Features;
+    vk::PhysicalDeviceFeatures2 features;
+    void** featuresNext = &features.pNext;
+    if (storage16BitAvailable) {
+        *featuresNext = &storage16BitFeatures;
+        featuresNext = &storage16BitFeatures.pNext;
+    }
+    if (storage8BitAvailable) {
+        *featuresNext = &storage8BitFeatures;
+        featuresNext = &storage8BitFeatures.pNext;
+    }
+    if (float16Int8Available) {
+        *featuresNext = &float16Int8Features;
+        featuresNext = &float16Int8Features.pNext;
+    }
+    physicalDevice.getFeatures2(&features);
+
+    // Only the narrow type features and the pipeline statistics queries of
+    // the profiling sequences are enabled, the other core features such as
+    // robust buffer access would slow down every shader
+    vk::PhysicalDeviceFeatures2 enabledFeatures;
+    enabledFeatures.features.shaderInt16 = features.features.shaderInt16;
+    enabledFeatures.features.pipelineStatisticsQuery =
+      features.features.pipelineStatisticsQuery;
+    enabledFeatures.pNext = features.pNext;
+    this->mDeviceInfo->setEnabledFeatures(enabledFeatures.features);
+
+    const std::vector<const char*> narrowTypeExtensions = {
+        VK_KHR_16BIT_STORAGE_EXTENSION_NAME,
+        VK_KHR_8BIT_STORAGE_EXTENSION_NAME,
+        VK_KHR_SHADER_FLOAT16_INT8_EXTENSION_NAME,
+    };
+    for (const char* ext : narrowTypeExtensions) {
+        if (physicalDeviceProperties.apiVersion < VK_API_VERSION_1_2 &&
+            uniqueExtensionNames.count(ext) &&
+            std::find_if(validExtensions.begin(),
+                         validExtensions.end(),
+                         [ext](const char* valid) {
+                             return std::string(valid) == ext;
+                         }) == validExtensions.end()) {
+            validExtensions.push_back(ext);
+        }
+    }
+
+    this->mStorage16Bit = storage16BitFeatures.storageBuffer16BitAccess;
+    this->mStorage8Bit = storage8BitFeatures.storageBuffer8BitAccess;
+    KP_LOG_DEBUG("Kompute Manager 16 bit storage {} 8 bit storage {} float16 "
+                 "{} int8 {} int16 {}",
+                 this->mStorage16Bit,
+                 this->mStorage8Bit,
+                 float16Int8Features.shaderFloat16,
+                 float16Int8Features.shaderInt8,
+                 features.features.shaderInt16);
+
     vk::DeviceCreateInfo deviceCreateInfo(vk::DeviceCreateFlags(),
                                           deviceQueueCreateInfos.size(),
                                           deviceQueueCreateInfos.data(),
@@ -401,11 +809,99 @@ Manager::createDevice(const std::vector<uint32_t>& familyQueueIndices,
                                           {},
                                           validExtensions.size(),
                                           validExtensions.data());
+    deviceCreateInfo.setPNext(&enabledFeatures);
+
+    // Timeline semaphores allow sequences to depend on each other on the GPU
+    vk::PhysicalDeviceTimelineSemaphoreFeatures timelineSemaphoreFeatures;
+    for (const char* ext : validExtensions) {
+        if (std::string(ext) == VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME) {
+            timelineSemaphoreFeatures.timelineSemaphore = VK_TRUE;
+            timelineSemaphoreFeatures.pNext = enabledFeatures.pNext;
+            enabledFeatures.pNext = &timelineSemaphoreFeatures;
+            this->mTimelineSemaphores = true;
+        }
+    }
+
+    // Buffer device addresses let algorithms pass tensors to shaders as
+    // pointers instead of through descriptor sets
+    vk::PhysicalDeviceBufferDeviceAddressFeatures bufferDeviceAddressFeatures;
+    for (const char* ext : validExtensions) {
+        if (std::string(ext) == VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME) {
+            bufferDeviceAddressFeatures.bufferDeviceAddress = VK_TRUE;
+            bufferDeviceAddressFeatures.pNext = enabledFeatures.pNext;
+            enabledFeatures.pNext = &bufferDeviceAddressFeatures;
+        }
+    }
+
+    // Global priorities are only chained for the families requesting one
+    // other than the default, as drivers may refuse the higher ones to
+    // processes without the privileges for them
+    const char* globalPriorityExtension = nullptr;
+    if (uniqueExtensionNames.count("VK_KHR_global_priority")) {
+        globalPriorityExtension = "VK_KHR_global_priority";
+    } else if (uniqueExtensionNames.count(
+                 VK_EXT_GLOBAL_PRIORITY_EXTENSION_NAME)) {
+        globalPriorityExtension = VK_EXT_GLOBAL_PRIORITY_EXTENSION_NAME;
+    }
+    std::vector<vk::DeviceQueueGlobalPriorityCreateInfoEXT>
+      globalPriorityInfos;
+    globalPriorityInfos.reserve(deviceQueueCreateInfos.size());
+    for (vk::DeviceQueueCreateInfo& queueCreateInfo : deviceQueueCreateInfos) {
+        vk::QueueGlobalPriorityEXT globalPriority =
+          familyGlobalPriorities[queueCreateInfo.queueFamilyIndex];
+        if (globalPriority == vk::QueueGlobalPriorityEXT::eMedium) {
+            continue;
+        }
+        if (!globalPriorityExtension) {
+            KP_LOG_WARN("Kompute Manager global priority {} of queue family "
+                        "{} ignored as the device does not support it",
+                        vk::to_string(globalPriority),
+                        queueCreateInfo.queueFamilyIndex);
+            continue;
+        }
+        globalPriorityInfos.push_back(
+          vk::DeviceQueueGlobalPriorityCreateInfoEXT(globalPriority));
+        queueCreateInfo.pNext = &globalPriorityInfos.back();
+    }
+    if (globalPriorityInfos.size()) {
+        if (std::find_if(validExtensions.begin(),
+                         validExtensions.end(),
+                         [globalPriorityExtension](const char* valid) {
+                             return std::string(valid) ==
+                                    globalPriorityExtension;
+                         }) == validExtensions.end()) {
+            validExtensions.push_back(globalPriorityExtension);
+        }
+        deviceCreateInfo.setEnabledExtensionCount(validExtensions.size());
+        deviceCreateInfo.setPpEnabledExtensionNames(validExtensions.data());
+        this->mGlobalPriority = true;
+    }
 
     this->mDevice = std::make_shared<vk::Device>();
-    physicalDevice.createDevice(
-      &deviceCreateInfo, nullptr, this->mDevice.get());
-    KP_LOG_DEBUG("Kompute Manager device created");
+    vk::Result result = physicalDevice.createDevice(
+      &deviceCreateInfo,
+      HostAllocator::callbacks(this->mHostAllocator),
+      this->mDevice.get());
+    if (result == vk::Result::eErrorNotPermittedEXT && this->mGlobalPriority) {
+        KP_LOG_WARN("Kompute Manager global priorities not permitted, "
+                    "creating the device without them");
+        for (vk::DeviceQueueCreateInfo& queueCreateInfo :
+             deviceQueueCreateInfos) {
+            queueCreateInfo.pNext = nullptr;
+        }
+        this->mGlobalPriority = false;
+        result = physicalDevice.createDevice(
+          &deviceCreateInfo,
+          HostAllocator::callbacks(this->mHostAllocator),
+          this->mDevice.get());
+    }
+    if (result != vk::Result::eSuccess) {
+        throw std::runtime_error(
+          fmt::format("Kompute Manager failed to create device: {}",
+                      vk::to_string(result)));
+    }
+    KP_LOG_DEBUG("Kompute Manager device created with global priority {}",
+                 this->mGlobalPriority);
 
     for (const uint32_t& familyQueueIndex : this->mComputeQueueFamilyIndices) {
         std::shared_ptr<vk::Queue> currQueue = std::make_shared<vk::Queue>();
@@ -417,34 +913,559 @@ Manager::createDevice(const std::vector<uint32_t>& familyQueueIndices,
         familyQueueIndexCount[familyQueueIndex]++;
 
         this->mComputeQueues.push_back(currQueue);
+        this->mComputeQueueMutexes.push_back(std::make_shared<std::mutex>());
     }
 
     KP_LOG_DEBUG("Kompute Manager compute queue obtained");
+
+    this->mMemoryPool =
+      std::make_shared<MemoryPool>(this->mPhysicalDevice,
+                                   this->mDevice,
+                                   KOMPUTE_MEMORY_POOL_BLOCK_SIZE,
+                                   this->mHostAllocator,
+                                   this->mDeviceInfo);
+
+    for (const char* ext : validExtensions) {
+        if (std::string(ext) == VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME) {
+            this->mMemoryPool->enableHostPointerImport(*this->mInstance);
+        }
+        if (std::string(ext) == VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME) {
+            this->mMemoryPool->enableBufferDeviceAddress(*this->mInstance);
+        }
+        if (std::string(ext) == VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME) {
+            this->mDeviceInfo->setCalibratedTimestamps(
+              this->hasMonotonicTimeDomain());
+        }
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+        if (std::string(ext) ==
+            VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME) {
+            this->mMemoryPool->enableHardwareBufferImport(*this->mInstance);
+        }
+#endif
+    }
+}
+
+bool
+Manager::hasMonotonicTimeDomain()
+{
+    PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT getTimeDomains =
+      (PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT)
+        this->mInstance->getProcAddr(
+          "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
+    if (!getTimeDomains) {
+        return false;
+    }
+
+    uint32_t count = 0;
+    if (getTimeDomains(*this->mPhysicalDevice, &count, nullptr) !=
+        VK_SUCCESS) {
+        return false;
+    }
+    std::vector<VkTimeDomainEXT> timeDomains(count);
+    if (getTimeDomains(*this->mPhysicalDevice, &count, timeDomains.data()) !=
+        VK_SUCCESS) {
+        return false;
+    }
+
+    // Tracing reads both clocks at once to convert device timestamps
+    bool device = std::find(timeDomains.begin(),
+                            timeDomains.end(),
+                            VK_TIME_DOMAIN_DEVICE_EXT) != timeDomains.end();
+    bool monotonic =
+      std::find(timeDomains.begin(),
+                timeDomains.end(),
+                VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT) != timeDomains.end();
+    KP_LOG_DEBUG("Kompute Manager calibrateable time domains device: {}, "
+                 "monotonic: {}",
+                 device,
+                 monotonic);
+    return device && monotonic;
+}
+
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+std::shared_ptr<Tensor>
+Manager::tensor(AHardwareBuffer* hardwareBuffer,
+                const Tensor::TensorDataTypes& dataType)
+{
+    KP_LOG_DEBUG("Kompute Manager hardware buffer tensor creation triggered");
+
+    return this->manage(*this->mManagedTensors,
+                        new kp::Tensor(this->mPhysicalDevice,
+                                       this->mDevice,
+                                       hardwareBuffer,
+                                       dataType,
+                                       this->mMemoryPool,
+                                       this->sharedQueueFamilyIndices(),
+                                       this->mDebugUtils,
+                                       this->mMetrics,
+                                       this->mHostAllocator,
+                                       this->mDeviceInfo));
+}
+#endif
+
+std::shared_ptr<Tensor>
+Manager::tensor(uint64_t elementTotalCount,
+                const Tensor::TensorDataTypes& dataType,
+                Tensor::TensorTypes tensorType,
+                bool zeroInitialise,
+                Tensor::HostMemoryTypes hostMemoryType)
+{
+    KP_LOG_DEBUG("Kompute Manager allocate only tensor creation triggered");
+
+    std::shared_ptr<Tensor> tensor = this->tensor(
+      nullptr,
+      elementTotalCount,
+      Tensor::elementMemorySize(dataType),
+      dataType,
+      tensorType,
+      hostMemoryType);
+
+    if (zeroInitialise) {
+        this->sequence()->eval<OpTensorFill>({ tensor });
+    }
+
+    return tensor;
+}
+
+std::shared_ptr<Tensor>
+Manager::image(void* data,
+               uint32_t width,
+               uint32_t height,
+               uint32_t channels,
+               const Tensor::TensorDataTypes& dataType,
+               Tensor::HostMemoryTypes hostMemoryType)
+{
+    KP_LOG_DEBUG("Kompute Manager image tensor creation triggered");
+
+    return this->manage(*this->mManagedTensors,
+                        new kp::Tensor(this->mPhysicalDevice,
+                                       this->mDevice,
+                                       data,
+                                       width,
+                                       height,
+                                       channels,
+                                       dataType,
+                                       hostMemoryType,
+                                       this->mMemoryPool,
+                                       this->sharedQueueFamilyIndices(),
+                                       this->mDebugUtils,
+                                       this->mMetrics,
+                                       this->mHostAllocator,
+                                       this->mDeviceInfo));
+}
+
+std::shared_ptr<SparseTensor>
+Manager::sparseTensor(uint32_t rows,
+                      uint32_t columns,
+                      uint32_t nonZeroCount,
+                      const uint32_t* rowPointers,
+                      const uint32_t* columnIndices,
+                      const float* values,
+                      Tensor::TensorTypes tensorType)
+{
+    KP_LOG_DEBUG("Kompute Manager sparse tensor creation triggered");
+
+    if (tensorType != Tensor::TensorTypes::eDevice &&
+        tensorType != Tensor::TensorTypes::eHost) {
+        throw std::runtime_error(
+          "Kompute Manager sparse tensors must be of type eDevice or eHost");
+    }
+
+    SparseTensor::validate(
+      rows, columns, nonZeroCount, rowPointers, columnIndices);
+
+    // Matrices without non zeros keep a single element, as tensors cannot be
+    // empty
+    const uint32_t zeroIndex = 0;
+    const float zeroValue = 0;
+    uint32_t nonZeroSize = std::max<uint32_t>(nonZeroCount, 1);
+    if (!nonZeroCount) {
+        columnIndices = &zeroIndex;
+        values = &zeroValue;
+    }
+
+    std::shared_ptr<Tensor> rowPointersTensor =
+      this->tensor((void*)rowPointers,
+                   (uint64_t)rows + 1,
+                   sizeof(uint32_t),
+                   Tensor::TensorDataTypes::eUnsignedInt,
+                   tensorType);
+    std::shared_ptr<Tensor> columnIndicesTensor =
+      this->tensor((void*)columnIndices,
+                   nonZeroSize,
+                   sizeof(uint32_t),
+                   Tensor::TensorDataTypes::eUnsignedInt,
+                   tensorType);
+    std::shared_ptr<Tensor> valuesTensor =
+      this->tensor((void*)values,
+                   nonZeroSize,
+                   sizeof(float),
+                   Tensor::TensorDataTypes::eFloat,
+                   tensorType);
+
+    return std::make_shared<SparseTensor>(rowPointersTensor,
+                                          columnIndicesTensor,
+                                          valuesTensor,
+                                          rows,
+                                          columns,
+                                          nonZeroCount);
+}
+
+std::shared_ptr<SparseTensor>
+Manager::sparseTensor(uint32_t rows,
+                      uint32_t columns,
+                      const std::vector<uint32_t>& rowPointers,
+                      const std::vector<uint32_t>& columnIndices,
+                      const std::vector<float>& values,
+                      Tensor::TensorTypes tensorType)
+{
+    if (rowPointers.size() != (size_t)rows + 1 ||
+        columnIndices.size() != values.size()) {
+        throw std::runtime_error(
+          fmt::format("Kompute Manager sparse tensor of {} rows expects {} "
+                      "row pointers and as many column indices as values but "
+                      "got {}, {} and {}",
+                      rows,
+                      (size_t)rows + 1,
+                      rowPointers.size(),
+                      columnIndices.size(),
+                      values.size()));
+    }
+
+    return this->sparseTensor(rows,
+                              columns,
+                              (uint32_t)values.size(),
+                              rowPointers.data(),
+                              columnIndices.data(),
+                              values.data(),
+                              tensorType);
 }
 
 std::shared_ptr<Sequence>
-Manager::sequence(uint32_t queueIndex, uint32_t totalTimestamps)
+Manager::sequence(uint32_t queueIndex,
+                  uint32_t totalTimestamps,
+                  uint32_t inFlightDepth,
+                  bool shareCommandPool,
+                  uint32_t totalPipelineStatistics)
 {
     KP_LOG_DEBUG("Kompute Manager sequence() with queueIndex: {}", queueIndex);
 
-    std::shared_ptr<Sequence> sq{ new kp::Sequence(
-      this->mPhysicalDevice,
-      this->mDevice,
-      this->mComputeQueues[queueIndex],
-      this->mComputeQueueFamilyIndices[queueIndex],
-      totalTimestamps) };
+    uint32_t queueFamilyIndex = this->mComputeQueueFamilyIndices[queueIndex];
+
+    std::shared_ptr<vk::CommandPool> commandPool = nullptr;
+    if (shareCommandPool) {
+        std::lock_guard<std::mutex> lock(this->mSharedCommandPoolsMutex);
+        std::shared_ptr<vk::CommandPool>& sharedCommandPool =
+          this->mSharedCommandPools[queueFamilyIndex];
+        if (!sharedCommandPool) {
+            KP_LOG_DEBUG("Kompute Manager creating shared command pool for "
+                         "queue family {}",
+                         queueFamilyIndex);
+            vk::CommandPoolCreateInfo commandPoolInfo(
+              vk::CommandPoolCreateFlagBits::eResetCommandBuffer,
+              queueFamilyIndex);
+            sharedCommandPool = std::make_shared<vk::CommandPool>();
+            this->mDevice->createCommandPool(
+              &commandPoolInfo,
+              HostAllocator::callbacks(this->mHostAllocator),
+              sharedCommandPool.get());
+        }
+        commandPool = sharedCommandPool;
+    }
 
-    if (this->mManageResources) {
-        this->mManagedSequences.push_back(sq);
+    return this->manage(
+      *this->mManagedSequences,
+      new kp::Sequence(this->mPhysicalDevice,
+                       this->mDevice,
+                       this->mComputeQueues[queueIndex],
+                       queueFamilyIndex,
+                       totalTimestamps,
+                       inFlightDepth,
+                       this->mTimelineSemaphores,
+                       commandPool,
+                       this->mComputeQueueMutexes[queueIndex],
+                       totalPipelineStatistics,
+                       this->mDebugUtils,
+                       this->mMetrics,
+                       this->mHostAllocator,
+                       this->mDeviceInfo));
+}
+
+std::shared_ptr<Sequence>
+Manager::sequence(QueueRole queueRole,
+                  uint32_t totalTimestamps,
+                  uint32_t inFlightDepth,
+                  bool shareCommandPool,
+                  uint32_t totalPipelineStatistics)
+{
+    return this->sequence(this->queueIndex(queueRole),
+                          totalTimestamps,
+                          inFlightDepth,
+                          shareCommandPool,
+                          totalPipelineStatistics);
+}
+
+uint32_t
+Manager::queueIndex(QueueRole queueRole)
+{
+    return this->mQueueRoleIndices[(uint32_t)queueRole];
+}
+
+Manager::QueuePriority
+Manager::queuePriority(uint32_t queueIndex)
+{
+    if (queueIndex >= this->mQueuePriorities.size()) {
+        throw std::runtime_error(
+          fmt::format("Kompute Manager queue index {} out of range of {}",
+                      queueIndex,
+                      this->mQueuePriorities.size()));
     }
+    return this->mQueuePriorities[queueIndex];
+}
 
-    return sq;
+void
+Manager::evalAsync(std::shared_ptr<Sequence> sequence,
+                   std::function<void(std::shared_ptr<Sequence>)> callback)
+{
+    KP_LOG_DEBUG("Kompute Manager evalAsync() with completion callback");
+
+    sequence->evalAsync();
+    this->completionWaiter()->watch(
+      sequence, [sequence, callback](std::exception_ptr exception) {
+          if (exception) {
+              std::rethrow_exception(exception);
+          }
+          callback(sequence);
+      });
+}
+
+std::future<std::shared_ptr<Sequence>>
+Manager::evalAsync(std::shared_ptr<Sequence> sequence)
+{
+    KP_LOG_DEBUG("Kompute Manager evalAsync() with future");
+
+    std::shared_ptr<std::promise<std::shared_ptr<Sequence>>> promise =
+      std::make_shared<std::promise<std::shared_ptr<Sequence>>>();
+
+    sequence->evalAsync();
+    this->completionWaiter()->watch(
+      sequence, [sequence, promise](std::exception_ptr exception) {
+          if (exception) {
+              promise->set_exception(exception);
+          } else {
+              promise->set_value(sequence);
+          }
+      });
+
+    return promise->get_future();
+}
+
+void
+Manager::evalAsync(
+  std::shared_ptr<Sequence> sequence,
+  std::function<void(std::shared_ptr<Sequence>, std::exception_ptr)>
+    completion)
+{
+    KP_LOG_DEBUG("Kompute Manager evalAsync() with completion");
+
+    sequence->evalAsync();
+    this->completionWaiter()->watch(
+      sequence, [sequence, completion](std::exception_ptr exception) {
+          completion(sequence, exception);
+      });
+}
+
+std::shared_ptr<Block>
+Manager::block(uint32_t queueIndex)
+{
+    KP_LOG_DEBUG("Kompute Manager block() with queueIndex: {}", queueIndex);
+
+    return this->manage(
+      *this->mManagedBlocks,
+      new kp::Block(this->mDevice,
+                    this->mComputeQueueFamilyIndices[queueIndex],
+                    this->mHostAllocator));
+}
+
+std::shared_ptr<SubmitBatch>
+Manager::submit(const std::vector<std::shared_ptr<Sequence>>& sequences)
+{
+    KP_LOG_DEBUG("Kompute Manager submit() with {} sequences",
+                 sequences.size());
+
+    std::shared_ptr<SubmitBatch> batch{ new kp::SubmitBatch(
+      this->mDevice, this->mHostAllocator) };
+    batch->submit(sequences);
+
+    return batch;
+}
+
+std::shared_ptr<Scheduler>
+Manager::scheduler(uint32_t sequencesPerQueue)
+{
+    KP_LOG_DEBUG("Kompute Manager scheduler() with {} sequences per queue",
+                 sequencesPerQueue);
+
+    const std::vector<vk::QueueFamilyProperties>& queueFamilyProperties =
+      this->mDeviceInfo->queueFamilyProperties();
+
+    // Transfer only queues are left out as they cannot dispatch algorithms
+    std::vector<std::vector<std::shared_ptr<Sequence>>> queueSequences;
+    for (uint32_t i = 0; i < this->mComputeQueues.size(); i++) {
+        uint32_t queueFamilyIndex = this->mComputeQueueFamilyIndices[i];
+        if (!(queueFamilyProperties[queueFamilyIndex].queueFlags &
+              vk::QueueFlagBits::eCompute)) {
+            continue;
+        }
+
+        std::vector<std::shared_ptr<Sequence>> sequences;
+        for (uint32_t j = 0; j < sequencesPerQueue; j++) {
+            sequences.push_back(this->sequence(i));
+        }
+        queueSequences.push_back(sequences);
+    }
+
+    return std::make_shared<Scheduler>(queueSequences,
+                                       this->completionWaiter());
+}
+
+std::shared_ptr<Graph>
+Manager::graph(const std::vector<uint32_t>& queueIndices)
+{
+    KP_LOG_DEBUG("Kompute Manager graph() with {} queues", queueIndices.size());
+
+    const std::vector<vk::QueueFamilyProperties>& queueFamilyProperties =
+      this->mDeviceInfo->queueFamilyProperties();
+
+    std::vector<uint32_t> graphQueueIndices = queueIndices;
+    if (graphQueueIndices.empty()) {
+        if (this->mTimelineSemaphores) {
+            for (uint32_t i = 0; i < this->mComputeQueues.size(); i++) {
+                uint32_t queueFamilyIndex = this->mComputeQueueFamilyIndices[i];
+                if (queueFamilyProperties[queueFamilyIndex].queueFlags &
+                    vk::QueueFlagBits::eCompute) {
+                    graphQueueIndices.push_back(i);
+                }
+            }
+        } else {
+            graphQueueIndices.push_back(this->queueIndex(QueueRole::eCompute));
+        }
+    }
+
+    if (graphQueueIndices.size() > 1 && !this->mTimelineSemaphores) {
+        throw std::runtime_error(
+          "Kompute Manager graph across several queues requires timeline "
+          "semaphores");
+    }
+    for (uint32_t queueIndex : graphQueueIndices) {
+        if (queueIndex >= this->mComputeQueues.size()) {
+            throw std::runtime_error(fmt::format(
+              "Kompute Manager graph queue index {} out of range of {}",
+              queueIndex,
+              this->mComputeQueues.size()));
+        }
+        uint32_t queueFamilyIndex =
+          this->mComputeQueueFamilyIndices[queueIndex];
+        if (!(queueFamilyProperties[queueFamilyIndex].queueFlags &
+              vk::QueueFlagBits::eCompute)) {
+            throw std::runtime_error(fmt::format(
+              "Kompute Manager graph queue {} does not support compute",
+              queueIndex));
+        }
+    }
+
+    return std::make_shared<Graph>(
+      graphQueueIndices,
+      [this](uint32_t queueIndex) { return this->sequence(queueIndex); });
+}
+
+void
+Manager::createPipelineCache(const std::string& pipelineCachePath)
+{
+    KP_LOG_DEBUG("Kompute Manager creating pipeline cache");
+
+    std::vector<char> initialData;
+    if (pipelineCachePath.size()) {
+        std::ifstream file(pipelineCachePath, std::ios::binary);
+        if (file) {
+            initialData.assign(std::istreambuf_iterator<char>(file),
+                               std::istreambuf_iterator<char>());
+        } else {
+            KP_LOG_WARN("Kompute Manager pipeline cache file {} not found, "
+                        "starting with an empty cache",
+                        pipelineCachePath);
+        }
+    }
+
+    // Data written for another device or driver is discarded, as drivers are
+    // not required to reject it themselves
+    if (initialData.size()) {
+        const vk::PhysicalDeviceProperties& properties =
+          this->mDeviceInfo->properties();
+
+        // Layout of VkPipelineCacheHeaderVersionOne
+        uint32_t header[4] = {};
+        bool valid = initialData.size() >= sizeof(header) + VK_UUID_SIZE;
+        if (valid) {
+            memcpy(header, initialData.data(), sizeof(header));
+            valid = header[0] >= sizeof(header) + VK_UUID_SIZE &&
+                    header[1] == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+                    header[2] == properties.vendorID &&
+                    header[3] == properties.deviceID &&
+                    memcmp(initialData.data() + sizeof(header),
+                           properties.pipelineCacheUUID.data(),
+                           VK_UUID_SIZE) == 0;
+        }
+
+        if (!valid) {
+            KP_LOG_WARN("Kompute Manager pipeline cache file {} was not "
+                        "created for this device, starting with an empty "
+                        "cache",
+                        pipelineCachePath);
+            initialData.clear();
+        } else {
+            KP_LOG_INFO("Kompute Manager preloading pipeline cache of {} bytes",
+                        initialData.size());
+        }
+    }
+
+    vk::PipelineCacheCreateInfo pipelineCacheInfo(
+      vk::PipelineCacheCreateFlags(), initialData.size(), initialData.data());
+    this->mPipelineCache = std::make_shared<vk::PipelineCache>();
+    this->mDevice->createPipelineCache(
+      &pipelineCacheInfo,
+      HostAllocator::callbacks(this->mHostAllocator),
+      this->mPipelineCache.get());
+}
+
+void
+Manager::savePipelineCache(const std::string& path)
+{
+    KP_LOG_DEBUG("Kompute Manager saving pipeline cache to {}", path);
+
+    if (!this->mPipelineCache) {
+        throw std::runtime_error(
+          "Kompute Manager savePipelineCache called after destroy");
+    }
+
+    std::vector<uint8_t> data =
+      this->mDevice->getPipelineCacheData(*this->mPipelineCache);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    if (!file) {
+        throw std::runtime_error(fmt::format(
+          "Kompute Manager failed to write pipeline cache to {}", path));
+    }
+
+    KP_LOG_INFO("Kompute Manager saved pipeline cache of {} bytes",
+                data.size());
 }
 
 vk::PhysicalDeviceProperties
 Manager::getDeviceProperties() const
 {
-    return this->mPhysicalDevice->getProperties();
+    return this->mDeviceInfo->properties();
 }
 
 std::vector<vk::PhysicalDevice>
@@ -453,4 +1474,350 @@ Manager::listDevices() const
     return this->mInstance->enumeratePhysicalDevices();
 }
 
+uint32_t
+Manager::selectDevice(const DeviceRequirements& requirements) const
+{
+    std::vector<vk::PhysicalDevice> physicalDevices = this->listDevices();
+
+    int64_t bestScore = -1;
+    uint32_t bestIndex = 0;
+    for (uint32_t i = 0; i < physicalDevices.size(); i++) {
+        int64_t score = Manager::scoreDevice(physicalDevices[i], requirements);
+
+        KP_LOG_DEBUG("Kompute Manager device {} {} scored {}",
+                     i,
+                     physicalDevices[i].getProperties().deviceName,
+                     score);
+
+        if (score > bestScore) {
+            bestScore = score;
+            bestIndex = i;
+        }
+    }
+
+    if (bestScore < 0) {
+        throw std::runtime_error(
+          fmt::format("Kompute Manager none of the {} devices meet the "
+                      "requirements",
+                      physicalDevices.size()));
+    }
+    return bestIndex;
+}
+
+int64_t
+Manager::scoreDevice(const vk::PhysicalDevice& physicalDevice,
+                     const DeviceRequirements& requirements)
+{
+    vk::PhysicalDeviceSubgroupProperties subgroupProperties;
+    vk::PhysicalDeviceProperties2 properties;
+    properties.pNext = &subgroupProperties;
+    physicalDevice.getProperties2(&properties);
+
+    int64_t typeRank = 0;
+    switch (properties.properties.deviceType) {
+        case vk::PhysicalDeviceType::eDiscreteGpu:
+            typeRank = 4;
+            break;
+        case vk::PhysicalDeviceType::eIntegratedGpu:
+            typeRank = 3;
+            break;
+        case vk::PhysicalDeviceType::eVirtualGpu:
+            typeRank = 2;
+            break;
+        case vk::PhysicalDeviceType::eCpu:
+            if (!requirements.allowCpu) {
+                return -1;
+            }
+            typeRank = 0;
+            break;
+        default:
+            typeRank = 1;
+    }
+
+    std::vector<vk::QueueFamilyProperties> queueFamilyProperties =
+      physicalDevice.getQueueFamilyProperties();
+    if (std::none_of(queueFamilyProperties.begin(),
+                     queueFamilyProperties.end(),
+                     [](const vk::QueueFamilyProperties& family) {
+                         return bool(family.queueFlags &
+                                     vk::QueueFlagBits::eCompute);
+                     })) {
+        return -1;
+    }
+
+    std::vector<vk::ExtensionProperties> extensionProperties =
+      physicalDevice.enumerateDeviceExtensionProperties();
+    for (const std::string& ext : requirements.extensions) {
+        if (std::none_of(extensionProperties.begin(),
+                         extensionProperties.end(),
+                         [&ext](const vk::ExtensionProperties& properties) {
+                             return ext == properties.extensionName.data();
+                         })) {
+            return -1;
+        }
+    }
+
+    // The features are a struct of VkBool32 only, compared one by one
+    vk::PhysicalDeviceFeatures features = physicalDevice.getFeatures();
+    const VkBool32* supported = reinterpret_cast<const VkBool32*>(&features);
+    const VkBool32* required =
+      reinterpret_cast<const VkBool32*>(&requirements.features);
+    for (size_t i = 0; i < sizeof(VkPhysicalDeviceFeatures) / sizeof(VkBool32);
+         i++) {
+        if (required[i] && !supported[i]) {
+            return -1;
+        }
+    }
+
+    if (subgroupProperties.subgroupSize < requirements.minSubgroupSize) {
+        return -1;
+    }
+    vk::SubgroupFeatureFlags operations = requirements.subgroupOperations;
+    if (operations &&
+        (!(subgroupProperties.supportedStages &
+           vk::ShaderStageFlagBits::eCompute) ||
+         (subgroupProperties.supportedOperations & operations) != operations)) {
+        return -1;
+    }
+
+    vk::PhysicalDeviceMemoryProperties memoryProperties =
+      physicalDevice.getMemoryProperties();
+    uint64_t deviceLocalSize = 0;
+    for (uint32_t i = 0; i < memoryProperties.memoryHeapCount; i++) {
+        if (memoryProperties.memoryHeaps[i].flags &
+            vk::MemoryHeapFlagBits::eDeviceLocal) {
+            deviceLocalSize += memoryProperties.memoryHeaps[i].size;
+        }
+    }
+
+    // The device type dominates, then the device local memory in MiB, then
+    // the subgroup size
+    int64_t memoryRank =
+      std::min<uint64_t>(deviceLocalSize >> 20, (uint64_t(1) << 31) - 1);
+    int64_t subgroupRank = std::min(subgroupProperties.subgroupSize, 255u);
+    return (typeRank << 40) | (memoryRank << 8) | subgroupRank;
+}
+
+uint32_t
+Manager::getDefaultLocalSize() const
+{
+    return this->mDefaultLocalSize;
+}
+
+vk::PhysicalDeviceSubgroupProperties
+Manager::getSubgroupProperties() const
+{
+    return this->mDeviceInfo->subgroupProperties();
+}
+
+bool
+Manager::supportsSubgroupOperations(vk::SubgroupFeatureFlags operations) const
+{
+    vk::PhysicalDeviceSubgroupProperties subgroupProperties =
+      this->getSubgroupProperties();
+
+    return (subgroupProperties.supportedStages &
+            vk::ShaderStageFlagBits::eCompute) &&
+           (subgroupProperties.supportedOperations & operations) == operations;
+}
+
+void
+Manager::updateDefaultLocalSize()
+{
+    vk::PhysicalDeviceSubgroupProperties subgroupProperties =
+      this->getSubgroupProperties();
+    const vk::PhysicalDeviceLimits& limits =
+      this->mDeviceInfo->properties().limits;
+
+    uint32_t subgroupSize = std::max(subgroupProperties.subgroupSize, 1u);
+    uint32_t maxLocalSize = std::min(limits.maxComputeWorkGroupSize[0],
+                                     limits.maxComputeWorkGroupInvocations);
+
+    // Whole subgroups keep all the lanes of the device busy
+    uint32_t localSize = (KOMPUTE_DEFAULT_LOCAL_SIZE_X + subgroupSize - 1) /
+                         subgroupSize * subgroupSize;
+    this->mDefaultLocalSize = std::max(std::min(localSize, maxLocalSize), 1u);
+
+    KP_LOG_DEBUG("Kompute Manager default local size {} for subgroup size {}",
+                 this->mDefaultLocalSize,
+                 subgroupSize);
+}
+
+bool
+Manager::hasTimelineSemaphores() const
+{
+    return this->mTimelineSemaphores;
+}
+
+bool
+Manager::hasBufferDeviceAddress() const
+{
+    return this->mMemoryPool && this->mMemoryPool->hasBufferDeviceAddress();
+}
+
+bool
+Manager::hasGlobalPriority() const
+{
+    return this->mGlobalPriority;
+}
+
+bool
+Manager::hasDebugUtils() const
+{
+    return (bool)this->mDebugUtils;
+}
+
+bool
+Manager::supportsDataType(const Tensor::TensorDataTypes& dataType) const
+{
+    switch (dataType) {
+        case Tensor::TensorDataTypes::eHalf:
+        case Tensor::TensorDataTypes::eInt16:
+            return this->mStorage16Bit;
+        case Tensor::TensorDataTypes::eInt8:
+        case Tensor::TensorDataTypes::eUnsignedInt8:
+            return this->mStorage8Bit;
+        default:
+            return true;
+    }
+}
+
+std::shared_ptr<MemoryPool>
+Manager::memoryPool() const
+{
+    return this->mMemoryPool;
+}
+
+std::shared_ptr<WorkerPool>
+Manager::workerPool()
+{
+    std::lock_guard<std::mutex> lock(this->mLazyResourcesMutex);
+    if (!this->mWorkerPool) {
+        KP_LOG_DEBUG("Kompute Manager creating worker pool");
+        this->mWorkerPool = std::make_shared<WorkerPool>();
+    }
+    return this->mWorkerPool;
+}
+
+std::shared_ptr<CompletionWaiter>
+Manager::completionWaiter()
+{
+    std::lock_guard<std::mutex> lock(this->mLazyResourcesMutex);
+    if (!this->mCompletionWaiter) {
+        KP_LOG_DEBUG("Kompute Manager creating completion waiter");
+        this->mCompletionWaiter =
+          std::make_shared<CompletionWaiter>(this->mDevice);
+    }
+    return this->mCompletionWaiter;
+}
+
+std::shared_ptr<ShaderCache>
+Manager::shaderCache() const
+{
+    return this->mShaderCache;
+}
+
+std::shared_ptr<DescriptorAllocator>
+Manager::descriptorAllocator() const
+{
+    return this->mDescriptorAllocator;
+}
+
+Manager::MemoryStats
+Manager::memoryStats()
+{
+    MemoryStats memoryStats;
+    memoryStats.heaps = this->mMemoryPool->heapStats();
+
+    for (const std::shared_ptr<Tensor>& tensor :
+         this->mManagedTensors->resources()) {
+        if (!tensor->isInit()) {
+            continue;
+        }
+        if (tensor->isView()) {
+            memoryStats.viewCount++;
+            continue;
+        }
+        memoryStats.tensorCount++;
+        memoryStats.primaryMemorySize += tensor->primaryMemorySize();
+        memoryStats.stagingMemorySize += tensor->stagingMemorySize();
+    }
+
+    return memoryStats;
+}
+
+Metrics::Snapshot
+Manager::metrics()
+{
+    Metrics::Snapshot metrics = this->mMetrics->snapshot();
+    metrics.tensorCount = this->mManagedTensors->resources().size();
+    metrics.algorithmCount = this->mManagedAlgorithms->resources().size();
+    metrics.sequenceCount = this->mManagedSequences->resources().size();
+    return metrics;
+}
+
+void
+Manager::resetMetrics()
+{
+    this->mMetrics->reset();
+}
+
+std::shared_ptr<HostAllocator>
+Manager::hostAllocator()
+{
+    return this->mHostAllocator;
+}
+
+void
+Manager::setDeviceMemoryLimit(vk::DeviceSize limit)
+{
+    KP_LOG_DEBUG("Kompute Manager setting device memory limit {}", limit);
+
+    const vk::PhysicalDeviceMemoryProperties& memoryProperties =
+      this->mDeviceInfo->memoryProperties();
+    for (uint32_t i = 0; i < memoryProperties.memoryHeapCount; i++) {
+        if (memoryProperties.memoryHeaps[i].flags &
+            vk::MemoryHeapFlagBits::eDeviceLocal) {
+            this->mMemoryPool->setHeapLimit(i, limit);
+        }
+    }
+}
+
+void
+Manager::setConcurrentSharing(bool concurrentSharing)
+{
+    this->mConcurrentSharing = concurrentSharing;
+}
+
+std::vector<uint32_t>
+Manager::sharedQueueFamilyIndices()
+{
+    if (!this->mConcurrentSharing) {
+        return {};
+    }
+    return this->mComputeQueueFamilyIndices;
+}
+
+void
+Manager::enableStagingRing(vk::DeviceSize ringSize, uint32_t queueIndex)
+{
+    KP_LOG_DEBUG("Kompute Manager enabling staging ring of size {}", ringSize);
+
+    if (queueIndex >= this->mComputeQueues.size()) {
+        throw std::runtime_error(
+          "Kompute Manager staging ring queue index out of range");
+    }
+
+    this->mStagingRing = std::make_shared<StagingRing>(
+      this->mPhysicalDevice,
+      this->mDevice,
+      this->mComputeQueues[queueIndex],
+      this->mComputeQueueFamilyIndices[queueIndex],
+      this->mMemoryPool,
+      ringSize,
+      KOMPUTE_STAGING_RING_SLOTS,
+      this->mComputeQueueMutexes[queueIndex],
+      this->mHostAllocator);
+}
+
 }
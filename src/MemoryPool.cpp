@@ -0,0 +1,713 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "kompute/MemoryPool.hpp"
+
+namespace kp {
+
+MemoryPool::MemoryPool(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
+                       std::shared_ptr<vk::Device> device,
+                       vk::DeviceSize blockSize,
+                       std::shared_ptr<HostAllocator> hostAllocator,
+                       std::shared_ptr<DeviceInfo> deviceInfo)
+{
+    KP_LOG_DEBUG("Kompute MemoryPool constructor with block size {}",
+                 blockSize);
+
+    if (!physicalDevice) {
+        throw std::runtime_error("Kompute MemoryPool physical device is null");
+    }
+    if (!device) {
+        throw std::runtime_error("Kompute MemoryPool device is null");
+    }
+
+    this->mPhysicalDevice = physicalDevice;
+    this->mDevice = device;
+    this->mHostAllocator = hostAllocator;
+    this->mBlockSize = blockSize;
+    if (!deviceInfo) {
+        deviceInfo = std::make_shared<DeviceInfo>(*physicalDevice);
+    }
+    this->mMemoryProperties = deviceInfo->memoryProperties();
+    this->mNonCoherentAtomSize =
+      deviceInfo->properties().limits.nonCoherentAtomSize;
+
+    // The budget is queried from the physical device, so support is enough
+    for (const vk::ExtensionProperties& ext :
+         this->mPhysicalDevice->enumerateDeviceExtensionProperties()) {
+        if (std::string(ext.extensionName) ==
+            VK_EXT_MEMORY_BUDGET_EXTENSION_NAME) {
+            this->mMemoryBudget = true;
+        }
+    }
+}
+
+MemoryPool::~MemoryPool()
+{
+    KP_LOG_DEBUG("Kompute MemoryPool destructor started");
+
+    if (this->mDevice) {
+        this->destroy();
+    }
+
+    KP_LOG_DEBUG("Kompute MemoryPool destructor success");
+}
+
+MemoryPool::Allocation
+MemoryPool::allocate(const vk::MemoryRequirements& requirements,
+                     const vk::MemoryPropertyFlags& memoryPropertyFlags)
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    if (!this->mDevice) {
+        throw std::runtime_error(
+          "Kompute MemoryPool allocate called on destroyed pool");
+    }
+
+    int32_t memoryTypeIndex = this->findMemoryTypeIndex(
+      requirements.memoryTypeBits, memoryPropertyFlags);
+    if (memoryTypeIndex < 0) {
+        throw std::runtime_error(
+          "Kompute MemoryPool memory type index for allocation not found");
+    }
+
+    vk::MemoryRequirements memoryRequirements = requirements;
+    vk::MemoryPropertyFlags typeFlags =
+      this->mMemoryProperties.memoryTypes[memoryTypeIndex].propertyFlags;
+    if ((typeFlags & vk::MemoryPropertyFlagBits::eHostVisible) &&
+        !(typeFlags & vk::MemoryPropertyFlagBits::eHostCoherent)) {
+        vk::DeviceSize atomSize = this->mNonCoherentAtomSize;
+        memoryRequirements.alignment =
+          std::max(memoryRequirements.alignment, atomSize);
+        memoryRequirements.size =
+          (memoryRequirements.size + atomSize - 1) / atomSize * atomSize;
+    }
+
+    Allocation allocation;
+    allocation.memoryTypeIndex = memoryTypeIndex;
+
+    // Requests larger than half a block would waste most of a shared block
+    if (memoryRequirements.size > this->mBlockSize / 2) {
+        KP_LOG_DEBUG("Kompute MemoryPool creating dedicated block of size {}",
+                     memoryRequirements.size);
+        Block* block =
+          this->createBlock(memoryTypeIndex, memoryRequirements.size, true);
+        this->allocateFromBlock(*block, memoryRequirements, allocation);
+        return allocation;
+    }
+
+    for (std::unique_ptr<Block>& block : this->mBlocks[memoryTypeIndex]) {
+        if (!block->dedicated &&
+            this->allocateFromBlock(*block, memoryRequirements, allocation)) {
+            return allocation;
+        }
+    }
+
+    // The heap may be smaller than the configured block size on some devices
+    vk::DeviceSize heapSize =
+      this->mMemoryProperties
+        .memoryHeaps[this->mMemoryProperties.memoryTypes[memoryTypeIndex]
+                       .heapIndex]
+        .size;
+    vk::DeviceSize blockSize = std::min(this->mBlockSize, heapSize / 8);
+    blockSize = std::max(blockSize, memoryRequirements.size);
+
+    Block* block = this->createBlock(memoryTypeIndex, blockSize, false);
+    if (!this->allocateFromBlock(*block, memoryRequirements, allocation)) {
+        throw std::runtime_error(
+          "Kompute MemoryPool failed to sub-allocate from new block");
+    }
+
+    return allocation;
+}
+
+void
+MemoryPool::enableHostPointerImport(const vk::Instance& instance)
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    vk::PhysicalDeviceExternalMemoryHostPropertiesEXT hostProperties;
+    vk::PhysicalDeviceProperties2 properties;
+    properties.pNext = &hostProperties;
+    this->mPhysicalDevice->getProperties2(&properties);
+
+    this->mDispatcher.init(
+      instance, &vkGetInstanceProcAddr, *this->mDevice, &vkGetDeviceProcAddr);
+    this->mHostPointerAlignment =
+      hostProperties.minImportedHostPointerAlignment;
+    this->mHostPointerImport =
+      this->mDispatcher.vkGetMemoryHostPointerPropertiesEXT != nullptr &&
+      this->mHostPointerAlignment > 0;
+
+    KP_LOG_DEBUG("Kompute MemoryPool host pointer import enabled: {}, "
+                 "alignment {}",
+                 this->mHostPointerImport,
+                 this->mHostPointerAlignment);
+}
+
+bool
+MemoryPool::canImportHostPointer(const void* hostPointer, vk::DeviceSize size)
+{
+    if (!this->mHostPointerImport || !hostPointer) {
+        return false;
+    }
+    return (uintptr_t)hostPointer % this->mHostPointerAlignment == 0 &&
+           size % this->mHostPointerAlignment == 0;
+}
+
+bool
+MemoryPool::importHostPointer(const vk::MemoryRequirements& memoryRequirements,
+                              const vk::MemoryPropertyFlags& memoryPropertyFlags,
+                              void* hostPointer,
+                              vk::DeviceSize size,
+                              Allocation& allocation)
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    if (!this->mDevice || !this->canImportHostPointer(hostPointer, size) ||
+        memoryRequirements.size > size) {
+        KP_LOG_DEBUG("Kompute MemoryPool host pointer cannot be imported");
+        return false;
+    }
+
+    vk::MemoryHostPointerPropertiesEXT hostPointerProperties;
+    vk::Result result = this->mDevice->getMemoryHostPointerPropertiesEXT(
+      vk::ExternalMemoryHandleTypeFlagBits::eHostAllocationEXT,
+      hostPointer,
+      &hostPointerProperties,
+      this->mDispatcher);
+    if (result != vk::Result::eSuccess) {
+        KP_LOG_DEBUG("Kompute MemoryPool host pointer properties failed: {}",
+                     vk::to_string(result));
+        return false;
+    }
+
+    int32_t memoryTypeIndex = this->findMemoryTypeIndex(
+      memoryRequirements.memoryTypeBits & hostPointerProperties.memoryTypeBits,
+      memoryPropertyFlags);
+    if (memoryTypeIndex < 0) {
+        KP_LOG_DEBUG("Kompute MemoryPool no memory type for host pointer");
+        return false;
+    }
+
+    vk::ImportMemoryHostPointerInfoEXT importInfo(
+      vk::ExternalMemoryHandleTypeFlagBits::eHostAllocationEXT, hostPointer);
+    vk::MemoryAllocateInfo memoryAllocateInfo(size, memoryTypeIndex);
+    memoryAllocateInfo.setPNext(&importInfo);
+    vk::MemoryAllocateFlagsInfo allocateFlagsInfo(
+      vk::MemoryAllocateFlagBits::eDeviceAddress);
+    if (this->mBufferDeviceAddress) {
+        allocateFlagsInfo.setPNext(&importInfo);
+        memoryAllocateInfo.setPNext(&allocateFlagsInfo);
+    }
+
+    this->checkHeapLimit(memoryTypeIndex, size);
+
+    std::unique_ptr<Block> block{ new Block() };
+    result = this->mDevice->allocateMemory(
+      &memoryAllocateInfo,
+      HostAllocator::callbacks(this->mHostAllocator),
+      &block->memory);
+    if (result != vk::Result::eSuccess) {
+        KP_LOG_DEBUG("Kompute MemoryPool host pointer import failed: {}",
+                     vk::to_string(result));
+        return false;
+    }
+
+    KP_LOG_DEBUG("Kompute MemoryPool imported host pointer of size {} with "
+                 "memory index {}",
+                 size,
+                 memoryTypeIndex);
+
+    // The host pointer is used directly instead of mapping the memory
+    block->size = size;
+    block->dedicated = true;
+    block->imported = true;
+    block->mappedData = hostPointer;
+
+    allocation.memory = block->memory;
+    allocation.offset = 0;
+    allocation.size = size;
+    allocation.memoryTypeIndex = memoryTypeIndex;
+    allocation.mappedData = hostPointer;
+
+    this->mBlocks[memoryTypeIndex].push_back(std::move(block));
+    return true;
+}
+
+void
+MemoryPool::enableBufferDeviceAddress(const vk::Instance& instance)
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    this->mDispatcher.init(
+      instance, &vkGetInstanceProcAddr, *this->mDevice, &vkGetDeviceProcAddr);
+    this->mBufferDeviceAddress =
+      this->mDispatcher.vkGetBufferDeviceAddressKHR != nullptr;
+
+    KP_LOG_DEBUG("Kompute MemoryPool buffer device address enabled: {}",
+                 this->mBufferDeviceAddress);
+}
+
+bool
+MemoryPool::hasBufferDeviceAddress()
+{
+    return this->mBufferDeviceAddress;
+}
+
+vk::DeviceAddress
+MemoryPool::bufferDeviceAddress(const vk::Buffer& buffer)
+{
+    if (!this->mBufferDeviceAddress) {
+        throw std::runtime_error(
+          "Kompute MemoryPool buffer device address requires "
+          "VK_KHR_buffer_device_address to be enabled");
+    }
+
+    vk::BufferDeviceAddressInfo addressInfo(buffer);
+    return this->mDevice->getBufferAddressKHR(addressInfo, this->mDispatcher);
+}
+
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+void
+MemoryPool::enableHardwareBufferImport(const vk::Instance& instance)
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    // The NDK wrapper declares the entry points as function pointers
+    this->mDispatcher.init(
+      instance, vkGetInstanceProcAddr, *this->mDevice, vkGetDeviceProcAddr);
+    this->mHardwareBufferImport =
+      this->mDispatcher.vkGetAndroidHardwareBufferPropertiesANDROID !=
+      nullptr;
+
+    KP_LOG_DEBUG("Kompute MemoryPool hardware buffer import enabled: {}",
+                 this->mHardwareBufferImport);
+}
+
+bool
+MemoryPool::canImportHardwareBuffer()
+{
+    return this->mHardwareBufferImport;
+}
+
+bool
+MemoryPool::importHardwareBuffer(
+  const vk::MemoryRequirements& memoryRequirements,
+  AHardwareBuffer* hardwareBuffer,
+  Allocation& allocation)
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    if (!this->mDevice || !this->mHardwareBufferImport || !hardwareBuffer) {
+        KP_LOG_DEBUG("Kompute MemoryPool hardware buffer cannot be imported");
+        return false;
+    }
+
+    vk::AndroidHardwareBufferPropertiesANDROID hardwareBufferProperties;
+    vk::Result result =
+      this->mDevice->getAndroidHardwareBufferPropertiesANDROID(
+        hardwareBuffer, &hardwareBufferProperties, this->mDispatcher);
+    if (result != vk::Result::eSuccess) {
+        KP_LOG_DEBUG("Kompute MemoryPool hardware buffer properties failed: {}",
+                     vk::to_string(result));
+        return false;
+    }
+    if (memoryRequirements.size > hardwareBufferProperties.allocationSize) {
+        KP_LOG_DEBUG("Kompute MemoryPool hardware buffer of {} bytes smaller "
+                     "than the {} bytes required",
+                     hardwareBufferProperties.allocationSize,
+                     memoryRequirements.size);
+        return false;
+    }
+
+    // Host visible memory is preferred so the data can be read in place
+    uint32_t memoryTypeBits = memoryRequirements.memoryTypeBits &
+                              hardwareBufferProperties.memoryTypeBits;
+    int32_t memoryTypeIndex = this->findMemoryTypeIndex(
+      memoryTypeBits, vk::MemoryPropertyFlagBits::eHostVisible);
+    if (memoryTypeIndex < 0) {
+        memoryTypeIndex =
+          this->findMemoryTypeIndex(memoryTypeBits, vk::MemoryPropertyFlags());
+    }
+    if (memoryTypeIndex < 0) {
+        KP_LOG_DEBUG("Kompute MemoryPool no memory type for hardware buffer");
+        return false;
+    }
+
+    vk::ImportAndroidHardwareBufferInfoANDROID importInfo(hardwareBuffer);
+    vk::MemoryAllocateInfo memoryAllocateInfo(
+      hardwareBufferProperties.allocationSize, memoryTypeIndex);
+    memoryAllocateInfo.setPNext(&importInfo);
+    vk::MemoryAllocateFlagsInfo allocateFlagsInfo(
+      vk::MemoryAllocateFlagBits::eDeviceAddress);
+    if (this->mBufferDeviceAddress) {
+        allocateFlagsInfo.setPNext(&importInfo);
+        memoryAllocateInfo.setPNext(&allocateFlagsInfo);
+    }
+
+    this->checkHeapLimit(memoryTypeIndex,
+                         hardwareBufferProperties.allocationSize);
+
+    std::unique_ptr<Block> block{ new Block() };
+    result = this->mDevice->allocateMemory(
+      &memoryAllocateInfo,
+      HostAllocator::callbacks(this->mHostAllocator),
+      &block->memory);
+    if (result != vk::Result::eSuccess) {
+        KP_LOG_DEBUG("Kompute MemoryPool hardware buffer import failed: {}",
+                     vk::to_string(result));
+        return false;
+    }
+
+    KP_LOG_DEBUG("Kompute MemoryPool imported hardware buffer of size {} "
+                 "with memory index {}",
+                 hardwareBufferProperties.allocationSize,
+                 memoryTypeIndex);
+
+    // Unlike imported host pointers the memory is mapped, and unmapped by
+    // freeBlock like the other blocks
+    block->size = hardwareBufferProperties.allocationSize;
+    block->dedicated = true;
+    if (this->mMemoryProperties.memoryTypes[memoryTypeIndex].propertyFlags &
+        vk::MemoryPropertyFlagBits::eHostVisible) {
+        block->mappedData = this->mDevice->mapMemory(
+          block->memory, 0, VK_WHOLE_SIZE, vk::MemoryMapFlags());
+    }
+
+    allocation.memory = block->memory;
+    allocation.offset = 0;
+    allocation.size = block->size;
+    allocation.memoryTypeIndex = memoryTypeIndex;
+    allocation.mappedData = block->mappedData;
+
+    this->mBlocks[memoryTypeIndex].push_back(std::move(block));
+    return true;
+}
+#endif
+
+void
+MemoryPool::free(const Allocation& allocation)
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    if (!this->mDevice || !allocation.memory) {
+        return;
+    }
+
+    std::vector<std::unique_ptr<Block>>& blocks =
+      this->mBlocks[allocation.memoryTypeIndex];
+
+    for (auto it = blocks.begin(); it != blocks.end(); it++) {
+        Block& block = **it;
+        if (block.memory != allocation.memory) {
+            continue;
+        }
+
+        if (block.dedicated) {
+            KP_LOG_DEBUG("Kompute MemoryPool freeing dedicated block");
+            this->freeBlock(block);
+            blocks.erase(it);
+            return;
+        }
+
+        vk::DeviceSize offset = allocation.offset;
+        vk::DeviceSize size = allocation.size;
+
+        // Merge with the following free range if contiguous
+        auto next = block.freeRanges.lower_bound(offset);
+        if (next != block.freeRanges.end() && offset + size == next->first) {
+            size += next->second;
+            next = block.freeRanges.erase(next);
+        }
+        // Merge with the preceding free range if contiguous
+        if (next != block.freeRanges.begin()) {
+            auto prev = std::prev(next);
+            if (prev->first + prev->second == offset) {
+                prev->second += size;
+                return;
+            }
+        }
+        block.freeRanges[offset] = size;
+        return;
+    }
+
+    KP_LOG_WARN("Kompute MemoryPool free called with unknown allocation");
+}
+
+void
+MemoryPool::destroy()
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    KP_LOG_DEBUG("Kompute MemoryPool started destroy()");
+
+    if (!this->mDevice) {
+        KP_LOG_WARN(
+          "Kompute MemoryPool destroy reached with null Device pointer");
+        return;
+    }
+
+    for (auto& memoryTypeBlocks : this->mBlocks) {
+        for (std::unique_ptr<Block>& block : memoryTypeBlocks.second) {
+            this->freeBlock(*block);
+        }
+    }
+    this->mBlocks.clear();
+
+    this->mDevice = nullptr;
+
+    KP_LOG_DEBUG("Kompute MemoryPool successful destroy()");
+}
+
+uint32_t
+MemoryPool::blockCount()
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    uint32_t count = 0;
+    for (const auto& memoryTypeBlocks : this->mBlocks) {
+        count += memoryTypeBlocks.second.size();
+    }
+    return count;
+}
+
+vk::DeviceSize
+MemoryPool::allocatedSize()
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    vk::DeviceSize size = 0;
+    for (const auto& memoryTypeBlocks : this->mBlocks) {
+        for (const std::unique_ptr<Block>& block : memoryTypeBlocks.second) {
+            size += block->size;
+        }
+    }
+    return size;
+}
+
+std::vector<MemoryPool::HeapStats>
+MemoryPool::heapStats()
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    std::vector<HeapStats> heapStats(this->mMemoryProperties.memoryHeapCount);
+
+    vk::PhysicalDeviceMemoryBudgetPropertiesEXT budgetProperties;
+    if (this->mMemoryBudget) {
+        vk::PhysicalDeviceMemoryProperties2 memoryProperties;
+        memoryProperties.pNext = &budgetProperties;
+        this->mPhysicalDevice->getMemoryProperties2(&memoryProperties);
+    }
+
+    for (uint32_t i = 0; i < heapStats.size(); i++) {
+        heapStats[i].flags = this->mMemoryProperties.memoryHeaps[i].flags;
+        heapStats[i].size = this->mMemoryProperties.memoryHeaps[i].size;
+        auto limit = this->mHeapLimits.find(i);
+        if (limit != this->mHeapLimits.end()) {
+            heapStats[i].limit = limit->second;
+        }
+    }
+
+    for (const auto& memoryTypeBlocks : this->mBlocks) {
+        HeapStats& stats =
+          heapStats[this->mMemoryProperties.memoryTypes[memoryTypeBlocks.first]
+                      .heapIndex];
+        for (const std::unique_ptr<Block>& block : memoryTypeBlocks.second) {
+            stats.allocated += block->size;
+            stats.used += block->size;
+            for (const auto& freeRange : block->freeRanges) {
+                stats.used -= freeRange.second;
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < heapStats.size(); i++) {
+        if (this->mMemoryBudget) {
+            heapStats[i].budget = budgetProperties.heapBudget[i];
+            heapStats[i].usage = budgetProperties.heapUsage[i];
+        } else {
+            heapStats[i].budget = heapStats[i].size;
+            heapStats[i].usage = heapStats[i].allocated;
+        }
+    }
+
+    return heapStats;
+}
+
+bool
+MemoryPool::hasMemoryBudget()
+{
+    return this->mMemoryBudget;
+}
+
+void
+MemoryPool::setHeapLimit(uint32_t heapIndex, vk::DeviceSize limit)
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    KP_LOG_DEBUG("Kompute MemoryPool setting limit of heap {} to {} bytes",
+                 heapIndex,
+                 limit);
+
+    if (heapIndex >= this->mMemoryProperties.memoryHeapCount) {
+        throw std::runtime_error(
+          fmt::format("Kompute MemoryPool heap index {} out of range", heapIndex));
+    }
+
+    if (limit == 0) {
+        this->mHeapLimits.erase(heapIndex);
+    } else {
+        this->mHeapLimits[heapIndex] = limit;
+    }
+}
+
+void
+MemoryPool::checkHeapLimit(uint32_t memoryTypeIndex, vk::DeviceSize size)
+{
+    uint32_t heapIndex =
+      this->mMemoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+    auto limit = this->mHeapLimits.find(heapIndex);
+    if (limit == this->mHeapLimits.end()) {
+        return;
+    }
+
+    vk::DeviceSize allocated = 0;
+    for (const auto& memoryTypeBlocks : this->mBlocks) {
+        if (this->mMemoryProperties.memoryTypes[memoryTypeBlocks.first]
+              .heapIndex != heapIndex) {
+            continue;
+        }
+        for (const std::unique_ptr<Block>& block : memoryTypeBlocks.second) {
+            allocated += block->size;
+        }
+    }
+
+    if (allocated + size > limit->second) {
+        throw std::runtime_error(fmt::format(
+          "Kompute MemoryPool allocation of {} bytes exceeds the limit of {} "
+          "bytes for heap {} with {} bytes allocated",
+          size,
+          limit->second,
+          heapIndex,
+          allocated));
+    }
+}
+
+int32_t
+MemoryPool::findMemoryTypeIndex(
+  uint32_t memoryTypeBits,
+  const vk::MemoryPropertyFlags& memoryPropertyFlags)
+{
+    for (uint32_t i = 0; i < this->mMemoryProperties.memoryTypeCount; i++) {
+        if (memoryTypeBits & (1 << i)) {
+            if (((this->mMemoryProperties.memoryTypes[i]).propertyFlags &
+                 memoryPropertyFlags) == memoryPropertyFlags) {
+                return i;
+            }
+        }
+    }
+    return -1;
+}
+
+MemoryPool::Block*
+MemoryPool::createBlock(uint32_t memoryTypeIndex,
+                        vk::DeviceSize size,
+                        bool dedicated)
+{
+    KP_LOG_DEBUG("Kompute MemoryPool allocating block memory index: {}, "
+                 "size {}, dedicated: {}",
+                 memoryTypeIndex,
+                 size,
+                 dedicated);
+
+    this->checkHeapLimit(memoryTypeIndex, size);
+
+    std::unique_ptr<Block> block{ new Block() };
+    block->size = size;
+    block->dedicated = dedicated;
+    block->freeRanges[0] = size;
+
+    // Buffers bound to the block can only retrieve their device address if
+    // the memory is allocated with it
+    vk::MemoryAllocateInfo memoryAllocateInfo(size, memoryTypeIndex);
+    vk::MemoryAllocateFlagsInfo allocateFlagsInfo(
+      vk::MemoryAllocateFlagBits::eDeviceAddress);
+    if (this->mBufferDeviceAddress) {
+        memoryAllocateInfo.setPNext(&allocateFlagsInfo);
+    }
+    vk::Result result = this->mDevice->allocateMemory(
+      &memoryAllocateInfo,
+      HostAllocator::callbacks(this->mHostAllocator),
+      &block->memory);
+    if (result != vk::Result::eSuccess) {
+        throw std::runtime_error(
+          fmt::format("Kompute MemoryPool failed to allocate block: {}",
+                      vk::to_string(result)));
+    }
+
+    if (this->mMemoryProperties.memoryTypes[memoryTypeIndex].propertyFlags &
+        vk::MemoryPropertyFlagBits::eHostVisible) {
+        block->mappedData = this->mDevice->mapMemory(
+          block->memory, 0, VK_WHOLE_SIZE, vk::MemoryMapFlags());
+    }
+
+    this->mBlocks[memoryTypeIndex].push_back(std::move(block));
+    return this->mBlocks[memoryTypeIndex].back().get();
+}
+
+void
+MemoryPool::freeBlock(Block& block)
+{
+    if (block.mappedData && !block.imported) {
+        this->mDevice->unmapMemory(block.memory);
+    }
+    block.mappedData = nullptr;
+    this->mDevice->freeMemory(
+      block.memory, HostAllocator::callbacks(this->mHostAllocator));
+    block.memory = nullptr;
+}
+
+bool
+MemoryPool::allocateFromBlock(Block& block,
+                              const vk::MemoryRequirements& memoryRequirements,
+                              Allocation& allocation)
+{
+    vk::DeviceSize alignment = std::max<vk::DeviceSize>(
+      memoryRequirements.alignment, 1);
+
+    for (auto it = block.freeRanges.begin(); it != block.freeRanges.end();
+         it++) {
+        vk::DeviceSize rangeOffset = it->first;
+        vk::DeviceSize rangeSize = it->second;
+        vk::DeviceSize alignedOffset =
+          (rangeOffset + alignment - 1) / alignment * alignment;
+        vk::DeviceSize padding = alignedOffset - rangeOffset;
+
+        if (padding + memoryRequirements.size > rangeSize) {
+            continue;
+        }
+
+        block.freeRanges.erase(it);
+        // The alignment padding stays free so it can still be merged back
+        if (padding > 0) {
+            block.freeRanges[rangeOffset] = padding;
+        }
+        vk::DeviceSize remaining = rangeSize - padding - memoryRequirements.size;
+        if (remaining > 0) {
+            block.freeRanges[alignedOffset + memoryRequirements.size] =
+              remaining;
+        }
+
+        allocation.memory = block.memory;
+        allocation.offset = alignedOffset;
+        allocation.size = memoryRequirements.size;
+        allocation.mappedData =
+          block.mappedData ? (uint8_t*)block.mappedData + alignedOffset
+                           : nullptr;
+        return true;
+    }
+
+    return false;
+}
+
+}
@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "kompute/Metrics.hpp"
+
+namespace kp {
+
+Metrics::Snapshot
+Metrics::snapshot() const
+{
+    Snapshot snapshot;
+    snapshot.submissions = this->get(Counter::eSubmissions);
+    snapshot.commandBuffersRecorded =
+      this->get(Counter::eCommandBuffersRecorded);
+    snapshot.barriers = this->get(Counter::eBarriers);
+    snapshot.bytesUploaded = this->get(Counter::eBytesUploaded);
+    snapshot.bytesDownloaded = this->get(Counter::eBytesDownloaded);
+    snapshot.pipelinesCreated = this->get(Counter::ePipelinesCreated);
+    snapshot.pipelineCacheHits = this->get(Counter::ePipelineCacheHits);
+    snapshot.descriptorSetsAllocated =
+      this->get(Counter::eDescriptorSetsAllocated);
+    snapshot.fenceWaits = this->get(Counter::eFenceWaits);
+    snapshot.fenceWaitNs = this->get(Counter::eFenceWaitNs);
+    return snapshot;
+}
+
+void
+Metrics::reset()
+{
+    KP_LOG_DEBUG("Kompute Metrics reset");
+
+    for (std::atomic<uint64_t>& counter : this->mCounters) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+}
+
+}
@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "kompute/MultiManager.hpp"
+#include "kompute/operations/OpAlgoDispatch.hpp"
+#include "kompute/operations/OpTensorSyncDevice.hpp"
+#include "kompute/operations/OpTensorSyncLocal.hpp"
+
+namespace kp {
+
+MultiManager::MultiManager(const std::vector<uint32_t>& physicalDeviceIndices,
+                           const std::vector<std::string>& desiredExtensions)
+{
+    KP_LOG_DEBUG("Kompute MultiManager constructor with {} devices",
+                 physicalDeviceIndices.size());
+
+    std::vector<uint32_t> deviceIndices = physicalDeviceIndices;
+    if (deviceIndices.empty()) {
+        // The first manager lists the devices of the instance
+        this->mManagers.push_back(std::make_shared<Manager>(
+          0, std::vector<uint32_t>(), desiredExtensions));
+        uint32_t deviceCount = this->mManagers[0]->listDevices().size();
+        for (uint32_t i = 0; i < deviceCount; i++) {
+            deviceIndices.push_back(i);
+        }
+    }
+
+    for (size_t i = this->mManagers.size(); i < deviceIndices.size(); i++) {
+        this->mManagers.push_back(std::make_shared<Manager>(
+          deviceIndices[i], std::vector<uint32_t>(), desiredExtensions));
+    }
+}
+
+MultiManager::~MultiManager()
+{
+    KP_LOG_DEBUG("Kompute MultiManager destructor started");
+    this->destroy();
+}
+
+uint32_t
+MultiManager::deviceCount()
+{
+    return this->mManagers.size();
+}
+
+std::shared_ptr<Manager>
+MultiManager::manager(uint32_t deviceIndex)
+{
+    if (deviceIndex >= this->mManagers.size()) {
+        throw std::runtime_error(
+          fmt::format("Kompute MultiManager device index {} out of range for "
+                      "{} devices",
+                      deviceIndex,
+                      this->mManagers.size()));
+    }
+    return this->mManagers[deviceIndex];
+}
+
+std::vector<std::shared_ptr<Algorithm>>
+MultiManager::algorithm(
+  const std::vector<std::shared_ptr<ShardedTensor>>& tensors,
+  const std::vector<uint32_t>& spirv,
+  const Workgroup& workgroup,
+  const std::vector<float>& specializationConstants,
+  const std::vector<float>& pushConstants)
+{
+    KP_LOG_DEBUG("Kompute MultiManager algorithm creation triggered");
+
+    std::vector<std::shared_ptr<Algorithm>> algorithms;
+    for (uint32_t i = 0; i < this->mManagers.size(); i++) {
+        algorithms.push_back(
+          this->mManagers[i]->algorithm(this->deviceShards(tensors, i),
+                                        spirv,
+                                        workgroup,
+                                        specializationConstants,
+                                        pushConstants));
+    }
+    return algorithms;
+}
+
+void
+MultiManager::syncDevice(
+  const std::vector<std::shared_ptr<ShardedTensor>>& tensors)
+{
+    this->evalOnDevices(
+      [this, &tensors](uint32_t i, std::shared_ptr<Sequence> sequence) {
+          sequence->record<OpTensorSyncDevice>(this->deviceShards(tensors, i));
+      });
+}
+
+void
+MultiManager::syncLocal(
+  const std::vector<std::shared_ptr<ShardedTensor>>& tensors)
+{
+    this->evalOnDevices(
+      [this, &tensors](uint32_t i, std::shared_ptr<Sequence> sequence) {
+          sequence->record<OpTensorSyncLocal>(this->deviceShards(tensors, i));
+      });
+}
+
+void
+MultiManager::dispatch(
+  const std::vector<std::shared_ptr<Algorithm>>& algorithms)
+{
+    if (algorithms.size() != this->mManagers.size()) {
+        throw std::runtime_error(
+          fmt::format("Kompute MultiManager expected an algorithm for each of "
+                      "the {} devices but got {}",
+                      this->mManagers.size(),
+                      algorithms.size()));
+    }
+
+    this->evalOnDevices(
+      [&algorithms](uint32_t i, std::shared_ptr<Sequence> sequence) {
+          sequence->record<OpAlgoDispatch>(algorithms[i]);
+      });
+}
+
+void
+MultiManager::destroy()
+{
+    KP_LOG_DEBUG("Kompute MultiManager destroy() started");
+
+    for (const std::shared_ptr<Manager>& manager : this->mManagers) {
+        manager->destroy();
+    }
+    this->mManagers.clear();
+}
+
+std::vector<std::shared_ptr<Tensor>>
+MultiManager::deviceShards(
+  const std::vector<std::shared_ptr<ShardedTensor>>& tensors,
+  uint32_t deviceIndex)
+{
+    std::vector<std::shared_ptr<Tensor>> shards;
+    for (const std::shared_ptr<ShardedTensor>& tensor : tensors) {
+        if (tensor->shards().size() != this->mManagers.size()) {
+            throw std::runtime_error(
+              "Kompute MultiManager tensor was sharded across different "
+              "devices");
+        }
+        shards.push_back(tensor->shard(deviceIndex));
+    }
+    return shards;
+}
+
+void
+MultiManager::evalOnDevices(
+  const std::function<void(uint32_t, std::shared_ptr<Sequence>)>& record)
+{
+    // Every device is submitted to before waiting for any of them, so the
+    // devices run at the same time
+    std::vector<std::shared_ptr<Sequence>> sequences;
+    for (uint32_t i = 0; i < this->mManagers.size(); i++) {
+        std::shared_ptr<Sequence> sequence = this->mManagers[i]->sequence();
+        record(i, sequence);
+        sequence->evalAsync();
+        sequences.push_back(sequence);
+    }
+    for (const std::shared_ptr<Sequence>& sequence : sequences) {
+        sequence->evalAwait();
+    }
+}
+
+}
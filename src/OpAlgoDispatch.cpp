@@ -8,28 +8,12 @@ namespace kp {
 OpAlgoDispatch::~OpAlgoDispatch()
 {
     KP_LOG_DEBUG("Kompute OpAlgoDispatch destructor started");
-
-    if (this->mPushConstantsData) {
-        KP_LOG_DEBUG("Kompute freeing push constants data");
-        free(this->mPushConstantsData);
-    }
 }
 
 void
 OpAlgoDispatch::record(const vk::CommandBuffer& commandBuffer)
 {
-    KP_LOG_DEBUG("Kompute OpAlgoDispatch record called");
-
-    // Barrier to ensure the data is finished writing to buffer memory
-    for (const std::shared_ptr<Tensor>& tensor :
-         this->mAlgorithm->getTensors()) {
-        tensor->recordPrimaryBufferMemoryBarrier(
-          commandBuffer,
-          vk::AccessFlagBits::eTransferWrite,
-          vk::AccessFlagBits::eShaderRead,
-          vk::PipelineStageFlagBits::eTransfer,
-          vk::PipelineStageFlagBits::eComputeShader);
-    }
+    KP_LOG_OPERATION("Kompute OpAlgoDispatch record called");
 
     if (this->mPushConstantsSize) {
         this->mAlgorithm->setPushConstants(
@@ -46,13 +30,52 @@ OpAlgoDispatch::record(const vk::CommandBuffer& commandBuffer)
 void
 OpAlgoDispatch::preEval(const vk::CommandBuffer& commandBuffer)
 {
-    KP_LOG_DEBUG("Kompute OpAlgoDispatch preEval called");
+    KP_LOG_OPERATION("Kompute OpAlgoDispatch preEval called");
 }
 
 void
 OpAlgoDispatch::postEval(const vk::CommandBuffer& commandBuffer)
 {
-    KP_LOG_DEBUG("Kompute OpAlgoDispatch postSubmit called");
+    KP_LOG_OPERATION("Kompute OpAlgoDispatch postSubmit called");
+}
+
+void
+OpAlgoDispatch::setPushConstants(const void* data,
+                                 uint32_t size,
+                                 uint32_t memorySize)
+{
+    uint32_t totalSize = size * memorySize;
+    if (totalSize > KOMPUTE_MAX_PUSH_CONSTANTS_SIZE) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpAlgoDispatch push constants of {} bytes "
+                      "exceed the maximum of {} bytes",
+                      totalSize,
+                      KOMPUTE_MAX_PUSH_CONSTANTS_SIZE));
+    }
+
+    memcpy(this->mPushConstantsData, data, totalSize);
+    this->mPushConstantsDataTypeMemorySize = memorySize;
+    this->mPushConstantsSize = size;
+}
+
+std::vector<OpBase::TensorAccess>
+OpAlgoDispatch::tensorAccesses()
+{
+    std::vector<TensorAccess> accesses;
+    for (const std::shared_ptr<Tensor>& tensor :
+         this->mAlgorithm->getTensors()) {
+        if (tensor->tensorType() == Tensor::TensorTypes::eUniform) {
+            accesses.push_back({ tensor,
+                                 vk::PipelineStageFlagBits::eComputeShader,
+                                 vk::AccessFlagBits::eUniformRead });
+        } else {
+            accesses.push_back({ tensor,
+                                 vk::PipelineStageFlagBits::eComputeShader,
+                                 vk::AccessFlagBits::eShaderRead |
+                                   vk::AccessFlagBits::eShaderWrite });
+        }
+    }
+    return accesses;
 }
 
 }
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "kompute/operations/OpAlgoDispatchBatch.hpp"
+
+namespace kp {
+
+OpAlgoDispatchBatch::~OpAlgoDispatchBatch()
+{
+    KP_LOG_DEBUG("Kompute OpAlgoDispatchBatch destructor started");
+}
+
+void
+OpAlgoDispatchBatch::record(const vk::CommandBuffer& commandBuffer)
+{
+    KP_LOG_OPERATION("Kompute OpAlgoDispatchBatch record called with {} "
+                     "dispatches",
+                     this->mDispatchCount);
+
+    this->mAlgorithm->recordBindCore(commandBuffer);
+
+    // Writes of every dispatch are made visible to the next one
+    vk::MemoryBarrier memoryBarrier(vk::AccessFlagBits::eShaderWrite,
+                                    vk::AccessFlagBits::eShaderRead |
+                                      vk::AccessFlagBits::eShaderWrite);
+
+    for (uint32_t i = 0; i < this->mDispatchCount; i++) {
+        if (i && this->mBarrierBetweenDispatches) {
+            commandBuffer.pipelineBarrier(
+              vk::PipelineStageFlagBits::eComputeShader,
+              vk::PipelineStageFlagBits::eComputeShader,
+              vk::DependencyFlags(),
+              memoryBarrier,
+              nullptr,
+              nullptr);
+        }
+
+        this->mAlgorithm->recordPushConstants(
+          commandBuffer,
+          this->mPushConstantsBatch.data() + i * this->mDispatchMemorySize,
+          this->mDispatchMemorySize);
+        this->mAlgorithm->recordDispatch(commandBuffer);
+    }
+}
+
+uint32_t
+OpAlgoDispatchBatch::dispatchCount()
+{
+    return this->mDispatchCount;
+}
+
+}
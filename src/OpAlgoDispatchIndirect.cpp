@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "kompute/operations/OpAlgoDispatchIndirect.hpp"
+
+namespace kp {
+
+OpAlgoDispatchIndirect::~OpAlgoDispatchIndirect()
+{
+    KP_LOG_DEBUG("Kompute OpAlgoDispatchIndirect destructor started");
+}
+
+void
+OpAlgoDispatchIndirect::record(const vk::CommandBuffer& commandBuffer)
+{
+    KP_LOG_OPERATION("Kompute OpAlgoDispatchIndirect record called");
+
+    if (this->mPushConstantsSize) {
+        this->mAlgorithm->setPushConstants(
+          this->mPushConstantsData,
+          this->mPushConstantsSize,
+          this->mPushConstantsDataTypeMemorySize);
+    }
+
+    this->mAlgorithm->recordBindCore(commandBuffer);
+    this->mAlgorithm->recordBindPush(commandBuffer);
+    this->mAlgorithm->recordDispatchIndirect(
+      commandBuffer, this->mIndirectTensor, this->mOffset);
+}
+
+std::vector<OpBase::TensorAccess>
+OpAlgoDispatchIndirect::tensorAccesses()
+{
+    std::vector<TensorAccess> accesses = OpAlgoDispatch::tensorAccesses();
+    accesses.push_back({ this->mIndirectTensor,
+                         vk::PipelineStageFlagBits::eDrawIndirect,
+                         vk::AccessFlagBits::eIndirectCommandRead });
+    return accesses;
+}
+
+}
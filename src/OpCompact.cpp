@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "kompute/operations/OpCompact.hpp"
+
+namespace kp {
+
+OpCompact::OpCompact(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                     const std::shared_ptr<Algorithm>& algorithm,
+                     uint32_t indirectLocalSize)
+  : OpScan(algorithm)
+{
+    KP_LOG_DEBUG("Kompute OpCompact constructor with params");
+
+    if (tensors.size() != 5) {
+        throw std::runtime_error(fmt::format(
+          "Kompute OpCompact expected 5 tensors but got {}", tensors.size()));
+    }
+
+    const std::shared_ptr<Tensor>& values = tensors[0];
+    const std::shared_ptr<Tensor>& flags = tensors[1];
+    const std::shared_ptr<Tensor>& output = tensors[2];
+    const std::shared_ptr<Tensor>& count = tensors[3];
+
+    if (values->dataTypeMemorySize() != sizeof(uint32_t)) {
+        throw std::runtime_error(
+          "Kompute OpCompact values tensor must be a 32-bit tensor");
+    }
+    if (!values->size()) {
+        throw std::runtime_error("Kompute OpCompact values tensor is empty");
+    }
+    if ((flags->dataType() != Tensor::TensorDataTypes::eInt &&
+         flags->dataType() != Tensor::TensorDataTypes::eUnsignedInt) ||
+        flags->size() != values->size()) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpCompact flags tensor must be an int32 or "
+                      "uint32 tensor of {} elements",
+                      values->size()));
+    }
+    if (output->dataType() != values->dataType() ||
+        output->size() < values->size()) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpCompact output tensor must have the data "
+                      "type of the values and at least {} elements",
+                      values->size()));
+    }
+    if (count->dataType() != Tensor::TensorDataTypes::eUnsignedInt ||
+        count->size() < 4) {
+        throw std::runtime_error("Kompute OpCompact count tensor must be a "
+                                 "uint32 tensor of at least 4 elements");
+    }
+    for (const std::shared_ptr<Tensor>& tensor : tensors) {
+        if (tensor->tensorType() == Tensor::TensorTypes::eUniform) {
+            throw std::runtime_error(
+              "Kompute OpCompact tensors cannot be uniform tensors");
+        }
+    }
+    if (!indirectLocalSize) {
+        throw std::runtime_error(
+          "Kompute OpCompact indirect local size cannot be zero");
+    }
+
+    std::vector<uint32_t> spirv(
+      (uint32_t*)shader_data::shaders_glsl_opcompact_comp_spv,
+      (uint32_t*)(shader_data::shaders_glsl_opcompact_comp_spv +
+                  shader_data::shaders_glsl_opcompact_comp_spv_len));
+
+    this->setupPasses(
+      tensors[4], values->size(), { 0, indirectLocalSize }, "OpCompact");
+
+    algorithm->rebuild<uint32_t, uint32_t>(tensors,
+                                           spirv,
+                                           this->mBlockWorkgroup,
+                                           {},
+                                           this->mPassPushConstants);
+}
+
+OpCompact::~OpCompact()
+{
+    KP_LOG_DEBUG("Kompute OpCompact destructor started");
+}
+
+}
@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "kompute/operations/OpConv2D.hpp"
+
+namespace kp {
+
+OpConv2D::OpConv2D(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                   const std::shared_ptr<Algorithm>& algorithm,
+                   uint32_t batch,
+                   uint32_t inChannels,
+                   uint32_t inHeight,
+                   uint32_t inWidth,
+                   uint32_t outChannels,
+                   uint32_t kernelHeight,
+                   uint32_t kernelWidth,
+                   uint32_t stride,
+                   uint32_t padding,
+                   Layout layout,
+                   Activation activation,
+                   float alpha,
+                   uint32_t tileSize)
+  : OpAlgoDispatch(algorithm)
+{
+    KP_LOG_DEBUG("Kompute OpConv2D constructor with params");
+
+    if (tensors.size() != 3 && tensors.size() != 4) {
+        throw std::runtime_error(fmt::format(
+          "Kompute OpConv2D expected 3 or 4 tensors but got {}",
+          tensors.size()));
+    }
+    for (const std::shared_ptr<Tensor>& tensor : tensors) {
+        if (tensor->dataType() != Tensor::TensorDataTypes::eFloat) {
+            throw std::runtime_error(
+              "Kompute OpConv2D tensors must be float tensors");
+        }
+    }
+
+    uint32_t outHeight =
+      OpConv2D::outputSize(inHeight, kernelHeight, stride, padding);
+    uint32_t outWidth =
+      OpConv2D::outputSize(inWidth, kernelWidth, stride, padding);
+    if (!batch || !inChannels || !outChannels || !stride || !outHeight ||
+        !outWidth) {
+        throw std::runtime_error(fmt::format(
+          "Kompute OpConv2D invalid dimensions batch {} channels {} to {} "
+          "input {}x{} kernel {}x{} stride {} padding {}",
+          batch,
+          inChannels,
+          outChannels,
+          inHeight,
+          inWidth,
+          kernelHeight,
+          kernelWidth,
+          stride,
+          padding));
+    }
+
+    if (!tileSize) {
+        tileSize = KOMPUTE_MATMUL_DEFAULT_TILE_SIZE;
+    }
+    if (tileSize < KOMPUTE_MATMUL_WORK_PER_THREAD ||
+        tileSize > KOMPUTE_MATMUL_MAX_TILE_SIZE ||
+        (tileSize & (tileSize - 1))) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpConv2D tile size {} is not a power of two "
+                      "between {} and {}",
+                      tileSize,
+                      KOMPUTE_MATMUL_WORK_PER_THREAD,
+                      KOMPUTE_MATMUL_MAX_TILE_SIZE));
+    }
+
+    bool hasBias = tensors.size() == 4;
+    uint32_t k = inChannels * kernelHeight * kernelWidth;
+    uint32_t pixels = outHeight * outWidth;
+
+    const std::array<uint64_t, 4> sizes = {
+        (uint64_t)batch * inChannels * inHeight * inWidth,
+        (uint64_t)outChannels * k,
+        outChannels,
+        (uint64_t)batch * outChannels * pixels,
+    };
+    const std::array<const char*, 4> names = {
+        "input", "weights", "bias", "output"
+    };
+    for (size_t i = 0; i < tensors.size(); i++) {
+        size_t tensorIndex = hasBias || i < 2 ? i : i + 1;
+        if (tensors[i]->size() < sizes[tensorIndex]) {
+            throw std::runtime_error(
+              fmt::format("Kompute OpConv2D {} tensor of {} elements "
+                          "requires {} elements",
+                          names[tensorIndex],
+                          tensors[i]->size(),
+                          sizes[tensorIndex]));
+        }
+    }
+
+    this->mTensors = tensors;
+
+    // Without a bias the weights are also bound to the unused bias binding
+    std::vector<std::shared_ptr<Tensor>> algorithmTensors = tensors;
+    if (!hasBias) {
+        algorithmTensors.insert(algorithmTensors.begin() + 2, tensors[1]);
+    }
+
+    // A relu is a leaky relu that zeroes the negative outputs
+    float slope = activation == Activation::eRelu ? 0.0f : alpha;
+    uint32_t slopeBits;
+    std::memcpy(&slopeBits, &slope, sizeof(slopeBits));
+
+    // Matches the push constants of the shader, whose last member is the
+    // float slope of the activation
+    const std::array<uint32_t, 12> pushConstants = {
+        inChannels, inHeight, inWidth, outChannels, outHeight, outWidth,
+        stride,     stride,   padding, padding,     k,         slopeBits,
+    };
+
+    std::vector<uint32_t> spirv(
+      (uint32_t*)shader_data::shaders_glsl_opconv2d_comp_spv,
+      (uint32_t*)(shader_data::shaders_glsl_opconv2d_comp_spv +
+                  kp::shader_data::shaders_glsl_opconv2d_comp_spv_len));
+
+    uint32_t rows = tileSize / KOMPUTE_MATMUL_WORK_PER_THREAD;
+    uint32_t pixelTiles = (pixels + tileSize - 1) / tileSize;
+    Workgroup workgroup = {
+        (outChannels + tileSize - 1) / tileSize,
+        std::min<uint32_t>(pixelTiles, KOMPUTE_CONV2D_MAX_WORKGROUPS),
+        batch
+    };
+
+    algorithm->rebuild<uint32_t, uint32_t>(
+      algorithmTensors,
+      spirv,
+      workgroup,
+      { tileSize,
+        rows,
+        KOMPUTE_MATMUL_WORK_PER_THREAD,
+        kernelHeight,
+        kernelWidth,
+        layout == Layout::eNHWC ? 1u : 0u,
+        activation == Activation::eNone ? 0u : 1u,
+        hasBias ? 1u : 0u },
+      std::vector<uint32_t>(pushConstants.begin(), pushConstants.end()));
+
+    this->setPushConstants(
+      pushConstants.data(), pushConstants.size(), sizeof(uint32_t));
+}
+
+OpConv2D::~OpConv2D()
+{
+    KP_LOG_DEBUG("Kompute OpConv2D destructor started");
+}
+
+std::vector<OpBase::TensorAccess>
+OpConv2D::tensorAccesses()
+{
+    std::vector<TensorAccess> accesses;
+    for (size_t i = 0; i + 1 < this->mTensors.size(); i++) {
+        accesses.push_back({ this->mTensors[i],
+                             vk::PipelineStageFlagBits::eComputeShader,
+                             vk::AccessFlagBits::eShaderRead });
+    }
+    accesses.push_back({ this->mTensors.back(),
+                         vk::PipelineStageFlagBits::eComputeShader,
+                         vk::AccessFlagBits::eShaderWrite });
+    return accesses;
+}
+
+uint32_t
+OpConv2D::outputSize(uint32_t inSize,
+                     uint32_t kernelSize,
+                     uint32_t stride,
+                     uint32_t padding)
+{
+    uint32_t paddedSize = inSize + 2 * padding;
+    if (!kernelSize || !stride || kernelSize > paddedSize) {
+        return 0;
+    }
+    return (paddedSize - kernelSize) / stride + 1;
+}
+
+}
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+
+#include "kompute/operations/OpExpression.hpp"
+
+namespace kp {
+
+OpExpression::OpExpression(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                           const std::shared_ptr<Algorithm>& algorithm,
+                           const Expression& expression)
+  : OpAlgoDispatch(algorithm)
+{
+    KP_LOG_DEBUG("Kompute OpExpression constructor with params");
+
+    if (tensors.size() != 1) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpExpression expected 1 tensor but got {}",
+                      tensors.size()));
+    }
+
+    this->mOutput = tensors[0];
+    this->mInputs = expression.tensors();
+
+    if (this->mOutput->dataType() != Tensor::TensorDataTypes::eFloat ||
+        !this->mOutput->size()) {
+        throw std::runtime_error("Kompute OpExpression output tensor must be "
+                                 "a non empty float tensor");
+    }
+    if (this->mOutput->tensorType() == Tensor::TensorTypes::eUniform) {
+        throw std::runtime_error(
+          "Kompute OpExpression output tensor cannot be a uniform tensor");
+    }
+    for (const std::shared_ptr<Tensor>& input : this->mInputs) {
+        if (input->dataType() != Tensor::TensorDataTypes::eFloat ||
+            input->size() != this->mOutput->size()) {
+            throw std::runtime_error(fmt::format(
+              "Kompute OpExpression tensors must be float tensors of {} "
+              "elements",
+              this->mOutput->size()));
+        }
+        if (input->tensorType() == Tensor::TensorTypes::eUniform) {
+            throw std::runtime_error(
+              "Kompute OpExpression tensors cannot be uniform tensors");
+        }
+    }
+
+    std::vector<float> constants = expression.constants();
+    if (constants.size() * sizeof(float) > KOMPUTE_MAX_PUSH_CONSTANTS_SIZE) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpExpression {} constants exceed the {} bytes "
+                      "of push constants",
+                      constants.size(),
+                      KOMPUTE_MAX_PUSH_CONSTANTS_SIZE));
+    }
+
+    std::vector<std::shared_ptr<Tensor>> algorithmTensors = { this->mOutput };
+    algorithmTensors.insert(
+      algorithmTensors.end(), this->mInputs.begin(), this->mInputs.end());
+
+    // One invocation per element with the local size of the algorithm
+    algorithm->rebuild<float, float>(
+      algorithmTensors, expression.spirv(), {}, {}, constants);
+}
+
+OpExpression::~OpExpression()
+{
+    KP_LOG_DEBUG("Kompute OpExpression destructor started");
+}
+
+std::vector<OpBase::TensorAccess>
+OpExpression::tensorAccesses()
+{
+    std::vector<TensorAccess> accesses;
+    bool outputRead = false;
+    for (const std::shared_ptr<Tensor>& input : this->mInputs) {
+        if (input == this->mOutput) {
+            outputRead = true;
+            continue;
+        }
+        accesses.push_back({ input,
+                             vk::PipelineStageFlagBits::eComputeShader,
+                             vk::AccessFlagBits::eShaderRead });
+    }
+
+    vk::AccessFlags outputAccesses = vk::AccessFlagBits::eShaderWrite;
+    if (outputRead) {
+        outputAccesses |= vk::AccessFlagBits::eShaderRead;
+    }
+    accesses.push_back({ this->mOutput,
+                         vk::PipelineStageFlagBits::eComputeShader,
+                         outputAccesses });
+    return accesses;
+}
+
+}
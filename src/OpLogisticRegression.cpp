@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <array>
+#include <cstring>
+
+#include "kompute/operations/OpLogisticRegression.hpp"
+
+namespace kp {
+
+OpLogisticRegression::OpLogisticRegression(
+  const std::vector<std::shared_ptr<Tensor>>& tensors,
+  const std::shared_ptr<Algorithm>& algorithm,
+  uint32_t epochs,
+  float learningRate)
+  : OpAlgoDispatch(algorithm)
+{
+    KP_LOG_DEBUG("Kompute OpLogisticRegression constructor with params");
+
+    if (tensors.size() != 5) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpLogisticRegression expected 5 tensors but "
+                      "got {}",
+                      tensors.size()));
+    }
+    for (const std::shared_ptr<Tensor>& tensor : tensors) {
+        if (tensor->dataType() != Tensor::TensorDataTypes::eFloat) {
+            throw std::runtime_error(
+              "Kompute OpLogisticRegression tensors must be float tensors");
+        }
+    }
+    for (size_t i = 2; i < tensors.size(); i++) {
+        if (tensors[i]->tensorType() == Tensor::TensorTypes::eUniform) {
+            throw std::runtime_error("Kompute OpLogisticRegression weights, "
+                                     "bias and loss cannot be uniform tensors");
+        }
+    }
+
+    uint32_t samples = tensors[1]->size();
+    uint32_t features = tensors[2]->size();
+    if (!samples || !features || !tensors[3]->size() ||
+        !tensors[4]->size()) {
+        throw std::runtime_error(
+          "Kompute OpLogisticRegression tensors cannot be empty");
+    }
+    if (tensors[0]->size() != (uint64_t)samples * features) {
+        throw std::runtime_error(fmt::format(
+          "Kompute OpLogisticRegression samples tensor of {} elements does "
+          "not hold {} samples of {} features",
+          tensors[0]->size(),
+          samples,
+          features));
+    }
+    if (!epochs) {
+        throw std::runtime_error(
+          "Kompute OpLogisticRegression requires at least one epoch");
+    }
+
+    this->mTensors = tensors;
+
+    const unsigned char* shaderData =
+      shader_data::shaders_glsl_oplogisticregression_comp_spv;
+    const unsigned int shaderDataLen =
+      shader_data::shaders_glsl_oplogisticregression_comp_spv_len;
+    std::vector<uint32_t> spirv((uint32_t*)shaderData,
+                                (uint32_t*)(shaderData + shaderDataLen));
+
+    // Matches the push constants of the shader, whose second member is the
+    // float learning rate
+    uint32_t learningRateBits;
+    std::memcpy(&learningRateBits, &learningRate, sizeof(learningRateBits));
+    const std::array<uint32_t, 2> pushConstants = { epochs, learningRateBits };
+
+    // A single workgroup runs every epoch
+    algorithm->rebuild<uint32_t, uint32_t>(
+      tensors,
+      spirv,
+      Workgroup({ 1, 1, 1 }),
+      { features },
+      std::vector<uint32_t>(pushConstants.begin(), pushConstants.end()));
+
+    uint32_t localSize = algorithm->getLocalSizeX();
+    if (!localSize || localSize > KOMPUTE_LOGISTIC_REGRESSION_MAX_LOCAL_SIZE) {
+        throw std::runtime_error(fmt::format(
+          "Kompute OpLogisticRegression local size {} is not between 1 and {}",
+          localSize,
+          KOMPUTE_LOGISTIC_REGRESSION_MAX_LOCAL_SIZE));
+    }
+
+    this->setPushConstants(
+      pushConstants.data(), pushConstants.size(), sizeof(uint32_t));
+}
+
+OpLogisticRegression::~OpLogisticRegression()
+{
+    KP_LOG_DEBUG("Kompute OpLogisticRegression destructor started");
+}
+
+std::vector<OpBase::TensorAccess>
+OpLogisticRegression::tensorAccesses()
+{
+    return {
+        { this->mTensors[0],
+          vk::PipelineStageFlagBits::eComputeShader,
+          vk::AccessFlagBits::eShaderRead },
+        { this->mTensors[1],
+          vk::PipelineStageFlagBits::eComputeShader,
+          vk::AccessFlagBits::eShaderRead },
+        { this->mTensors[2],
+          vk::PipelineStageFlagBits::eComputeShader,
+          vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite },
+        { this->mTensors[3],
+          vk::PipelineStageFlagBits::eComputeShader,
+          vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite },
+        { this->mTensors[4],
+          vk::PipelineStageFlagBits::eComputeShader,
+          vk::AccessFlagBits::eShaderWrite },
+    };
+}
+
+}
@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <array>
+
+#include "kompute/operations/OpMatMul.hpp"
+
+namespace kp {
+
+OpMatMul::OpMatMul(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                   const std::shared_ptr<Algorithm>& algorithm,
+                   uint32_t m,
+                   uint32_t n,
+                   uint32_t k,
+                   bool transposeA,
+                   bool transposeB,
+                   uint32_t batchCount,
+                   uint32_t tileSize)
+  : OpAlgoDispatch(algorithm)
+{
+    KP_LOG_DEBUG("Kompute OpMatMul constructor with params");
+
+    if (tensors.size() != 3) {
+        throw std::runtime_error(fmt::format(
+          "Kompute OpMatMul expected 3 tensors but got {}", tensors.size()));
+    }
+    for (const std::shared_ptr<Tensor>& tensor : tensors) {
+        if (tensor->dataType() != Tensor::TensorDataTypes::eFloat) {
+            throw std::runtime_error(
+              "Kompute OpMatMul tensors must be float tensors");
+        }
+    }
+    if (!m || !n || !k || !batchCount) {
+        throw std::runtime_error(fmt::format(
+          "Kompute OpMatMul invalid dimensions m {} n {} k {} batch {}",
+          m,
+          n,
+          k,
+          batchCount));
+    }
+
+    if (!tileSize) {
+        tileSize = KOMPUTE_MATMUL_DEFAULT_TILE_SIZE;
+    }
+    if (tileSize < KOMPUTE_MATMUL_WORK_PER_THREAD ||
+        tileSize > KOMPUTE_MATMUL_MAX_TILE_SIZE ||
+        (tileSize & (tileSize - 1))) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpMatMul tile size {} is not a power of two "
+                      "between {} and {}",
+                      tileSize,
+                      KOMPUTE_MATMUL_WORK_PER_THREAD,
+                      KOMPUTE_MATMUL_MAX_TILE_SIZE));
+    }
+
+    const std::array<uint64_t, 3> sizes = { (uint64_t)m * k,
+                                            (uint64_t)k * n,
+                                            (uint64_t)m * n };
+    for (size_t i = 0; i < tensors.size(); i++) {
+        if (tensors[i]->size() < sizes[i] * batchCount) {
+            throw std::runtime_error(
+              fmt::format("Kompute OpMatMul tensor {} of {} elements cannot "
+                          "hold {} matrices of {} elements",
+                          i,
+                          tensors[i]->size(),
+                          batchCount,
+                          sizes[i]));
+        }
+    }
+
+    this->mTensors = tensors;
+
+    // Element strides of the rows and columns of op(A) and op(B) followed by
+    // the batch strides, matching the push constants of the shader
+    const std::array<uint32_t, 10> pushConstants = {
+        m,
+        n,
+        k,
+        transposeA ? 1 : k,
+        transposeA ? m : 1,
+        transposeB ? 1 : n,
+        transposeB ? k : 1,
+        m * k,
+        k * n,
+        m * n,
+    };
+
+    std::vector<uint32_t> spirv(
+      (uint32_t*)shader_data::shaders_glsl_opmatmul_comp_spv,
+      (uint32_t*)(shader_data::shaders_glsl_opmatmul_comp_spv +
+                  kp::shader_data::shaders_glsl_opmatmul_comp_spv_len));
+
+    // The local size is the tile size by the rows of the tile processed per
+    // pass of the invocations
+    uint32_t rows = tileSize / KOMPUTE_MATMUL_WORK_PER_THREAD;
+    Workgroup workgroup = { (n + tileSize - 1) / tileSize,
+                            (m + tileSize - 1) / tileSize,
+                            batchCount };
+
+    algorithm->rebuild<uint32_t, uint32_t>(
+      tensors,
+      spirv,
+      workgroup,
+      { tileSize, rows, KOMPUTE_MATMUL_WORK_PER_THREAD },
+      std::vector<uint32_t>(pushConstants.begin(), pushConstants.end()));
+
+    this->setPushConstants(
+      pushConstants.data(), pushConstants.size(), sizeof(uint32_t));
+}
+
+OpMatMul::~OpMatMul()
+{
+    KP_LOG_DEBUG("Kompute OpMatMul destructor started");
+}
+
+std::vector<OpBase::TensorAccess>
+OpMatMul::tensorAccesses()
+{
+    return {
+        { this->mTensors[0],
+          vk::PipelineStageFlagBits::eComputeShader,
+          vk::AccessFlagBits::eShaderRead },
+        { this->mTensors[1],
+          vk::PipelineStageFlagBits::eComputeShader,
+          vk::AccessFlagBits::eShaderRead },
+        { this->mTensors[2],
+          vk::PipelineStageFlagBits::eComputeShader,
+          vk::AccessFlagBits::eShaderWrite },
+    };
+}
+
+uint32_t
+OpMatMul::tileSizeForDevice(const vk::PhysicalDeviceProperties& properties)
+{
+    const vk::PhysicalDeviceLimits& limits = properties.limits;
+
+    // Both shared memory tiles are allocated at their maximum size
+    const uint32_t sharedMemorySize = 2 * KOMPUTE_MATMUL_MAX_TILE_SIZE *
+                                      KOMPUTE_MATMUL_MAX_TILE_SIZE *
+                                      sizeof(float);
+    if (sharedMemorySize > limits.maxComputeSharedMemorySize) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpMatMul requires {} bytes of shared memory "
+                      "but the device supports {}",
+                      sharedMemorySize,
+                      limits.maxComputeSharedMemorySize));
+    }
+
+    uint32_t tileSize = KOMPUTE_MATMUL_MAX_TILE_SIZE;
+    for (; tileSize > KOMPUTE_MATMUL_WORK_PER_THREAD; tileSize /= 2) {
+        uint32_t rows = tileSize / KOMPUTE_MATMUL_WORK_PER_THREAD;
+        if (tileSize * rows <= limits.maxComputeWorkGroupInvocations &&
+            tileSize <= limits.maxComputeWorkGroupSize[0] &&
+            rows <= limits.maxComputeWorkGroupSize[1]) {
+            break;
+        }
+    }
+    return tileSize;
+}
+
+}
@@ -30,38 +30,46 @@ OpMemoryBarrier::~OpMemoryBarrier()
 void
 OpMemoryBarrier::record(const vk::CommandBuffer& commandBuffer)
 {
-    KP_LOG_DEBUG("Kompute OpMemoryBarrier record called");
+    KP_LOG_OPERATION("Kompute OpMemoryBarrier record called");
 
-    // Barrier to ensure the data is finished writing to buffer memory
-    if (this->mBarrierOnPrimary) {
-        for (const std::shared_ptr<Tensor>& tensor : this->mTensors) {
-            tensor->recordPrimaryBufferMemoryBarrier(commandBuffer,
-                                                     this->mSrcAccessMask,
-                                                     this->mDstAccessMask,
-                                                     this->mSrcStageMask,
-                                                     this->mDstStageMask);
-        }
-    } else {
-        for (const std::shared_ptr<Tensor>& tensor : this->mTensors) {
-            tensor->recordStagingBufferMemoryBarrier(commandBuffer,
-                                                     this->mSrcAccessMask,
-                                                     this->mDstAccessMask,
-                                                     this->mSrcStageMask,
-                                                     this->mDstStageMask);
+    // Barrier to ensure the data is finished writing to buffer memory, with
+    // the barriers of all the tensors recorded in a single command
+    std::vector<vk::BufferMemoryBarrier> bufferMemoryBarriers;
+    std::vector<vk::ImageMemoryBarrier> imageMemoryBarriers;
+    for (const std::shared_ptr<Tensor>& tensor : this->mTensors) {
+        if (this->mBarrierOnPrimary &&
+            tensor->tensorType() == Tensor::TensorTypes::eImage) {
+            imageMemoryBarriers.push_back(tensor->createImageMemoryBarrier(
+              this->mSrcAccessMask, this->mDstAccessMask));
+        } else if (this->mBarrierOnPrimary) {
+            bufferMemoryBarriers.push_back(
+              tensor->createPrimaryBufferMemoryBarrier(this->mSrcAccessMask,
+                                                       this->mDstAccessMask));
+        } else {
+            bufferMemoryBarriers.push_back(
+              tensor->createStagingBufferMemoryBarrier(this->mSrcAccessMask,
+                                                       this->mDstAccessMask));
         }
     }
+
+    commandBuffer.pipelineBarrier(this->mSrcStageMask,
+                                  this->mDstStageMask,
+                                  vk::DependencyFlags(),
+                                  nullptr,
+                                  bufferMemoryBarriers,
+                                  imageMemoryBarriers);
 }
 
 void
 OpMemoryBarrier::preEval(const vk::CommandBuffer& commandBuffer)
 {
-    KP_LOG_DEBUG("Kompute OpMemoryBarrier preEval called");
+    KP_LOG_OPERATION("Kompute OpMemoryBarrier preEval called");
 }
 
 void
 OpMemoryBarrier::postEval(const vk::CommandBuffer& commandBuffer)
 {
-    KP_LOG_DEBUG("Kompute OpMemoryBarrier postSubmit called");
+    KP_LOG_OPERATION("Kompute OpMemoryBarrier postSubmit called");
 }
 
 }
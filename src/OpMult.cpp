@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+
+#include "kompute/Shader.hpp"
+#include "kompute/operations/OpMult.hpp"
+
+namespace kp {
+
+namespace {
+
+// Vectorized variant of shaders/glsl/opmult.comp, compiled in process when
+// Kompute is built with the shader compiler
+const char* VECTORIZED_SOURCE = R"(
+#version 450
+
+// Elementwise multiplication of float tensors. Each invocation multiplies
+// four consecutive elements at a time through the vec4 views of the tensors,
+// in a grid-stride loop so that a capped number of workgroups covers any
+// size. The elements past the last whole vec4, or every element when the
+// tensors are not aligned to a vec4, are multiplied one at a time.
+
+// The local size is specialized for the device
+layout (local_size_x_id = 3, local_size_y = 1, local_size_z = 1) in;
+
+// Whether the lhs or rhs holds a single value multiplied with every element
+layout (constant_id = 0) const uint BROADCAST_LHS = 0;
+layout (constant_id = 1) const uint BROADCAST_RHS = 0;
+// Whether the tensors are bound at offsets aligned to a vec4
+layout (constant_id = 2) const uint VECTORIZE = 1;
+
+layout(set = 0, binding = 0) readonly buffer tensorLhs {
+   float valuesLhs[ ];
+};
+
+layout(set = 0, binding = 0) readonly buffer tensorLhs4 {
+   vec4 valuesLhs4[ ];
+};
+
+layout(set = 0, binding = 1) readonly buffer tensorRhs {
+   float valuesRhs[ ];
+};
+
+layout(set = 0, binding = 1) readonly buffer tensorRhs4 {
+   vec4 valuesRhs4[ ];
+};
+
+layout(set = 0, binding = 2) writeonly buffer tensorOutput {
+   float valuesOutput[ ];
+};
+
+layout(set = 0, binding = 2) writeonly buffer tensorOutput4 {
+   vec4 valuesOutput4[ ];
+};
+
+void main()
+{
+    uint size = uint(valuesOutput.length());
+    uint size4 = VECTORIZE != 0 ? size / 4 : 0;
+    uint stride = gl_NumWorkGroups.x * gl_WorkGroupSize.x;
+
+    float lhsValue = 0.0;
+    if (BROADCAST_LHS != 0) {
+        lhsValue = valuesLhs[0];
+    }
+    float rhsValue = 0.0;
+    if (BROADCAST_RHS != 0) {
+        rhsValue = valuesRhs[0];
+    }
+
+    for (uint i = gl_GlobalInvocationID.x; i < size4; i += stride) {
+        vec4 lhs = vec4(lhsValue);
+        if (BROADCAST_LHS == 0) {
+            lhs = valuesLhs4[i];
+        }
+        vec4 rhs = vec4(rhsValue);
+        if (BROADCAST_RHS == 0) {
+            rhs = valuesRhs4[i];
+        }
+        valuesOutput4[i] = lhs * rhs;
+    }
+
+    for (uint i = size4 * 4 + gl_GlobalInvocationID.x; i < size; i += stride) {
+        float lhs = lhsValue;
+        if (BROADCAST_LHS == 0) {
+            lhs = valuesLhs[i];
+        }
+        float rhs = rhsValue;
+        if (BROADCAST_RHS == 0) {
+            rhs = valuesRhs[i];
+        }
+        valuesOutput[i] = lhs * rhs;
+    }
+}
+)";
+
+}
+
+OpMult::OpMult(std::vector<std::shared_ptr<Tensor>> tensors,
+               std::shared_ptr<Algorithm> algorithm)
+  : OpAlgoDispatch(algorithm)
+{
+    KP_LOG_DEBUG("Kompute OpMult constructor with params");
+
+    if (tensors.size() != 3) {
+        throw std::runtime_error(fmt::format(
+          "Kompute OpMult expected 3 tensors but got {}", tensors.size()));
+    }
+    for (const std::shared_ptr<Tensor>& tensor : tensors) {
+        if (tensor->dataType() != Tensor::TensorDataTypes::eFloat) {
+            throw std::runtime_error(
+              "Kompute OpMult tensors must be float tensors");
+        }
+    }
+
+    uint64_t size = tensors[2]->size();
+    if (!size) {
+        throw std::runtime_error("Kompute OpMult output tensor is empty");
+    }
+    // The shader indexes the elements with 32-bit unsigned integers
+    if (size > UINT32_MAX) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpMult output of {} elements is too large, "
+                      "tensors of 2^32 elements or more are not supported",
+                      size));
+    }
+    if (tensors[2]->tensorType() == Tensor::TensorTypes::eUniform) {
+        throw std::runtime_error(
+          "Kompute OpMult output tensor cannot be a uniform tensor");
+    }
+    // Without the compiler the prebuilt shader multiplies one element per
+    // invocation, which cannot broadcast
+    bool vectorized = Shader::compilerAvailable();
+    for (size_t i = 0; i < 2; i++) {
+        if (tensors[i]->size() == size) {
+            continue;
+        }
+        if (tensors[i]->size() != 1) {
+            throw std::runtime_error(fmt::format(
+              "Kompute OpMult input of {} elements must have the {} elements "
+              "of the output or a single element",
+              tensors[i]->size(),
+              size));
+        }
+        if (!vectorized) {
+            throw std::runtime_error(
+              "Kompute OpMult broadcasting a single element input requires "
+              "Kompute built with KOMPUTE_OPT_ENABLE_SHADER_COMPILER");
+        }
+    }
+
+    this->mTensors = tensors;
+
+    if (!vectorized) {
+        std::vector<uint32_t> spirv(
+          (uint32_t*)shader_data::shaders_glsl_opmult_comp_spv,
+          (uint32_t*)(shader_data::shaders_glsl_opmult_comp_spv +
+                      kp::shader_data::shaders_glsl_opmult_comp_spv_len));
+
+        algorithm->rebuild<>(
+          tensors, spirv, Workgroup({ static_cast<uint32_t>(size), 1, 1 }));
+        return;
+    }
+
+    // A single element input is broadcast to every element of the output
+    uint32_t broadcastLhs = size > 1 && tensors[0]->size() == 1 ? 1 : 0;
+    uint32_t broadcastRhs = size > 1 && tensors[1]->size() == 1 ? 1 : 0;
+
+    // The vec4 views of the tensors need their descriptors to be aligned to
+    // a vec4, which views of tensors are not always
+    uint32_t vectorize = 1;
+    for (const std::shared_ptr<Tensor>& tensor : tensors) {
+        if (tensor->bufferOffset() % (4 * sizeof(float))) {
+            vectorize = 0;
+        }
+    }
+
+    std::vector<uint32_t> spirv = Shader::compile(VECTORIZED_SOURCE);
+
+    algorithm->rebuild<uint32_t, uint32_t>(
+      tensors, spirv, {}, { broadcastLhs, broadcastRhs, vectorize }, {});
+
+    // Enough workgroups for one vec4 per invocation, up to the limit past
+    // which the invocations loop
+    uint32_t items = static_cast<uint32_t>(vectorize ? (size + 3) / 4 : size);
+    uint32_t localSize = std::max<uint32_t>(algorithm->getLocalSizeX(), 1);
+    uint32_t groups = std::min<uint32_t>((items + localSize - 1) / localSize,
+                                         KOMPUTE_MULT_MAX_WORKGROUPS);
+    algorithm->setWorkgroup({ groups, 1, 1 });
+}
+
+OpMult::~OpMult()
+{
+    KP_LOG_DEBUG("Kompute OpMult destructor started");
+}
+
+std::vector<OpBase::TensorAccess>
+OpMult::tensorAccesses()
+{
+    std::vector<TensorAccess> accesses;
+    bool outputRead = false;
+    for (size_t i = 0; i < 2; i++) {
+        if (this->mTensors[i] == this->mTensors[2]) {
+            outputRead = true;
+            continue;
+        }
+        accesses.push_back({ this->mTensors[i],
+                             vk::PipelineStageFlagBits::eComputeShader,
+                             vk::AccessFlagBits::eShaderRead });
+    }
+
+    vk::AccessFlags outputAccesses = vk::AccessFlagBits::eShaderWrite;
+    if (outputRead) {
+        outputAccesses |= vk::AccessFlagBits::eShaderRead;
+    }
+    accesses.push_back({ this->mTensors[2],
+                         vk::PipelineStageFlagBits::eComputeShader,
+                         outputAccesses });
+    return accesses;
+}
+
+}
@@ -0,0 +1,234 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+
+#include "kompute/operations/OpReduce.hpp"
+
+namespace kp {
+
+OpReduce::OpReduce(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                   const std::shared_ptr<Algorithm>& algorithm,
+                   Operation operation,
+                   bool subgroupArithmetic,
+                   bool syncLocal)
+  : OpAlgoDispatch(algorithm)
+{
+    KP_LOG_DEBUG("Kompute OpReduce constructor with params");
+
+    if (tensors.size() != 2) {
+        throw std::runtime_error(fmt::format(
+          "Kompute OpReduce expected 2 tensors but got {}", tensors.size()));
+    }
+
+    this->mInput = tensors[0];
+    this->mOutput = tensors[1];
+    this->mOperation = operation;
+    this->mSyncLocal = syncLocal;
+
+    // The argmax output holds the maximum and its index
+    Tensor::TensorDataTypes outputDataType = Tensor::TensorDataTypes::eFloat;
+    uint32_t outputSize = 1;
+    uint32_t operationIndex = 0;
+    switch (operation) {
+        case Operation::eSum:
+            operationIndex = 0;
+            break;
+        case Operation::eMin:
+            operationIndex = 1;
+            break;
+        case Operation::eMax:
+            operationIndex = 2;
+            break;
+        case Operation::eArgmax:
+            operationIndex = 2;
+            outputDataType = Tensor::TensorDataTypes::eUnsignedInt;
+            outputSize = 2;
+            break;
+        default:
+            throw std::runtime_error("Kompute OpReduce invalid operation");
+    }
+
+    if (this->mInput->dataType() != Tensor::TensorDataTypes::eFloat) {
+        throw std::runtime_error(
+          "Kompute OpReduce input tensor must be a float tensor");
+    }
+    if (!this->mInput->size()) {
+        throw std::runtime_error("Kompute OpReduce input tensor is empty");
+    }
+    // The shaders index the elements with 32-bit unsigned integers
+    if (this->mInput->size() > UINT32_MAX) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpReduce input tensor of {} elements is too "
+                      "large, tensors of 2^32 elements or more are not "
+                      "supported",
+                      this->mInput->size()));
+    }
+    if (this->mOutput->dataType() != outputDataType ||
+        this->mOutput->size() < outputSize) {
+        throw std::runtime_error(fmt::format(
+          "Kompute OpReduce output tensor must be a {} tensor of at least {} "
+          "elements",
+          outputDataType == Tensor::TensorDataTypes::eFloat ? "float"
+                                                            : "uint32",
+          outputSize));
+    }
+    // The output is initialised with a transfer fill
+    if (this->mOutput->tensorType() == Tensor::TensorTypes::eStorage ||
+        this->mOutput->tensorType() == Tensor::TensorTypes::eUniform) {
+        throw std::runtime_error("Kompute OpReduce output tensor cannot be a "
+                                 "storage or uniform tensor");
+    }
+
+    const unsigned char* shaderData =
+      subgroupArithmetic ? shader_data::shaders_glsl_opreduce_subgroup_comp_spv
+                         : shader_data::shaders_glsl_opreduce_comp_spv;
+    const unsigned int shaderDataLen =
+      subgroupArithmetic
+        ? shader_data::shaders_glsl_opreduce_subgroup_comp_spv_len
+        : shader_data::shaders_glsl_opreduce_comp_spv_len;
+
+    std::vector<uint32_t> spirv((uint32_t*)shaderData,
+                                (uint32_t*)(shaderData + shaderDataLen));
+
+    // The push constant selects the index pass of argmax
+    algorithm->rebuild<uint32_t, uint32_t>(
+      tensors, spirv, {}, { operationIndex }, { 0 });
+
+    uint32_t localSize = algorithm->getLocalSizeX();
+    if (!localSize || localSize > KOMPUTE_REDUCE_MAX_LOCAL_SIZE) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpReduce local size {} is not between 1 and {}",
+                      localSize,
+                      KOMPUTE_REDUCE_MAX_LOCAL_SIZE));
+    }
+
+    // Workgroups past the maximum are folded into a grid-stride loop
+    uint64_t workgroupCount =
+      (this->mInput->size() + localSize - 1) / localSize;
+    algorithm->setWorkgroup(
+      { static_cast<uint32_t>(std::min<uint64_t>(
+          workgroupCount, KOMPUTE_REDUCE_MAX_WORKGROUPS)),
+        1,
+        1 });
+
+    const uint32_t pass = 0;
+    this->setPushConstants(&pass, 1, sizeof(uint32_t));
+}
+
+OpReduce::~OpReduce()
+{
+    KP_LOG_DEBUG("Kompute OpReduce destructor started");
+}
+
+void
+OpReduce::record(const vk::CommandBuffer& commandBuffer)
+{
+    KP_LOG_OPERATION("Kompute OpReduce record called");
+
+    // Bits of 0.0, +infinity and -infinity, where the index of argmax is
+    // larger than any valid index
+    uint32_t identity = 0;
+    if (this->mOperation == Operation::eMin) {
+        identity = 0x7f800000;
+    } else if (this->mOperation == Operation::eMax ||
+               this->mOperation == Operation::eArgmax) {
+        identity = 0xff800000;
+    }
+
+    this->mOutput->recordFill(commandBuffer, identity);
+    this->mOutput->recordPrimaryBufferMemoryBarrier(
+      commandBuffer,
+      vk::AccessFlagBits::eTransferWrite,
+      vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite,
+      vk::PipelineStageFlagBits::eTransfer,
+      vk::PipelineStageFlagBits::eComputeShader);
+
+    OpAlgoDispatch::record(commandBuffer);
+
+    if (this->mOperation == Operation::eArgmax) {
+        this->mOutput->recordPrimaryBufferMemoryBarrier(
+          commandBuffer,
+          vk::AccessFlagBits::eShaderWrite,
+          vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite,
+          vk::PipelineStageFlagBits::eComputeShader,
+          vk::PipelineStageFlagBits::eComputeShader);
+
+        const uint32_t pass = 1;
+        this->mAlgorithm->recordPushConstants(
+          commandBuffer, &pass, sizeof(uint32_t));
+        this->mAlgorithm->recordDispatch(commandBuffer);
+    }
+
+    if (!this->mSyncLocal) {
+        return;
+    }
+
+    if (this->mOutput->tensorType() == Tensor::TensorTypes::eDevice &&
+        !this->mOutput->usesStagingRing()) {
+        this->mOutput->recordPrimaryBufferMemoryBarrier(
+          commandBuffer,
+          vk::AccessFlagBits::eShaderWrite,
+          vk::AccessFlagBits::eTransferRead,
+          vk::PipelineStageFlagBits::eComputeShader,
+          vk::PipelineStageFlagBits::eTransfer);
+        this->mOutput->recordCopyFromDeviceToStaging(commandBuffer);
+        this->mOutput->recordStagingBufferMemoryBarrier(
+          commandBuffer,
+          vk::AccessFlagBits::eTransferWrite,
+          vk::AccessFlagBits::eHostRead,
+          vk::PipelineStageFlagBits::eTransfer,
+          vk::PipelineStageFlagBits::eHost);
+    } else if (this->mOutput->tensorType() == Tensor::TensorTypes::eHost) {
+        this->mOutput->recordPrimaryBufferMemoryBarrier(
+          commandBuffer,
+          vk::AccessFlagBits::eShaderWrite,
+          vk::AccessFlagBits::eHostRead,
+          vk::PipelineStageFlagBits::eComputeShader,
+          vk::PipelineStageFlagBits::eHost);
+    }
+}
+
+void
+OpReduce::postEval(const vk::CommandBuffer& commandBuffer)
+{
+    KP_LOG_OPERATION("Kompute OpReduce postEval called");
+
+    if (!this->mSyncLocal) {
+        return;
+    }
+
+    if (this->mOutput->usesStagingRing()) {
+        this->mOutput->syncLocalWithStagingRing();
+    } else {
+        this->mOutput->invalidateMappedMemory();
+    }
+}
+
+std::vector<OpBase::TensorAccess>
+OpReduce::tensorAccesses()
+{
+    vk::PipelineStageFlags outputStages =
+      vk::PipelineStageFlagBits::eTransfer |
+      vk::PipelineStageFlagBits::eComputeShader;
+    vk::AccessFlags outputAccesses = vk::AccessFlagBits::eTransferWrite |
+                                     vk::AccessFlagBits::eShaderRead |
+                                     vk::AccessFlagBits::eShaderWrite;
+
+    if (this->mSyncLocal && !this->mOutput->usesStagingRing()) {
+        if (this->mOutput->tensorType() == Tensor::TensorTypes::eDevice) {
+            outputAccesses |= vk::AccessFlagBits::eTransferRead;
+        } else {
+            outputStages |= vk::PipelineStageFlagBits::eHost;
+            outputAccesses |= vk::AccessFlagBits::eHostRead;
+        }
+    }
+
+    return {
+        { this->mInput,
+          vk::PipelineStageFlagBits::eComputeShader,
+          vk::AccessFlagBits::eShaderRead },
+        { this->mOutput, outputStages, outputAccesses },
+    };
+}
+
+}
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+
+#include "kompute/operations/OpScan.hpp"
+
+namespace kp {
+
+OpScan::OpScan(const std::vector<std::shared_ptr<Tensor>>& tensors,
+               const std::shared_ptr<Algorithm>& algorithm,
+               bool inclusive)
+  : OpAlgoDispatch(algorithm)
+{
+    KP_LOG_DEBUG("Kompute OpScan constructor with params");
+
+    if (tensors.size() != 3) {
+        throw std::runtime_error(fmt::format(
+          "Kompute OpScan expected 3 tensors but got {}", tensors.size()));
+    }
+
+    const std::shared_ptr<Tensor>& input = tensors[0];
+    const std::shared_ptr<Tensor>& output = tensors[1];
+
+    Tensor::TensorDataTypes dataType = input->dataType();
+    if (dataType != Tensor::TensorDataTypes::eFloat &&
+        dataType != Tensor::TensorDataTypes::eInt &&
+        dataType != Tensor::TensorDataTypes::eUnsignedInt) {
+        throw std::runtime_error(
+          "Kompute OpScan input tensor must be a float, int32 or uint32 "
+          "tensor");
+    }
+    if (!input->size()) {
+        throw std::runtime_error("Kompute OpScan input tensor is empty");
+    }
+    if (output->dataType() != dataType || output->size() < input->size()) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpScan output tensor must have the data type "
+                      "of the input and at least {} elements",
+                      input->size()));
+    }
+    if (input->tensorType() == Tensor::TensorTypes::eUniform ||
+        output->tensorType() == Tensor::TensorTypes::eUniform) {
+        throw std::runtime_error(
+          "Kompute OpScan tensors cannot be uniform tensors");
+    }
+
+    std::vector<uint32_t> spirv(
+      (uint32_t*)shader_data::shaders_glsl_opscan_comp_spv,
+      (uint32_t*)(shader_data::shaders_glsl_opscan_comp_spv +
+                  shader_data::shaders_glsl_opscan_comp_spv_len));
+
+    this->setupPasses(tensors[2], input->size(), { 0 }, "OpScan");
+
+    uint32_t isFloat = dataType == Tensor::TensorDataTypes::eFloat;
+    algorithm->rebuild<uint32_t, uint32_t>(tensors,
+                                           spirv,
+                                           this->mBlockWorkgroup,
+                                           { isFloat, inclusive ? 1u : 0u },
+                                           this->mPassPushConstants);
+}
+
+OpScan::OpScan(const std::shared_ptr<Algorithm>& algorithm)
+  : OpAlgoDispatch(algorithm)
+{
+    KP_LOG_DEBUG("Kompute OpScan constructor for derived operation");
+}
+
+OpScan::~OpScan()
+{
+    KP_LOG_DEBUG("Kompute OpScan destructor started");
+}
+
+void
+OpScan::setupPasses(const std::shared_ptr<Tensor>& partials,
+                    uint32_t size,
+                    const std::vector<uint32_t>& pushConstants,
+                    const std::string& name)
+{
+    uint32_t blocks = OpScan::partialsSize(size);
+
+    if (partials->dataTypeMemorySize() != sizeof(uint32_t) ||
+        partials->size() < blocks) {
+        throw std::runtime_error(
+          fmt::format("Kompute {} partials tensor must be a 32-bit tensor of "
+                      "at least {} elements",
+                      name,
+                      blocks));
+    }
+    if (partials->tensorType() == Tensor::TensorTypes::eUniform) {
+        throw std::runtime_error(fmt::format(
+          "Kompute {} partials tensor cannot be a uniform tensor", name));
+    }
+
+    this->mPartials = partials;
+    this->mPassPushConstants = pushConstants;
+
+    // Blocks past the maximum are folded into a loop of every workgroup
+    this->mBlockWorkgroup = {
+        std::min<uint32_t>(blocks, KOMPUTE_SCAN_MAX_WORKGROUPS), 1, 1
+    };
+}
+
+void
+OpScan::record(const vk::CommandBuffer& commandBuffer)
+{
+    KP_LOG_OPERATION("Kompute OpScan record called");
+
+    this->mAlgorithm->recordBindCore(commandBuffer);
+
+    // The scan of the partials runs on a single workgroup
+    for (uint32_t pass = 0; pass < 3; pass++) {
+        if (pass) {
+            this->mPartials->recordPrimaryBufferMemoryBarrier(
+              commandBuffer,
+              vk::AccessFlagBits::eShaderWrite,
+              vk::AccessFlagBits::eShaderRead |
+                vk::AccessFlagBits::eShaderWrite,
+              vk::PipelineStageFlagBits::eComputeShader,
+              vk::PipelineStageFlagBits::eComputeShader);
+        }
+
+        this->mPassPushConstants[0] = pass;
+        this->mAlgorithm->recordPushConstants(
+          commandBuffer,
+          this->mPassPushConstants.data(),
+          this->mPassPushConstants.size() * sizeof(uint32_t));
+        this->mAlgorithm->recordDispatch(
+          commandBuffer,
+          pass == 1 ? Workgroup({ 1, 1, 1 }) : this->mBlockWorkgroup);
+    }
+}
+
+uint32_t
+OpScan::partialsSize(uint32_t size)
+{
+    return (size + KOMPUTE_SCAN_BLOCK_SIZE - 1) / KOMPUTE_SCAN_BLOCK_SIZE;
+}
+
+}
@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+
+#include "kompute/operations/OpSort.hpp"
+
+#include "kompute/Manager.hpp"
+
+namespace kp {
+
+OpSort::OpSort(const std::vector<std::shared_ptr<Tensor>>& tensors,
+               Manager& manager)
+  : OpAlgoDispatch(manager.algorithm())
+{
+    KP_LOG_DEBUG("Kompute OpSort constructor with params");
+
+    if (tensors.size() != 1 && tensors.size() != 2) {
+        throw std::runtime_error(fmt::format(
+          "Kompute OpSort expected 1 or 2 tensors but got {}", tensors.size()));
+    }
+
+    this->mKeys = tensors[0];
+    this->mPayload = tensors.size() == 2 ? tensors[1] : nullptr;
+
+    uint32_t keyType = 0;
+    switch (this->mKeys->dataType()) {
+        case Tensor::TensorDataTypes::eUnsignedInt:
+            keyType = 0;
+            break;
+        case Tensor::TensorDataTypes::eInt:
+            keyType = 1;
+            break;
+        case Tensor::TensorDataTypes::eFloat:
+            keyType = 2;
+            break;
+        default:
+            throw std::runtime_error(
+              "Kompute OpSort keys tensor must be a uint32, int32 or float "
+              "tensor");
+    }
+
+    if (!this->mKeys->size()) {
+        throw std::runtime_error("Kompute OpSort keys tensor is empty");
+    }
+    // The shaders index the keys with 32-bit unsigned integers
+    if (this->mKeys->size() > UINT32_MAX) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpSort keys tensor of {} elements is too "
+                      "large, tensors of 2^32 elements or more are not "
+                      "supported",
+                      this->mKeys->size()));
+    }
+    uint32_t size = static_cast<uint32_t>(this->mKeys->size());
+    if (this->mPayload &&
+        (this->mPayload->dataTypeMemorySize() != sizeof(uint32_t) ||
+         this->mPayload->size() != size)) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpSort payload tensor must be a 32-bit tensor "
+                      "of {} elements",
+                      size));
+    }
+    for (const std::shared_ptr<Tensor>& tensor : tensors) {
+        if (tensor->tensorType() == Tensor::TensorTypes::eUniform) {
+            throw std::runtime_error(
+              "Kompute OpSort tensors cannot be uniform tensors");
+        }
+    }
+
+    uint32_t blocks = OpScan::partialsSize(size);
+    uint32_t histogramsSize = blocks << KOMPUTE_SORT_RADIX_BITS;
+
+    this->mKeysScratch = manager.tensor(
+      size, this->mKeys->dataType(), Tensor::TensorTypes::eStorage);
+    this->mHistograms = manager.tensor(histogramsSize,
+                                       Tensor::TensorDataTypes::eUnsignedInt,
+                                       Tensor::TensorTypes::eStorage);
+    this->mPartials = manager.tensor(OpScan::partialsSize(histogramsSize),
+                                     Tensor::TensorDataTypes::eUnsignedInt,
+                                     Tensor::TensorTypes::eStorage);
+
+    // Without a payload its bindings alias the keys and are never accessed
+    std::vector<std::shared_ptr<Tensor>> algorithmTensors;
+    if (this->mPayload) {
+        this->mPayloadScratch = manager.tensor(
+          size, this->mPayload->dataType(), Tensor::TensorTypes::eStorage);
+        algorithmTensors = { this->mKeys,
+                             this->mKeysScratch,
+                             this->mPayload,
+                             this->mPayloadScratch,
+                             this->mHistograms };
+    } else {
+        algorithmTensors = { this->mKeys,
+                             this->mKeysScratch,
+                             this->mKeys,
+                             this->mKeysScratch,
+                             this->mHistograms };
+    }
+
+    // The histograms are scanned in place into the destinations of the digits
+    this->mScan = std::make_shared<OpScan>(
+      std::vector<std::shared_ptr<Tensor>>{ this->mHistograms,
+                                            this->mHistograms,
+                                            this->mPartials },
+      manager.algorithm(),
+      false);
+
+    std::vector<uint32_t> spirv(
+      (uint32_t*)shader_data::shaders_glsl_opsort_comp_spv,
+      (uint32_t*)(shader_data::shaders_glsl_opsort_comp_spv +
+                  shader_data::shaders_glsl_opsort_comp_spv_len));
+
+    // Blocks past the maximum are folded into a loop of every workgroup
+    this->mAlgorithm->rebuild<uint32_t, uint32_t>(
+      algorithmTensors,
+      spirv,
+      { std::min<uint32_t>(blocks, KOMPUTE_SORT_MAX_WORKGROUPS), 1, 1 },
+      { keyType, this->mPayload ? 1u : 0u },
+      { 0, 0 });
+}
+
+OpSort::~OpSort()
+{
+    KP_LOG_DEBUG("Kompute OpSort destructor started");
+}
+
+void
+OpSort::record(const vk::CommandBuffer& commandBuffer)
+{
+    KP_LOG_OPERATION("Kompute OpSort record called");
+
+    vk::MemoryBarrier memoryBarrier(vk::AccessFlagBits::eShaderWrite,
+                                    vk::AccessFlagBits::eShaderRead |
+                                      vk::AccessFlagBits::eShaderWrite);
+
+    // An even number of digits leaves the sorted keys in the keys tensor
+    for (uint32_t shift = 0; shift < 32; shift += KOMPUTE_SORT_RADIX_BITS) {
+        if (shift) {
+            commandBuffer.pipelineBarrier(
+              vk::PipelineStageFlagBits::eComputeShader,
+              vk::PipelineStageFlagBits::eComputeShader,
+              vk::DependencyFlags(),
+              memoryBarrier,
+              nullptr,
+              nullptr);
+        }
+
+        this->recordPass(commandBuffer, 0, shift);
+
+        commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eComputeShader,
+                                      vk::PipelineStageFlagBits::eComputeShader,
+                                      vk::DependencyFlags(),
+                                      memoryBarrier,
+                                      nullptr,
+                                      nullptr);
+
+        this->mScan->record(commandBuffer);
+
+        commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eComputeShader,
+                                      vk::PipelineStageFlagBits::eComputeShader,
+                                      vk::DependencyFlags(),
+                                      memoryBarrier,
+                                      nullptr,
+                                      nullptr);
+
+        this->recordPass(commandBuffer, 1, shift);
+    }
+}
+
+std::vector<OpBase::TensorAccess>
+OpSort::tensorAccesses()
+{
+    std::vector<TensorAccess> accesses = {
+        { this->mKeys,
+          vk::PipelineStageFlagBits::eComputeShader,
+          vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite },
+    };
+    if (this->mPayload) {
+        accesses.push_back({ this->mPayload,
+                             vk::PipelineStageFlagBits::eComputeShader,
+                             vk::AccessFlagBits::eShaderRead |
+                               vk::AccessFlagBits::eShaderWrite });
+    }
+    return accesses;
+}
+
+void
+OpSort::recordPass(const vk::CommandBuffer& commandBuffer,
+                   uint32_t pass,
+                   uint32_t shift)
+{
+    const uint32_t pushConstants[2] = { pass, shift };
+
+    this->mAlgorithm->recordBindCore(commandBuffer);
+    this->mAlgorithm->recordPushConstants(
+      commandBuffer, pushConstants, sizeof(pushConstants));
+    this->mAlgorithm->recordDispatch(commandBuffer);
+}
+
+}
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <array>
+
+#include "kompute/operations/OpSpMM.hpp"
+
+namespace kp {
+
+OpSpMM::OpSpMM(const std::shared_ptr<SparseTensor>& matrix,
+               const std::vector<std::shared_ptr<Tensor>>& tensors,
+               const std::shared_ptr<Algorithm>& algorithm,
+               uint32_t n)
+  : OpAlgoDispatch(algorithm)
+{
+    KP_LOG_DEBUG("Kompute OpSpMM constructor with params");
+
+    if (tensors.size() != 2) {
+        throw std::runtime_error(fmt::format(
+          "Kompute OpSpMM expected 2 tensors but got {}", tensors.size()));
+    }
+    for (const std::shared_ptr<Tensor>& tensor : tensors) {
+        if (tensor->dataType() != Tensor::TensorDataTypes::eFloat) {
+            throw std::runtime_error(
+              "Kompute OpSpMM tensors must be float tensors");
+        }
+    }
+
+    uint32_t rows = matrix->rows();
+    uint32_t columns = matrix->columns();
+    if (!rows || !columns || !n) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpSpMM invalid dimensions rows {} columns {} "
+                      "n {}",
+                      rows,
+                      columns,
+                      n));
+    }
+    if (tensors[0]->size() < (uint64_t)columns * n ||
+        tensors[1]->size() < (uint64_t)rows * n) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpSpMM tensors of {} and {} elements cannot "
+                      "hold B of {} x {} and C of {} x {} elements",
+                      tensors[0]->size(),
+                      tensors[1]->size(),
+                      columns,
+                      n,
+                      rows,
+                      n));
+    }
+
+    std::vector<std::shared_ptr<Tensor>> algorithmTensors = matrix->tensors();
+    algorithmTensors.insert(
+      algorithmTensors.end(), tensors.begin(), tensors.end());
+    this->mTensors = algorithmTensors;
+
+    const std::array<uint32_t, 2> pushConstants = { rows, n };
+
+    std::vector<uint32_t> spirv(
+      (uint32_t*)shader_data::shaders_glsl_opspmm_comp_spv,
+      (uint32_t*)(shader_data::shaders_glsl_opspmm_comp_spv +
+                  kp::shader_data::shaders_glsl_opspmm_comp_spv_len));
+
+    // The local size x is the power of two closest above the columns, and
+    // the remaining invocations of the workgroup cover further rows
+    uint32_t groupColumns = 1;
+    while (groupColumns < n && groupColumns < KOMPUTE_SPMM_LOCAL_SIZE) {
+        groupColumns *= 2;
+    }
+    uint32_t groupRows = KOMPUTE_SPMM_LOCAL_SIZE / groupColumns;
+    Workgroup workgroup = { (n + groupColumns - 1) / groupColumns,
+                            std::min<uint32_t>(
+                              (rows + groupRows - 1) / groupRows,
+                              KOMPUTE_SPMM_MAX_WORKGROUPS),
+                            1 };
+
+    algorithm->rebuild<uint32_t, uint32_t>(
+      this->mTensors,
+      spirv,
+      workgroup,
+      { groupColumns, groupRows },
+      std::vector<uint32_t>(pushConstants.begin(), pushConstants.end()));
+
+    this->setPushConstants(
+      pushConstants.data(), pushConstants.size(), sizeof(uint32_t));
+}
+
+OpSpMM::~OpSpMM()
+{
+    KP_LOG_DEBUG("Kompute OpSpMM destructor started");
+}
+
+std::vector<OpBase::TensorAccess>
+OpSpMM::tensorAccesses()
+{
+    std::vector<TensorAccess> accesses;
+    for (size_t i = 0; i < this->mTensors.size(); i++) {
+        bool output = i + 1 == this->mTensors.size();
+        accesses.push_back({ this->mTensors[i],
+                             vk::PipelineStageFlagBits::eComputeShader,
+                             output ? vk::AccessFlagBits::eShaderWrite
+                                    : vk::AccessFlagBits::eShaderRead });
+    }
+    return accesses;
+}
+
+}
@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+
+#include "kompute/operations/OpSpMV.hpp"
+
+namespace kp {
+
+OpSpMV::OpSpMV(const std::shared_ptr<SparseTensor>& matrix,
+               const std::vector<std::shared_ptr<Tensor>>& tensors,
+               const std::shared_ptr<Algorithm>& algorithm,
+               uint32_t lanesPerRow)
+  : OpAlgoDispatch(algorithm)
+{
+    KP_LOG_DEBUG("Kompute OpSpMV constructor with params");
+
+    if (tensors.size() != 2) {
+        throw std::runtime_error(fmt::format(
+          "Kompute OpSpMV expected 2 tensors but got {}", tensors.size()));
+    }
+    for (const std::shared_ptr<Tensor>& tensor : tensors) {
+        if (tensor->dataType() != Tensor::TensorDataTypes::eFloat) {
+            throw std::runtime_error(
+              "Kompute OpSpMV tensors must be float tensors");
+        }
+    }
+
+    uint32_t rows = matrix->rows();
+    uint32_t columns = matrix->columns();
+    if (!rows || !columns) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpSpMV invalid matrix of {} rows {} columns",
+                      rows,
+                      columns));
+    }
+    if (tensors[0]->size() < columns || tensors[1]->size() < rows) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpSpMV tensors of {} and {} elements cannot "
+                      "hold x of {} and y of {} elements",
+                      tensors[0]->size(),
+                      tensors[1]->size(),
+                      columns,
+                      rows));
+    }
+
+    if (!lanesPerRow) {
+        lanesPerRow = lanesPerRowFor(rows, matrix->nonZeroCount());
+    }
+    if (lanesPerRow > KOMPUTE_SPMV_LOCAL_SIZE ||
+        (lanesPerRow & (lanesPerRow - 1))) {
+        throw std::runtime_error(
+          fmt::format("Kompute OpSpMV lanes per row {} is not a power of two "
+                      "of at most {}",
+                      lanesPerRow,
+                      KOMPUTE_SPMV_LOCAL_SIZE));
+    }
+
+    std::vector<std::shared_ptr<Tensor>> algorithmTensors = matrix->tensors();
+    algorithmTensors.insert(
+      algorithmTensors.end(), tensors.begin(), tensors.end());
+    this->mTensors = algorithmTensors;
+
+    std::vector<uint32_t> spirv(
+      (uint32_t*)shader_data::shaders_glsl_opspmv_comp_spv,
+      (uint32_t*)(shader_data::shaders_glsl_opspmv_comp_spv +
+                  kp::shader_data::shaders_glsl_opspmv_comp_spv_len));
+
+    // Each workgroup reduces as many rows as fit its invocations
+    uint32_t groupRows = KOMPUTE_SPMV_LOCAL_SIZE / lanesPerRow;
+    Workgroup workgroup = { std::min<uint32_t>(
+                              (rows + groupRows - 1) / groupRows,
+                              KOMPUTE_SPMV_MAX_WORKGROUPS),
+                            1,
+                            1 };
+
+    algorithm->rebuild<uint32_t, uint32_t>(this->mTensors,
+                                           spirv,
+                                           workgroup,
+                                           { lanesPerRow, groupRows },
+                                           { rows });
+
+    this->setPushConstants(&rows, 1, sizeof(uint32_t));
+}
+
+OpSpMV::~OpSpMV()
+{
+    KP_LOG_DEBUG("Kompute OpSpMV destructor started");
+}
+
+std::vector<OpBase::TensorAccess>
+OpSpMV::tensorAccesses()
+{
+    std::vector<TensorAccess> accesses;
+    for (size_t i = 0; i < this->mTensors.size(); i++) {
+        bool output = i + 1 == this->mTensors.size();
+        accesses.push_back({ this->mTensors[i],
+                             vk::PipelineStageFlagBits::eComputeShader,
+                             output ? vk::AccessFlagBits::eShaderWrite
+                                    : vk::AccessFlagBits::eShaderRead });
+    }
+    return accesses;
+}
+
+uint32_t
+OpSpMV::lanesPerRowFor(uint32_t rows, uint32_t nonZeroCount)
+{
+    uint64_t average = rows ? ((uint64_t)nonZeroCount + rows - 1) / rows : 1;
+
+    uint32_t lanesPerRow = 1;
+    while (lanesPerRow < average &&
+           lanesPerRow < KOMPUTE_SPMV_MAX_LANES_PER_ROW) {
+        lanesPerRow *= 2;
+    }
+    return lanesPerRow;
+}
+
+}
@@ -4,11 +4,15 @@
 
 namespace kp {
 
-OpTensorCopy::OpTensorCopy(const std::vector<std::shared_ptr<Tensor>>& tensors)
+OpTensorCopy::OpTensorCopy(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                           const std::vector<Tensor::Range>& ranges,
+                           HostUpdate hostUpdate)
 {
     KP_LOG_DEBUG("Kompute OpTensorCopy constructor with params");
 
     this->mTensors = tensors;
+    this->mRanges = ranges;
+    this->mHostUpdate = hostUpdate;
 
     if (this->mTensors.size() < 2) {
         throw std::runtime_error(
@@ -16,7 +20,7 @@ OpTensorCopy::OpTensorCopy(const std::vector<std::shared_ptr<Tensor>>& tensors)
     }
 
     kp::Tensor::TensorDataTypes dataType = this->mTensors[0]->dataType();
-    uint32_t size = this->mTensors[0]->size();
+    uint64_t size = this->mTensors[0]->size();
     for (const std::shared_ptr<Tensor>& tensor : tensors) {
         if (tensor->dataType() != dataType) {
             throw std::runtime_error(fmt::format(
@@ -41,30 +45,70 @@ OpTensorCopy::~OpTensorCopy()
 void
 OpTensorCopy::record(const vk::CommandBuffer& commandBuffer)
 {
-    KP_LOG_DEBUG("Kompute OpTensorCopy record called");
+    KP_LOG_OPERATION("Kompute OpTensorCopy record called");
 
-    // We iterate from the second tensor onwards and record a copy to all
+    // The first tensor is skipped as the source of the copies
+    this->mTensors[0]->recordCopyTo(
+      commandBuffer, this->mTensors, this->mRanges);
+}
+
+std::vector<OpBase::TensorAccess>
+OpTensorCopy::tensorAccesses()
+{
+    std::vector<TensorAccess> accesses;
+    accesses.push_back({ this->mTensors[0],
+                         vk::PipelineStageFlagBits::eTransfer,
+                         vk::AccessFlagBits::eTransferRead });
     for (size_t i = 1; i < this->mTensors.size(); i++) {
-        this->mTensors[i]->recordCopyFrom(commandBuffer, this->mTensors[0]);
+        accesses.push_back({ this->mTensors[i],
+                             vk::PipelineStageFlagBits::eTransfer,
+                             vk::AccessFlagBits::eTransferWrite });
     }
+    return accesses;
 }
 
 void
 OpTensorCopy::preEval(const vk::CommandBuffer& commandBuffer)
 {
-    KP_LOG_DEBUG("Kompute OpTensorCopy preEval called");
+    KP_LOG_OPERATION("Kompute OpTensorCopy preEval called");
 }
 
 void
 OpTensorCopy::postEval(const vk::CommandBuffer& commandBuffer)
 {
-    KP_LOG_DEBUG("Kompute OpTensorCopy postEval called");
+    KP_LOG_OPERATION("Kompute OpTensorCopy postEval called");
+
+    if (this->mHostUpdate == HostUpdate::eNone) {
+        return;
+    }
 
-    void* data = this->mTensors[0]->rawData();
+    uint8_t* data = (uint8_t*)this->mTensors[0]->rawData();
+    uint32_t elementMemorySize = this->mTensors[0]->dataTypeMemorySize();
+
+    // Storage tensors hold no host data, which then has to be synced back
+    // explicitly from the tensors copied into
+    if (!data) {
+        return;
+    }
 
     // Copy the data from the first tensor into all the tensors
     for (size_t i = 1; i < this->mTensors.size(); i++) {
-        this->mTensors[i]->setRawData(data);
+        if (!this->mTensors[i]->rawData() ||
+            this->mTensors[i] == this->mTensors[0]) {
+            continue;
+        }
+        if (this->mRanges.empty()) {
+            memcpy(this->mTensors[i]->rawData(),
+                   data,
+                   this->mTensors[i]->memorySize());
+            continue;
+        }
+        for (const Tensor::Range& range : this->mRanges) {
+            vk::DeviceSize offset = range.offset * elementMemorySize;
+            memcpy((uint8_t*)this->mTensors[i]->rawData() + offset,
+                   data + offset,
+                   range.count * elementMemorySize);
+        }
     }
 }
 
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "kompute/operations/OpTensorFill.hpp"
+
+namespace kp {
+
+OpTensorFill::OpTensorFill(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                           uint32_t data)
+{
+    KP_LOG_DEBUG("Kompute OpTensorFill constructor with params");
+
+    if (tensors.size() < 1) {
+        throw std::runtime_error(
+          "Kompute OpTensorFill called with less than 1 tensor");
+    }
+
+    this->mTensors = tensors;
+    this->mData = data;
+}
+
+OpTensorFill::~OpTensorFill()
+{
+    KP_LOG_DEBUG("Kompute OpTensorFill destructor started");
+}
+
+void
+OpTensorFill::record(const vk::CommandBuffer& commandBuffer)
+{
+    KP_LOG_OPERATION("Kompute OpTensorFill record called");
+
+    for (size_t i = 0; i < this->mTensors.size(); i++) {
+        this->mTensors[i]->recordFill(commandBuffer, this->mData);
+    }
+}
+
+std::vector<OpBase::TensorAccess>
+OpTensorFill::tensorAccesses()
+{
+    std::vector<TensorAccess> accesses;
+    for (const std::shared_ptr<Tensor>& tensor : this->mTensors) {
+        accesses.push_back({ tensor,
+                             vk::PipelineStageFlagBits::eTransfer,
+                             vk::AccessFlagBits::eTransferWrite });
+    }
+    return accesses;
+}
+
+void
+OpTensorFill::preEval(const vk::CommandBuffer& commandBuffer)
+{
+    KP_LOG_OPERATION("Kompute OpTensorFill preEval called");
+}
+
+void
+OpTensorFill::postEval(const vk::CommandBuffer& commandBuffer)
+{
+    KP_LOG_OPERATION("Kompute OpTensorFill postEval called");
+
+    for (size_t i = 0; i < this->mTensors.size(); i++) {
+        std::shared_ptr<Tensor> tensor = this->mTensors[i];
+
+        if (tensor->tensorType() == Tensor::TensorTypes::eHost ||
+            tensor->tensorType() == Tensor::TensorTypes::eUniform) {
+            tensor->invalidateMappedMemory();
+        } else if (tensor->tensorType() == Tensor::TensorTypes::eDevice ||
+                   tensor->tensorType() == Tensor::TensorTypes::eImage) {
+            // Mirror the 32-bit pattern into the separate host copy
+            uint8_t* rawData = (uint8_t*)tensor->rawData();
+            const uint8_t* pattern = (const uint8_t*)&this->mData;
+            for (vk::DeviceSize b = 0; b < tensor->memorySize(); b++) {
+                rawData[b] = pattern[b % sizeof(uint32_t)];
+            }
+        }
+    }
+}
+
+}
@@ -5,7 +5,8 @@
 namespace kp {
 
 OpTensorSyncDevice::OpTensorSyncDevice(
-  const std::vector<std::shared_ptr<Tensor>>& tensors)
+  const std::vector<std::shared_ptr<Tensor>>& tensors,
+  const std::vector<Tensor::Range>& ranges)
 {
     KP_LOG_DEBUG("Kompute OpTensorSyncDevice constructor with params");
 
@@ -15,6 +16,7 @@ OpTensorSyncDevice::OpTensorSyncDevice(
     }
 
     this->mTensors = tensors;
+    this->mRanges = ranges;
 }
 
 OpTensorSyncDevice::~OpTensorSyncDevice()
@@ -27,25 +29,63 @@ OpTensorSyncDevice::~OpTensorSyncDevice()
 void
 OpTensorSyncDevice::record(const vk::CommandBuffer& commandBuffer)
 {
-    KP_LOG_DEBUG("Kompute OpTensorSyncDevice record called");
+    KP_LOG_OPERATION("Kompute OpTensorSyncDevice record called");
 
     for (size_t i = 0; i < this->mTensors.size(); i++) {
-        if (this->mTensors[i]->tensorType() == Tensor::TensorTypes::eDevice) {
-            this->mTensors[i]->recordCopyFromStagingToDevice(commandBuffer);
+        if (this->mTensors[i]->hasStagingBuffer()) {
+            this->mTensors[i]->recordCopyFromStagingToDevice(commandBuffer,
+                                                             this->mRanges);
         }
     }
 }
 
+std::vector<OpBase::TensorAccess>
+OpTensorSyncDevice::tensorAccesses()
+{
+    std::vector<TensorAccess> accesses;
+    for (const std::shared_ptr<Tensor>& tensor : this->mTensors) {
+        if (tensor->hasStagingBuffer()) {
+            accesses.push_back({ tensor,
+                                 vk::PipelineStageFlagBits::eTransfer,
+                                 vk::AccessFlagBits::eTransferWrite });
+        }
+    }
+    return accesses;
+}
+
 void
 OpTensorSyncDevice::preEval(const vk::CommandBuffer& commandBuffer)
 {
-    KP_LOG_DEBUG("Kompute OpTensorSyncDevice preEval called");
+    KP_LOG_OPERATION("Kompute OpTensorSyncDevice preEval called");
+
+    for (size_t i = 0; i < this->mTensors.size(); i++) {
+        if (this->mTensors[i]->usesStagingRing()) {
+            this->mTensors[i]->syncDeviceWithStagingRing(this->mRanges);
+        } else {
+            this->mTensors[i]->flushMappedMemory();
+            if (this->mTensors[i]->hasStagingBuffer()) {
+                this->mTensors[i]->countTransfer(
+                  Metrics::Counter::eBytesUploaded, this->mRanges);
+            }
+        }
+    }
 }
 
 void
 OpTensorSyncDevice::postEval(const vk::CommandBuffer& commandBuffer)
 {
-    KP_LOG_DEBUG("Kompute OpTensorSyncDevice postEval called");
+    KP_LOG_OPERATION("Kompute OpTensorSyncDevice postEval called");
+}
+
+std::shared_ptr<StagingRing>
+OpTensorSyncDevice::stagingRing()
+{
+    for (const std::shared_ptr<Tensor>& tensor : this->mTensors) {
+        if (tensor->usesStagingRing()) {
+            return tensor->stagingRing();
+        }
+    }
+    return nullptr;
 }
 
 }
@@ -7,7 +7,8 @@
 namespace kp {
 
 OpTensorSyncLocal::OpTensorSyncLocal(
-  const std::vector<std::shared_ptr<Tensor>>& tensors)
+  const std::vector<std::shared_ptr<Tensor>>& tensors,
+  const std::vector<Tensor::Range>& ranges)
 {
     KP_LOG_DEBUG("Kompute OpTensorSyncLocal constructor with params");
 
@@ -17,6 +18,7 @@ OpTensorSyncLocal::OpTensorSyncLocal(
     }
 
     this->mTensors = tensors;
+    this->mRanges = ranges;
 }
 
 OpTensorSyncLocal::~OpTensorSyncLocal()
@@ -27,21 +29,16 @@ OpTensorSyncLocal::~OpTensorSyncLocal()
 void
 OpTensorSyncLocal::record(const vk::CommandBuffer& commandBuffer)
 {
-    KP_LOG_DEBUG("Kompute OpTensorSyncLocal record called");
+    KP_LOG_OPERATION("Kompute OpTensorSyncLocal record called");
 
     for (size_t i = 0; i < this->mTensors.size(); i++) {
-        if (this->mTensors[i]->tensorType() == Tensor::TensorTypes::eDevice) {
+        if (this->mTensors[i]->hasStagingBuffer()) {
 
-            this->mTensors[i]->recordPrimaryBufferMemoryBarrier(
-              commandBuffer,
-              vk::AccessFlagBits::eShaderWrite,
-              vk::AccessFlagBits::eTransferRead,
-              vk::PipelineStageFlagBits::eComputeShader,
-              vk::PipelineStageFlagBits::eTransfer);
-
-            this->mTensors[i]->recordCopyFromDeviceToStaging(commandBuffer);
+            this->mTensors[i]->recordCopyFromDeviceToStaging(commandBuffer,
+                                                             this->mRanges);
 
-            this->mTensors[i]->recordPrimaryBufferMemoryBarrier(
+            // The staging buffer is not tracked by the sequence
+            this->mTensors[i]->recordStagingBufferMemoryBarrier(
               commandBuffer,
               vk::AccessFlagBits::eTransferWrite,
               vk::AccessFlagBits::eHostRead,
@@ -51,18 +48,64 @@ OpTensorSyncLocal::record(const vk::CommandBuffer& commandBuffer)
     }
 }
 
+std::vector<OpBase::TensorAccess>
+OpTensorSyncLocal::tensorAccesses()
+{
+    std::vector<TensorAccess> accesses;
+    for (const std::shared_ptr<Tensor>& tensor : this->mTensors) {
+        if (tensor->usesStagingRing()) {
+            continue;
+        }
+        if (tensor->hasStagingBuffer()) {
+            accesses.push_back({ tensor,
+                                 vk::PipelineStageFlagBits::eTransfer,
+                                 vk::AccessFlagBits::eTransferRead });
+        } else if (tensor->tensorType() == Tensor::TensorTypes::eHost ||
+                   tensor->tensorType() == Tensor::TensorTypes::eUniform) {
+            accesses.push_back({ tensor,
+                                 vk::PipelineStageFlagBits::eHost,
+                                 vk::AccessFlagBits::eHostRead });
+        }
+    }
+    return accesses;
+}
+
 void
 OpTensorSyncLocal::preEval(const vk::CommandBuffer& commandBuffer)
 {
-    KP_LOG_DEBUG("Kompute OpTensorSyncLocal preEval called");
+    KP_LOG_OPERATION("Kompute OpTensorSyncLocal preEval called");
 }
 
 void
 OpTensorSyncLocal::postEval(const vk::CommandBuffer& commandBuffer)
 {
-    KP_LOG_DEBUG("Kompute OpTensorSyncLocal postEval called");
+    KP_LOG_OPERATION("Kompute OpTensorSyncLocal postEval called");
+
+    KP_LOG_OPERATION(
+      "Kompute OpTensorSyncLocal mapping data into tensor local");
 
-    KP_LOG_DEBUG("Kompute OpTensorSyncLocal mapping data into tensor local");
+    for (size_t i = 0; i < this->mTensors.size(); i++) {
+        if (this->mTensors[i]->usesStagingRing()) {
+            this->mTensors[i]->syncLocalWithStagingRing(this->mRanges);
+        } else {
+            this->mTensors[i]->invalidateMappedMemory();
+            if (this->mTensors[i]->hasStagingBuffer()) {
+                this->mTensors[i]->countTransfer(
+                  Metrics::Counter::eBytesDownloaded, this->mRanges);
+            }
+        }
+    }
+}
+
+std::shared_ptr<StagingRing>
+OpTensorSyncLocal::stagingRing()
+{
+    for (const std::shared_ptr<Tensor>& tensor : this->mTensors) {
+        if (tensor->usesStagingRing()) {
+            return tensor->stagingRing();
+        }
+    }
+    return nullptr;
 }
 
 }
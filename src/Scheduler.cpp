@@ -0,0 +1,251 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "kompute/Scheduler.hpp"
+
+namespace kp {
+
+Scheduler::Scheduler(
+  const std::vector<std::vector<std::shared_ptr<Sequence>>>& queueSequences,
+  std::shared_ptr<CompletionWaiter> completionWaiter)
+{
+    KP_LOG_DEBUG("Kompute Scheduler constructor with {} queues",
+                 queueSequences.size());
+
+    if (!completionWaiter) {
+        throw std::runtime_error(
+          "Kompute Scheduler completion waiter is null");
+    }
+    if (queueSequences.empty()) {
+        throw std::runtime_error("Kompute Scheduler requires a queue");
+    }
+
+    this->mCompletionWaiter = completionWaiter;
+    this->mQueues.resize(queueSequences.size());
+    for (size_t i = 0; i < queueSequences.size(); i++) {
+        if (queueSequences[i].empty()) {
+            throw std::runtime_error(fmt::format(
+              "Kompute Scheduler requires a sequence for queue {}", i));
+        }
+        this->mQueues[i].idleSequences = queueSequences[i];
+    }
+}
+
+Scheduler::~Scheduler()
+{
+    KP_LOG_DEBUG("Kompute Scheduler destructor started");
+
+    if (this->mCompletionWaiter) {
+        this->destroy();
+    }
+}
+
+void
+Scheduler::submit(std::shared_ptr<Sequence> sequence, Completion completion)
+{
+    if (!this->mCompletionWaiter) {
+        throw std::runtime_error(
+          "Kompute Scheduler submit called after destroy");
+    }
+
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    // The submission is assigned to the queue with the least outstanding
+    // work, which other queues steal from if it falls behind
+    uint32_t queueIndex = 0;
+    size_t leastWork = SIZE_MAX;
+    for (uint32_t i = 0; i < this->mQueues.size(); i++) {
+        const Queue& queue = this->mQueues[i];
+        size_t work = queue.pending.size() + queue.running;
+        if (work < leastWork) {
+            leastWork = work;
+            queueIndex = i;
+        }
+    }
+
+    KP_LOG_DEBUG("Kompute Scheduler assigning {} operations to queue {}",
+                 sequence->operations().size(),
+                 queueIndex);
+
+    this->mQueues[queueIndex].pending.push_back(
+      { sequence, sequence->operations(), completion });
+    this->mOutstanding++;
+
+    for (uint32_t i = 0; i < this->mQueues.size(); i++) {
+        this->dispatch(i, lock);
+    }
+}
+
+std::future<std::shared_ptr<Sequence>>
+Scheduler::submit(std::shared_ptr<Sequence> sequence)
+{
+    std::shared_ptr<std::promise<std::shared_ptr<Sequence>>> promise =
+      std::make_shared<std::promise<std::shared_ptr<Sequence>>>();
+
+    this->submit(sequence,
+                 [sequence, promise](std::exception_ptr exception) {
+                     if (exception) {
+                         promise->set_exception(exception);
+                     } else {
+                         promise->set_value(sequence);
+                     }
+                 });
+
+    return promise->get_future();
+}
+
+void
+Scheduler::await()
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+    this->mCondition.wait(lock, [this]() { return !this->mOutstanding; });
+}
+
+uint32_t
+Scheduler::queueCount()
+{
+    return this->mQueues.size();
+}
+
+uint32_t
+Scheduler::outstandingCount()
+{
+    std::lock_guard<std::mutex> lock(this->mMutex);
+    return this->mOutstanding;
+}
+
+std::vector<uint64_t>
+Scheduler::completedCounts()
+{
+    std::lock_guard<std::mutex> lock(this->mMutex);
+
+    std::vector<uint64_t> completedCounts;
+    for (const Queue& queue : this->mQueues) {
+        completedCounts.push_back(queue.completed);
+    }
+    return completedCounts;
+}
+
+uint64_t
+Scheduler::stolenCount()
+{
+    std::lock_guard<std::mutex> lock(this->mMutex);
+    return this->mStolen;
+}
+
+void
+Scheduler::destroy()
+{
+    KP_LOG_DEBUG("Kompute Scheduler destroy called");
+
+    if (!this->mCompletionWaiter) {
+        KP_LOG_WARN("Kompute Scheduler destroy called after destroy");
+        return;
+    }
+
+    this->await();
+
+    std::lock_guard<std::mutex> lock(this->mMutex);
+    this->mQueues.clear();
+    this->mCompletionWaiter = nullptr;
+}
+
+void
+Scheduler::dispatch(uint32_t queueIndex, std::unique_lock<std::mutex>& lock)
+{
+    Queue& queue = this->mQueues[queueIndex];
+
+    while (queue.idleSequences.size()) {
+        // Without pending work of its own, the queue steals the most recent
+        // submission of the queue with the most pending work
+        Queue* source = &queue;
+        if (queue.pending.empty()) {
+            for (Queue& other : this->mQueues) {
+                if (other.pending.size() > source->pending.size()) {
+                    source = &other;
+                }
+            }
+            if (source->pending.empty()) {
+                return;
+            }
+            this->mStolen++;
+        }
+
+        Task task;
+        if (source == &queue) {
+            task = queue.pending.front();
+            queue.pending.pop_front();
+        } else {
+            task = source->pending.back();
+            source->pending.pop_back();
+        }
+
+        std::shared_ptr<Sequence> sequence = queue.idleSequences.back();
+        queue.idleSequences.pop_back();
+        queue.running++;
+
+        try {
+            sequence->begin();
+            for (const std::shared_ptr<OpBase>& op : task.operations) {
+                sequence->record(op);
+            }
+            sequence->evalAsync();
+            this->mCompletionWaiter->watch(
+              sequence,
+              [this, queueIndex, sequence, task](std::exception_ptr exception) {
+                  this->complete(queueIndex, sequence, task, exception);
+              });
+        } catch (...) {
+            KP_LOG_ERROR("Kompute Scheduler failed to submit to queue {}",
+                         queueIndex);
+
+            if (sequence->isRunning()) {
+                sequence->evalAwait();
+            }
+            queue.running--;
+            queue.idleSequences.push_back(sequence);
+
+            this->finish(task, std::current_exception(), lock);
+        }
+    }
+}
+
+void
+Scheduler::complete(uint32_t queueIndex,
+                    std::shared_ptr<Sequence> sequence,
+                    const Task& task,
+                    std::exception_ptr exception)
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    Queue& queue = this->mQueues[queueIndex];
+    queue.running--;
+    queue.completed++;
+    queue.idleSequences.push_back(sequence);
+
+    // The sequence freed picks up the next submission before the completion
+    // runs, so the queue is kept busy
+    this->dispatch(queueIndex, lock);
+
+    this->finish(task, exception, lock);
+}
+
+void
+Scheduler::finish(const Task& task,
+                  std::exception_ptr exception,
+                  std::unique_lock<std::mutex>& lock)
+{
+    lock.unlock();
+    try {
+        task.completion(exception);
+    } catch (const std::exception& e) {
+        KP_LOG_ERROR("Kompute Scheduler completion threw: {}", e.what());
+    } catch (...) {
+        KP_LOG_ERROR("Kompute Scheduler completion threw");
+    }
+    lock.lock();
+
+    this->mOutstanding--;
+    this->mCondition.notify_all();
+}
+
+}
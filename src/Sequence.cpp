@@ -1,27 +1,115 @@
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <typeinfo>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
 #include "kompute/Sequence.hpp"
+#include "kompute/operations/OpTensorSyncDevice.hpp"
+#include "kompute/operations/OpTensorSyncLocal.hpp"
+#include "kompute/SubmitBatch.hpp"
+#include "kompute/Tracer.hpp"
 
 namespace kp {
 
+// Name of the type of an operation without the namespace, such as OpMult
+static std::string
+operationTypeName(const OpBase& op)
+{
+    std::string name = typeid(op).name();
+#if defined(__GNUG__)
+    int status = 0;
+    char* demangled =
+      abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (status == 0 && demangled) {
+        name = demangled;
+    }
+    free(demangled);
+#endif
+    if (name.compare(0, 6, "class ") == 0) {
+        name = name.substr(6);
+    }
+    if (name.compare(0, 4, "kp::") == 0) {
+        name = name.substr(4);
+    }
+    return name;
+}
+
 Sequence::Sequence(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
                    std::shared_ptr<vk::Device> device,
                    std::shared_ptr<vk::Queue> computeQueue,
                    uint32_t queueIndex,
-                   uint32_t totalTimestamps)
+                   uint32_t totalTimestamps,
+                   uint32_t inFlightDepth,
+                   bool timelineSemaphore,
+                   std::shared_ptr<vk::CommandPool> commandPool,
+                   std::shared_ptr<std::mutex> queueMutex,
+                   uint32_t totalPipelineStatistics,
+                   std::shared_ptr<DebugUtils> debugUtils,
+                   std::shared_ptr<Metrics> metrics,
+                   std::shared_ptr<HostAllocator> hostAllocator,
+                   std::shared_ptr<DeviceInfo> deviceInfo)
 {
     KP_LOG_DEBUG("Kompute Sequence Constructor with existing device & queue");
 
+    if (inFlightDepth < 1) {
+        throw std::runtime_error(
+          "Kompute Sequence in flight depth must be at least 1");
+    }
+    // Submissions in flight would latch into the same queries
+    if (inFlightDepth > 1 &&
+        (totalTimestamps > 0 || totalPipelineStatistics > 0)) {
+        throw std::runtime_error(
+          "Kompute Sequence timestamps and pipeline statistics require an in "
+          "flight depth of 1");
+    }
+
     this->mPhysicalDevice = physicalDevice;
     this->mDevice = device;
     this->mComputeQueue = computeQueue;
+    this->mQueueMutex = queueMutex;
+    this->mDebugUtils = debugUtils;
+    this->mMetrics = metrics;
+    this->mHostAllocator = hostAllocator;
+    this->mDeviceInfo = deviceInfo;
     this->mQueueIndex = queueIndex;
+    this->mSubmissions.resize(inFlightDepth);
+
+    if (!this->mDeviceInfo && physicalDevice) {
+        this->mDeviceInfo = std::make_shared<DeviceInfo>(*physicalDevice);
+    }
+    if (this->mDeviceInfo) {
+        const std::vector<vk::QueueFamilyProperties>& queueFamilyProperties =
+          this->mDeviceInfo->queueFamilyProperties();
+        if (queueIndex < queueFamilyProperties.size()) {
+            this->mComputeSupported =
+              (bool)(queueFamilyProperties[queueIndex].queueFlags &
+                     vk::QueueFlagBits::eCompute);
+        }
+    }
+    this->mHazardTracker = HazardTracker(this->mComputeSupported);
 
-    this->createCommandPool();
+    if (commandPool) {
+        this->mCommandPool = commandPool;
+    } else {
+        this->createCommandPool();
+    }
     this->createCommandBuffer();
+    this->createFences();
+    if (timelineSemaphore) {
+        this->createTimelineSemaphore();
+    }
     if (totalTimestamps > 0)
         this->createTimestampQueryPool(totalTimestamps +
                                        1); //+1 for the first one
+    if (totalPipelineStatistics > 0) {
+        this->createPipelineStatisticsQueryPool(totalPipelineStatistics);
+    }
 }
 
 Sequence::~Sequence()
@@ -36,10 +124,11 @@ Sequence::~Sequence()
 void
 Sequence::begin()
 {
-    KP_LOG_DEBUG("Kompute sequence called BEGIN");
+    KP_LOG_SEQUENCE("Kompute sequence called BEGIN");
 
     if (this->isRecording()) {
-        KP_LOG_DEBUG("Kompute Sequence begin called when already recording");
+        KP_LOG_SEQUENCE(
+          "Kompute Sequence begin called when already recording");
         return;
     }
 
@@ -48,22 +137,36 @@ Sequence::begin()
           "Kompute Sequence begin called when sequence still running");
     }
 
-    KP_LOG_INFO("Kompute Sequence command now started recording");
+    // A submission that timed out may still be using the command buffer
+    Submission& submission = this->mSubmissions[this->mNextSubmission];
+    this->waitPendingSubmission(submission);
+    this->mCommandBuffer = submission.commandBuffer;
+
+    // The command buffer is recorded from scratch, so the operations it
+    // contained are discarded as well
+    this->mOperations.clear();
+    this->mOperationLabels.clear();
+    this->mRecordedGenerations.clear();
+    this->mHazardTracker = HazardTracker(this->mComputeSupported);
+    this->mRecordVersion++;
+
+    KP_LOG_SEQUENCE("Kompute Sequence command now started recording");
     this->mCommandBuffer->begin(vk::CommandBufferBeginInfo());
     this->mRecording = true;
 
-    // latch the first timestamp before any commands are submitted
-    if (this->timestampQueryPool)
-        this->mCommandBuffer->writeTimestamp(
-          vk::PipelineStageFlagBits::eAllCommands,
-          *this->timestampQueryPool,
-          0);
+    // The queries are reset by every submission of the command buffer, so
+    // the sequence can be evaluated again, and the first timestamp is
+    // latched before any commands are submitted
+    this->resetQueries(*this->mCommandBuffer);
+    if (this->timestampQueryPool) {
+        this->writeTimestamp(*this->mCommandBuffer, 0);
+    }
 }
 
 void
 Sequence::end()
 {
-    KP_LOG_DEBUG("Kompute Sequence calling END");
+    KP_LOG_SEQUENCE("Kompute Sequence calling END");
 
     if (this->isRunning()) {
         throw std::runtime_error(
@@ -74,10 +177,30 @@ Sequence::end()
         KP_LOG_WARN("Kompute Sequence end called when not recording");
         return;
     } else {
-        KP_LOG_INFO("Kompute Sequence command recording END");
+        KP_LOG_SEQUENCE("Kompute Sequence command recording END");
         this->mCommandBuffer->end();
         this->mRecording = false;
+        if (this->mMetrics) {
+            this->mMetrics->add(Metrics::Counter::eCommandBuffersRecorded);
+        }
+        this->mSubmissions[this->mNextSubmission].recordedVersion =
+          this->mRecordVersion;
+    }
+}
+
+std::unique_lock<std::mutex>
+Sequence::lockQueue()
+{
+    if (!this->mQueueMutex) {
+        return std::unique_lock<std::mutex>();
     }
+    return std::unique_lock<std::mutex>(*this->mQueueMutex);
+}
+
+const std::vector<std::shared_ptr<OpBase>>&
+Sequence::operations()
+{
+    return this->mOperations;
 }
 
 void
@@ -89,57 +212,182 @@ Sequence::clear()
     }
 }
 
+void
+Sequence::reset()
+{
+    KP_LOG_SEQUENCE("Kompute Sequence calling reset");
+
+    if (this->isRunning()) {
+        throw std::runtime_error(
+          "Kompute Sequence reset called when sequence still running");
+    }
+
+    // Recording is abandoned, as the command buffer is reset
+    this->mRecording = false;
+
+    for (Submission& submission : this->mSubmissions) {
+        this->waitPendingSubmission(submission);
+        submission.commandBuffer->reset(vk::CommandBufferResetFlags());
+        submission.recordedVersion = UINT64_MAX;
+    }
+
+    this->mOperations.clear();
+    this->mOperationLabels.clear();
+    this->mRecordedGenerations.clear();
+    this->mHazardTracker = HazardTracker(this->mComputeSupported);
+    this->mRecordVersion++;
+}
+
 std::shared_ptr<Sequence>
 Sequence::eval()
 {
-    KP_LOG_DEBUG("Kompute sequence EVAL BEGIN");
+    KP_LOG_SEQUENCE("Kompute sequence EVAL BEGIN");
 
-    return this->evalAsync()->evalAwait();
+    this->evalAsync();
+    while (this->isRunning()) {
+        this->evalAwait();
+    }
+    return shared_from_this();
 }
 
 std::shared_ptr<Sequence>
 Sequence::eval(std::shared_ptr<OpBase> op)
 {
-    this->clear();
+    this->reset();
     return this->record(op)->eval();
 }
 
 std::shared_ptr<Sequence>
 Sequence::evalAsync()
 {
+    return this->evalAsync(std::vector<std::shared_ptr<Sequence>>());
+}
+
+std::shared_ptr<Sequence>
+Sequence::evalAsync(const std::vector<std::shared_ptr<Sequence>>& waitSequences)
+{
+    Tracer::Span span("Sequence::evalAsync");
+
+    SubmitData submitData;
+    Submission& submission = this->prepareSubmit(waitSequences, submitData);
+
+    std::unique_lock<std::mutex> queueLock = this->lockQueue();
+    this->mComputeQueue->submit(1, &submitData.submitInfo, submission.fence);
+
+    return shared_from_this();
+}
+
+Sequence::Submission&
+Sequence::prepareSubmit(
+  const std::vector<std::shared_ptr<Sequence>>& waitSequences,
+  SubmitData& submitData,
+  std::shared_ptr<SubmitBatch> batch,
+  uint32_t batchFenceIndex)
+{
+    for (const std::shared_ptr<Sequence>& waitSequence : waitSequences) {
+        if (!waitSequence->mTimelineSemaphore) {
+            throw std::runtime_error(
+              "Kompute Sequence evalAsync dependency was not created with a "
+              "timeline semaphore");
+        }
+        // Nothing to wait for if the dependency has never been submitted
+        if (waitSequence->mTimelineValue == 0) {
+            continue;
+        }
+        submitData.waitSemaphores.push_back(waitSequence->mTimelineSemaphore);
+        submitData.waitValues.push_back(waitSequence->mTimelineValue);
+    }
+
+    if (submitData.waitSemaphores.size() && !this->mTimelineSemaphore) {
+        throw std::runtime_error(
+          "Kompute Sequence evalAsync with dependencies requires the sequence "
+          "to be created with a timeline semaphore");
+    }
+
+    // Tensors rebuilt since the operations were recorded changed their size
+    // or buffers, which the descriptors, copies and barriers recorded with
+    // them still refer to
+    if (this->tensorsRebuilt()) {
+        KP_LOG_SEQUENCE("Kompute Sequence recording operations again after "
+                        "their tensors were rebuilt");
+        this->rerecord();
+    }
+
     if (this->isRecording()) {
         this->end();
     }
 
-    if (this->mIsRunning) {
-        throw std::runtime_error(
-          "Kompute Sequence evalAsync called when an eval async was "
-          "called without successful wait");
+    if (this->mInFlight.size() == this->mSubmissions.size()) {
+        throw std::runtime_error(fmt::format(
+          "Kompute Sequence evalAsync called with {} eval async submissions "
+          "in flight without successful wait",
+          this->mInFlight.size()));
     }
 
-    this->mIsRunning = true;
+    uint32_t submissionIndex = this->mNextSubmission;
+    Submission& submission = this->mSubmissions[submissionIndex];
+    this->waitPendingSubmission(submission);
+
+    // Operations are recorded into the other command buffers when first used
+    if (submission.recordedVersion != this->mRecordVersion) {
+        this->recordSubmission(submission);
+    }
 
     for (size_t i = 0; i < this->mOperations.size(); i++) {
-        this->mOperations[i]->preEval(*this->mCommandBuffer);
+        this->mOperations[i]->preEval(*submission.commandBuffer);
+    }
+
+    submitData.waitStages.resize(submitData.waitSemaphores.size(),
+                                 vk::PipelineStageFlagBits::eAllCommands);
+
+    submitData.submitInfo =
+      vk::SubmitInfo(submitData.waitSemaphores.size(),
+                     submitData.waitSemaphores.data(),
+                     submitData.waitStages.data(),
+                     1,
+                     submission.commandBuffer.get());
+
+    if (this->mTimelineSemaphore) {
+        this->mTimelineValue++;
+        submitData.signalValue = this->mTimelineValue;
+        submitData.timelineSubmitInfo =
+          vk::TimelineSemaphoreSubmitInfo(submitData.waitValues.size(),
+                                          submitData.waitValues.data(),
+                                          1,
+                                          &submitData.signalValue);
+        submitData.submitInfo.signalSemaphoreCount = 1;
+        submitData.submitInfo.pSignalSemaphores = &this->mTimelineSemaphore;
+        submitData.submitInfo.setPNext(&submitData.timelineSubmitInfo);
     }
 
-    vk::SubmitInfo submitInfo(
-      0, nullptr, nullptr, 1, this->mCommandBuffer.get());
+    KP_LOG_SEQUENCE("Kompute sequence submitting command buffer {} into "
+                    "compute queue waiting for {} sequences",
+                    submissionIndex,
+                    submitData.waitSemaphores.size());
 
-    this->mFence = this->mDevice->createFence(vk::FenceCreateInfo());
+    // The submission is considered in flight from here, as the caller
+    // submits it straight away
+    submission.fencePending = true;
+    submission.batched = batch != nullptr;
+    submission.batch = batch;
+    submission.batchFenceIndex = batchFenceIndex;
 
-    KP_LOG_DEBUG(
-      "Kompute sequence submitting command buffer into compute queue");
+    if (this->mMetrics) {
+        this->mMetrics->add(Metrics::Counter::eSubmissions);
+    }
 
-    this->mComputeQueue->submit(1, &submitInfo, this->mFence);
+    this->mInFlight.push_back(submissionIndex);
+    this->mNextSubmission = (submissionIndex + 1) % this->mSubmissions.size();
+    this->mCommandBuffer =
+      this->mSubmissions[this->mNextSubmission].commandBuffer;
 
-    return shared_from_this();
+    return submission;
 }
 
 std::shared_ptr<Sequence>
 Sequence::evalAsync(std::shared_ptr<OpBase> op)
 {
-    this->clear();
+    this->reset();
     this->record(op);
     this->evalAsync();
     return shared_from_this();
@@ -148,35 +396,173 @@ Sequence::evalAsync(std::shared_ptr<OpBase> op)
 std::shared_ptr<Sequence>
 Sequence::evalAwait(uint64_t waitFor)
 {
-    if (!this->mIsRunning) {
+    Tracer::Span span("Sequence::evalAwait");
+
+    if (this->mInFlight.empty()) {
         KP_LOG_WARN("Kompute Sequence evalAwait called without existing eval");
         return shared_from_this();
     }
 
-    vk::Result result =
-      this->mDevice->waitForFences(1, &this->mFence, VK_TRUE, waitFor);
-    this->mDevice->destroy(
-      this->mFence, (vk::Optional<const vk::AllocationCallbacks>)nullptr);
+    Submission& submission = this->mSubmissions[this->mInFlight.front()];
+    this->mInFlight.pop_front();
 
-    this->mIsRunning = false;
-
-    if (result == vk::Result::eTimeout) {
+    // The fence stays pending until the submission completes, and is waited
+    // for before the command buffer or fence are used again
+    if (this->waitSubmission(submission, waitFor) == vk::Result::eTimeout) {
         KP_LOG_WARN("Kompute Sequence evalAwait reached timeout of {}",
                     waitFor);
         return shared_from_this();
     }
 
+    if (Tracer::isEnabled() && this->timestampQueryPool) {
+        this->traceTimestamps(Tracer::now());
+    }
+
     for (size_t i = 0; i < this->mOperations.size(); i++) {
-        this->mOperations[i]->postEval(*this->mCommandBuffer);
+        this->mOperations[i]->postEval(*submission.commandBuffer);
     }
 
     return shared_from_this();
 }
 
+bool
+Sequence::isComplete()
+{
+    if (!this->mInFlight.empty()) {
+        return this->isSubmissionComplete(
+          this->mSubmissions[this->mInFlight.front()]);
+    }
+
+    // Submissions whose wait timed out are still pending on the GPU
+    for (const Submission& submission : this->mSubmissions) {
+        if (!this->isSubmissionComplete(submission)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool
+Sequence::isSubmissionComplete(const Submission& submission)
+{
+    if (!submission.fencePending) {
+        return true;
+    }
+
+    if (submission.batched) {
+        // A batch that no longer exists waited for its fences when destroyed
+        std::shared_ptr<SubmitBatch> batch = submission.batch.lock();
+        return !batch || batch->fenceStatus(submission.batchFenceIndex) ==
+                           vk::Result::eSuccess;
+    }
+
+    return this->mDevice->getFenceStatus(submission.fence) ==
+           vk::Result::eSuccess;
+}
+
+uint32_t
+Sequence::inFlightCount()
+{
+    return this->mInFlight.size();
+}
+
+uint32_t
+Sequence::inFlightDepth()
+{
+    return this->mSubmissions.size();
+}
+
+uint64_t
+Sequence::barrierCount()
+{
+    return this->mHazardTracker.barrierCount();
+}
+
+void
+Sequence::recordSubmission(Submission& submission)
+{
+    KP_LOG_SEQUENCE("Kompute Sequence recording {} operations into command "
+                    "buffer of submission",
+                    this->mOperations.size());
+
+    submission.commandBuffer->begin(vk::CommandBufferBeginInfo());
+
+    this->resetQueries(*submission.commandBuffer);
+    if (this->timestampQueryPool) {
+        this->writeTimestamp(*submission.commandBuffer, 0);
+    }
+
+    HazardTracker hazardTracker(this->mComputeSupported);
+    for (size_t i = 0; i < this->mOperations.size(); i++) {
+        this->recordOperation(*submission.commandBuffer, hazardTracker, i);
+    }
+
+    submission.commandBuffer->end();
+    submission.recordedVersion = this->mRecordVersion;
+    if (this->mMetrics) {
+        this->mMetrics->add(Metrics::Counter::eCommandBuffersRecorded);
+    }
+}
+
+void
+Sequence::waitPendingSubmission(Submission& submission)
+{
+    if (!submission.fencePending) {
+        return;
+    }
+
+    KP_LOG_SEQUENCE("Kompute Sequence waiting for pending submission");
+
+    this->waitSubmission(submission, UINT64_MAX);
+}
+
+vk::Result
+Sequence::waitSubmission(Submission& submission, uint64_t waitFor)
+{
+    if (!submission.fencePending) {
+        return vk::Result::eSuccess;
+    }
+
+    std::chrono::steady_clock::time_point waitStart =
+      std::chrono::steady_clock::now();
+
+    vk::Result result = vk::Result::eSuccess;
+    if (submission.batched) {
+        // The fences of a batch are only reset by the batch itself
+        if (std::shared_ptr<SubmitBatch> batch = submission.batch.lock()) {
+            result = batch->waitFence(submission.batchFenceIndex, waitFor);
+        }
+    } else {
+        result = this->mDevice->waitForFences(
+          1, &submission.fence, VK_TRUE, waitFor);
+        if (result == vk::Result::eSuccess) {
+            this->mDevice->resetFences(1, &submission.fence);
+        }
+    }
+
+    if (this->mMetrics) {
+        this->mMetrics->add(Metrics::Counter::eFenceWaits);
+        this->mMetrics->add(
+          Metrics::Counter::eFenceWaitNs,
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - waitStart)
+            .count());
+    }
+
+    if (result == vk::Result::eTimeout) {
+        return result;
+    }
+
+    submission.fencePending = false;
+    submission.batched = false;
+    submission.batch.reset();
+    return result;
+}
+
 bool
 Sequence::isRunning()
 {
-    return this->mIsRunning;
+    return !this->mInFlight.empty();
 }
 
 bool
@@ -195,11 +581,15 @@ Sequence::isInit()
 void
 Sequence::rerecord()
 {
-    this->end();
+    if (this->isRecording()) {
+        this->end();
+    }
     std::vector<std::shared_ptr<OpBase>> ops = this->mOperations;
+    std::vector<std::string> labels = this->mOperationLabels;
     this->mOperations.clear();
-    for (const std::shared_ptr<kp::OpBase>& op : ops) {
-        this->record(op);
+    this->mOperationLabels.clear();
+    for (size_t i = 0; i < ops.size(); i++) {
+        this->record(ops[i], labels[i]);
     }
 }
 
@@ -214,6 +604,25 @@ Sequence::destroy()
         return;
     }
 
+    // Resources still in use by the GPU cannot be freed
+    this->mInFlight.clear();
+    for (Submission& submission : this->mSubmissions) {
+        this->waitPendingSubmission(submission);
+        if (submission.fence) {
+            this->mDevice->destroy(
+              submission.fence,
+              HostAllocator::callbacks(this->mHostAllocator));
+            submission.fence = nullptr;
+        }
+    }
+
+    if (this->mTimelineSemaphore) {
+        this->mDevice->destroy(
+          this->mTimelineSemaphore,
+          HostAllocator::callbacks(this->mHostAllocator));
+        this->mTimelineSemaphore = nullptr;
+    }
+
     if (this->mFreeCommandBuffer) {
         KP_LOG_INFO("Freeing CommandBuffer");
         if (!this->mCommandBuffer) {
@@ -221,8 +630,14 @@ Sequence::destroy()
                         "CommandPool pointer");
             return;
         }
-        this->mDevice->freeCommandBuffers(
-          *this->mCommandPool, 1, this->mCommandBuffer.get());
+        std::vector<vk::CommandBuffer> commandBuffers;
+        for (Submission& submission : this->mSubmissions) {
+            commandBuffers.push_back(*submission.commandBuffer);
+            submission.commandBuffer = nullptr;
+        }
+        this->mDevice->freeCommandBuffers(*this->mCommandPool,
+                                          commandBuffers.size(),
+                                          commandBuffers.data());
 
         this->mCommandBuffer = nullptr;
         this->mFreeCommandBuffer = false;
@@ -239,29 +654,43 @@ Sequence::destroy()
         }
         this->mDevice->destroy(
           *this->mCommandPool,
-          (vk::Optional<const vk::AllocationCallbacks>)nullptr);
+          HostAllocator::callbacks(this->mHostAllocator));
 
         this->mCommandPool = nullptr;
         this->mFreeCommandPool = false;
 
         KP_LOG_DEBUG("Kompute Sequence Destroyed CommandPool");
     }
+    // Command pools shared with other sequences are left for their owner
+    this->mCommandPool = nullptr;
 
     if (this->mOperations.size()) {
         KP_LOG_INFO("Kompute Sequence clearing operations buffer");
         this->mOperations.clear();
+        this->mOperationLabels.clear();
+        this->mRecordedGenerations.clear();
     }
 
     if (this->timestampQueryPool) {
         KP_LOG_INFO("Destroying QueryPool");
         this->mDevice->destroy(
           *this->timestampQueryPool,
-          (vk::Optional<const vk::AllocationCallbacks>)nullptr);
+          HostAllocator::callbacks(this->mHostAllocator));
 
         this->timestampQueryPool = nullptr;
         KP_LOG_DEBUG("Kompute Sequence Destroyed QueryPool");
     }
 
+    if (this->mPipelineStatisticsQueryPool) {
+        this->mDevice->destroy(
+          *this->mPipelineStatisticsQueryPool,
+          HostAllocator::callbacks(this->mHostAllocator));
+
+        this->mPipelineStatisticsQueryPool = nullptr;
+        KP_LOG_DEBUG("Kompute Sequence Destroyed pipeline statistics "
+                     "QueryPool");
+    }
+
     if (this->mDevice) {
         this->mDevice = nullptr;
     }
@@ -271,31 +700,139 @@ Sequence::destroy()
     if (this->mComputeQueue) {
         this->mComputeQueue = nullptr;
     }
+    this->mQueueMutex = nullptr;
 }
 
 std::shared_ptr<Sequence>
 Sequence::record(std::shared_ptr<OpBase> op)
 {
-    KP_LOG_DEBUG("Kompute Sequence record function started");
+    return this->record(op, "");
+}
+
+std::shared_ptr<Sequence>
+Sequence::record(std::shared_ptr<OpBase> op, const std::string& label)
+{
+    Tracer::Span span("Sequence::record");
+
+    KP_LOG_SEQUENCE("Kompute Sequence record function started");
 
     this->begin();
 
-    KP_LOG_DEBUG(
+    KP_LOG_SEQUENCE(
       "Kompute Sequence running record on OpBase derived class instance");
 
-    op->record(*this->mCommandBuffer);
+    this->checkStagingRingOrder(op);
 
     this->mOperations.push_back(op);
+    this->mOperationLabels.push_back(label);
 
-    if (this->timestampQueryPool)
-        this->mCommandBuffer->writeTimestamp(
-          vk::PipelineStageFlagBits::eAllCommands,
-          *this->timestampQueryPool,
-          this->mOperations.size());
+    this->recordOperation(*this->mCommandBuffer,
+                          this->mHazardTracker,
+                          this->mOperations.size() - 1);
+    this->trackTensorGenerations(op);
+
+    return shared_from_this();
+}
+
+std::shared_ptr<Sequence>
+Sequence::record(const std::vector<std::shared_ptr<OpBase>>& ops)
+{
+    Tracer::Span span("Sequence::record");
+
+    KP_LOG_SEQUENCE("Kompute Sequence record function started with {} "
+                    "operations",
+                    ops.size());
+
+    this->begin();
+
+    this->mOperations.reserve(this->mOperations.size() + ops.size());
+    this->mOperationLabels.reserve(this->mOperationLabels.size() + ops.size());
+
+    for (const std::shared_ptr<OpBase>& op : ops) {
+        this->checkStagingRingOrder(op);
+
+        this->mOperations.push_back(op);
+        this->mOperationLabels.push_back("");
+
+        this->recordOperation(*this->mCommandBuffer,
+                              this->mHazardTracker,
+                              this->mOperations.size() - 1);
+        this->trackTensorGenerations(op);
+    }
 
     return shared_from_this();
 }
 
+void
+Sequence::checkStagingRingOrder(const std::shared_ptr<OpBase>& op)
+{
+    // The transfers of a staging ring are submitted on their own, uploads
+    // before the command buffer and downloads after it, so they only keep
+    // their order when uploads lead the sequence and downloads close it
+    std::shared_ptr<StagingRing> uploadRing = nullptr;
+    std::shared_ptr<StagingRing> downloadRing = nullptr;
+    if (OpTensorSyncDevice* syncDevice =
+          dynamic_cast<OpTensorSyncDevice*>(op.get())) {
+        uploadRing = syncDevice->stagingRing();
+    } else if (OpTensorSyncLocal* syncLocal =
+                 dynamic_cast<OpTensorSyncLocal*>(op.get())) {
+        downloadRing = syncLocal->stagingRing();
+    }
+
+    std::shared_ptr<StagingRing> ring = uploadRing ? uploadRing : downloadRing;
+    if (ring && *ring->queue() != *this->mComputeQueue) {
+        throw std::runtime_error(
+          "Kompute Sequence cannot record a sync through a staging ring that "
+          "submits to a different queue than the sequence");
+    }
+
+    if (this->mOperations.empty()) {
+        return;
+    }
+    std::shared_ptr<OpBase> last = this->mOperations.back();
+
+    OpTensorSyncDevice* lastSyncDevice =
+      dynamic_cast<OpTensorSyncDevice*>(last.get());
+    if (uploadRing && !(lastSyncDevice && lastSyncDevice->stagingRing())) {
+        throw std::runtime_error(fmt::format(
+          "Kompute Sequence cannot record a sync to device through a staging "
+          "ring after operation {}, as the ring uploads before the sequence "
+          "runs",
+          this->mOperations.size() - 1));
+    }
+
+    OpTensorSyncLocal* lastSyncLocal =
+      dynamic_cast<OpTensorSyncLocal*>(last.get());
+    if (lastSyncLocal && lastSyncLocal->stagingRing() && !downloadRing) {
+        throw std::runtime_error(fmt::format(
+          "Kompute Sequence cannot record operations after a sync to local "
+          "through a staging ring at operation {}, as the ring downloads "
+          "after the sequence runs",
+          this->mOperations.size() - 1));
+    }
+}
+
+void
+Sequence::trackTensorGenerations(const std::shared_ptr<OpBase>& op)
+{
+    for (const OpBase::TensorAccess& access : op->tensorAccesses()) {
+        this->mRecordedGenerations.emplace_back(access.tensor,
+                                                access.tensor->generation());
+    }
+}
+
+bool
+Sequence::tensorsRebuilt()
+{
+    for (const std::pair<std::shared_ptr<Tensor>, uint64_t>& recorded :
+         this->mRecordedGenerations) {
+        if (recorded.first->generation() != recorded.second) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void
 Sequence::createCommandPool()
 {
@@ -310,11 +847,14 @@ Sequence::createCommandPool()
 
     this->mFreeCommandPool = true;
 
-    vk::CommandPoolCreateInfo commandPoolInfo(vk::CommandPoolCreateFlags(),
-                                              this->mQueueIndex);
+    // Command buffers are re-recorded individually as operations change
+    vk::CommandPoolCreateInfo commandPoolInfo(
+      vk::CommandPoolCreateFlagBits::eResetCommandBuffer, this->mQueueIndex);
     this->mCommandPool = std::make_shared<vk::CommandPool>();
     this->mDevice->createCommandPool(
-      &commandPoolInfo, nullptr, this->mCommandPool.get());
+      &commandPoolInfo,
+      HostAllocator::callbacks(this->mHostAllocator),
+      this->mCommandPool.get());
     KP_LOG_DEBUG("Kompute Sequence Command Pool Created");
 }
 
@@ -331,13 +871,57 @@ Sequence::createCommandBuffer()
 
     this->mFreeCommandBuffer = true;
 
+    uint32_t commandBufferCount = this->mSubmissions.size();
     vk::CommandBufferAllocateInfo commandBufferAllocateInfo(
-      *this->mCommandPool, vk::CommandBufferLevel::ePrimary, 1);
+      *this->mCommandPool,
+      vk::CommandBufferLevel::ePrimary,
+      commandBufferCount);
 
-    this->mCommandBuffer = std::make_shared<vk::CommandBuffer>();
+    std::vector<vk::CommandBuffer> commandBuffers(commandBufferCount);
     this->mDevice->allocateCommandBuffers(&commandBufferAllocateInfo,
-                                          this->mCommandBuffer.get());
-    KP_LOG_DEBUG("Kompute Sequence Command Buffer Created");
+                                          commandBuffers.data());
+    for (uint32_t i = 0; i < commandBufferCount; i++) {
+        this->mSubmissions[i].commandBuffer =
+          std::make_shared<vk::CommandBuffer>(commandBuffers[i]);
+    }
+    this->mCommandBuffer = this->mSubmissions[0].commandBuffer;
+    KP_LOG_DEBUG("Kompute Sequence {} Command Buffers Created",
+                 commandBufferCount);
+}
+
+void
+Sequence::createFences()
+{
+    KP_LOG_DEBUG("Kompute Sequence creating fences");
+    if (!this->mDevice) {
+        throw std::runtime_error("Kompute Sequence device is null");
+    }
+
+    // Reused across submissions and reset once each submission completes
+    for (Submission& submission : this->mSubmissions) {
+        submission.fence = this->mDevice->createFence(
+          vk::FenceCreateInfo(),
+          HostAllocator::callbacks(this->mHostAllocator));
+    }
+    KP_LOG_DEBUG("Kompute Sequence Fences Created");
+}
+
+void
+Sequence::createTimelineSemaphore()
+{
+    KP_LOG_DEBUG("Kompute Sequence creating timeline semaphore");
+    if (!this->mDevice) {
+        throw std::runtime_error("Kompute Sequence device is null");
+    }
+
+    vk::SemaphoreTypeCreateInfo semaphoreTypeInfo(
+      vk::SemaphoreType::eTimeline, this->mTimelineValue);
+    vk::SemaphoreCreateInfo semaphoreInfo;
+    semaphoreInfo.setPNext(&semaphoreTypeInfo);
+
+    this->mTimelineSemaphore = this->mDevice->createSemaphore(
+      semaphoreInfo, HostAllocator::callbacks(this->mHostAllocator));
+    KP_LOG_DEBUG("Kompute Sequence Timeline Semaphore Created");
 }
 
 void
@@ -348,19 +932,40 @@ Sequence::createTimestampQueryPool(uint32_t totalTimestamps)
         throw std::runtime_error(
           "createTimestampQueryPool() called on uninitialized Sequence");
     }
-    if (!this->mPhysicalDevice) {
+    if (!this->mDeviceInfo) {
         throw std::runtime_error("Kompute Sequence physical device is null");
     }
 
-    vk::PhysicalDeviceProperties physicalDeviceProperties =
-      this->mPhysicalDevice->getProperties();
+    const vk::PhysicalDeviceProperties& physicalDeviceProperties =
+      this->mDeviceInfo->properties();
 
     if (physicalDeviceProperties.limits.timestampComputeAndGraphics) {
+        // Queue families without timestamps report no valid bits
+        const std::vector<vk::QueueFamilyProperties>& queueFamilyProperties =
+          this->mDeviceInfo->queueFamilyProperties();
+        uint32_t validBits = 64;
+        if (this->mQueueIndex < queueFamilyProperties.size()) {
+            validBits =
+              queueFamilyProperties[this->mQueueIndex].timestampValidBits;
+        }
+        if (!validBits) {
+            throw std::runtime_error(
+              fmt::format("Kompute Sequence queue family {} does not support "
+                          "timestamps",
+                          this->mQueueIndex));
+        }
+        this->mTimestampMask =
+          validBits >= 64 ? UINT64_MAX : (((uint64_t)1 << validBits) - 1);
+        this->mTimestampPeriod =
+          physicalDeviceProperties.limits.timestampPeriod;
+
         vk::QueryPoolCreateInfo queryPoolInfo;
         queryPoolInfo.setQueryCount(totalTimestamps);
         queryPoolInfo.setQueryType(vk::QueryType::eTimestamp);
         this->timestampQueryPool = std::make_shared<vk::QueryPool>(
-          this->mDevice->createQueryPool(queryPoolInfo));
+          this->mDevice->createQueryPool(
+            queryPoolInfo, HostAllocator::callbacks(this->mHostAllocator)));
+        this->mTimestampCount = totalTimestamps;
 
         KP_LOG_DEBUG("Query pool for timestamps created");
     } else {
@@ -368,13 +973,243 @@ Sequence::createTimestampQueryPool(uint32_t totalTimestamps)
     }
 }
 
+void
+Sequence::createPipelineStatisticsQueryPool(uint32_t totalPipelineStatistics)
+{
+    KP_LOG_DEBUG("Kompute Sequence creating pipeline statistics query pool");
+
+    if (!this->mDeviceInfo) {
+        throw std::runtime_error("Kompute Sequence physical device is null");
+    }
+    // Supported is not enough, creating the pool requires the feature to be
+    // enabled on the device, which external devices may not have done
+    if (!this->mDeviceInfo->enabledFeatures().pipelineStatisticsQuery) {
+        throw std::runtime_error(
+          "Kompute Sequence pipeline statistics require the "
+          "pipelineStatisticsQuery feature to be enabled on the device");
+    }
+    if (!this->mComputeSupported) {
+        throw std::runtime_error(
+          "Kompute Sequence pipeline statistics require a compute queue");
+    }
+
+    vk::QueryPoolCreateInfo queryPoolInfo;
+    queryPoolInfo.setQueryCount(totalPipelineStatistics);
+    queryPoolInfo.setQueryType(vk::QueryType::ePipelineStatistics);
+    queryPoolInfo.setPipelineStatistics(
+      vk::QueryPipelineStatisticFlagBits::eComputeShaderInvocations);
+    this->mPipelineStatisticsQueryPool = std::make_shared<vk::QueryPool>(
+      this->mDevice->createQueryPool(
+        queryPoolInfo, HostAllocator::callbacks(this->mHostAllocator)));
+    this->mPipelineStatisticsCount = totalPipelineStatistics;
+}
+
+void
+Sequence::resetQueries(const vk::CommandBuffer& commandBuffer)
+{
+    if (this->timestampQueryPool) {
+        commandBuffer.resetQueryPool(
+          *this->timestampQueryPool, 0, this->mTimestampCount);
+    }
+    if (this->mPipelineStatisticsQueryPool) {
+        commandBuffer.resetQueryPool(*this->mPipelineStatisticsQueryPool,
+                                     0,
+                                     this->mPipelineStatisticsCount);
+    }
+}
+
+void
+Sequence::recordOperation(const vk::CommandBuffer& commandBuffer,
+                          HazardTracker& hazardTracker,
+                          uint32_t operationIndex)
+{
+    const std::shared_ptr<OpBase>& op = this->mOperations[operationIndex];
+
+    // Only dispatches run compute shaders, the queries of the other
+    // operations are left unavailable
+    bool statistics = this->mPipelineStatisticsQueryPool &&
+                      operationIndex < this->mPipelineStatisticsCount &&
+                      dynamic_cast<OpAlgoDispatch*>(op.get());
+    if (statistics) {
+        commandBuffer.beginQuery(*this->mPipelineStatisticsQueryPool,
+                                 operationIndex,
+                                 vk::QueryControlFlags());
+    }
+
+    // The label covers the barriers recorded for the operation as well
+    if (this->mDebugUtils) {
+        this->mDebugUtils->beginLabel(commandBuffer,
+                                      this->operationLabel(operationIndex));
+    }
+
+    uint64_t barrierCount = hazardTracker.barrierCount();
+    hazardTracker.recordOperation(commandBuffer, op);
+    if (this->mMetrics) {
+        this->mMetrics->add(Metrics::Counter::eBarriers,
+                            hazardTracker.barrierCount() - barrierCount);
+    }
+
+    if (this->mDebugUtils) {
+        this->mDebugUtils->endLabel(commandBuffer);
+    }
+    if (statistics) {
+        commandBuffer.endQuery(*this->mPipelineStatisticsQueryPool,
+                               operationIndex);
+    }
+    if (this->timestampQueryPool) {
+        this->writeTimestamp(commandBuffer, operationIndex + 1);
+    }
+}
+
+void
+Sequence::setName(const std::string& name)
+{
+    this->mName = name;
+
+    if (!this->mDebugUtils || !this->mDevice) {
+        return;
+    }
+
+    for (size_t i = 0; i < this->mSubmissions.size(); i++) {
+        if (!this->mSubmissions[i].commandBuffer) {
+            continue;
+        }
+        // Command buffers of the submissions in flight are told apart
+        std::string commandBufferName =
+          this->mSubmissions.size() > 1 ? fmt::format("{} #{}", name, i)
+                                        : name;
+        this->mDebugUtils->setObjectName(
+          *this->mDevice,
+          vk::ObjectType::eCommandBuffer,
+          (uint64_t)(VkCommandBuffer)*this->mSubmissions[i].commandBuffer,
+          commandBufferName);
+    }
+    if (this->timestampQueryPool) {
+        this->mDebugUtils->setObjectName(
+          *this->mDevice,
+          vk::ObjectType::eQueryPool,
+          (uint64_t)(VkQueryPool)*this->timestampQueryPool,
+          name + " (timestamps)");
+    }
+    if (this->mPipelineStatisticsQueryPool) {
+        this->mDebugUtils->setObjectName(
+          *this->mDevice,
+          vk::ObjectType::eQueryPool,
+          (uint64_t)(VkQueryPool)*this->mPipelineStatisticsQueryPool,
+          name + " (pipeline statistics)");
+    }
+}
+
+const std::string&
+Sequence::name()
+{
+    return this->mName;
+}
+
+std::string
+Sequence::operationLabel(size_t operationIndex)
+{
+    return this->mOperationLabels[operationIndex].size()
+             ? this->mOperationLabels[operationIndex]
+             : operationTypeName(*this->mOperations[operationIndex]);
+}
+
+void
+Sequence::traceTimestamps(int64_t completedNs)
+{
+    size_t count = std::min<size_t>(this->mOperations.size() + 1,
+                                    this->mTimestampCount);
+    if (count < 2) {
+        return;
+    }
+
+    // The submission completed, so the timestamps are available
+    std::vector<uint64_t> timestamps(count, 0);
+    if (this->mDevice->getQueryPoolResults(*this->timestampQueryPool,
+                                           0,
+                                           count,
+                                           count * sizeof(uint64_t),
+                                           timestamps.data(),
+                                           sizeof(uint64_t),
+                                           vk::QueryResultFlagBits::e64) !=
+        vk::Result::eSuccess) {
+        return;
+    }
+
+    // A device tick and the host time it corresponds to, which is the last
+    // timestamp and the time the completion was seen unless calibrated
+    uint64_t deviceTicks = timestamps.back();
+    int64_t hostNs = completedNs;
+#if defined(__linux__) || defined(__ANDROID__)
+    // The steady clock of the tracer is CLOCK_MONOTONIC on these platforms,
+    // which only devices with the extension enabled calibrate against
+    if (!this->mCalibrationResolved && this->mDeviceInfo &&
+        this->mDeviceInfo->hasCalibratedTimestamps()) {
+        this->mGetCalibratedTimestamps =
+          (PFN_vkGetCalibratedTimestampsEXT)this->mDevice->getProcAddr(
+            "vkGetCalibratedTimestampsEXT");
+    }
+    this->mCalibrationResolved = true;
+    if (this->mGetCalibratedTimestamps) {
+        VkCalibratedTimestampInfoEXT infos[2] = {};
+        infos[0].sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+        infos[0].timeDomain = VK_TIME_DOMAIN_DEVICE_EXT;
+        infos[1].sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+        infos[1].timeDomain = VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT;
+        uint64_t values[2] = { 0, 0 };
+        uint64_t maxDeviation = 0;
+        if (this->mGetCalibratedTimestamps(
+              *this->mDevice, 2, infos, values, &maxDeviation) ==
+            VK_SUCCESS) {
+            deviceTicks = values[0];
+            hostNs = values[1];
+        }
+    }
+#endif
+
+    for (size_t i = 0; i + 1 < count; i++) {
+        uint64_t startTicks =
+          (deviceTicks - timestamps[i]) & this->mTimestampMask;
+        uint64_t endTicks =
+          (deviceTicks - timestamps[i + 1]) & this->mTimestampMask;
+        Tracer::recordGpuSpan(
+          this->operationLabel(i),
+          this->mQueueIndex,
+          hostNs - (int64_t)(startTicks * this->mTimestampPeriod),
+          hostNs - (int64_t)(endTicks * this->mTimestampPeriod));
+    }
+}
+
+void
+Sequence::writeTimestamp(const vk::CommandBuffer& commandBuffer,
+                         uint32_t query)
+{
+    // Operations past the timestamps allocated are not timed
+    if (query < this->mTimestampCount) {
+        commandBuffer.writeTimestamp(vk::PipelineStageFlagBits::eAllCommands,
+                                     *this->timestampQueryPool,
+                                     query);
+    }
+}
+
+uint32_t
+Sequence::timedOperationCount()
+{
+    if (!this->timestampQueryPool) {
+        return 0;
+    }
+    // The first timestamp is latched before the first operation
+    return this->mTimestampCount - 1;
+}
+
 std::vector<std::uint64_t>
 Sequence::getTimestamps()
 {
     if (!this->timestampQueryPool)
         throw std::runtime_error("Timestamp latching not enabled");
 
-    const auto n = this->mOperations.size() + 1;
+    const auto n = std::min<size_t>(this->mOperations.size() + 1,
+                                    this->mTimestampCount);
     std::vector<std::uint64_t> timestamps(n, 0);
     this->mDevice->getQueryPoolResults(
       *this->timestampQueryPool,
@@ -388,4 +1223,80 @@ Sequence::getTimestamps()
     return timestamps;
 }
 
+std::vector<Sequence::OpTiming>
+Sequence::getOpTimings(bool wait)
+{
+    if (!this->timestampQueryPool && !this->mPipelineStatisticsQueryPool)
+        throw std::runtime_error(
+          "Timestamp latching and pipeline statistics not enabled");
+
+    size_t count = this->mOperations.size();
+    if (this->timestampQueryPool) {
+        count = std::min<size_t>(count, this->mTimestampCount - 1);
+    }
+
+    vk::QueryResultFlags flags = vk::QueryResultFlagBits::e64;
+    if (wait) {
+        flags |= vk::QueryResultFlagBits::eWait;
+    }
+
+    std::vector<OpTiming> timings(count);
+    for (size_t i = 0; i < count; i++) {
+        timings[i].label = this->operationLabel(i);
+    }
+
+    if (this->timestampQueryPool && count) {
+        std::vector<std::uint64_t> timestamps(count + 1, 0);
+        vk::Result result = this->mDevice->getQueryPoolResults(
+          *this->timestampQueryPool,
+          0,
+          timestamps.size(),
+          timestamps.size() * sizeof(std::uint64_t),
+          timestamps.data(),
+          sizeof(uint64_t),
+          flags);
+        // Without a wait the results are only returned once they are all
+        // available, which the submission completing guarantees
+        if (result == vk::Result::eNotReady) {
+            return {};
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            // The difference is taken modulo the valid bits, so a counter
+            // wrapping around between two timestamps still gives the
+            // duration
+            uint64_t ticks =
+              (timestamps[i + 1] - timestamps[i]) & this->mTimestampMask;
+            timings[i].durationNs = ticks * this->mTimestampPeriod;
+        }
+    }
+
+    // The queries of the operations other than dispatches never become
+    // available, so the dispatches are queried one at a time
+    size_t statisticsCount =
+      this->mPipelineStatisticsQueryPool
+        ? std::min<size_t>(count, this->mPipelineStatisticsCount)
+        : 0;
+    for (size_t i = 0; i < statisticsCount; i++) {
+        if (!dynamic_cast<OpAlgoDispatch*>(this->mOperations[i].get())) {
+            continue;
+        }
+        uint64_t invocations = 0;
+        vk::Result result = this->mDevice->getQueryPoolResults(
+          *this->mPipelineStatisticsQueryPool,
+          i,
+          1,
+          sizeof(uint64_t),
+          &invocations,
+          sizeof(uint64_t),
+          flags);
+        if (result == vk::Result::eNotReady) {
+            return {};
+        }
+        timings[i].computeInvocations = invocations;
+    }
+
+    return timings;
+}
+
 }
@@ -0,0 +1,267 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+
+#if KOMPUTE_ENABLE_SHADER_COMPILER
+#include <glslang/Public/ResourceLimits.h>
+#include <glslang/Public/ShaderLang.h>
+// If glslang is cloned the SPIRV headers are not under the glslang directory
+#ifdef USE_EXTERNAL_GLSLANG
+#include <SPIRV/GlslangToSpv.h>
+#else
+#include <glslang/SPIRV/GlslangToSpv.h>
+#endif
+#endif
+
+#include "kompute/Shader.hpp"
+
+namespace kp {
+
+namespace {
+
+std::mutex cacheMutex;
+std::unordered_map<std::string, std::vector<uint32_t>> cacheEntries;
+std::string cacheDirectoryPath;
+
+void
+appendHash(uint64_t& hash, const std::string& value)
+{
+    // The size separates consecutive strings, so that moving characters
+    // between them changes the hash
+    uint64_t size = value.size();
+    for (size_t i = 0; i < sizeof(size); i++) {
+        hash = (hash ^ ((size >> (i * 8)) & 0xff)) * 1099511628211ULL;
+    }
+    for (unsigned char c : value) {
+        hash = (hash ^ c) * 1099511628211ULL;
+    }
+}
+
+std::string
+cachePath(const std::string& directory, const std::string& key)
+{
+    return directory + "/" + key + ".spv";
+}
+
+bool
+readCacheFile(const std::string& path, std::vector<uint32_t>& spirv)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return false;
+    }
+    std::streamsize size = file.tellg();
+    if (size <= 0 || size % sizeof(uint32_t)) {
+        return false;
+    }
+    file.seekg(0);
+    spirv.resize(size / sizeof(uint32_t));
+    return (bool)file.read(reinterpret_cast<char*>(spirv.data()), size);
+}
+
+void
+writeCacheFile(const std::string& path, const std::vector<uint32_t>& spirv)
+{
+    // Written to a temporary file first so that other processes sharing the
+    // directory never read a partial file
+    std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            KP_LOG_WARN("Kompute Shader could not write cache file {}",
+                        tmpPath);
+            return;
+        }
+        file.write(reinterpret_cast<const char*>(spirv.data()),
+                   spirv.size() * sizeof(uint32_t));
+        if (!file) {
+            KP_LOG_WARN("Kompute Shader could not write cache file {}",
+                        tmpPath);
+            return;
+        }
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str())) {
+        KP_LOG_WARN("Kompute Shader could not rename cache file {}", tmpPath);
+        std::remove(tmpPath.c_str());
+    }
+}
+
+#if KOMPUTE_ENABLE_SHADER_COMPILER
+
+std::mutex compilerMutex;
+std::once_flag compilerInitialized;
+
+std::vector<uint32_t>
+compileSpirv(const std::string& source,
+             const std::vector<std::pair<std::string, std::string>>& definitions,
+             Shader::Language language,
+             const std::string& entryPoint)
+{
+    std::call_once(compilerInitialized, []() {
+        glslang::InitializeProcess();
+        std::atexit(glslang::FinalizeProcess);
+    });
+
+    // The parsing of glslang relies on process wide state
+    std::lock_guard<std::mutex> lock(compilerMutex);
+
+    std::string preamble;
+    for (const std::pair<std::string, std::string>& definition : definitions) {
+        preamble += "#define " + definition.first + " " + definition.second +
+                    "\n";
+    }
+
+#if VK_VERSION_MINOR(KOMPUTE_VK_API_VERSION) >= 2
+    glslang::EShTargetClientVersion clientVersion =
+      glslang::EShTargetVulkan_1_2;
+    glslang::EShTargetLanguageVersion spirvVersion = glslang::EShTargetSpv_1_5;
+#elif VK_VERSION_MINOR(KOMPUTE_VK_API_VERSION) == 1
+    glslang::EShTargetClientVersion clientVersion =
+      glslang::EShTargetVulkan_1_1;
+    glslang::EShTargetLanguageVersion spirvVersion = glslang::EShTargetSpv_1_3;
+#else
+    glslang::EShTargetClientVersion clientVersion =
+      glslang::EShTargetVulkan_1_0;
+    glslang::EShTargetLanguageVersion spirvVersion = glslang::EShTargetSpv_1_0;
+#endif
+
+    glslang::EShSource sourceLanguage = language == Shader::Language::eHlsl
+                                          ? glslang::EShSourceHlsl
+                                          : glslang::EShSourceGlsl;
+
+    const char* sourceData = source.c_str();
+    glslang::TShader shader(EShLangCompute);
+    shader.setStrings(&sourceData, 1);
+    shader.setPreamble(preamble.c_str());
+    shader.setEntryPoint(entryPoint.c_str());
+    shader.setSourceEntryPoint(entryPoint.c_str());
+    shader.setEnvInput(
+      sourceLanguage, EShLangCompute, glslang::EShClientVulkan, 100);
+    shader.setEnvClient(glslang::EShClientVulkan, clientVersion);
+    shader.setEnvTarget(glslang::EShTargetSpv, spirvVersion);
+
+    EShMessages messages = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules);
+    if (!shader.parse(GetDefaultResources(), 100, false, messages)) {
+        throw std::runtime_error(
+          fmt::format("Kompute Shader compilation failed: {}{}",
+                      shader.getInfoLog(),
+                      shader.getInfoDebugLog()));
+    }
+
+    glslang::TProgram program;
+    program.addShader(&shader);
+    if (!program.link(messages)) {
+        throw std::runtime_error(
+          fmt::format("Kompute Shader linking failed: {}{}",
+                      program.getInfoLog(),
+                      program.getInfoDebugLog()));
+    }
+
+    std::vector<uint32_t> spirv;
+    glslang::GlslangToSpv(*program.getIntermediate(EShLangCompute), spirv);
+    return spirv;
+}
+
+#endif
+
+}
+
+std::vector<uint32_t>
+Shader::compile(
+  const std::string& source,
+  const std::vector<std::pair<std::string, std::string>>& definitions,
+  Language language,
+  const std::string& entryPoint)
+{
+    std::string shaderKey = key(source, definitions, language, entryPoint);
+
+    std::string directory;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto it = cacheEntries.find(shaderKey);
+        if (it != cacheEntries.end()) {
+            return it->second;
+        }
+        directory = cacheDirectoryPath;
+    }
+
+    std::vector<uint32_t> spirv;
+    if (!directory.empty() &&
+        readCacheFile(cachePath(directory, shaderKey), spirv)) {
+        KP_LOG_DEBUG("Kompute Shader read {} from the on-disk cache",
+                     shaderKey);
+    } else {
+#if KOMPUTE_ENABLE_SHADER_COMPILER
+        KP_LOG_DEBUG("Kompute Shader compiling {}", shaderKey);
+        spirv = compileSpirv(source, definitions, language, entryPoint);
+        if (!directory.empty()) {
+            writeCacheFile(cachePath(directory, shaderKey), spirv);
+        }
+#else
+        throw std::runtime_error(fmt::format(
+          "Kompute Shader {} is not cached and Kompute was built without "
+          "the shader compiler, enable KOMPUTE_OPT_ENABLE_SHADER_COMPILER",
+          shaderKey));
+#endif
+    }
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    cacheEntries.emplace(shaderKey, spirv);
+    return spirv;
+}
+
+std::string
+Shader::key(const std::string& source,
+            const std::vector<std::pair<std::string, std::string>>& definitions,
+            Language language,
+            const std::string& entryPoint)
+{
+    // FNV-1a over the source and every option changing the SPIR-V
+    uint64_t hash = 14695981039346656037ULL;
+    appendHash(hash, source);
+    for (const std::pair<std::string, std::string>& definition : definitions) {
+        appendHash(hash, definition.first);
+        appendHash(hash, definition.second);
+    }
+    appendHash(hash, entryPoint);
+    appendHash(hash,
+               fmt::format("{}-{}", (uint32_t)language, KOMPUTE_VK_API_VERSION));
+
+    return fmt::format("{:016x}", hash);
+}
+
+void
+Shader::setCacheDirectory(const std::string& directory)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    cacheDirectoryPath = directory;
+}
+
+std::string
+Shader::cacheDirectory()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    return cacheDirectoryPath;
+}
+
+void
+Shader::clearCache()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    cacheEntries.clear();
+}
+
+bool
+Shader::compilerAvailable()
+{
+#if KOMPUTE_ENABLE_SHADER_COMPILER
+    return true;
+#else
+    return false;
+#endif
+}
+
+}
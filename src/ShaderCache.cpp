@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "kompute/ShaderCache.hpp"
+
+namespace kp {
+
+namespace {
+
+template<typename T>
+void
+appendBytes(std::string& key, const T& value)
+{
+    key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+}
+
+ShaderCache::ShaderCache(std::shared_ptr<vk::Device> device,
+                         std::shared_ptr<HostAllocator> hostAllocator)
+{
+    KP_LOG_DEBUG("Kompute ShaderCache constructor");
+
+    if (!device) {
+        throw std::runtime_error("Kompute ShaderCache device is null");
+    }
+
+    this->mDevice = device;
+    this->mHostAllocator = hostAllocator;
+}
+
+ShaderCache::~ShaderCache()
+{
+    KP_LOG_DEBUG("Kompute ShaderCache destructor started");
+
+    if (this->mDevice) {
+        this->destroy();
+    }
+}
+
+std::string
+ShaderCache::key(const std::vector<uint32_t>& spirv,
+                 const void* specializationConstantsData,
+                 uint32_t specializationConstantsDataTypeMemorySize,
+                 uint32_t specializationConstantsSize,
+                 uint32_t pushConstantsRangeSize,
+                 const std::vector<vk::DescriptorType>& descriptorTypes,
+                 uint32_t localSizeX)
+{
+    // FNV-1a over the words of the SPIR-V, which is checked together with
+    // its size
+    uint64_t spirvHash = 14695981039346656037ULL;
+    for (uint32_t word : spirv) {
+        spirvHash = (spirvHash ^ word) * 1099511628211ULL;
+    }
+
+    std::string key;
+    appendBytes(key, spirvHash);
+    appendBytes(key, static_cast<uint64_t>(spirv.size()));
+    appendBytes(key, pushConstantsRangeSize);
+    appendBytes(key, specializationConstantsDataTypeMemorySize);
+    appendBytes(key, specializationConstantsSize);
+    appendBytes(key, localSizeX);
+    if (specializationConstantsData) {
+        key.append(static_cast<const char*>(specializationConstantsData),
+                   specializationConstantsDataTypeMemorySize *
+                     specializationConstantsSize);
+    }
+    for (vk::DescriptorType descriptorType : descriptorTypes) {
+        appendBytes(key, static_cast<uint32_t>(descriptorType));
+    }
+    return key;
+}
+
+bool
+ShaderCache::find(const std::string& key, Entry& entry)
+{
+    std::lock_guard<std::mutex> lock(this->mMutex);
+
+    auto it = this->mEntries.find(key);
+    if (it == this->mEntries.end()) {
+        return false;
+    }
+
+    KP_LOG_DEBUG("Kompute ShaderCache reusing cached pipeline");
+    entry = it->second;
+    return true;
+}
+
+void
+ShaderCache::insert(const std::string& key, Entry& entry)
+{
+    std::lock_guard<std::mutex> lock(this->mMutex);
+
+    if (!this->mDevice) {
+        throw std::runtime_error(
+          "Kompute ShaderCache insert called after destroy");
+    }
+
+    auto inserted = this->mEntries.insert({ key, entry });
+    if (!inserted.second) {
+        KP_LOG_DEBUG("Kompute ShaderCache pipeline cached meanwhile, "
+                     "destroying duplicate");
+        this->destroyEntry(entry);
+        entry = inserted.first->second;
+    }
+}
+
+void
+ShaderCache::prune()
+{
+    std::lock_guard<std::mutex> lock(this->mMutex);
+
+    // The cache holds the only reference once no algorithm uses the entry
+    for (auto it = this->mEntries.begin(); it != this->mEntries.end();) {
+        if (it->second.pipeline.use_count() == 1) {
+            this->destroyEntry(it->second);
+            it = this->mEntries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+uint32_t
+ShaderCache::size()
+{
+    std::lock_guard<std::mutex> lock(this->mMutex);
+    return this->mEntries.size();
+}
+
+void
+ShaderCache::destroy()
+{
+    KP_LOG_DEBUG("Kompute ShaderCache destroy called");
+
+    if (!this->mDevice) {
+        KP_LOG_WARN("Kompute ShaderCache destroy called "
+                    "with null Device pointer");
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(this->mMutex);
+
+    for (const auto& entry : this->mEntries) {
+        this->destroyEntry(entry.second);
+    }
+    this->mEntries.clear();
+
+    this->mDevice = nullptr;
+}
+
+void
+ShaderCache::destroyEntry(const Entry& entry)
+{
+    this->mDevice->destroy(
+      *entry.pipeline, HostAllocator::callbacks(this->mHostAllocator));
+    this->mDevice->destroy(
+      *entry.pipelineLayout,
+      HostAllocator::callbacks(this->mHostAllocator));
+    this->mDevice->destroy(
+      *entry.descriptorSetLayout,
+      HostAllocator::callbacks(this->mHostAllocator));
+    this->mDevice->destroy(
+      *entry.shaderModule,
+      HostAllocator::callbacks(this->mHostAllocator));
+}
+
+}
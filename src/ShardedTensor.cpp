@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "kompute/ShardedTensor.hpp"
+
+namespace kp {
+
+ShardedTensor::ShardedTensor(const std::vector<std::shared_ptr<Tensor>>& shards,
+                             const std::vector<uint64_t>& offsets,
+                             uint64_t size,
+                             Layout layout)
+{
+    KP_LOG_DEBUG("Kompute ShardedTensor constructor with {} shards",
+                 shards.size());
+
+    if (shards.empty() || shards.size() != offsets.size()) {
+        throw std::runtime_error(
+          "Kompute ShardedTensor requires an offset for each of its shards");
+    }
+
+    this->mShards = shards;
+    this->mOffsets = offsets;
+    this->mSize = size;
+    this->mLayout = layout;
+}
+
+ShardedTensor::~ShardedTensor()
+{
+    KP_LOG_DEBUG("Kompute ShardedTensor destructor started");
+}
+
+const std::vector<std::shared_ptr<Tensor>>&
+ShardedTensor::shards()
+{
+    return this->mShards;
+}
+
+std::shared_ptr<Tensor>
+ShardedTensor::shard(uint32_t deviceIndex)
+{
+    if (deviceIndex >= this->mShards.size()) {
+        throw std::runtime_error(
+          fmt::format("Kompute ShardedTensor device index {} out of range for "
+                      "{} shards",
+                      deviceIndex,
+                      this->mShards.size()));
+    }
+    return this->mShards[deviceIndex];
+}
+
+uint64_t
+ShardedTensor::shardOffset(uint32_t deviceIndex)
+{
+    this->shard(deviceIndex);
+    return this->mOffsets[deviceIndex];
+}
+
+uint64_t
+ShardedTensor::size()
+{
+    return this->mSize;
+}
+
+ShardedTensor::Layout
+ShardedTensor::layout()
+{
+    return this->mLayout;
+}
+
+}
@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+
+#include "kompute/SparseTensor.hpp"
+
+namespace kp {
+
+SparseTensor::SparseTensor(std::shared_ptr<Tensor> rowPointers,
+                           std::shared_ptr<Tensor> columnIndices,
+                           std::shared_ptr<Tensor> values,
+                           uint32_t rows,
+                           uint32_t columns,
+                           uint32_t nonZeroCount)
+{
+    KP_LOG_DEBUG("Kompute SparseTensor constructor with {} rows {} columns "
+                 "and {} non zeros",
+                 rows,
+                 columns,
+                 nonZeroCount);
+
+    if (!rowPointers || !columnIndices || !values) {
+        throw std::runtime_error(
+          "Kompute SparseTensor requires row pointers, column indices and "
+          "values tensors");
+    }
+    if (rowPointers->dataType() != Tensor::TensorDataTypes::eUnsignedInt ||
+        columnIndices->dataType() != Tensor::TensorDataTypes::eUnsignedInt ||
+        values->dataType() != Tensor::TensorDataTypes::eFloat) {
+        throw std::runtime_error(
+          "Kompute SparseTensor indices must be unsigned int tensors and "
+          "values a float tensor");
+    }
+
+    uint64_t nonZeroSize = std::max<uint64_t>(nonZeroCount, 1);
+    if (rowPointers->size() < (uint64_t)rows + 1 ||
+        columnIndices->size() < nonZeroSize || values->size() < nonZeroSize) {
+        throw std::runtime_error(
+          fmt::format("Kompute SparseTensor tensors of {}, {} and {} elements "
+                      "cannot hold {} rows and {} non zeros",
+                      rowPointers->size(),
+                      columnIndices->size(),
+                      values->size(),
+                      rows,
+                      nonZeroCount));
+    }
+
+    this->mRowPointers = rowPointers;
+    this->mColumnIndices = columnIndices;
+    this->mValues = values;
+    this->mRows = rows;
+    this->mColumns = columns;
+    this->mNonZeroCount = nonZeroCount;
+}
+
+SparseTensor::~SparseTensor()
+{
+    KP_LOG_DEBUG("Kompute SparseTensor destructor started");
+}
+
+std::shared_ptr<Tensor>
+SparseTensor::rowPointers()
+{
+    return this->mRowPointers;
+}
+
+std::shared_ptr<Tensor>
+SparseTensor::columnIndices()
+{
+    return this->mColumnIndices;
+}
+
+std::shared_ptr<Tensor>
+SparseTensor::values()
+{
+    return this->mValues;
+}
+
+std::vector<std::shared_ptr<Tensor>>
+SparseTensor::tensors()
+{
+    return { this->mRowPointers, this->mColumnIndices, this->mValues };
+}
+
+uint32_t
+SparseTensor::rows()
+{
+    return this->mRows;
+}
+
+uint32_t
+SparseTensor::columns()
+{
+    return this->mColumns;
+}
+
+uint32_t
+SparseTensor::nonZeroCount()
+{
+    return this->mNonZeroCount;
+}
+
+void
+SparseTensor::validate(uint32_t rows,
+                       uint32_t columns,
+                       uint32_t nonZeroCount,
+                       const uint32_t* rowPointers,
+                       const uint32_t* columnIndices)
+{
+    if (rowPointers[0] != 0 || rowPointers[rows] != nonZeroCount) {
+        throw std::runtime_error(
+          fmt::format("Kompute SparseTensor row pointers must go from 0 to "
+                      "the {} non zeros but go from {} to {}",
+                      nonZeroCount,
+                      rowPointers[0],
+                      rowPointers[rows]));
+    }
+    for (uint32_t row = 0; row < rows; row++) {
+        if (rowPointers[row + 1] < rowPointers[row]) {
+            throw std::runtime_error(fmt::format(
+              "Kompute SparseTensor row pointer of row {} decreases", row));
+        }
+    }
+    for (uint32_t i = 0; i < nonZeroCount; i++) {
+        if (columnIndices[i] >= columns) {
+            throw std::runtime_error(
+              fmt::format("Kompute SparseTensor column index {} of non zero {} "
+                          "out of range for {} columns",
+                          columnIndices[i],
+                          i,
+                          columns));
+        }
+    }
+}
+
+}
@@ -0,0 +1,294 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "kompute/StagingRing.hpp"
+
+namespace kp {
+
+StagingRing::StagingRing(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
+                         std::shared_ptr<vk::Device> device,
+                         std::shared_ptr<vk::Queue> computeQueue,
+                         uint32_t queueIndex,
+                         std::shared_ptr<MemoryPool> memoryPool,
+                         vk::DeviceSize ringSize,
+                         uint32_t slotCount,
+                         std::shared_ptr<std::mutex> queueMutex,
+                         std::shared_ptr<HostAllocator> hostAllocator)
+{
+    KP_LOG_DEBUG("Kompute StagingRing constructor with size {} and {} slots",
+                 ringSize,
+                 slotCount);
+
+    if (!device || !memoryPool) {
+        throw std::runtime_error(
+          "Kompute StagingRing device or memory pool is null");
+    }
+    if (slotCount < 1 || ringSize < slotCount) {
+        throw std::runtime_error(
+          "Kompute StagingRing requires at least one non-empty slot");
+    }
+
+    this->mPhysicalDevice = physicalDevice;
+    this->mDevice = device;
+    this->mComputeQueue = computeQueue;
+    this->mQueueMutex = queueMutex;
+    this->mMemoryPool = memoryPool;
+    this->mHostAllocator = hostAllocator;
+    this->mSize = ringSize;
+    this->mSlotSize = ringSize / slotCount;
+
+    this->mWaitStageMask = vk::PipelineStageFlagBits::eTransfer;
+    std::vector<vk::QueueFamilyProperties> queueFamilyProperties =
+      physicalDevice ? physicalDevice->getQueueFamilyProperties()
+                     : std::vector<vk::QueueFamilyProperties>();
+    if (queueIndex >= queueFamilyProperties.size() ||
+        queueFamilyProperties[queueIndex].queueFlags &
+          vk::QueueFlagBits::eCompute) {
+        this->mWaitStageMask |= vk::PipelineStageFlagBits::eComputeShader;
+    }
+
+    vk::BufferCreateInfo bufferInfo(vk::BufferCreateFlags(),
+                                    this->mSize,
+                                    vk::BufferUsageFlagBits::eTransferSrc |
+                                      vk::BufferUsageFlagBits::eTransferDst,
+                                    vk::SharingMode::eExclusive);
+    this->mDevice->createBuffer(
+      &bufferInfo,
+      HostAllocator::callbacks(this->mHostAllocator),
+      &this->mBuffer);
+
+    vk::MemoryRequirements memoryRequirements =
+      this->mDevice->getBufferMemoryRequirements(this->mBuffer);
+    this->mAllocation = this->mMemoryPool->allocate(
+      memoryRequirements,
+      vk::MemoryPropertyFlagBits::eHostVisible |
+        vk::MemoryPropertyFlagBits::eHostCoherent);
+    this->mDevice->bindBufferMemory(
+      this->mBuffer, this->mAllocation.memory, this->mAllocation.offset);
+
+    vk::CommandPoolCreateInfo commandPoolInfo(
+      vk::CommandPoolCreateFlagBits::eResetCommandBuffer, queueIndex);
+    this->mDevice->createCommandPool(
+      &commandPoolInfo,
+      HostAllocator::callbacks(this->mHostAllocator),
+      &this->mCommandPool);
+
+    std::vector<vk::CommandBuffer> commandBuffers(slotCount);
+    vk::CommandBufferAllocateInfo commandBufferAllocateInfo(
+      this->mCommandPool, vk::CommandBufferLevel::ePrimary, slotCount);
+    this->mDevice->allocateCommandBuffers(&commandBufferAllocateInfo,
+                                          commandBuffers.data());
+
+    this->mSlots.resize(slotCount);
+    for (uint32_t i = 0; i < slotCount; i++) {
+        this->mSlots[i].offset = i * this->mSlotSize;
+        this->mSlots[i].commandBuffer = commandBuffers[i];
+        this->mSlots[i].fence = this->mDevice->createFence(
+          vk::FenceCreateInfo(),
+          HostAllocator::callbacks(this->mHostAllocator));
+    }
+}
+
+StagingRing::~StagingRing()
+{
+    KP_LOG_DEBUG("Kompute StagingRing destructor started");
+
+    if (this->mDevice) {
+        this->destroy();
+    }
+}
+
+void
+StagingRing::upload(const void* data,
+                    const vk::Buffer& dstBuffer,
+                    vk::DeviceSize dstOffset,
+                    vk::DeviceSize size)
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    KP_LOG_DEBUG("Kompute StagingRing uploading {} bytes", size);
+
+    for (vk::DeviceSize done = 0; done < size; done += this->mSlotSize) {
+        vk::DeviceSize chunkSize = std::min(this->mSlotSize, size - done);
+        Slot& slot = this->acquireSlot();
+
+        memcpy((uint8_t*)this->mAllocation.mappedData + slot.offset,
+               (const uint8_t*)data + done,
+               chunkSize);
+
+        this->submitSlot(slot,
+                         this->mBuffer,
+                         dstBuffer,
+                         vk::BufferCopy(slot.offset, dstOffset + done, chunkSize),
+                         false);
+    }
+}
+
+void
+StagingRing::download(const vk::Buffer& srcBuffer,
+                      vk::DeviceSize srcOffset,
+                      void* data,
+                      vk::DeviceSize size)
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    KP_LOG_DEBUG("Kompute StagingRing downloading {} bytes", size);
+
+    for (vk::DeviceSize done = 0; done < size; done += this->mSlotSize) {
+        vk::DeviceSize chunkSize = std::min(this->mSlotSize, size - done);
+        Slot& slot = this->acquireSlot();
+
+        slot.readbackData = (uint8_t*)data + done;
+        slot.readbackSize = chunkSize;
+
+        this->submitSlot(slot,
+                         srcBuffer,
+                         this->mBuffer,
+                         vk::BufferCopy(srcOffset + done, slot.offset, chunkSize),
+                         true);
+    }
+
+    for (Slot& slot : this->mSlots) {
+        this->completeSlot(slot);
+    }
+}
+
+void
+StagingRing::waitIdle()
+{
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    for (Slot& slot : this->mSlots) {
+        this->completeSlot(slot);
+    }
+}
+
+void
+StagingRing::destroy()
+{
+    KP_LOG_DEBUG("Kompute StagingRing started destroy()");
+
+    if (!this->mDevice) {
+        KP_LOG_WARN(
+          "Kompute StagingRing destroy reached with null Device pointer");
+        return;
+    }
+
+    this->waitIdle();
+
+    std::unique_lock<std::mutex> lock(this->mMutex);
+
+    for (Slot& slot : this->mSlots) {
+        this->mDevice->destroy(
+          slot.fence, HostAllocator::callbacks(this->mHostAllocator));
+    }
+    this->mSlots.clear();
+
+    // Command buffers are freed together with their pool
+    this->mDevice->destroy(
+      this->mCommandPool,
+      HostAllocator::callbacks(this->mHostAllocator));
+    this->mDevice->destroy(
+      this->mBuffer, HostAllocator::callbacks(this->mHostAllocator));
+    this->mMemoryPool->free(this->mAllocation);
+    this->mAllocation = MemoryPool::Allocation();
+
+    this->mDevice = nullptr;
+
+    KP_LOG_DEBUG("Kompute StagingRing successful destroy()");
+}
+
+vk::DeviceSize
+StagingRing::size()
+{
+    return this->mSize;
+}
+
+std::shared_ptr<vk::Queue>
+StagingRing::queue()
+{
+    return this->mComputeQueue;
+}
+
+StagingRing::Slot&
+StagingRing::acquireSlot()
+{
+    Slot& slot = this->mSlots[this->mNextSlot];
+    this->mNextSlot = (this->mNextSlot + 1) % this->mSlots.size();
+    this->completeSlot(slot);
+    return slot;
+}
+
+void
+StagingRing::completeSlot(Slot& slot)
+{
+    if (!slot.pending) {
+        return;
+    }
+
+    this->mDevice->waitForFences(1, &slot.fence, VK_TRUE, UINT64_MAX);
+    this->mDevice->resetFences(1, &slot.fence);
+    slot.pending = false;
+
+    if (slot.readbackData) {
+        memcpy(slot.readbackData,
+               (uint8_t*)this->mAllocation.mappedData + slot.offset,
+               slot.readbackSize);
+        slot.readbackData = nullptr;
+        slot.readbackSize = 0;
+    }
+}
+
+void
+StagingRing::submitSlot(Slot& slot,
+                        const vk::Buffer& srcBuffer,
+                        const vk::Buffer& dstBuffer,
+                        const vk::BufferCopy& copyRegion,
+                        bool readback)
+{
+    slot.commandBuffer.begin(vk::CommandBufferBeginInfo(
+      vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+
+    // Wait for shaders or transfers from previous submissions on the queue
+    // that may still be reading or writing the device buffer
+    vk::AccessFlags waitAccessMask = vk::AccessFlagBits::eTransferWrite;
+    if (this->mWaitStageMask & vk::PipelineStageFlagBits::eComputeShader) {
+        waitAccessMask |= vk::AccessFlagBits::eShaderWrite;
+    }
+    vk::MemoryBarrier transferBarrier(waitAccessMask,
+                                      vk::AccessFlagBits::eTransferRead |
+                                        vk::AccessFlagBits::eTransferWrite);
+    slot.commandBuffer.pipelineBarrier(
+      this->mWaitStageMask,
+      vk::PipelineStageFlagBits::eTransfer,
+      vk::DependencyFlags(),
+      transferBarrier,
+      nullptr,
+      nullptr);
+
+    slot.commandBuffer.copyBuffer(srcBuffer, dstBuffer, copyRegion);
+
+    if (readback) {
+        vk::MemoryBarrier hostBarrier(vk::AccessFlagBits::eTransferWrite,
+                                      vk::AccessFlagBits::eHostRead);
+        slot.commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer,
+                                           vk::PipelineStageFlagBits::eHost,
+                                           vk::DependencyFlags(),
+                                           hostBarrier,
+                                           nullptr,
+                                           nullptr);
+    }
+
+    slot.commandBuffer.end();
+
+    vk::SubmitInfo submitInfo(0, nullptr, nullptr, 1, &slot.commandBuffer);
+    {
+        std::unique_lock<std::mutex> queueLock;
+        if (this->mQueueMutex) {
+            queueLock = std::unique_lock<std::mutex>(*this->mQueueMutex);
+        }
+        this->mComputeQueue->submit(1, &submitInfo, slot.fence);
+    }
+    slot.pending = true;
+}
+
+}
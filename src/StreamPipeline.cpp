@@ -0,0 +1,221 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstring>
+
+#include "kompute/StreamPipeline.hpp"
+#include "kompute/operations/OpTensorSyncDevice.hpp"
+#include "kompute/operations/OpTensorSyncLocal.hpp"
+
+namespace kp {
+
+StreamPipeline::StreamPipeline(const std::vector<Slot>& slots,
+                               uint64_t chunkSize)
+{
+    KP_LOG_DEBUG("Kompute StreamPipeline constructor with {} slots of {} "
+                 "elements",
+                 slots.size(),
+                 chunkSize);
+
+    if (slots.empty()) {
+        throw std::runtime_error("Kompute StreamPipeline requires a slot");
+    }
+
+    for (size_t i = 0; i < slots.size(); i++) {
+        const Slot& slot = slots[i];
+        if (!slot.algorithm || !slot.compute) {
+            throw std::runtime_error(fmt::format(
+              "Kompute StreamPipeline slot {} requires an algorithm and a "
+              "compute sequence",
+              i));
+        }
+        if (bool(slot.upload) != bool(slot.download)) {
+            throw std::runtime_error(fmt::format(
+              "Kompute StreamPipeline slot {} requires both an upload and a "
+              "download sequence, or neither",
+              i));
+        }
+        if (slot.inputs.empty() || slot.outputs.empty()) {
+            throw std::runtime_error(fmt::format(
+              "Kompute StreamPipeline slot {} requires inputs and outputs", i));
+        }
+        for (const std::vector<std::shared_ptr<Tensor>>* tensors :
+             { &slot.inputs, &slot.outputs }) {
+            for (const std::shared_ptr<Tensor>& tensor : *tensors) {
+                if (!tensor || tensor->size() != chunkSize) {
+                    throw std::runtime_error(fmt::format(
+                      "Kompute StreamPipeline slot {} tensors must have {} "
+                      "elements",
+                      i,
+                      chunkSize));
+                }
+            }
+        }
+    }
+
+    this->mSlots = slots;
+    this->mChunkSize = chunkSize;
+    this->mSlotChunks.resize(slots.size(), -1);
+    this->mSlotCounts.resize(slots.size(), 0);
+
+    for (Slot& slot : this->mSlots) {
+        if (slot.upload) {
+            slot.upload->record<OpTensorSyncDevice>(slot.inputs);
+            slot.compute->record<OpAlgoDispatch>(slot.algorithm);
+            slot.download->record<OpTensorSyncLocal>(slot.outputs);
+        } else {
+            slot.compute->record<OpTensorSyncDevice>(slot.inputs)
+              ->record<OpAlgoDispatch>(slot.algorithm)
+              ->record<OpTensorSyncLocal>(slot.outputs);
+        }
+    }
+}
+
+StreamPipeline::~StreamPipeline()
+{
+    KP_LOG_DEBUG("Kompute StreamPipeline destructor started");
+
+    this->destroy();
+}
+
+uint64_t
+StreamPipeline::run(Source source, Sink sink)
+{
+    if (this->mSlots.empty()) {
+        throw std::runtime_error(
+          "Kompute StreamPipeline run called after destroy");
+    }
+
+    uint32_t depth = this->mSlots.size();
+    uint64_t chunk = 0;
+
+    try {
+        while (true) {
+            // The slot is reused once the chunk it holds has been consumed
+            uint32_t slotIndex = chunk % depth;
+            if (this->mSlotChunks[slotIndex] >= 0) {
+                this->await(slotIndex);
+                this->mSlotChunks[slotIndex] = -1;
+                sink(chunk - depth,
+                     this->mSlots[slotIndex].outputs,
+                     this->mSlotCounts[slotIndex]);
+            }
+
+            Slot& slot = this->mSlots[slotIndex];
+            uint64_t count = source(chunk, slot.inputs);
+            if (!count) {
+                break;
+            }
+            if (count > this->mChunkSize) {
+                throw std::runtime_error(
+                  fmt::format("Kompute StreamPipeline source wrote {} "
+                              "elements in chunks of {}",
+                              count,
+                              this->mChunkSize));
+            }
+            for (const std::shared_ptr<Tensor>& input : slot.inputs) {
+                uint32_t memorySize = input->dataTypeMemorySize();
+                memset((uint8_t*)input->rawData() + count * memorySize,
+                       0,
+                       (this->mChunkSize - count) * memorySize);
+            }
+
+            KP_LOG_DEBUG("Kompute StreamPipeline submitting chunk {} of {} "
+                         "elements in slot {}",
+                         chunk,
+                         count,
+                         slotIndex);
+
+            this->mSlotCounts[slotIndex] = count;
+            this->submit(slotIndex);
+            this->mSlotChunks[slotIndex] = chunk;
+            chunk++;
+        }
+
+        // The chunks still in flight are consumed in order
+        for (uint64_t i = chunk > depth ? chunk - depth : 0; i < chunk; i++) {
+            uint32_t slotIndex = i % depth;
+            if (this->mSlotChunks[slotIndex] != (int64_t)i) {
+                continue;
+            }
+            this->await(slotIndex);
+            this->mSlotChunks[slotIndex] = -1;
+            sink(i,
+                 this->mSlots[slotIndex].outputs,
+                 this->mSlotCounts[slotIndex]);
+        }
+    } catch (...) {
+        KP_LOG_ERROR("Kompute StreamPipeline failed at chunk {}", chunk);
+
+        for (uint32_t i = 0; i < depth; i++) {
+            this->await(i);
+            this->mSlotChunks[i] = -1;
+        }
+        throw;
+    }
+
+    KP_LOG_DEBUG("Kompute StreamPipeline processed {} chunks", chunk);
+
+    return chunk;
+}
+
+uint64_t
+StreamPipeline::chunkSize()
+{
+    return this->mChunkSize;
+}
+
+uint32_t
+StreamPipeline::depth()
+{
+    return this->mSlots.size();
+}
+
+bool
+StreamPipeline::hasTransferQueue()
+{
+    return this->mSlots.size() && this->mSlots[0].upload;
+}
+
+void
+StreamPipeline::destroy()
+{
+    KP_LOG_DEBUG("Kompute StreamPipeline destroy called");
+
+    for (uint32_t i = 0; i < this->mSlots.size(); i++) {
+        this->await(i);
+    }
+    this->mSlots.clear();
+    this->mSlotChunks.clear();
+    this->mSlotCounts.clear();
+}
+
+void
+StreamPipeline::submit(uint32_t slotIndex)
+{
+    Slot& slot = this->mSlots[slotIndex];
+
+    if (slot.upload) {
+        slot.upload->evalAsync();
+        slot.compute->evalAsync(
+          std::vector<std::shared_ptr<Sequence>>{ slot.upload });
+        slot.download->evalAsync(
+          std::vector<std::shared_ptr<Sequence>>{ slot.compute });
+    } else {
+        slot.compute->evalAsync();
+    }
+}
+
+void
+StreamPipeline::await(uint32_t slotIndex)
+{
+    Slot& slot = this->mSlots[slotIndex];
+
+    for (const std::shared_ptr<Sequence>& sequence :
+         { slot.upload, slot.compute, slot.download }) {
+        if (sequence && sequence->isRunning()) {
+            sequence->evalAwait();
+        }
+    }
+}
+
+}
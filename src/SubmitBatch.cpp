@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <deque>
+
+#include "kompute/SubmitBatch.hpp"
+
+namespace kp {
+
+SubmitBatch::SubmitBatch(std::shared_ptr<vk::Device> device,
+                         std::shared_ptr<HostAllocator> hostAllocator)
+{
+    KP_LOG_DEBUG("Kompute SubmitBatch constructor");
+
+    if (!device) {
+        throw std::runtime_error("Kompute SubmitBatch device is null");
+    }
+
+    this->mDevice = device;
+    this->mHostAllocator = hostAllocator;
+}
+
+SubmitBatch::~SubmitBatch()
+{
+    KP_LOG_DEBUG("Kompute SubmitBatch destructor started");
+
+    if (this->mDevice) {
+        this->destroy();
+    }
+}
+
+void
+SubmitBatch::submit(const std::vector<std::shared_ptr<Sequence>>& sequences)
+{
+    KP_LOG_DEBUG("Kompute SubmitBatch submitting {} sequences",
+                 sequences.size());
+
+    if (!this->mDevice) {
+        throw std::runtime_error("Kompute SubmitBatch submit called after "
+                                 "the batch was destroyed");
+    }
+    if (this->mSequences.size()) {
+        throw std::runtime_error(
+          "Kompute SubmitBatch submit called on a batch already submitted");
+    }
+
+    // Group the sequences by queue, preserving the order they were provided
+    std::vector<std::shared_ptr<vk::Queue>> queues;
+    std::vector<std::vector<std::shared_ptr<Sequence>>> queueSequences;
+    for (const std::shared_ptr<Sequence>& sequence : sequences) {
+        if (!sequence->isInit()) {
+            throw std::runtime_error(
+              "Kompute SubmitBatch submit called with uninitialised sequence");
+        }
+
+        // Checked upfront so no sequence is left prepared but not submitted
+        uint32_t submissionCount =
+          std::count(sequences.begin(), sequences.end(), sequence);
+        if (sequence->inFlightCount() + submissionCount >
+            sequence->inFlightDepth()) {
+            throw std::runtime_error(fmt::format(
+              "Kompute SubmitBatch submit exceeds the in flight depth {} of "
+              "a sequence",
+              sequence->inFlightDepth()));
+        }
+
+        uint32_t queueIndex = 0;
+        while (queueIndex < queues.size() &&
+               queues[queueIndex] != sequence->mComputeQueue) {
+            queueIndex++;
+        }
+        if (queueIndex == queues.size()) {
+            queues.push_back(sequence->mComputeQueue);
+            queueSequences.emplace_back();
+        }
+        queueSequences[queueIndex].push_back(sequence);
+    }
+
+    for (uint32_t i = 0; i < queues.size(); i++) {
+        vk::Fence fence = this->mDevice->createFence(
+          vk::FenceCreateInfo(),
+          HostAllocator::callbacks(this->mHostAllocator));
+        this->mFences.push_back(fence);
+
+        // Submit infos point into their data, which must not be relocated
+        std::deque<Sequence::SubmitData> submitData;
+        std::vector<vk::SubmitInfo> submitInfos;
+        for (const std::shared_ptr<Sequence>& sequence : queueSequences[i]) {
+            submitData.emplace_back();
+            sequence->prepareSubmit(
+              {}, submitData.back(), shared_from_this(), i);
+            submitInfos.push_back(submitData.back().submitInfo);
+            this->mSequences.push_back(sequence);
+        }
+
+        KP_LOG_DEBUG("Kompute SubmitBatch submitting {} sequences to queue {}",
+                     submitInfos.size(),
+                     i);
+
+        std::unique_lock<std::mutex> queueLock =
+          queueSequences[i][0]->lockQueue();
+        queues[i]->submit(submitInfos.size(), submitInfos.data(), fence);
+    }
+}
+
+bool
+SubmitBatch::await(uint64_t waitFor)
+{
+    KP_LOG_DEBUG("Kompute SubmitBatch await called");
+
+    if (this->mFences.size()) {
+        vk::Result result = this->mDevice->waitForFences(
+          this->mFences.size(), this->mFences.data(), VK_TRUE, waitFor);
+        if (result == vk::Result::eTimeout) {
+            KP_LOG_WARN("Kompute SubmitBatch await reached timeout of {}",
+                        waitFor);
+            return false;
+        }
+    }
+
+    // Submissions are retired in order, so earlier submissions of the same
+    // sequences are retired along with the ones of the batch
+    for (const std::shared_ptr<Sequence>& sequence : this->mSequences) {
+        while (this->hasPendingSubmission(*sequence)) {
+            sequence->evalAwait();
+        }
+    }
+
+    return true;
+}
+
+bool
+SubmitBatch::isComplete()
+{
+    for (uint32_t i = 0; i < this->mFences.size(); i++) {
+        if (this->fenceStatus(i) != vk::Result::eSuccess) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint32_t
+SubmitBatch::queueSubmitCount()
+{
+    return this->mFences.size();
+}
+
+void
+SubmitBatch::destroy()
+{
+    KP_LOG_DEBUG("Kompute SubmitBatch destroy called");
+
+    if (!this->mDevice) {
+        KP_LOG_WARN("Kompute SubmitBatch destroy called "
+                    "with null Device pointer");
+        return;
+    }
+
+    // The fences may still be signaled by the GPU
+    if (this->mFences.size()) {
+        this->mDevice->waitForFences(
+          this->mFences.size(), this->mFences.data(), VK_TRUE, UINT64_MAX);
+    }
+    for (vk::Fence& fence : this->mFences) {
+        this->mDevice->destroy(
+          fence, HostAllocator::callbacks(this->mHostAllocator));
+    }
+    this->mFences.clear();
+    this->mSequences.clear();
+
+    this->mDevice = nullptr;
+}
+
+vk::Result
+SubmitBatch::waitFence(uint32_t fenceIndex, uint64_t waitFor)
+{
+    // Destroying the batch waits for all of its fences
+    if (fenceIndex >= this->mFences.size()) {
+        return vk::Result::eSuccess;
+    }
+    return this->mDevice->waitForFences(
+      1, &this->mFences[fenceIndex], VK_TRUE, waitFor);
+}
+
+vk::Result
+SubmitBatch::fenceStatus(uint32_t fenceIndex)
+{
+    if (fenceIndex >= this->mFences.size()) {
+        return vk::Result::eSuccess;
+    }
+    return this->mDevice->getFenceStatus(this->mFences[fenceIndex]);
+}
+
+bool
+SubmitBatch::hasPendingSubmission(Sequence& sequence)
+{
+    for (uint32_t submissionIndex : sequence.mInFlight) {
+        const Sequence::Submission& submission =
+          sequence.mSubmissions[submissionIndex];
+        if (submission.batched && submission.batch.lock().get() == this) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}
@@ -1,29 +1,320 @@
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
+#include <cstring>
+
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+#include <android/hardware_buffer.h>
+#endif
+
 #include "kompute/Tensor.hpp"
+#include "kompute/Tracer.hpp"
 
 namespace kp {
 
+Half::Half(float value)
+{
+    uint32_t f;
+    std::memcpy(&f, &value, sizeof(f));
+
+    uint16_t sign = (f >> 16) & 0x8000;
+    int32_t exponent = (int32_t)((f >> 23) & 0xff) - 127 + 15;
+    uint32_t mantissa = f & 0x7fffff;
+
+    if (((f >> 23) & 0xff) == 0xff) {
+        // Infinity stays infinity and NaN stays a quiet NaN
+        this->bits = sign | 0x7c00 | (mantissa ? 0x200 : 0);
+    } else if (exponent >= 0x1f) {
+        this->bits = sign | 0x7c00;
+    } else if (exponent <= 0) {
+        // Subnormal halves, or zero below half of the smallest one
+        if (exponent < -10) {
+            this->bits = sign;
+            return;
+        }
+        mantissa |= 0x800000;
+        uint32_t shift = 14 - exponent;
+        uint32_t half = mantissa >> shift;
+        uint32_t remainder = mantissa & ((1u << shift) - 1);
+        uint32_t midpoint = 1u << (shift - 1);
+        if (remainder > midpoint || (remainder == midpoint && (half & 1))) {
+            half++;
+        }
+        this->bits = sign | half;
+    } else {
+        // Rounding may carry into the exponent, up to infinity
+        uint32_t half = ((uint32_t)exponent << 10) | (mantissa >> 13);
+        uint32_t remainder = mantissa & 0x1fff;
+        if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1))) {
+            half++;
+        }
+        this->bits = sign | half;
+    }
+}
+
+Half::operator float() const
+{
+    uint32_t sign = (uint32_t)(this->bits & 0x8000) << 16;
+    uint32_t exponent = (this->bits >> 10) & 0x1f;
+    uint32_t mantissa = this->bits & 0x3ff;
+
+    uint32_t f;
+    if (exponent == 0x1f) {
+        f = sign | 0x7f800000 | (mantissa << 13);
+    } else if (exponent) {
+        f = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+    } else if (mantissa) {
+        // Subnormal halves are normal floats
+        exponent = 127 - 15 + 1;
+        while (!(mantissa & 0x400)) {
+            mantissa <<= 1;
+            exponent--;
+        }
+        f = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+    } else {
+        f = sign;
+    }
+
+    float value;
+    std::memcpy(&value, &f, sizeof(value));
+    return value;
+}
+
 Tensor::Tensor(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
                std::shared_ptr<vk::Device> device,
                void* data,
-               uint32_t elementTotalCount,
+               uint64_t elementTotalCount,
                uint32_t elementMemorySize,
                const TensorDataTypes& dataType,
-               const TensorTypes& tensorType)
+               const TensorTypes& tensorType,
+               const HostMemoryTypes& hostMemoryType,
+               std::shared_ptr<MemoryPool> memoryPool,
+               std::shared_ptr<StagingRing> stagingRing,
+               const std::vector<uint32_t>& queueFamilyIndices,
+               std::shared_ptr<DebugUtils> debugUtils,
+               std::shared_ptr<Metrics> metrics,
+               std::shared_ptr<HostAllocator> hostAllocator,
+               std::shared_ptr<DeviceInfo> deviceInfo)
 {
     KP_LOG_DEBUG("Kompute Tensor constructor data length: {}, and type: {}",
                  elementTotalCount,
                  tensorType);
 
+    if (tensorType == TensorTypes::eImage) {
+        throw std::runtime_error(
+          "Kompute Tensor image tensors require the image constructor with "
+          "their extent and channels");
+    }
+
     this->mPhysicalDevice = physicalDevice;
     this->mDevice = device;
+    this->mMemoryPool = memoryPool;
+    this->mStagingRing = stagingRing;
+    this->mDebugUtils = debugUtils;
+    this->mMetrics = metrics;
+    this->mHostAllocator = hostAllocator;
+    this->mDeviceInfo = deviceInfo;
+    if (!this->mDeviceInfo && physicalDevice) {
+        this->mDeviceInfo = std::make_shared<DeviceInfo>(*physicalDevice);
+    }
     this->mDataType = dataType;
     this->mTensorType = tensorType;
+    this->mHostMemoryType = hostMemoryType;
+    this->setQueueFamilyIndices(queueFamilyIndices);
 
     this->rebuild(data, elementTotalCount, elementMemorySize);
 }
 
+Tensor::Tensor(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
+               std::shared_ptr<vk::Device> device,
+               void* data,
+               uint32_t width,
+               uint32_t height,
+               uint32_t channels,
+               const TensorDataTypes& dataType,
+               const HostMemoryTypes& hostMemoryType,
+               std::shared_ptr<MemoryPool> memoryPool,
+               const std::vector<uint32_t>& queueFamilyIndices,
+               std::shared_ptr<DebugUtils> debugUtils,
+               std::shared_ptr<Metrics> metrics,
+               std::shared_ptr<HostAllocator> hostAllocator,
+               std::shared_ptr<DeviceInfo> deviceInfo)
+{
+    KP_LOG_DEBUG("Kompute Tensor image constructor with extent {}x{} and {} "
+                 "channels",
+                 width,
+                 height,
+                 channels);
+
+    if (width == 0 || height == 0) {
+        throw std::runtime_error(
+          fmt::format("Kompute Tensor image extent {}x{} is empty",
+                      width,
+                      height));
+    }
+    // Validates the channels and data type before creating any resource
+    imageFormat(dataType, channels);
+
+    this->mPhysicalDevice = physicalDevice;
+    this->mDevice = device;
+    this->mMemoryPool = memoryPool;
+    this->mDebugUtils = debugUtils;
+    this->mMetrics = metrics;
+    this->mHostAllocator = hostAllocator;
+    this->mDeviceInfo = deviceInfo;
+    if (!this->mDeviceInfo && physicalDevice) {
+        this->mDeviceInfo = std::make_shared<DeviceInfo>(*physicalDevice);
+    }
+    this->mDataType = dataType;
+    this->mTensorType = TensorTypes::eImage;
+    this->mHostMemoryType = hostMemoryType;
+    this->mImageExtent = vk::Extent3D(width, height, 1);
+    this->mImageChannels = channels;
+    this->setQueueFamilyIndices(queueFamilyIndices);
+
+    this->rebuild(data,
+                  (uint64_t)width * height * channels,
+                  elementMemorySize(dataType));
+}
+
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+Tensor::Tensor(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
+               std::shared_ptr<vk::Device> device,
+               AHardwareBuffer* hardwareBuffer,
+               const TensorDataTypes& dataType,
+               std::shared_ptr<MemoryPool> memoryPool,
+               const std::vector<uint32_t>& queueFamilyIndices,
+               std::shared_ptr<DebugUtils> debugUtils,
+               std::shared_ptr<Metrics> metrics,
+               std::shared_ptr<HostAllocator> hostAllocator,
+               std::shared_ptr<DeviceInfo> deviceInfo)
+{
+    KP_LOG_DEBUG("Kompute Tensor constructor from hardware buffer");
+
+    if (!hardwareBuffer) {
+        throw std::runtime_error("Kompute Tensor hardware buffer is null");
+    }
+    if (!memoryPool || !memoryPool->canImportHardwareBuffer()) {
+        throw std::runtime_error(
+          "Kompute Tensor hardware buffer import requires the "
+          "VK_ANDROID_external_memory_android_hardware_buffer extension");
+    }
+
+    // Only blob buffers are linear memory that can be bound to a buffer
+    AHardwareBuffer_Desc description = {};
+    AHardwareBuffer_describe(hardwareBuffer, &description);
+    if (description.format != AHARDWAREBUFFER_FORMAT_BLOB ||
+        !(description.usage & AHARDWAREBUFFER_USAGE_GPU_DATA_BUFFER)) {
+        throw std::runtime_error(
+          fmt::format("Kompute Tensor hardware buffer of format {} and usage "
+                      "{} is not a GPU data buffer blob",
+                      description.format,
+                      description.usage));
+    }
+
+    this->mPhysicalDevice = physicalDevice;
+    this->mDevice = device;
+    this->mMemoryPool = memoryPool;
+    this->mDebugUtils = debugUtils;
+    this->mMetrics = metrics;
+    this->mHostAllocator = hostAllocator;
+    this->mDeviceInfo = deviceInfo;
+    if (!this->mDeviceInfo && physicalDevice) {
+        this->mDeviceInfo = std::make_shared<DeviceInfo>(*physicalDevice);
+    }
+    this->mDataType = dataType;
+    this->mTensorType = TensorTypes::eHost;
+    this->mHostMemoryType = HostMemoryTypes::eImported;
+    this->mHardwareBuffer = hardwareBuffer;
+    this->setQueueFamilyIndices(queueFamilyIndices);
+
+    this->mDataTypeMemorySize = elementMemorySize(dataType);
+    this->mSize = description.width / this->mDataTypeMemorySize;
+    this->mCapacity = this->mSize;
+    if (!this->mSize) {
+        throw std::runtime_error(fmt::format(
+          "Kompute Tensor hardware buffer of {} bytes holds no element",
+          description.width));
+    }
+
+    this->importHardwareBuffer();
+    this->mapRawData();
+    this->setObjectNames();
+    this->mGeneration++;
+}
+#endif
+
+Tensor::Tensor(std::shared_ptr<Tensor> parent, uint64_t offset, uint64_t count)
+{
+    KP_LOG_DEBUG("Kompute Tensor view constructor with offset {} and size {}",
+                 offset,
+                 count);
+
+    if (!parent || !parent->isInit()) {
+        throw std::runtime_error(
+          "Kompute Tensor view requires an initialised parent tensor");
+    }
+    if (parent->mTensorType == TensorTypes::eImage) {
+        throw std::runtime_error(
+          "Kompute Tensor views of image tensors are not supported");
+    }
+    if (offset + count > parent->size() || count == 0) {
+        throw std::runtime_error(
+          fmt::format("Kompute Tensor view range {}+{} out of bounds for "
+                      "parent of size {}",
+                      offset,
+                      count,
+                      parent->size()));
+    }
+
+    vk::DeviceSize bufferOffset =
+      parent->mBufferOffset + (vk::DeviceSize)offset * parent->mDataTypeMemorySize;
+
+    // Descriptors can only bind storage buffers at aligned offsets
+    vk::DeviceSize offsetAlignment =
+      parent->mDeviceInfo->properties().limits.minStorageBufferOffsetAlignment;
+    if (offsetAlignment > 0 && bufferOffset % offsetAlignment != 0) {
+        throw std::runtime_error(fmt::format(
+          "Kompute Tensor view offset {} bytes is not a multiple of the "
+          "device minStorageBufferOffsetAlignment {}",
+          bufferOffset,
+          offsetAlignment));
+    }
+
+    this->mPhysicalDevice = parent->mPhysicalDevice;
+    this->mDevice = parent->mDevice;
+    this->mMemoryPool = parent->mMemoryPool;
+    this->mStagingRing = parent->mStagingRing;
+    this->mDebugUtils = parent->mDebugUtils;
+    this->mMetrics = parent->mMetrics;
+    this->mHostAllocator = parent->mHostAllocator;
+    this->mDeviceInfo = parent->mDeviceInfo;
+    this->mQueueFamilyIndices = parent->mQueueFamilyIndices;
+    this->mDataType = parent->mDataType;
+    this->mTensorType = parent->mTensorType;
+    this->mHostMemoryType = parent->mHostMemoryType;
+    this->mHostMemoryCoherent = parent->mHostMemoryCoherent;
+    this->mHostMemoryImported = parent->mHostMemoryImported;
+    this->mSize = count;
+    this->mCapacity = count;
+    this->mDataTypeMemorySize = parent->mDataTypeMemorySize;
+
+    this->mPrimaryBuffer = parent->mPrimaryBuffer;
+    this->mPrimaryMemory = parent->mPrimaryMemory;
+    this->mStagingBuffer = parent->mStagingBuffer;
+    this->mStagingMemory = parent->mStagingMemory;
+    this->mBufferOffset = bufferOffset;
+
+    if (parent->mRawData) {
+        this->mRawData = (uint8_t*)parent->mRawData +
+                         (vk::DeviceSize)offset * parent->mDataTypeMemorySize;
+    }
+
+    // Views of views alias the root tensor that owns the memory
+    this->mParent = parent->mParent ? parent->mParent : parent;
+    this->mParent->mViews.push_back(this);
+}
+
 Tensor::~Tensor()
 {
     KP_LOG_DEBUG("Kompute Tensor destructor started. Type: {}",
@@ -38,24 +329,134 @@ Tensor::~Tensor()
 
 void
 Tensor::rebuild(void* data,
-                uint32_t elementTotalCount,
+                uint64_t elementTotalCount,
                 uint32_t elementMemorySize)
 {
+    Tracer::Span span("Tensor::rebuild");
+
     KP_LOG_DEBUG("Kompute Tensor rebuilding with size {}", elementTotalCount);
 
-    this->mSize = elementTotalCount;
-    this->mDataTypeMemorySize = elementMemorySize;
+    if (this->mParent) {
+        throw std::runtime_error("Kompute Tensor views cannot be rebuilt");
+    }
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+    if (this->mHardwareBuffer) {
+        throw std::runtime_error(
+          "Kompute Tensor imported hardware buffers cannot be rebuilt");
+    }
+#endif
+    // The extent and format of images are fixed when they are created
+    if (this->mTensorType == TensorTypes::eImage &&
+        (elementTotalCount != (uint64_t)this->mImageExtent.width *
+                                this->mImageExtent.height *
+                                this->mImageChannels ||
+         elementMemorySize != Tensor::elementMemorySize(this->mDataType))) {
+        throw std::runtime_error(fmt::format(
+          "Kompute Tensor image of {}x{} texels with {} channels cannot be "
+          "rebuilt with {} elements",
+          this->mImageExtent.width,
+          this->mImageExtent.height,
+          this->mImageChannels,
+          elementTotalCount));
+    }
+
+    // Imported memory is tied to the pointer it was imported from
+    bool withinCapacity =
+      this->isInit() && elementTotalCount > 0 &&
+      elementTotalCount <= this->mCapacity &&
+      elementMemorySize == this->mDataTypeMemorySize &&
+      (!this->mHostMemoryImported || this->mRawData == data);
+
+    if (withinCapacity) {
+        KP_LOG_TENSOR("Kompute Tensor reusing resources with capacity {}",
+                      this->mCapacity);
+        this->mSize = elementTotalCount;
+    } else {
+        if (!this->mViews.empty()) {
+            throw std::runtime_error(fmt::format(
+              "Kompute Tensor cannot be reallocated while {} views alias it",
+              this->mViews.size()));
+        }
+        this->mDataTypeMemorySize = elementMemorySize;
+        this->reallocate(data, elementTotalCount);
+        this->mSize = elementTotalCount;
+    }
+    this->mDirtyRanges.clear();
+    this->mGeneration++;
+
+    // Imported host memory already holds the data, and tensors allocated
+    // without data or without host memory have nothing to copy
+    if (data && this->mRawData && this->mRawData != data) {
+        memcpy(this->mRawData, data, this->memorySize());
+    }
+}
+
+void
+Tensor::reserve(uint64_t elementCapacity)
+{
+    KP_LOG_DEBUG("Kompute Tensor reserving capacity {}", elementCapacity);
+
+    if (this->mParent) {
+        throw std::runtime_error("Kompute Tensor views cannot be reserved");
+    }
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+    if (this->mHardwareBuffer) {
+        throw std::runtime_error(
+          "Kompute Tensor imported hardware buffers cannot be reserved");
+    }
+#endif
+    if (this->mTensorType == TensorTypes::eImage) {
+        throw std::runtime_error(
+          "Kompute Tensor image tensors cannot be reserved");
+    }
+    if (elementCapacity <= this->mCapacity) {
+        return;
+    }
+    if (!this->mViews.empty()) {
+        throw std::runtime_error(fmt::format(
+          "Kompute Tensor cannot be reallocated while {} views alias it",
+          this->mViews.size()));
+    }
+
+    // The host data may live in the memory about to be freed
+    std::vector<uint8_t> hostData;
+    if (this->mRawData) {
+        hostData.assign((uint8_t*)this->mRawData,
+                        (uint8_t*)this->mRawData + this->memorySize());
+    }
+
+    uint64_t size = this->mSize;
+    this->reallocate(nullptr, elementCapacity);
+    this->mSize = size;
+    this->mGeneration++;
 
-    if (this->mPrimaryBuffer || this->mPrimaryMemory) {
+    if (this->mRawData && hostData.size()) {
+        memcpy(this->mRawData, hostData.data(), hostData.size());
+        this->markDirty(0, this->mSize);
+    }
+}
+
+void
+Tensor::reallocate(void* data, uint64_t elementCapacity)
+{
+    if (this->mPrimaryBuffer || this->mImage || this->mPrimaryMemory) {
         KP_LOG_DEBUG(
           "Kompute Tensor destroying existing resources before rebuild");
+        // Destroying the resources also releases the device reference
+        std::shared_ptr<vk::Device> device = this->mDevice;
+        uint32_t dataTypeMemorySize = this->mDataTypeMemorySize;
         this->destroy();
+        this->mDevice = device;
+        this->mDataTypeMemorySize = dataTypeMemorySize;
     }
 
-    this->allocateMemoryCreateGPUResources();
-    this->mapRawData();
+    // Buffers are created and mapped with the full capacity of the tensor
+    this->mSize = elementCapacity;
+    this->mCapacity = elementCapacity;
 
-    memcpy(this->mRawData, data, this->memorySize());
+    this->allocateMemoryCreateGPUResources(data);
+    this->mapRawData();
+    this->setObjectNames();
 }
 
 Tensor::TensorTypes
@@ -64,29 +465,289 @@ Tensor::tensorType()
     return this->mTensorType;
 }
 
+Tensor::HostMemoryTypes
+Tensor::hostMemoryType()
+{
+    return this->mHostMemoryType;
+}
+
+bool
+Tensor::isView()
+{
+    return (bool)this->mParent;
+}
+
+std::shared_ptr<Tensor>
+Tensor::parent()
+{
+    return this->mParent;
+}
+
+vk::DeviceSize
+Tensor::bufferOffset()
+{
+    return this->mBufferOffset;
+}
+
+vk::DeviceAddress
+Tensor::deviceAddress()
+{
+    if (!this->mPrimaryBuffer || !this->mMemoryPool ||
+        !this->mMemoryPool->hasBufferDeviceAddress()) {
+        throw std::runtime_error(
+          "Kompute Tensor device address requires an initialised buffer "
+          "tensor created with VK_KHR_buffer_device_address enabled");
+    }
+
+    return this->mMemoryPool->bufferDeviceAddress(*this->mPrimaryBuffer) +
+           this->mBufferOffset;
+}
+
+void
+Tensor::setName(const std::string& name)
+{
+    this->mName = name;
+    this->setObjectNames();
+}
+
+const std::string&
+Tensor::name()
+{
+    return this->mName;
+}
+
+void
+Tensor::setObjectNames()
+{
+    if (!this->mDebugUtils || !this->mDevice || this->mParent) {
+        return;
+    }
+
+    if (this->mPrimaryBuffer) {
+        this->mDebugUtils->setObjectName(
+          *this->mDevice,
+          vk::ObjectType::eBuffer,
+          (uint64_t)(VkBuffer)*this->mPrimaryBuffer,
+          this->mName);
+    }
+    if (this->mImage) {
+        this->mDebugUtils->setObjectName(*this->mDevice,
+                                         vk::ObjectType::eImage,
+                                         (uint64_t)(VkImage)*this->mImage,
+                                         this->mName);
+    }
+    if (this->mStagingBuffer && !this->mName.empty()) {
+        this->mDebugUtils->setObjectName(
+          *this->mDevice,
+          vk::ObjectType::eBuffer,
+          (uint64_t)(VkBuffer)*this->mStagingBuffer,
+          this->mName + " (staging)");
+    }
+}
+
+const std::vector<uint32_t>&
+Tensor::queueFamilyIndices()
+{
+    return this->mQueueFamilyIndices;
+}
+
+void
+Tensor::setQueueFamilyIndices(const std::vector<uint32_t>& queueFamilyIndices)
+{
+    for (uint32_t queueFamilyIndex : queueFamilyIndices) {
+        if (std::find(this->mQueueFamilyIndices.begin(),
+                      this->mQueueFamilyIndices.end(),
+                      queueFamilyIndex) == this->mQueueFamilyIndices.end()) {
+            this->mQueueFamilyIndices.push_back(queueFamilyIndex);
+        }
+    }
+    if (this->mQueueFamilyIndices.size() < 2) {
+        this->mQueueFamilyIndices.clear();
+    }
+}
+
+std::shared_ptr<vk::Image>
+Tensor::image()
+{
+    return this->mImage;
+}
+
+std::shared_ptr<vk::ImageView>
+Tensor::imageView()
+{
+    return this->mImageView;
+}
+
+vk::Extent3D
+Tensor::imageExtent()
+{
+    return this->mImageExtent;
+}
+
+vk::Format
+Tensor::imageFormat()
+{
+    if (this->mTensorType != TensorTypes::eImage) {
+        return vk::Format::eUndefined;
+    }
+    return imageFormat(this->mDataType, this->mImageChannels);
+}
+
+vk::Format
+Tensor::imageFormat(const TensorDataTypes& dataType, uint32_t channels)
+{
+    if (channels != 1 && channels != 2 && channels != 4) {
+        throw std::runtime_error(fmt::format(
+          "Kompute Tensor images have 1, 2 or 4 channels, not {}", channels));
+    }
+
+    auto format = [channels](vk::Format r, vk::Format rg, vk::Format rgba) {
+        return channels == 1 ? r : channels == 2 ? rg : rgba;
+    };
+
+    switch (dataType) {
+        case TensorDataTypes::eInt:
+            return format(vk::Format::eR32Sint,
+                          vk::Format::eR32G32Sint,
+                          vk::Format::eR32G32B32A32Sint);
+        case TensorDataTypes::eUnsignedInt:
+            return format(vk::Format::eR32Uint,
+                          vk::Format::eR32G32Uint,
+                          vk::Format::eR32G32B32A32Uint);
+        case TensorDataTypes::eFloat:
+            return format(vk::Format::eR32Sfloat,
+                          vk::Format::eR32G32Sfloat,
+                          vk::Format::eR32G32B32A32Sfloat);
+        case TensorDataTypes::eHalf:
+            return format(vk::Format::eR16Sfloat,
+                          vk::Format::eR16G16Sfloat,
+                          vk::Format::eR16G16B16A16Sfloat);
+        case TensorDataTypes::eInt8:
+            return format(vk::Format::eR8Snorm,
+                          vk::Format::eR8G8Snorm,
+                          vk::Format::eR8G8B8A8Snorm);
+        case TensorDataTypes::eUnsignedInt8:
+            return format(vk::Format::eR8Unorm,
+                          vk::Format::eR8G8Unorm,
+                          vk::Format::eR8G8B8A8Unorm);
+        case TensorDataTypes::eInt16:
+            return format(vk::Format::eR16Sint,
+                          vk::Format::eR16G16Sint,
+                          vk::Format::eR16G16B16A16Sint);
+        default:
+            throw std::runtime_error(
+              "Kompute Tensor data type has no image format");
+    }
+}
+
+bool
+Tensor::hasStagingBuffer()
+{
+    return (bool)this->mStagingBuffer;
+}
+
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+AHardwareBuffer*
+Tensor::hardwareBuffer()
+{
+    return this->mHardwareBuffer;
+}
+#endif
+
+bool
+Tensor::isHostMemoryImported()
+{
+    return this->mHostMemoryImported;
+}
+
 bool
 Tensor::isInit()
 {
-    return this->mDevice && this->mPrimaryBuffer && this->mPrimaryMemory &&
-           this->mRawData;
+    // Storage tensors have no host visible memory to hold data in
+    return this->mDevice && (this->mPrimaryBuffer || this->mImage) &&
+           this->mPrimaryMemory &&
+           (this->mRawData || this->mTensorType == TensorTypes::eStorage);
 }
 
-uint32_t
+uint64_t
 Tensor::size()
 {
     return this->mSize;
 }
 
+uint64_t
+Tensor::capacity()
+{
+    return this->mCapacity;
+}
+
+uint64_t
+Tensor::generation()
+{
+    return this->mGeneration;
+}
+
 uint32_t
 Tensor::dataTypeMemorySize()
 {
     return this->mDataTypeMemorySize;
 }
 
-uint32_t
+vk::DeviceSize
 Tensor::memorySize()
 {
-    return this->mSize * this->mDataTypeMemorySize;
+    return this->mSize * (vk::DeviceSize)this->mDataTypeMemorySize;
+}
+
+vk::DeviceSize
+Tensor::capacityMemorySize()
+{
+    return this->mCapacity * (vk::DeviceSize)this->mDataTypeMemorySize;
+}
+
+vk::DeviceSize
+Tensor::primaryMemorySize()
+{
+    if (this->mParent || (!this->mPrimaryBuffer && !this->mImage)) {
+        return 0;
+    }
+    return (this->capacityMemorySize() + 3) / 4 * 4;
+}
+
+vk::DeviceSize
+Tensor::stagingMemorySize()
+{
+    if (this->mParent || !this->mStagingBuffer) {
+        return 0;
+    }
+    return (this->capacityMemorySize() + 3) / 4 * 4;
+}
+
+uint32_t
+Tensor::elementMemorySize(const TensorDataTypes& dataType)
+{
+    switch (dataType) {
+        case TensorDataTypes::eBool:
+            return sizeof(bool);
+        case TensorDataTypes::eInt:
+            return sizeof(int32_t);
+        case TensorDataTypes::eUnsignedInt:
+            return sizeof(uint32_t);
+        case TensorDataTypes::eFloat:
+            return sizeof(float);
+        case TensorDataTypes::eDouble:
+            return sizeof(double);
+        case TensorDataTypes::eHalf:
+            return sizeof(Half);
+        case TensorDataTypes::eInt8:
+            return sizeof(int8_t);
+        case TensorDataTypes::eUnsignedInt8:
+            return sizeof(uint8_t);
+        case TensorDataTypes::eInt16:
+            return sizeof(int16_t);
+        default:
+            throw std::runtime_error("Kompute Tensor invalid data type");
+    }
 }
 
 kp::Tensor::TensorDataTypes
@@ -105,30 +766,108 @@ void
 Tensor::setRawData(const void* data)
 {
     memcpy(this->mRawData, data, this->memorySize());
+    this->markDirty(0, this->mSize);
+}
+
+void
+Tensor::setRawData(const void* data, uint64_t offset, uint64_t count)
+{
+    if (offset + count > this->mSize) {
+        throw std::runtime_error(
+          fmt::format("Kompute Tensor setRawData range {}+{} out of bounds "
+                      "for tensor of size {}",
+                      offset,
+                      count,
+                      this->mSize));
+    }
+
+    memcpy((uint8_t*)this->mRawData + offset * this->mDataTypeMemorySize,
+           data,
+           count * this->mDataTypeMemorySize);
+    this->markDirty(offset, count);
+}
+
+void
+Tensor::markDirty(uint64_t offset, uint64_t count)
+{
+    if (count == 0 || offset >= this->mSize) {
+        return;
+    }
+
+    uint64_t end = std::min(offset + count, this->mSize);
+
+    // Ranges are kept sorted, merging the ones that overlap or touch
+    auto it = this->mDirtyRanges.begin();
+    while (it != this->mDirtyRanges.end() && it->offset + it->count < offset) {
+        it++;
+    }
+    while (it != this->mDirtyRanges.end() && it->offset <= end) {
+        offset = std::min(offset, it->offset);
+        end = std::max(end, it->offset + it->count);
+        it = this->mDirtyRanges.erase(it);
+    }
+    this->mDirtyRanges.insert(it, Range{ offset, end - offset });
+
+    // Beyond a handful of ranges the copy commands cost more than the bytes
+    if (this->mDirtyRanges.size() > KOMPUTE_TENSOR_MAX_DIRTY_RANGES) {
+        Range& last = this->mDirtyRanges.back();
+        Range merged{ this->mDirtyRanges.front().offset,
+                      last.offset + last.count -
+                        this->mDirtyRanges.front().offset };
+        this->mDirtyRanges = { merged };
+    }
+}
+
+const std::vector<Tensor::Range>&
+Tensor::dirtyRanges()
+{
+    return this->mDirtyRanges;
+}
+
+void
+Tensor::clearDirtyRanges()
+{
+    this->mDirtyRanges.clear();
 }
 
 void
 Tensor::mapRawData()
 {
 
-    KP_LOG_DEBUG("Kompute Tensor mapping data from host buffer");
+    KP_LOG_TENSOR("Kompute Tensor mapping data from host buffer");
 
     std::shared_ptr<vk::DeviceMemory> hostVisibleMemory = nullptr;
+    MemoryPool::Allocation* hostVisibleAllocation = nullptr;
+
+    if (this->usesStagingRing()) {
+        // Without staging memory the data is kept in host memory
+        this->mRawData = malloc(this->capacityMemorySize());
+        this->mFreeRawData = true;
+        return;
+    }
 
-    if (this->mTensorType == TensorTypes::eHost) {
+    if (this->mTensorType == TensorTypes::eHost ||
+        this->mTensorType == TensorTypes::eUniform) {
         hostVisibleMemory = this->mPrimaryMemory;
-    } else if (this->mTensorType == TensorTypes::eDevice) {
+        hostVisibleAllocation = &this->mPrimaryAllocation;
+    } else if (this->mTensorType == TensorTypes::eDevice ||
+               this->mTensorType == TensorTypes::eImage) {
         hostVisibleMemory = this->mStagingMemory;
+        hostVisibleAllocation = &this->mStagingAllocation;
     } else {
-        KP_LOG_WARN(
-          "Kompute Tensor mapping data not supported on storage tensor");
+        KP_LOG_TENSOR("Kompute Tensor storage tensor has no data to map");
         return;
     }
 
-    vk::DeviceSize bufferSize = this->memorySize();
+    // Pooled memory is mapped once by the pool for all its allocations
+    if (hostVisibleAllocation->memory) {
+        this->mRawData = hostVisibleAllocation->mappedData;
+        return;
+    }
+
+    vk::DeviceSize bufferSize = this->capacityMemorySize();
 
-    // Given we request coherent host memory we don't need to invalidate /
-    // flush
+    // Non-coherent memory is flushed and invalidated by the sync operations
     this->mRawData = this->mDevice->mapMemory(
       *hostVisibleMemory, 0, bufferSize, vk::MemoryMapFlags());
 
@@ -139,92 +878,451 @@ void
 Tensor::unmapRawData()
 {
 
-    KP_LOG_DEBUG("Kompute Tensor mapping data from host buffer");
+    KP_LOG_TENSOR("Kompute Tensor mapping data from host buffer");
 
     std::shared_ptr<vk::DeviceMemory> hostVisibleMemory = nullptr;
+    MemoryPool::Allocation* hostVisibleAllocation = nullptr;
 
-    if (this->mTensorType == TensorTypes::eHost) {
+    if (this->usesStagingRing()) {
+        return;
+    }
+
+    if (this->mTensorType == TensorTypes::eHost ||
+        this->mTensorType == TensorTypes::eUniform) {
         hostVisibleMemory = this->mPrimaryMemory;
-    } else if (this->mTensorType == TensorTypes::eDevice) {
+        hostVisibleAllocation = &this->mPrimaryAllocation;
+    } else if (this->mTensorType == TensorTypes::eDevice ||
+               this->mTensorType == TensorTypes::eImage) {
         hostVisibleMemory = this->mStagingMemory;
+        hostVisibleAllocation = &this->mStagingAllocation;
     } else {
-        KP_LOG_WARN(
-          "Kompute Tensor mapping data not supported on storage tensor");
+        KP_LOG_TENSOR("Kompute Tensor storage tensor has no data to map");
         return;
     }
 
-    vk::DeviceSize bufferSize = this->memorySize();
-    vk::MappedMemoryRange mappedRange(*hostVisibleMemory, 0, bufferSize);
-    this->mDevice->flushMappedMemoryRanges(1, &mappedRange);
+    // Pooled memory stays mapped until the pool frees it
+    if (hostVisibleAllocation->memory) {
+        return;
+    }
+
+    this->flushMappedMemory();
     this->mDevice->unmapMemory(*hostVisibleMemory);
 }
 
+vk::MappedMemoryRange
+Tensor::hostVisibleMemoryRange()
+{
+    if (this->mTensorType == TensorTypes::eHost ||
+        this->mTensorType == TensorTypes::eUniform) {
+        if (this->mPrimaryAllocation.memory) {
+            return vk::MappedMemoryRange(this->mPrimaryAllocation.memory,
+                                         this->mPrimaryAllocation.offset,
+                                         this->mPrimaryAllocation.size);
+        }
+        return vk::MappedMemoryRange(*this->mPrimaryMemory, 0, VK_WHOLE_SIZE);
+    }
+
+    // Pooled non-coherent ranges are already aligned to the atom size
+    if (this->mStagingAllocation.memory) {
+        return vk::MappedMemoryRange(this->mStagingAllocation.memory,
+                                     this->mStagingAllocation.offset,
+                                     this->mStagingAllocation.size);
+    }
+    return vk::MappedMemoryRange(*this->mStagingMemory, 0, VK_WHOLE_SIZE);
+}
+
+void
+Tensor::recordFill(const vk::CommandBuffer& commandBuffer, uint32_t data)
+{
+    if (this->mImage) {
+        KP_LOG_TENSOR("Kompute Tensor recording image clear");
+
+        // Float and normalized formats read the pattern as a float
+        vk::ClearColorValue clearColor;
+        if (this->mDataType == TensorDataTypes::eInt ||
+            this->mDataType == TensorDataTypes::eUnsignedInt ||
+            this->mDataType == TensorDataTypes::eInt16) {
+            clearColor.setUint32({ data, data, data, data });
+        } else {
+            float value;
+            std::memcpy(&value, &data, sizeof(value));
+            clearColor.setFloat32({ value, value, value, value });
+        }
+
+        // The previous contents are discarded as the whole image is cleared
+        this->recordImageMemoryBarrier(commandBuffer,
+                                       vk::AccessFlags(),
+                                       vk::AccessFlagBits::eTransferWrite,
+                                       vk::PipelineStageFlagBits::eAllCommands,
+                                       vk::PipelineStageFlagBits::eTransfer,
+                                       vk::ImageLayout::eUndefined);
+        vk::ImageSubresourceRange subresourceRange(
+          vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1);
+        commandBuffer.clearColorImage(*this->mImage,
+                                      vk::ImageLayout::eGeneral,
+                                      clearColor,
+                                      subresourceRange);
+        return;
+    }
+
+    // Fills operate on whole words, the buffers of non-views are rounded up
+    vk::DeviceSize fillSize = (this->memorySize() + 3) / 4 * 4;
+    if (this->mParent && fillSize != this->memorySize()) {
+        throw std::runtime_error(
+          "Kompute Tensor view fill requires a size multiple of 4 bytes");
+    }
+
+    KP_LOG_TENSOR("Kompute Tensor recording fill of size {}", fillSize);
+
+    commandBuffer.fillBuffer(
+      *this->mPrimaryBuffer, this->mBufferOffset, fillSize, data);
+}
+
+void
+Tensor::flushMappedMemory()
+{
+    if (this->mParent) {
+        this->mParent->flushMappedMemory();
+        return;
+    }
+
+    if (this->mHostMemoryCoherent || this->usesStagingRing() ||
+        this->mTensorType == TensorTypes::eStorage) {
+        return;
+    }
+
+    KP_LOG_TENSOR("Kompute Tensor flushing non-coherent host memory");
+
+    vk::MappedMemoryRange mappedRange = this->hostVisibleMemoryRange();
+    this->mDevice->flushMappedMemoryRanges(1, &mappedRange);
+}
+
+void
+Tensor::invalidateMappedMemory()
+{
+    if (this->mParent) {
+        this->mParent->invalidateMappedMemory();
+        return;
+    }
+
+    if (this->mHostMemoryCoherent || this->usesStagingRing() ||
+        this->mTensorType == TensorTypes::eStorage) {
+        return;
+    }
+
+    KP_LOG_TENSOR("Kompute Tensor invalidating non-coherent host memory");
+
+    vk::MappedMemoryRange mappedRange = this->hostVisibleMemoryRange();
+    this->mDevice->invalidateMappedMemoryRanges(1, &mappedRange);
+}
+
+void
+Tensor::recordCopyFrom(const vk::CommandBuffer& commandBuffer,
+                       std::shared_ptr<Tensor> copyFromTensor,
+                       const std::vector<Range>& ranges)
+{
+    KP_LOG_TENSOR("Kompute Tensor recordCopyFrom data size {} in {} ranges.",
+                  this->memorySize(),
+                  ranges.size());
+
+    // Images are copied whole from and to the buffers of other tensors
+    if (this->mImage && copyFromTensor->mImage) {
+        throw std::runtime_error(
+          "Kompute Tensor copies between two image tensors are not supported");
+    }
+    if (this->mImage) {
+        this->recordImageCopy(commandBuffer,
+                              *copyFromTensor->mPrimaryBuffer,
+                              copyFromTensor->mBufferOffset,
+                              true);
+        return;
+    }
+    if (copyFromTensor->mImage) {
+        copyFromTensor->recordImageCopy(
+          commandBuffer, *this->mPrimaryBuffer, this->mBufferOffset, false);
+        return;
+    }
+
+    this->recordCopyBuffer(commandBuffer,
+                           copyFromTensor->mPrimaryBuffer,
+                           this->mPrimaryBuffer,
+                           copyFromTensor->mBufferOffset,
+                           ranges);
+}
+
+void
+Tensor::recordCopyTo(const vk::CommandBuffer& commandBuffer,
+                     const std::vector<std::shared_ptr<Tensor>>& copyToTensors,
+                     const std::vector<Range>& ranges)
+{
+    KP_LOG_TENSOR("Kompute Tensor recordCopyTo {} tensors data size {} in {} "
+                  "ranges.",
+                  copyToTensors.size(),
+                  this->memorySize(),
+                  ranges.size());
+
+    // Regions relative to the start of the destination buffers, which are
+    // shifted by the offset of each destination
+    std::vector<vk::BufferCopy> baseRegions;
+    std::vector<vk::BufferCopy> regions;
+    if (!this->mImage) {
+        baseRegions = this->copyRegions(ranges, this->mBufferOffset, 0);
+        regions = baseRegions;
+    }
+
+    for (const std::shared_ptr<Tensor>& copyToTensor : copyToTensors) {
+        if (copyToTensor.get() == this) {
+            continue;
+        }
+
+        if (this->mImage && copyToTensor->mImage) {
+            throw std::runtime_error("Kompute Tensor copies between two image "
+                                     "tensors are not supported");
+        }
+        if (copyToTensor->mImage) {
+            copyToTensor->recordImageCopy(commandBuffer,
+                                          *this->mPrimaryBuffer,
+                                          this->mBufferOffset,
+                                          true);
+            continue;
+        }
+        if (this->mImage) {
+            this->recordImageCopy(commandBuffer,
+                                  *copyToTensor->mPrimaryBuffer,
+                                  copyToTensor->mBufferOffset,
+                                  false);
+            continue;
+        }
+
+        if (regions.empty()) {
+            continue;
+        }
+        for (size_t i = 0; i < regions.size(); i++) {
+            regions[i].dstOffset =
+              baseRegions[i].dstOffset + copyToTensor->mBufferOffset;
+        }
+        commandBuffer.copyBuffer(
+          *this->mPrimaryBuffer, *copyToTensor->mPrimaryBuffer, regions);
+    }
+}
+
+void
+Tensor::recordCopyFromStagingToDevice(const vk::CommandBuffer& commandBuffer,
+                                      const std::vector<Range>& ranges)
+{
+    KP_LOG_TENSOR("Kompute Tensor copying data size {} in {} ranges.",
+                  this->memorySize(),
+                  ranges.size());
+
+    if (this->mImage) {
+        this->recordImageCopy(commandBuffer, *this->mStagingBuffer, 0, true);
+        return;
+    }
+
+    this->recordCopyBuffer(commandBuffer,
+                           this->mStagingBuffer,
+                           this->mPrimaryBuffer,
+                           this->mBufferOffset,
+                           ranges);
+}
+
+void
+Tensor::recordCopyFromDeviceToStaging(const vk::CommandBuffer& commandBuffer,
+                                      const std::vector<Range>& ranges)
+{
+    KP_LOG_TENSOR("Kompute Tensor copying data size {} in {} ranges.",
+                  this->memorySize(),
+                  ranges.size());
+
+    if (this->mImage) {
+        this->recordImageCopy(commandBuffer, *this->mStagingBuffer, 0, false);
+        return;
+    }
+
+    this->recordCopyBuffer(commandBuffer,
+                           this->mPrimaryBuffer,
+                           this->mStagingBuffer,
+                           this->mBufferOffset,
+                           ranges);
+}
+
+bool
+Tensor::usesStagingRing()
+{
+    return this->mStagingRing && this->mTensorType == TensorTypes::eDevice;
+}
+
+std::shared_ptr<StagingRing>
+Tensor::stagingRing()
+{
+    return this->usesStagingRing() ? this->mStagingRing : nullptr;
+}
+
 void
-Tensor::recordCopyFrom(const vk::CommandBuffer& commandBuffer,
-                       std::shared_ptr<Tensor> copyFromTensor)
+Tensor::syncDeviceWithStagingRing(const std::vector<Range>& ranges)
 {
+    if (!this->usesStagingRing()) {
+        throw std::runtime_error(
+          "Kompute Tensor syncDeviceWithStagingRing called on tensor without "
+          "staging ring");
+    }
 
-    vk::DeviceSize bufferSize(this->memorySize());
-    vk::BufferCopy copyRegion(0, 0, bufferSize);
+    KP_LOG_TENSOR("Kompute Tensor uploading data size {} through staging ring",
+                  this->memorySize());
+
+    for (const vk::BufferCopy& region :
+         this->copyRegions(ranges, 0, this->mBufferOffset)) {
+        this->mStagingRing->upload((uint8_t*)this->mRawData + region.srcOffset,
+                                   *this->mPrimaryBuffer,
+                                   region.dstOffset,
+                                   region.size);
+        if (this->mMetrics) {
+            this->mMetrics->add(Metrics::Counter::eBytesUploaded,
+                                region.size);
+        }
+    }
+}
 
-    KP_LOG_DEBUG("Kompute Tensor recordCopyFrom data size {}.", bufferSize);
+void
+Tensor::syncLocalWithStagingRing(const std::vector<Range>& ranges)
+{
+    if (!this->usesStagingRing()) {
+        throw std::runtime_error(
+          "Kompute Tensor syncLocalWithStagingRing called on tensor without "
+          "staging ring");
+    }
 
-    this->recordCopyBuffer(commandBuffer,
-                           copyFromTensor->mPrimaryBuffer,
-                           this->mPrimaryBuffer,
-                           bufferSize,
-                           copyRegion);
+    KP_LOG_TENSOR(
+      "Kompute Tensor downloading data size {} through staging ring",
+      this->memorySize());
+
+    for (const vk::BufferCopy& region :
+         this->copyRegions(ranges, this->mBufferOffset, 0)) {
+        this->mStagingRing->download(*this->mPrimaryBuffer,
+                                     region.srcOffset,
+                                     (uint8_t*)this->mRawData + region.dstOffset,
+                                     region.size);
+        if (this->mMetrics) {
+            this->mMetrics->add(Metrics::Counter::eBytesDownloaded,
+                                region.size);
+        }
+    }
 }
 
 void
-Tensor::recordCopyFromStagingToDevice(const vk::CommandBuffer& commandBuffer)
+Tensor::recordCopyBuffer(const vk::CommandBuffer& commandBuffer,
+                         std::shared_ptr<vk::Buffer> bufferFrom,
+                         std::shared_ptr<vk::Buffer> bufferTo,
+                         vk::DeviceSize bufferFromOffset,
+                         const std::vector<Range>& ranges)
 {
-    vk::DeviceSize bufferSize(this->memorySize());
-    vk::BufferCopy copyRegion(0, 0, bufferSize);
-
-    KP_LOG_DEBUG("Kompute Tensor copying data size {}.", bufferSize);
+    std::vector<vk::BufferCopy> copyRegions =
+      this->copyRegions(ranges, bufferFromOffset, this->mBufferOffset);
+    if (copyRegions.empty()) {
+        return;
+    }
 
-    this->recordCopyBuffer(commandBuffer,
-                           this->mStagingBuffer,
-                           this->mPrimaryBuffer,
-                           bufferSize,
-                           copyRegion);
+    commandBuffer.copyBuffer(*bufferFrom, *bufferTo, copyRegions);
 }
 
 void
-Tensor::recordCopyFromDeviceToStaging(const vk::CommandBuffer& commandBuffer)
+Tensor::recordImageCopy(const vk::CommandBuffer& commandBuffer,
+                        const vk::Buffer& buffer,
+                        vk::DeviceSize bufferOffset,
+                        bool toImage)
 {
-    vk::DeviceSize bufferSize(this->memorySize());
-    vk::BufferCopy copyRegion(0, 0, bufferSize);
+    // Texels are tightly packed rows of the whole image in the buffer
+    vk::BufferImageCopy region(
+      bufferOffset,
+      0,
+      0,
+      vk::ImageSubresourceLayers(vk::ImageAspectFlagBits::eColor, 0, 0, 1),
+      vk::Offset3D(0, 0, 0),
+      this->mImageExtent);
+
+    if (toImage) {
+        // The previous contents are discarded as the whole image is written
+        this->recordImageMemoryBarrier(commandBuffer,
+                                       vk::AccessFlags(),
+                                       vk::AccessFlagBits::eTransferWrite,
+                                       vk::PipelineStageFlagBits::eAllCommands,
+                                       vk::PipelineStageFlagBits::eTransfer,
+                                       vk::ImageLayout::eUndefined);
+        commandBuffer.copyBufferToImage(
+          buffer, *this->mImage, vk::ImageLayout::eGeneral, region);
+    } else {
+        commandBuffer.copyImageToBuffer(
+          *this->mImage, vk::ImageLayout::eGeneral, buffer, region);
+    }
+}
 
-    KP_LOG_DEBUG("Kompute Tensor copying data size {}.", bufferSize);
+void
+Tensor::countTransfer(Metrics::Counter counter,
+                      const std::vector<Range>& ranges)
+{
+    if (!this->mMetrics) {
+        return;
+    }
 
-    this->recordCopyBuffer(commandBuffer,
-                           this->mPrimaryBuffer,
-                           this->mStagingBuffer,
-                           bufferSize,
-                           copyRegion);
+    // Images are always transferred whole
+    std::vector<Range> transferred =
+      this->mImage ? std::vector<Range>() : ranges;
+    for (const vk::BufferCopy& region :
+         this->copyRegions(transferred, 0, 0)) {
+        this->mMetrics->add(counter, region.size);
+    }
 }
 
-void
-Tensor::recordCopyBuffer(const vk::CommandBuffer& commandBuffer,
-                         std::shared_ptr<vk::Buffer> bufferFrom,
-                         std::shared_ptr<vk::Buffer> bufferTo,
-                         vk::DeviceSize bufferSize,
-                         vk::BufferCopy copyRegion)
+std::vector<vk::BufferCopy>
+Tensor::copyRegions(const std::vector<Range>& ranges,
+                    vk::DeviceSize srcOffset,
+                    vk::DeviceSize dstOffset)
 {
+    if (ranges.empty()) {
+        return { vk::BufferCopy(srcOffset, dstOffset, this->memorySize()) };
+    }
 
-    commandBuffer.copyBuffer(*bufferFrom, *bufferTo, copyRegion);
+    std::vector<vk::BufferCopy> copyRegions;
+    copyRegions.reserve(ranges.size());
+    for (const Range& range : ranges) {
+        if (range.offset + range.count > this->mSize) {
+            throw std::runtime_error(fmt::format(
+              "Kompute Tensor copy range {}+{} out of bounds for tensor of "
+              "size {}",
+              range.offset,
+              range.count,
+              this->mSize));
+        }
+        if (range.count == 0) {
+            continue;
+        }
+        vk::DeviceSize offset = range.offset * this->mDataTypeMemorySize;
+        copyRegions.push_back(
+          vk::BufferCopy(srcOffset + offset,
+                         dstOffset + offset,
+                         range.count * this->mDataTypeMemorySize));
+    }
+    return copyRegions;
 }
 
 void
 Tensor::recordPrimaryBufferMemoryBarrier(const vk::CommandBuffer& commandBuffer,
-                                         vk::AccessFlagBits srcAccessMask,
-                                         vk::AccessFlagBits dstAccessMask,
-                                         vk::PipelineStageFlagBits srcStageMask,
-                                         vk::PipelineStageFlagBits dstStageMask)
+                                         vk::AccessFlags srcAccessMask,
+                                         vk::AccessFlags dstAccessMask,
+                                         vk::PipelineStageFlags srcStageMask,
+                                         vk::PipelineStageFlags dstStageMask)
 {
-    KP_LOG_DEBUG("Kompute Tensor recording PRIMARY buffer memory barrier");
+    KP_LOG_TENSOR("Kompute Tensor recording PRIMARY buffer memory barrier");
+
+    if (this->mImage) {
+        this->recordImageMemoryBarrier(commandBuffer,
+                                       srcAccessMask,
+                                       dstAccessMask,
+                                       srcStageMask,
+                                       dstStageMask,
+                                       vk::ImageLayout::eGeneral);
+        return;
+    }
 
     this->recordBufferMemoryBarrier(commandBuffer,
                                     *this->mPrimaryBuffer,
@@ -236,12 +1334,12 @@ Tensor::recordPrimaryBufferMemoryBarrier(const vk::CommandBuffer& commandBuffer,
 
 void
 Tensor::recordStagingBufferMemoryBarrier(const vk::CommandBuffer& commandBuffer,
-                                         vk::AccessFlagBits srcAccessMask,
-                                         vk::AccessFlagBits dstAccessMask,
-                                         vk::PipelineStageFlagBits srcStageMask,
-                                         vk::PipelineStageFlagBits dstStageMask)
+                                         vk::AccessFlags srcAccessMask,
+                                         vk::AccessFlags dstAccessMask,
+                                         vk::PipelineStageFlags srcStageMask,
+                                         vk::PipelineStageFlags dstStageMask)
 {
-    KP_LOG_DEBUG("Kompute Tensor recording PRIMARY buffer memory barrier");
+    KP_LOG_TENSOR("Kompute Tensor recording PRIMARY buffer memory barrier");
 
     this->recordBufferMemoryBarrier(commandBuffer,
                                     *this->mStagingBuffer,
@@ -251,61 +1349,196 @@ Tensor::recordStagingBufferMemoryBarrier(const vk::CommandBuffer& commandBuffer,
                                     dstStageMask);
 }
 
-void
-Tensor::recordBufferMemoryBarrier(const vk::CommandBuffer& commandBuffer,
-                                  const vk::Buffer& buffer,
-                                  vk::AccessFlagBits srcAccessMask,
-                                  vk::AccessFlagBits dstAccessMask,
-                                  vk::PipelineStageFlagBits srcStageMask,
-                                  vk::PipelineStageFlagBits dstStageMask)
+vk::BufferMemoryBarrier
+Tensor::createPrimaryBufferMemoryBarrier(vk::AccessFlags srcAccessMask,
+                                         vk::AccessFlags dstAccessMask)
+{
+    if (this->mImage) {
+        throw std::runtime_error(
+          "Kompute Tensor image tensors require an image memory barrier");
+    }
+    return this->createBufferMemoryBarrier(
+      *this->mPrimaryBuffer, srcAccessMask, dstAccessMask);
+}
+
+vk::BufferMemoryBarrier
+Tensor::createStagingBufferMemoryBarrier(vk::AccessFlags srcAccessMask,
+                                         vk::AccessFlags dstAccessMask)
 {
-    KP_LOG_DEBUG("Kompute Tensor recording buffer memory barrier");
+    return this->createBufferMemoryBarrier(
+      *this->mStagingBuffer, srcAccessMask, dstAccessMask);
+}
+
+vk::ImageMemoryBarrier
+Tensor::createImageMemoryBarrier(vk::AccessFlags srcAccessMask,
+                                 vk::AccessFlags dstAccessMask,
+                                 vk::ImageLayout oldLayout)
+{
+    if (!this->mImage) {
+        throw std::runtime_error(
+          "Kompute Tensor image memory barrier requires an image tensor");
+    }
+
+    vk::ImageMemoryBarrier imageMemoryBarrier;
+    imageMemoryBarrier.image = *this->mImage;
+    imageMemoryBarrier.oldLayout = oldLayout;
+    imageMemoryBarrier.newLayout = vk::ImageLayout::eGeneral;
+    imageMemoryBarrier.subresourceRange =
+      vk::ImageSubresourceRange(vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1);
+    imageMemoryBarrier.srcAccessMask = srcAccessMask;
+    imageMemoryBarrier.dstAccessMask = dstAccessMask;
+    imageMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    imageMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+
+    return imageMemoryBarrier;
+}
 
+vk::BufferMemoryBarrier
+Tensor::createBufferMemoryBarrier(const vk::Buffer& buffer,
+                                  vk::AccessFlags srcAccessMask,
+                                  vk::AccessFlags dstAccessMask)
+{
     vk::DeviceSize bufferSize = this->memorySize();
 
     vk::BufferMemoryBarrier bufferMemoryBarrier;
     bufferMemoryBarrier.buffer = buffer;
+    bufferMemoryBarrier.offset = this->mBufferOffset;
     bufferMemoryBarrier.size = bufferSize;
     bufferMemoryBarrier.srcAccessMask = srcAccessMask;
     bufferMemoryBarrier.dstAccessMask = dstAccessMask;
     bufferMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
     bufferMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
 
+    return bufferMemoryBarrier;
+}
+
+void
+Tensor::recordBufferMemoryBarrier(const vk::CommandBuffer& commandBuffer,
+                                  const vk::Buffer& buffer,
+                                  vk::AccessFlags srcAccessMask,
+                                  vk::AccessFlags dstAccessMask,
+                                  vk::PipelineStageFlags srcStageMask,
+                                  vk::PipelineStageFlags dstStageMask)
+{
+    KP_LOG_TENSOR("Kompute Tensor recording buffer memory barrier");
+
+    vk::BufferMemoryBarrier bufferMemoryBarrier =
+      this->createBufferMemoryBarrier(buffer, srcAccessMask, dstAccessMask);
+
     commandBuffer.pipelineBarrier(srcStageMask,
                                   dstStageMask,
                                   vk::DependencyFlags(),
                                   nullptr,
                                   bufferMemoryBarrier,
                                   nullptr);
+    if (this->mMetrics) {
+        this->mMetrics->add(Metrics::Counter::eBarriers);
+    }
+}
+
+void
+Tensor::recordImageMemoryBarrier(const vk::CommandBuffer& commandBuffer,
+                                 vk::AccessFlags srcAccessMask,
+                                 vk::AccessFlags dstAccessMask,
+                                 vk::PipelineStageFlags srcStageMask,
+                                 vk::PipelineStageFlags dstStageMask,
+                                 vk::ImageLayout oldLayout)
+{
+    KP_LOG_TENSOR("Kompute Tensor recording image memory barrier");
+
+    vk::ImageMemoryBarrier imageMemoryBarrier =
+      this->createImageMemoryBarrier(srcAccessMask, dstAccessMask, oldLayout);
+
+    commandBuffer.pipelineBarrier(srcStageMask,
+                                  dstStageMask,
+                                  vk::DependencyFlags(),
+                                  nullptr,
+                                  nullptr,
+                                  imageMemoryBarrier);
+    if (this->mMetrics) {
+        this->mMetrics->add(Metrics::Counter::eBarriers);
+    }
 }
 
 vk::DescriptorBufferInfo
 Tensor::constructDescriptorBufferInfo()
 {
-    KP_LOG_DEBUG("Kompute Tensor construct descriptor buffer info size {}",
-                 this->memorySize());
+    KP_LOG_TENSOR("Kompute Tensor construct descriptor buffer info size {}",
+                  this->memorySize());
     vk::DeviceSize bufferSize = this->memorySize();
-    return vk::DescriptorBufferInfo(*this->mPrimaryBuffer,
-                                    0, // offset
-                                    bufferSize);
+
+    // Tensors beyond the range limit can still be bound through their views
+    uint32_t maxStorageBufferRange =
+      this->mDeviceInfo->properties().limits.maxStorageBufferRange;
+    if (bufferSize > maxStorageBufferRange) {
+        throw std::runtime_error(fmt::format(
+          "Kompute Tensor of {} bytes exceeds maxStorageBufferRange {}, bind "
+          "views of at most that size instead",
+          bufferSize,
+          maxStorageBufferRange));
+    }
+
+    return vk::DescriptorBufferInfo(
+      *this->mPrimaryBuffer, this->mBufferOffset, bufferSize);
+}
+
+vk::DescriptorImageInfo
+Tensor::constructDescriptorImageInfo()
+{
+    KP_LOG_TENSOR("Kompute Tensor construct descriptor image info");
+
+    if (!this->mImageView) {
+        throw std::runtime_error(
+          "Kompute Tensor descriptor image info requires an image tensor");
+    }
+
+    return vk::DescriptorImageInfo(
+      vk::Sampler(), *this->mImageView, vk::ImageLayout::eGeneral);
+}
+
+vk::DescriptorType
+Tensor::descriptorType()
+{
+    if (this->mTensorType == TensorTypes::eUniform) {
+        return vk::DescriptorType::eUniformBuffer;
+    }
+    if (this->mTensorType == TensorTypes::eImage) {
+        return vk::DescriptorType::eStorageImage;
+    }
+    return vk::DescriptorType::eStorageBuffer;
 }
 
 vk::BufferUsageFlags
 Tensor::getPrimaryBufferUsageFlags()
 {
+    // The memory of the pool is only allocated with device addresses when
+    // the extension is enabled
+    vk::BufferUsageFlags addressUsage;
+    if (this->mMemoryPool && this->mMemoryPool->hasBufferDeviceAddress()) {
+        addressUsage = vk::BufferUsageFlagBits::eShaderDeviceAddress;
+    }
+
     switch (this->mTensorType) {
         case TensorTypes::eDevice:
             return vk::BufferUsageFlagBits::eStorageBuffer |
+                   vk::BufferUsageFlagBits::eIndirectBuffer |
                    vk::BufferUsageFlagBits::eTransferSrc |
-                   vk::BufferUsageFlagBits::eTransferDst;
+                   vk::BufferUsageFlagBits::eTransferDst | addressUsage;
             break;
         case TensorTypes::eHost:
             return vk::BufferUsageFlagBits::eStorageBuffer |
+                   vk::BufferUsageFlagBits::eIndirectBuffer |
                    vk::BufferUsageFlagBits::eTransferSrc |
-                   vk::BufferUsageFlagBits::eTransferDst;
+                   vk::BufferUsageFlagBits::eTransferDst | addressUsage;
             break;
         case TensorTypes::eStorage:
-            return vk::BufferUsageFlagBits::eStorageBuffer;
+            return vk::BufferUsageFlagBits::eStorageBuffer |
+                   vk::BufferUsageFlagBits::eIndirectBuffer | addressUsage;
+            break;
+        case TensorTypes::eUniform:
+            return vk::BufferUsageFlagBits::eUniformBuffer |
+                   vk::BufferUsageFlagBits::eTransferSrc |
+                   vk::BufferUsageFlagBits::eTransferDst | addressUsage;
             break;
         default:
             throw std::runtime_error("Kompute Tensor invalid tensor type");
@@ -320,12 +1553,17 @@ Tensor::getPrimaryMemoryPropertyFlags()
             return vk::MemoryPropertyFlagBits::eDeviceLocal;
             break;
         case TensorTypes::eHost:
-            return vk::MemoryPropertyFlagBits::eHostVisible |
-                   vk::MemoryPropertyFlagBits::eHostCoherent;
+            return this->getHostVisibleMemoryPropertyFlags();
             break;
         case TensorTypes::eStorage:
+        case TensorTypes::eImage:
             return vk::MemoryPropertyFlagBits::eDeviceLocal;
             break;
+        case TensorTypes::eUniform:
+            // Coherent so host writes need no flush before a submission
+            return vk::MemoryPropertyFlagBits::eHostVisible |
+                   vk::MemoryPropertyFlagBits::eHostCoherent;
+            break;
         default:
             throw std::runtime_error("Kompute Tensor invalid tensor type");
     }
@@ -336,6 +1574,7 @@ Tensor::getStagingBufferUsageFlags()
 {
     switch (this->mTensorType) {
         case TensorTypes::eDevice:
+        case TensorTypes::eImage:
             return vk::BufferUsageFlagBits::eTransferSrc |
                    vk::BufferUsageFlagBits::eTransferDst;
             break;
@@ -349,16 +1588,34 @@ Tensor::getStagingMemoryPropertyFlags()
 {
     switch (this->mTensorType) {
         case TensorTypes::eDevice:
+        case TensorTypes::eImage:
+            return this->getHostVisibleMemoryPropertyFlags();
+            break;
+        default:
+            throw std::runtime_error("Kompute Tensor invalid tensor type");
+    }
+}
+
+vk::MemoryPropertyFlags
+Tensor::getHostVisibleMemoryPropertyFlags()
+{
+    switch (this->mHostMemoryType) {
+        case HostMemoryTypes::eCoherent:
+        case HostMemoryTypes::eImported:
             return vk::MemoryPropertyFlagBits::eHostVisible |
                    vk::MemoryPropertyFlagBits::eHostCoherent;
             break;
+        case HostMemoryTypes::eCached:
+            return vk::MemoryPropertyFlagBits::eHostVisible |
+                   vk::MemoryPropertyFlagBits::eHostCached;
+            break;
         default:
-            throw std::runtime_error("Kompute Tensor invalid tensor type");
+            throw std::runtime_error("Kompute Tensor invalid host memory type");
     }
 }
 
 void
-Tensor::allocateMemoryCreateGPUResources()
+Tensor::allocateMemoryCreateGPUResources(void* data)
 {
     KP_LOG_DEBUG("Kompute Tensor creating buffer");
 
@@ -368,31 +1625,82 @@ Tensor::allocateMemoryCreateGPUResources()
     if (!this->mDevice) {
         throw std::runtime_error("Kompute Tensor device is null");
     }
+    if (this->mTensorType == TensorTypes::eUniform) {
+        uint32_t maxUniformBufferRange =
+          this->mDeviceInfo->properties().limits.maxUniformBufferRange;
+        if (this->capacityMemorySize() > maxUniformBufferRange) {
+            throw std::runtime_error(fmt::format(
+              "Kompute Tensor uniform tensor of {} bytes exceeds the maximum "
+              "uniform buffer range of {} bytes",
+              this->capacityMemorySize(),
+              maxUniformBufferRange));
+        }
+    }
+
+    bool importHostMemory =
+      this->mHostMemoryType == HostMemoryTypes::eImported &&
+      this->mMemoryPool &&
+      this->mMemoryPool->canImportHostPointer(data, this->memorySize());
+    this->mHostMemoryImported = false;
 
     KP_LOG_DEBUG("Kompute Tensor creating primary buffer and memory");
 
-    this->mPrimaryBuffer = std::make_shared<vk::Buffer>();
-    this->createBuffer(this->mPrimaryBuffer,
-                       this->getPrimaryBufferUsageFlags());
-    this->mFreePrimaryBuffer = true;
     this->mPrimaryMemory = std::make_shared<vk::DeviceMemory>();
-    this->allocateBindMemory(this->mPrimaryBuffer,
-                             this->mPrimaryMemory,
-                             this->getPrimaryMemoryPropertyFlags());
-    this->mFreePrimaryMemory = true;
+    if (this->mTensorType == TensorTypes::eImage) {
+        this->createImage();
+    } else {
+        this->mPrimaryBuffer = std::make_shared<vk::Buffer>();
+        if (importHostMemory && this->mTensorType == TensorTypes::eHost) {
+            this->mHostMemoryImported =
+              this->importBindHostMemory(this->mPrimaryBuffer,
+                                         this->mPrimaryMemory,
+                                         this->mPrimaryAllocation,
+                                         this->getPrimaryBufferUsageFlags(),
+                                         data);
+        }
+        if (!this->mHostMemoryImported) {
+            this->createBuffer(this->mPrimaryBuffer,
+                               this->getPrimaryBufferUsageFlags());
+            this->allocateBindMemory(this->mPrimaryBuffer,
+                                     this->mPrimaryMemory,
+                                     this->mPrimaryAllocation,
+                                     this->getPrimaryMemoryPropertyFlags());
+        }
+        this->mFreePrimaryBuffer = true;
+    }
+    this->mFreePrimaryMemory = !this->mPrimaryAllocation.memory;
 
-    if (this->mTensorType == TensorTypes::eDevice) {
+    // Images are never created with a staging ring
+    if ((this->mTensorType == TensorTypes::eDevice && !this->mStagingRing) ||
+        this->mTensorType == TensorTypes::eImage) {
         KP_LOG_DEBUG("Kompute Tensor creating staging buffer and memory");
 
         this->mStagingBuffer = std::make_shared<vk::Buffer>();
-        this->createBuffer(this->mStagingBuffer,
-                           this->getStagingBufferUsageFlags());
-        this->mFreeStagingBuffer = true;
         this->mStagingMemory = std::make_shared<vk::DeviceMemory>();
-        this->allocateBindMemory(this->mStagingBuffer,
-                                 this->mStagingMemory,
-                                 this->getStagingMemoryPropertyFlags());
-        this->mFreeStagingMemory = true;
+        if (importHostMemory) {
+            this->mHostMemoryImported =
+              this->importBindHostMemory(this->mStagingBuffer,
+                                         this->mStagingMemory,
+                                         this->mStagingAllocation,
+                                         this->getStagingBufferUsageFlags(),
+                                         data);
+        }
+        if (!this->mHostMemoryImported) {
+            this->createBuffer(this->mStagingBuffer,
+                               this->getStagingBufferUsageFlags());
+            this->allocateBindMemory(this->mStagingBuffer,
+                                     this->mStagingMemory,
+                                     this->mStagingAllocation,
+                                     this->getStagingMemoryPropertyFlags());
+        }
+        this->mFreeStagingBuffer = true;
+        this->mFreeStagingMemory = !this->mStagingAllocation.memory;
+    }
+
+    if (this->mHostMemoryType == HostMemoryTypes::eImported &&
+        !this->mHostMemoryImported) {
+        KP_LOG_DEBUG("Kompute Tensor host memory not imported, falling back "
+                     "to host coherent memory with a copy");
     }
 
     KP_LOG_DEBUG("Kompute Tensor buffer & memory creation successful");
@@ -400,10 +1708,12 @@ Tensor::allocateMemoryCreateGPUResources()
 
 void
 Tensor::createBuffer(std::shared_ptr<vk::Buffer> buffer,
-                     vk::BufferUsageFlags bufferUsageFlags)
+                     vk::BufferUsageFlags bufferUsageFlags,
+                     vk::ExternalMemoryHandleTypeFlags externalHandleTypes)
 {
 
-    vk::DeviceSize bufferSize = this->memorySize();
+    // Rounded up to whole words so the buffer can always be filled
+    vk::DeviceSize bufferSize = (this->capacityMemorySize() + 3) / 4 * 4;
 
     if (bufferSize < 1) {
         throw std::runtime_error(
@@ -415,44 +1725,275 @@ Tensor::createBuffer(std::shared_ptr<vk::Buffer> buffer,
                  bufferSize,
                  vk::to_string(bufferUsageFlags));
 
-    // TODO: Explore having concurrent sharing mode (with option)
+    // Buffers shared between queue families are concurrent, as exclusive
+    // buffers would need their ownership transferred between the queues
     vk::BufferCreateInfo bufferInfo(vk::BufferCreateFlags(),
                                     bufferSize,
                                     bufferUsageFlags,
                                     vk::SharingMode::eExclusive);
+    if (this->mQueueFamilyIndices.size()) {
+        bufferInfo.setSharingMode(vk::SharingMode::eConcurrent);
+        bufferInfo.setQueueFamilyIndexCount(this->mQueueFamilyIndices.size());
+        bufferInfo.setPQueueFamilyIndices(this->mQueueFamilyIndices.data());
+    }
+
+    // Buffers bound to imported memory must declare the handle type upfront
+    vk::ExternalMemoryBufferCreateInfo externalMemoryInfo(externalHandleTypes);
+    if (externalHandleTypes) {
+        bufferInfo.setPNext(&externalMemoryInfo);
+    }
+
+    this->mDevice->createBuffer(
+      &bufferInfo,
+      HostAllocator::callbacks(this->mHostAllocator),
+      buffer.get());
+}
+
+bool
+Tensor::importBindHostMemory(std::shared_ptr<vk::Buffer> buffer,
+                             std::shared_ptr<vk::DeviceMemory> memory,
+                             MemoryPool::Allocation& allocation,
+                             vk::BufferUsageFlags bufferUsageFlags,
+                             void* data)
+{
+    KP_LOG_DEBUG("Kompute Tensor importing host memory");
+
+    this->createBuffer(
+      buffer,
+      bufferUsageFlags,
+      vk::ExternalMemoryHandleTypeFlagBits::eHostAllocationEXT);
+
+    vk::MemoryRequirements memoryRequirements =
+      this->mDevice->getBufferMemoryRequirements(*buffer);
+
+    if (!this->mMemoryPool->importHostPointer(
+          memoryRequirements,
+          vk::MemoryPropertyFlagBits::eHostVisible,
+          data,
+          this->memorySize(),
+          allocation)) {
+        // The buffer cannot be bound to memory without the external handle
+        this->mDevice->destroy(
+          *buffer, HostAllocator::callbacks(this->mHostAllocator));
+        return false;
+    }
+
+    *memory = allocation.memory;
+    this->mDevice->bindBufferMemory(*buffer, *memory, 0);
+
+    vk::MemoryPropertyFlags memoryTypeFlags =
+      this->mDeviceInfo->memoryProperties()
+        .memoryTypes[allocation.memoryTypeIndex]
+        .propertyFlags;
+    this->mHostMemoryCoherent =
+      (bool)(memoryTypeFlags & vk::MemoryPropertyFlagBits::eHostCoherent);
+
+    return true;
+}
+
+void
+Tensor::createImage()
+{
+    vk::Format format = this->imageFormat();
+
+    KP_LOG_DEBUG("Kompute Tensor creating image of {}x{} texels with format "
+                 "{}",
+                 this->mImageExtent.width,
+                 this->mImageExtent.height,
+                 vk::to_string(format));
+
+    vk::FormatFeatureFlags formatFeatures =
+      this->mPhysicalDevice->getFormatProperties(format).optimalTilingFeatures;
+    if (!(formatFeatures & vk::FormatFeatureFlagBits::eStorageImage)) {
+        throw std::runtime_error(
+          fmt::format("Kompute Tensor image format {} not supported for "
+                      "storage images by the device",
+                      vk::to_string(format)));
+    }
+
+    // Renderers sharing the device sample the image when the format allows
+    vk::ImageUsageFlags imageUsageFlags =
+      vk::ImageUsageFlagBits::eStorage | vk::ImageUsageFlagBits::eTransferSrc |
+      vk::ImageUsageFlagBits::eTransferDst;
+    if (formatFeatures & vk::FormatFeatureFlagBits::eSampledImage) {
+        imageUsageFlags |= vk::ImageUsageFlagBits::eSampled;
+    }
+
+    vk::ImageCreateInfo imageInfo(vk::ImageCreateFlags(),
+                                  vk::ImageType::e2D,
+                                  format,
+                                  this->mImageExtent,
+                                  1, // Mip levels
+                                  1, // Array layers
+                                  vk::SampleCountFlagBits::e1,
+                                  vk::ImageTiling::eOptimal,
+                                  imageUsageFlags,
+                                  vk::SharingMode::eExclusive);
+    if (this->mQueueFamilyIndices.size()) {
+        imageInfo.setSharingMode(vk::SharingMode::eConcurrent);
+        imageInfo.setQueueFamilyIndexCount(this->mQueueFamilyIndices.size());
+        imageInfo.setPQueueFamilyIndices(this->mQueueFamilyIndices.data());
+    }
+
+    this->mImage = std::make_shared<vk::Image>();
+    this->mDevice->createImage(&imageInfo,
+                               HostAllocator::callbacks(this->mHostAllocator),
+                               this->mImage.get());
+    this->mFreeImage = true;
+
+    // Pooled images are padded to whole pages of the buffer image
+    // granularity, so they never share a page with the linear buffers
+    vk::MemoryRequirements memoryRequirements =
+      this->mDevice->getImageMemoryRequirements(*this->mImage);
+    if (this->mMemoryPool) {
+        vk::DeviceSize granularity =
+          this->mDeviceInfo->properties().limits.bufferImageGranularity;
+        memoryRequirements.alignment =
+          std::max(memoryRequirements.alignment, granularity);
+        memoryRequirements.size =
+          (memoryRequirements.size + granularity - 1) / granularity *
+          granularity;
+    }
+
+    vk::DeviceSize offset =
+      this->allocateMemory(this->mPrimaryMemory,
+                           this->mPrimaryAllocation,
+                           memoryRequirements,
+                           this->getPrimaryMemoryPropertyFlags());
+    this->mDevice->bindImageMemory(
+      *this->mImage, *this->mPrimaryMemory, offset);
+
+    vk::ImageViewCreateInfo imageViewInfo(
+      vk::ImageViewCreateFlags(),
+      *this->mImage,
+      vk::ImageViewType::e2D,
+      format,
+      vk::ComponentMapping(),
+      vk::ImageSubresourceRange(vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1));
+
+    this->mImageView = std::make_shared<vk::ImageView>();
+    this->mDevice->createImageView(
+      &imageViewInfo,
+      HostAllocator::callbacks(this->mHostAllocator),
+      this->mImageView.get());
+}
+
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+void
+Tensor::importHardwareBuffer()
+{
+    KP_LOG_DEBUG("Kompute Tensor importing hardware buffer");
+
+    this->mPrimaryBuffer = std::make_shared<vk::Buffer>();
+    this->mPrimaryMemory = std::make_shared<vk::DeviceMemory>();
+    this->createBuffer(
+      this->mPrimaryBuffer,
+      this->getPrimaryBufferUsageFlags(),
+      vk::ExternalMemoryHandleTypeFlagBits::eAndroidHardwareBufferANDROID);
+
+    vk::MemoryRequirements memoryRequirements =
+      this->mDevice->getBufferMemoryRequirements(*this->mPrimaryBuffer);
+
+    if (!this->mMemoryPool->importHardwareBuffer(memoryRequirements,
+                                                 this->mHardwareBuffer,
+                                                 this->mPrimaryAllocation)) {
+        this->mDevice->destroy(*this->mPrimaryBuffer,
+                               HostAllocator::callbacks(this->mHostAllocator));
+        this->mPrimaryBuffer = nullptr;
+        this->mPrimaryMemory = nullptr;
+        throw std::runtime_error(
+          "Kompute Tensor failed to import hardware buffer");
+    }
 
-    this->mDevice->createBuffer(&bufferInfo, nullptr, buffer.get());
+    *this->mPrimaryMemory = this->mPrimaryAllocation.memory;
+    this->mDevice->bindBufferMemory(
+      *this->mPrimaryBuffer, *this->mPrimaryMemory, 0);
+    this->mFreePrimaryBuffer = true;
+    this->mFreePrimaryMemory = false;
+
+    // Buffers allocated without CPU usage can only be accessed by shaders
+    vk::MemoryPropertyFlags memoryTypeFlags =
+      this->mDeviceInfo->memoryProperties()
+        .memoryTypes[this->mPrimaryAllocation.memoryTypeIndex]
+        .propertyFlags;
+    if (memoryTypeFlags & vk::MemoryPropertyFlagBits::eHostVisible) {
+        this->mHostMemoryImported = true;
+        this->mHostMemoryCoherent =
+          (bool)(memoryTypeFlags & vk::MemoryPropertyFlagBits::eHostCoherent);
+    } else {
+        KP_LOG_DEBUG("Kompute Tensor hardware buffer is not host visible, "
+                     "using it as a storage tensor");
+        this->mTensorType = TensorTypes::eStorage;
+    }
 }
+#endif
 
 void
 Tensor::allocateBindMemory(std::shared_ptr<vk::Buffer> buffer,
                            std::shared_ptr<vk::DeviceMemory> memory,
+                           MemoryPool::Allocation& allocation,
                            vk::MemoryPropertyFlags memoryPropertyFlags)
 {
 
     KP_LOG_DEBUG("Kompute Tensor allocating and binding memory");
 
-    vk::PhysicalDeviceMemoryProperties memoryProperties =
-      this->mPhysicalDevice->getMemoryProperties();
-
     vk::MemoryRequirements memoryRequirements =
       this->mDevice->getBufferMemoryRequirements(*buffer);
 
-    uint32_t memoryTypeIndex = -1;
-    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
-        if (memoryRequirements.memoryTypeBits & (1 << i)) {
-            if (((memoryProperties.memoryTypes[i]).propertyFlags &
-                 memoryPropertyFlags) == memoryPropertyFlags) {
-                memoryTypeIndex = i;
-                break;
-            }
-        }
+    vk::DeviceSize offset = this->allocateMemory(
+      memory, allocation, memoryRequirements, memoryPropertyFlags);
+    this->mDevice->bindBufferMemory(*buffer, *memory, offset);
+}
+
+vk::DeviceSize
+Tensor::allocateMemory(std::shared_ptr<vk::DeviceMemory> memory,
+                       MemoryPool::Allocation& allocation,
+                       const vk::MemoryRequirements& memoryRequirements,
+                       vk::MemoryPropertyFlags memoryPropertyFlags)
+{
+    const vk::PhysicalDeviceMemoryProperties& memoryProperties =
+      this->mDeviceInfo->memoryProperties();
+
+    int32_t memoryTypeIndex = this->findMemoryTypeIndex(
+      memoryProperties, memoryRequirements, memoryPropertyFlags);
+
+    // Not all devices expose host cached memory for every buffer
+    if (memoryTypeIndex < 0 &&
+        (memoryPropertyFlags & vk::MemoryPropertyFlagBits::eHostCached)) {
+        KP_LOG_DEBUG("Kompute Tensor host cached memory not available, "
+                     "falling back to host coherent memory");
+        memoryPropertyFlags = vk::MemoryPropertyFlagBits::eHostVisible |
+                              vk::MemoryPropertyFlagBits::eHostCoherent;
+        memoryTypeIndex = this->findMemoryTypeIndex(
+          memoryProperties, memoryRequirements, memoryPropertyFlags);
     }
+
     if (memoryTypeIndex < 0) {
         throw std::runtime_error(
           "Memory type index for buffer creation not found");
     }
 
+    vk::MemoryPropertyFlags memoryTypeFlags =
+      memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags;
+    if (memoryTypeFlags & vk::MemoryPropertyFlagBits::eHostVisible) {
+        this->mHostMemoryCoherent =
+          (bool)(memoryTypeFlags & vk::MemoryPropertyFlagBits::eHostCoherent);
+    }
+
+    if (this->mMemoryPool) {
+        allocation =
+          this->mMemoryPool->allocate(memoryRequirements, memoryPropertyFlags);
+        *memory = allocation.memory;
+
+        KP_LOG_DEBUG("Kompute Tensor binding pooled memory index: {}, offset "
+                     "{}, size {}",
+                     allocation.memoryTypeIndex,
+                     allocation.offset,
+                     allocation.size);
+
+        return allocation.offset;
+    }
+
     KP_LOG_DEBUG(
       "Kompute Tensor allocating memory index: {}, size {}, flags: {}",
       memoryTypeIndex,
@@ -462,9 +2003,35 @@ Tensor::allocateBindMemory(std::shared_ptr<vk::Buffer> buffer,
     vk::MemoryAllocateInfo memoryAllocateInfo(memoryRequirements.size,
                                               memoryTypeIndex);
 
-    this->mDevice->allocateMemory(&memoryAllocateInfo, nullptr, memory.get());
+    vk::Result result = this->mDevice->allocateMemory(
+      &memoryAllocateInfo,
+      HostAllocator::callbacks(this->mHostAllocator),
+      memory.get());
+    if (result != vk::Result::eSuccess) {
+        throw std::runtime_error(
+          fmt::format("Kompute Tensor failed to allocate {} bytes of memory: {}",
+                      memoryRequirements.size,
+                      vk::to_string(result)));
+    }
 
-    this->mDevice->bindBufferMemory(*buffer, *memory, 0);
+    return 0;
+}
+
+int32_t
+Tensor::findMemoryTypeIndex(
+  const vk::PhysicalDeviceMemoryProperties& memoryProperties,
+  const vk::MemoryRequirements& memoryRequirements,
+  const vk::MemoryPropertyFlags& memoryPropertyFlags)
+{
+    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
+        if (memoryRequirements.memoryTypeBits & (1 << i)) {
+            if (((memoryProperties.memoryTypes[i]).propertyFlags &
+                 memoryPropertyFlags) == memoryPropertyFlags) {
+                return i;
+            }
+        }
+    }
+    return -1;
 }
 
 void
@@ -472,10 +2039,22 @@ Tensor::destroy()
 {
     KP_LOG_DEBUG("Kompute Tensor started destroy()");
 
+    // Views would be left pointing to the memory about to be freed
+    std::vector<Tensor*> views = this->mViews;
+    for (Tensor* view : views) {
+        view->destroy();
+    }
+
+    if (this->mFreeRawData) {
+        free(this->mRawData);
+        this->mFreeRawData = false;
+    }
+
     // Setting raw data to null regardless whether device is available to
     // invalidate Tensor
     this->mRawData = nullptr;
     this->mSize = 0;
+    this->mCapacity = 0;
     this->mDataTypeMemorySize = 0;
 
     if (!this->mDevice) {
@@ -484,6 +2063,20 @@ Tensor::destroy()
         return;
     }
 
+    // Views never own the resources they share with their parent
+    if (this->mParent) {
+        KP_LOG_DEBUG("Kompute Tensor releasing view of parent tensor");
+        this->mPrimaryBuffer = nullptr;
+        this->mPrimaryMemory = nullptr;
+        this->mStagingBuffer = nullptr;
+        this->mStagingMemory = nullptr;
+        std::vector<Tensor*>& views = this->mParent->mViews;
+        views.erase(std::remove(views.begin(), views.end(), this), views.end());
+        this->mParent = nullptr;
+        this->mDevice = nullptr;
+        return;
+    }
+
     // Unmap the current memory data
     this->unmapRawData();
 
@@ -495,12 +2088,31 @@ Tensor::destroy()
             KP_LOG_DEBUG("Kompose Tensor destroying primary buffer");
             this->mDevice->destroy(
               *this->mPrimaryBuffer,
-              (vk::Optional<const vk::AllocationCallbacks>)nullptr);
+              HostAllocator::callbacks(this->mHostAllocator));
             this->mPrimaryBuffer = nullptr;
             this->mFreePrimaryBuffer = false;
         }
     }
 
+    if (this->mFreeImage) {
+        if (!this->mImage) {
+            KP_LOG_WARN("Kompute Tensor expected to destroy image but got "
+                        "null image");
+        } else {
+            KP_LOG_DEBUG("Kompute Tensor destroying image and image view");
+            if (this->mImageView) {
+                this->mDevice->destroy(
+                  *this->mImageView,
+                  HostAllocator::callbacks(this->mHostAllocator));
+                this->mImageView = nullptr;
+            }
+            this->mDevice->destroy(
+              *this->mImage, HostAllocator::callbacks(this->mHostAllocator));
+            this->mImage = nullptr;
+            this->mFreeImage = false;
+        }
+    }
+
     if (this->mFreeStagingBuffer) {
         if (!this->mStagingBuffer) {
             KP_LOG_WARN("Kompose Tensor expected to destroy staging buffer "
@@ -509,7 +2121,7 @@ Tensor::destroy()
             KP_LOG_DEBUG("Kompose Tensor destroying staging buffer");
             this->mDevice->destroy(
               *this->mStagingBuffer,
-              (vk::Optional<const vk::AllocationCallbacks>)nullptr);
+              HostAllocator::callbacks(this->mHostAllocator));
             this->mStagingBuffer = nullptr;
             this->mFreeStagingBuffer = false;
         }
@@ -523,7 +2135,7 @@ Tensor::destroy()
             KP_LOG_DEBUG("Kompose Tensor freeing primary memory");
             this->mDevice->freeMemory(
               *this->mPrimaryMemory,
-              (vk::Optional<const vk::AllocationCallbacks>)nullptr);
+              HostAllocator::callbacks(this->mHostAllocator));
             this->mPrimaryMemory = nullptr;
             this->mFreePrimaryMemory = false;
         }
@@ -537,12 +2149,26 @@ Tensor::destroy()
             KP_LOG_DEBUG("Kompose Tensor freeing staging memory");
             this->mDevice->freeMemory(
               *this->mStagingMemory,
-              (vk::Optional<const vk::AllocationCallbacks>)nullptr);
+              HostAllocator::callbacks(this->mHostAllocator));
             this->mStagingMemory = nullptr;
             this->mFreeStagingMemory = false;
         }
     }
 
+    if (this->mPrimaryAllocation.memory) {
+        KP_LOG_DEBUG("Kompute Tensor returning primary memory to pool");
+        this->mMemoryPool->free(this->mPrimaryAllocation);
+        this->mPrimaryAllocation = MemoryPool::Allocation();
+        this->mPrimaryMemory = nullptr;
+    }
+
+    if (this->mStagingAllocation.memory) {
+        KP_LOG_DEBUG("Kompute Tensor returning staging memory to pool");
+        this->mMemoryPool->free(this->mStagingAllocation);
+        this->mStagingAllocation = MemoryPool::Allocation();
+        this->mStagingMemory = nullptr;
+    }
+
     if (this->mDevice) {
         this->mDevice = nullptr;
     }
@@ -585,4 +2211,32 @@ TensorT<double>::dataType()
     return Tensor::TensorDataTypes::eDouble;
 }
 
+template<>
+Tensor::TensorDataTypes
+TensorT<Half>::dataType()
+{
+    return Tensor::TensorDataTypes::eHalf;
+}
+
+template<>
+Tensor::TensorDataTypes
+TensorT<int8_t>::dataType()
+{
+    return Tensor::TensorDataTypes::eInt8;
+}
+
+template<>
+Tensor::TensorDataTypes
+TensorT<uint8_t>::dataType()
+{
+    return Tensor::TensorDataTypes::eUnsignedInt8;
+}
+
+template<>
+Tensor::TensorDataTypes
+TensorT<int16_t>::dataType()
+{
+    return Tensor::TensorDataTypes::eInt16;
+}
+
 }
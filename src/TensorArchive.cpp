@@ -0,0 +1,462 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <set>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "kompute/TensorArchive.hpp"
+#include "kompute/operations/OpTensorSyncDevice.hpp"
+
+namespace kp {
+
+namespace {
+
+// The header is made of the magic, the version and the number of entries,
+// followed by the fixed fields, the shape and the name of each entry
+const char ARCHIVE_MAGIC[4] = { 'K', 'P', 'T', 'A' };
+const uint32_t ARCHIVE_VERSION = 1;
+
+struct EntryFields
+{
+    uint32_t nameSize;
+    uint32_t dataType;
+    uint32_t rank;
+    uint32_t reserved;
+    uint64_t offset;
+    uint64_t size;
+};
+
+template<typename T>
+void
+appendBytes(std::string& header, const T& value)
+{
+    header.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+uint64_t
+alignOffset(uint64_t offset)
+{
+    return (offset + KOMPUTE_TENSOR_ARCHIVE_ALIGNMENT - 1) /
+           KOMPUTE_TENSOR_ARCHIVE_ALIGNMENT * KOMPUTE_TENSOR_ARCHIVE_ALIGNMENT;
+}
+
+uint64_t
+entrySize(const TensorArchive::Entry& entry)
+{
+    uint64_t count = 1;
+    for (uint64_t extent : entry.shape) {
+        count *= extent;
+    }
+    return count * Tensor::elementMemorySize(entry.dataType);
+}
+
+}
+
+void
+TensorArchive::write(const std::string& path,
+                     const std::vector<Entry>& entries,
+                     const std::vector<const void*>& data)
+{
+    KP_LOG_DEBUG("Kompute TensorArchive writing {} entries to {}",
+                 entries.size(),
+                 path);
+
+    if (entries.size() != data.size()) {
+        throw std::runtime_error(
+          fmt::format("Kompute TensorArchive write got {} entries but data "
+                      "for {}",
+                      entries.size(),
+                      data.size()));
+    }
+
+    std::set<std::string> names;
+    uint64_t headerSize = sizeof(ARCHIVE_MAGIC) + sizeof(uint32_t) +
+                          sizeof(uint64_t);
+    for (const Entry& entry : entries) {
+        if (!names.insert(entry.name).second) {
+            throw std::runtime_error(fmt::format(
+              "Kompute TensorArchive entry name {} is not unique", entry.name));
+        }
+        if (entrySize(entry) == 0) {
+            throw std::runtime_error(fmt::format(
+              "Kompute TensorArchive entry {} is empty", entry.name));
+        }
+        headerSize += sizeof(EntryFields) +
+                      entry.shape.size() * sizeof(uint64_t) + entry.name.size();
+    }
+
+    // The data of each entry starts at an aligned offset after the header
+    std::string header;
+    header.append(ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+    appendBytes(header, ARCHIVE_VERSION);
+    appendBytes(header, static_cast<uint64_t>(entries.size()));
+    std::vector<uint64_t> offsets;
+    uint64_t offset = alignOffset(headerSize);
+    for (const Entry& entry : entries) {
+        EntryFields fields = {};
+        fields.nameSize = entry.name.size();
+        fields.dataType = static_cast<uint32_t>(entry.dataType);
+        fields.rank = entry.shape.size();
+        fields.offset = offset;
+        fields.size = entrySize(entry);
+        appendBytes(header, fields);
+        for (uint64_t extent : entry.shape) {
+            appendBytes(header, extent);
+        }
+        header.append(entry.name);
+
+        offsets.push_back(offset);
+        offset = alignOffset(offset + fields.size);
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(header.data(), header.size());
+    const std::string padding(KOMPUTE_TENSOR_ARCHIVE_ALIGNMENT, '\0');
+    uint64_t written = header.size();
+    for (size_t i = 0; i < entries.size(); i++) {
+        file.write(padding.data(), offsets[i] - written);
+        uint64_t size = entrySize(entries[i]);
+        file.write(static_cast<const char*>(data[i]), size);
+        written = offsets[i] + size;
+    }
+    if (!file) {
+        throw std::runtime_error(fmt::format(
+          "Kompute TensorArchive failed to write archive to {}", path));
+    }
+}
+
+void
+TensorArchive::write(const std::string& path,
+                     const std::vector<std::string>& names,
+                     const std::vector<std::shared_ptr<Tensor>>& tensors,
+                     const std::vector<std::vector<uint64_t>>& shapes)
+{
+    if (names.size() != tensors.size() ||
+        (shapes.size() && shapes.size() != tensors.size())) {
+        throw std::runtime_error(
+          fmt::format("Kompute TensorArchive write got {} tensors with {} "
+                      "names and {} shapes",
+                      tensors.size(),
+                      names.size(),
+                      shapes.size()));
+    }
+
+    std::vector<Entry> entries(tensors.size());
+    std::vector<const void*> data(tensors.size());
+    for (size_t i = 0; i < tensors.size(); i++) {
+        if (!tensors[i]->rawData()) {
+            throw std::runtime_error(fmt::format(
+              "Kompute TensorArchive tensor {} has no host data", names[i]));
+        }
+        entries[i].name = names[i];
+        entries[i].dataType = tensors[i]->dataType();
+        entries[i].shape = shapes.size()
+                             ? shapes[i]
+                             : std::vector<uint64_t>{ tensors[i]->size() };
+        if (entrySize(entries[i]) != tensors[i]->memorySize()) {
+            throw std::runtime_error(fmt::format(
+              "Kompute TensorArchive shape of {} does not match the size {} "
+              "of its tensor",
+              names[i],
+              tensors[i]->size()));
+        }
+        data[i] = tensors[i]->rawData();
+    }
+
+    TensorArchive::write(path, entries, data);
+}
+
+TensorArchive::TensorArchive(const std::string& path)
+{
+    KP_LOG_DEBUG("Kompute TensorArchive constructor with archive {}", path);
+
+    this->mPath = path;
+    this->map(path);
+    try {
+        this->readHeader();
+    } catch (const std::exception&) {
+        this->close();
+        throw;
+    }
+
+    KP_LOG_INFO("Kompute TensorArchive opened {} with {} entries",
+                path,
+                this->mEntries.size());
+}
+
+TensorArchive::~TensorArchive()
+{
+    KP_LOG_DEBUG("Kompute TensorArchive destructor started");
+
+    this->close();
+}
+
+void
+TensorArchive::map(const std::string& path)
+{
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error(
+          fmt::format("Kompute TensorArchive failed to open {}", path));
+    }
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(file, &fileSize);
+    this->mFileHandle = file;
+    this->mMappingSize = fileSize.QuadPart;
+    if (this->mMappingSize == 0) {
+        return;
+    }
+
+    this->mMappingHandle =
+      CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (this->mMappingHandle) {
+        this->mMapping = static_cast<const uint8_t*>(
+          MapViewOfFile(this->mMappingHandle, FILE_MAP_READ, 0, 0, 0));
+    }
+    if (!this->mMapping) {
+        this->close();
+        throw std::runtime_error(
+          fmt::format("Kompute TensorArchive failed to map {}", path));
+    }
+#else
+    int file = open(path.c_str(), O_RDONLY);
+    if (file < 0) {
+        throw std::runtime_error(
+          fmt::format("Kompute TensorArchive failed to open {}: {}",
+                      path,
+                      strerror(errno)));
+    }
+    struct stat fileStat;
+    if (fstat(file, &fileStat) != 0) {
+        ::close(file);
+        throw std::runtime_error(
+          fmt::format("Kompute TensorArchive failed to stat {}", path));
+    }
+    this->mMappingSize = fileStat.st_size;
+    if (this->mMappingSize == 0) {
+        ::close(file);
+        return;
+    }
+
+    // The mapping keeps its own reference to the file
+    void* mapping =
+      mmap(nullptr, this->mMappingSize, PROT_READ, MAP_PRIVATE, file, 0);
+    int mapError = errno;
+    ::close(file);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error(
+          fmt::format("Kompute TensorArchive failed to map {}: {}",
+                      path,
+                      strerror(mapError)));
+    }
+    // The data is read from start to end when the tensors are loaded
+    madvise(mapping, this->mMappingSize, MADV_SEQUENTIAL);
+    this->mMapping = static_cast<const uint8_t*>(mapping);
+#endif
+}
+
+void
+TensorArchive::readHeader()
+{
+    uint64_t position = 0;
+    auto read = [this, &position](void* value, uint64_t size) {
+        if (size > this->mMappingSize - position) {
+            throw std::runtime_error(
+              fmt::format("Kompute TensorArchive header of {} is truncated",
+                          this->mPath));
+        }
+        memcpy(value, this->mMapping + position, size);
+        position += size;
+    };
+
+    char magic[sizeof(ARCHIVE_MAGIC)];
+    uint32_t version = 0;
+    uint64_t entryCount = 0;
+    read(magic, sizeof(magic));
+    if (memcmp(magic, ARCHIVE_MAGIC, sizeof(magic)) != 0) {
+        throw std::runtime_error(fmt::format(
+          "Kompute TensorArchive {} is not a tensor archive", this->mPath));
+    }
+    read(&version, sizeof(version));
+    if (version != ARCHIVE_VERSION) {
+        throw std::runtime_error(
+          fmt::format("Kompute TensorArchive {} has unsupported version {}",
+                      this->mPath,
+                      version));
+    }
+    read(&entryCount, sizeof(entryCount));
+
+    for (uint64_t i = 0; i < entryCount; i++) {
+        EntryFields fields;
+        read(&fields, sizeof(fields));
+
+        // Checked before allocating the shape and name of a corrupt header
+        if (fields.rank * sizeof(uint64_t) + fields.nameSize >
+            this->mMappingSize - position) {
+            throw std::runtime_error(
+              fmt::format("Kompute TensorArchive header of {} is truncated",
+                          this->mPath));
+        }
+
+        Entry entry;
+        entry.dataType = static_cast<Tensor::TensorDataTypes>(fields.dataType);
+        entry.shape.resize(fields.rank);
+        read(entry.shape.data(), fields.rank * sizeof(uint64_t));
+        entry.name.resize(fields.nameSize);
+        read(&entry.name[0], fields.nameSize);
+        entry.offset = fields.offset;
+        entry.size = fields.size;
+
+        if (fields.dataType >
+              static_cast<uint32_t>(Tensor::TensorDataTypes::eInt16) ||
+            entry.offset % KOMPUTE_TENSOR_ARCHIVE_ALIGNMENT ||
+            entry.offset > this->mMappingSize ||
+            entry.size > this->mMappingSize - entry.offset ||
+            entry.size == 0 || entrySize(entry) != entry.size) {
+            throw std::runtime_error(
+              fmt::format("Kompute TensorArchive entry {} of {} is invalid",
+                          entry.name,
+                          this->mPath));
+        }
+
+        this->mEntryIndices[entry.name] = this->mEntries.size();
+        this->mEntries.push_back(entry);
+    }
+}
+
+const std::vector<TensorArchive::Entry>&
+TensorArchive::entries() const
+{
+    return this->mEntries;
+}
+
+bool
+TensorArchive::find(const std::string& name, Entry& entry) const
+{
+    auto it = this->mEntryIndices.find(name);
+    if (it == this->mEntryIndices.end()) {
+        return false;
+    }
+    entry = this->mEntries[it->second];
+    return true;
+}
+
+const void*
+TensorArchive::data(const Entry& entry) const
+{
+    if (!this->mMapping) {
+        throw std::runtime_error(fmt::format(
+          "Kompute TensorArchive {} accessed after being closed", this->mPath));
+    }
+    return this->mMapping + entry.offset;
+}
+
+std::map<std::string, std::shared_ptr<Tensor>>
+TensorArchive::load(std::shared_ptr<Manager> manager,
+                    Tensor::TensorTypes tensorType,
+                    Tensor::HostMemoryTypes hostMemoryType,
+                    const std::vector<std::string>& names) const
+{
+    if (tensorType != Tensor::TensorTypes::eDevice &&
+        tensorType != Tensor::TensorTypes::eHost) {
+        throw std::runtime_error(
+          "Kompute TensorArchive tensors must be of type eDevice or eHost");
+    }
+
+    std::vector<Entry> entries;
+    if (names.empty()) {
+        entries = this->mEntries;
+    } else {
+        for (const std::string& name : names) {
+            Entry entry;
+            if (!this->find(name, entry)) {
+                throw std::runtime_error(
+                  fmt::format("Kompute TensorArchive {} has no entry {}",
+                              this->mPath,
+                              name));
+            }
+            entries.push_back(entry);
+        }
+    }
+
+    KP_LOG_DEBUG("Kompute TensorArchive loading {} entries of {}",
+                 entries.size(),
+                 this->mPath);
+
+    // Each entry is copied once, from the mapped file into the host visible
+    // memory of its tensor, and the device tensors are synced together
+    std::map<std::string, std::shared_ptr<Tensor>> tensors;
+    std::vector<std::shared_ptr<Tensor>> syncTensors;
+    for (const Entry& entry : entries) {
+        std::shared_ptr<Tensor> tensor = manager->tensor(
+          entry.size / Tensor::elementMemorySize(entry.dataType),
+          entry.dataType,
+          tensorType,
+          false,
+          hostMemoryType);
+        tensor->setRawData(this->data(entry));
+        tensor->setName(entry.name);
+        tensors[entry.name] = tensor;
+        syncTensors.push_back(tensor);
+    }
+
+    if (tensorType == Tensor::TensorTypes::eDevice && syncTensors.size()) {
+        manager->sequence()->eval<OpTensorSyncDevice>(syncTensors);
+    }
+
+    return tensors;
+}
+
+void
+TensorArchive::close()
+{
+#if defined(_WIN32)
+    if (this->mMapping) {
+        UnmapViewOfFile(this->mMapping);
+    }
+    if (this->mMappingHandle) {
+        CloseHandle(this->mMappingHandle);
+        this->mMappingHandle = nullptr;
+    }
+    if (this->mFileHandle) {
+        CloseHandle(this->mFileHandle);
+        this->mFileHandle = nullptr;
+    }
+#else
+    if (this->mMapping) {
+        munmap(const_cast<uint8_t*>(this->mMapping), this->mMappingSize);
+    }
+#endif
+    this->mMapping = nullptr;
+    this->mMappingSize = 0;
+}
+
+bool
+TensorArchive::isOpen() const
+{
+    return this->mMapping != nullptr;
+}
+}
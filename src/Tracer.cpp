@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "kompute/Tracer.hpp"
+
+namespace kp {
+
+namespace {
+
+struct TraceEvent
+{
+    std::string name;
+    bool gpu = false;
+    uint32_t track = 0;
+    int64_t startNs = 0;
+    int64_t endNs = 0;
+};
+
+struct TraceState
+{
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    // Small index of each thread, in the order they first recorded a span
+    std::unordered_map<std::thread::id, uint32_t> threads;
+    int64_t startNs = 0;
+};
+
+TraceState&
+traceState()
+{
+    static TraceState state;
+    return state;
+}
+
+void
+writeJsonString(std::ostream& out, const std::string& value)
+{
+    out << '"';
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if ((unsigned char)c < 0x20) {
+            out << fmt::format("\\u{:04x}", (unsigned char)c);
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+}
+
+std::atomic<bool> Tracer::sEnabled{ false };
+
+Tracer::Span::Span(const char* name)
+  : mName(name)
+  , mStartNs(Tracer::isEnabled() ? Tracer::now() : -1)
+{}
+
+Tracer::Span::~Span()
+{
+    if (this->mStartNs >= 0 && Tracer::isEnabled()) {
+        Tracer::recordCpuSpan(this->mName, this->mStartNs, Tracer::now());
+    }
+}
+
+void
+Tracer::start()
+{
+    KP_LOG_DEBUG("Kompute Tracer started");
+
+    TraceState& state = traceState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.events.clear();
+    state.threads.clear();
+    state.startNs = Tracer::now();
+    sEnabled.store(true, std::memory_order_relaxed);
+}
+
+void
+Tracer::stop()
+{
+    KP_LOG_DEBUG("Kompute Tracer stopped");
+
+    sEnabled.store(false, std::memory_order_relaxed);
+}
+
+int64_t
+Tracer::now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void
+Tracer::recordCpuSpan(const char* name, int64_t startNs, int64_t endNs)
+{
+    TraceState& state = traceState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    auto thread = state.threads.find(std::this_thread::get_id());
+    if (thread == state.threads.end()) {
+        thread = state.threads
+                   .emplace(std::this_thread::get_id(), state.threads.size())
+                   .first;
+    }
+
+    TraceEvent event;
+    event.name = name;
+    event.track = thread->second;
+    event.startNs = startNs;
+    event.endNs = endNs;
+    state.events.push_back(event);
+}
+
+void
+Tracer::recordGpuSpan(const std::string& name,
+                      uint32_t queueFamilyIndex,
+                      int64_t startNs,
+                      int64_t endNs)
+{
+    TraceState& state = traceState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    TraceEvent event;
+    event.name = name;
+    event.gpu = true;
+    event.track = queueFamilyIndex;
+    event.startNs = startNs;
+    event.endNs = endNs;
+    state.events.push_back(event);
+}
+
+uint64_t
+Tracer::eventCount()
+{
+    TraceState& state = traceState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.events.size();
+}
+
+std::string
+Tracer::chromeTrace()
+{
+    TraceState& state = traceState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    // The CPU spans are in process 0 with a track per thread, and the GPU
+    // spans in process 1 with a track per queue family
+    std::set<uint32_t> queueFamilies;
+    std::ostringstream out;
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,"
+           "\"args\":{\"name\":\"Kompute CPU\"}},";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,"
+           "\"args\":{\"name\":\"Kompute GPU\"}}";
+    for (const auto& thread : state.threads) {
+        out << fmt::format(",{{\"name\":\"thread_name\",\"ph\":\"M\","
+                           "\"pid\":0,\"tid\":{},\"args\":{{\"name\":"
+                           "\"Thread {}\"}}}}",
+                           thread.second,
+                           thread.second);
+    }
+    for (const TraceEvent& event : state.events) {
+        if (event.gpu) {
+            queueFamilies.insert(event.track);
+        }
+        // Timestamps are in microseconds, relative to the start of the
+        // trace
+        out << ",{\"name\":";
+        writeJsonString(out, event.name);
+        out << fmt::format(",\"cat\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},"
+                           "\"dur\":{:.3f},\"pid\":{},\"tid\":{}}}",
+                           event.gpu ? "gpu" : "cpu",
+                           (event.startNs - state.startNs) / 1000.0,
+                           (event.endNs - event.startNs) / 1000.0,
+                           event.gpu ? 1 : 0,
+                           event.track);
+    }
+    for (uint32_t queueFamily : queueFamilies) {
+        out << fmt::format(",{{\"name\":\"thread_name\",\"ph\":\"M\","
+                           "\"pid\":1,\"tid\":{},\"args\":{{\"name\":"
+                           "\"Queue family {}\"}}}}",
+                           queueFamily,
+                           queueFamily);
+    }
+    out << "]}";
+
+    return out.str();
+}
+
+void
+Tracer::writeChromeTrace(const std::string& path)
+{
+    KP_LOG_DEBUG("Kompute Tracer writing trace to {}", path);
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error(
+          fmt::format("Kompute Tracer could not open {}", path));
+    }
+    file << Tracer::chromeTrace();
+}
+
+}
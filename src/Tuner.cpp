@@ -0,0 +1,282 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "kompute/Tuner.hpp"
+#include "kompute/operations/OpAlgoDispatch.hpp"
+
+namespace kp {
+
+Tuner::Tuner(std::shared_ptr<Manager> manager,
+             const std::string& databasePath,
+             uint32_t warmup,
+             uint32_t repetitions)
+  : mBenchmark(manager, warmup, repetitions)
+{
+    KP_LOG_DEBUG("Kompute Tuner constructor with database '{}'",
+                 databasePath);
+
+    this->mManager = manager;
+    this->mDatabasePath = databasePath;
+
+    vk::PhysicalDeviceProperties properties =
+      this->mManager->getDeviceProperties();
+    this->mDeviceKey = fmt::format("{:04x}:{:04x}:{}",
+                                   properties.vendorID,
+                                   properties.deviceID,
+                                   properties.driverVersion);
+
+    if (databasePath.size()) {
+        this->load(databasePath);
+    }
+}
+
+Tuner::Result
+Tuner::tune(std::shared_ptr<Algorithm> algorithm,
+            const std::string& name,
+            const std::vector<uint32_t>& shape,
+            const std::vector<Candidate>& candidates,
+            bool retune)
+{
+    KP_LOG_DEBUG("Kompute Tuner tuning '{}' with {} candidates",
+                 name,
+                 candidates.size());
+
+    if (!algorithm) {
+        throw std::runtime_error("Kompute Tuner algorithm is null");
+    }
+    if (name.empty() || name.find_first_of("\t\n") != std::string::npos) {
+        throw std::runtime_error(fmt::format(
+          "Kompute Tuner name '{}' must be non empty without tabs or newlines",
+          name));
+    }
+
+    Result result;
+    if (!retune && this->find(name, shape, result)) {
+        KP_LOG_DEBUG("Kompute Tuner using the choice of the database for "
+                     "'{}'",
+                     name);
+        this->apply(algorithm, result.candidate);
+        return result;
+    }
+
+    if (candidates.empty()) {
+        throw std::runtime_error(fmt::format(
+          "Kompute Tuner has no choice nor candidates for '{}'", name));
+    }
+
+    std::shared_ptr<Sequence> sequence = this->mManager->sequence(0, 1);
+    sequence->record<OpAlgoDispatch>(algorithm);
+
+    bool found = false;
+    for (const Candidate& candidate : candidates) {
+        try {
+            this->apply(algorithm, candidate);
+        } catch (const std::exception& e) {
+            KP_LOG_WARN("Kompute Tuner skipping candidate of '{}' which "
+                        "failed to build: {}",
+                        name,
+                        e.what());
+            continue;
+        }
+        if (!this->isSupported(algorithm)) {
+            KP_LOG_DEBUG("Kompute Tuner skipping candidate of '{}' exceeding "
+                         "the limits of the device",
+                         name);
+            continue;
+        }
+
+        sequence->rerecord();
+        Benchmark::Result timing = this->mBenchmark.run(sequence);
+
+        KP_LOG_DEBUG("Kompute Tuner candidate of '{}' ran in {} ns",
+                     name,
+                     timing.medianNs);
+
+        if (!found || timing.medianNs < result.medianNs) {
+            result.candidate = candidate;
+            result.medianNs = timing.medianNs;
+            found = true;
+        }
+    }
+
+    sequence->destroy();
+
+    if (!found) {
+        throw std::runtime_error(fmt::format(
+          "Kompute Tuner found no candidate of '{}' supported by the device",
+          name));
+    }
+
+    this->apply(algorithm, result.candidate);
+    this->mEntries[this->key(name, shape)] = result;
+
+    KP_LOG_INFO("Kompute Tuner chose workgroup ({}, {}, {}) for '{}' "
+                "running in {} ns",
+                result.candidate.workgroup[0],
+                result.candidate.workgroup[1],
+                result.candidate.workgroup[2],
+                name,
+                result.medianNs);
+
+    if (this->mDatabasePath.size()) {
+        this->save(this->mDatabasePath);
+    }
+
+    return result;
+}
+
+bool
+Tuner::find(const std::string& name,
+            const std::vector<uint32_t>& shape,
+            Result& result) const
+{
+    auto it = this->mEntries.find(this->key(name, shape));
+    if (it == this->mEntries.end()) {
+        return false;
+    }
+    result = it->second;
+    result.cached = true;
+    return true;
+}
+
+void
+Tuner::load(const std::string& path)
+{
+    KP_LOG_DEBUG("Kompute Tuner loading database {}", path);
+
+    std::ifstream file(path);
+    if (!file) {
+        KP_LOG_DEBUG("Kompute Tuner database {} not found, starting empty",
+                     path);
+        return;
+    }
+
+    // Each line holds the device, name, shape, workgroup, specialization
+    // constants and median time of a choice, separated by tabs
+    std::string line;
+    uint32_t loaded = 0;
+    while (std::getline(file, line)) {
+        if (line.empty()) {
+            continue;
+        }
+
+        std::vector<std::string> fields;
+        std::stringstream lineStream(line);
+        std::string field;
+        while (std::getline(lineStream, field, '\t')) {
+            fields.push_back(field);
+        }
+
+        Result result;
+        std::stringstream workgroup(fields.size() == 6 ? fields[3] : "");
+        std::stringstream constants(fields.size() == 6 ? fields[4] : "");
+        std::stringstream median(fields.size() == 6 ? fields[5] : "");
+        workgroup >> result.candidate.workgroup[0] >>
+          result.candidate.workgroup[1] >> result.candidate.workgroup[2];
+        median >> result.medianNs;
+        if (fields.size() != 6 || workgroup.fail() || median.fail()) {
+            KP_LOG_WARN("Kompute Tuner skipping malformed line of database "
+                        "{}: '{}'",
+                        path,
+                        line);
+            continue;
+        }
+        uint32_t value;
+        while (constants >> value) {
+            result.candidate.specializationConstants.push_back(value);
+        }
+
+        this->mEntries[fields[0] + '\t' + fields[1] + '\t' + fields[2]] =
+          result;
+        loaded++;
+    }
+
+    KP_LOG_INFO("Kompute Tuner loaded {} choices from {}", loaded, path);
+}
+
+void
+Tuner::save(const std::string& path)
+{
+    std::string destination = path.size() ? path : this->mDatabasePath;
+
+    KP_LOG_DEBUG("Kompute Tuner saving database to {}", destination);
+
+    if (destination.empty()) {
+        throw std::runtime_error(
+          "Kompute Tuner save requires a path without a database path");
+    }
+
+    std::ofstream file(destination, std::ios::trunc);
+    file.precision(std::numeric_limits<double>::max_digits10);
+    for (const auto& entry : this->mEntries) {
+        const Candidate& candidate = entry.second.candidate;
+        file << entry.first << '\t' << candidate.workgroup[0] << ' '
+             << candidate.workgroup[1] << ' ' << candidate.workgroup[2]
+             << '\t';
+        for (size_t i = 0; i < candidate.specializationConstants.size(); i++) {
+            file << (i ? " " : "") << candidate.specializationConstants[i];
+        }
+        file << '\t' << entry.second.medianNs << '\n';
+    }
+    if (!file) {
+        throw std::runtime_error(fmt::format(
+          "Kompute Tuner failed to write database to {}", destination));
+    }
+}
+
+size_t
+Tuner::size() const
+{
+    return this->mEntries.size();
+}
+
+const std::string&
+Tuner::deviceKey() const
+{
+    return this->mDeviceKey;
+}
+
+std::string
+Tuner::key(const std::string& name, const std::vector<uint32_t>& shape) const
+{
+    std::string shapeKey;
+    for (size_t i = 0; i < shape.size(); i++) {
+        shapeKey += (i ? "x" : "") + std::to_string(shape[i]);
+    }
+    return this->mDeviceKey + '\t' + name + '\t' + shapeKey;
+}
+
+bool
+Tuner::isSupported(std::shared_ptr<Algorithm> algorithm) const
+{
+    vk::PhysicalDeviceLimits limits =
+      this->mManager->getDeviceProperties().limits;
+
+    const Workgroup& workgroup = algorithm->getWorkgroup();
+    for (uint32_t i = 0; i < 3; i++) {
+        if (workgroup[i] > limits.maxComputeWorkGroupCount[i]) {
+            return false;
+        }
+    }
+
+    // Only the local sizes specialized by the algorithm are known
+    uint32_t localSizeX = algorithm->getLocalSizeX();
+    return localSizeX <= limits.maxComputeWorkGroupSize[0] &&
+           localSizeX <= limits.maxComputeWorkGroupInvocations;
+}
+
+void
+Tuner::apply(std::shared_ptr<Algorithm> algorithm, const Candidate& candidate)
+{
+    // Copied as the rebuild replaces them
+    std::vector<std::shared_ptr<Tensor>> tensors = algorithm->getTensors();
+    std::vector<uint32_t> spirv = algorithm->getSpirv();
+
+    algorithm->rebuild<uint32_t, float>(
+      tensors, spirv, candidate.workgroup, candidate.specializationConstants);
+}
+
+}
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+
+#include "kompute/WorkerPool.hpp"
+
+namespace kp {
+
+WorkerPool::WorkerPool(uint32_t threadCount)
+{
+    if (!threadCount) {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    KP_LOG_DEBUG("Kompute WorkerPool starting {} threads", threadCount);
+
+    for (uint32_t i = 0; i < threadCount; i++) {
+        this->mThreads.push_back(std::thread(&WorkerPool::run, this));
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    KP_LOG_DEBUG("Kompute WorkerPool destructor started");
+
+    this->destroy();
+}
+
+std::shared_future<void>
+WorkerPool::submit(std::function<void()> task)
+{
+    std::packaged_task<void()> packagedTask(task);
+    std::shared_future<void> future = packagedTask.get_future().share();
+
+    {
+        std::lock_guard<std::mutex> lock(this->mMutex);
+        if (this->mStopping) {
+            throw std::runtime_error(
+              "Kompute WorkerPool submit called after destroy");
+        }
+        this->mTasks.push_back(std::move(packagedTask));
+    }
+    this->mCondition.notify_one();
+
+    return future;
+}
+
+uint32_t
+WorkerPool::threadCount()
+{
+    return this->mThreads.size();
+}
+
+void
+WorkerPool::destroy()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mMutex);
+        if (this->mStopping) {
+            return;
+        }
+        this->mStopping = true;
+    }
+    this->mCondition.notify_all();
+
+    KP_LOG_DEBUG("Kompute WorkerPool joining threads");
+    for (std::thread& thread : this->mThreads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+    this->mThreads.clear();
+}
+
+void
+WorkerPool::run()
+{
+    while (true) {
+        std::packaged_task<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(this->mMutex);
+            this->mCondition.wait(lock, [this]() {
+                return this->mStopping || this->mTasks.size();
+            });
+
+            // Pending tasks are run before stopping
+            if (this->mTasks.empty()) {
+                return;
+            }
+
+            task = std::move(this->mTasks.front());
+            this->mTasks.pop_front();
+        }
+
+        // Exceptions are stored in the future of the task
+        task();
+    }
+}
+
+}
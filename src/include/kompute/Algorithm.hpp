@@ -1,9 +1,33 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <type_traits>
+
 #include "kompute/Core.hpp"
 
+#include "kompute/DebugUtils.hpp"
+#include "kompute/DescriptorAllocator.hpp"
+#include "kompute/HostAllocator.hpp"
+#include "kompute/Metrics.hpp"
+#include "kompute/ShaderCache.hpp"
 #include "kompute/Tensor.hpp"
+#include "kompute/Tracer.hpp"
+#include "kompute/WorkerPool.hpp"
+
+// Bytes of push constants stored inline by algorithms and dispatches, which
+// is the largest maxPushConstantsSize of common devices
+#ifndef KOMPUTE_MAX_PUSH_CONSTANTS_SIZE
+#define KOMPUTE_MAX_PUSH_CONSTANTS_SIZE 256
+#endif
+
+// Local size of shaders with a specialized local_size_x when the workgroup is
+// computed automatically, rounded to a multiple of the subgroup size
+#ifndef KOMPUTE_DEFAULT_LOCAL_SIZE_X
+#define KOMPUTE_DEFAULT_LOCAL_SIZE_X 64
+#endif
 
 namespace kp {
 
@@ -14,6 +38,15 @@ namespace kp {
 class Algorithm
 {
   public:
+    /**
+     * How the tensors of the algorithm are passed to its shader.
+     */
+    enum class BindingModes
+    {
+        eDescriptors,     ///< Bound to one descriptor set, a binding each
+        eDeviceAddresses, ///< Addresses at the start of the push constants
+    };
+
     /**
      *  Main constructor for algorithm with configuration parameters to create
      *  the underlying resources.
@@ -23,13 +56,47 @@ class Algorithm
      * resources
      *  @param spirv (optional) The spirv code to use to create the algorithm
      *  @param workgroup (optional) The kp::Workgroup to use for the dispatch
-     * which defaults to kp::Workgroup(tensor[0].size(), 1, 1) if not set.
+     * which defaults to kp::Workgroup(tensor[0].size(), 1, 1) if not set, or
+     * to enough workgroups of the local size for tensor[0].size() invocations
+     * if the local_size_x of the shader is a specialization constant.
      *  @param specializationConstants (optional) The templatable param is to be used to
      * initialize the specialization constants which cannot be changed once set.
      *  @param pushConstants (optional) This templatable param is to be used when
      * initializing the pipeline, which set the size of the push constants -
      * these can be modified but all new values must have the same data type and length
      * as otherwise it will result in errors.
+     *  @param pipelineCache (optional) The pipeline cache to create the
+     * pipeline with, which is not owned by the algorithm. An owned cache is
+     * created for the algorithm if not provided.
+     *  @param shaderCache (optional) The cache to share the shader module,
+     * pipeline and layouts through with the algorithms built from the same
+     * spirv, specialization constants, push constant size and descriptor
+     * types. The algorithm creates its own if not provided.
+     *  @param descriptorAllocator (optional) The allocator to allocate the
+     * descriptor set from. The algorithm creates a descriptor pool of its own
+     * if not provided.
+     *  @param defaultLocalSize (optional) The local size to specialize the
+     * local_size_x_id of the shader with when its id is not one of the
+     * specialization constants provided, which is chosen for the device by
+     * the manager and defaults to KOMPUTE_DEFAULT_LOCAL_SIZE_X.
+     *  @param debugUtils (optional) Functions of VK_EXT_debug_utils to name
+     * the pipeline of the algorithm with, see setName
+     *  @param metrics (optional) Counters to add the pipelines created or
+     * reused and the descriptor sets allocated by the algorithm to
+     *  @param hostAllocator (optional) Host allocation callbacks to create
+     * and destroy the pipeline resources of the algorithm with
+     *  @param bindingMode (optional) How the tensors are passed to the
+     * shader. With BindingModes::eDeviceAddresses no descriptor set is
+     * allocated, and the device address of each tensor is pushed as a 64 bit
+     * value at the start of the push constants, followed by the push
+     * constants of the algorithm, so the shader declares the tensors as
+     * GL_EXT_buffer_reference members of its push constant block. This
+     * requires the manager to have buffer device addresses enabled.
+     *  @param maxPushConstantsSize (optional) The maxPushConstantsSize limit
+     * of the device, which the manager provides and which may be as low as
+     * 128 bytes. The push constants, including the tensor addresses, are
+     * checked against it and against KOMPUTE_MAX_PUSH_CONSTANTS_SIZE, or
+     * only against the latter if zero.
      */
     template<typename S = float, typename P = float>
     Algorithm(std::shared_ptr<vk::Device> device,
@@ -37,22 +104,46 @@ class Algorithm
               const std::vector<uint32_t>& spirv = {},
               const Workgroup& workgroup = {},
               const std::vector<S>& specializationConstants = {},
-              const std::vector<P>& pushConstants = {})
+              const std::vector<P>& pushConstants = {},
+              std::shared_ptr<vk::PipelineCache> pipelineCache = nullptr,
+              std::shared_ptr<ShaderCache> shaderCache = nullptr,
+              std::shared_ptr<DescriptorAllocator> descriptorAllocator = nullptr,
+              uint32_t defaultLocalSize = 0,
+              std::shared_ptr<DebugUtils> debugUtils = nullptr,
+              std::shared_ptr<Metrics> metrics = nullptr,
+              std::shared_ptr<HostAllocator> hostAllocator = nullptr,
+              BindingModes bindingMode = BindingModes::eDescriptors,
+              uint32_t maxPushConstantsSize = 0)
     {
         KP_LOG_DEBUG("Kompute Algorithm Constructor with device");
 
         this->mDevice = device;
+        this->mBindingMode = bindingMode;
+        if (maxPushConstantsSize) {
+            this->mMaxPushConstantsSize = std::min<uint32_t>(
+              maxPushConstantsSize, KOMPUTE_MAX_PUSH_CONSTANTS_SIZE);
+        }
+        this->mDebugUtils = debugUtils;
+        this->mMetrics = metrics;
+        this->mHostAllocator = hostAllocator;
+        this->mPipelineCache = pipelineCache;
+        this->mShaderCache = shaderCache;
+        this->mDescriptorAllocator = descriptorAllocator;
+        this->mDefaultLocalSize =
+          defaultLocalSize ? defaultLocalSize : KOMPUTE_DEFAULT_LOCAL_SIZE_X;
 
         if (tensors.size() && spirv.size()) {
-            KP_LOG_INFO("Kompute Algorithm initialising with tensor size: {} and "
-                        "spirv size: {}",
-                        tensors.size(),
-                        spirv.size());
+            KP_LOG_DEBUG(
+              "Kompute Algorithm initialising with tensor size: {} and "
+              "spirv size: {}",
+              tensors.size(),
+              spirv.size());
             this->rebuild(
               tensors, spirv, workgroup, specializationConstants, pushConstants);
         } else {
-            KP_LOG_INFO("Kompute Algorithm constructor with empty tensors and or "
-                        "spirv so not rebuilding vulkan components");
+            KP_LOG_DEBUG(
+              "Kompute Algorithm constructor with empty tensors and or "
+              "spirv so not rebuilding vulkan components");
         }
     }
 
@@ -78,49 +169,50 @@ class Algorithm
                  const std::vector<S>& specializationConstants = {},
                  const std::vector<P>& pushConstants = {})
     {
-        KP_LOG_DEBUG("Kompute Algorithm rebuild started");
+        Tracer::Span span("Algorithm::rebuild");
 
-        this->mTensors = tensors;
-        this->mSpirv = spirv;
-
-        if (specializationConstants.size()) {
-            if (this->mSpecializationConstantsData) {
-                free(this->mSpecializationConstantsData);
-            }
-            uint32_t memorySize = sizeof(decltype(specializationConstants.back()));
-            uint32_t size = specializationConstants.size();
-            uint32_t totalSize = size * memorySize;
-            this->mSpecializationConstantsData = malloc(totalSize);
-            memcpy(this->mSpecializationConstantsData, specializationConstants.data(), totalSize);
-            this->mSpecializationConstantsDataTypeMemorySize = memorySize;
-            this->mSpecializationConstantsSize = size;
-        }
-
-        if (pushConstants.size()) {
-            if (this->mPushConstantsData) {
-                free(this->mPushConstantsData);
-            }
-            uint32_t memorySize = sizeof(decltype(pushConstants.back()));
-            uint32_t size = pushConstants.size();
-            uint32_t totalSize = size * memorySize;
-            this->mPushConstantsData = malloc(totalSize);
-            memcpy(this->mPushConstantsData, pushConstants.data(), totalSize);
-            this->mPushConstantsDataTypeMemorySize = memorySize;
-            this->mPushConstantsSize = size;
-        }
-
-        this->setWorkgroup(workgroup,
-                           this->mTensors.size() ? this->mTensors[0]->size() : 1);
-
-        // Descriptor pool is created first so if available then destroy all before
-        // rebuild
-        if (this->isInit()) {
-            this->destroy();
-        }
+        this->awaitBuild();
+        this->build(
+          tensors, spirv, workgroup, specializationConstants, pushConstants);
+    }
 
-        this->createParameters();
-        this->createShaderModule();
-        this->createPipeline();
+    /**
+     * Rebuild function which reconstructs the underlying resources of the
+     * algorithm on a thread of the worker pool, returning without waiting for
+     * the pipeline to be compiled. The functions of the algorithm wait for
+     * the rebuild to complete when called, and rethrow the exception thrown
+     * by the rebuild if any.
+     *
+     *  @param workerPool The worker pool to run the rebuild on
+     *  @param tensors The tensors to use to create the descriptor resources
+     *  @param spirv The spirv code to use to create the algorithm
+     *  @param workgroup (optional) The kp::Workgroup to use for the dispatch
+     * which defaults to kp::Workgroup(tensor[0].size(), 1, 1) if not set.
+     *  @param specializationConstants (optional) The std::vector to use to
+     * initialize the specialization constants.
+     *  @param pushConstants (optional) The std::vector to use when
+     * initializing the pipeline, which set the size of the push constants.
+     */
+    template<typename S = float, typename P = float>
+    void rebuildAsync(WorkerPool& workerPool,
+                      const std::vector<std::shared_ptr<Tensor>>& tensors,
+                      const std::vector<uint32_t>& spirv,
+                      const Workgroup& workgroup = {},
+                      const std::vector<S>& specializationConstants = {},
+                      const std::vector<P>& pushConstants = {})
+    {
+        this->awaitBuild();
+
+        // The destructor waits for the build so the algorithm outlives it
+        this->mBuild = workerPool.submit([this,
+                                          tensors,
+                                          spirv,
+                                          workgroup,
+                                          specializationConstants,
+                                          pushConstants]() {
+            this->build(
+              tensors, spirv, workgroup, specializationConstants, pushConstants);
+        });
     }
 
     /**
@@ -137,9 +229,36 @@ class Algorithm
      */
     void recordDispatch(const vk::CommandBuffer& commandBuffer);
 
+    /**
+     * Records a dispatch with the workgroup counts provided instead of the
+     * workgroup of the algorithm, which allows the passes of a multi pass
+     * operation to dispatch different grids of the same pipeline.
+     *
+     * @param commandBuffer Command buffer to record the algorithm resources to
+     * @param workgroup The workgroup counts of the dispatch, which are used as
+     * they are so a count of zero records an empty dispatch
+     */
+    void recordDispatch(const vk::CommandBuffer& commandBuffer,
+                        const Workgroup& workgroup);
+
+    /**
+     * Records an indirect dispatch which reads the workgroup counts from a
+     * VkDispatchIndirectCommand stored in a tensor when the command buffer
+     * is executed, instead of using the workgroup of the algorithm.
+     *
+     * @param commandBuffer Command buffer to record the algorithm resources to
+     * @param tensor Tensor holding the dispatch command
+     * @param offset Offset in bytes of the dispatch command in the tensor
+     */
+    void recordDispatchIndirect(const vk::CommandBuffer& commandBuffer,
+                                std::shared_ptr<Tensor> tensor,
+                                vk::DeviceSize offset = 0);
+
     /**
      * Records command that binds the "core" algorithm components which consist
-     * of binding the pipeline and binding the descriptorsets.
+     * of binding the pipeline and binding the descriptorsets. The descriptors
+     * are refreshed first if any of the tensors has been rebuilt since they
+     * were last written.
      *
      * @param commandBuffer Command buffer to record the algorithm resources to
      */
@@ -155,6 +274,21 @@ class Algorithm
      */
     void recordBindPush(const vk::CommandBuffer& commandBuffer);
 
+    /**
+     * Records command that binds push constants provided as raw memory
+     * instead of the push constants stored in the algorithm, which allows
+     * recording several dispatches with different push constants without
+     * updating the algorithm in between.
+     *
+     * @param commandBuffer Command buffer to record the algorithm resources to
+     * @param data The raw data of the push constants
+     * @param size The size of the data in bytes, which has to be the memory
+     * size of the push constants provided during initialization
+     */
+    void recordPushConstants(const vk::CommandBuffer& commandBuffer,
+                             const void* data,
+                             uint32_t size);
+
     /**
      * function that checks all the gpu resource components to verify if these
      * have been created and returns true if all are valid.
@@ -169,7 +303,8 @@ class Algorithm
      * @param workgroup The kp::Workgroup value to use to update the algorithm.
      * It must have a value greater than 1 on the x value (index 1) otherwise it
      * will be initialized on the size of the first tensor (ie.
-     * this->mTensor[0]->size())
+     * this->mTensor[0]->size()), divided by the local size rounding up if the
+     * local size of the shader is specialized
      */
     void setWorkgroup(const Workgroup& workgroup, uint32_t minSize = 1);
     /**
@@ -189,6 +324,54 @@ class Algorithm
         this->setPushConstants(pushConstants.data(), size, memorySize);
     }
 
+    /**
+     * Sets the push constants from a fixed size array, whose size is checked
+     * against the inline storage of the push constants at compile time.
+     *
+     * @param pushConstants The push constants to use in the next bindPush(...)
+     * calls, of the same total size as the ones created during initialization.
+     */
+    template<typename T, size_t N>
+    void setPushConstants(const std::array<T, N>& pushConstants)
+    {
+        static_assert(sizeof(T) * N <= KOMPUTE_MAX_PUSH_CONSTANTS_SIZE,
+                      "Kompute Algorithm push constants exceed "
+                      "KOMPUTE_MAX_PUSH_CONSTANTS_SIZE");
+
+        this->setPushConstants(pushConstants.data(), N, sizeof(T));
+    }
+
+    /**
+     * Writes a single push constant in place for the next bindPush(...)
+     * calls.
+     *
+     * @param index The index of the push constant to write
+     * @param value The value of the push constant, which must be of the size
+     * of the push constants created during initialization
+     */
+    template<typename T>
+    void setPushConstant(uint32_t index, const T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "Kompute Algorithm push constants must be trivially "
+                      "copyable");
+
+        this->awaitBuild();
+
+        if (sizeof(T) != this->mPushConstantsDataTypeMemorySize ||
+            index >= this->mPushConstantsSize) {
+            throw std::runtime_error(
+              fmt::format("Kompute Algorithm push constant {} of {} bytes "
+                          "provided but there are {} of {} bytes",
+                          index,
+                          sizeof(T),
+                          this->mPushConstantsSize,
+                          this->mPushConstantsDataTypeMemorySize));
+        }
+
+        memcpy(this->mPushConstantsData + index * sizeof(T), &value, sizeof(T));
+    }
+
     /**
      * Sets the push constants to the new value provided to use in the next
      * bindPush() with the raw memory block location and memory size to be used.
@@ -197,7 +380,9 @@ class Algorithm
      * @param size The number of data elements provided in the data
      * @param memorySize The memory size of each of the data elements in bytes.
      */
-    void setPushConstants(void* data, uint32_t size, uint32_t memorySize) {
+    void setPushConstants(const void* data, uint32_t size, uint32_t memorySize) {
+
+        this->awaitBuild();
 
         uint32_t totalSize = memorySize * size;
         uint32_t previousTotalSize = this->mPushConstantsDataTypeMemorySize * this->mPushConstantsSize;
@@ -209,11 +394,8 @@ class Algorithm
                           totalSize,
                           previousTotalSize));
         }
-        if (this->mPushConstantsData) {
-            free(this->mPushConstantsData);
-        }
 
-        this->mPushConstantsData = malloc(totalSize);
+        // The push constants are written in place without reallocating
         memcpy(this->mPushConstantsData, data, totalSize);
         this->mPushConstantsDataTypeMemorySize = memorySize;
         this->mPushConstantsSize = size;
@@ -227,6 +409,15 @@ class Algorithm
      * as the ones created during initialization.
      */
     const Workgroup& getWorkgroup();
+
+    /**
+     * Gets the local size the local_size_x_id of the shader was specialized
+     * with, which the group count of automatic workgroups is based on.
+     *
+     * @returns The specialized local size, or 0 if the local size of the
+     * shader is not specialized by the algorithm
+     */
+    uint32_t getLocalSizeX();
     /**
      * Gets the specialization constants of the current algorithm.
      *
@@ -235,6 +426,7 @@ class Algorithm
     template<typename T>
     const std::vector<T> getSpecializationConstants()
     {
+        this->awaitBuild();
         return { (T*)this->mSpecializationConstantsData,
             ((T*)this->mSpecializationConstantsData) + this->mSpecializationConstantsSize };
     }
@@ -246,6 +438,7 @@ class Algorithm
     template<typename T>
     const std::vector<T> getPushConstants()
     {
+        this->awaitBuild();
         return { (T*)this->mPushConstantsData,
             ((T*)this->mPushConstantsData) + this->mPushConstantsSize };
     }
@@ -256,12 +449,64 @@ class Algorithm
      */
     const std::vector<std::shared_ptr<Tensor>>& getTensors();
 
+    /**
+     * Gets the SPIR-V the algorithm was built from, which allows rebuilding
+     * it with other workgroups or specialization constants.
+     *
+     * @returns The SPIR-V of the shader of the algorithm.
+     */
+    const std::vector<uint32_t>& getSpirv();
+
+    /**
+     * Binds other tensors to the algorithm by rewriting its descriptor set,
+     * or only the device addresses it pushes with
+     * BindingModes::eDeviceAddresses, keeping the shader module and pipeline.
+     * The tensors must match the number of bindings and the descriptor type
+     * of each binding. Sequences that recorded the algorithm must not be
+     * running, and need to be recorded again to use the new tensors.
+     *
+     * @param tensors The tensors to bind, one per binding
+     */
+    void setTensors(const std::vector<std::shared_ptr<Tensor>>& tensors);
+
+    /**
+     * Sets the name of the algorithm, which names its pipeline, pipeline
+     * layout and descriptor set through VK_EXT_debug_utils so they can be
+     * identified in captures of debugging and profiling tools. The resources
+     * keep the name through rebuilds. Pipelines shared through the shader
+     * cache take the name of the last algorithm named.
+     *
+     * @param name The name of the algorithm
+     */
+    void setName(const std::string& name);
+
+    /**
+     * Retrieve the name of the algorithm set with setName.
+     *
+     * @return Name of the algorithm, empty if it was not named
+     */
+    const std::string& name();
+
+    /**
+     * Retrieve how the tensors of the algorithm are passed to its shader.
+     *
+     * @return The binding mode the algorithm was created with
+     */
+    BindingModes bindingMode();
+
     void destroy();
 
   private:
     // -------------- NEVER OWNED RESOURCES
     std::shared_ptr<vk::Device> mDevice;
     std::vector<std::shared_ptr<Tensor>> mTensors;
+    std::vector<uint64_t> mTensorGenerations;
+    std::vector<vk::DeviceAddress> mTensorAddresses;
+    std::shared_ptr<ShaderCache> mShaderCache;
+    std::shared_ptr<DescriptorAllocator> mDescriptorAllocator;
+    std::shared_ptr<DebugUtils> mDebugUtils;
+    std::shared_ptr<Metrics> mMetrics;
+    std::shared_ptr<HostAllocator> mHostAllocator;
 
     // -------------- OPTIONALLY OWNED RESOURCES
     std::shared_ptr<vk::DescriptorSetLayout> mDescriptorSetLayout;
@@ -284,17 +529,98 @@ class Algorithm
     void* mSpecializationConstantsData = nullptr;
     uint32_t mSpecializationConstantsDataTypeMemorySize = 0;
     uint32_t mSpecializationConstantsSize = 0;
-    void* mPushConstantsData = nullptr;
+    alignas(16) uint8_t mPushConstantsData[KOMPUTE_MAX_PUSH_CONSTANTS_SIZE];
     uint32_t mPushConstantsDataTypeMemorySize = 0;
     uint32_t mPushConstantsSize = 0;
+    uint32_t mMaxPushConstantsSize = KOMPUTE_MAX_PUSH_CONSTANTS_SIZE;
     Workgroup mWorkgroup;
+    uint32_t mDefaultLocalSize = KOMPUTE_DEFAULT_LOCAL_SIZE_X;
+    uint32_t mLocalSizeX = 0;
+    uint32_t mLocalSizeXSpecializationId = 0;
+    std::string mName;
+    BindingModes mBindingMode = BindingModes::eDescriptors;
+    // Pending asynchronous build, valid until awaited
+    std::shared_future<void> mBuild;
+
+    // Build functions, run on the thread of the worker pool when rebuilding
+    // asynchronously
+    template<typename S, typename P>
+    void build(const std::vector<std::shared_ptr<Tensor>>& tensors,
+               const std::vector<uint32_t>& spirv,
+               const Workgroup& workgroup,
+               const std::vector<S>& specializationConstants,
+               const std::vector<P>& pushConstants)
+    {
+        KP_LOG_DEBUG("Kompute Algorithm build started");
+
+        this->mTensors = tensors;
+        this->mSpirv = spirv;
+
+        if (specializationConstants.size()) {
+            if (this->mSpecializationConstantsData) {
+                free(this->mSpecializationConstantsData);
+            }
+            uint32_t memorySize = sizeof(decltype(specializationConstants.back()));
+            uint32_t size = specializationConstants.size();
+            uint32_t totalSize = size * memorySize;
+            this->mSpecializationConstantsData = malloc(totalSize);
+            memcpy(this->mSpecializationConstantsData, specializationConstants.data(), totalSize);
+            this->mSpecializationConstantsDataTypeMemorySize = memorySize;
+            this->mSpecializationConstantsSize = size;
+        }
+
+        if (pushConstants.size()) {
+            uint32_t memorySize = sizeof(decltype(pushConstants.back()));
+            uint32_t size = pushConstants.size();
+            uint32_t totalSize = size * memorySize;
+            // Devices may only guarantee the 128 bytes required by the spec
+            if (totalSize > this->mMaxPushConstantsSize) {
+                throw std::runtime_error(fmt::format(
+                  "Kompute Algorithm push constants of {} bytes exceed the "
+                  "maximum of {} bytes of the device",
+                  totalSize,
+                  this->mMaxPushConstantsSize));
+            }
+            memcpy(this->mPushConstantsData, pushConstants.data(), totalSize);
+            this->mPushConstantsDataTypeMemorySize = memorySize;
+            this->mPushConstantsSize = size;
+        }
+
+        this->updateLocalSize();
+        this->updateWorkgroup(
+          workgroup,
+          this->mTensors.size()
+            ? static_cast<uint32_t>(this->mTensors[0]->size())
+            : 1);
+
+        // Descriptor pool is created first so if available then destroy all before
+        // rebuild
+        if (this->hasResources()) {
+            this->destroyResources();
+        }
+
+        this->createPipelineResources();
+        this->createParameters();
+        this->setObjectNames();
+    }
+
+    void awaitBuild();
+    bool hasResources();
+    void destroyResources();
+    void updateLocalSize();
+    void updateWorkgroup(const Workgroup& workgroup, uint32_t minSize);
+    void setObjectNames();
 
     // Create util functions
+    void createPipelineResources();
+    void createDescriptorSetLayout();
     void createShaderModule();
     void createPipeline();
 
     // Parameters
     void createParameters();
+    void updateDescriptors();
+    uint32_t pushConstantsOffset();
 };
 
 } // End namespace kp
@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <functional>
+
+#include "kompute/Core.hpp"
+
+#include "kompute/Manager.hpp"
+
+namespace kp {
+
+/**
+ * Harness timing the operations of sequences with their GPU timestamps
+ * rather than the wall clock, so the time of the submission and of the wait
+ * for completion are left out. Each run evaluates the sequence a number of
+ * times to warm up the caches and clocks of the device, then a number of
+ * repetitions whose times are summarised, along with the GFLOP/s and GB/s
+ * achieved and their fraction of the peak of the device.
+ *
+ * Vulkan reports neither the peak arithmetic rate nor the peak bandwidth of
+ * a device, so the peak bandwidth is measured with buffer copies, and the
+ * peak arithmetic rate is provided by the user, such as from the datasheet
+ * of the device.
+ */
+class Benchmark
+{
+  public:
+    /**
+     * Summary of the times of the repetitions of a run.
+     */
+    struct Result
+    {
+        std::string label;        ///< Operations timed, all if empty
+        uint32_t repetitions = 0; ///< Number of times summarised
+        double minNs = 0;         ///< Fastest repetition
+        double medianNs = 0;      ///< Median repetition
+        double meanNs = 0;        ///< Mean of the repetitions
+        double stddevNs = 0;      ///< Standard deviation of the repetitions
+        double maxNs = 0;         ///< Slowest repetition
+        double gflops = 0;        ///< At the median time, 0 without flops
+        double gbps = 0;          ///< At the median time, 0 without bytes
+        double peakGflopsFraction = 0; ///< Of gflops, 0 without a peak
+        double peakGbpsFraction = 0;   ///< Of gbps, 0 without a peak
+    };
+
+    /**
+     * Constructor for a harness of the device of a manager.
+     *
+     * @param manager The manager creating the resources of the peak
+     * bandwidth measurement
+     * @param warmup Number of evaluations before the timed ones
+     * @param repetitions Number of timed evaluations, at least 1
+     */
+    Benchmark(std::shared_ptr<Manager> manager,
+              uint32_t warmup = 3,
+              uint32_t repetitions = 10);
+
+    /**
+     * Times a sequence already recorded, which must have been created with
+     * at least as many timestamps as operations. The time of a repetition is
+     * the sum of the GPU time of the operations with the label provided,
+     * which lets the sync operations of the sequence be left out.
+     *
+     * @param sequence The sequence to evaluate
+     * @param flops Floating point operations of an evaluation, for GFLOP/s
+     * @param bytes Bytes read and written by an evaluation, for GB/s
+     * @param label (Optional) Label of the operations to time, given when
+     * they were recorded, or all the operations if empty
+     * @return Summary of the times of the repetitions
+     */
+    Result run(std::shared_ptr<Sequence> sequence,
+               double flops = 0,
+               double bytes = 0,
+               const std::string& label = "");
+
+    /**
+     * Times a function running on the host with the wall clock, with the
+     * same warmup and repetitions as the sequences, to compare the device
+     * against a host implementation such as numpy.
+     *
+     * @param function The function to time
+     * @param flops Floating point operations of a call, for GFLOP/s
+     * @param bytes Bytes read and written by a call, for GB/s
+     * @return Summary of the times of the repetitions, without the
+     * fractions of the peak of the device
+     */
+    Result runHost(const std::function<void()>& function,
+                   double flops = 0,
+                   double bytes = 0);
+
+    /**
+     * Measures the peak bandwidth of the device by timing copies between
+     * two device tensors, counting the bytes read and written, and uses it
+     * as the peak of the results of later runs.
+     *
+     * @param bytes Size of the tensors copied
+     * @return The bandwidth measured, in GB/s
+     */
+    double measurePeakBandwidth(uint64_t bytes = 64 * 1024 * 1024);
+
+    /**
+     * Sets the peaks the results of later runs are compared against.
+     *
+     * @param gflops Peak arithmetic rate in GFLOP/s, or 0 if unknown
+     * @param gbps Peak bandwidth in GB/s, or 0 if unknown
+     */
+    void setPeak(double gflops, double gbps);
+
+    /**
+     * Peak arithmetic rate the results are compared against.
+     *
+     * @return GFLOP/s, or 0 if unknown
+     */
+    double peakGflops() const;
+
+    /**
+     * Peak bandwidth the results are compared against.
+     *
+     * @return GB/s, or 0 if unknown
+     */
+    double peakGbps() const;
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<Manager> mManager;
+
+    uint32_t mWarmup;
+    uint32_t mRepetitions;
+    double mPeakGflops = 0;
+    double mPeakGbps = 0;
+
+    Result summarize(const std::string& label,
+                     std::vector<double> samplesNs,
+                     double flops,
+                     double bytes);
+};
+
+} // End namespace kp
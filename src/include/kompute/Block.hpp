@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Core.hpp"
+
+#include "kompute/HazardTracker.hpp"
+#include "kompute/HostAllocator.hpp"
+#include "kompute/operations/OpAlgoDispatch.hpp"
+#include "kompute/operations/OpBase.hpp"
+
+namespace kp {
+
+/**
+ * Block of operations recorded once into a secondary command buffer, which
+ * can then be recorded into any number of sequences as a single operation
+ * that executes the secondary command buffer. This allows composing
+ * sequences out of prebuilt blocks without recording their operations again.
+ *
+ * Each block owns its command pool, so separate blocks can be recorded in
+ * parallel from different threads as long as they do not share algorithms.
+ * The barriers between the operations of the block are recorded within the
+ * block, and the block acts as an operation with undeclared accesses in the
+ * sequences it is recorded into.
+ */
+class Block
+  : public OpBase
+  , public std::enable_shared_from_this<Block>
+{
+  public:
+    /**
+     * Main constructor for the block which creates its command pool and
+     * secondary command buffer.
+     *
+     * @param device Vulkan logical device
+     * @param queueIndex Index of the queue family of the sequences the block
+     * will be recorded into
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy the command pool of the block with
+     */
+    Block(std::shared_ptr<vk::Device> device,
+          uint32_t queueIndex,
+          std::shared_ptr<HostAllocator> hostAllocator = nullptr);
+
+    /**
+     * Destructor for the block which frees its command buffer and pool.
+     */
+    ~Block() override;
+
+    /**
+     * Record function for operation to be added to the block. If the block
+     * is not recording it begins recording, discarding the operations it
+     * contained. Sequences that contain the block need to be re-recorded
+     * after the block is recorded again, and must not be running.
+     *
+     * @param op Object derived from kp::BaseOp that will be recorded by the
+     * block.
+     * @return shared_ptr<Block> of the Block class itself
+     */
+    std::shared_ptr<Block> record(std::shared_ptr<OpBase> op);
+
+    /**
+     * Record function for operation to be added to the block.
+     *
+     * @param tensors Vector of tensors to use for the operation
+     * @param TArgs Template parameters that are used to initialise operation
+     * which allows for extensible configurations on initialisation.
+     * @return shared_ptr<Block> of the Block class itself
+     */
+    template<typename T, typename... TArgs>
+    std::shared_ptr<Block> record(std::vector<std::shared_ptr<Tensor>> tensors,
+                                  TArgs&&... params)
+    {
+        std::shared_ptr<T> op{ new T(tensors, std::forward<TArgs>(params)...) };
+        return this->record(op);
+    }
+    /**
+     * Record function for operation to be added to the block.
+     *
+     * @param algorithm Algorithm to use for the record often used for OpAlgo
+     * operations
+     * @param TArgs Template parameters that are used to initialise operation
+     * which allows for extensible configurations on initialisation.
+     * @return shared_ptr<Block> of the Block class itself
+     */
+    template<typename T, typename... TArgs>
+    std::shared_ptr<Block> record(std::shared_ptr<Algorithm> algorithm,
+                                  TArgs&&... params)
+    {
+        std::shared_ptr<T> op{ new T(algorithm,
+                                     std::forward<TArgs>(params)...) };
+        return this->record(op);
+    }
+
+    /**
+     * Begins recording the secondary command buffer, discarding the
+     * operations the block contained.
+     */
+    void begin();
+
+    /**
+     * Ends recording the secondary command buffer. This is called when the
+     * block is recorded into a sequence, so it only needs to be called
+     * explicitly before recording the block from another thread.
+     */
+    void end();
+
+    /**
+     * Records the execution of the secondary command buffer of the block,
+     * ending its recording if required.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Runs the preEval of all the operations of the block.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    void preEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Runs the postEval of all the operations of the block.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    void postEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Returns true if the block is currently in recording activated.
+     *
+     * @return Boolean stating if recording ongoing.
+     */
+    bool isRecording();
+
+    /**
+     * Returns true if the block has been initialised, and it's based on the
+     * GPU resources being referenced.
+     *
+     * @return Boolean stating if is initialized
+     */
+    bool isInit();
+
+    /**
+     * Returns the number of operations recorded into the block.
+     *
+     * @return Number of operations of the block
+     */
+    uint32_t operationCount();
+
+    /**
+     * Destroys and frees the GPU resources which include the secondary
+     * command buffer and the command pool. Sequences containing the block
+     * must have completed.
+     */
+    void destroy();
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<vk::Device> mDevice = nullptr;
+    uint32_t mQueueIndex = -1;
+    std::shared_ptr<HostAllocator> mHostAllocator = nullptr;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::shared_ptr<vk::CommandPool> mCommandPool = nullptr;
+    std::shared_ptr<vk::CommandBuffer> mCommandBuffer = nullptr;
+    std::vector<std::shared_ptr<OpBase>> mOperations;
+    HazardTracker mHazardTracker;
+
+    // State
+    bool mRecording = false;
+    bool mRecorded = false;
+
+    // Create functions
+    void createCommandPool();
+    void createCommandBuffer();
+};
+
+} // End namespace kp
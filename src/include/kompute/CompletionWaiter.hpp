@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "kompute/Core.hpp"
+
+#include "kompute/Sequence.hpp"
+
+// Nanoseconds to wait for the fences before picking up new submissions
+#ifndef KOMPUTE_COMPLETION_WAITER_TIMEOUT
+#define KOMPUTE_COMPLETION_WAITER_TIMEOUT 1000000
+#endif
+
+namespace kp {
+
+/**
+ * Background thread that waits for the submissions of many sequences at the
+ * same time, running evalAwait on each sequence once its submission
+ * completes and then notifying the completion, so no thread has to block on
+ * each of the submissions.
+ *
+ * The completions are run on the thread of the waiter. Until a sequence
+ * completes it must not be used by other threads.
+ */
+class CompletionWaiter
+{
+  public:
+    /**
+     * Completion run once the submission has been awaited, with the
+     * exception thrown by evalAwait if any.
+     */
+    typedef std::function<void(std::exception_ptr)> Completion;
+
+    /**
+     * Constructor which starts the thread of the waiter.
+     *
+     * @param device The device the fences of the sequences belong to
+     */
+    CompletionWaiter(std::shared_ptr<vk::Device> device);
+
+    /**
+     * Destructor which waits for the submissions still pending.
+     */
+    ~CompletionWaiter();
+
+    /**
+     * Waits in the background for the last submission of the sequence, which
+     * must have been submitted with evalAsync. Submissions of a batch are
+     * awaited through the batch instead.
+     *
+     * @param sequence The sequence whose last submission to wait for
+     * @param completion The function to run once the submission is awaited
+     */
+    void watch(std::shared_ptr<Sequence> sequence, Completion completion);
+
+    /**
+     * Returns the number of submissions the waiter is waiting for.
+     *
+     * @return Number of pending submissions
+     */
+    uint32_t pendingCount();
+
+    /**
+     * Waits for the pending submissions and their completions, and then
+     * stops the thread of the waiter.
+     */
+    void destroy();
+
+  private:
+    struct Pending
+    {
+        std::shared_ptr<Sequence> sequence;
+        vk::Fence fence;
+        Completion completion;
+    };
+
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<vk::Device> mDevice;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::thread mThread;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::vector<Pending> mPending;
+    bool mStopping = false;
+
+    void run();
+};
+
+} // End namespace kp
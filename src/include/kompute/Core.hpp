@@ -13,6 +13,16 @@ static const char* KOMPUTE_LOG_TAG = "KomputeLog";
 
 #include <vulkan/vulkan.hpp>
 
+// Android hardware buffers can be imported from API level 26, where the NDK
+// functions describing them were introduced
+#ifndef KOMPUTE_HARDWARE_BUFFER_IMPORT
+#if defined(VK_USE_PLATFORM_ANDROID_KHR) && __ANDROID_API__ >= 26
+#define KOMPUTE_HARDWARE_BUFFER_IMPORT 1
+#else
+#define KOMPUTE_HARDWARE_BUFFER_IMPORT 0
+#endif
+#endif
+
 // Typedefs to simplify interaction with core types
 namespace kp {
 typedef std::array<uint32_t, 3> Workgroup;
@@ -32,6 +42,17 @@ typedef std::vector<float> Constants;
       KOMPUTE_VK_API_MAJOR_VERSION, KOMPUTE_VK_API_MINOR_VERSION, 0)
 #endif // KOMPUTE_VK_API_VERSION
 
+// Values of the spdlog levels, also used when spdlog is not enabled
+#ifndef SPDLOG_LEVEL_TRACE
+#define SPDLOG_LEVEL_TRACE 0
+#define SPDLOG_LEVEL_DEBUG 1
+#define SPDLOG_LEVEL_INFO 2
+#define SPDLOG_LEVEL_WARN 3
+#define SPDLOG_LEVEL_ERROR 4
+#define SPDLOG_LEVEL_CRITICAL 5
+#define SPDLOG_LEVEL_OFF 6
+#endif
+
 // SPDLOG_ACTIVE_LEVEL must be defined before spdlog.h import
 #ifndef SPDLOG_ACTIVE_LEVEL
 #if DEBUG
@@ -41,6 +62,23 @@ typedef std::vector<float> Constants;
 #endif
 #endif
 
+// Messages of the paths run for every operation recorded, dispatched or
+// submitted, by subsystem. They are logged at the debug level when the
+// subsystem is enabled, and compiled out otherwise, which is the default in
+// release builds.
+#ifndef KOMPUTE_LOG_SEQUENCE
+#define KOMPUTE_LOG_SEQUENCE DEBUG
+#endif
+#ifndef KOMPUTE_LOG_ALGORITHM
+#define KOMPUTE_LOG_ALGORITHM DEBUG
+#endif
+#ifndef KOMPUTE_LOG_TENSOR
+#define KOMPUTE_LOG_TENSOR DEBUG
+#endif
+#ifndef KOMPUTE_LOG_OPERATION
+#define KOMPUTE_LOG_OPERATION DEBUG
+#endif
+
 #if defined(KOMPUTE_BUILD_PYTHON)
 #include <pybind11/pybind11.h>
 namespace py = pybind11;
@@ -56,85 +94,150 @@ extern py::object kp_debug, kp_info, kp_warning, kp_error;
 #define KP_LOG_WARN(...) SPDLOG_WARN(__VA_ARGS__)
 #define KP_LOG_ERROR(...) SPDLOG_ERROR(__VA_ARGS__)
 #else
+#include <atomic>
 #include <iostream>
-#if SPDLOG_ACTIVE_LEVEL > 1
-#define KP_LOG_DEBUG(...)
-#else
+
+namespace kp {
+
+/**
+ * Runtime level of the messages logged without spdlog, which are neither
+ * formatted nor passed to the sink below it. It is a spdlog level, and
+ * defaults to SPDLOG_ACTIVE_LEVEL.
+ *
+ * @return The level, shared by all the translation units
+ */
+inline std::atomic<int>&
+logLevel()
+{
+    static std::atomic<int> level{ SPDLOG_ACTIVE_LEVEL };
+    return level;
+}
+
+/**
+ * Sets the runtime level of the messages logged without spdlog, the
+ * equivalent of spdlog::set_level. Levels below SPDLOG_ACTIVE_LEVEL are
+ * compiled out regardless.
+ *
+ * @param level A spdlog level, such as SPDLOG_LEVEL_WARN
+ */
+inline void
+setLogLevel(int level)
+{
+    logLevel().store(level, std::memory_order_relaxed);
+}
+
+} // End namespace kp
+
+// Only formats the message and calls the sink when the level is enabled
+#define KP_LOG_AT(level, ...)                                                  \
+    do {                                                                       \
+        if ((level) >= kp::logLevel().load(std::memory_order_relaxed)) {       \
+            __VA_ARGS__;                                                       \
+        }                                                                      \
+    } while (0)
+
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
-#define KP_LOG_DEBUG(...)                                                      \
-    ((void)__android_log_write(                                                \
-      ANDROID_LOG_DEBUG, KOMPUTE_LOG_TAG, fmt::format(__VA_ARGS__).c_str()))
+#define KP_LOG_SINK(level, androidPriority, pythonSink, tag, ...)              \
+    KP_LOG_AT(level,                                                           \
+              __android_log_write(androidPriority,                             \
+                                  KOMPUTE_LOG_TAG,                             \
+                                  fmt::format(__VA_ARGS__).c_str()))
 #elif defined(KOMPUTE_BUILD_PYTHON)
-#define KP_LOG_DEBUG(...) kp_debug(fmt::format(__VA_ARGS__))
+namespace kp {
+
+/**
+ * Passes a message to a Python logger, taking the GIL as messages are logged
+ * from the threads of Kompute and from bindings that release the GIL.
+ *
+ * @param sink The function of the Python logger of the level
+ * @param message The formatted message
+ */
+inline void
+logPython(const py::object& sink, const std::string& message)
+{
+    py::gil_scoped_acquire gil;
+    sink(message);
+}
+
+} // End namespace kp
+
+#define KP_LOG_SINK(level, androidPriority, pythonSink, tag, ...)              \
+    KP_LOG_AT(level, kp::logPython(pythonSink, fmt::format(__VA_ARGS__)))
 #else
-#define KP_LOG_DEBUG(...)                                                      \
-    fmt::print("[{} {}] [debug] [{}:{}] {}\n",                                 \
-               __DATE__,                                                       \
-               __TIME__,                                                       \
-               __FILE__,                                                       \
-               __LINE__,                                                       \
-               fmt::format(__VA_ARGS__))
+#define KP_LOG_SINK(level, androidPriority, pythonSink, tag, ...)              \
+    KP_LOG_AT(level,                                                           \
+              fmt::print("[{} {}] [{}] [{}:{}] {}\n",                          \
+                         __DATE__,                                             \
+                         __TIME__,                                             \
+                         tag,                                                  \
+                         __FILE__,                                             \
+                         __LINE__,                                             \
+                         fmt::format(__VA_ARGS__)))
 #endif // VK_USE_PLATFORM_ANDROID_KHR
-#endif // SPDLOG_ACTIVE_LEVEL > 1
 
-#if SPDLOG_ACTIVE_LEVEL > 2
-#define KP_LOG_INFO(...)
+#if SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_DEBUG
+#define KP_LOG_DEBUG(...)
 #else
-#if defined(VK_USE_PLATFORM_ANDROID_KHR)
-#define KP_LOG_INFO(...)                                                       \
-    ((void)__android_log_write(                                                \
-      ANDROID_LOG_INFO, KOMPUTE_LOG_TAG, fmt::format(__VA_ARGS__).c_str()))
-#elif defined(KOMPUTE_BUILD_PYTHON)
-#define KP_LOG_INFO(...) kp_info(fmt::format(__VA_ARGS__))
+#define KP_LOG_DEBUG(...)                                                      \
+    KP_LOG_SINK(SPDLOG_LEVEL_DEBUG,                                            \
+                ANDROID_LOG_DEBUG,                                             \
+                kp_debug,                                                      \
+                "debug",                                                       \
+                __VA_ARGS__)
+#endif // SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_DEBUG
+
+#if SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_INFO
+#define KP_LOG_INFO(...)
 #else
 #define KP_LOG_INFO(...)                                                       \
-    fmt::print("[{} {}] [debug] [{}:{}] {}\n",                                 \
-               __DATE__,                                                       \
-               __TIME__,                                                       \
-               __FILE__,                                                       \
-               __LINE__,                                                       \
-               fmt::format(__VA_ARGS__))
-#endif // VK_USE_PLATFORM_ANDROID_KHR
-#endif // SPDLOG_ACTIVE_LEVEL > 2
+    KP_LOG_SINK(SPDLOG_LEVEL_INFO,                                             \
+                ANDROID_LOG_INFO,                                              \
+                kp_info,                                                       \
+                "info",                                                        \
+                __VA_ARGS__)
+#endif // SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_INFO
 
-#if SPDLOG_ACTIVE_LEVEL > 3
+#if SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_WARN
 #define KP_LOG_WARN(...)
 #else
-#if defined(VK_USE_PLATFORM_ANDROID_KHR)
 #define KP_LOG_WARN(...)                                                       \
-    ((void)__android_log_write(                                                \
-      ANDROID_LOG_WARN, KOMPUTE_LOG_TAG, fmt::format(__VA_ARGS__).c_str()))
-#elif defined(KOMPUTE_BUILD_PYTHON)
-#define KP_LOG_WARN(...) kp_warning(fmt::format(__VA_ARGS__))
-#else
-#define KP_LOG_WARN(...)                                                       \
-    fmt::print("[{} {}] [debug] [{}:{}] {}\n",                                 \
-               __DATE__,                                                       \
-               __TIME__,                                                       \
-               __FILE__,                                                       \
-               __LINE__,                                                       \
-               fmt::format(__VA_ARGS__))
-#endif // VK_USE_PLATFORM_ANDROID_KHR
-#endif // SPDLOG_ACTIVE_LEVEL > 3
+    KP_LOG_SINK(SPDLOG_LEVEL_WARN,                                             \
+                ANDROID_LOG_WARN,                                              \
+                kp_warning,                                                    \
+                "warning",                                                     \
+                __VA_ARGS__)
+#endif // SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_WARN
 
-#if SPDLOG_ACTIVE_LEVEL > 4
+#if SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_ERROR
 #define KP_LOG_ERROR(...)
 #else
-#if defined(VK_USE_PLATFORM_ANDROID_KHR)
-#define KP_LOG_ERROR(...)                                                      \
-    ((void)__android_log_write(                                                \
-      ANDROID_LOG_ERROR, KOMPUTE_LOG_TAG, fmt::format(__VA_ARGS__).c_str()))
-#elif defined(KOMPUTE_BUILD_PYTHON)
-#define KP_LOG_ERROR(...) kp_error(fmt::format(__VA_ARGS__))
-#else
 #define KP_LOG_ERROR(...)                                                      \
-    fmt::print("[{} {}] [debug] [{}:{}] {}\n",                                 \
-               __DATE__,                                                       \
-               __TIME__,                                                       \
-               __FILE__,                                                       \
-               __LINE__,                                                       \
-               fmt::format(__VA_ARGS__))
-#endif // VK_USE_PLATFORM_ANDROID_KHR
-#endif // SPDLOG_ACTIVE_LEVEL > 4
+    KP_LOG_SINK(SPDLOG_LEVEL_ERROR,                                            \
+                ANDROID_LOG_ERROR,                                             \
+                kp_error,                                                      \
+                "error",                                                       \
+                __VA_ARGS__)
+#endif // SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_ERROR
 #endif // KOMPUTE_SPDLOG_ENABLED
 #endif // KOMPUTE_LOG_OVERRIDE
+
+#if KOMPUTE_LOG_SEQUENCE
+#define KP_LOG_SEQUENCE(...) KP_LOG_DEBUG(__VA_ARGS__)
+#else
+#define KP_LOG_SEQUENCE(...)
+#endif
+#if KOMPUTE_LOG_ALGORITHM
+#define KP_LOG_ALGORITHM(...) KP_LOG_DEBUG(__VA_ARGS__)
+#else
+#define KP_LOG_ALGORITHM(...)
+#endif
+#if KOMPUTE_LOG_TENSOR
+#define KP_LOG_TENSOR(...) KP_LOG_DEBUG(__VA_ARGS__)
+#else
+#define KP_LOG_TENSOR(...)
+#endif
+#if KOMPUTE_LOG_OPERATION
+#define KP_LOG_OPERATION(...) KP_LOG_DEBUG(__VA_ARGS__)
+#else
+#define KP_LOG_OPERATION(...)
+#endif
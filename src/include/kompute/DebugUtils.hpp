@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <string>
+
+#include "kompute/Core.hpp"
+
+namespace kp {
+
+/**
+ * Functions of VK_EXT_debug_utils used to name the Vulkan objects of the
+ * tensors, algorithms and sequences, and to label the commands of each
+ * operation, so captures of tools such as RenderDoc and Nsight show the names
+ * given by the user instead of raw handles.
+ *
+ * The manager creates it when it enables the extension on the instance it
+ * creates, and shares it with the components it creates. Without the
+ * extension the components keep their names but skip the Vulkan calls.
+ */
+class DebugUtils
+{
+  public:
+    /**
+     * Resolves the functions of the extension from an instance created with
+     * VK_EXT_debug_utils enabled.
+     *
+     * @param instance The instance the extension is enabled on
+     */
+    DebugUtils(const vk::Instance& instance);
+
+    /**
+     * Checks whether the functions of the extension were resolved.
+     *
+     * @return Boolean stating whether objects can be named and labelled
+     */
+    bool isValid() const;
+
+    /**
+     * Names a Vulkan object, which is ignored for an empty name or a null
+     * handle.
+     *
+     * @param device The device owning the object
+     * @param objectType The type of the object
+     * @param objectHandle The handle of the object cast to an integer
+     * @param name The name to give the object
+     */
+    void setObjectName(const vk::Device& device,
+                       vk::ObjectType objectType,
+                       uint64_t objectHandle,
+                       const std::string& name) const;
+
+    /**
+     * Opens a labelled region of a command buffer, which must be closed with
+     * endLabel in the same command buffer.
+     *
+     * @param commandBuffer The command buffer being recorded
+     * @param label The label of the region
+     */
+    void beginLabel(const vk::CommandBuffer& commandBuffer,
+                    const std::string& label) const;
+
+    /**
+     * Closes the last region opened by beginLabel.
+     *
+     * @param commandBuffer The command buffer being recorded
+     */
+    void endLabel(const vk::CommandBuffer& commandBuffer) const;
+
+  private:
+    PFN_vkSetDebugUtilsObjectNameEXT mSetObjectName = nullptr;
+    PFN_vkCmdBeginDebugUtilsLabelEXT mCmdBeginLabel = nullptr;
+    PFN_vkCmdEndDebugUtilsLabelEXT mCmdEndLabel = nullptr;
+};
+
+} // End namespace kp
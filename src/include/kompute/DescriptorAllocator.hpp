@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <mutex>
+
+#include "kompute/Core.hpp"
+
+#include "kompute/HostAllocator.hpp"
+
+// Descriptor sets and descriptors of each type in a pool of the allocator
+#ifndef KOMPUTE_DESCRIPTOR_POOL_MAX_SETS
+#define KOMPUTE_DESCRIPTOR_POOL_MAX_SETS 256
+#endif
+#ifndef KOMPUTE_DESCRIPTOR_POOL_DESCRIPTORS
+#define KOMPUTE_DESCRIPTOR_POOL_DESCRIPTORS 1024
+#endif
+
+namespace kp {
+
+/**
+ * Growable allocator of descriptor sets shared by the algorithms created by
+ * a manager.
+ *
+ * Instead of creating a descriptor pool for every algorithm, the sets are
+ * allocated from large pools created with eFreeDescriptorSet, so the sets of
+ * destroyed algorithms are returned to their pool and reused. A new pool is
+ * created whenever none of the existing ones can fit a set.
+ */
+class DescriptorAllocator
+{
+  public:
+    /**
+     * Descriptor set handed out by the allocator, together with the pool it
+     * was allocated from which is owned by the allocator.
+     */
+    struct Allocation
+    {
+        vk::DescriptorPool pool;
+        vk::DescriptorSet set;
+    };
+
+    /**
+     * Constructor for the allocator of the descriptor sets of a device.
+     *
+     * @param device The device the descriptor pools are created with
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy the descriptor pools with
+     */
+    DescriptorAllocator(std::shared_ptr<vk::Device> device,
+                        std::shared_ptr<HostAllocator> hostAllocator = nullptr);
+
+    /**
+     * Destructor which destroys the descriptor pools.
+     */
+    ~DescriptorAllocator();
+
+    /**
+     * Allocates a descriptor set from the first pool able to fit it,
+     * creating a new pool if none can.
+     *
+     * @param layout The layout of the descriptor set
+     * @param storageBufferCount The storage buffer descriptors of the layout
+     * @param uniformBufferCount The uniform buffer descriptors of the layout
+     * @param storageImageCount The storage image descriptors of the layout
+     * @return The allocated descriptor set and its pool
+     */
+    Allocation allocate(const vk::DescriptorSetLayout& layout,
+                        uint32_t storageBufferCount,
+                        uint32_t uniformBufferCount,
+                        uint32_t storageImageCount = 0);
+
+    /**
+     * Returns a descriptor set to its pool. Command buffers using the set
+     * must have completed.
+     *
+     * @param allocation The allocation returned by allocate
+     */
+    void free(const Allocation& allocation);
+
+    /**
+     * Returns the number of descriptor pools created by the allocator.
+     *
+     * @return Number of descriptor pools
+     */
+    uint32_t poolCount();
+
+    /**
+     * Returns the number of descriptor sets currently allocated.
+     *
+     * @return Number of allocated descriptor sets
+     */
+    uint32_t allocatedSetCount();
+
+    /**
+     * Destroys the descriptor pools, which frees all the descriptor sets
+     * allocated from them.
+     */
+    void destroy();
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<vk::Device> mDevice;
+    std::shared_ptr<HostAllocator> mHostAllocator;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<vk::DescriptorPool> mPools;
+    uint32_t mAllocatedSetCount = 0;
+    std::mutex mMutex;
+
+    vk::DescriptorPool createPool(uint32_t storageBufferCount,
+                                  uint32_t uniformBufferCount,
+                                  uint32_t storageImageCount);
+};
+
+} // End namespace kp
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <vector>
+
+#include "kompute/Core.hpp"
+
+namespace kp {
+
+/**
+ * Properties of a physical device queried once when the manager selects it,
+ * and shared with the components it creates instead of each of them querying
+ * the driver again, such as every sequence for its queue family. They do not
+ * change while the device exists.
+ */
+class DeviceInfo
+{
+  public:
+    /**
+     * Constructor querying the properties of a physical device.
+     *
+     * @param physicalDevice The physical device to query
+     */
+    DeviceInfo(const vk::PhysicalDevice& physicalDevice);
+
+    /**
+     * The general properties and limits of the device.
+     *
+     * @return Reference to the properties of the device
+     */
+    const vk::PhysicalDeviceProperties& properties() const;
+
+    /**
+     * The subgroup properties of the device, with a null pNext.
+     *
+     * @return Reference to the subgroup properties of the device
+     */
+    const vk::PhysicalDeviceSubgroupProperties& subgroupProperties() const;
+
+    /**
+     * The memory types and heaps of the device.
+     *
+     * @return Reference to the memory properties of the device
+     */
+    const vk::PhysicalDeviceMemoryProperties& memoryProperties() const;
+
+    /**
+     * The properties of the queue families of the device, by family index.
+     *
+     * @return Reference to the queue family properties of the device
+     */
+    const std::vector<vk::QueueFamilyProperties>& queueFamilyProperties()
+      const;
+
+    /**
+     * The core features enabled on the logical device, which may be fewer
+     * than the features the physical device supports. None are reported
+     * until the manager records them with setEnabledFeatures.
+     *
+     * @return Reference to the features enabled on the device
+     */
+    const vk::PhysicalDeviceFeatures& enabledFeatures() const;
+
+    /**
+     * Record the core features the logical device was created with, before
+     * the info is shared with the components of the manager.
+     *
+     * @param enabledFeatures The features enabled on the device
+     */
+    void setEnabledFeatures(const vk::PhysicalDeviceFeatures& enabledFeatures);
+
+    /**
+     * Whether device timestamps can be calibrated against CLOCK_MONOTONIC,
+     * which requires VK_EXT_calibrated_timestamps to be enabled on the
+     * logical device and both time domains to be calibrateable. False until
+     * the manager records it with setCalibratedTimestamps.
+     *
+     * @return Boolean stating whether timestamps can be calibrated
+     */
+    bool hasCalibratedTimestamps() const;
+
+    /**
+     * Record whether device timestamps can be calibrated against
+     * CLOCK_MONOTONIC, before the info is shared with the components of the
+     * manager.
+     *
+     * @param calibratedTimestamps Whether timestamps can be calibrated
+     */
+    void setCalibratedTimestamps(bool calibratedTimestamps);
+
+  private:
+    vk::PhysicalDeviceProperties mProperties;
+    vk::PhysicalDeviceSubgroupProperties mSubgroupProperties;
+    vk::PhysicalDeviceMemoryProperties mMemoryProperties;
+    std::vector<vk::QueueFamilyProperties> mQueueFamilyProperties;
+    vk::PhysicalDeviceFeatures mEnabledFeatures;
+    bool mCalibratedTimestamps = false;
+};
+
+} // End namespace kp
@@ -0,0 +1,200 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <string>
+#include <type_traits>
+
+#include "kompute/Core.hpp"
+
+#include "kompute/Tensor.hpp"
+
+namespace kp {
+
+/**
+ * Elementwise expression over float tensors of the same size, built with the
+ * arithmetic operators and the functions of this header, which OpExpression
+ * evaluates in a single fused dispatch instead of one dispatch and one
+ * intermediate tensor per operation.
+ *
+ * The GLSL of an expression is generated from its signature, which
+ * identifies the operations and the positions of the tensors and constants
+ * but not which tensors or constant values are used, and compiled in the
+ * process by kp::Shader, which caches the SPIR-V by source. Expressions with
+ * the same structure then share the same SPIR-V, and the pipeline of the
+ * ShaderCache of the manager. The constants are passed as push constants.
+ * Compiling requires Kompute to be built with
+ * KOMPUTE_OPT_ENABLE_SHADER_COMPILER, unless the SPIR-V is already in the
+ * on-disk cache of kp::Shader.
+ */
+class Expression
+{
+  public:
+    /**
+     * Operation of a node of the expression.
+     */
+    enum class Operation
+    {
+        eTensor = 0,
+        eConstant = 1,
+        eAdd = 2,
+        eSubtract = 3,
+        eMultiply = 4,
+        eDivide = 5,
+        eMin = 6,
+        eMax = 7,
+        eNegate = 8,
+        eAbs = 9,
+        eSqrt = 10,
+        eExp = 11,
+        eLog = 12,
+    };
+
+    /**
+     * Constructor of an expression reading the elements of a tensor, which
+     * also converts tensors to expressions in the operators.
+     *
+     * @param tensor The float tensor to read
+     */
+    template<typename T,
+             typename = typename std::enable_if<
+               std::is_base_of<Tensor, T>::value>::type>
+    Expression(const std::shared_ptr<T>& tensor)
+      : Expression(std::static_pointer_cast<Tensor>(tensor))
+    {
+    }
+
+    /**
+     * Constructor of an expression reading the elements of a tensor.
+     *
+     * @param tensor The float tensor to read
+     */
+    Expression(const std::shared_ptr<Tensor>& tensor);
+
+    /**
+     * Constructor of a constant expression, whose value is passed as a push
+     * constant.
+     *
+     * @param constant The value of the constant
+     */
+    explicit Expression(float constant);
+
+    /**
+     * Constructor of an operation on one or two expressions.
+     *
+     * @param operation The operation of the node
+     * @param left The first operand
+     * @param right The second operand of binary operations
+     */
+    Expression(Operation operation,
+               const Expression& left,
+               const Expression& right);
+    Expression(Operation operation, const Expression& operand);
+
+    /**
+     * Returns the distinct tensors read by the expression, in the order they
+     * are first read which is the order of their bindings after the output.
+     *
+     * @return The tensors of the expression
+     */
+    std::vector<std::shared_ptr<Tensor>> tensors() const;
+
+    /**
+     * Returns the values of the constants of the expression, in the order of
+     * their push constants.
+     *
+     * @return The constants of the expression
+     */
+    std::vector<float> constants() const;
+
+    /**
+     * Returns the signature of the expression, such as mul(t0,add(t1,c0))
+     * where t are the distinct tensors and c the constants.
+     *
+     * @return The signature of the expression
+     */
+    std::string signature() const;
+
+    /**
+     * Returns the GLSL of a compute shader that evaluates the expression
+     * into the tensor at binding 0, with one invocation per element and the
+     * local size x specialized through the specialization constant 0.
+     *
+     * @return The GLSL source of the fused shader
+     */
+    std::string glsl() const;
+
+    /**
+     * Returns the SPIR-V of the shader of glsl, compiled through
+     * kp::Shader::compile the first time a signature is used and then
+     * served from its cache.
+     *
+     * @return The SPIR-V of the fused shader
+     */
+    std::vector<uint32_t> spirv() const;
+
+  private:
+    struct Node
+    {
+        Operation operation;
+        std::shared_ptr<Tensor> tensor;
+        float constant;
+        std::shared_ptr<const Node> left;
+        std::shared_ptr<const Node> right;
+    };
+
+    std::shared_ptr<const Node> mNode;
+};
+
+/**
+ * Starts an expression from a tensor, as in kp::expr(a) * b + c.
+ *
+ * @param tensor The float tensor to read
+ * @return Expression reading the tensor
+ */
+inline Expression
+expr(const std::shared_ptr<Tensor>& tensor)
+{
+    return Expression(tensor);
+}
+
+Expression
+operator+(const Expression& left, const Expression& right);
+Expression
+operator+(const Expression& left, float right);
+Expression
+operator+(float left, const Expression& right);
+Expression
+operator-(const Expression& left, const Expression& right);
+Expression
+operator-(const Expression& left, float right);
+Expression
+operator-(float left, const Expression& right);
+Expression
+operator*(const Expression& left, const Expression& right);
+Expression
+operator*(const Expression& left, float right);
+Expression
+operator*(float left, const Expression& right);
+Expression
+operator/(const Expression& left, const Expression& right);
+Expression
+operator/(const Expression& left, float right);
+Expression
+operator/(float left, const Expression& right);
+Expression
+operator-(const Expression& operand);
+
+Expression
+min(const Expression& left, const Expression& right);
+Expression
+max(const Expression& left, const Expression& right);
+Expression
+abs(const Expression& operand);
+Expression
+sqrt(const Expression& operand);
+Expression
+exp(const Expression& operand);
+Expression
+log(const Expression& operand);
+
+} // End namespace kp
@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+
+#include "kompute/Core.hpp"
+
+#include "kompute/Sequence.hpp"
+
+namespace kp {
+
+/**
+ * Graph of operations whose dependencies are derived from the tensors they
+ * read and write, compiled into sequences spread across several queues and
+ * replayed without recording them again while the graph does not change.
+ *
+ * Each operation depends on the last operation writing a tensor it reads or
+ * writes, and on the operations reading a tensor it writes since the last
+ * write. The operations are assigned to the queues so that chains of
+ * dependent operations stay on one queue, and independent chains run on
+ * different queues. The operations of a queue are split into sequences
+ * where they wait for or are waited on by another queue, and the sequences
+ * depending on each other are chained with timeline semaphores. The barriers
+ * within a sequence are recorded from the accesses of the operations.
+ */
+class Graph
+{
+  public:
+    /**
+     * Function creating a sequence on the queue of the index provided, with
+     * a timeline semaphore when the graph uses several queues.
+     */
+    typedef std::function<std::shared_ptr<Sequence>(uint32_t queueIndex)>
+      SequenceFactory;
+
+    /**
+     * Constructor from the queues to spread the operations across.
+     *
+     * @param queueIndices The indices of the queues the operations can run
+     * on, all of which must support compute
+     * @param sequenceFactory The function creating the sequences of the
+     * compiled graph
+     */
+    Graph(const std::vector<uint32_t>& queueIndices,
+          SequenceFactory sequenceFactory);
+
+    /**
+     * Destructor which waits for the run in flight and releases the
+     * sequences of the graph.
+     */
+    ~Graph();
+
+    /**
+     * Adds an operation reading and writing the tensors provided, after the
+     * operations added before. The graph is compiled again on its next run.
+     *
+     * @param op The operation to add
+     * @param inputs The tensors read by the operation
+     * @param outputs The tensors written by the operation
+     * @return Index of the operation in the graph
+     */
+    uint32_t add(std::shared_ptr<OpBase> op,
+                 const std::vector<std::shared_ptr<Tensor>>& inputs,
+                 const std::vector<std::shared_ptr<Tensor>>& outputs);
+
+    /**
+     * Adds an operation whose inputs and outputs are the tensors of the
+     * accesses it declares, the tensors with a write access being outputs.
+     *
+     * @param op The operation to add, which must declare its accesses
+     * @return Index of the operation in the graph
+     */
+    uint32_t add(std::shared_ptr<OpBase> op);
+
+    /**
+     * Assigns the operations to the queues and records the sequences of the
+     * graph, waiting for the run in flight first. Called by run when the
+     * graph changed since it was last compiled.
+     */
+    void compile();
+
+    /**
+     * Runs the graph and waits for it to complete.
+     */
+    void run();
+
+    /**
+     * Submits the sequences of the graph, compiling it first if it changed.
+     * A previous run still in flight is awaited first.
+     */
+    void runAsync();
+
+    /**
+     * Waits for the run in flight, if any, to complete.
+     */
+    void await();
+
+    /**
+     * Checks whether the graph has been compiled since its last change.
+     *
+     * @return Boolean stating whether the graph is compiled
+     */
+    bool isCompiled();
+
+    /**
+     * Returns the number of operations added to the graph.
+     *
+     * @return Number of operations
+     */
+    uint32_t operationCount();
+
+    /**
+     * Returns the indices of the operations each operation depends on.
+     *
+     * @param operationIndex The index of the operation
+     * @return Indices of the operations it depends on
+     */
+    const std::vector<uint32_t>& dependencies(uint32_t operationIndex);
+
+    /**
+     * Returns the queue each operation was assigned to by the last compile.
+     *
+     * @return Index of the queue of each operation, from the queue indices
+     * of the graph
+     */
+    std::vector<uint32_t> operationQueues();
+
+    /**
+     * Returns the number of sequences the graph was compiled into.
+     *
+     * @return Number of sequences
+     */
+    uint32_t sequenceCount();
+
+    /**
+     * Returns the number of times the sequences of the graph were recorded,
+     * which only increases when the graph changed between runs.
+     *
+     * @return Number of compiles
+     */
+    uint64_t compileCount();
+
+    /**
+     * Waits for the run in flight and releases the operations and sequences
+     * of the graph.
+     */
+    void destroy();
+
+  private:
+    struct Node
+    {
+        std::shared_ptr<OpBase> op;
+        std::vector<std::shared_ptr<Tensor>> tensors;
+        std::vector<uint32_t> dependencies;
+        uint32_t queue = 0;
+        uint32_t segment = 0;
+    };
+    struct Segment
+    {
+        uint32_t queue = 0;
+        std::vector<uint32_t> nodes;
+        std::vector<uint32_t> waitSegments;
+        std::shared_ptr<Sequence> sequence;
+    };
+    struct TensorState
+    {
+        int64_t lastWriter = -1;
+        std::vector<uint32_t> readers;
+    };
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<uint32_t> mQueueIndices;
+    SequenceFactory mSequenceFactory;
+    std::vector<Node> mNodes;
+    std::vector<Segment> mSegments;
+    // Accesses since the last write to each tensor, views as their parent
+    std::unordered_map<Tensor*, TensorState> mTensorStates;
+    bool mCompiled = false;
+    bool mRunning = false;
+    uint64_t mCompileCount = 0;
+
+    void assignQueues();
+    void createSegments();
+};
+
+} // End namespace kp
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <unordered_map>
+
+#include "kompute/Core.hpp"
+
+#include "kompute/operations/OpBase.hpp"
+
+namespace kp {
+
+/**
+ * Tracks the last accesses to the memory of each tensor while a command
+ * buffer is recorded, and records only the barriers that the accesses of the
+ * next operation require: read after write, write after write and write after
+ * read hazards.
+ *
+ * Views are tracked as the tensor that owns their memory. Accesses from
+ * previous submissions are unknown, so the first access to a tensor waits for
+ * any shader or transfer write made before.
+ */
+class HazardTracker
+{
+  public:
+    /**
+     * Constructor for the tracker of a command buffer.
+     *
+     * @param computeSupported Whether the queue of the command buffer
+     * supports compute, without which the first access to a tensor only
+     * waits for transfer writes, as barriers of transfer queues cannot
+     * reference the compute shader stage
+     */
+    HazardTracker(bool computeSupported = true);
+
+    /**
+     * Records the barriers needed before the accesses of an operation and
+     * updates the state of the tensors accessed. Accesses of the same
+     * operation to the same tensor are combined, as no barrier can be
+     * recorded between them. The barriers of all the tensors are recorded
+     * with a single pipeline barrier, which uses a global memory barrier
+     * when every tensor accessed requires one.
+     *
+     * @param commandBuffer The command buffer to record the barriers into
+     * @param accesses The accesses of the operation to record next
+     */
+    void recordBarriers(const vk::CommandBuffer& commandBuffer,
+                        const std::vector<OpBase::TensorAccess>& accesses);
+
+    /**
+     * Records an operation along with the barriers its accesses require. An
+     * operation that declares no accesses records its own barriers, and resets
+     * the state of the tensors as it may have accessed any of them.
+     *
+     * @param commandBuffer The command buffer to record the operation into
+     * @param op The operation to record
+     */
+    void recordOperation(const vk::CommandBuffer& commandBuffer,
+                         std::shared_ptr<OpBase> op);
+
+    /**
+     * Forgets the state of all the tensors, so their next access waits for
+     * any write made before, as when an operation with undeclared accesses
+     * is recorded.
+     */
+    void reset();
+
+    /**
+     * Total number of pipeline barrier commands recorded since the tracker
+     * was created.
+     *
+     * @return Number of pipeline barriers recorded
+     */
+    uint64_t barrierCount();
+
+  private:
+    struct State
+    {
+        // Write not yet made visible to every later access
+        vk::PipelineStageFlags writeStageMask;
+        vk::AccessFlags writeAccessMask;
+        // Stages and accesses the last write has been made visible to
+        vk::PipelineStageFlags visibleStageMask;
+        vk::AccessFlags visibleAccessMask;
+        // Stages that read the tensor since the last write
+        vk::PipelineStageFlags readStageMask;
+    };
+
+    std::unordered_map<Tensor*, State> mStates;
+    uint64_t mBarrierCount = 0;
+    bool mComputeSupported = true;
+};
+
+} // End namespace kp
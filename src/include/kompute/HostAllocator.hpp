@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "kompute/Core.hpp"
+
+namespace kp {
+
+/**
+ * Host allocation callbacks passed to every Vulkan create and destroy call
+ * of the components created by a manager, which track the memory the driver
+ * allocates on the host so it can be measured around any operation.
+ *
+ * The allocations are served by the heap, or by the callbacks provided by
+ * the user, such as those of an engine's own allocator. Allocations with the
+ * command scope, which only live during a single Vulkan command such as a
+ * pipeline creation or a submission, can be served by a bump arena instead,
+ * whose offset is rewound once all of them are freed.
+ */
+class HostAllocator
+{
+  public:
+    /**
+     * Values of the counters of the allocator at a point in time.
+     */
+    struct Stats
+    {
+        uint64_t allocations = 0;         ///< Including reallocations
+        uint64_t frees = 0;               ///< Including reallocations
+        uint64_t arenaAllocations = 0;    ///< Served by the arena
+        uint64_t liveBytes = 0;           ///< Allocated and not yet freed
+        uint64_t peakBytes = 0;           ///< Highest liveBytes
+        uint64_t totalBytes = 0;          ///< Allocated since the reset
+        uint64_t internalAllocations = 0; ///< Notified by the driver
+        uint64_t internalBytes = 0;       ///< Live internal allocations
+    };
+
+    /**
+     * Constructor for an allocator over the heap.
+     *
+     * @param arenaSize Size of the arena of the command scope allocations, or
+     * 0 to serve them from the heap
+     */
+    HostAllocator(size_t arenaSize = 0);
+
+    /**
+     * Constructor for an allocator forwarding to callbacks provided by the
+     * user, which are tracked the same way. The internal allocation
+     * notifications are forwarded as well.
+     *
+     * @param callbacks The callbacks the allocations are forwarded to, which
+     * must outlive the allocator
+     * @param arenaSize Size of the arena of the command scope allocations, or
+     * 0 to forward them too
+     */
+    HostAllocator(const vk::AllocationCallbacks& callbacks,
+                  size_t arenaSize = 0);
+
+    /**
+     * Destructor which frees the arena. The objects created with the
+     * allocator must have been destroyed.
+     */
+    ~HostAllocator();
+
+    HostAllocator(const HostAllocator&) = delete;
+    HostAllocator& operator=(const HostAllocator&) = delete;
+
+    /**
+     * The callbacks passed to Vulkan, pointing to this allocator.
+     *
+     * @return Reference to the callbacks of the allocator
+     */
+    const vk::AllocationCallbacks& allocationCallbacks() const;
+
+    /**
+     * The callbacks of an allocator in the form taken by the Vulkan create
+     * and destroy calls, used by the components for their own objects.
+     *
+     * @param hostAllocator The allocator, which can be null
+     * @return The callbacks, or null for the default allocation of the driver
+     */
+    static vk::Optional<const vk::AllocationCallbacks> callbacks(
+      const std::shared_ptr<HostAllocator>& hostAllocator);
+
+    /**
+     * Reads the counters. They are read one after the other, so the stats
+     * may miss the allocations made while they are read.
+     *
+     * @return The values of the counters
+     */
+    Stats stats() const;
+
+    /**
+     * Sets the cumulative counters back to zero and the peak back to the
+     * live bytes, for example before the operation to measure.
+     */
+    void resetStats();
+
+  private:
+    struct Header;
+
+    vk::AllocationCallbacks mCallbacks;
+    vk::AllocationCallbacks mUpstream;
+    bool mHasUpstream = false;
+
+    // -------------- ARENA OF THE COMMAND SCOPE
+    std::mutex mArenaMutex;
+    std::vector<char> mArena;
+    size_t mArenaOffset = 0;
+    size_t mArenaLiveCount = 0;
+
+    // -------------- COUNTERS
+    std::atomic<uint64_t> mAllocations{ 0 };
+    std::atomic<uint64_t> mFrees{ 0 };
+    std::atomic<uint64_t> mArenaAllocations{ 0 };
+    std::atomic<uint64_t> mLiveBytes{ 0 };
+    std::atomic<uint64_t> mPeakBytes{ 0 };
+    std::atomic<uint64_t> mTotalBytes{ 0 };
+    std::atomic<uint64_t> mInternalAllocations{ 0 };
+    std::atomic<uint64_t> mInternalBytes{ 0 };
+
+    void* allocate(size_t size,
+                   size_t alignment,
+                   VkSystemAllocationScope allocationScope);
+    void* reallocate(void* original,
+                     size_t size,
+                     size_t alignment,
+                     VkSystemAllocationScope allocationScope);
+    void deallocate(void* memory);
+    void* allocateArena(size_t size, size_t alignment);
+
+    static VKAPI_ATTR void* VKAPI_CALL allocateCallback(
+      void* userData,
+      size_t size,
+      size_t alignment,
+      VkSystemAllocationScope allocationScope);
+    static VKAPI_ATTR void* VKAPI_CALL reallocateCallback(
+      void* userData,
+      void* original,
+      size_t size,
+      size_t alignment,
+      VkSystemAllocationScope allocationScope);
+    static VKAPI_ATTR void VKAPI_CALL freeCallback(void* userData,
+                                                   void* memory);
+    static VKAPI_ATTR void VKAPI_CALL internalAllocationCallback(
+      void* userData,
+      size_t size,
+      VkInternalAllocationType allocationType,
+      VkSystemAllocationScope allocationScope);
+    static VKAPI_ATTR void VKAPI_CALL internalFreeCallback(
+      void* userData,
+      size_t size,
+      VkInternalAllocationType allocationType,
+      VkSystemAllocationScope allocationScope);
+};
+
+} // End namespace kp
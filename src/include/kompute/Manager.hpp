@@ -1,12 +1,31 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
+#include <future>
+#include <mutex>
 #include <set>
 #include <unordered_map>
 
 #include "kompute/Core.hpp"
 
+#include "kompute/Block.hpp"
+#include "kompute/CompletionWaiter.hpp"
+#include "kompute/DebugUtils.hpp"
+#include "kompute/DescriptorAllocator.hpp"
+#include "kompute/DeviceInfo.hpp"
+#include "kompute/Graph.hpp"
+#include "kompute/HostAllocator.hpp"
+#include "kompute/MemoryPool.hpp"
+#include "kompute/Metrics.hpp"
+#include "kompute/ResourceRegistry.hpp"
+#include "kompute/Scheduler.hpp"
 #include "kompute/Sequence.hpp"
+#include "kompute/ShaderCache.hpp"
+#include "kompute/SparseTensor.hpp"
+#include "kompute/StagingRing.hpp"
+#include "kompute/StreamPipeline.hpp"
+#include "kompute/SubmitBatch.hpp"
+#include "kompute/WorkerPool.hpp"
 
 #define KP_DEFAULT_SESSION "DEFAULT"
 
@@ -14,10 +33,71 @@ namespace kp {
 
 /**
     Base orchestrator which creates and manages device and child components
+
+    Tensors, algorithms, sequences and blocks can be created from several
+    threads at the same time, and clear() can run alongside them. Each queue
+    is submitted to by one thread at a time, as Vulkan requires, by the
+    sequences, batches and staging ring of the manager. A sequence itself,
+    and the sequences sharing a command pool, must still be recorded and
+    evaluated by one thread at a time.
 */
 class Manager
 {
   public:
+    /**
+     * Memory usage of the device and of the tensors created by the manager.
+     */
+    struct MemoryStats
+    {
+        std::vector<MemoryPool::HeapStats> heaps; ///< Indexed by heap index
+        uint32_t tensorCount = 0; ///< Live tensors owning their memory
+        uint32_t viewCount = 0;   ///< Live views aliasing other tensors
+        vk::DeviceSize primaryMemorySize = 0; ///< Bytes of primary buffers
+        vk::DeviceSize stagingMemorySize = 0; ///< Bytes of staging buffers
+    };
+
+    /**
+     * Role of a queue of the manager, which selects the queue a sequence is
+     * submitted to without knowing the queue families of the device. A role
+     * without a dedicated queue family falls back to the compute queue.
+     */
+    enum class QueueRole
+    {
+        eCompute = 0,      ///< First queue family supporting compute
+        eAsyncCompute = 1, ///< Compute queue family without graphics
+        eTransfer = 2,     ///< Transfer queue family without compute
+        eHighPriority = 3, ///< Compute queue with the highest priority
+    };
+
+    /**
+     * Priority of a queue requested by the manager. The priority orders the
+     * queues of the device, while the global priority orders the queues of
+     * the device against the queues of other processes, and is requested
+     * through VK_KHR_global_priority or VK_EXT_global_priority when the
+     * device supports one of them. Vulkan applies the global priority to a
+     * queue family, so a family gets the highest global priority among its
+     * queues.
+     */
+    struct QueuePriority
+    {
+        float priority = 1.0f; ///< From 0 to 1, relative to the device queues
+        vk::QueueGlobalPriorityEXT globalPriority =
+          vk::QueueGlobalPriorityEXT::eMedium; ///< Relative to other processes
+    };
+
+    /**
+     * Requirements of the physical device to select by capabilities rather
+     * than by index, see Manager::selectDevice.
+     */
+    struct DeviceRequirements
+    {
+        std::vector<std::string> extensions; ///< Required, and enabled
+        vk::PhysicalDeviceFeatures features; ///< Features set are required
+        uint32_t minSubgroupSize = 0; ///< Minimum subgroup size
+        vk::SubgroupFeatureFlags subgroupOperations; ///< Required in compute
+        bool allowCpu = true; ///< Whether CPU devices such as llvmpipe count
+    };
+
     /**
         Base constructor and default used which creates the base resources
        including choosing the device 0 by default.
@@ -28,15 +108,59 @@ class Manager
      * Similar to base constructor but allows for further configuration to use
      * when creating the Vulkan resources.
      *
+     * The Vulkan instance is shared by the managers of the process created
+     * without host allocator, which skips its creation and the enumeration of
+     * the layers and extensions for all but the first of them. It is
+     * destroyed along with the last of them.
+     *
      * @param physicalDeviceIndex The index of the physical device to use
      * @param familyQueueIndices (Optional) List of queue indices to add for
-     * explicit allocation
+     * explicit allocation. If empty, a queue of the first compute family is
+     * created along with a queue of the dedicated compute family and of the
+     * transfer only family when the device has them, see QueueRole
      * @param desiredExtensions The desired extensions to load from
      * physicalDevice
+     * @param pipelineCachePath (Optional) File previously written by
+     * savePipelineCache to preload the pipeline cache from, which is ignored
+     * if missing or created for a different device
+     * @param queuePriorities (Optional) Priority of each queue, in the order
+     * of the family queue indices or of the queues created by default. If
+     * empty, every queue has a priority of 1 and the default global priority
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy every Vulkan object of the manager and its components with,
+     * including the instance and the device
      */
     Manager(uint32_t physicalDeviceIndex,
             const std::vector<uint32_t>& familyQueueIndices = {},
-            const std::vector<std::string>& desiredExtensions = {});
+            const std::vector<std::string>& desiredExtensions = {},
+            const std::string& pipelineCachePath = "",
+            const std::vector<QueuePriority>& queuePriorities = {},
+            std::shared_ptr<HostAllocator> hostAllocator = nullptr);
+
+    /**
+     * Constructor selecting the physical device with the highest score for
+     * the requirements provided, instead of a device index, see selectDevice.
+     * The extensions of the requirements are enabled on the device.
+     *
+     * @param requirements The requirements of the physical device to select
+     * @param familyQueueIndices (Optional) List of queue indices to add for
+     * explicit allocation, see the constructor with a device index
+     * @param desiredExtensions The desired extensions to load from
+     * physicalDevice in addition to the required ones
+     * @param pipelineCachePath (Optional) File previously written by
+     * savePipelineCache to preload the pipeline cache from
+     * @param queuePriorities (Optional) Priority of each queue, see the
+     * constructor with a device index
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy every Vulkan object of the manager and its components with,
+     * including the instance and the device
+     */
+    Manager(const DeviceRequirements& requirements,
+            const std::vector<uint32_t>& familyQueueIndices = {},
+            const std::vector<std::string>& desiredExtensions = {},
+            const std::string& pipelineCachePath = "",
+            const std::vector<QueuePriority>& queuePriorities = {},
+            std::shared_ptr<HostAllocator> hostAllocator = nullptr);
 
     /**
      * Manager constructor which allows your own vulkan application to integrate
@@ -46,10 +170,21 @@ class Manager
      * @param physicalDevice Vulkan physical device to use for application
      * @param device Vulkan logical device to use for all base resources
      * @param physicalDeviceIndex Index for vulkan physical device used
+     * @param pipelineCachePath (Optional) File previously written by
+     * savePipelineCache to preload the pipeline cache from
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy every Vulkan object of the manager and its components with,
+     * which should be the callbacks the device was created with
+     * @param enabledFeatures (Optional) Core features the device was created
+     * with, such as pipelineStatisticsQuery for the pipeline statistics of
+     * sequences. Features left out are treated as disabled.
      */
     Manager(std::shared_ptr<vk::Instance> instance,
             std::shared_ptr<vk::PhysicalDevice> physicalDevice,
-            std::shared_ptr<vk::Device> device);
+            std::shared_ptr<vk::Device> device,
+            const std::string& pipelineCachePath = "",
+            std::shared_ptr<HostAllocator> hostAllocator = nullptr,
+            const vk::PhysicalDeviceFeatures& enabledFeatures = {});
 
     /**
      * Manager destructor which would ensure all owned resources are destroyed
@@ -64,10 +199,151 @@ class Manager
      * @param queueIndex The queue to use from the available queues
      * @param nrOfTimestamps The maximum number of timestamps to allocate.
      * If zero (default), disables latching of timestamps.
+     * @param inFlightDepth The number of evalAsync submissions the sequence
+     * can have in flight at the same time, 1 by default
+     * @param shareCommandPool Whether to allocate the command buffers from a
+     * command pool shared by the sequences of the same queue family, owned by
+     * the manager, instead of creating a pool for the sequence. Sequences
+     * sharing a pool must not be recorded from different threads at once.
+     * @param totalPipelineStatistics The number of operations whose compute
+     * shader invocations are counted when they dispatch an algorithm, see
+     * Sequence::getOpTimings. If zero (default), disables the statistics.
      * @returns Shared pointer with initialised sequence
      */
     std::shared_ptr<Sequence> sequence(uint32_t queueIndex = 0,
-                                       uint32_t totalTimestamps = 0);
+                                       uint32_t totalTimestamps = 0,
+                                       uint32_t inFlightDepth = 1,
+                                       bool shareCommandPool = false,
+                                       uint32_t totalPipelineStatistics = 0);
+
+    /**
+     * Create a managed sequence submitted to the queue of a role. Sequences
+     * of the transfer role can only record operations that copy or sync
+     * tensors, as their queue may not support compute.
+     *
+     * @param queueRole The role of the queue to use
+     * @param nrOfTimestamps The maximum number of timestamps to allocate.
+     * If zero (default), disables latching of timestamps.
+     * @param inFlightDepth The number of evalAsync submissions the sequence
+     * can have in flight at the same time, 1 by default
+     * @param shareCommandPool Whether to allocate the command buffers from a
+     * command pool shared by the sequences of the same queue family
+     * @param totalPipelineStatistics The number of operations whose compute
+     * shader invocations are counted when they dispatch an algorithm
+     * @returns Shared pointer with initialised sequence
+     */
+    std::shared_ptr<Sequence> sequence(QueueRole queueRole,
+                                       uint32_t totalTimestamps = 0,
+                                       uint32_t inFlightDepth = 1,
+                                       bool shareCommandPool = false,
+                                       uint32_t totalPipelineStatistics = 0);
+
+    /**
+     * Index of the queue used for a role, which can be passed to the
+     * functions taking a queue index.
+     *
+     * @param queueRole The role of the queue
+     * @returns Index of the queue, the index of the compute queue if the
+     * device has no dedicated queue family for the role
+     */
+    uint32_t queueIndex(QueueRole queueRole);
+
+    /**
+     * Priority requested for a queue when the manager created the device.
+     *
+     * @param queueIndex The queue from the available queues
+     * @returns Priority of the queue
+     */
+    QueuePriority queuePriority(uint32_t queueIndex);
+
+    /**
+     * Submits the recorded operations of the sequence as with evalAsync, and
+     * runs the callback once the submission completes and has been awaited.
+     * The fences of all the sequences submitted this way are waited for by a
+     * single thread owned by the manager, which also runs the callbacks.
+     * The sequence must not be used until the callback runs.
+     *
+     * @param sequence The sequence to submit
+     * @param callback The function to run with the sequence once completed
+     */
+    void evalAsync(std::shared_ptr<Sequence> sequence,
+                   std::function<void(std::shared_ptr<Sequence>)> callback);
+
+    /**
+     * Submits the recorded operations of the sequence as with evalAsync,
+     * returning a future that becomes ready once the submission completes
+     * and has been awaited by the thread owned by the manager. The sequence
+     * must not be used until the future is ready.
+     *
+     * @param sequence The sequence to submit
+     * @returns Future holding the sequence, or the exception of evalAwait
+     */
+    std::future<std::shared_ptr<Sequence>> evalAsync(
+      std::shared_ptr<Sequence> sequence);
+
+    /**
+     * Submits the recorded operations of the sequence as with evalAsync, and
+     * runs the completion once the submission completes and has been awaited,
+     * with the exception of evalAwait if any. Like the callback it runs on
+     * the thread owned by the manager, which lets bindings forward the result
+     * to another thread, such as to the future of an event loop.
+     *
+     * @param sequence The sequence to submit
+     * @param completion The function to run with the sequence and the
+     * exception, null if none, once completed
+     */
+    void evalAsync(
+      std::shared_ptr<Sequence> sequence,
+      std::function<void(std::shared_ptr<Sequence>, std::exception_ptr)>
+        completion);
+
+    /**
+     * Create a managed block of operations recorded into a secondary command
+     * buffer, which can be recorded into the sequences of the same queue
+     * without recording its operations again.
+     *
+     * @param queueIndex The queue of the sequences the block is recorded into
+     * @returns Shared pointer with initialised block
+     */
+    std::shared_ptr<Block> block(uint32_t queueIndex = 0);
+
+    /**
+     * Submits the recorded operations of several sequences at once. The
+     * sequences targeting the same queue are grouped into a single queue
+     * submit signaling a single fence, which reduces the submission overhead
+     * when many small sequences are sent together.
+     *
+     * @param sequences The sequences to submit, each as with evalAsync
+     * @returns Shared pointer to the batch which can be awaited as a group
+     */
+    std::shared_ptr<SubmitBatch> submit(
+      const std::vector<std::shared_ptr<Sequence>>& sequences);
+
+    /**
+     * Create a scheduler distributing the operations of independent
+     * sequences across all the queues of the manager supporting compute,
+     * with sequences of its own on each queue. The submissions are awaited
+     * by the thread owned by the manager that also awaits evalAsync.
+     *
+     * @param sequencesPerQueue The number of submissions each queue can run
+     * at the same time
+     * @returns Shared pointer with initialised scheduler
+     */
+    std::shared_ptr<Scheduler> scheduler(uint32_t sequencesPerQueue = 2);
+
+    /**
+     * Create a graph of operations compiled into sequences of the manager
+     * spread across the queues provided. The graph must not be compiled once
+     * the manager is destroyed.
+     *
+     * @param queueIndices (Optional) The queues the operations can run on,
+     * which must support compute. If empty, all the queues of the manager
+     * supporting compute are used when the device supports timeline
+     * semaphores, and the compute queue otherwise
+     * @returns Shared pointer with initialised graph
+     */
+    std::shared_ptr<Graph> graph(
+      const std::vector<uint32_t>& queueIndices = {});
 
     /**
      * Create a managed tensor that will be destroyed by this manager
@@ -75,53 +351,171 @@ class Manager
      *
      * @param data The data to initialize the tensor with
      * @param tensorType The type of tensor to initialize
+     * @param hostMemoryType The type of host visible memory to use
      * @returns Shared pointer with initialised tensor
      */
     template<typename T>
     std::shared_ptr<TensorT<T>> tensorT(
       const std::vector<T>& data,
-      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice)
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice,
+      Tensor::HostMemoryTypes hostMemoryType =
+        Tensor::HostMemoryTypes::eCoherent)
     {
         KP_LOG_DEBUG("Kompute Manager tensor creation triggered");
 
-        std::shared_ptr<TensorT<T>> tensor{ new kp::TensorT<T>(
-          this->mPhysicalDevice, this->mDevice, data, tensorType) };
-
-        if (this->mManageResources) {
-            this->mManagedTensors.push_back(tensor);
-        }
-
-        return tensor;
+        return this->manage(
+          *this->mManagedTensors,
+          new kp::TensorT<T>(this->mPhysicalDevice,
+                             this->mDevice,
+                             data,
+                             tensorType,
+                             hostMemoryType,
+                             this->mMemoryPool,
+                             this->mStagingRing,
+                             this->sharedQueueFamilyIndices(),
+                             this->mDebugUtils,
+                             this->mMetrics,
+                             this->mHostAllocator,
+                             this->mDeviceInfo));
     }
 
     std::shared_ptr<TensorT<float>> tensor(
       const std::vector<float>& data,
-      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice)
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice,
+      Tensor::HostMemoryTypes hostMemoryType =
+        Tensor::HostMemoryTypes::eCoherent)
     {
-        return this->tensorT<float>(data, tensorType);
+        return this->tensorT<float>(data, tensorType, hostMemoryType);
     }
 
     std::shared_ptr<Tensor> tensor(
       void* data,
-      uint32_t elementTotalCount,
+      uint64_t elementTotalCount,
       uint32_t elementMemorySize,
       const Tensor::TensorDataTypes& dataType,
-      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice)
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice,
+      Tensor::HostMemoryTypes hostMemoryType =
+        Tensor::HostMemoryTypes::eCoherent)
     {
-        std::shared_ptr<Tensor> tensor{ new kp::Tensor(this->mPhysicalDevice,
-                                                       this->mDevice,
-                                                       data,
-                                                       elementTotalCount,
-                                                       elementMemorySize,
-                                                       dataType,
-                                                       tensorType) };
+        return this->manage(
+          *this->mManagedTensors,
+          new kp::Tensor(this->mPhysicalDevice,
+                         this->mDevice,
+                         data,
+                         elementTotalCount,
+                         elementMemorySize,
+                         dataType,
+                         tensorType,
+                         hostMemoryType,
+                         this->mMemoryPool,
+                         this->mStagingRing,
+                         this->sharedQueueFamilyIndices(),
+                         this->mDebugUtils,
+                         this->mMetrics,
+                         this->mHostAllocator,
+                         this->mDeviceInfo));
+    }
 
-        if (this->mManageResources) {
-            this->mManagedTensors.push_back(tensor);
-        }
+    /**
+     * Create a managed tensor that only allocates its GPU memory, without any
+     * host data to initialise it from. This is intended for output and
+     * scratch tensors, including tensors of type eStorage, and for tensors
+     * whose data is written directly in their mapped host memory through
+     * rawData, which avoids copying it from an intermediate buffer.
+     *
+     * @param elementTotalCount The number of elements of the tensor
+     * @param dataType The data type of the elements of the tensor
+     * @param tensorType The type of tensor to initialize
+     * @param zeroInitialise Whether to zero the memory, which is done on the
+     * GPU with a fill command rather than on the host
+     * @param hostMemoryType The type of host visible memory to use
+     * @returns Shared pointer with initialised tensor
+     */
+    std::shared_ptr<Tensor> tensor(
+      uint64_t elementTotalCount,
+      const Tensor::TensorDataTypes& dataType,
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice,
+      bool zeroInitialise = false,
+      Tensor::HostMemoryTypes hostMemoryType =
+        Tensor::HostMemoryTypes::eCoherent);
 
-        return tensor;
-    }
+    /**
+     * Create a managed tensor of type eImage, holding its data in a 2D image
+     * bound as a storage image by algorithms. When the manager was created
+     * from the device of a renderer, the image can be sampled by the
+     * renderer without copying it. The data must be synced to the image with
+     * OpTensorSyncDevice, or the image filled with OpTensorFill, before
+     * shaders access it.
+     *
+     * @param data Data of width * height * channels elements in row major
+     * order, or null to leave the host data uninitialised
+     * @param width Width of the image in texels
+     * @param height Height of the image in texels
+     * @param channels Number of channels of a texel, which is 1, 2 or 4
+     * @param dataType The data type of the channels
+     * @param hostMemoryType The type of host visible memory to use
+     * @returns Shared pointer with initialised tensor
+     */
+    std::shared_ptr<Tensor> image(void* data,
+                                  uint32_t width,
+                                  uint32_t height,
+                                  uint32_t channels,
+                                  const Tensor::TensorDataTypes& dataType,
+                                  Tensor::HostMemoryTypes hostMemoryType =
+                                    Tensor::HostMemoryTypes::eCoherent);
+
+    /**
+     * Create a sparse CSR matrix made of three managed tensors, holding the
+     * row pointers, the column indices and the values of the non zeros. The
+     * arrays are checked to describe a valid matrix and copied into the host
+     * memory of the tensors, which have to be synced to the device with
+     * OpTensorSyncDevice before shaders access them.
+     *
+     * @param rows The number of rows of the matrix
+     * @param columns The number of columns of the matrix
+     * @param nonZeroCount The number of non zeros of the matrix
+     * @param rowPointers Array of rows + 1 indices of the first non zero of
+     * each row, followed by the number of non zeros
+     * @param columnIndices Array of the column of each non zero
+     * @param values Array of the value of each non zero
+     * @param tensorType The type of the tensors, eDevice or eHost
+     * @returns Shared pointer with initialised sparse tensor
+     */
+    std::shared_ptr<SparseTensor> sparseTensor(
+      uint32_t rows,
+      uint32_t columns,
+      uint32_t nonZeroCount,
+      const uint32_t* rowPointers,
+      const uint32_t* columnIndices,
+      const float* values,
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice);
+
+    std::shared_ptr<SparseTensor> sparseTensor(
+      uint32_t rows,
+      uint32_t columns,
+      const std::vector<uint32_t>& rowPointers,
+      const std::vector<uint32_t>& columnIndices,
+      const std::vector<float>& values,
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice);
+
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+    /**
+     * Create a managed tensor importing the memory of an Android hardware
+     * buffer, such as a camera frame, which shaders then read without it
+     * being copied into a vector and a staging buffer first. The manager
+     * must have been created with the
+     * VK_ANDROID_external_memory_android_hardware_buffer extension, and the
+     * buffer must be a blob with GPU data buffer usage.
+     *
+     * @param hardwareBuffer The hardware buffer to import, referenced by the
+     * tensor until it is destroyed
+     * @param dataType The data type of the elements of the buffer
+     * @returns Shared pointer with initialised tensor, of type eHost if the
+     * buffer can be mapped and eStorage otherwise
+     */
+    std::shared_ptr<Tensor> tensor(AHardwareBuffer* hardwareBuffer,
+                                   const Tensor::TensorDataTypes& dataType);
+#endif
 
     /**
      * Default non-template function that can be used to create algorithm objects
@@ -135,6 +529,8 @@ class Manager
      * specialization constants, and defaults to an empty constant
      * @param pushConstants (optional) float vector to use for push constants,
      * and defaults to an empty constant
+     * @param bindingMode (optional) How the tensors are passed to the shader,
+     * see Algorithm::BindingModes
      * @returns Shared pointer with initialised algorithm
      */
     std::shared_ptr<Algorithm> algorithm(
@@ -142,9 +538,47 @@ class Manager
       const std::vector<uint32_t>& spirv = {},
       const Workgroup& workgroup = {},
       const std::vector<float>& specializationConstants = {},
-      const std::vector<float>& pushConstants = {})
+      const std::vector<float>& pushConstants = {},
+      Algorithm::BindingModes bindingMode =
+        Algorithm::BindingModes::eDescriptors)
+    {
+        return this->algorithm<>(tensors,
+                                 spirv,
+                                 workgroup,
+                                 specializationConstants,
+                                 pushConstants,
+                                 bindingMode);
+    }
+
+    /**
+     * Create a managed view that aliases a range of elements of a parent
+     * tensor, sharing its buffers and memory so operations and algorithms
+     * can run in place on slices of a larger allocation.
+     *
+     * @param parent The tensor owning the memory to alias
+     * @param offset Index of the first element of the parent in the view
+     * @param count Number of elements of the view
+     * @returns Shared pointer with initialised tensor view
+     */
+    template<typename T>
+    std::shared_ptr<TensorT<T>> tensorView(std::shared_ptr<TensorT<T>> parent,
+                                           uint64_t offset,
+                                           uint64_t count)
+    {
+        KP_LOG_DEBUG("Kompute Manager tensor view creation triggered");
+
+        return this->manage(*this->mManagedTensors,
+                            new kp::TensorT<T>(parent, offset, count));
+    }
+
+    std::shared_ptr<Tensor> tensorView(std::shared_ptr<Tensor> parent,
+                                       uint64_t offset,
+                                       uint64_t count)
     {
-        return this->algorithm<>(tensors, spirv, workgroup, specializationConstants, pushConstants);
+        KP_LOG_DEBUG("Kompute Manager tensor view creation triggered");
+
+        return this->manage(*this->mManagedTensors,
+                            new kp::Tensor(parent, offset, count));
     }
 
     /**
@@ -159,6 +593,8 @@ class Manager
      * specialization constants, and defaults to an empty constant
      * @param pushConstants (optional) templatable vector parameter to use for push constants,
      * and defaults to an empty constant
+     * @param bindingMode (optional) How the tensors are passed to the shader,
+     * with BindingModes::eDeviceAddresses requiring hasBufferDeviceAddress
      * @returns Shared pointer with initialised algorithm
      */
     template<typename S = float, typename P = float>
@@ -167,33 +603,180 @@ class Manager
       const std::vector<uint32_t>& spirv,
       const Workgroup& workgroup,
       const std::vector<S>& specializationConstants,
-      const std::vector<P>& pushConstants)
+      const std::vector<P>& pushConstants,
+      Algorithm::BindingModes bindingMode =
+        Algorithm::BindingModes::eDescriptors)
     {
 
         KP_LOG_DEBUG("Kompute Manager algorithm creation triggered");
 
-        std::shared_ptr<Algorithm> algorithm{ new kp::Algorithm(
-          this->mDevice,
-          tensors,
-          spirv,
-          workgroup,
-          specializationConstants,
-          pushConstants) };
+        uint32_t maxPushConstantsSize =
+          this->mDeviceInfo->properties().limits.maxPushConstantsSize;
+        return this->manage(*this->mManagedAlgorithms,
+                            new kp::Algorithm(this->mDevice,
+                                              tensors,
+                                              spirv,
+                                              workgroup,
+                                              specializationConstants,
+                                              pushConstants,
+                                              this->mPipelineCache,
+                                              this->mShaderCache,
+                                              this->mDescriptorAllocator,
+                                              this->mDefaultLocalSize,
+                                              this->mDebugUtils,
+                                              this->mMetrics,
+                                              this->mHostAllocator,
+                                              bindingMode,
+                                              maxPushConstantsSize));
+    }
 
-        if (this->mManageResources) {
-            this->mManagedAlgorithms.push_back(algorithm);
-        }
+    /**
+     * Create a managed algorithm like algorithm, whose resources are created
+     * and its pipeline compiled on a pool of worker threads owned by the
+     * manager, so many algorithms can be compiled in parallel. The algorithm
+     * is returned right away, and its functions block until it is built the
+     * first time they are called, rethrowing the exception of the build if
+     * it failed.
+     *
+     * @param tensors The tensors to initialise the algorithm with
+     * @param spirv The spirv bytes for the shader to run
+     * @param workgroup (optional) kp::Workgroup for number of dispatches
+     * @param specializationConstants (optional) templatable vector parameter to
+     * use for specialization constants, and defaults to an empty constant
+     * @param pushConstants (optional) templatable vector parameter to use for
+     * push constants, and defaults to an empty constant
+     * @param bindingMode (optional) How the tensors are passed to the shader,
+     * see Algorithm::BindingModes
+     * @returns Shared pointer with the algorithm being built
+     */
+    template<typename S = float, typename P = float>
+    std::shared_ptr<Algorithm> algorithmAsync(
+      const std::vector<std::shared_ptr<Tensor>>& tensors,
+      const std::vector<uint32_t>& spirv,
+      const Workgroup& workgroup = {},
+      const std::vector<S>& specializationConstants = {},
+      const std::vector<P>& pushConstants = {},
+      Algorithm::BindingModes bindingMode =
+        Algorithm::BindingModes::eDescriptors)
+    {
+        KP_LOG_DEBUG("Kompute Manager asynchronous algorithm creation "
+                     "triggered");
+
+        uint32_t maxPushConstantsSize =
+          this->mDeviceInfo->properties().limits.maxPushConstantsSize;
+        std::shared_ptr<Algorithm> algorithm =
+          this->manage(*this->mManagedAlgorithms,
+                       new kp::Algorithm(this->mDevice,
+                                         {},
+                                         {},
+                                         {},
+                                         std::vector<S>(),
+                                         std::vector<P>(),
+                                         this->mPipelineCache,
+                                         this->mShaderCache,
+                                         this->mDescriptorAllocator,
+                                         this->mDefaultLocalSize,
+                                         this->mDebugUtils,
+                                         this->mMetrics,
+                                         this->mHostAllocator,
+                                         bindingMode,
+                                         maxPushConstantsSize));
+
+        algorithm->rebuildAsync(*this->workerPool(),
+                                tensors,
+                                spirv,
+                                workgroup,
+                                specializationConstants,
+                                pushConstants);
 
         return algorithm;
     }
 
+    /**
+     * Create a pipeline streaming chunks of host data through an algorithm,
+     * with the tensors, algorithm and sequences of each chunk in flight. The
+     * uploads and downloads run on the transfer queue, overlapping with the
+     * dispatches, when the device has a dedicated transfer queue and
+     * timeline semaphores.
+     *
+     * @param spirv The spirv bytes of the shader run on each chunk, whose
+     * bindings are the inputs followed by the outputs
+     * @param chunkSize The number of elements of each tensor of a chunk
+     * @param inputCount (optional) The number of input tensors of a chunk
+     * @param outputCount (optional) The number of output tensors of a chunk
+     * @param depth (optional) The number of chunks in flight at the same
+     * time, three to overlap an upload, a dispatch and a download
+     * @param workgroup (optional) kp::Workgroup of the algorithm, which
+     * defaults to (chunkSize, 1, 1)
+     * @param specializationConstants (optional) templatable vector parameter
+     * to use for specialization constants
+     * @param pushConstants (optional) templatable vector parameter to use for
+     * push constants
+     * @returns Shared pointer with initialised stream pipeline
+     */
+    template<typename T, typename S = float, typename P = float>
+    std::shared_ptr<StreamPipeline> streamPipeline(
+      const std::vector<uint32_t>& spirv,
+      uint64_t chunkSize,
+      uint32_t inputCount = 1,
+      uint32_t outputCount = 1,
+      uint32_t depth = 3,
+      const Workgroup& workgroup = {},
+      const std::vector<S>& specializationConstants = {},
+      const std::vector<P>& pushConstants = {})
+    {
+        KP_LOG_DEBUG("Kompute Manager stream pipeline creation triggered");
+
+        if (!depth || !chunkSize) {
+            throw std::runtime_error(
+              "Kompute Manager stream pipeline requires a depth and a chunk "
+              "size");
+        }
+
+        // Transfers only overlap with the dispatches on a queue of their own
+        uint32_t computeQueue = this->queueIndex(QueueRole::eCompute);
+        uint32_t transferQueue = this->queueIndex(QueueRole::eTransfer);
+        bool transferSequences =
+          this->mTimelineSemaphores && transferQueue != computeQueue;
+
+        std::vector<StreamPipeline::Slot> slots(depth);
+        for (StreamPipeline::Slot& slot : slots) {
+            for (uint32_t i = 0; i < inputCount; i++) {
+                slot.inputs.push_back(
+                  this->tensorT<T>(std::vector<T>(chunkSize)));
+            }
+            for (uint32_t i = 0; i < outputCount; i++) {
+                slot.outputs.push_back(
+                  this->tensorT<T>(std::vector<T>(chunkSize)));
+            }
+
+            std::vector<std::shared_ptr<Tensor>> tensors = slot.inputs;
+            tensors.insert(
+              tensors.end(), slot.outputs.begin(), slot.outputs.end());
+            slot.algorithm = this->algorithm(tensors,
+                                             spirv,
+                                             workgroup,
+                                             specializationConstants,
+                                             pushConstants);
+
+            slot.compute = this->sequence(computeQueue);
+            if (transferSequences) {
+                slot.upload = this->sequence(transferQueue);
+                slot.download = this->sequence(transferQueue);
+            }
+        }
+
+        return std::make_shared<StreamPipeline>(slots, chunkSize);
+    }
+
     /**
      * Destroy the GPU resources and all managed resources by manager.
      **/
     void destroy();
     /**
-     * Run a pseudo-garbage collection to release all the managed resources
-     * that have been already freed due to these reaching to zero ref count.
+     * Release the cached resources no longer in use, such as the shader
+     * modules of destroyed algorithms. Managed resources remove themselves
+     * from the manager once their reference count reaches zero.
      **/
     void clear();
 
@@ -211,6 +794,218 @@ class Manager
      **/
     std::vector<vk::PhysicalDevice> listDevices() const;
 
+    /**
+     * Select the device of the instance with the highest score for the
+     * requirements provided, see scoreDevice.
+     *
+     * @param requirements The requirements of the physical device
+     * @return Index of the selected device in listDevices
+     **/
+    uint32_t selectDevice(const DeviceRequirements& requirements) const;
+
+    /**
+     * Score a physical device against requirements. Discrete GPUs score above
+     * integrated, virtual and CPU devices, then devices with more device
+     * local memory score higher, then devices with larger subgroups.
+     *
+     * @param physicalDevice The physical device to score
+     * @param requirements The requirements of the physical device
+     * @return The score of the device, or -1 if it does not meet the
+     * requirements
+     **/
+    static int64_t scoreDevice(const vk::PhysicalDevice& physicalDevice,
+                               const DeviceRequirements& requirements);
+
+    /**
+     * Information about the subgroups of the device, such as their size and
+     * the subgroup operations supported in each shader stage.
+     *
+     * @return Vulkan subgroup properties of the physical device
+     **/
+    vk::PhysicalDeviceSubgroupProperties getSubgroupProperties() const;
+
+    /**
+     * Check whether compute shaders of the device support the subgroup
+     * operations provided, which allows selecting the subgroup variants of
+     * the built-in operations at runtime.
+     *
+     * @param operations The subgroup operations required
+     * @return Boolean stating whether all the operations are supported in
+     * compute shaders
+     **/
+    bool supportsSubgroupOperations(vk::SubgroupFeatureFlags operations) const;
+
+    /**
+     * The local size chosen for the device that algorithms specialize the
+     * local_size_x_id of their shaders with when dispatched without an
+     * explicit workgroup. It is KOMPUTE_DEFAULT_LOCAL_SIZE_X rounded up to a
+     * multiple of the subgroup size and clamped to the workgroup size limits
+     * of the device.
+     *
+     * @return The default local size of the algorithms of the manager
+     **/
+    uint32_t getDefaultLocalSize() const;
+
+    /**
+     * The memory pool that the tensors created by this manager sub-allocate
+     * their device memory from.
+     *
+     * @return Shared pointer to the memory pool of the manager
+     **/
+    std::shared_ptr<MemoryPool> memoryPool() const;
+
+    /**
+     * The cache through which the algorithms created by this manager share
+     * their shader modules, pipelines and layouts.
+     *
+     * @return Shared pointer to the shader cache of the manager
+     **/
+    std::shared_ptr<ShaderCache> shaderCache() const;
+
+    /**
+     * The allocator that the algorithms created by this manager allocate
+     * their descriptor sets from.
+     *
+     * @return Shared pointer to the descriptor allocator of the manager
+     **/
+    std::shared_ptr<DescriptorAllocator> descriptorAllocator() const;
+
+    /**
+     * Check whether the sequences created by the manager signal timeline
+     * semaphores, which allows them to be passed as dependencies to the
+     * evalAsync of other sequences. This requires VK_KHR_timeline_semaphore
+     * to be provided in the desired extensions of the manager.
+     *
+     * @return Boolean stating whether timeline semaphores are enabled
+     **/
+    bool hasTimelineSemaphores() const;
+
+    /**
+     * Check whether tensors created by the manager have device addresses,
+     * which algorithms built with BindingModes::eDeviceAddresses pass to
+     * their shaders instead of binding descriptor sets. This requires
+     * VK_KHR_buffer_device_address to be provided in the desired extensions
+     * of the manager.
+     *
+     * @return Boolean stating whether buffer device addresses are enabled
+     **/
+    bool hasBufferDeviceAddress() const;
+
+    /**
+     * Check whether the global priorities of the queues were granted, which
+     * requires VK_KHR_global_priority or VK_EXT_global_priority to be
+     * supported by the device, and the process to be allowed the priorities
+     * above the default one by the driver.
+     *
+     * @return Boolean stating whether global priorities are enabled
+     **/
+    bool hasGlobalPriority() const;
+
+    /**
+     * Check whether VK_EXT_debug_utils is enabled, in which case the names
+     * set on the tensors, algorithms and sequences of the manager name their
+     * Vulkan objects, and the commands of each operation of the sequences
+     * are labelled. The extension is enabled on the instance created by the
+     * manager in debug builds, or when the KOMPUTE_ENV_DEBUG_UTILS
+     * environment variable is set to a value other than 0, provided the
+     * Vulkan loader or a layer supports it.
+     *
+     * @return Boolean stating whether debug utils are enabled
+     **/
+    bool hasDebugUtils() const;
+
+    /**
+     * Check whether shaders of the device can access tensors of the data type
+     * provided in storage buffers. The half, 8 and 16 bit integer types
+     * require the 8 or 16 bit storage features, which are enabled when the
+     * manager creates the device and they are supported, while tensors of
+     * any data type can be created and synced regardless.
+     *
+     * @param dataType The data type of the tensors
+     * @return Boolean stating whether shaders can access the data type
+     **/
+    bool supportsDataType(const Tensor::TensorDataTypes& dataType) const;
+
+    /**
+     * Reports the usage and budget of each memory heap, together with the
+     * live tensors and the size of their buffers. The tensors are only
+     * tracked when the manager manages its resources, which is not the case
+     * when it is created from an existing vulkan device.
+     *
+     * @return Memory statistics of the device and the tensors
+     **/
+    MemoryStats memoryStats();
+
+    /**
+     * Reads the counters of the work done by the tensors, algorithms and
+     * sequences created by the manager, along with the number of them alive.
+     * The counters are always updated, and the resources are only counted
+     * when the manager manages its resources.
+     *
+     * @return Snapshot of the counters and the live resources
+     **/
+    Metrics::Snapshot metrics();
+
+    /**
+     * Sets the counters returned by metrics back to zero. The live resource
+     * counts are not affected.
+     **/
+    void resetMetrics();
+
+    /**
+     * The host allocation callbacks provided on construction, whose stats
+     * can be read around an operation to measure the host memory the driver
+     * allocates for it.
+     *
+     * @return The host allocator of the manager, null if none was provided
+     **/
+    std::shared_ptr<HostAllocator> hostAllocator();
+
+    /**
+     * Sets a soft limit on the device local memory that the manager can
+     * allocate for its tensors. Allocations exceeding the limit throw before
+     * reaching the driver, so the available headroom can be relied upon.
+     *
+     * @param limit The limit in bytes applied to every device local heap, or
+     * 0 to remove the limit
+     **/
+    void setDeviceMemoryLimit(vk::DeviceSize limit);
+
+    /**
+     * Enables a shared staging ring of fixed size for all the device tensors
+     * created after this call, which then don't hold a staging buffer of
+     * their own. Their data is kept in host memory, uploaded through the ring
+     * before a sequence with OpTensorSyncDevice is submitted, and downloaded
+     * after a sequence with OpTensorSyncLocal completes. Sequences recording
+     * these syncs must run on the queue of the ring, with the syncs to device
+     * first and the syncs to local last.
+     *
+     * @param ringSize The total size in bytes of the staging ring
+     * @param queueIndex The queue to submit the ring transfers to
+     **/
+    void enableStagingRing(vk::DeviceSize ringSize = KOMPUTE_STAGING_RING_SIZE,
+                           uint32_t queueIndex = 0);
+
+    /**
+     * Sets whether the buffers of the tensors created after this call are
+     * shared concurrently between the queue families of the manager, which
+     * is the default. This lets sequences of different queues, such as the
+     * transfer and compute roles, access the same tensors without queue
+     * family ownership transfers. Tensors used from a single queue family
+     * can disable it, as exclusive buffers may be faster on some devices.
+     *
+     * @param concurrentSharing Whether to share the buffers concurrently
+     **/
+    void setConcurrentSharing(bool concurrentSharing);
+
+    /**
+     * Writes the contents of the pipeline cache shared by the algorithms of
+     * the manager to a file, so the pipelines compiled so far can be
+     * preloaded by passing the file to the constructor of a later manager.
+     *
+     * @param path The file to write the pipeline cache data to
+     **/
+    void savePipelineCache(const std::string& path);
 
   private:
     // -------------- OPTIONALLY OWNED RESOURCES
@@ -221,14 +1016,53 @@ class Manager
     bool mFreeDevice = false;
 
     // -------------- ALWAYS OWNED RESOURCES
-    std::vector<std::weak_ptr<Tensor>> mManagedTensors;
-    std::vector<std::weak_ptr<Sequence>> mManagedSequences;
-    std::vector<std::weak_ptr<Algorithm>> mManagedAlgorithms;
+    // Properties of the physical device, queried once when it is selected
+    std::shared_ptr<DeviceInfo> mDeviceInfo = nullptr;
+    std::shared_ptr<MemoryPool> mMemoryPool = nullptr;
+    std::shared_ptr<StagingRing> mStagingRing = nullptr;
+    std::shared_ptr<CompletionWaiter> mCompletionWaiter = nullptr;
+    // Pipeline cache shared by the algorithms created by the manager
+    std::shared_ptr<vk::PipelineCache> mPipelineCache = nullptr;
+    std::shared_ptr<ShaderCache> mShaderCache = nullptr;
+    std::shared_ptr<DescriptorAllocator> mDescriptorAllocator = nullptr;
+    std::shared_ptr<WorkerPool> mWorkerPool = nullptr;
+    // Functions of VK_EXT_debug_utils, null when the extension is disabled
+    std::shared_ptr<DebugUtils> mDebugUtils = nullptr;
+    // Counters shared by the components created by the manager
+    std::shared_ptr<Metrics> mMetrics = std::make_shared<Metrics>();
+    // Host allocation callbacks of every Vulkan object, null for the default
+    std::shared_ptr<HostAllocator> mHostAllocator = nullptr;
+    // Resources deregister themselves from the registries when released
+    std::shared_ptr<ResourceRegistry<Tensor>> mManagedTensors =
+      std::make_shared<ResourceRegistry<Tensor>>();
+    std::shared_ptr<ResourceRegistry<Sequence>> mManagedSequences =
+      std::make_shared<ResourceRegistry<Sequence>>();
+    std::shared_ptr<ResourceRegistry<Block>> mManagedBlocks =
+      std::make_shared<ResourceRegistry<Block>>();
+    std::shared_ptr<ResourceRegistry<Algorithm>> mManagedAlgorithms =
+      std::make_shared<ResourceRegistry<Algorithm>>();
+    // Command pools shared by sequences, by queue family index
+    std::unordered_map<uint32_t, std::shared_ptr<vk::CommandPool>>
+      mSharedCommandPools;
+    std::mutex mSharedCommandPoolsMutex;
+    // Guards the creation of the completion waiter and worker pool
+    std::mutex mLazyResourcesMutex;
 
     std::vector<uint32_t> mComputeQueueFamilyIndices;
     std::vector<std::shared_ptr<vk::Queue>> mComputeQueues;
+    // Serialises the submissions to each queue, by queue index
+    std::vector<std::shared_ptr<std::mutex>> mComputeQueueMutexes;
+    // Index of the queue of each role, by QueueRole value
+    std::vector<uint32_t> mQueueRoleIndices = { 0, 0, 0, 0 };
+    std::vector<QueuePriority> mQueuePriorities;
 
     bool mManageResources = false;
+    bool mTimelineSemaphores = false;
+    bool mGlobalPriority = false;
+    bool mConcurrentSharing = true;
+    bool mStorage16Bit = false;
+    bool mStorage8Bit = false;
+    uint32_t mDefaultLocalSize = KOMPUTE_DEFAULT_LOCAL_SIZE_X;
 
 #if DEBUG
 #ifndef KOMPUTE_DISABLE_VK_DEBUG_LAYERS
@@ -239,9 +1073,28 @@ class Manager
 
     // Create functions
     void createInstance();
+    void createInstanceDebug(bool debugUtils, bool validationLayers);
     void createDevice(const std::vector<uint32_t>& familyQueueIndices = {},
                       uint32_t hysicalDeviceIndex = 0,
-                      const std::vector<std::string>& desiredExtensions = {});
+                      const std::vector<std::string>& desiredExtensions = {},
+                      const std::vector<QueuePriority>& queuePriorities = {});
+    void createPipelineCache(const std::string& pipelineCachePath);
+    bool hasMonotonicTimeDomain();
+    void updateDefaultLocalSize();
+    std::shared_ptr<WorkerPool> workerPool();
+    std::shared_ptr<CompletionWaiter> completionWaiter();
+    std::vector<uint32_t> sharedQueueFamilyIndices();
+
+    // Takes ownership of a resource created, registered to be destroyed with
+    // the manager if it manages its resources
+    template<typename T, typename U>
+    std::shared_ptr<U> manage(ResourceRegistry<T>& registry, U* resource)
+    {
+        if (this->mManageResources) {
+            return registry.add(resource);
+        }
+        return std::shared_ptr<U>(resource);
+    }
 };
 
 } // End namespace kp
@@ -0,0 +1,306 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <map>
+#include <mutex>
+
+#include "kompute/Core.hpp"
+
+#include "kompute/DeviceInfo.hpp"
+#include "kompute/HostAllocator.hpp"
+
+#ifndef KOMPUTE_MEMORY_POOL_BLOCK_SIZE
+#define KOMPUTE_MEMORY_POOL_BLOCK_SIZE (64 * 1024 * 1024)
+#endif
+
+namespace kp {
+
+/**
+ * Sub-allocating pool of device memory shared across the tensors created by
+ * a manager.
+ *
+ * Instead of performing a vkAllocateMemory call for every buffer, the pool
+ * allocates large blocks of vk::DeviceMemory per memory type index and hands
+ * out aligned ranges within them. Host visible blocks are mapped once when
+ * created, as Vulkan does not allow mapping the same memory object more than
+ * once, and each allocation exposes its pointer into that mapping. Ranges of
+ * non-coherent memory are aligned to the non-coherent atom size so they can
+ * be flushed and invalidated without affecting their neighbours.
+ *
+ * When enabled, the pool can also import existing host allocations through
+ * VK_EXT_external_memory_host, and Android hardware buffers through
+ * VK_ANDROID_external_memory_android_hardware_buffer, each into a dedicated
+ * block of its own.
+ *
+ * The pool reports the usage of each memory heap, with the budget of the
+ * process when VK_EXT_memory_budget is supported, and can enforce a soft limit
+ * per heap so allocations fail before the driver runs out of memory.
+ */
+class MemoryPool
+{
+  public:
+    /**
+     * Range of device memory handed out by the pool. The memory handle is
+     * owned by the pool and must not be freed by the holder of the allocation.
+     */
+    struct Allocation
+    {
+        vk::DeviceMemory memory;
+        vk::DeviceSize offset = 0;
+        vk::DeviceSize size = 0;
+        uint32_t memoryTypeIndex = 0;
+        void* mappedData = nullptr; ///< Host pointer, null if not host visible
+    };
+
+    /**
+     * Usage of a memory heap of the device. Without VK_EXT_memory_budget the
+     * budget is the size of the heap and the usage is the memory of the pool.
+     */
+    struct HeapStats
+    {
+        vk::MemoryHeapFlags flags;
+        vk::DeviceSize size = 0;      ///< Total size of the heap
+        vk::DeviceSize budget = 0;    ///< Memory the process can allocate
+        vk::DeviceSize usage = 0;     ///< Memory the process has allocated
+        vk::DeviceSize allocated = 0; ///< Size of the blocks of the pool
+        vk::DeviceSize used = 0;      ///< Size of the ranges handed out
+        vk::DeviceSize limit = 0;     ///< Soft limit of the pool, 0 if none
+    };
+
+    /**
+     * Constructor for the memory pool which will allocate blocks lazily as
+     * memory is requested.
+     *
+     * @param physicalDevice The physical device to use to fetch properties
+     * @param device The device to use to allocate the memory blocks from
+     * @param blockSize The size of the blocks allocated by the pool, requests
+     * larger than half a block receive a dedicated block of their own
+     * @param hostAllocator (Optional) Host allocation callbacks to allocate
+     * and free the memory blocks with
+     * @param deviceInfo (Optional) Properties of the physical device already
+     * queried by the manager, queried from the device if null
+     */
+    MemoryPool(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
+               std::shared_ptr<vk::Device> device,
+               vk::DeviceSize blockSize = KOMPUTE_MEMORY_POOL_BLOCK_SIZE,
+               std::shared_ptr<HostAllocator> hostAllocator = nullptr,
+               std::shared_ptr<DeviceInfo> deviceInfo = nullptr);
+
+    /**
+     * Destructor which frees all the blocks allocated by the pool.
+     */
+    ~MemoryPool();
+
+    /**
+     * Sub-allocates a range matching the memory requirements with the first
+     * memory type that supports the memory property flags provided.
+     *
+     * @param memoryRequirements The requirements of the resource to bind
+     * @param memoryPropertyFlags The properties required for the memory
+     * @return Allocation describing the memory and offset to bind to
+     */
+    Allocation allocate(const vk::MemoryRequirements& memoryRequirements,
+                        const vk::MemoryPropertyFlags& memoryPropertyFlags);
+
+    /**
+     * Enables importing host pointers with VK_EXT_external_memory_host, which
+     * must have been enabled when the device was created.
+     *
+     * @param instance The instance to load the extension functions with
+     */
+    void enableHostPointerImport(const vk::Instance& instance);
+
+    /**
+     * Check whether a host pointer can be imported by the pool, which
+     * requires the import to be enabled and the pointer and size to be
+     * aligned to minImportedHostPointerAlignment.
+     *
+     * @param hostPointer The host pointer to import
+     * @param size The size in bytes of the host allocation
+     * @return Boolean stating whether the pointer can be imported
+     */
+    bool canImportHostPointer(const void* hostPointer, vk::DeviceSize size);
+
+    /**
+     * Imports a host allocation as device memory in a dedicated block, so the
+     * device accesses the host memory directly without any copy. The host
+     * allocation must outlive the returned allocation.
+     *
+     * @param memoryRequirements The requirements of the resource to bind
+     * @param memoryPropertyFlags The properties required for the memory
+     * @param hostPointer The host pointer to import
+     * @param size The size in bytes of the host allocation
+     * @param allocation Allocation set to the imported memory on success
+     * @return Boolean stating whether the import succeeded, the caller is
+     * expected to fall back to a regular allocation otherwise
+     */
+    bool importHostPointer(const vk::MemoryRequirements& memoryRequirements,
+                           const vk::MemoryPropertyFlags& memoryPropertyFlags,
+                           void* hostPointer,
+                           vk::DeviceSize size,
+                           Allocation& allocation);
+
+    /**
+     * Enables VK_KHR_buffer_device_address, which must have been enabled
+     * with its bufferDeviceAddress feature when the device was created. The
+     * memory allocated by the pool from then on can back buffers whose
+     * device address is retrieved by bufferDeviceAddress.
+     *
+     * @param instance The instance to load the extension functions with
+     */
+    void enableBufferDeviceAddress(const vk::Instance& instance);
+
+    /**
+     * Check whether the memory of the pool is allocated with device
+     * addresses, so buffers can be created with the shader device address
+     * usage.
+     *
+     * @return Boolean stating whether buffer device addresses are enabled
+     */
+    bool hasBufferDeviceAddress();
+
+    /**
+     * Retrieve the device address of a buffer bound to memory of the pool,
+     * which shaders can dereference through GL_EXT_buffer_reference.
+     *
+     * @param buffer The buffer created with the shader device address usage
+     * @return The device address of the start of the buffer
+     */
+    vk::DeviceAddress bufferDeviceAddress(const vk::Buffer& buffer);
+
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+    /**
+     * Enables importing Android hardware buffers with
+     * VK_ANDROID_external_memory_android_hardware_buffer, which must have
+     * been enabled when the device was created.
+     *
+     * @param instance The instance to load the extension functions with
+     */
+    void enableHardwareBufferImport(const vk::Instance& instance);
+
+    /**
+     * Check whether Android hardware buffers can be imported by the pool.
+     *
+     * @return Boolean stating whether the import is enabled
+     */
+    bool canImportHardwareBuffer();
+
+    /**
+     * Imports an Android hardware buffer as device memory in a dedicated
+     * block, so the device accesses the memory of the buffer directly without
+     * any copy. The memory is mapped when the buffer has a host visible
+     * memory type, which is the case for buffers allocated with CPU usage.
+     * The import holds a reference to the hardware buffer until the
+     * allocation is freed.
+     *
+     * @param memoryRequirements The requirements of the resource to bind
+     * @param hardwareBuffer The hardware buffer to import
+     * @param allocation Allocation set to the imported memory on success
+     * @return Boolean stating whether the import succeeded
+     */
+    bool importHardwareBuffer(const vk::MemoryRequirements& memoryRequirements,
+                              AHardwareBuffer* hardwareBuffer,
+                              Allocation& allocation);
+#endif
+
+    /**
+     * Returns the range of an allocation back to the pool so it can be
+     * reused. Dedicated blocks are freed straight away.
+     *
+     * @param allocation The allocation previously returned by allocate
+     */
+    void free(const Allocation& allocation);
+
+    /**
+     * Frees all the blocks owned by the pool. Allocations handed out before
+     * this call become invalid.
+     */
+    void destroy();
+
+    /**
+     * Total number of vk::DeviceMemory blocks currently allocated by the pool.
+     *
+     * @return Total number of blocks across all memory types
+     */
+    uint32_t blockCount();
+
+    /**
+     * Total size of the vk::DeviceMemory blocks currently allocated by the
+     * pool, including the ranges that are not in use.
+     *
+     * @return Total size in bytes of all the blocks
+     */
+    vk::DeviceSize allocatedSize();
+
+    /**
+     * Retrieve the usage of every memory heap of the device, including the
+     * budget reported by the driver when VK_EXT_memory_budget is supported.
+     *
+     * @return Usage of the heaps indexed by heap index
+     */
+    std::vector<HeapStats> heapStats();
+
+    /**
+     * Check whether the heap budget and usage are reported by the driver
+     * through VK_EXT_memory_budget.
+     *
+     * @return Boolean stating whether the memory budget is available
+     */
+    bool hasMemoryBudget();
+
+    /**
+     * Sets a soft limit on the memory the pool allocates from a heap. Once
+     * reached, allocations throw instead of allocating further blocks, which
+     * leaves headroom before the driver itself runs out of memory.
+     *
+     * @param heapIndex The index of the heap to limit
+     * @param limit The maximum size in bytes of the blocks allocated from the
+     * heap, or 0 to remove the limit
+     */
+    void setHeapLimit(uint32_t heapIndex, vk::DeviceSize limit);
+
+  private:
+    struct Block
+    {
+        vk::DeviceMemory memory;
+        vk::DeviceSize size = 0;
+        void* mappedData = nullptr;
+        bool dedicated = false;
+        bool imported = false; ///< Memory backed by a host allocation
+        // Free ranges as offset to size, kept merged with their neighbours
+        std::map<vk::DeviceSize, vk::DeviceSize> freeRanges;
+    };
+
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<vk::PhysicalDevice> mPhysicalDevice;
+    std::shared_ptr<vk::Device> mDevice;
+    std::shared_ptr<HostAllocator> mHostAllocator;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::map<uint32_t, std::vector<std::unique_ptr<Block>>> mBlocks;
+    vk::PhysicalDeviceMemoryProperties mMemoryProperties;
+    vk::DeviceSize mNonCoherentAtomSize;
+    vk::DeviceSize mBlockSize;
+    std::mutex mMutex;
+    vk::DispatchLoaderDynamic mDispatcher;
+    bool mHostPointerImport = false;
+    vk::DeviceSize mHostPointerAlignment = 0;
+    bool mHardwareBufferImport = false;
+    bool mBufferDeviceAddress = false;
+    bool mMemoryBudget = false;
+    std::map<uint32_t, vk::DeviceSize> mHeapLimits;
+
+    int32_t findMemoryTypeIndex(
+      uint32_t memoryTypeBits,
+      const vk::MemoryPropertyFlags& memoryPropertyFlags);
+    Block* createBlock(uint32_t memoryTypeIndex,
+                       vk::DeviceSize size,
+                       bool dedicated);
+    void freeBlock(Block& block);
+    void checkHeapLimit(uint32_t memoryTypeIndex, vk::DeviceSize size);
+    bool allocateFromBlock(Block& block,
+                           const vk::MemoryRequirements& memoryRequirements,
+                           Allocation& allocation);
+};
+
+} // End namespace kp
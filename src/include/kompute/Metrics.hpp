@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "kompute/Core.hpp"
+
+namespace kp {
+
+/**
+ * Always-on counters of the work done by the components created by a
+ * manager, which they update with relaxed atomic additions so the counters
+ * can be read at any time from any thread, for example to export them to a
+ * monitoring system and catch regressions such as algorithms rebuilt for
+ * every request.
+ *
+ * The counters only grow, so rates are derived by the reader from two
+ * snapshots, and are shared by every thread using the components.
+ */
+class Metrics
+{
+  public:
+    /**
+     * Counters updated by the components of the manager.
+     */
+    enum class Counter
+    {
+        eSubmissions = 0,             ///< Sequences submitted to a queue
+        eCommandBuffersRecorded = 1,  ///< Command buffers recorded
+        eBarriers = 2,                ///< Pipeline barriers recorded
+        eBytesUploaded = 3,           ///< Bytes copied to device tensors
+        eBytesDownloaded = 4,         ///< Bytes copied from device tensors
+        ePipelinesCreated = 5,        ///< Pipelines compiled, cache misses
+        ePipelineCacheHits = 6,       ///< Pipelines reused from the cache
+        eDescriptorSetsAllocated = 7, ///< Descriptor sets of algorithms
+        eFenceWaits = 8,              ///< Waits for a submission to complete
+        eFenceWaitNs = 9,             ///< Time spent in those waits
+        eCount = 10,
+    };
+
+    /**
+     * Values of the counters at a point in time, along with the resources
+     * alive at that time, which the manager fills in.
+     */
+    struct Snapshot
+    {
+        uint64_t submissions = 0;
+        uint64_t commandBuffersRecorded = 0;
+        uint64_t barriers = 0;
+        uint64_t bytesUploaded = 0;
+        uint64_t bytesDownloaded = 0;
+        uint64_t pipelinesCreated = 0;
+        uint64_t pipelineCacheHits = 0;
+        uint64_t descriptorSetsAllocated = 0;
+        uint64_t fenceWaits = 0;
+        uint64_t fenceWaitNs = 0;
+        uint32_t tensorCount = 0;    ///< Live tensors, including views
+        uint32_t algorithmCount = 0; ///< Live algorithms
+        uint32_t sequenceCount = 0;  ///< Live sequences
+    };
+
+    /**
+     * Adds a value to a counter.
+     *
+     * @param counter The counter to update
+     * @param value The value to add, 1 by default
+     */
+    void add(Counter counter, uint64_t value = 1)
+    {
+        this->mCounters[(size_t)counter].fetch_add(value,
+                                                   std::memory_order_relaxed);
+    }
+
+    /**
+     * Reads a counter.
+     *
+     * @param counter The counter to read
+     * @return The value of the counter
+     */
+    uint64_t get(Counter counter) const
+    {
+        return this->mCounters[(size_t)counter].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Reads all the counters. They are read one after the other, so the
+     * snapshot may miss the updates made while it is taken.
+     *
+     * @return The values of the counters, without the resource counts
+     */
+    Snapshot snapshot() const;
+
+    /**
+     * Sets all the counters back to zero.
+     */
+    void reset();
+
+  private:
+    std::array<std::atomic<uint64_t>, (size_t)Counter::eCount> mCounters{};
+};
+
+} // End namespace kp
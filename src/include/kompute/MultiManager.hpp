@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <functional>
+
+#include "kompute/Core.hpp"
+
+#include "kompute/Manager.hpp"
+#include "kompute/ShardedTensor.hpp"
+
+namespace kp {
+
+/**
+ * Orchestrator of several devices, with a manager for each device, which
+ * shards tensors across the devices and dispatches an algorithm on every
+ * shard at the same time.
+ *
+ * The data exchanged between the devices, such as by gather and allReduce,
+ * goes through the host visible staging memory of the shards.
+ */
+class MultiManager
+{
+  public:
+    /**
+     * Constructor creating a manager for each of the physical devices.
+     *
+     * @param physicalDeviceIndices (Optional) The indices of the physical
+     * devices to use, which are all the devices of the instance if empty. A
+     * device can be listed more than once, in which case it gets several
+     * managers of its own.
+     * @param desiredExtensions The desired extensions to load from each
+     * physical device
+     */
+    MultiManager(const std::vector<uint32_t>& physicalDeviceIndices = {},
+                 const std::vector<std::string>& desiredExtensions = {});
+
+    /**
+     * Destructor which destroys the managers of the devices along with their
+     * resources.
+     */
+    ~MultiManager();
+
+    /**
+     * Retrieve the number of devices, which is the number of shards of the
+     * sharded tensors.
+     *
+     * @return Number of devices
+     */
+    uint32_t deviceCount();
+
+    /**
+     * Retrieve the manager of a device, to create resources only on that
+     * device.
+     *
+     * @param deviceIndex The index of the device
+     * @return The manager of the device
+     */
+    std::shared_ptr<Manager> manager(uint32_t deviceIndex);
+
+    /**
+     * Create a tensor sharded by rows, where each device holds a block of
+     * consecutive rows. The rows are split as evenly as possible, with the
+     * first devices holding one more row when they cannot be split evenly.
+     *
+     * @param data The data of the full tensor, stored row by row
+     * @param rowSize The number of elements of each row
+     * @param tensorType The type of the tensors of the shards
+     * @return Shared pointer with the sharded tensor
+     */
+    template<typename T>
+    std::shared_ptr<ShardedTensor> shardRows(
+      const std::vector<T>& data,
+      uint64_t rowSize = 1,
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice)
+    {
+        KP_LOG_DEBUG("Kompute MultiManager sharding {} elements by rows of {}",
+                     data.size(),
+                     rowSize);
+
+        if (rowSize == 0 || data.size() % rowSize) {
+            throw std::runtime_error(fmt::format(
+              "Kompute MultiManager tensor of {} elements is not made of "
+              "rows of {} elements",
+              data.size(),
+              rowSize));
+        }
+        uint64_t rows = data.size() / rowSize;
+        uint64_t deviceCount = this->mManagers.size();
+        if (rows < deviceCount) {
+            throw std::runtime_error(
+              fmt::format("Kompute MultiManager cannot shard {} rows across "
+                          "{} devices",
+                          rows,
+                          deviceCount));
+        }
+
+        std::vector<std::shared_ptr<Tensor>> shards;
+        std::vector<uint64_t> offsets;
+        uint64_t row = 0;
+        for (uint64_t i = 0; i < deviceCount; i++) {
+            uint64_t shardRows = rows / deviceCount + (i < rows % deviceCount);
+            std::vector<T> shardData(data.begin() + row * rowSize,
+                                     data.begin() +
+                                       (row + shardRows) * rowSize);
+            shards.push_back(
+              this->mManagers[i]->tensorT<T>(shardData, tensorType));
+            offsets.push_back(row * rowSize);
+            row += shardRows;
+        }
+
+        return std::make_shared<ShardedTensor>(
+          shards, offsets, data.size(), ShardedTensor::Layout::eRows);
+    }
+
+    /**
+     * Create a tensor replicated on every device, such as the weights of a
+     * model whose inputs are sharded.
+     *
+     * @param data The data of the tensor
+     * @param tensorType The type of the tensors of the shards
+     * @return Shared pointer with the sharded tensor
+     */
+    template<typename T>
+    std::shared_ptr<ShardedTensor> replicate(
+      const std::vector<T>& data,
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice)
+    {
+        KP_LOG_DEBUG("Kompute MultiManager replicating {} elements",
+                     data.size());
+
+        std::vector<std::shared_ptr<Tensor>> shards;
+        for (const std::shared_ptr<Manager>& manager : this->mManagers) {
+            shards.push_back(manager->tensorT<T>(data, tensorType));
+        }
+
+        return std::make_shared<ShardedTensor>(
+          shards,
+          std::vector<uint64_t>(shards.size(), 0),
+          data.size(),
+          ShardedTensor::Layout::eReplicated);
+    }
+
+    /**
+     * Create an algorithm on each device, which runs on the shards of the
+     * tensors of that device.
+     *
+     * @param tensors The sharded tensors to bind, in the order of their
+     * bindings
+     * @param spirv The SPIRV bytes of the shader
+     * @param workgroup (optional) kp::Workgroup of the algorithms, which
+     * defaults to the size of the first shard of each device
+     * @param specializationConstants (optional) float vector to use for
+     * specialization constants
+     * @param pushConstants (optional) float vector to use for push constants
+     * @returns The algorithm of each device, in the order of the devices
+     */
+    std::vector<std::shared_ptr<Algorithm>> algorithm(
+      const std::vector<std::shared_ptr<ShardedTensor>>& tensors,
+      const std::vector<uint32_t>& spirv,
+      const Workgroup& workgroup = {},
+      const std::vector<float>& specializationConstants = {},
+      const std::vector<float>& pushConstants = {});
+
+    /**
+     * Copies the host data of the shards to their devices, on every device
+     * at the same time.
+     *
+     * @param tensors The sharded tensors to copy
+     */
+    void syncDevice(const std::vector<std::shared_ptr<ShardedTensor>>& tensors);
+
+    /**
+     * Copies the data of the shards from their devices to their host data,
+     * on every device at the same time.
+     *
+     * @param tensors The sharded tensors to copy
+     */
+    void syncLocal(const std::vector<std::shared_ptr<ShardedTensor>>& tensors);
+
+    /**
+     * Dispatches the algorithm of each device, on every device at the same
+     * time, and waits for all of them to complete.
+     *
+     * @param algorithms The algorithm of each device, as created by
+     * MultiManager::algorithm
+     */
+    void dispatch(const std::vector<std::shared_ptr<Algorithm>>& algorithms);
+
+    /**
+     * Copies the shards of a tensor from their devices and gathers them into
+     * the full tensor on the host.
+     *
+     * @param tensor The sharded tensor to gather
+     * @return Vector with the elements of the full tensor
+     */
+    template<typename T>
+    std::vector<T> gather(std::shared_ptr<ShardedTensor> tensor)
+    {
+        this->syncLocal({ tensor });
+        return tensor->vector<T>();
+    }
+
+    /**
+     * Sums the replicas of a replicated tensor element by element, and
+     * writes the sum to every replica, such as to combine the gradients
+     * computed by each device. The replicas are summed on the host.
+     *
+     * @param tensor The replicated tensor to reduce
+     */
+    template<typename T>
+    void allReduce(std::shared_ptr<ShardedTensor> tensor)
+    {
+        KP_LOG_DEBUG("Kompute MultiManager all reduce of {} elements",
+                     tensor->size());
+
+        if (tensor->layout() != ShardedTensor::Layout::eReplicated) {
+            throw std::runtime_error(
+              "Kompute MultiManager all reduce requires a replicated tensor");
+        }
+
+        this->syncLocal({ tensor });
+
+        std::vector<T> sum(tensor->size(), T(0));
+        for (const std::shared_ptr<Tensor>& shard : tensor->shards()) {
+            std::vector<T> shardData = shard->vector<T>();
+            for (size_t i = 0; i < sum.size(); i++) {
+                sum[i] += shardData[i];
+            }
+        }
+        for (const std::shared_ptr<Tensor>& shard : tensor->shards()) {
+            shard->setRawData(sum.data());
+        }
+
+        this->syncDevice({ tensor });
+    }
+
+    /**
+     * Destroys the managers of the devices along with their resources.
+     */
+    void destroy();
+
+  private:
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<std::shared_ptr<Manager>> mManagers;
+
+    std::vector<std::shared_ptr<Tensor>> deviceShards(
+      const std::vector<std::shared_ptr<ShardedTensor>>& tensors,
+      uint32_t deviceIndex);
+    void evalOnDevices(
+      const std::function<void(uint32_t, std::shared_ptr<Sequence>)>& record);
+};
+
+} // End namespace kp
@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "kompute/Core.hpp"
+
+// Number of independently locked shards the registrations are spread over
+#ifndef KOMPUTE_RESOURCE_REGISTRY_SHARDS
+#define KOMPUTE_RESOURCE_REGISTRY_SHARDS 16
+#endif
+
+namespace kp {
+
+/**
+ * Registry of weak references to the resources created by a manager, where
+ * each resource removes itself in constant time when it is released, so the
+ * registry only holds the resources alive.
+ *
+ * The resources are registered in slot maps whose free slots are reused.
+ * The registry is split into shards chosen by the registering thread, each
+ * with its own lock, so threads creating resources at the same time rarely
+ * wait for each other. The registry must be owned by a shared pointer, which
+ * the resources only hold weakly so they can outlive it.
+ */
+template<typename T>
+class ResourceRegistry
+  : public std::enable_shared_from_this<ResourceRegistry<T>>
+{
+  public:
+    /**
+     * Takes ownership of a resource and registers it, returning the shared
+     * pointer to the resource that removes it from the registry when the
+     * resource is released.
+     *
+     * @param resource The resource to register, deleted on failure
+     * @return Shared pointer owning the resource
+     */
+    template<typename U>
+    std::shared_ptr<U> add(U* resource)
+    {
+        Handle handle;
+        try {
+            handle = this->allocate();
+        } catch (...) {
+            delete resource;
+            throw;
+        }
+
+        std::weak_ptr<ResourceRegistry<T>> registry = this->shared_from_this();
+        std::shared_ptr<U> shared(resource, [registry, handle](U* resource) {
+            if (std::shared_ptr<ResourceRegistry<T>> owner = registry.lock()) {
+                owner->remove(handle);
+            }
+            delete resource;
+        });
+
+        Shard& shard = this->mShards[handle.shard];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        Slot& slot = shard.slots[handle.index];
+        if (slot.generation == handle.generation) {
+            slot.resource = shared;
+        }
+        return shared;
+    }
+
+    /**
+     * Returns the resources of the registry that are still alive.
+     *
+     * @return The resources alive
+     */
+    std::vector<std::shared_ptr<T>> resources()
+    {
+        std::vector<std::shared_ptr<T>> resources;
+        for (Shard& shard : this->mShards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (const Slot& slot : shard.slots) {
+                // The resources are released after the lock, as releasing
+                // the last reference removes the resource from its shard
+                if (std::shared_ptr<T> resource = slot.resource.lock()) {
+                    resources.push_back(resource);
+                }
+            }
+        }
+        return resources;
+    }
+
+    /**
+     * Removes all the resources from the registry, returning the ones still
+     * alive.
+     *
+     * @return The resources alive
+     */
+    std::vector<std::shared_ptr<T>> take()
+    {
+        std::vector<std::shared_ptr<T>> resources;
+        for (Shard& shard : this->mShards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (Slot& slot : shard.slots) {
+                if (std::shared_ptr<T> resource = slot.resource.lock()) {
+                    resources.push_back(resource);
+                }
+            }
+            // The slots are dropped, so resources released later find their
+            // slot gone from the generation of the shard
+            shard.generation++;
+            shard.slots.clear();
+            shard.freeSlots.clear();
+            shard.size = 0;
+        }
+        return resources;
+    }
+
+    /**
+     * Returns the number of resources registered, which are the resources
+     * alive that have not been taken.
+     *
+     * @return Number of resources registered
+     */
+    size_t size()
+    {
+        size_t size = 0;
+        for (Shard& shard : this->mShards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            size += shard.size;
+        }
+        return size;
+    }
+
+    /**
+     * Returns the number of slots allocated by the registry, which is the
+     * highest number of resources registered at the same time since the last
+     * take.
+     *
+     * @return Number of slots allocated
+     */
+    size_t capacity()
+    {
+        size_t capacity = 0;
+        for (Shard& shard : this->mShards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            capacity += shard.slots.size();
+        }
+        return capacity;
+    }
+
+  private:
+    struct Handle
+    {
+        uint32_t shard = 0;
+        uint32_t index = 0;
+        uint64_t generation = 0;
+    };
+    struct Slot
+    {
+        std::weak_ptr<T> resource;
+        uint64_t generation = 0;
+    };
+    struct Shard
+    {
+        std::mutex mutex;
+        std::vector<Slot> slots;
+        std::vector<uint32_t> freeSlots;
+        // Increased when the slots are dropped, so old handles never match
+        uint64_t generation = 0;
+        size_t size = 0;
+    };
+
+    Shard mShards[KOMPUTE_RESOURCE_REGISTRY_SHARDS];
+
+    Handle allocate()
+    {
+        Handle handle;
+        handle.shard = std::hash<std::thread::id>()(std::this_thread::get_id()) %
+                       KOMPUTE_RESOURCE_REGISTRY_SHARDS;
+
+        Shard& shard = this->mShards[handle.shard];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.freeSlots.size()) {
+            handle.index = shard.freeSlots.back();
+            shard.freeSlots.pop_back();
+        } else {
+            handle.index = shard.slots.size();
+            shard.slots.emplace_back();
+        }
+        // Each use of a slot gets a distinct generation across drops
+        shard.generation++;
+        shard.slots[handle.index].generation = shard.generation;
+        handle.generation = shard.generation;
+        shard.size++;
+        return handle;
+    }
+
+    void remove(const Handle& handle)
+    {
+        Shard& shard = this->mShards[handle.shard];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (handle.index >= shard.slots.size() ||
+            shard.slots[handle.index].generation != handle.generation) {
+            return;
+        }
+        shard.slots[handle.index] = Slot();
+        shard.freeSlots.push_back(handle.index);
+        shard.size--;
+    }
+};
+
+} // End namespace kp
@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+
+#include "kompute/Core.hpp"
+
+#include "kompute/CompletionWaiter.hpp"
+#include "kompute/Sequence.hpp"
+
+namespace kp {
+
+/**
+ * Scheduler distributing independent sequences across several queues, so
+ * they run in parallel without being assigned to a queue by hand.
+ *
+ * The operations of each sequence submitted are recorded into one of the
+ * sequences the scheduler owns on each queue. A submission goes to the queue
+ * with the least outstanding work, and a queue left without pending work
+ * steals the most recently submitted work of the busiest queue. Submissions
+ * are awaited through the fences of their sequences by a CompletionWaiter,
+ * and complete in no particular order.
+ */
+class Scheduler
+{
+  public:
+    /**
+     * Completion run once the operations of a sequence submitted have been
+     * awaited, with the exception thrown while submitting or awaiting them
+     * if any.
+     */
+    typedef std::function<void(std::exception_ptr)> Completion;
+
+    /**
+     * Constructor from the sequences to run the submissions with.
+     *
+     * @param queueSequences For each queue, the sequences created on that
+     * queue, whose count is the number of submissions the queue can run at
+     * the same time
+     * @param completionWaiter The waiter for the fences of the sequences,
+     * which runs the completions
+     */
+    Scheduler(
+      const std::vector<std::vector<std::shared_ptr<Sequence>>>& queueSequences,
+      std::shared_ptr<CompletionWaiter> completionWaiter);
+
+    /**
+     * Destructor which waits for the submissions still outstanding.
+     */
+    ~Scheduler();
+
+    /**
+     * Submits the operations recorded by the sequence to one of the queues.
+     * The sequence itself is not submitted, and may be recorded again or
+     * submitted again straight away.
+     *
+     * @param sequence The sequence whose operations to run
+     * @param completion The function to run once the operations completed,
+     * from the thread of the completion waiter
+     */
+    void submit(std::shared_ptr<Sequence> sequence, Completion completion);
+
+    /**
+     * Submits the operations recorded by the sequence to one of the queues,
+     * returning a future that becomes ready once they completed.
+     *
+     * @param sequence The sequence whose operations to run
+     * @returns Future holding the sequence, or the exception raised while
+     * running its operations
+     */
+    std::future<std::shared_ptr<Sequence>> submit(
+      std::shared_ptr<Sequence> sequence);
+
+    /**
+     * Waits until all the submissions so far have completed.
+     */
+    void await();
+
+    /**
+     * Returns the number of queues the submissions are distributed across.
+     *
+     * @return Number of queues
+     */
+    uint32_t queueCount();
+
+    /**
+     * Returns the number of submissions pending or running that have not
+     * completed yet.
+     *
+     * @return Number of outstanding submissions
+     */
+    uint32_t outstandingCount();
+
+    /**
+     * Returns the number of submissions completed by each queue.
+     *
+     * @return Number of completed submissions, indexed by queue
+     */
+    std::vector<uint64_t> completedCounts();
+
+    /**
+     * Returns the number of submissions run by a queue other than the queue
+     * they were first assigned to.
+     *
+     * @return Number of stolen submissions
+     */
+    uint64_t stolenCount();
+
+    /**
+     * Waits for the submissions still outstanding and releases the
+     * sequences of the scheduler.
+     */
+    void destroy();
+
+  private:
+    struct Task
+    {
+        std::shared_ptr<Sequence> sequence;
+        std::vector<std::shared_ptr<OpBase>> operations;
+        Completion completion;
+    };
+    struct Queue
+    {
+        std::deque<Task> pending;
+        std::vector<std::shared_ptr<Sequence>> idleSequences;
+        uint32_t running = 0;
+        uint64_t completed = 0;
+    };
+
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<CompletionWaiter> mCompletionWaiter;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<Queue> mQueues;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    uint32_t mOutstanding = 0;
+    uint64_t mStolen = 0;
+
+    void dispatch(uint32_t queueIndex, std::unique_lock<std::mutex>& lock);
+    void complete(uint32_t queueIndex,
+                  std::shared_ptr<Sequence> sequence,
+                  const Task& task,
+                  std::exception_ptr exception);
+    void finish(const Task& task,
+                std::exception_ptr exception,
+                std::unique_lock<std::mutex>& lock);
+};
+
+} // End namespace kp
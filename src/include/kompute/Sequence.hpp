@@ -1,19 +1,44 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
+#include <deque>
+#include <mutex>
+#include <string>
+
 #include "kompute/Core.hpp"
 
+#include "kompute/DebugUtils.hpp"
+#include "kompute/DeviceInfo.hpp"
+#include "kompute/HazardTracker.hpp"
+#include "kompute/HostAllocator.hpp"
+#include "kompute/Metrics.hpp"
 #include "kompute/operations/OpAlgoDispatch.hpp"
 #include "kompute/operations/OpBase.hpp"
 
 namespace kp {
 
+class SubmitBatch;
+
 /**
- *  Container of operations that can be sent to GPU as batch
+ *  Container of operations that can be sent to GPU as batch. A sequence can
+ *  keep several submissions of its operations in flight, each with its own
+ *  command buffer and fence, so the next submission can be queued while the
+ *  previous ones are still running on the GPU.
  */
 class Sequence : public std::enable_shared_from_this<Sequence>
 {
   public:
+    /**
+     * GPU time of an operation, measured from the timestamps latched before
+     * and after it.
+     */
+    struct OpTiming
+    {
+        std::string label;     ///< Label recorded, or the operation type
+        double durationNs = 0; ///< Nanoseconds since the previous timestamp
+        uint64_t computeInvocations = 0; ///< Of dispatches with statistics
+    };
+
     /**
      * Main constructor for sequence which requires core vulkan components to
      * generate all dependent resources.
@@ -23,12 +48,47 @@ class Sequence : public std::enable_shared_from_this<Sequence>
      * @param computeQueue Vulkan compute queue
      * @param queueIndex Vulkan compute queue index in device
      * @param totalTimestamps Maximum number of timestamps to allocate
+     * @param inFlightDepth Maximum number of submissions running at the same
+     * time, timestamps are only supported with a single submission
+     * @param timelineSemaphore Whether to signal a timeline semaphore with
+     * every submission so other sequences can depend on it, which requires
+     * the timelineSemaphore feature of VK_KHR_timeline_semaphore
+     * @param commandPool Command pool of the queue family to allocate the
+     * command buffers from, which is not destroyed by the sequence. A new
+     * pool owned by the sequence is created if null. Sequences sharing a
+     * pool must not be recorded from different threads at the same time.
+     * @param queueMutex (Optional) Mutex held while submitting to the queue,
+     * shared by all the sequences of the queue so it is submitted to by one
+     * thread at a time, as Vulkan requires
+     * @param totalPipelineStatistics (Optional) Number of operations, from
+     * the first one recorded, whose compute shader invocations are counted
+     * by a pipeline statistics query when they dispatch an algorithm, which
+     * requires the pipelineStatisticsQuery feature to be enabled on the
+     * device, see DeviceInfo::enabledFeatures
+     * @param debugUtils (Optional) Functions of VK_EXT_debug_utils to label
+     * the commands of each operation with, and to name the command buffers
+     * of the sequence with, see setName
+     * @param metrics (Optional) Counters to add the submissions, command
+     * buffers, barriers and fence waits of the sequence to
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy the command pool, fences, semaphore and query pools with
+     * @param deviceInfo (Optional) Properties of the physical device queried
+     * once by the manager, which are queried by the sequence if null
      */
     Sequence(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
              std::shared_ptr<vk::Device> device,
              std::shared_ptr<vk::Queue> computeQueue,
              uint32_t queueIndex,
-             uint32_t totalTimestamps = 0);
+             uint32_t totalTimestamps = 0,
+             uint32_t inFlightDepth = 1,
+             bool timelineSemaphore = false,
+             std::shared_ptr<vk::CommandPool> commandPool = nullptr,
+             std::shared_ptr<std::mutex> queueMutex = nullptr,
+             uint32_t totalPipelineStatistics = 0,
+             std::shared_ptr<DebugUtils> debugUtils = nullptr,
+             std::shared_ptr<Metrics> metrics = nullptr,
+             std::shared_ptr<HostAllocator> hostAllocator = nullptr,
+             std::shared_ptr<DeviceInfo> deviceInfo = nullptr);
     /**
      * Destructor for sequence which is responsible for cleaning all subsequent
      * owned operations.
@@ -47,6 +107,31 @@ class Sequence : public std::enable_shared_from_this<Sequence>
      */
     std::shared_ptr<Sequence> record(std::shared_ptr<OpBase> op);
 
+    /**
+     * Record function for an operation like record, which labels the timing
+     * of the operation returned by getOpTimings.
+     *
+     * @param op Object derived from kp::BaseOp that will be recoreded by the
+     * sequence which will be used when the operation is evaluated.
+     * @param label Label of the operation in its timing
+     * @return shared_ptr<Sequence> of the Sequence class itself
+     */
+    std::shared_ptr<Sequence> record(std::shared_ptr<OpBase> op,
+                                     const std::string& label);
+
+    /**
+     * Record function for several operations at once, like calling record
+     * for each of them in order, which begins the recording and reserves the
+     * storage of the operations only once. This is intended for long
+     * sequences built by the bindings, which record them in a single call.
+     *
+     * @param ops Objects derived from kp::BaseOp that will be recorded by the
+     * sequence in order
+     * @return shared_ptr<Sequence> of the Sequence class itself
+     */
+    std::shared_ptr<Sequence> record(
+      const std::vector<std::shared_ptr<OpBase>>& ops);
+
     /**
      * Record function for operation to be added to the GPU queue in batch. This
      * template requires classes to be derived from the OpBase class. This
@@ -143,7 +228,9 @@ class Sequence : public std::enable_shared_from_this<Sequence>
      * Eval Async sends all the recorded and stored operations in the vector of
      * operations into the gpu as a submit job without a barrier. EvalAwait()
      * must ALWAYS be called after to ensure the sequence is terminated
-     * correctly.
+     * correctly. Up to the in flight depth of the sequence, repeated calls
+     * queue further submissions of the same operations, which are retired in
+     * order by evalAwait().
      *
      * @return Boolean stating whether execution was successful.
      */
@@ -157,6 +244,21 @@ class Sequence : public std::enable_shared_from_this<Sequence>
      * @return Boolean stating whether execution was successful.
      */
     std::shared_ptr<Sequence> evalAsync(std::shared_ptr<OpBase> op);
+    /**
+     * Eval Async sends all the recorded and stored operations like
+     * evalAsync(), with the GPU waiting for the last submission of each of
+     * the sequences provided before executing them. The dependencies are
+     * resolved on the GPU through timeline semaphores, so sequences on
+     * different queues can be chained without waiting on the host.
+     * EvalAwait() must ALWAYS be called after to ensure the sequence is
+     * terminated correctly.
+     *
+     * @param waitSequences Sequences whose last submission has to complete
+     * before this submission executes, all created with timeline semaphores
+     * @return shared_ptr<Sequence> of the Sequence class itself
+     */
+    std::shared_ptr<Sequence> evalAsync(
+      const std::vector<std::shared_ptr<Sequence>>& waitSequences);
     /**
      * Eval sends all the recorded and stored operations in the vector of
      * operations into the gpu as a submit job with a barrier.
@@ -194,29 +296,126 @@ class Sequence : public std::enable_shared_from_this<Sequence>
     }
 
     /**
-     * Eval Await waits for the fence to finish processing and then once it
-     * finishes, it runs the postEval of all operations.
+     * Eval Await waits for the fence of the oldest submission in flight to
+     * finish processing and then once it finishes, it runs the postEval of
+     * all operations.
      *
      * @param waitFor Number of milliseconds to wait before timing out.
      * @return shared_ptr<Sequence> of the Sequence class itself
      */
     std::shared_ptr<Sequence> evalAwait(uint64_t waitFor = UINT64_MAX);
 
+    /**
+     * Checks without blocking whether the oldest submission in flight of the
+     * sequence has finished executing on the GPU. The postEval of the
+     * operations is only run by evalAwait, which returns straight away once
+     * this is true.
+     *
+     * @return Boolean stating whether the GPU has finished the submission
+     */
+    bool isComplete();
+
+    /**
+     * Returns the number of submissions that have been sent with evalAsync
+     * and not yet retired with evalAwait.
+     *
+     * @return Number of submissions in flight
+     */
+    uint32_t inFlightCount();
+
+    /**
+     * Returns the maximum number of submissions of the sequence that can be
+     * in flight at the same time.
+     *
+     * @return Maximum number of submissions in flight
+     */
+    uint32_t inFlightDepth();
+
+    /**
+     * Returns the number of pipeline barriers recorded by the sequence
+     * between the operations of the current recording, based on the tensor
+     * accesses the operations declare. The barriers required by the tensors
+     * of an operation are recorded as a single pipeline barrier.
+     *
+     * @return Number of barriers recorded for the tracked tensor accesses
+     */
+    uint64_t barrierCount();
+
+    /**
+     * Returns the operations of the current recording, in the order they
+     * were recorded.
+     *
+     * @return The operations recorded
+     */
+    const std::vector<std::shared_ptr<OpBase>>& operations();
+
     /**
      * Clear function clears all operations currently recorded and starts
      * recording again.
      */
     void clear();
 
+    /**
+     * Resets the command buffers of the sequence and discards the operations
+     * recorded, keeping the command buffers allocated so the sequence can be
+     * recorded again cheaply. The sequence must not be running, and
+     * submissions whose wait timed out are waited for.
+     */
+    void reset();
+
     /**
      * Return the timestamps that were latched at the beginning and
-     * after each operation during the last eval() call.
+     * after each operation during the last eval() call, in ticks of the
+     * timestampPeriod of the device. Waits for the timestamps to be
+     * available.
      */
     std::vector<std::uint64_t> getTimestamps();
 
+    /**
+     * Returns the number of operations whose GPU time is latched, which is
+     * the number of timestamps the sequence was created with.
+     *
+     * @return Number of operations timed, 0 without timestamps
+     */
+    uint32_t timedOperationCount();
+
+    /**
+     * Returns the GPU time of each operation during the last eval() call, in
+     * nanoseconds, along with the compute shader invocations of the
+     * dispatches when pipeline statistics are collected. The queries are
+     * reset at the start of every submission, so the sequence can be
+     * evaluated again and the timings retrieved after each eval. The
+     * durations are zero when the sequence has no timestamps.
+     *
+     * @param wait Whether to wait for the timestamps to be available, which
+     * they are once the submission completed
+     * @return Timing of each operation with a timestamp or statistics, or
+     * an empty vector if wait is false and the results are not available
+     * yet
+     */
+    std::vector<OpTiming> getOpTimings(bool wait = true);
+
+    /**
+     * Sets the name of the sequence, which names its command buffers and
+     * query pools through VK_EXT_debug_utils so they can be identified in
+     * captures of debugging and profiling tools. The commands of each
+     * operation are labelled with the label of the operation, or its type,
+     * whether the sequence is named or not.
+     *
+     * @param name The name of the sequence
+     */
+    void setName(const std::string& name);
+
+    /**
+     * Retrieve the name of the sequence set with setName.
+     *
+     * @return Name of the sequence, empty if it was not named
+     */
+    const std::string& name();
+
     /**
      * Begins recording commands for commands to be submitted into the command
-     * buffer.
+     * buffer, replacing the operations recorded previously.
      *
      * @return Boolean stating whether execution was successful.
      */
@@ -248,7 +447,9 @@ class Sequence : public std::enable_shared_from_this<Sequence>
     /**
      * Clears command buffer and triggers re-record of all the current
      * operations saved, which is useful if the underlying kp::Tensors or
-     * kp::Algorithms are modified and need to be re-recorded.
+     * kp::Algorithms are modified and need to be re-recorded. Submissions
+     * call it on their own when tensors of the operations were rebuilt since
+     * the operations were recorded.
      */
     void rerecord();
 
@@ -271,7 +472,14 @@ class Sequence : public std::enable_shared_from_this<Sequence>
     std::shared_ptr<vk::PhysicalDevice> mPhysicalDevice = nullptr;
     std::shared_ptr<vk::Device> mDevice = nullptr;
     std::shared_ptr<vk::Queue> mComputeQueue = nullptr;
+    std::shared_ptr<std::mutex> mQueueMutex = nullptr;
+    std::shared_ptr<DebugUtils> mDebugUtils = nullptr;
+    std::shared_ptr<Metrics> mMetrics = nullptr;
+    std::shared_ptr<HostAllocator> mHostAllocator = nullptr;
+    std::shared_ptr<DeviceInfo> mDeviceInfo = nullptr;
     uint32_t mQueueIndex = -1;
+    // Whether the queue family supports compute or only transfers
+    bool mComputeSupported = true;
 
     // -------------- OPTIONALLY OWNED RESOURCES
     std::shared_ptr<vk::CommandPool> mCommandPool = nullptr;
@@ -280,18 +488,89 @@ class Sequence : public std::enable_shared_from_this<Sequence>
     bool mFreeCommandBuffer = false;
 
     // -------------- ALWAYS OWNED RESOURCES
-    vk::Fence mFence;
+    struct Submission
+    {
+        std::shared_ptr<vk::CommandBuffer> commandBuffer;
+        vk::Fence fence;
+        bool fencePending = false;
+        // Submitted by a batch, which signals one of its fences instead
+        bool batched = false;
+        std::weak_ptr<SubmitBatch> batch;
+        uint32_t batchFenceIndex = 0;
+        // Version of the operations recorded, the maximum if never recorded
+        uint64_t recordedVersion = UINT64_MAX;
+    };
+    // Storage referenced by the submit info of a submission
+    struct SubmitData
+    {
+        vk::SubmitInfo submitInfo;
+        vk::TimelineSemaphoreSubmitInfo timelineSubmitInfo;
+        std::vector<vk::Semaphore> waitSemaphores;
+        std::vector<uint64_t> waitValues;
+        std::vector<vk::PipelineStageFlags> waitStages;
+        uint64_t signalValue = 0;
+    };
+    std::vector<Submission> mSubmissions;
     std::vector<std::shared_ptr<OpBase>> mOperations;
+    HazardTracker mHazardTracker;
     std::shared_ptr<vk::QueryPool> timestampQueryPool = nullptr;
+    uint32_t mTimestampCount = 0;
+    // Valid bits of the timestamps of the queue family, and ticks to ns
+    uint64_t mTimestampMask = UINT64_MAX;
+    double mTimestampPeriod = 1.0;
+    std::shared_ptr<vk::QueryPool> mPipelineStatisticsQueryPool = nullptr;
+    uint32_t mPipelineStatisticsCount = 0;
+    // Label of each operation recorded, empty for the operation type
+    std::vector<std::string> mOperationLabels;
+    // Tensors of the operations recorded, with their generation at the time
+    std::vector<std::pair<std::shared_ptr<Tensor>, uint64_t>>
+      mRecordedGenerations;
+    // Resolved on the first trace, null unless the device enabled
+    // VK_EXT_calibrated_timestamps and calibrates CLOCK_MONOTONIC
+    PFN_vkGetCalibratedTimestampsEXT mGetCalibratedTimestamps = nullptr;
+    bool mCalibrationResolved = false;
+    vk::Semaphore mTimelineSemaphore;
+    std::string mName;
 
     // State
     bool mRecording = false;
-    bool mIsRunning = false;
+    std::deque<uint32_t> mInFlight;
+    uint32_t mNextSubmission = 0;
+    uint64_t mRecordVersion = 0;
+    // Value signaled by the last submission on the timeline semaphore
+    uint64_t mTimelineValue = 0;
 
     // Create functions
     void createCommandPool();
     void createCommandBuffer();
+    void createFences();
+    void createTimelineSemaphore();
+    void recordSubmission(Submission& submission);
+    void waitPendingSubmission(Submission& submission);
+    vk::Result waitSubmission(Submission& submission, uint64_t waitFor);
+    bool isSubmissionComplete(const Submission& submission);
+    Submission& prepareSubmit(
+      const std::vector<std::shared_ptr<Sequence>>& waitSequences,
+      SubmitData& submitData,
+      std::shared_ptr<SubmitBatch> batch = nullptr,
+      uint32_t batchFenceIndex = 0);
     void createTimestampQueryPool(uint32_t totalTimestamps);
+    void createPipelineStatisticsQueryPool(uint32_t totalPipelineStatistics);
+    void writeTimestamp(const vk::CommandBuffer& commandBuffer,
+                        uint32_t query);
+    void resetQueries(const vk::CommandBuffer& commandBuffer);
+    std::string operationLabel(size_t operationIndex);
+    void traceTimestamps(int64_t completedNs);
+    void recordOperation(const vk::CommandBuffer& commandBuffer,
+                         HazardTracker& hazardTracker,
+                         uint32_t operationIndex);
+    void checkStagingRingOrder(const std::shared_ptr<OpBase>& op);
+    void trackTensorGenerations(const std::shared_ptr<OpBase>& op);
+    bool tensorsRebuilt();
+    std::unique_lock<std::mutex> lockQueue();
+
+    friend class SubmitBatch;
+    friend class CompletionWaiter;
 };
 
 } // End namespace kp
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "kompute/Core.hpp"
+
+namespace kp {
+
+/**
+ * Compiles GLSL or HLSL compute shaders into SPIR-V within the process
+ * through the glslang library, which is linked when Kompute is built with
+ * KOMPUTE_OPT_ENABLE_SHADER_COMPILER.
+ *
+ * The SPIR-V is cached in memory, and optionally on disk, by a hash of the
+ * source together with the compile options, so a shader generated again
+ * with the same source is only compiled once. The on-disk cache is also
+ * read when the compiler is not linked, so shaders compiled ahead of time
+ * can be shipped in the cache directory. All the functions are thread safe.
+ */
+class Shader
+{
+  public:
+    /**
+     * Language of the source of a shader.
+     */
+    enum class Language
+    {
+        eGlsl = 0,
+        eHlsl = 1,
+    };
+
+    /**
+     * Compiles a compute shader into SPIR-V for the Vulkan version of
+     * KOMPUTE_VK_API_VERSION, or returns the cached SPIR-V of the same
+     * source and options.
+     *
+     * @param source The source of the compute shader
+     * @param definitions The preprocessor definitions as pairs of names and
+     * values, defined in order before the source
+     * @param language The language of the source
+     * @param entryPoint The name of the entry point function
+     * @return The compiled SPIR-V
+     */
+    static std::vector<uint32_t> compile(
+      const std::string& source,
+      const std::vector<std::pair<std::string, std::string>>& definitions = {},
+      Language language = Language::eGlsl,
+      const std::string& entryPoint = "main");
+
+    /**
+     * Builds the key of the compiled SPIR-V in the caches, made of the hex
+     * digits of a hash of the source, the definitions, the language, the
+     * entry point and the target Vulkan version.
+     *
+     * @param source The source of the compute shader
+     * @param definitions The preprocessor definitions
+     * @param language The language of the source
+     * @param entryPoint The name of the entry point function
+     * @return The key of the SPIR-V, which is also its file name in the
+     * on-disk cache
+     */
+    static std::string key(
+      const std::string& source,
+      const std::vector<std::pair<std::string, std::string>>& definitions = {},
+      Language language = Language::eGlsl,
+      const std::string& entryPoint = "main");
+
+    /**
+     * Sets the directory of the on-disk cache, which has to exist, where
+     * the SPIR-V of every compiled shader is stored as a <key>.spv file.
+     *
+     * @param directory The directory of the cache, or an empty string to
+     * disable the on-disk cache, which is disabled by default
+     */
+    static void setCacheDirectory(const std::string& directory);
+
+    /**
+     * Gets the directory of the on-disk cache.
+     *
+     * @return The directory of the cache, empty if disabled
+     */
+    static std::string cacheDirectory();
+
+    /**
+     * Removes every shader from the in-memory cache, leaving the on-disk
+     * cache untouched.
+     */
+    static void clearCache();
+
+    /**
+     * Whether Kompute was built with the glslang compiler, without which
+     * only the shaders already in the on-disk cache can be compiled.
+     *
+     * @return Boolean stating whether shaders can be compiled
+     */
+    static bool compilerAvailable();
+};
+
+} // End namespace kp
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "kompute/Core.hpp"
+
+#include "kompute/HostAllocator.hpp"
+
+namespace kp {
+
+/**
+ * Content addressed cache of the immutable pipeline resources of algorithms,
+ * shared by the algorithms created by a manager.
+ *
+ * Algorithms built from the same SPIR-V, specialization constants, push
+ * constant range and descriptor types share the same shader module,
+ * descriptor set layout, pipeline layout and pipeline, and only own their
+ * descriptor pool and descriptor set. The resources are owned by the cache
+ * and are only destroyed through prune or destroy.
+ */
+class ShaderCache
+{
+  public:
+    /**
+     * Pipeline resources of an entry of the cache, which must not be
+     * destroyed by the algorithms using them.
+     */
+    struct Entry
+    {
+        std::shared_ptr<vk::ShaderModule> shaderModule;
+        std::shared_ptr<vk::DescriptorSetLayout> descriptorSetLayout;
+        std::shared_ptr<vk::PipelineLayout> pipelineLayout;
+        std::shared_ptr<vk::Pipeline> pipeline;
+    };
+
+    /**
+     * Constructor for the cache of the pipeline resources of a device.
+     *
+     * @param device The device the resources are created with
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy the resources of the entries with
+     */
+    ShaderCache(std::shared_ptr<vk::Device> device,
+                std::shared_ptr<HostAllocator> hostAllocator = nullptr);
+
+    /**
+     * Destructor which destroys the resources of all the entries.
+     */
+    ~ShaderCache();
+
+    /**
+     * Builds the key of the resources of an algorithm, made of a hash of the
+     * SPIR-V together with the bytes of the specialization constants, the
+     * size of the push constant range, the descriptor types of the bindings
+     * and the specialized local size.
+     *
+     * @param spirv The SPIR-V of the shader
+     * @param specializationConstantsData The specialization constant bytes
+     * @param specializationConstantsDataTypeMemorySize The size in bytes of
+     * each specialization constant
+     * @param specializationConstantsSize The number of specialization
+     * constants
+     * @param pushConstantsRangeSize The size in bytes of the push constants
+     * @param descriptorTypes The descriptor type of each binding
+     * @param localSizeX The local size x specialized by the algorithm, or 0
+     * @return The key identifying the resources in the cache
+     */
+    static std::string key(const std::vector<uint32_t>& spirv,
+                           const void* specializationConstantsData,
+                           uint32_t specializationConstantsDataTypeMemorySize,
+                           uint32_t specializationConstantsSize,
+                           uint32_t pushConstantsRangeSize,
+                           const std::vector<vk::DescriptorType>& descriptorTypes,
+                           uint32_t localSizeX = 0);
+
+    /**
+     * Looks up the resources stored with the key.
+     *
+     * @param key The key built with ShaderCache::key
+     * @param entry The entry to fill with the resources if found
+     * @return Boolean stating whether the resources were found
+     */
+    bool find(const std::string& key, Entry& entry);
+
+    /**
+     * Stores resources with the key, transferring their ownership to the
+     * cache. If resources were stored for the key meanwhile, the ones
+     * provided are destroyed and the entry is replaced with the stored ones.
+     *
+     * @param key The key built with ShaderCache::key
+     * @param entry The resources to store, replaced with the stored ones
+     */
+    void insert(const std::string& key, Entry& entry);
+
+    /**
+     * Destroys the resources of the entries no longer used by any algorithm.
+     */
+    void prune();
+
+    /**
+     * Returns the number of entries of the cache.
+     *
+     * @return Number of entries
+     */
+    uint32_t size();
+
+    /**
+     * Destroys the resources of all the entries. Algorithms using them must
+     * have been destroyed.
+     */
+    void destroy();
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<vk::Device> mDevice;
+    std::shared_ptr<HostAllocator> mHostAllocator;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::unordered_map<std::string, Entry> mEntries;
+    std::mutex mMutex;
+
+    void destroyEntry(const Entry& entry);
+};
+
+} // End namespace kp
@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Core.hpp"
+
+#include "kompute/Tensor.hpp"
+
+namespace kp {
+
+/**
+ * Tensor distributed across the devices of a MultiManager, made of one
+ * tensor per device. The shards either hold consecutive blocks of rows of
+ * the tensor, or each hold a full replica of it.
+ */
+class ShardedTensor
+{
+  public:
+    /**
+     * Distribution of the elements of the tensor across the shards.
+     */
+    enum class Layout
+    {
+        eRows = 0,       ///< Each shard holds a block of consecutive rows
+        eReplicated = 1, ///< Each shard holds all the elements
+    };
+
+    /**
+     * Constructor from the tensors of the shards, which are not copied.
+     *
+     * @param shards The tensor of each device, in the order of the devices
+     * @param offsets The index in the full tensor of the first element of
+     * each shard
+     * @param size The number of elements of the full tensor
+     * @param layout The distribution of the elements across the shards
+     */
+    ShardedTensor(const std::vector<std::shared_ptr<Tensor>>& shards,
+                  const std::vector<uint64_t>& offsets,
+                  uint64_t size,
+                  Layout layout);
+
+    /**
+     * Destructor which does not destroy the shards, which are owned by the
+     * managers of their devices.
+     */
+    ~ShardedTensor();
+
+    /**
+     * Retrieve the tensors of the shards.
+     *
+     * @return The tensor of each device, in the order of the devices
+     */
+    const std::vector<std::shared_ptr<Tensor>>& shards();
+
+    /**
+     * Retrieve the tensor of the shard of a device.
+     *
+     * @param deviceIndex The index of the device in the MultiManager
+     * @return The tensor of the shard
+     */
+    std::shared_ptr<Tensor> shard(uint32_t deviceIndex);
+
+    /**
+     * Retrieve the index in the full tensor of the first element of the
+     * shard of a device, which is 0 for replicated tensors.
+     *
+     * @param deviceIndex The index of the device in the MultiManager
+     * @return The offset of the shard in elements
+     */
+    uint64_t shardOffset(uint32_t deviceIndex);
+
+    /**
+     * Retrieve the number of elements of the full tensor.
+     *
+     * @return Number of elements of the full tensor
+     */
+    uint64_t size();
+
+    /**
+     * Retrieve the distribution of the elements across the shards.
+     *
+     * @return The layout of the tensor
+     */
+    Layout layout();
+
+    /**
+     * Retrieve the host data of the full tensor, concatenating the host data
+     * of the shards of rows, or taken from the first shard if replicated.
+     * The host data of the shards is only updated by syncLocal.
+     *
+     * @return Vector with the elements of the full tensor
+     */
+    template<typename T>
+    std::vector<T> vector()
+    {
+        if (this->mLayout == Layout::eReplicated) {
+            return this->mShards[0]->vector<T>();
+        }
+
+        std::vector<T> data;
+        data.reserve(this->mSize);
+        for (const std::shared_ptr<Tensor>& shard : this->mShards) {
+            std::vector<T> shardData = shard->vector<T>();
+            data.insert(data.end(), shardData.begin(), shardData.end());
+        }
+        return data;
+    }
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mShards;
+
+    std::vector<uint64_t> mOffsets;
+    uint64_t mSize;
+    Layout mLayout;
+};
+
+} // End namespace kp
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Core.hpp"
+
+#include "kompute/Tensor.hpp"
+
+namespace kp {
+
+/**
+ * Sparse matrix in compressed sparse row (CSR) format, made of three
+ * tensors: the row pointers, holding the index of the first non zero of each
+ * row followed by the number of non zeros, the column index of each non zero
+ * and the value of each non zero. Only the non zeros are stored and
+ * transferred, which is what makes very sparse matrices cheaper than dense
+ * tensors.
+ *
+ * The tensors are synced like any other tensor, for example recording
+ * OpTensorSyncDevice with the tensors returned by tensors().
+ */
+class SparseTensor
+{
+  public:
+    /**
+     * Constructor from the tensors of a CSR matrix, which are not copied.
+     *
+     * @param rowPointers Unsigned int tensor of at least rows + 1 elements
+     * @param columnIndices Unsigned int tensor of the column of each non zero
+     * @param values Float tensor of the value of each non zero
+     * @param rows The number of rows of the matrix
+     * @param columns The number of columns of the matrix
+     * @param nonZeroCount The number of non zeros of the matrix, which the
+     * column indices and values tensors hold at least, or a single element
+     * for matrices without non zeros
+     */
+    SparseTensor(std::shared_ptr<Tensor> rowPointers,
+                 std::shared_ptr<Tensor> columnIndices,
+                 std::shared_ptr<Tensor> values,
+                 uint32_t rows,
+                 uint32_t columns,
+                 uint32_t nonZeroCount);
+
+    /**
+     * Destructor which does not destroy the tensors, which are owned by the
+     * manager that created them.
+     */
+    ~SparseTensor();
+
+    /**
+     * Retrieve the row pointers tensor.
+     *
+     * @return Tensor of the index of the first non zero of each row
+     */
+    std::shared_ptr<Tensor> rowPointers();
+
+    /**
+     * Retrieve the column indices tensor.
+     *
+     * @return Tensor of the column of each non zero
+     */
+    std::shared_ptr<Tensor> columnIndices();
+
+    /**
+     * Retrieve the values tensor.
+     *
+     * @return Tensor of the value of each non zero
+     */
+    std::shared_ptr<Tensor> values();
+
+    /**
+     * Retrieve the tensors of the matrix, to sync them or bind them to an
+     * algorithm.
+     *
+     * @return The row pointers, column indices and values tensors
+     */
+    std::vector<std::shared_ptr<Tensor>> tensors();
+
+    /**
+     * Retrieve the number of rows of the matrix.
+     *
+     * @return Number of rows
+     */
+    uint32_t rows();
+
+    /**
+     * Retrieve the number of columns of the matrix.
+     *
+     * @return Number of columns
+     */
+    uint32_t columns();
+
+    /**
+     * Retrieve the number of non zeros of the matrix.
+     *
+     * @return Number of non zeros
+     */
+    uint32_t nonZeroCount();
+
+    /**
+     * Checks that host arrays describe a valid CSR matrix, with row pointers
+     * starting at 0, never decreasing and ending at the number of non zeros,
+     * and column indices within the columns, so shaders never read out of
+     * the bounds of the tensors.
+     *
+     * @param rows The number of rows of the matrix
+     * @param columns The number of columns of the matrix
+     * @param nonZeroCount The number of non zeros of the matrix
+     * @param rowPointers Array of rows + 1 row pointers
+     * @param columnIndices Array of nonZeroCount column indices
+     */
+    static void validate(uint32_t rows,
+                         uint32_t columns,
+                         uint32_t nonZeroCount,
+                         const uint32_t* rowPointers,
+                         const uint32_t* columnIndices);
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<Tensor> mRowPointers;
+    std::shared_ptr<Tensor> mColumnIndices;
+    std::shared_ptr<Tensor> mValues;
+
+    uint32_t mRows;
+    uint32_t mColumns;
+    uint32_t mNonZeroCount;
+};
+
+} // End namespace kp
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <mutex>
+
+#include "kompute/Core.hpp"
+
+#include "kompute/HostAllocator.hpp"
+#include "kompute/MemoryPool.hpp"
+
+#ifndef KOMPUTE_STAGING_RING_SIZE
+#define KOMPUTE_STAGING_RING_SIZE (16 * 1024 * 1024)
+#endif
+
+#ifndef KOMPUTE_STAGING_RING_SLOTS
+#define KOMPUTE_STAGING_RING_SLOTS 4
+#endif
+
+namespace kp {
+
+/**
+ * Fixed size host visible buffer shared by device tensors to transfer data
+ * to and from their device memory, instead of each tensor keeping its own
+ * staging buffer.
+ *
+ * The ring is split into slots which each have their own command buffer and
+ * fence, so transfers larger than a slot are streamed in chunks while the
+ * host copies the next chunk into a free slot.
+ */
+class StagingRing
+{
+  public:
+    /**
+     * Constructor for the staging ring which creates the host visible buffer
+     * and the command buffers used to submit the transfers.
+     *
+     * @param physicalDevice The physical device to use to fetch properties
+     * @param device The device to use to create the buffer and commands from
+     * @param computeQueue The queue to submit the transfers to
+     * @param queueIndex The index of the family of the queue provided
+     * @param memoryPool The pool to allocate the ring memory from
+     * @param ringSize The total size in bytes of the ring
+     * @param slotCount The number of slots the ring is split into
+     * @param queueMutex (Optional) Mutex held while submitting to the queue,
+     * shared with the other users of the queue
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy the buffer, command pool and fences of the ring with
+     */
+    StagingRing(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
+                std::shared_ptr<vk::Device> device,
+                std::shared_ptr<vk::Queue> computeQueue,
+                uint32_t queueIndex,
+                std::shared_ptr<MemoryPool> memoryPool,
+                vk::DeviceSize ringSize = KOMPUTE_STAGING_RING_SIZE,
+                uint32_t slotCount = KOMPUTE_STAGING_RING_SLOTS,
+                std::shared_ptr<std::mutex> queueMutex = nullptr,
+                std::shared_ptr<HostAllocator> hostAllocator = nullptr);
+
+    /**
+     * Destructor which waits for pending transfers and frees the vulkan
+     * resources of the ring.
+     */
+    ~StagingRing();
+
+    /**
+     * Copies host data into the buffer provided through the ring. The copies
+     * are submitted before returning, and later submissions to the same queue
+     * are expected to synchronise with them via their own barriers.
+     *
+     * @param data Pointer to the host data to upload
+     * @param dstBuffer Buffer to copy the data into
+     * @param dstOffset Offset in bytes into the destination buffer
+     * @param size Size in bytes of the data to upload
+     */
+    void upload(const void* data,
+                const vk::Buffer& dstBuffer,
+                vk::DeviceSize dstOffset,
+                vk::DeviceSize size);
+
+    /**
+     * Copies the contents of the buffer provided into host memory through the
+     * ring, waiting for all the transfers to complete before returning.
+     *
+     * @param srcBuffer Buffer to copy the data from
+     * @param srcOffset Offset in bytes into the source buffer
+     * @param data Pointer to the host memory to download into
+     * @param size Size in bytes of the data to download
+     */
+    void download(const vk::Buffer& srcBuffer,
+                  vk::DeviceSize srcOffset,
+                  void* data,
+                  vk::DeviceSize size);
+
+    /**
+     * Waits for all the transfers in flight to complete.
+     */
+    void waitIdle();
+
+    /**
+     * Destroys the vulkan resources of the ring after waiting for any pending
+     * transfers.
+     */
+    void destroy();
+
+    /**
+     * Total size in bytes of the ring.
+     *
+     * @return Size of the ring buffer
+     */
+    vk::DeviceSize size();
+
+    /**
+     * Queue the transfers of the ring are submitted to.
+     *
+     * @return Queue of the ring
+     */
+    std::shared_ptr<vk::Queue> queue();
+
+  private:
+    struct Slot
+    {
+        vk::DeviceSize offset = 0;
+        vk::CommandBuffer commandBuffer;
+        vk::Fence fence;
+        bool pending = false;
+        // Host destination of a download waiting on the fence of the slot
+        void* readbackData = nullptr;
+        vk::DeviceSize readbackSize = 0;
+    };
+
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<vk::PhysicalDevice> mPhysicalDevice;
+    std::shared_ptr<vk::Device> mDevice;
+    std::shared_ptr<vk::Queue> mComputeQueue;
+    std::shared_ptr<std::mutex> mQueueMutex;
+    std::shared_ptr<MemoryPool> mMemoryPool;
+    std::shared_ptr<HostAllocator> mHostAllocator;
+    // Stages of previous submissions the copies wait for, which exclude
+    // the compute shader stage on transfer queues
+    vk::PipelineStageFlags mWaitStageMask;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    vk::Buffer mBuffer;
+    MemoryPool::Allocation mAllocation;
+    vk::CommandPool mCommandPool;
+    std::vector<Slot> mSlots;
+    uint32_t mNextSlot = 0;
+    vk::DeviceSize mSlotSize = 0;
+    vk::DeviceSize mSize = 0;
+    std::mutex mMutex;
+
+    Slot& acquireSlot();
+    void completeSlot(Slot& slot);
+    void submitSlot(Slot& slot,
+                    const vk::Buffer& srcBuffer,
+                    const vk::Buffer& dstBuffer,
+                    const vk::BufferCopy& copyRegion,
+                    bool readback);
+};
+
+} // End namespace kp
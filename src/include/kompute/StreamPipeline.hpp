@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <functional>
+
+#include "kompute/Core.hpp"
+
+#include "kompute/Sequence.hpp"
+
+namespace kp {
+
+/**
+ * Pipeline streaming data larger than the memory of the device through an
+ * algorithm in chunks, so the transfers of a chunk overlap with the dispatch
+ * of the others instead of leaving the device idle.
+ *
+ * Each slot of the pipeline holds the tensors of a chunk and an algorithm
+ * bound to them. Up to one chunk per slot is in flight, so with three slots
+ * the upload of a chunk, the dispatch of the previous one and the download of
+ * the one before can run at the same time. When the slots have sequences on
+ * a transfer queue, the uploads and downloads run on that queue and are
+ * chained to the dispatches on the compute queue by timeline semaphores.
+ * Otherwise each chunk runs as a single sequence, and only the host side of
+ * the transfers overlaps with the device.
+ */
+class StreamPipeline
+{
+  public:
+    /**
+     * Function filling the host data of the input tensors with a chunk,
+     * returning the number of elements written to each of them, which is
+     * zero once the source is exhausted.
+     */
+    typedef std::function<uint64_t(
+      uint64_t chunkIndex,
+      const std::vector<std::shared_ptr<Tensor>>& inputs)>
+      Source;
+
+    /**
+     * Function consuming the host data of the output tensors of a chunk,
+     * called in the order of the chunks with the number of elements the
+     * source wrote for that chunk.
+     */
+    typedef std::function<void(
+      uint64_t chunkIndex,
+      const std::vector<std::shared_ptr<Tensor>>& outputs,
+      uint64_t elementCount)>
+      Sink;
+
+    /**
+     * Resources of one chunk in flight.
+     */
+    struct Slot
+    {
+        std::vector<std::shared_ptr<Tensor>> inputs; ///< Filled by the source
+        std::vector<std::shared_ptr<Tensor>> outputs; ///< Read by the sink
+        std::shared_ptr<Algorithm> algorithm; ///< Bound to the tensors
+        std::shared_ptr<Sequence> compute;    ///< Dispatches the algorithm
+        std::shared_ptr<Sequence> upload;     ///< Optional, transfer queue
+        std::shared_ptr<Sequence> download;   ///< Optional, transfer queue
+    };
+
+    /**
+     * Constructor recording the operations of each slot into its sequences.
+     * The uploads and downloads are recorded into the compute sequence of
+     * the slots without upload and download sequences.
+     *
+     * @param slots The resources of the chunks that can be in flight at the
+     * same time, usually two or three
+     * @param chunkSize The number of elements of each tensor of the slots
+     */
+    StreamPipeline(const std::vector<Slot>& slots, uint64_t chunkSize);
+
+    /**
+     * Destructor which waits for the chunks in flight and releases the
+     * resources of the slots.
+     */
+    ~StreamPipeline();
+
+    /**
+     * Streams the chunks of the source through the algorithm until the
+     * source is exhausted, passing the outputs of each chunk to the sink.
+     * The elements of the inputs past the count returned by the source are
+     * set to zero. An exception thrown by the source or the sink is rethrown
+     * once the chunks in flight completed.
+     *
+     * @param source The function filling the inputs of each chunk
+     * @param sink The function consuming the outputs of each chunk
+     * @return Number of chunks processed
+     */
+    uint64_t run(Source source, Sink sink);
+
+    /**
+     * Returns the number of elements of each tensor of a chunk.
+     *
+     * @return Number of elements per chunk
+     */
+    uint64_t chunkSize();
+
+    /**
+     * Returns the number of chunks that can be in flight at the same time.
+     *
+     * @return Number of slots
+     */
+    uint32_t depth();
+
+    /**
+     * Checks whether the transfers run on a queue of their own, so they
+     * overlap with the dispatches on the device.
+     *
+     * @return Boolean stating whether the slots have transfer sequences
+     */
+    bool hasTransferQueue();
+
+    /**
+     * Waits for the chunks in flight and releases the resources of the
+     * slots.
+     */
+    void destroy();
+
+  private:
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<Slot> mSlots;
+    uint64_t mChunkSize = 0;
+    // Chunk in flight in each slot, or -1, and the number of its elements
+    std::vector<int64_t> mSlotChunks;
+    std::vector<uint64_t> mSlotCounts;
+
+    void submit(uint32_t slotIndex);
+    void await(uint32_t slotIndex);
+};
+
+} // End namespace kp
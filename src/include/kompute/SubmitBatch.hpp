@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Core.hpp"
+
+#include "kompute/HostAllocator.hpp"
+#include "kompute/Sequence.hpp"
+
+namespace kp {
+
+/**
+ * Handle to a group of sequences submitted together, which can be awaited as
+ * a whole instead of calling evalAwait on each of the sequences.
+ *
+ * The sequences targeting the same queue are sent with a single queue submit
+ * containing one submit info per sequence, and signal a single fence.
+ */
+class SubmitBatch : public std::enable_shared_from_this<SubmitBatch>
+{
+  public:
+    /**
+     * Constructor for the batch, which is created empty and then submitted
+     * with submit.
+     *
+     * @param device The device to create the fences of the batch with
+     * @param hostAllocator (Optional) Host allocation callbacks to create and
+     * destroy the fences of the batch with
+     */
+    SubmitBatch(std::shared_ptr<vk::Device> device,
+                std::shared_ptr<HostAllocator> hostAllocator = nullptr);
+
+    /**
+     * Destructor which waits for the submissions of the batch and frees its
+     * fences.
+     */
+    ~SubmitBatch();
+
+    /**
+     * Submits the recorded operations of every sequence provided, grouped in
+     * a single queue submit per queue. Each sequence is submitted as with
+     * evalAsync, so it must have a free submission within its in flight depth.
+     *
+     * @param sequences The sequences to submit, in the order of submission
+     */
+    void submit(const std::vector<std::shared_ptr<Sequence>>& sequences);
+
+    /**
+     * Waits for every submission of the batch to finish processing and then
+     * runs the postEval of the operations of each sequence, retiring their
+     * submissions as evalAwait would.
+     *
+     * @param waitFor Number of nanoseconds to wait before timing out
+     * @return Boolean stating whether the batch completed within the timeout
+     */
+    bool await(uint64_t waitFor = UINT64_MAX);
+
+    /**
+     * Checks without blocking whether every submission of the batch has
+     * finished executing on the GPU.
+     *
+     * @return Boolean stating whether the GPU has finished the batch
+     */
+    bool isComplete();
+
+    /**
+     * Returns the number of queue submits performed by the batch, one for
+     * each distinct queue targeted by its sequences.
+     *
+     * @return Number of queue submits of the batch
+     */
+    uint32_t queueSubmitCount();
+
+    /**
+     * Waits for the submissions of the batch and destroys its fences. The
+     * submissions remain in flight on their sequences until awaited.
+     */
+    void destroy();
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<vk::Device> mDevice;
+    std::shared_ptr<HostAllocator> mHostAllocator;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<vk::Fence> mFences;
+    std::vector<std::shared_ptr<Sequence>> mSequences;
+
+    vk::Result waitFence(uint32_t fenceIndex, uint64_t waitFor);
+    vk::Result fenceStatus(uint32_t fenceIndex);
+    bool hasPendingSubmission(Sequence& sequence);
+
+    friend class Sequence;
+};
+
+} // End namespace kp
@@ -3,8 +3,33 @@
 
 #include "kompute/Core.hpp"
 
+#include "kompute/DebugUtils.hpp"
+#include "kompute/DeviceInfo.hpp"
+#include "kompute/HostAllocator.hpp"
+#include "kompute/MemoryPool.hpp"
+#include "kompute/Metrics.hpp"
+#include "kompute/StagingRing.hpp"
+
+#ifndef KOMPUTE_TENSOR_MAX_DIRTY_RANGES
+#define KOMPUTE_TENSOR_MAX_DIRTY_RANGES 64
+#endif
+
 namespace kp {
 
+/**
+ * IEEE 754 half precision float, the element type of eHalf tensors. Only the
+ * bits of the value are stored, which are converted from and to float on the
+ * host with round to nearest even, while shaders access them as float16_t.
+ */
+struct Half
+{
+    uint16_t bits = 0;
+
+    Half() = default;
+    Half(float value);
+    operator float() const;
+};
+
 /**
  * Structured data used in GPU operations.
  *
@@ -20,13 +45,33 @@ class Tensor
      * Type for tensors created: Device allows memory to be transferred from
      * staging buffers. Staging are host memory visible. Storage are device
      * visible but are not set up to transfer or receive data (only for shader
-     * storage).
+     * storage). Uniform are host coherent memory read by shaders as a uniform
+     * buffer, so parameters written on the host before a submission are seen
+     * by sequences recorded once, without syncing or re-recording. Image are
+     * device memory 2D images bound as storage images, transferred through a
+     * staging buffer like device tensors.
      */
     enum class TensorTypes
     {
         eDevice = 0,  ///< Type is device memory, source and destination
         eHost = 1,    ///< Type is host memory, source and destination
         eStorage = 2, ///< Type is Device memory (only)
+        eUniform = 3, ///< Type is host memory bound as a uniform buffer
+        eImage = 4,   ///< Type is device memory bound as a storage image
+    };
+    /**
+     * Type of host visible memory used for the staging memory of device
+     * tensors, or the primary memory of host tensors. Cached memory speeds up
+     * reading the data on the host after a sync, at the cost of explicitly
+     * flushing and invalidating the memory when it is not coherent. Imported
+     * memory uses the data pointer provided directly as the memory of the
+     * tensor, in which case the pointer must outlive the tensor.
+     */
+    enum class HostMemoryTypes
+    {
+        eCoherent = 0, ///< Host coherent memory, usually uncached for reads
+        eCached = 1,   ///< Host cached memory, falls back to coherent memory
+        eImported = 2, ///< Data pointer imported, falls back to a copy
     };
     enum class TensorDataTypes
     {
@@ -35,6 +80,20 @@ class Tensor
         eUnsignedInt = 2,
         eFloat = 3,
         eDouble = 4,
+        eHalf = 5,          ///< kp::Half, requires 16 bit storage in shaders
+        eInt8 = 6,          ///< int8_t, requires 8 bit storage in shaders
+        eUnsignedInt8 = 7,  ///< uint8_t, requires 8 bit storage in shaders
+        eInt16 = 8,         ///< int16_t, requires 16 bit storage in shaders
+    };
+
+    /**
+     * Contiguous range of elements of a tensor, used to restrict transfers to
+     * the parts of the tensor that have changed.
+     */
+    struct Range
+    {
+        uint64_t offset = 0; ///< Index of the first element of the range
+        uint64_t count = 0;  ///< Number of elements in the range
     };
 
     /**
@@ -46,14 +105,151 @@ class Tensor
      *  @param data Non-zero-sized vector of data that will be used by the
      * tensor
      *  @param tensorTypes Type for the tensor which is of type TensorTypes
+     *  @param hostMemoryType Type of the host visible memory of the tensor
+     *  @param memoryPool (Optional) Pool to sub-allocate the memory from, if
+     * not provided each buffer will get its own device memory allocation
+     *  @param stagingRing (Optional) Shared ring to transfer data through for
+     * device tensors, in which case no staging buffer is created and the
+     * tensor data is held in host memory
+     *  @param queueFamilyIndices (Optional) Queue families the buffers are
+     * accessed from, which are created with concurrent sharing when there
+     * are several so that no ownership transfer is needed between the
+     * queues. The buffers are exclusive to a single queue family otherwise.
+     *  @param debugUtils (Optional) Functions of VK_EXT_debug_utils to name
+     * the buffers of the tensor with, see setName
+     *  @param metrics (Optional) Counters to add the bytes transferred and
+     * the barriers recorded by the tensor to
+     *  @param hostAllocator (Optional) Host allocation callbacks to create
+     * and destroy the buffers and memory of the tensor with
+     *  @param deviceInfo (Optional) Properties of the physical device already
+     * queried by the manager, queried from the device if null
      */
     Tensor(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
            std::shared_ptr<vk::Device> device,
            void* data,
-           uint32_t elementTotalCount,
+           uint64_t elementTotalCount,
            uint32_t elementMemorySize,
            const TensorDataTypes& dataType,
-           const TensorTypes& tensorType = TensorTypes::eDevice);
+           const TensorTypes& tensorType = TensorTypes::eDevice,
+           const HostMemoryTypes& hostMemoryType = HostMemoryTypes::eCoherent,
+           std::shared_ptr<MemoryPool> memoryPool = nullptr,
+           std::shared_ptr<StagingRing> stagingRing = nullptr,
+           const std::vector<uint32_t>& queueFamilyIndices = {},
+           std::shared_ptr<DebugUtils> debugUtils = nullptr,
+           std::shared_ptr<Metrics> metrics = nullptr,
+           std::shared_ptr<HostAllocator> hostAllocator = nullptr,
+           std::shared_ptr<DeviceInfo> deviceInfo = nullptr);
+
+    /**
+     *  Constructor for a view that aliases a range of elements of a parent
+     * tensor. The view shares the buffers and memory of the parent without
+     * copying, and exposes its own offset and size to descriptors, copies and
+     * barriers. The view holds a reference to the parent, which cannot be
+     * reallocated while the view exists, and is destroyed along with the
+     * parent if the parent is destroyed explicitly.
+     *
+     *  @param parent Tensor that owns the memory aliased by the view
+     *  @param offset Index of the first element of the parent in the view
+     *  @param count Number of elements of the view
+     */
+    Tensor(std::shared_ptr<Tensor> parent, uint64_t offset, uint64_t count);
+
+    /**
+     *  Constructor for a tensor of type eImage, holding its data in a 2D
+     * image with optimal tiling instead of a buffer. Shaders access it as a
+     * storage image with imageLoad and imageStore, whose caches are laid out
+     * for 2D locality, and the image can be sampled by a renderer sharing
+     * the device. The elements are stored in row major order with the
+     * channels of a texel interleaved, and the format is derived from the
+     * data type and the number of channels, see imageFormat. The image is
+     * kept in the general layout, and its contents are undefined until it
+     * is synced with OpTensorSyncDevice or filled with OpTensorFill.
+     *
+     *  @param physicalDevice The physical device to use to fetch properties
+     *  @param device The device to use to create the image and memory from
+     *  @param data Data of width * height * channels elements, or null to
+     * leave the host data uninitialised
+     *  @param width Width of the image in texels
+     *  @param height Height of the image in texels
+     *  @param channels Number of channels of a texel, which is 1, 2 or 4
+     *  @param dataType The data type of the channels
+     *  @param hostMemoryType Type of the host visible staging memory
+     *  @param memoryPool (Optional) Pool to sub-allocate the memory from
+     *  @param queueFamilyIndices (Optional) Queue families the image is
+     * accessed from, see the data constructor
+     *  @param debugUtils (Optional) Functions of VK_EXT_debug_utils to name
+     * the image and buffer of the tensor with, see setName
+     *  @param metrics (Optional) Counters to add the bytes transferred and
+     * the barriers recorded by the tensor to
+     *  @param hostAllocator (Optional) Host allocation callbacks to create
+     * and destroy the image, buffer and memory of the tensor with
+     *  @param deviceInfo (Optional) Properties of the physical device already
+     * queried by the manager, queried from the device if null
+     */
+    Tensor(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
+           std::shared_ptr<vk::Device> device,
+           void* data,
+           uint32_t width,
+           uint32_t height,
+           uint32_t channels,
+           const TensorDataTypes& dataType,
+           const HostMemoryTypes& hostMemoryType = HostMemoryTypes::eCoherent,
+           std::shared_ptr<MemoryPool> memoryPool = nullptr,
+           const std::vector<uint32_t>& queueFamilyIndices = {},
+           std::shared_ptr<DebugUtils> debugUtils = nullptr,
+           std::shared_ptr<Metrics> metrics = nullptr,
+           std::shared_ptr<HostAllocator> hostAllocator = nullptr,
+           std::shared_ptr<DeviceInfo> deviceInfo = nullptr);
+
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+    /**
+     *  Constructor importing the memory of an Android hardware buffer, such
+     * as a camera or neural network input frame, so shaders access it
+     * without copying it through host memory. The buffer must have the
+     * AHARDWAREBUFFER_FORMAT_BLOB format and the
+     * AHARDWAREBUFFER_USAGE_GPU_DATA_BUFFER usage, and its width in bytes
+     * sets the size of the tensor. The tensor is of type eHost when the
+     * memory can be mapped, which is the case for buffers allocated with CPU
+     * usage, and of type eStorage otherwise. It holds a reference to the
+     * hardware buffer until it is destroyed, and cannot be rebuilt.
+     *
+     *  @param physicalDevice The physical device to use to fetch properties
+     *  @param device The device to import the memory with
+     *  @param hardwareBuffer The hardware buffer to import
+     *  @param dataType The data type of the elements of the buffer
+     *  @param memoryPool Pool with hardware buffer import enabled, see
+     * MemoryPool::enableHardwareBufferImport
+     *  @param queueFamilyIndices (Optional) Queue families the buffer is
+     * accessed from, see the data constructor
+     *  @param debugUtils (Optional) Functions of VK_EXT_debug_utils to name
+     * the buffer of the tensor with, see setName
+     *  @param metrics (Optional) Counters to add the bytes transferred and
+     * the barriers recorded by the tensor to
+     *  @param hostAllocator (Optional) Host allocation callbacks to create
+     * and destroy the buffer of the tensor with
+     *  @param deviceInfo (Optional) Properties of the physical device already
+     * queried by the manager, queried from the device if null
+     */
+    Tensor(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
+           std::shared_ptr<vk::Device> device,
+           AHardwareBuffer* hardwareBuffer,
+           const TensorDataTypes& dataType,
+           std::shared_ptr<MemoryPool> memoryPool,
+           const std::vector<uint32_t>& queueFamilyIndices = {},
+           std::shared_ptr<DebugUtils> debugUtils = nullptr,
+           std::shared_ptr<Metrics> metrics = nullptr,
+           std::shared_ptr<HostAllocator> hostAllocator = nullptr,
+           std::shared_ptr<DeviceInfo> deviceInfo = nullptr);
+
+    /**
+     * Retrieve the Android hardware buffer the memory of the tensor was
+     * imported from.
+     *
+     * @return The hardware buffer, null if the tensor was not created from
+     * one
+     */
+    AHardwareBuffer* hardwareBuffer();
+#endif
 
     /**
      * Destructor which is in charge of freeing vulkan resources unless they
@@ -63,17 +259,57 @@ class Tensor
 
     /**
      * Function to trigger reinitialisation of the tensor buffer and memory with
-     * new data as well as new potential device type.
+     * new data as well as new potential device type. Similar to std::vector,
+     * the buffers and memory are kept when the new data fits within the
+     * capacity of the tensor, in which case only the size and data are
+     * updated. Sequences recorded with the tensor must not be running during
+     * a rebuild, and record their operations again when they are next
+     * submitted. Algorithms bound to the tensor then rewrite their descriptor
+     * set in place, so no sequence that recorded them may be running at that
+     * point either. Tensors aliased by views can only be rebuilt within their
+     * capacity.
      *
-     * @param data Vector of data to use to initialise vector from
-     * @param tensorType The type to use for the tensor
+     * @param data Pointer to the data to initialise the tensor with, which
+     * can be null to leave the memory uninitialised
+     * @param elementTotalCount Number of elements of the tensor
+     * @param elementMemorySize Size in bytes of a single element
      */
     void rebuild(void* data,
-                 uint32_t elementTotalCount,
+                 uint64_t elementTotalCount,
                  uint32_t elementMemorySize);
 
+    /**
+     * Grows the capacity of the tensor to fit at least the number of elements
+     * provided, so later rebuilds up to that size keep the same buffers. The
+     * host data is preserved, but the device memory is reallocated without
+     * copying its contents. Does nothing if the capacity is already enough.
+     * Sequences recorded with the tensor are subject to the same
+     * restrictions as for rebuild. Tensors aliased by views cannot grow.
+     *
+     * @param elementCapacity Number of elements to reserve memory for
+     */
+    void reserve(uint64_t elementCapacity);
+
+    /**
+     * Returns the number of elements the buffers and memory of the tensor can
+     * hold, which is never smaller than the size of the tensor.
+     *
+     * @return Unsigned integer representing the capacity in elements
+     */
+    uint64_t capacity();
+
+    /**
+     * Returns a counter incremented whenever the size or buffers of the
+     * tensor change, which allows the algorithms bound to the tensor to find
+     * out whether their descriptors have to be refreshed.
+     *
+     * @return Unsigned integer identifying the current buffers and size
+     */
+    uint64_t generation();
+
     /**
      * Destroys and frees the GPU resources which include the buffer and memory.
+     * The views aliasing the tensor are destroyed first.
      */
     void destroy();
 
@@ -91,34 +327,262 @@ class Tensor
      */
     TensorTypes tensorType();
 
+    /**
+     * Retrieve the type of host visible memory requested for the Tensor
+     *
+     * @return Host memory type of tensor
+     */
+    HostMemoryTypes hostMemoryType();
+
+    /**
+     * Check whether the tensor is a view aliasing the memory of a parent
+     * tensor.
+     *
+     * @return Boolean stating whether the tensor is a view
+     */
+    bool isView();
+
+    /**
+     * Retrieve the tensor owning the memory a view aliases. Views of views
+     * share the same parent.
+     *
+     * @return Parent tensor of the view, null if the tensor is not a view
+     */
+    std::shared_ptr<Tensor> parent();
+
+    /**
+     * Check whether the host visible memory of the tensor is the data
+     * pointer it was created with, imported via VK_EXT_external_memory_host.
+     *
+     * @return Boolean stating whether the host memory was imported
+     */
+    bool isHostMemoryImported();
+
+    /**
+     * Retrieve the offset in bytes of the tensor data within its buffers,
+     * which is only non-zero for views.
+     *
+     * @return Offset of the tensor in its buffers
+     */
+    vk::DeviceSize bufferOffset();
+
+    /**
+     * Retrieve the device address of the tensor data, offset for views,
+     * which shaders dereference through GL_EXT_buffer_reference. This
+     * requires the manager to be created with VK_KHR_buffer_device_address
+     * in its desired extensions, and is not supported by image tensors.
+     *
+     * @return Device address of the first element of the tensor
+     */
+    vk::DeviceAddress deviceAddress();
+
+    /**
+     * Retrieve the queue families the buffers of the tensor are shared
+     * between with concurrent sharing.
+     *
+     * @return Distinct queue family indices, empty if the buffers are
+     * exclusive to a single queue family
+     */
+    const std::vector<uint32_t>& queueFamilyIndices();
+
+    /**
+     * Retrieve the image holding the data of a tensor of type eImage, which
+     * is in the general layout outside of the sync and fill operations.
+     *
+     * @return The image, null if the tensor is not an image
+     */
+    std::shared_ptr<vk::Image> image();
+
+    /**
+     * Retrieve the 2D view of the whole image of a tensor of type eImage,
+     * which shaders and renderers bind the image with.
+     *
+     * @return The image view, null if the tensor is not an image
+     */
+    std::shared_ptr<vk::ImageView> imageView();
+
+    /**
+     * Retrieve the extent of the image of a tensor of type eImage.
+     *
+     * @return Width and height of the image in texels, with a depth of 1
+     */
+    vk::Extent3D imageExtent();
+
+    /**
+     * Retrieve the format of the image of a tensor of type eImage.
+     *
+     * @return Format of the image, eUndefined if the tensor is not an image
+     */
+    vk::Format imageFormat();
+
+    /**
+     * Returns the format of the images holding channels of a data type. 8
+     * and 16 bit unsigned and signed integers map to normalized formats
+     * read as floats by shaders, except eInt16 which stays an integer, and
+     * other types map to the format of the same bit width. Booleans and
+     * doubles have no image format.
+     *
+     * @param dataType The data type of the channels
+     * @param channels Number of channels of a texel, which is 1, 2 or 4
+     * @return Format of the image
+     */
+    static vk::Format imageFormat(const TensorDataTypes& dataType,
+                                  uint32_t channels);
+
+    /**
+     * Check whether the tensor has a staging buffer of its own to transfer
+     * its data with, which is the case for tensors of type eDevice without a
+     * staging ring and for tensors of type eImage.
+     *
+     * @return Boolean stating whether the tensor has a staging buffer
+     */
+    bool hasStagingBuffer();
+
+    /**
+     * Sets the name of the tensor, which names its buffers through
+     * VK_EXT_debug_utils so they can be identified in captures of debugging
+     * and profiling tools. The staging buffer is named with a " (staging)"
+     * suffix, and the buffers keep the name through rebuilds. Views do not
+     * own their buffers, so their name is only stored.
+     *
+     * @param name The name of the tensor
+     */
+    void setName(const std::string& name);
+
+    /**
+     * Retrieve the name of the tensor set with setName.
+     *
+     * @return Name of the tensor, empty if it was not named
+     */
+    const std::string& name();
+
     /**
      * Records a copy from the memory of the tensor provided to the current
      * thensor. This is intended to pass memory into a processing, to perform
-     * a staging buffer transfer, or to gather output (between others).
+     * a staging buffer transfer, or to gather output (between others). Image
+     * tensors are copied whole from and to the buffers of other tensors,
+     * with tightly packed rows, which copies the output of a shader into a
+     * texture and back. Copies between two images are not supported.
      *
      * @param commandBuffer Vulkan Command Buffer to record the commands into
      * @param copyFromTensor Tensor to copy the data from
+     * @param ranges Element ranges to copy, the whole tensor if empty
      */
     void recordCopyFrom(const vk::CommandBuffer& commandBuffer,
-                        std::shared_ptr<Tensor> copyFromTensor);
+                        std::shared_ptr<Tensor> copyFromTensor,
+                        const std::vector<Range>& ranges = {});
+
+    /**
+     * Records copies from the memory of the current tensor into several
+     * tensors, as recordCopyFrom does for each of them, but computing the
+     * copy regions of the ranges once and only moving their destination
+     * offset for each buffer, so broadcasting to many tensors only records
+     * the copy commands. The current tensor is skipped if it is one of the
+     * tensors provided.
+     *
+     * @param commandBuffer Vulkan Command Buffer to record the commands into
+     * @param copyToTensors Tensors to copy the data into
+     * @param ranges Element ranges to copy, the whole tensor if empty
+     */
+    void recordCopyTo(const vk::CommandBuffer& commandBuffer,
+                      const std::vector<std::shared_ptr<Tensor>>& copyToTensors,
+                      const std::vector<Range>& ranges = {});
 
     /**
      * Records a copy from the internal staging memory to the device memory
      * using an optional barrier to wait for the operation. This function would
-     * only be relevant for kp::Tensors of type eDevice.
+     * only be relevant for kp::Tensors of type eDevice and eImage, where
+     * images are always copied whole.
      *
      * @param commandBuffer Vulkan Command Buffer to record the commands into
+     * @param ranges Element ranges to copy, the whole tensor if empty
      */
-    void recordCopyFromStagingToDevice(const vk::CommandBuffer& commandBuffer);
+    void recordCopyFromStagingToDevice(const vk::CommandBuffer& commandBuffer,
+                                       const std::vector<Range>& ranges = {});
 
     /**
      * Records a copy from the internal device memory to the staging memory
      * using an optional barrier to wait for the operation. This function would
-     * only be relevant for kp::Tensors of type eDevice.
+     * only be relevant for kp::Tensors of type eDevice and eImage, where
+     * images are always copied whole.
      *
      * @param commandBuffer Vulkan Command Buffer to record the commands into
+     * @param ranges Element ranges to copy, the whole tensor if empty
      */
-    void recordCopyFromDeviceToStaging(const vk::CommandBuffer& commandBuffer);
+    void recordCopyFromDeviceToStaging(const vk::CommandBuffer& commandBuffer,
+                                       const std::vector<Range>& ranges = {});
+
+    /**
+     * Records a fill of the device memory of the tensor with a repeated 32-bit
+     * value, which does not require any host data. Views must have a memory
+     * size that is a multiple of 4 bytes. Images are cleared with the value
+     * in every channel, converted to the format of the image, so the pattern
+     * is only kept as is for 32 bit formats.
+     *
+     * @param commandBuffer Vulkan Command Buffer to record the commands into
+     * @param data The 32-bit pattern to fill the memory with
+     */
+    void recordFill(const vk::CommandBuffer& commandBuffer, uint32_t data);
+
+    /**
+     * Flushes the host writes to the host visible memory of the tensor so
+     * they are available to the device. This only has an effect when the
+     * memory is not host coherent.
+     */
+    void flushMappedMemory();
+
+    /**
+     * Invalidates the host visible memory of the tensor so writes by the
+     * device are visible to the host. This only has an effect when the memory
+     * is not host coherent.
+     */
+    void invalidateMappedMemory();
+
+    /**
+     * Check whether the tensor transfers its data through a shared staging
+     * ring instead of its own staging buffer. This is only the case for
+     * kp::Tensors of type eDevice created with a staging ring.
+     *
+     * @returns Boolean stating whether the staging ring is used
+     */
+    bool usesStagingRing();
+
+    /**
+     * Staging ring the tensor transfers its data through.
+     *
+     * @returns The staging ring, or nullptr if usesStagingRing is false
+     */
+    std::shared_ptr<StagingRing> stagingRing();
+
+    /**
+     * Uploads the host data of the tensor into its device memory through the
+     * staging ring. The transfers are submitted immediately, so this is
+     * expected to be called before the commands using the tensor are
+     * submitted to the same queue.
+     *
+     * @param ranges Element ranges to upload, the whole tensor if empty
+     */
+    void syncDeviceWithStagingRing(const std::vector<Range>& ranges = {});
+
+    /**
+     * Downloads the device memory of the tensor into its host data through
+     * the staging ring, waiting until the data is available.
+     *
+     * @param ranges Element ranges to download, the whole tensor if empty
+     */
+    void syncLocalWithStagingRing(const std::vector<Range>& ranges = {});
+
+    /**
+     * Adds the bytes of element ranges to a transfer counter of the metrics
+     * the tensor was created with. The sync operations call it for every
+     * submission of the copies they record, as a command buffer recorded
+     * once can be submitted several times.
+     *
+     * @param counter The counter to add to, such as eBytesUploaded
+     * @param ranges Element ranges transferred, the whole tensor if empty
+     */
+    void countTransfer(Metrics::Counter counter,
+                       const std::vector<Range>& ranges = {});
 
     /**
      * Records the buffer memory barrier into the primary buffer and command
@@ -133,10 +597,10 @@ class Tensor
      */
     void recordPrimaryBufferMemoryBarrier(
       const vk::CommandBuffer& commandBuffer,
-      vk::AccessFlagBits srcAccessMask,
-      vk::AccessFlagBits dstAccessMask,
-      vk::PipelineStageFlagBits srcStageMask,
-      vk::PipelineStageFlagBits dstStageMask);
+      vk::AccessFlags srcAccessMask,
+      vk::AccessFlags dstAccessMask,
+      vk::PipelineStageFlags srcStageMask,
+      vk::PipelineStageFlags dstStageMask);
     /**
      * Records the buffer memory barrier into the staging buffer and command
      * buffer which ensures that relevant data transfers are carried out
@@ -150,10 +614,50 @@ class Tensor
      */
     void recordStagingBufferMemoryBarrier(
       const vk::CommandBuffer& commandBuffer,
-      vk::AccessFlagBits srcAccessMask,
-      vk::AccessFlagBits dstAccessMask,
-      vk::PipelineStageFlagBits srcStageMask,
-      vk::PipelineStageFlagBits dstStageMask);
+      vk::AccessFlags srcAccessMask,
+      vk::AccessFlags dstAccessMask,
+      vk::PipelineStageFlags srcStageMask,
+      vk::PipelineStageFlags dstStageMask);
+
+    /**
+     * Constructs a buffer memory barrier for the range of the primary buffer
+     * used by the tensor, so barriers on several tensors can be recorded with
+     * a single pipeline barrier command.
+     *
+     * @param srcAccessMask Access flags for source access mask
+     * @param dstAccessMask Access flags for destination access mask
+     * @return Buffer memory barrier on the primary buffer
+     */
+    vk::BufferMemoryBarrier createPrimaryBufferMemoryBarrier(
+      vk::AccessFlags srcAccessMask,
+      vk::AccessFlags dstAccessMask);
+    /**
+     * Constructs a buffer memory barrier for the range of the staging buffer
+     * used by the tensor, so barriers on several tensors can be recorded with
+     * a single pipeline barrier command.
+     *
+     * @param srcAccessMask Access flags for source access mask
+     * @param dstAccessMask Access flags for destination access mask
+     * @return Buffer memory barrier on the staging buffer
+     */
+    vk::BufferMemoryBarrier createStagingBufferMemoryBarrier(
+      vk::AccessFlags srcAccessMask,
+      vk::AccessFlags dstAccessMask);
+    /**
+     * Constructs an image memory barrier for the image of a tensor of type
+     * eImage, which stays in the general layout. Barriers on the primary
+     * memory of images must be recorded with it instead of a buffer memory
+     * barrier.
+     *
+     * @param srcAccessMask Access flags for source access mask
+     * @param dstAccessMask Access flags for destination access mask
+     * @param oldLayout Layout of the image before the barrier
+     * @return Image memory barrier on the image
+     */
+    vk::ImageMemoryBarrier createImageMemoryBarrier(
+      vk::AccessFlags srcAccessMask,
+      vk::AccessFlags dstAccessMask,
+      vk::ImageLayout oldLayout = vk::ImageLayout::eGeneral);
 
     /**
      * Constructs a vulkan descriptor buffer info which can be used to specify
@@ -164,13 +668,30 @@ class Tensor
      */
     vk::DescriptorBufferInfo constructDescriptorBufferInfo();
 
+    /**
+     * Constructs a vulkan descriptor image info referencing the image view
+     * of a tensor of type eImage in the general layout.
+     *
+     * @return Descriptor image info with own image view
+     */
+    vk::DescriptorImageInfo constructDescriptorImageInfo();
+
+    /**
+     * Retrieve the type of descriptor the tensor is bound with by algorithms,
+     * which is a uniform buffer for uniform tensors, a storage image for
+     * image tensors and a storage buffer otherwise.
+     *
+     * @return Descriptor type of the buffer of the tensor
+     */
+    vk::DescriptorType descriptorType();
+
     /**
      * Returns the size/magnitude of the Tensor, which will be the total number
      * of elements across all dimensions
      *
      * @return Unsigned integer representing the total number of elements
      */
-    uint32_t size();
+    uint64_t size();
 
     /**
      * Returns the total size of a single element of the respective data type
@@ -188,7 +709,31 @@ class Tensor
      * @return Unsigned integer representing the memory of a single element of
      * the respective data type.
      */
-    uint32_t memorySize();
+    vk::DeviceSize memorySize();
+
+    /**
+     * Returns the size of the primary buffer owned by the tensor, which is
+     * zero for views as they share the buffer of their parent.
+     *
+     * @return Size in bytes of the primary buffer of the tensor
+     */
+    vk::DeviceSize primaryMemorySize();
+
+    /**
+     * Returns the size of the staging buffer owned by the tensor, which is
+     * zero for views and for tensors without a staging buffer.
+     *
+     * @return Size in bytes of the staging buffer of the tensor
+     */
+    vk::DeviceSize stagingMemorySize();
+
+    /**
+     * Returns the size in bytes of a single element of the data type provided.
+     *
+     * @param dataType The data type of the element
+     * @return Size in bytes of an element of the data type
+     */
+    static uint32_t elementMemorySize(const TensorDataTypes& dataType);
 
     /**
      * Retrieve the data type of the tensor (host, device, storage)
@@ -208,10 +753,46 @@ class Tensor
 
     /**
      * Sets / resets the data of the tensor which is directly done on the GPU
-     * host visible memory available by the tensor.
+     * host visible memory available by the tensor. The whole tensor is marked
+     * as dirty.
      */
     void setRawData(const void* data);
 
+    /**
+     * Sets the data of a range of elements of the tensor, marking only that
+     * range as dirty.
+     *
+     * @param data Pointer to the data of the elements in the range
+     * @param offset Index of the first element to set
+     * @param count Number of elements to set
+     */
+    void setRawData(const void* data, uint64_t offset, uint64_t count);
+
+    /**
+     * Marks a range of elements as modified on the host, for when the data is
+     * written directly through the pointer returned by rawData or data.
+     *
+     * @param offset Index of the first element modified
+     * @param count Number of elements modified
+     */
+    void markDirty(uint64_t offset, uint64_t count);
+
+    /**
+     * Retrieve the ranges of elements modified through setRawData or
+     * markDirty since the ranges were last cleared. Overlapping and adjacent
+     * ranges are merged, so they can be passed directly to the sync and copy
+     * operations.
+     *
+     * @return Sorted ranges of elements modified on the host
+     */
+    const std::vector<Range>& dirtyRanges();
+
+    /**
+     * Clears the ranges of elements marked as dirty, usually once they have
+     * been synced to the device.
+     */
+    void clearDirtyRanges();
+
     /**
      * Template to return the pointer data converted by specific type, which
      * would be any of the supported types including float, double, int32,
@@ -241,15 +822,30 @@ class Tensor
   protected:
     // -------------- ALWAYS OWNED RESOURCES
     TensorTypes mTensorType;
+    HostMemoryTypes mHostMemoryType;
     TensorDataTypes mDataType;
-    uint32_t mSize;
+    uint64_t mSize;
+    uint64_t mCapacity = 0;
+    uint64_t mGeneration = 0;
     uint32_t mDataTypeMemorySize;
-    void* mRawData;
+    void* mRawData = nullptr;
+    std::vector<Range> mDirtyRanges;
 
   private:
     // -------------- NEVER OWNED RESOURCES
     std::shared_ptr<vk::PhysicalDevice> mPhysicalDevice;
     std::shared_ptr<vk::Device> mDevice;
+    std::shared_ptr<MemoryPool> mMemoryPool;
+    std::shared_ptr<StagingRing> mStagingRing;
+    std::shared_ptr<Tensor> mParent;
+    // Live views aliasing the memory of the tensor, which hold a reference
+    // to it and remove themselves when they are destroyed
+    std::vector<Tensor*> mViews;
+    std::vector<uint32_t> mQueueFamilyIndices;
+    std::shared_ptr<DebugUtils> mDebugUtils;
+    std::shared_ptr<Metrics> mMetrics;
+    std::shared_ptr<HostAllocator> mHostAllocator;
+    std::shared_ptr<DeviceInfo> mDeviceInfo;
 
     // -------------- OPTIONALLY OWNED RESOURCES
     std::shared_ptr<vk::Buffer> mPrimaryBuffer;
@@ -260,33 +856,93 @@ class Tensor
     bool mFreePrimaryMemory = false;
     std::shared_ptr<vk::DeviceMemory> mStagingMemory;
     bool mFreeStagingMemory = false;
-
-    void allocateMemoryCreateGPUResources(); // Creates the vulkan buffer
-    void createBuffer(std::shared_ptr<vk::Buffer> buffer,
-                      vk::BufferUsageFlags bufferUsageFlags);
+    MemoryPool::Allocation mPrimaryAllocation;
+    MemoryPool::Allocation mStagingAllocation;
+    bool mFreeRawData = false;
+    bool mHostMemoryCoherent = true;
+    bool mHostMemoryImported = false;
+    std::shared_ptr<vk::Image> mImage;
+    std::shared_ptr<vk::ImageView> mImageView;
+    bool mFreeImage = false;
+    vk::Extent3D mImageExtent;
+    uint32_t mImageChannels = 0;
+    vk::DeviceSize mBufferOffset = 0;
+    std::string mName;
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+    AHardwareBuffer* mHardwareBuffer = nullptr;
+#endif
+
+    void allocateMemoryCreateGPUResources(
+      void* data); // Creates the vulkan buffer
+    void createBuffer(
+      std::shared_ptr<vk::Buffer> buffer,
+      vk::BufferUsageFlags bufferUsageFlags,
+      vk::ExternalMemoryHandleTypeFlags externalHandleTypes = {});
+    bool importBindHostMemory(std::shared_ptr<vk::Buffer> buffer,
+                              std::shared_ptr<vk::DeviceMemory> memory,
+                              MemoryPool::Allocation& allocation,
+                              vk::BufferUsageFlags bufferUsageFlags,
+                              void* data);
+    void createImage();
     void allocateBindMemory(std::shared_ptr<vk::Buffer> buffer,
                             std::shared_ptr<vk::DeviceMemory> memory,
+                            MemoryPool::Allocation& allocation,
                             vk::MemoryPropertyFlags memoryPropertyFlags);
+    vk::DeviceSize allocateMemory(
+      std::shared_ptr<vk::DeviceMemory> memory,
+      MemoryPool::Allocation& allocation,
+      const vk::MemoryRequirements& memoryRequirements,
+      vk::MemoryPropertyFlags memoryPropertyFlags);
+    int32_t findMemoryTypeIndex(
+      const vk::PhysicalDeviceMemoryProperties& memoryProperties,
+      const vk::MemoryRequirements& memoryRequirements,
+      const vk::MemoryPropertyFlags& memoryPropertyFlags);
     void recordCopyBuffer(const vk::CommandBuffer& commandBuffer,
                           std::shared_ptr<vk::Buffer> bufferFrom,
                           std::shared_ptr<vk::Buffer> bufferTo,
-                          vk::DeviceSize bufferSize,
-                          vk::BufferCopy copyRegion);
+                          vk::DeviceSize bufferFromOffset,
+                          const std::vector<Range>& ranges);
+    void recordImageCopy(const vk::CommandBuffer& commandBuffer,
+                         const vk::Buffer& buffer,
+                         vk::DeviceSize bufferOffset,
+                         bool toImage);
+    vk::BufferMemoryBarrier createBufferMemoryBarrier(
+      const vk::Buffer& buffer,
+      vk::AccessFlags srcAccessMask,
+      vk::AccessFlags dstAccessMask);
     void recordBufferMemoryBarrier(const vk::CommandBuffer& commandBuffer,
                                    const vk::Buffer& buffer,
-                                   vk::AccessFlagBits srcAccessMask,
-                                   vk::AccessFlagBits dstAccessMask,
-                                   vk::PipelineStageFlagBits srcStageMask,
-                                   vk::PipelineStageFlagBits dstStageMask);
+                                   vk::AccessFlags srcAccessMask,
+                                   vk::AccessFlags dstAccessMask,
+                                   vk::PipelineStageFlags srcStageMask,
+                                   vk::PipelineStageFlags dstStageMask);
+    void recordImageMemoryBarrier(const vk::CommandBuffer& commandBuffer,
+                                  vk::AccessFlags srcAccessMask,
+                                  vk::AccessFlags dstAccessMask,
+                                  vk::PipelineStageFlags srcStageMask,
+                                  vk::PipelineStageFlags dstStageMask,
+                                  vk::ImageLayout oldLayout);
 
     // Private util functions
+    std::vector<vk::BufferCopy> copyRegions(const std::vector<Range>& ranges,
+                                            vk::DeviceSize srcOffset,
+                                            vk::DeviceSize dstOffset);
     vk::BufferUsageFlags getPrimaryBufferUsageFlags();
     vk::MemoryPropertyFlags getPrimaryMemoryPropertyFlags();
     vk::BufferUsageFlags getStagingBufferUsageFlags();
     vk::MemoryPropertyFlags getStagingMemoryPropertyFlags();
+    vk::MemoryPropertyFlags getHostVisibleMemoryPropertyFlags();
+    vk::DeviceSize capacityMemorySize();
+    void reallocate(void* data, uint64_t elementCapacity);
 
     void mapRawData();
     void unmapRawData();
+    void setObjectNames();
+    void setQueueFamilyIndices(const std::vector<uint32_t>& queueFamilyIndices);
+#if KOMPUTE_HARDWARE_BUFFER_IMPORT
+    void importHardwareBuffer();
+#endif
+    vk::MappedMemoryRange hostVisibleMemoryRange();
 };
 
 template<typename T>
@@ -297,19 +953,44 @@ class TensorT : public Tensor
     TensorT(std::shared_ptr<vk::PhysicalDevice> physicalDevice,
             std::shared_ptr<vk::Device> device,
             const std::vector<T>& data,
-            const TensorTypes& tensorType = TensorTypes::eDevice)
+            const TensorTypes& tensorType = TensorTypes::eDevice,
+            const HostMemoryTypes& hostMemoryType = HostMemoryTypes::eCoherent,
+            std::shared_ptr<MemoryPool> memoryPool = nullptr,
+            std::shared_ptr<StagingRing> stagingRing = nullptr,
+            const std::vector<uint32_t>& queueFamilyIndices = {},
+            std::shared_ptr<DebugUtils> debugUtils = nullptr,
+            std::shared_ptr<Metrics> metrics = nullptr,
+            std::shared_ptr<HostAllocator> hostAllocator = nullptr,
+            std::shared_ptr<DeviceInfo> deviceInfo = nullptr)
       : Tensor(physicalDevice,
                device,
                (void*)data.data(),
                data.size(),
                sizeof(T),
                this->dataType(),
-               tensorType)
+               tensorType,
+               hostMemoryType,
+               memoryPool,
+               stagingRing,
+               queueFamilyIndices,
+               debugUtils,
+               metrics,
+               hostAllocator,
+               deviceInfo)
     {
         KP_LOG_DEBUG("Kompute TensorT constructor with data size {}",
                      data.size());
     }
 
+    TensorT(std::shared_ptr<TensorT<T>> parent, uint64_t offset, uint64_t count)
+      : Tensor(parent, offset, count)
+    {
+        KP_LOG_DEBUG("Kompute TensorT view constructor with offset {} and "
+                     "size {}",
+                     offset,
+                     count);
+    }
+
     ~TensorT() { KP_LOG_DEBUG("Kompute TensorT destructor"); }
 
     T* data() { return (T*)this->mRawData; }
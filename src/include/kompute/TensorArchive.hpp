@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <map>
+
+#include "kompute/Core.hpp"
+
+#include "kompute/Manager.hpp"
+#include "kompute/Tensor.hpp"
+
+#ifndef KOMPUTE_TENSOR_ARCHIVE_ALIGNMENT
+#define KOMPUTE_TENSOR_ARCHIVE_ALIGNMENT 256
+#endif
+
+namespace kp {
+
+/**
+ * Archive of named tensors in a single file, such as the weights of a model,
+ * which is memory mapped when opened so the data of the tensors is copied
+ * straight from the page cache into their host visible memory.
+ *
+ * The file starts with a header holding the name, data type, shape, offset
+ * and size of each entry, followed by the data of the entries, each starting
+ * at an offset aligned to KOMPUTE_TENSOR_ARCHIVE_ALIGNMENT bytes. All the
+ * values are stored in the byte order of the host.
+ */
+class TensorArchive
+{
+  public:
+    /**
+     * Description of a tensor stored in the archive.
+     */
+    struct Entry
+    {
+        std::string name;                 ///< Unique name of the tensor
+        Tensor::TensorDataTypes dataType; ///< Data type of the elements
+        std::vector<uint64_t> shape;      ///< Extents in row major order
+        uint64_t offset = 0;              ///< Offset in bytes of the data
+        uint64_t size = 0;                ///< Size in bytes of the data
+    };
+
+    /**
+     * Writes an archive holding the data provided. The offsets and sizes of
+     * the entries are ignored and computed from their shapes and data types.
+     *
+     * @param path The file to write
+     * @param entries The name, data type and shape of each tensor
+     * @param data The data of each tensor, in the order of the entries
+     */
+    static void write(const std::string& path,
+                      const std::vector<Entry>& entries,
+                      const std::vector<const void*>& data);
+
+    /**
+     * Writes an archive holding the host data of tensors, which has to be
+     * synced with OpTensorSyncLocal first for device tensors.
+     *
+     * @param path The file to write
+     * @param names The unique name of each tensor
+     * @param tensors The tensors to store
+     * @param shapes (Optional) The shape of each tensor, a single extent of
+     * the size of the tensor when not provided
+     */
+    static void write(const std::string& path,
+                      const std::vector<std::string>& names,
+                      const std::vector<std::shared_ptr<Tensor>>& tensors,
+                      const std::vector<std::vector<uint64_t>>& shapes = {});
+
+    /**
+     * Constructor which maps the file of the archive and reads its header.
+     * The data of the entries is only read from disk when it is accessed.
+     *
+     * @param path The file of the archive
+     */
+    TensorArchive(const std::string& path);
+
+    TensorArchive(const TensorArchive&) = delete;
+    TensorArchive& operator=(const TensorArchive&) = delete;
+
+    /**
+     * Destructor which unmaps the file of the archive.
+     */
+    ~TensorArchive();
+
+    /**
+     * Returns the entries of the archive, in the order they were written.
+     *
+     * @return The entries of the archive
+     */
+    const std::vector<Entry>& entries() const;
+
+    /**
+     * Looks up the entry of a tensor by name.
+     *
+     * @param name The name of the tensor
+     * @param entry The entry to fill if found
+     * @return Boolean stating whether the archive holds the tensor
+     */
+    bool find(const std::string& name, Entry& entry) const;
+
+    /**
+     * Returns the mapped data of an entry, which remains valid until the
+     * archive is closed.
+     *
+     * @param entry An entry of the archive
+     * @return Pointer to the data of the entry
+     */
+    const void* data(const Entry& entry) const;
+
+    /**
+     * Creates a tensor of the manager for each entry, or for the entries
+     * named, copying their data from the mapped file into the host visible
+     * memory of the tensors sub-allocated from the memory pool of the
+     * manager. Device tensors are then uploaded together by a single
+     * OpTensorSyncDevice, so the data is copied once on the host and
+     * transferred in one submission.
+     *
+     * @param manager The manager creating the tensors
+     * @param tensorType The type of the tensors, eDevice or eHost
+     * @param hostMemoryType The type of host visible memory of the tensors
+     * @param names (Optional) The names of the tensors to load, all the
+     * entries when empty
+     * @return The tensors created, by name
+     */
+    std::map<std::string, std::shared_ptr<Tensor>> load(
+      std::shared_ptr<Manager> manager,
+      Tensor::TensorTypes tensorType = Tensor::TensorTypes::eDevice,
+      Tensor::HostMemoryTypes hostMemoryType =
+        Tensor::HostMemoryTypes::eCoherent,
+      const std::vector<std::string>& names = {}) const;
+
+    /**
+     * Unmaps the file of the archive. Pointers returned by data are no longer
+     * valid, while tensors loaded from the archive are not affected.
+     */
+    void close();
+
+    /**
+     * Returns true while the file of the archive is mapped.
+     *
+     * @return Boolean stating whether the archive is open
+     */
+    bool isOpen() const;
+
+  private:
+    // -------------- ALWAYS OWNED RESOURCES
+    std::string mPath;
+    const uint8_t* mMapping = nullptr;
+    uint64_t mMappingSize = 0;
+#if defined(_WIN32)
+    void* mFileHandle = nullptr;
+    void* mMappingHandle = nullptr;
+#endif
+    std::vector<Entry> mEntries;
+    std::map<std::string, size_t> mEntryIndices;
+
+    void map(const std::string& path);
+    void readHeader();
+};
+
+} // End namespace kp
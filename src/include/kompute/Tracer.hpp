@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "kompute/Core.hpp"
+
+namespace kp {
+
+/**
+ * Process wide tracer recording the CPU spans of the record, submission and
+ * rebuild functions of Kompute, together with the GPU spans of the operations
+ * of the sequences with timestamps, on one timeline written as a Chrome trace
+ * that can be opened in Perfetto or chrome://tracing.
+ *
+ * The tracer is disabled by default, in which case a span costs a relaxed
+ * atomic load. The GPU spans are recorded when a sequence created with
+ * timestamps is awaited through evalAwait. Their timestamps are converted to
+ * the host clock with VK_EXT_calibrated_timestamps when the extension is
+ * enabled on the device and it calibrates against CLOCK_MONOTONIC, and
+ * otherwise by aligning the end of the last
+ * operation with the time its fence was seen signaled, which is the upper
+ * bound of its completion.
+ */
+class Tracer
+{
+  public:
+    /**
+     * Guard recording a CPU span from its construction to its destruction
+     * on the current thread, when the tracer is enabled at construction.
+     */
+    class Span
+    {
+      public:
+        /**
+         * Starts the span.
+         *
+         * @param name Name of the span, which must outlive the tracer events
+         * such as a string literal
+         */
+        Span(const char* name);
+
+        /**
+         * Ends the span and records it.
+         */
+        ~Span();
+
+      private:
+        const char* mName;
+        int64_t mStartNs;
+    };
+
+    /**
+     * Clears the events recorded and starts recording.
+     */
+    static void start();
+
+    /**
+     * Stops recording, keeping the events recorded until the next start.
+     */
+    static void stop();
+
+    /**
+     * Checks whether the tracer is recording.
+     *
+     * @return Boolean stating whether the tracer is enabled
+     */
+    static bool isEnabled()
+    {
+        return sEnabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Current time of the clock of the spans, which is the steady clock of
+     * the host.
+     *
+     * @return Nanoseconds since the epoch of the steady clock
+     */
+    static int64_t now();
+
+    /**
+     * Records a span of the current thread.
+     *
+     * @param name Name of the span, which must outlive the tracer events
+     * @param startNs Start of the span, from now
+     * @param endNs End of the span, from now
+     */
+    static void recordCpuSpan(const char* name, int64_t startNs, int64_t endNs);
+
+    /**
+     * Records a span of work of a queue of the device.
+     *
+     * @param name Name of the span
+     * @param queueFamilyIndex The queue family the work ran on, which is the
+     * track of the span
+     * @param startNs Start of the span on the host clock, from now
+     * @param endNs End of the span on the host clock, from now
+     */
+    static void recordGpuSpan(const std::string& name,
+                              uint32_t queueFamilyIndex,
+                              int64_t startNs,
+                              int64_t endNs);
+
+    /**
+     * Returns the number of spans recorded since the last start.
+     *
+     * @return Number of spans
+     */
+    static uint64_t eventCount();
+
+    /**
+     * Returns the spans recorded as a Chrome trace, in the JSON object format
+     * of the Trace Event Format, with the CPU spans grouped by thread and the
+     * GPU spans grouped by queue family.
+     *
+     * @return JSON of the trace
+     */
+    static std::string chromeTrace();
+
+    /**
+     * Writes the spans recorded as a Chrome trace, see chromeTrace.
+     *
+     * @param path The file to write the trace to
+     */
+    static void writeChromeTrace(const std::string& path);
+
+  private:
+    static std::atomic<bool> sEnabled;
+};
+
+} // End namespace kp
@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstring>
+#include <map>
+
+#include "kompute/Core.hpp"
+
+#include "kompute/Benchmark.hpp"
+#include "kompute/Manager.hpp"
+
+namespace kp {
+
+/**
+ * Auto-tuner choosing the workgroup and specialization constants of an
+ * algorithm, such as its local size or tile size, for an input shape. Each
+ * candidate is built and timed with the GPU timestamps of a sequence through
+ * the benchmark harness, and the algorithm is left built with the fastest.
+ *
+ * The choices are kept in a tuning database keyed by the device, the name of
+ * the algorithm and the shape, which is loaded from a file when the tuner is
+ * created and written back after each new choice. Later runs of the
+ * application on the same device and driver reuse the choices without timing
+ * the candidates again.
+ */
+class Tuner
+{
+  public:
+    /**
+     * Configuration of the algorithm tried by the tuner.
+     */
+    struct Candidate
+    {
+        Workgroup workgroup; ///< Computed by the algorithm if all zero
+        std::vector<uint32_t> specializationConstants; ///< Raw 32 bit values
+    };
+
+    /**
+     * Choice of the tuner for an algorithm and shape.
+     */
+    struct Result
+    {
+        Candidate candidate; ///< Fastest candidate
+        double medianNs = 0; ///< Median GPU time of the fastest candidate
+        bool cached = false; ///< Whether it was found in the database
+    };
+
+    /**
+     * Builds a candidate from specialization constants of any 32 bit type,
+     * which are stored as their raw values.
+     *
+     * @param workgroup The workgroup of the dispatch, computed by the
+     * algorithm if all zero
+     * @param specializationConstants The specialization constants, or empty
+     * to keep the ones of the algorithm
+     * @return The candidate
+     */
+    template<typename S = float>
+    static Candidate candidate(
+      const Workgroup& workgroup,
+      const std::vector<S>& specializationConstants = {})
+    {
+        static_assert(sizeof(S) == sizeof(uint32_t),
+                      "Kompute Tuner specialization constants must be 32 "
+                      "bit values");
+
+        Candidate candidate;
+        candidate.workgroup = workgroup;
+        candidate.specializationConstants.resize(
+          specializationConstants.size());
+        memcpy(candidate.specializationConstants.data(),
+               specializationConstants.data(),
+               specializationConstants.size() * sizeof(S));
+        return candidate;
+    }
+
+    /**
+     * Constructor for a tuner of the device of a manager, loading the
+     * database if a path is provided.
+     *
+     * @param manager The manager creating the sequences timing the candidates
+     * @param databasePath (Optional) File of the tuning database, loaded if it
+     * exists and written after each new choice
+     * @param warmup Number of evaluations of a candidate before the timed ones
+     * @param repetitions Number of timed evaluations of a candidate
+     */
+    Tuner(std::shared_ptr<Manager> manager,
+          const std::string& databasePath = "",
+          uint32_t warmup = 2,
+          uint32_t repetitions = 5);
+
+    /**
+     * Chooses the fastest candidate for the algorithm and shape, and rebuilds
+     * the algorithm with it. The choice of the database is used if there is
+     * one for the device, name and shape, otherwise each candidate is timed
+     * dispatching the algorithm with its current tensors and push constants.
+     * Candidates exceeding the limits of the device, or whose pipeline fails
+     * to build, are skipped.
+     *
+     * @param algorithm The algorithm to tune, left built with the choice
+     * @param name Name of the algorithm in the database, such as the name of
+     * its shader
+     * @param shape Shape of the input the choice is made for
+     * @param candidates The candidates to try
+     * @param retune Whether to time the candidates even if the database has a
+     * choice already
+     * @return The choice for the algorithm and shape
+     */
+    Result tune(std::shared_ptr<Algorithm> algorithm,
+                const std::string& name,
+                const std::vector<uint32_t>& shape,
+                const std::vector<Candidate>& candidates,
+                bool retune = false);
+
+    /**
+     * Looks up the choice of the database for the device, name and shape.
+     *
+     * @param name Name of the algorithm in the database
+     * @param shape Shape of the input the choice was made for
+     * @param result The result to fill with the choice if found
+     * @return Boolean stating whether there is a choice
+     */
+    bool find(const std::string& name,
+              const std::vector<uint32_t>& shape,
+              Result& result) const;
+
+    /**
+     * Loads the choices of a database file, replacing the ones with the same
+     * device, name and shape. The choices of other devices are kept so they
+     * are written back when saving.
+     *
+     * @param path The file to load, which is ignored if it does not exist
+     */
+    void load(const std::string& path);
+
+    /**
+     * Writes the choices of all devices to a database file.
+     *
+     * @param path The file to write, or the database path of the tuner if
+     * empty
+     */
+    void save(const std::string& path = "");
+
+    /**
+     * Returns the number of choices of the database, of all devices.
+     *
+     * @return Number of choices
+     */
+    size_t size() const;
+
+    /**
+     * Identifier of the device in the database, made of its vendor, device
+     * and driver version, as the fastest configuration depends on all three.
+     *
+     * @return The identifier of the device of the manager
+     */
+    const std::string& deviceKey() const;
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<Manager> mManager;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    Benchmark mBenchmark;
+    std::string mDatabasePath;
+    std::string mDeviceKey;
+    std::map<std::string, Result> mEntries;
+
+    std::string key(const std::string& name,
+                    const std::vector<uint32_t>& shape) const;
+    bool isSupported(std::shared_ptr<Algorithm> algorithm) const;
+    void apply(std::shared_ptr<Algorithm> algorithm,
+               const Candidate& candidate);
+};
+
+} // End namespace kp
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+
+#include "kompute/Core.hpp"
+
+namespace kp {
+
+/**
+ * Fixed set of worker threads running the tasks submitted to the pool in
+ * submission order, used by the manager to build algorithms in parallel.
+ */
+class WorkerPool
+{
+  public:
+    /**
+     * Constructor which starts the worker threads.
+     *
+     * @param threadCount The number of worker threads, which defaults to the
+     * number of hardware threads if 0
+     */
+    WorkerPool(uint32_t threadCount = 0);
+
+    /**
+     * Destructor which runs the tasks still pending before stopping.
+     */
+    ~WorkerPool();
+
+    /**
+     * Queues a task to be run by the first worker thread available.
+     *
+     * @param task The function to run
+     * @return Future completed once the task has run, holding the exception
+     * thrown by the task if any
+     */
+    std::shared_future<void> submit(std::function<void()> task);
+
+    /**
+     * Returns the number of worker threads of the pool.
+     *
+     * @return Number of worker threads
+     */
+    uint32_t threadCount();
+
+    /**
+     * Runs the tasks still pending and then stops the worker threads.
+     */
+    void destroy();
+
+  private:
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<std::thread> mThreads;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::deque<std::packaged_task<void()>> mTasks;
+    bool mStopping = false;
+
+    void run();
+};
+
+} // End namespace kp
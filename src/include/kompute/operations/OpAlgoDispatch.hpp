@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
+#include <array>
+
 #include "kompute/Core.hpp"
 #include "kompute/Algorithm.hpp"
 #include "kompute/Tensor.hpp"
@@ -34,16 +36,33 @@ class OpAlgoDispatch : public OpBase
         this->mAlgorithm = algorithm;
 
         if (pushConstants.size()) {
-            uint32_t memorySize = sizeof(decltype(pushConstants.back()));
-            uint32_t size = pushConstants.size();
-            uint32_t totalSize = size * memorySize;
-            this->mPushConstantsData = malloc(totalSize);
-            memcpy(this->mPushConstantsData, pushConstants.data(), totalSize);
-            this->mPushConstantsDataTypeMemorySize = memorySize;
-            this->mPushConstantsSize = size;
+            this->setPushConstants(pushConstants.data(),
+                                   pushConstants.size(),
+                                   sizeof(decltype(pushConstants.back())));
         }
     }
 
+    /**
+     * Constructor that stores the algorithm to use as well as push constants
+     * of fixed size, checked against the inline storage at compile time.
+     *
+     * @param algorithm The algorithm object to use for dispatch
+     * @param pushConstants The push constants to use for override
+     */
+    template<typename T, size_t N>
+    OpAlgoDispatch(const std::shared_ptr<kp::Algorithm>& algorithm,
+                   const std::array<T, N>& pushConstants)
+    {
+        static_assert(sizeof(T) * N <= KOMPUTE_MAX_PUSH_CONSTANTS_SIZE,
+                      "Kompute OpAlgoDispatch push constants exceed "
+                      "KOMPUTE_MAX_PUSH_CONSTANTS_SIZE");
+
+        KP_LOG_DEBUG("Kompute OpAlgoDispatch constructor");
+
+        this->mAlgorithm = algorithm;
+        this->setPushConstants(pushConstants.data(), N, sizeof(T));
+    }
+
     /**
      * Default destructor, which is in charge of destroying the algorithm
      * components but does not destroy the underlying tensors
@@ -51,12 +70,10 @@ class OpAlgoDispatch : public OpBase
     virtual ~OpAlgoDispatch() override;
 
     /**
-     * This records the commands that are to be sent to the GPU. This includes
-     * the barriers that ensure the memory has been copied before going in and
-     * out of the shader, as well as the dispatch operation that sends the
-     * shader processing to the gpu. This function also records the GPU memory
-     * copy of the output data for the staging buffer so it can be read by the
-     * host.
+     * This records the commands that are to be sent to the GPU, binding the
+     * algorithm and recording the dispatch operation that sends the shader
+     * processing to the gpu. The barriers that ensure the memory is available
+     * to the shader are recorded by the sequence from tensorAccesses.
      *
      * @param commandBuffer The command buffer to record the command into.
      */
@@ -76,12 +93,22 @@ class OpAlgoDispatch : public OpBase
      */
     virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
 
-private:
+    /**
+     * Declares shader reads and writes to every tensor of the algorithm, or
+     * uniform reads for uniform tensors.
+     *
+     * @return Accesses of the dispatch to the tensors of the algorithm
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  protected:
     // -------------- ALWAYS OWNED RESOURCES
     std::shared_ptr<Algorithm> mAlgorithm;
-    void* mPushConstantsData = nullptr;
+    alignas(16) uint8_t mPushConstantsData[KOMPUTE_MAX_PUSH_CONSTANTS_SIZE];
     uint32_t mPushConstantsDataTypeMemorySize = 0;
     uint32_t mPushConstantsSize = 0;
+
+    void setPushConstants(const void* data, uint32_t size, uint32_t memorySize);
 };
 
 } // End namespace kp
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Core.hpp"
+#include "kompute/Algorithm.hpp"
+#include "kompute/Tensor.hpp"
+#include "kompute/operations/OpAlgoDispatch.hpp"
+
+namespace kp {
+
+/**
+ * Operation that dispatches an algorithm several times with different push
+ * constants, binding the pipeline and descriptor set only once and then
+ * recording a push constants and dispatch pair for each set of push
+ * constants of a contiguous array.
+ */
+class OpAlgoDispatchBatch : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that stores the algorithm to use as well as a copy of the
+     * push constants of all the dispatches.
+     *
+     * @param algorithm The algorithm object to use for dispatch
+     * @param pushConstants The push constants of all the dispatches one after
+     * the other, which can be an array of structs matching the push constants
+     * block of the shader
+     * @param constantsPerDispatch The number of elements of pushConstants
+     * used by each dispatch
+     * @param barrierBetweenDispatches Whether to record a memory barrier
+     * between consecutive dispatches, which is required if a dispatch reads
+     * the results of the previous one
+     */
+    template<typename T = float>
+    OpAlgoDispatchBatch(const std::shared_ptr<kp::Algorithm>& algorithm,
+                        const std::vector<T>& pushConstants,
+                        uint32_t constantsPerDispatch = 1,
+                        bool barrierBetweenDispatches = false)
+      : OpAlgoDispatch(algorithm)
+    {
+        KP_LOG_DEBUG("Kompute OpAlgoDispatchBatch constructor");
+
+        if (!constantsPerDispatch ||
+            pushConstants.size() % constantsPerDispatch) {
+            throw std::runtime_error(
+              fmt::format("Kompute OpAlgoDispatchBatch {} push constants "
+                          "cannot be split into dispatches of {}",
+                          pushConstants.size(),
+                          constantsPerDispatch));
+        }
+
+        uint32_t dispatchMemorySize = constantsPerDispatch * sizeof(T);
+        if (dispatchMemorySize > KOMPUTE_MAX_PUSH_CONSTANTS_SIZE) {
+            throw std::runtime_error(
+              fmt::format("Kompute OpAlgoDispatchBatch push constants of {} "
+                          "bytes exceed the maximum of {} bytes",
+                          dispatchMemorySize,
+                          KOMPUTE_MAX_PUSH_CONSTANTS_SIZE));
+        }
+
+        this->mPushConstantsBatch.assign(
+          (const uint8_t*)pushConstants.data(),
+          (const uint8_t*)(pushConstants.data() + pushConstants.size()));
+        this->mDispatchMemorySize = dispatchMemorySize;
+        this->mDispatchCount = pushConstants.size() / constantsPerDispatch;
+        this->mBarrierBetweenDispatches = barrierBetweenDispatches;
+    }
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpAlgoDispatchBatch() override;
+
+    /**
+     * This records the commands that are to be sent to the GPU, binding the
+     * algorithm once and then recording the push constants and dispatch of
+     * each of the dispatches, separated by memory barriers if requested.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Returns the number of dispatches recorded by the operation.
+     *
+     * @return Number of dispatches
+     */
+    uint32_t dispatchCount();
+
+  private:
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<uint8_t> mPushConstantsBatch;
+    uint32_t mDispatchMemorySize = 0;
+    uint32_t mDispatchCount = 0;
+    bool mBarrierBetweenDispatches = false;
+};
+
+} // End namespace kp
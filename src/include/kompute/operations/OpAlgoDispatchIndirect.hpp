@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Core.hpp"
+#include "kompute/Algorithm.hpp"
+#include "kompute/Tensor.hpp"
+#include "kompute/operations/OpAlgoDispatch.hpp"
+
+namespace kp {
+
+/**
+ * Operation that dispatches an algorithm with the workgroup counts read from
+ * a VkDispatchIndirectCommand stored in a tensor, so a previous shader can
+ * decide the size of the dispatch without a round trip to the host.
+ */
+class OpAlgoDispatchIndirect : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that stores the algorithm to use, the tensor holding the
+     * dispatch command as well as the relevant push constants to override
+     * when recording.
+     *
+     * @param algorithm The algorithm object to use for dispatch
+     * @param indirectTensor Tensor holding the three uint32 workgroup counts
+     * @param offset Offset in bytes of the dispatch command in the tensor,
+     * which has to be a multiple of 4
+     * @param pushConstants The push constants to use for override
+     */
+    template<typename T = float>
+    OpAlgoDispatchIndirect(const std::shared_ptr<kp::Algorithm>& algorithm,
+                           const std::shared_ptr<Tensor>& indirectTensor,
+                           vk::DeviceSize offset = 0,
+                           const std::vector<T>& pushConstants = {})
+      : OpAlgoDispatch(algorithm, pushConstants)
+    {
+        KP_LOG_DEBUG("Kompute OpAlgoDispatchIndirect constructor");
+
+        if (!indirectTensor) {
+            throw std::runtime_error(
+              "Kompute OpAlgoDispatchIndirect indirect tensor is null");
+        }
+        if (indirectTensor->tensorType() == Tensor::TensorTypes::eUniform ||
+            indirectTensor->tensorType() == Tensor::TensorTypes::eImage) {
+            throw std::runtime_error("Kompute OpAlgoDispatchIndirect indirect "
+                                     "tensor cannot be a uniform or image "
+                                     "tensor");
+        }
+        if (offset % 4) {
+            throw std::runtime_error(
+              fmt::format("Kompute OpAlgoDispatchIndirect offset {} is not a "
+                          "multiple of 4",
+                          offset));
+        }
+        if (indirectTensor->memorySize() <
+            offset + sizeof(VkDispatchIndirectCommand)) {
+            throw std::runtime_error(
+              fmt::format("Kompute OpAlgoDispatchIndirect indirect tensor of "
+                          "{} bytes cannot hold a dispatch command at offset "
+                          "{}",
+                          indirectTensor->memorySize(),
+                          offset));
+        }
+
+        this->mIndirectTensor = indirectTensor;
+        this->mOffset = offset;
+    }
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpAlgoDispatchIndirect() override;
+
+    /**
+     * This records the commands that are to be sent to the GPU, binding the
+     * algorithm and recording the indirect dispatch which reads the
+     * workgroup counts from the indirect tensor on execution.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Declares the accesses of the dispatch to the tensors of the algorithm
+     * as well as the indirect command read of the indirect tensor.
+     *
+     * @return Accesses of the dispatch to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<Tensor> mIndirectTensor;
+    vk::DeviceSize mOffset = 0;
+};
+
+} // End namespace kp
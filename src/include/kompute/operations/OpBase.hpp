@@ -18,6 +18,16 @@ namespace kp {
 class OpBase
 {
   public:
+    /**
+     * Access of an operation to the memory of a tensor on the GPU, used by
+     * the sequence to record the barriers required between the operations.
+     */
+    struct TensorAccess
+    {
+        std::shared_ptr<Tensor> tensor;
+        vk::PipelineStageFlags stageMask;
+        vk::AccessFlags accessMask;
+    };
 
     /**
      * Default destructor for OpBase class. This OpBase destructor class should
@@ -61,6 +71,18 @@ class OpBase
      * @param commandBuffer The command buffer to record the command into.
      */
     virtual void postEval(const vk::CommandBuffer& commandBuffer) = 0;
+
+    /**
+     * Declares the accesses of the commands recorded by the operation to the
+     * memory of its tensors. The sequence records the barriers these accesses
+     * require against the operations recorded before, so the operation does
+     * not record barriers of its own. Operations that declare no accesses are
+     * expected to record their own barriers, and the sequence assumes they
+     * may have written to any tensor.
+     *
+     * @return Accesses of the operation to the memory of its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() { return {}; }
 };
 
 } // End namespace kp
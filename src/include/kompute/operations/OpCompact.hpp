@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Core.hpp"
+
+#include "kompute/shaders/shaderopcompact.hpp"
+
+#include "kompute/Algorithm.hpp"
+#include "kompute/Tensor.hpp"
+
+#include "kompute/operations/OpScan.hpp"
+
+namespace kp {
+
+/**
+ * Operation that compacts the elements of a 32-bit tensor whose flag is not
+ * zero into the front of an output tensor, keeping their order, so a
+ * filtering stage doesn't have to read its results back to the host.
+ *
+ * The destination of every element kept is found with the reduce-then-scan
+ * passes of OpScan on the flags. The number of elements kept is written to a
+ * count tensor of at least 4 uint32 elements: the first 3 are a
+ * VkDispatchIndirectCommand with one invocation per element kept for a local
+ * size of indirectLocalSize, which can be passed as it is to
+ * OpAlgoDispatchIndirect, and the fourth is the number of elements kept.
+ */
+class OpCompact : public OpScan
+{
+  public:
+    /**
+     * Constructor that overrides the algorithm with the compaction shader and
+     * the tensors provided.
+     *
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the 32-bit values, the int32 or uint32 flags of the same
+     * size, the output of the data type of the values and at least their
+     * size, the uint32 count tensor and the 32-bit partials tensor of at least
+     * OpScan::partialsSize elements
+     * @param algorithm An algorithm that will be overridden with the
+     * OpCompact shader data and the tensors provided
+     * @param indirectLocalSize The local size of the algorithm dispatched
+     * with the dispatch command of the count tensor, usually its
+     * Algorithm::getLocalSizeX
+     */
+    OpCompact(const std::vector<std::shared_ptr<Tensor>>& tensors,
+              const std::shared_ptr<Algorithm>& algorithm,
+              uint32_t indirectLocalSize = 1);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpCompact() override;
+};
+
+} // End namespace kp
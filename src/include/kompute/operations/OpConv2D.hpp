@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Core.hpp"
+
+#include "kompute/shaders/shaderopconv2d.hpp"
+
+#include "kompute/Algorithm.hpp"
+#include "kompute/Tensor.hpp"
+
+#include "kompute/operations/OpAlgoDispatch.hpp"
+#include "kompute/operations/OpMatMul.hpp"
+
+// Largest number of workgroups dispatched along the pixels of an image,
+// which is the minimum workgroup count limit of every device. The
+// workgroups loop over the remaining tiles of larger images.
+#ifndef KOMPUTE_CONV2D_MAX_WORKGROUPS
+#define KOMPUTE_CONV2D_MAX_WORKGROUPS 65535
+#endif
+
+namespace kp {
+
+/**
+ * Operation that computes the two dimensional convolution of a batch of
+ * float images, with an optional bias and a fused relu or leaky relu
+ * activation, as an implicit matrix multiplication that gathers the input
+ * windows while loading the shared memory tiles of the OpMatMul shader
+ * design, so the images are never expanded in memory.
+ *
+ * The images are stored NCHW or NHWC. The weights are stored
+ * [outChannels][inChannels][kernelHeight][kernelWidth] for NCHW images and
+ * [outChannels][kernelHeight][kernelWidth][inChannels] for NHWC images,
+ * and the bias holds one value per output channel.
+ */
+class OpConv2D : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Memory layout of the input and output images.
+     */
+    enum class Layout
+    {
+        eNCHW = 0,
+        eNHWC = 1,
+    };
+
+    /**
+     * Activation applied to the outputs of the convolution.
+     */
+    enum class Activation
+    {
+        eNone = 0,
+        eRelu = 1,
+        eLeakyRelu = 2,
+    };
+
+    /**
+     * Constructor that overrides the algorithm with the convolution shader,
+     * specialized for the kernel size, layout and activation, and the
+     * tensors provided.
+     *
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the float input, weights, optionally bias and output
+     * @param algorithm An algorithm that will be overridden with the
+     * OpConv2D shader data and the tensors provided
+     * @param batch The number of images of the input and output
+     * @param inChannels The channels of the input images
+     * @param inHeight The height of the input images
+     * @param inWidth The width of the input images
+     * @param outChannels The channels of the output images
+     * @param kernelHeight The height of the kernel window
+     * @param kernelWidth The width of the kernel window
+     * @param stride The step of the kernel window along both dimensions
+     * @param padding The zeros added around the input images along both
+     * dimensions
+     * @param layout The memory layout of the input and output images
+     * @param activation The activation applied to the outputs
+     * @param alpha The slope of the negative outputs of eLeakyRelu
+     * @param tileSize The size of the square tiles of output pixels by
+     * output channels computed by each workgroup, as described by OpMatMul,
+     * or 0 for KOMPUTE_MATMUL_DEFAULT_TILE_SIZE
+     */
+    OpConv2D(const std::vector<std::shared_ptr<Tensor>>& tensors,
+             const std::shared_ptr<Algorithm>& algorithm,
+             uint32_t batch,
+             uint32_t inChannels,
+             uint32_t inHeight,
+             uint32_t inWidth,
+             uint32_t outChannels,
+             uint32_t kernelHeight,
+             uint32_t kernelWidth,
+             uint32_t stride = 1,
+             uint32_t padding = 0,
+             Layout layout = Layout::eNCHW,
+             Activation activation = Activation::eNone,
+             float alpha = 0.01,
+             uint32_t tileSize = 0);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpConv2D() override;
+
+    /**
+     * Declares the shader reads of the input, weights and bias as well as
+     * the shader write of the output.
+     *
+     * @return Accesses of the convolution to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+    /**
+     * Returns the size of a dimension of the output images.
+     *
+     * @param inSize The size of the dimension of the input images
+     * @param kernelSize The size of the kernel window along the dimension
+     * @param stride The step of the kernel window
+     * @param padding The zeros added on both sides of the dimension
+     * @return The size of the dimension of the output, 0 when the kernel
+     * window is larger than the padded input
+     */
+    static uint32_t outputSize(uint32_t inSize,
+                               uint32_t kernelSize,
+                               uint32_t stride = 1,
+                               uint32_t padding = 0);
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mTensors;
+};
+
+} // End namespace kp
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Core.hpp"
+
+#include "kompute/Algorithm.hpp"
+#include "kompute/Expression.hpp"
+#include "kompute/Tensor.hpp"
+
+#include "kompute/operations/OpAlgoDispatch.hpp"
+
+namespace kp {
+
+/**
+ * Operation that evaluates an elementwise Expression into a float tensor in
+ * a single dispatch of a shader generated for the expression, so chains of
+ * elementwise operations neither dispatch once per operation nor write their
+ * intermediate results to memory.
+ */
+class OpExpression : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that overrides the algorithm with the shader of the
+     * expression, the output tensor and the tensors of the expression.
+     *
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the float output of the expression, which can also be
+     * read by the expression
+     * @param algorithm An algorithm that will be overridden with the shader
+     * generated for the expression and its tensors
+     * @param expression The expression to evaluate, whose tensors must be
+     * float tensors of the size of the output
+     */
+    OpExpression(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                 const std::shared_ptr<Algorithm>& algorithm,
+                 const Expression& expression);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpExpression() override;
+
+    /**
+     * Declares the shader reads of the tensors of the expression and the
+     * shader write of the output.
+     *
+     * @return Accesses of the expression to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<Tensor> mOutput;
+    std::vector<std::shared_ptr<Tensor>> mInputs;
+};
+
+} // End namespace kp
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Core.hpp"
+
+#include "kompute/shaders/shaderoplogisticregression.hpp"
+
+#include "kompute/Algorithm.hpp"
+#include "kompute/Tensor.hpp"
+
+#include "kompute/operations/OpAlgoDispatch.hpp"
+
+// Size of the shared memory partials array of the training shader
+#define KOMPUTE_LOGISTIC_REGRESSION_MAX_LOCAL_SIZE 1024
+
+namespace kp {
+
+/**
+ * Operation that trains a logistic regression with full batch gradient
+ * descent for several epochs in a single dispatch, so the weights stay on
+ * the device between epochs and only the trained weights, bias and loss
+ * have to be read back by the host.
+ *
+ * The training runs in one workgroup that keeps the weights in shared
+ * memory, and reduces the gradients of the samples in shared memory every
+ * epoch before updating the weights.
+ */
+class OpLogisticRegression : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that overrides the algorithm with the training shader and
+     * the tensors provided.
+     *
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the float samples stored row by row, the labels of 0 or
+     * 1 of each sample, the weights of each feature, the bias and the loss.
+     * The weights and bias hold the initial values and are overwritten with
+     * the trained values, and the loss receives the mean cross entropy of
+     * the last epoch
+     * @param algorithm An algorithm that will be overridden with the
+     * OpLogisticRegression shader data and the tensors provided
+     * @param epochs The number of gradient descent steps over all samples
+     * @param learningRate The step size of the updates of the weights
+     */
+    OpLogisticRegression(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                         const std::shared_ptr<Algorithm>& algorithm,
+                         uint32_t epochs,
+                         float learningRate = 0.1);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpLogisticRegression() override;
+
+    /**
+     * Declares the shader reads of the samples and labels, the shader reads
+     * and writes of the weights and bias and the shader write of the loss.
+     *
+     * @return Accesses of the training to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mTensors;
+};
+
+} // End namespace kp
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Core.hpp"
+
+#include "kompute/shaders/shaderopmatmul.hpp"
+
+#include "kompute/Algorithm.hpp"
+#include "kompute/Tensor.hpp"
+
+#include "kompute/operations/OpAlgoDispatch.hpp"
+
+// Rows of the output accumulated in registers by each invocation, which has
+// to be at most 8 and a power of two
+#ifndef KOMPUTE_MATMUL_WORK_PER_THREAD
+#define KOMPUTE_MATMUL_WORK_PER_THREAD 4
+#endif
+
+// Tile size used when none is provided, which fits the minimum workgroup
+// limits of every device
+#ifndef KOMPUTE_MATMUL_DEFAULT_TILE_SIZE
+#define KOMPUTE_MATMUL_DEFAULT_TILE_SIZE 16
+#endif
+
+// Size of the shared memory tiles of the matrix multiplication shader, which
+// are declared with this fixed size whatever the tile size specialized
+#define KOMPUTE_MATMUL_MAX_TILE_SIZE 32
+
+namespace kp {
+
+/**
+ * Operation that multiplies two row-major float matrices, or two batches of
+ * matrices, into a third tensor with a tiled shader that stages blocks of
+ * the inputs in shared memory and accumulates several outputs per
+ * invocation in registers.
+ *
+ * The output C is M x N and is computed as op(A) * op(B), where op(A) is
+ * M x K and op(B) is K x N. A transposed input is stored with its
+ * dimensions swapped, for example A of K x M when transposeA is set. The
+ * matrices of a batch are stored one after the other in each tensor.
+ *
+ * Only the tile size of C and the local size are specialization constants.
+ * The shared memory tiles of A and B are arrays of a fixed
+ * KOMPUTE_MATMUL_MAX_TILE_SIZE x KOMPUTE_MATMUL_MAX_TILE_SIZE floats, so
+ * every tile size reserves 8 KB of shared memory per workgroup, and tiles
+ * larger than 32 x 32 require changing the shader.
+ */
+class OpMatMul : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that overrides the algorithm with the matrix
+     * multiplication shader, specialized for the tile size, and the tensors
+     * provided.
+     *
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the float tensors A, B and C
+     * @param algorithm An algorithm that will be overridden with the OpMatMul
+     * shader data and the tensors provided
+     * @param m Rows of op(A) and C
+     * @param n Columns of op(B) and C
+     * @param k Columns of op(A) and rows of op(B)
+     * @param transposeA Whether A is stored transposed as a K x M matrix
+     * @param transposeB Whether B is stored transposed as a N x K matrix
+     * @param batchCount The number of matrix multiplications of the batch
+     * @param tileSize The size of the square tiles of C computed by each
+     * workgroup, a power of two between KOMPUTE_MATMUL_WORK_PER_THREAD and
+     * KOMPUTE_MATMUL_MAX_TILE_SIZE, or 0 for
+     * KOMPUTE_MATMUL_DEFAULT_TILE_SIZE. The largest size supported by a
+     * device is returned by tileSizeForDevice.
+     */
+    OpMatMul(const std::vector<std::shared_ptr<Tensor>>& tensors,
+             const std::shared_ptr<Algorithm>& algorithm,
+             uint32_t m,
+             uint32_t n,
+             uint32_t k,
+             bool transposeA = false,
+             bool transposeB = false,
+             uint32_t batchCount = 1,
+             uint32_t tileSize = 0);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpMatMul() override;
+
+    /**
+     * Declares the shader reads of A and B as well as the shader write of C.
+     *
+     * @return Accesses of the matrix multiplication to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+    /**
+     * Returns the largest tile size whose workgroups fit the compute limits
+     * of a device, which is the fastest on most devices.
+     *
+     * @param properties The properties of the physical device
+     * @return The tile size to provide to the constructor
+     */
+    static uint32_t tileSizeForDevice(
+      const vk::PhysicalDeviceProperties& properties);
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mTensors;
+};
+
+} // End namespace kp
@@ -46,7 +46,8 @@ class OpMemoryBarrier : public OpBase
 
     /**
      * This records the memory barrier with the access and stage masks provided
-     * across all relevant tensors.
+     * across all relevant tensors, as a single pipeline barrier command with
+     * one buffer memory barrier per tensor.
      *
      * @param commandBuffer The command buffer to record the command into.
      */
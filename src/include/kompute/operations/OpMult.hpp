@@ -1,8 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
-#include <fstream>
-
 #include "kompute/Core.hpp"
 
 #include "kompute/shaders/shaderopmult.hpp"
@@ -12,49 +10,62 @@
 
 #include "kompute/operations/OpAlgoDispatch.hpp"
 
+// Largest number of workgroups dispatched by the vectorized OpMult shader,
+// which is the minimum workgroup count limit of every device. The
+// invocations loop over the remaining elements of larger tensors.
+#ifndef KOMPUTE_MULT_MAX_WORKGROUPS
+#define KOMPUTE_MULT_MAX_WORKGROUPS 65535
+#endif
+
 namespace kp {
 
 /**
- * Operation that performs multiplication on two tensors and outpus on third
- * tensor.
+ * Operation that performs elementwise multiplication on two float tensors
+ * and outputs on a third tensor.
+ *
+ * When Kompute is built with the shader compiler, a vectorized shader is
+ * compiled in process, where each invocation multiplies four elements at a
+ * time through vec4 loads and stores in a grid-stride loop, with the local
+ * size of the algorithm and at most KOMPUTE_MULT_MAX_WORKGROUPS workgroups.
+ * Either input can then hold a single value that is multiplied with every
+ * element of the other input. Otherwise the prebuilt shader multiplies one
+ * element per workgroup and the inputs need the size of the output.
  */
 class OpMult : public OpAlgoDispatch
 {
   public:
-
     /**
      * Default constructor with parameters that provides the bare minimum
      * requirements for the operations to be able to create and manage their
      * sub-components.
      *
-     * @param tensors Tensors that are to be used in this operation
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the lhs, rhs and output float tensors, where the lhs and
+     * rhs have either the size of the output or, with the shader compiler, a
+     * single element
      * @param algorithm An algorithm that will be overridden with the OpMult
-     * shader data and the tensors provided which are expected to be 3
+     * shader data and the tensors provided
      */
-    OpMult(std::vector<std::shared_ptr<Tensor>> tensors, std::shared_ptr<Algorithm> algorithm)
-        : OpAlgoDispatch(algorithm)
-    {
-        KP_LOG_DEBUG("Kompute OpMult constructor with params");
-
-        if (tensors.size() != 3) {
-            throw std::runtime_error("Kompute OpMult expected 3 tensors but got " + tensors.size());
-        }
-
-        std::vector<uint32_t> spirv(
-          (uint32_t*)shader_data::shaders_glsl_opmult_comp_spv,
-          (uint32_t*)(shader_data::shaders_glsl_opmult_comp_spv +
-            kp::shader_data::shaders_glsl_opmult_comp_spv_len));
-
-        algorithm->rebuild<>(tensors, spirv);
-    }
+    OpMult(std::vector<std::shared_ptr<Tensor>> tensors,
+           std::shared_ptr<Algorithm> algorithm);
 
     /**
      * Default destructor, which is in charge of destroying the algorithm
      * components but does not destroy the underlying tensors
      */
-    virtual ~OpMult() override {
-        KP_LOG_DEBUG("Kompute OpMult destructor started");
-    }
+    virtual ~OpMult() override;
+
+    /**
+     * Declares the shader reads of the inputs and the shader write of the
+     * output.
+     *
+     * @return Accesses of the multiplication to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mTensors;
 };
 
 } // End namespace kp
@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Core.hpp"
+
+#include "kompute/shaders/shaderopreduce.hpp"
+#include "kompute/shaders/shaderopreduce_subgroup.hpp"
+
+#include "kompute/Algorithm.hpp"
+#include "kompute/Tensor.hpp"
+
+#include "kompute/operations/OpAlgoDispatch.hpp"
+
+// Upper bound of the workgroups dispatched by a reduction, past which every
+// invocation accumulates several elements before the workgroup reduction
+#ifndef KOMPUTE_REDUCE_MAX_WORKGROUPS
+#define KOMPUTE_REDUCE_MAX_WORKGROUPS 1024
+#endif
+
+// Size of the shared memory partials array of the reduction shaders
+#define KOMPUTE_REDUCE_MAX_LOCAL_SIZE 1024
+
+namespace kp {
+
+/**
+ * Operation that reduces all the elements of a float tensor into a small
+ * output tensor, so only the result has to be read back by the host.
+ *
+ * Each workgroup reduces a strided slice of the input and combines its
+ * partial result atomically into the output, which the operation
+ * initialises with the identity of the reduction. The workgroup reduction
+ * either uses subgroup arithmetic, which requires the device to support the
+ * basic and arithmetic subgroup operations in compute shaders as reported by
+ * Manager::supportsSubgroupOperations, or a fallback reduction in shared
+ * memory that runs on any device.
+ */
+class OpReduce : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Reduction performed by the operation.
+     */
+    enum class Operation
+    {
+        eSum = 0,
+        eMin = 1,
+        eMax = 2,
+        eArgmax = 3, ///< Stores the float bits of the maximum in the first
+                     ///< element of a uint32 output and the first index of
+                     ///< the maximum in the second element
+    };
+
+    /**
+     * Constructor that overrides the algorithm with the reduction shader and
+     * the tensors provided.
+     *
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the float input and output of the reduction, or a uint32
+     * output of at least 2 elements for eArgmax
+     * @param algorithm An algorithm that will be overridden with the OpReduce
+     * shader data and the tensors provided
+     * @param operation The reduction to perform
+     * @param subgroupArithmetic Whether to use the subgroup arithmetic variant
+     * of the shader, which is only valid if the device supports it
+     * @param syncLocal Whether to also read the output back into the host
+     * memory of the tensor, as an OpTensorSyncLocal recorded after the
+     * reduction would
+     */
+    OpReduce(const std::vector<std::shared_ptr<Tensor>>& tensors,
+             const std::shared_ptr<Algorithm>& algorithm,
+             Operation operation = Operation::eSum,
+             bool subgroupArithmetic = false,
+             bool syncLocal = false);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpReduce() override;
+
+    /**
+     * Records the initialisation of the output with the identity of the
+     * reduction, which the workgroups then combine their partial results
+     * with, followed by the dispatch of the reduction. For eArgmax a second
+     * dispatch finds the index of the maximum. The copy of the output to the
+     * host is recorded last if syncLocal was set.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Makes the output available in the host memory of the tensor if
+     * syncLocal was set.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Declares the shader read of the input as well as the transfer write
+     * and shader accesses of the output, and its transfer or host read if
+     * syncLocal was set.
+     *
+     * @return Accesses of the reduction to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<Tensor> mInput;
+    std::shared_ptr<Tensor> mOutput;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    Operation mOperation;
+    bool mSyncLocal;
+};
+
+} // End namespace kp
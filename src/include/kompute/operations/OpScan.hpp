@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Core.hpp"
+
+#include "kompute/shaders/shaderopscan.hpp"
+
+#include "kompute/Algorithm.hpp"
+#include "kompute/Tensor.hpp"
+
+#include "kompute/operations/OpAlgoDispatch.hpp"
+
+// Upper bound of the workgroups dispatched by the block passes of a scan,
+// past which every workgroup processes several blocks
+#ifndef KOMPUTE_SCAN_MAX_WORKGROUPS
+#define KOMPUTE_SCAN_MAX_WORKGROUPS 1024
+#endif
+
+// Elements scanned by a workgroup in a block, which is fixed by the local
+// size and elements per invocation of the scan shaders
+#define KOMPUTE_SCAN_BLOCK_SIZE 1024
+
+namespace kp {
+
+/**
+ * Operation that computes the inclusive or exclusive prefix sum of a 32-bit
+ * float, int32 or uint32 tensor.
+ *
+ * The scan uses a reduce-then-scan in three dispatches of the same pipeline,
+ * which runs on any device: the first reduces every block of
+ * KOMPUTE_SCAN_BLOCK_SIZE elements into a partials tensor, the second scans
+ * the partials with a single workgroup and the third scans every block again
+ * starting from its partial. The partials tensor is scratch memory provided
+ * by the caller, of at least partialsSize elements of the input.
+ */
+class OpScan : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that overrides the algorithm with the scan shader and the
+     * tensors provided.
+     *
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the input, the output of the same data type and at least
+     * the same size, and the 32-bit partials tensor. The input and the output
+     * can be the same tensor to scan in place
+     * @param algorithm An algorithm that will be overridden with the OpScan
+     * shader data and the tensors provided
+     * @param inclusive Whether every output element includes the input
+     * element at the same index, otherwise the scan is exclusive and the
+     * first output element is zero
+     */
+    OpScan(const std::vector<std::shared_ptr<Tensor>>& tensors,
+           const std::shared_ptr<Algorithm>& algorithm,
+           bool inclusive = true);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpScan() override;
+
+    /**
+     * Records the three passes of the scan, with barriers on the partials
+     * tensor in between.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Returns the number of elements of the partials tensor required to scan
+     * an input of the size provided, which is one per block.
+     *
+     * @param size The number of elements of the input
+     * @return The minimum number of elements of the partials tensor
+     */
+    static uint32_t partialsSize(uint32_t size);
+
+  protected:
+    /**
+     * Constructor for the operations that run the passes of the scan with a
+     * shader of their own, which have to call setupPasses once the algorithm
+     * is rebuilt.
+     *
+     * @param algorithm The algorithm object to use for dispatch
+     */
+    OpScan(const std::shared_ptr<Algorithm>& algorithm);
+
+    /**
+     * Validates the partials tensor and sizes the dispatches of the block
+     * passes for an input of the size provided.
+     *
+     * @param partials The partials tensor of the scan
+     * @param size The number of elements of the input
+     * @param pushConstants The push constants of the shader, of which the
+     * first is set to the index of each pass when recording
+     * @param name The name of the operation used in errors
+     */
+    void setupPasses(const std::shared_ptr<Tensor>& partials,
+                     uint32_t size,
+                     const std::vector<uint32_t>& pushConstants,
+                     const std::string& name);
+
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<Tensor> mPartials;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    Workgroup mBlockWorkgroup;
+    std::vector<uint32_t> mPassPushConstants;
+};
+
+} // End namespace kp
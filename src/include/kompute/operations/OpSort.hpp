@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Core.hpp"
+
+#include "kompute/shaders/shaderopsort.hpp"
+
+#include "kompute/Algorithm.hpp"
+#include "kompute/Tensor.hpp"
+
+#include "kompute/operations/OpAlgoDispatch.hpp"
+#include "kompute/operations/OpScan.hpp"
+
+// Upper bound of the workgroups dispatched by the passes of a sort, past
+// which every workgroup sorts several blocks
+#ifndef KOMPUTE_SORT_MAX_WORKGROUPS
+#define KOMPUTE_SORT_MAX_WORKGROUPS 1024
+#endif
+
+// Bits of the keys sorted by every digit of the sort shader
+#define KOMPUTE_SORT_RADIX_BITS 4
+
+namespace kp {
+
+class Manager;
+
+/**
+ * Operation that sorts a uint32, int32 or float tensor of keys in ascending
+ * order, optionally reordering a 32-bit payload tensor of the same size with
+ * the keys. The sort is stable, so equal keys keep the order of their
+ * payloads.
+ *
+ * It is a least significant digit radix sort of KOMPUTE_SORT_RADIX_BITS per
+ * digit, where every digit counts the digits of every block of keys into
+ * histograms, scans them with an OpScan and scatters the keys to their
+ * destinations, all recorded into the same command buffer. The operation
+ * creates and owns the scratch tensors it needs, which are eStorage tensors
+ * of the manager, so it holds memory for about twice the keys and payload.
+ */
+class OpSort : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that creates the algorithms and scratch tensors of the
+     * sort with the manager provided.
+     *
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the keys and optionally the payload
+     * @param manager The manager used to create the algorithms and scratch
+     * tensors, which is only used in the constructor
+     */
+    OpSort(const std::vector<std::shared_ptr<Tensor>>& tensors,
+           Manager& manager);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors but
+     * releases the scratch tensors of the operation
+     */
+    virtual ~OpSort() override;
+
+    /**
+     * Records the histogram, scan and scatter passes of every digit, with
+     * memory barriers in between.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Declares the shader reads and writes of the keys and the payload, as
+     * the scratch tensors are private to the operation.
+     *
+     * @return Accesses of the sort to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::shared_ptr<Tensor> mKeys;
+    std::shared_ptr<Tensor> mPayload;
+
+    // -------------- ALWAYS OWNED RESOURCES
+    std::shared_ptr<Tensor> mKeysScratch;
+    std::shared_ptr<Tensor> mPayloadScratch;
+    std::shared_ptr<Tensor> mHistograms;
+    std::shared_ptr<Tensor> mPartials;
+    std::shared_ptr<OpScan> mScan;
+
+    void recordPass(const vk::CommandBuffer& commandBuffer,
+                    uint32_t pass,
+                    uint32_t shift);
+};
+
+} // End namespace kp
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Core.hpp"
+
+#include "kompute/shaders/shaderopspmm.hpp"
+
+#include "kompute/Algorithm.hpp"
+#include "kompute/SparseTensor.hpp"
+#include "kompute/Tensor.hpp"
+
+#include "kompute/operations/OpAlgoDispatch.hpp"
+
+// Invocations of the workgroups of the sparse matrix product, spread over
+// the columns and rows of the output
+#define KOMPUTE_SPMM_LOCAL_SIZE 64
+
+// Largest number of workgroups dispatched along the rows, which is the
+// minimum workgroup count limit of every device. The workgroups loop over
+// the remaining rows of larger matrices.
+#ifndef KOMPUTE_SPMM_MAX_WORKGROUPS
+#define KOMPUTE_SPMM_MAX_WORKGROUPS 65535
+#endif
+
+namespace kp {
+
+/**
+ * Operation that multiplies a sparse CSR matrix A by a dense row-major float
+ * matrix B into a dense row-major float matrix C, as C = A * B. Each
+ * invocation computes an element of C from the non zeros of its row of A,
+ * and the invocations of a workgroup cover consecutive columns so they read
+ * consecutive elements of B. Narrow matrices put several rows of C in each
+ * workgroup instead of leaving invocations idle.
+ */
+class OpSpMM : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that overrides the algorithm with the sparse matrix
+     * product shader and the tensors provided.
+     *
+     * @param matrix The sparse matrix A of rows x columns
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the float tensors B, of columns x n elements, and C, of
+     * rows x n elements
+     * @param algorithm An algorithm that will be overridden with the OpSpMM
+     * shader data and the tensors provided
+     * @param n Columns of B and C
+     */
+    OpSpMM(const std::shared_ptr<SparseTensor>& matrix,
+           const std::vector<std::shared_ptr<Tensor>>& tensors,
+           const std::shared_ptr<Algorithm>& algorithm,
+           uint32_t n);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpSpMM() override;
+
+    /**
+     * Declares the shader reads of the matrix and B as well as the shader
+     * write of C.
+     *
+     * @return Accesses of the product to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mTensors;
+};
+
+} // End namespace kp
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Core.hpp"
+
+#include "kompute/shaders/shaderopspmv.hpp"
+
+#include "kompute/Algorithm.hpp"
+#include "kompute/SparseTensor.hpp"
+#include "kompute/Tensor.hpp"
+
+#include "kompute/operations/OpAlgoDispatch.hpp"
+
+// Invocations of the workgroups of the sparse matrix vector product, which
+// is the size of the shared memory of the shader
+#define KOMPUTE_SPMV_LOCAL_SIZE 64
+
+// Invocations reducing a row when none is provided are chosen from the
+// average non zeros per row, up to this limit
+#ifndef KOMPUTE_SPMV_MAX_LANES_PER_ROW
+#define KOMPUTE_SPMV_MAX_LANES_PER_ROW 32
+#endif
+
+// Largest number of workgroups dispatched along the rows, which is the
+// minimum workgroup count limit of every device. The workgroups loop over
+// the remaining rows of larger matrices.
+#ifndef KOMPUTE_SPMV_MAX_WORKGROUPS
+#define KOMPUTE_SPMV_MAX_WORKGROUPS 65535
+#endif
+
+namespace kp {
+
+/**
+ * Operation that multiplies a sparse CSR matrix A by a dense float vector x
+ * into a float vector y, as y = A * x. The rows are split across the
+ * invocations of the workgroups, each row being reduced by a group of
+ * invocations that stride over its non zeros, so rows with many non zeros
+ * are spread over several invocations while short rows share a workgroup.
+ */
+class OpSpMV : public OpAlgoDispatch
+{
+  public:
+    /**
+     * Constructor that overrides the algorithm with the sparse matrix vector
+     * product shader and the tensors provided.
+     *
+     * @param matrix The sparse matrix A of rows x columns
+     * @param tensors Tensors that are to be used in this operation, which are
+     * expected to be the float tensors x, of at least columns elements, and
+     * y, of at least rows elements
+     * @param algorithm An algorithm that will be overridden with the OpSpMV
+     * shader data and the tensors provided
+     * @param lanesPerRow The invocations reducing each row, a power of two of
+     * at most KOMPUTE_SPMV_LOCAL_SIZE, or 0 to choose it from the average
+     * non zeros per row
+     */
+    OpSpMV(const std::shared_ptr<SparseTensor>& matrix,
+           const std::vector<std::shared_ptr<Tensor>>& tensors,
+           const std::shared_ptr<Algorithm>& algorithm,
+           uint32_t lanesPerRow = 0);
+
+    /**
+     * Default destructor, which does not destroy the underlying tensors
+     */
+    virtual ~OpSpMV() override;
+
+    /**
+     * Declares the shader reads of the matrix and x as well as the shader
+     * write of y.
+     *
+     * @return Accesses of the product to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+    /**
+     * Returns the invocations reducing each row chosen for a matrix, which
+     * is the power of two closest above its average non zeros per row, up
+     * to KOMPUTE_SPMV_MAX_LANES_PER_ROW.
+     *
+     * @param rows The number of rows of the matrix
+     * @param nonZeroCount The number of non zeros of the matrix
+     * @return The invocations per row
+     */
+    static uint32_t lanesPerRowFor(uint32_t rows, uint32_t nonZeroCount);
+
+  private:
+    // -------------- NEVER OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mTensors;
+};
+
+} // End namespace kp
@@ -14,17 +14,39 @@ namespace kp {
  * provided, using a record command for all the vectors. This operation does not 
  * own/manage the memory of the tensors passed to it. The operation must only 
  * receive tensors of type 
+ * When element ranges are provided only those ranges are copied.
 */
 class OpTensorCopy : public OpBase
 {
   public:
+    /**
+     * Update of the host data of the tensors copied into after each
+     * evaluation.
+     */
+    enum class HostUpdate
+    {
+        eNone = 0,   ///< Only the device memory is copied, and the host data
+                     ///< is read back with OpTensorSyncLocal when needed
+        eMirror = 1, ///< The host data of the first tensor is copied into
+                     ///< the host data of the others, which for device
+                     ///< tensors is their staging memory as last synced
+    };
+
     /**
      * Default constructor with parameters that provides the core vulkan resources 
      * and the tensors that will be used in the operation.
      *
      * @param tensors Tensors that will be used to create in operation.
+     * @param ranges Element ranges to copy into each tensor, the whole
+     * tensors if empty
+     * @param hostUpdate Whether the host data of the first tensor is also
+     * copied on the host into the other tensors after each evaluation, which
+     * eNone avoids for copies broadcasting to many tensors whose host data
+     * is not read
      */
-    OpTensorCopy(const std::vector<std::shared_ptr<Tensor>>& tensors);
+    OpTensorCopy(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                  const std::vector<Tensor::Range>& ranges = {},
+                  HostUpdate hostUpdate = HostUpdate::eMirror);
 
     /**
      * Default destructor. This class does not manage memory so it won't be 
@@ -34,7 +56,7 @@ class OpTensorCopy : public OpBase
 
     /**
      * Records the copy commands from the first tensor into all the other 
-     * tensors provided. Also optionally records a barrier.
+     * tensors provided, computing the copy regions once for all of them.
      *
      * @param commandBuffer The command buffer to record the command into.
      */
@@ -48,15 +70,26 @@ class OpTensorCopy : public OpBase
     virtual void preEval(const vk::CommandBuffer& commandBuffer) override;
 
     /**
-     * Copies the local vectors for all the tensors to sync the data with the gpu.
+     * Copies the local vectors for all the tensors to sync the data with the
+     * gpu, unless the host update is eNone.
      *
      * @param commandBuffer The command buffer to record the command into.
      */
     virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
 
+    /**
+     * Declares a transfer read of the first tensor and transfer writes to the
+     * tensors copied into.
+     *
+     * @return Accesses of the operation to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
   private:
     // -------------- ALWAYS OWNED RESOURCES
     std::vector<std::shared_ptr<Tensor>> mTensors;
+    std::vector<Tensor::Range> mRanges;
+    HostUpdate mHostUpdate;
 };
 
 } // End namespace kp
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "kompute/Core.hpp"
+
+#include "kompute/Tensor.hpp"
+
+#include "kompute/operations/OpBase.hpp"
+
+namespace kp {
+
+/**
+ * Operation that fills the GPU memory of the tensors provided with a repeated
+ * 32-bit value, using a record command for all the tensors so no host data is
+ * required. This is intended to clear output and scratch tensors, including
+ * tensors of type eStorage. This operation does not own/manage the memory of
+ * the tensors passed to it.
+*/
+class OpTensorFill : public OpBase
+{
+  public:
+    /**
+     * Default constructor with parameters that provides the tensors that will
+     * be filled and the value to fill them with.
+     *
+     * @param tensors Tensors that will be used to create in operation.
+     * @param data The 32-bit pattern written repeatedly into the tensors,
+     * which defaults to zero
+     */
+    OpTensorFill(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                 uint32_t data = 0);
+
+    /**
+     * Default destructor. This class does not manage memory so it won't be 
+     * expecting the parent to perform a release.
+     */
+    ~OpTensorFill() override;
+
+    /**
+     * Records the fill commands for all the tensors provided.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    void record(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Does not perform any preEval commands.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void preEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Fills the local data of the tensors that hold a separate host copy, and
+     * invalidates the memory of host tensors, to keep the data in sync with
+     * the gpu.
+     *
+     * @param commandBuffer The command buffer to record the command into.
+     */
+    virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
+
+    /**
+     * Declares transfer writes to the tensors filled.
+     *
+     * @return Accesses of the operation to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+  private:
+    // -------------- ALWAYS OWNED RESOURCES
+    std::vector<std::shared_ptr<Tensor>> mTensors;
+    uint32_t mData;
+};
+
+} // End namespace kp
@@ -14,6 +14,12 @@ namespace kp {
  * into GPU memory which means that the operation will be done in sync with GPU commands. 
  * For TensorTypes::eHost it will only map the data into host memory which will 
  * happen during preEval before the recorded commands are dispatched.
+ * For device tensors that use a staging ring the data is uploaded through the
+ * ring during preEval, before the recorded commands are submitted.
+ * When element ranges are provided only those ranges are transferred, such as
+ * the ranges returned by Tensor::dirtyRanges. Tensors of type eImage are
+ * copied whole from their staging buffer, which leaves the image in the
+ * general layout shaders access it in.
 */
 class OpTensorSyncDevice : public OpBase
 {
@@ -24,8 +30,11 @@ class OpTensorSyncDevice : public OpBase
      * be of type TensorTypes::eStorage.
      *
      * @param tensors Tensors that will be used to create in operation.
+     * @param ranges Element ranges to sync in each tensor, the whole
+     * tensors if empty
      */
-    OpTensorSyncDevice(const std::vector<std::shared_ptr<Tensor>>& tensors);
+    OpTensorSyncDevice(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                        const std::vector<Tensor::Range>& ranges = {});
 
     /**
      * Default destructor. This class does not manage memory so it won't be expecting the parent to perform a release.
@@ -41,7 +50,9 @@ class OpTensorSyncDevice : public OpBase
     void record(const vk::CommandBuffer& commandBuffer) override;
 
     /**
-     * Does not perform any preEval commands.
+     * For device tensors that use a staging ring, it uploads the data through
+     * the ring into device memory. Other tensors with non-coherent host memory
+     * have their mapped memory flushed before the commands are submitted.
      *
      * @param commandBuffer The command buffer to record the command into.
      */
@@ -54,9 +65,25 @@ class OpTensorSyncDevice : public OpBase
      */
     virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
 
+    /**
+     * Declares transfer writes to the device tensors synced.
+     *
+     * @return Accesses of the operation to its tensors
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+    /**
+     * Staging ring that the tensors of the operation transfer through. Its
+     * transfers are submitted before the command buffer of the sequence.
+     *
+     * @return The staging ring, or nullptr if no tensor uses one
+     */
+    std::shared_ptr<StagingRing> stagingRing();
+
   private:
     // -------------- ALWAYS OWNED RESOURCES
     std::vector<std::shared_ptr<Tensor>> mTensors;
+    std::vector<Tensor::Range> mRanges;
 };
 
 } // End namespace kp
@@ -15,7 +15,11 @@ namespace kp {
  * for the memory to be syncd into GPU memory which means that the operation 
  * will be done in sync with GPU commands. For TensorTypes::eHost it will 
  * only map the data into host memory which will happen during preEval before 
- * the recorded commands are dispatched.
+ * the recorded commands are dispatched. For device tensors that use a staging 
+ * ring the data is downloaded through the ring during postEval, once the 
+ * recorded commands have completed. When element ranges are provided only
+ * those ranges are transferred, while tensors of type eImage are always
+ * copied whole.
 */
 class OpTensorSyncLocal : public OpBase
 {
@@ -26,8 +30,11 @@ class OpTensorSyncLocal : public OpBase
      * cannot be of type TensorTypes::eStorage.
      *
      * @param tensors Tensors that will be used to create in operation.
+     * @param ranges Element ranges to sync in each tensor, the whole
+     * tensors if empty
      */
-    OpTensorSyncLocal(const std::vector<std::shared_ptr<Tensor>>& tensors);
+    OpTensorSyncLocal(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                       const std::vector<Tensor::Range>& ranges = {});
 
     /**
      * Default destructor. This class does not manage memory so it won't be expecting 
@@ -52,15 +59,33 @@ class OpTensorSyncLocal : public OpBase
 
     /**
      * For host tensors it performs the map command from the host memory into local memory.
+     * For device tensors that use a staging ring it downloads the data through the ring.
+     * Other tensors with non-coherent host memory have their mapped memory invalidated.
      *
      * @param commandBuffer The command buffer to record the command into.
      */
     virtual void postEval(const vk::CommandBuffer& commandBuffer) override;
 
+    /**
+     * Declares transfer reads of device tensors and host reads of host
+     * visible tensors, so the data is available once the sequence completes.
+     *
+     * @return Accesses of the operation to the tensors synced
+     */
+    virtual std::vector<TensorAccess> tensorAccesses() override;
+
+    /**
+     * Staging ring that the tensors of the operation transfer through. Its
+     * transfers are submitted after the command buffer of the sequence.
+     *
+     * @return The staging ring, or nullptr if no tensor uses one
+     */
+    std::shared_ptr<StagingRing> stagingRing();
 
   private:
     // -------------- ALWAYS OWNED RESOURCES
     std::vector<std::shared_ptr<Tensor>> mTensors;
+    std::vector<Tensor::Range> mRanges;
 };
 
 } // End namespace kp
@@ -2,7 +2,14 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <future>
+#include <mutex>
+#include <numeric>
 
 #include "kompute/Kompute.hpp"
 
@@ -10,9 +17,8 @@
 
 TEST(TestAsyncOperations, TestManagerParallelExecution)
 {
-    // This test is built for NVIDIA 1650. It assumes:
-    // * Queue family 0 and 2 have compute capabilities
-    // * GPU is able to process parallel shader code across different families
+    // This test requires a GPU with a compute queue family without graphics,
+    // which processes shader code in parallel with the first compute family
     uint32_t size = 10;
 
     uint32_t numParallel = 2;
@@ -48,6 +54,11 @@ TEST(TestAsyncOperations, TestManagerParallelExecution)
 
     kp::Manager mgr;
 
+    if (mgr.queueIndex(kp::Manager::QueueRole::eAsyncCompute) ==
+        mgr.queueIndex(kp::Manager::QueueRole::eCompute)) {
+        GTEST_SKIP() << "Device has no dedicated compute queue family";
+    }
+
     std::shared_ptr<kp::Sequence> sq = mgr.sequence();
 
     std::vector<std::shared_ptr<kp::Tensor>> inputsSyncB;
@@ -79,8 +90,6 @@ TEST(TestAsyncOperations, TestManagerParallelExecution)
         EXPECT_EQ(inputsSyncB[i]->vector<float>(), resultSync);
     }
 
-    kp::Manager mgrAsync(0, { 0, 2 });
-
     std::vector<std::shared_ptr<kp::Tensor>> inputsAsyncB;
 
     std::vector<std::shared_ptr<kp::Algorithm>> algosAsync;
@@ -90,11 +99,10 @@ TEST(TestAsyncOperations, TestManagerParallelExecution)
         algosAsync.push_back(mgr.algorithm({ inputsAsyncB[i] }, spirv));
     }
 
-    std::vector<std::shared_ptr<kp::Sequence>> sqs;
-
-    for (uint32_t i = 0; i < numParallel; i++) {
-        sqs.push_back(mgrAsync.sequence(i));
-    }
+    std::vector<std::shared_ptr<kp::Sequence>> sqs = {
+        mgr.sequence(kp::Manager::QueueRole::eCompute),
+        mgr.sequence(kp::Manager::QueueRole::eAsyncCompute)
+    };
 
     auto startAsync = std::chrono::high_resolution_clock::now();
 
@@ -254,3 +262,287 @@ TEST(TestAsyncOperations, TestManagerAsyncExecutionTimeout)
     EXPECT_EQ(tensorA->vector(), resultAsync);
     EXPECT_EQ(tensorB->vector(), resultAsync);
 }
+
+TEST(TestAsyncOperations, TestManagerCompletionCallbacksAndFutures)
+{
+    kp::Manager mgr;
+
+    uint32_t total = 9;
+
+    std::vector<std::shared_ptr<kp::TensorT<float>>> tensorsIn;
+    std::vector<std::shared_ptr<kp::TensorT<float>>> tensorsOut;
+    std::vector<std::shared_ptr<kp::Sequence>> sequences;
+    for (uint32_t i = 0; i < total; i++) {
+        tensorsIn.push_back(mgr.tensor({ (float)i, (float)i, (float)i }));
+        tensorsOut.push_back(mgr.tensor({ 0, 0, 0 }));
+        sequences.push_back(
+          mgr.sequence()
+            ->record<kp::OpTensorSyncDevice>({ tensorsIn[i] })
+            ->record<kp::OpTensorCopy>({ tensorsIn[i], tensorsOut[i] })
+            ->record<kp::OpTensorSyncLocal>({ tensorsOut[i] }));
+    }
+
+    // A third of the sequences notify a callback, a third a completion with
+    // the exception and the rest a future
+    std::mutex mutex;
+    std::condition_variable condition;
+    uint32_t completedCallbacks = 0;
+    std::vector<std::future<std::shared_ptr<kp::Sequence>>> futures;
+    for (uint32_t i = 0; i < total; i++) {
+        if (i % 3 == 1) {
+            mgr.evalAsync(sequences[i], [&](std::shared_ptr<kp::Sequence> sq) {
+                EXPECT_FALSE(sq->isRunning());
+                std::lock_guard<std::mutex> lock(mutex);
+                completedCallbacks++;
+                condition.notify_one();
+            });
+        } else if (i % 3 == 2) {
+            mgr.evalAsync(sequences[i],
+                          [&](std::shared_ptr<kp::Sequence> sq,
+                              std::exception_ptr exception) {
+                              EXPECT_FALSE(exception);
+                              EXPECT_FALSE(sq->isRunning());
+                              std::lock_guard<std::mutex> lock(mutex);
+                              completedCallbacks++;
+                              condition.notify_one();
+                          });
+        } else {
+            futures.push_back(mgr.evalAsync(sequences[i]));
+        }
+    }
+
+    for (std::future<std::shared_ptr<kp::Sequence>>& future : futures) {
+        EXPECT_FALSE(future.get()->isRunning());
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock,
+                       [&]() { return completedCallbacks == 2 * total / 3; });
+    }
+
+    for (uint32_t i = 0; i < total; i++) {
+        EXPECT_EQ(tensorsOut[i]->vector(),
+                  std::vector<float>({ (float)i, (float)i, (float)i }));
+    }
+}
+
+TEST(TestAsyncOperations, TestManagerAlgorithmAsync)
+{
+    kp::Manager mgr;
+
+    std::string shader(R"(
+      #version 450
+      layout (constant_id = 0) const float cIncrement = 0;
+      layout (local_size_x = 1) in;
+      layout(set = 0, binding = 0) buffer a { float pa[]; };
+      void main() {
+          uint index = gl_GlobalInvocationID.x;
+          pa[index] = pa[index] + cIncrement;
+      })");
+
+    std::vector<uint32_t> spirv = compileSource(shader);
+
+    uint32_t numAlgorithms = 8;
+
+    std::vector<std::shared_ptr<kp::Tensor>> tensors;
+    std::vector<std::shared_ptr<kp::Algorithm>> algorithms;
+    for (uint32_t i = 0; i < numAlgorithms; i++) {
+        tensors.push_back(mgr.tensor({ 0, 0, 0 }));
+        // Different constants so each algorithm compiles its own pipeline
+        algorithms.push_back(mgr.algorithmAsync(
+          { tensors[i] }, spirv, {}, std::vector<float>({ float(i) })));
+    }
+
+    std::shared_ptr<kp::Sequence> sq =
+      mgr.sequence()->record<kp::OpTensorSyncDevice>(tensors);
+    // Recording waits for each algorithm to be built
+    for (const std::shared_ptr<kp::Algorithm>& algorithm : algorithms) {
+        sq->record<kp::OpAlgoDispatch>(algorithm);
+    }
+    sq->record<kp::OpTensorSyncLocal>(tensors)->eval();
+
+    for (uint32_t i = 0; i < numAlgorithms; i++) {
+        EXPECT_TRUE(algorithms[i]->isInit());
+        EXPECT_EQ(tensors[i]->vector<float>(),
+                  std::vector<float>({ float(i), float(i), float(i) }));
+    }
+
+    // Algorithms still being built are waited for when destroyed
+    std::shared_ptr<kp::Algorithm> pending =
+      mgr.algorithmAsync({ tensors[0] }, spirv);
+    pending->destroy();
+    EXPECT_FALSE(pending->isInit());
+}
+
+TEST(TestAsyncOperations, TestTransferQueueSyncWithCompute)
+{
+    kp::Manager mgr(0, {}, { VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME });
+
+    if (!mgr.hasTimelineSemaphores()) {
+        GTEST_SKIP() << "Device has no timeline semaphores";
+    }
+
+    std::shared_ptr<kp::TensorT<float>> tensorLHS = mgr.tensor({ 0, 1, 2 });
+    std::shared_ptr<kp::TensorT<float>> tensorRHS = mgr.tensor({ 2, 4, 6 });
+    std::shared_ptr<kp::TensorT<float>> tensorOutput = mgr.tensor({ 0, 0, 0 });
+
+    // The tensors are shared by the queues of all the roles by default
+    if (mgr.queueIndex(kp::Manager::QueueRole::eTransfer) !=
+        mgr.queueIndex(kp::Manager::QueueRole::eCompute)) {
+        EXPECT_GT(tensorOutput->queueFamilyIndices().size(), 1);
+    }
+
+    std::vector<std::shared_ptr<kp::Tensor>> params = { tensorLHS,
+                                                        tensorRHS,
+                                                        tensorOutput };
+
+    std::shared_ptr<kp::Sequence> sqUpload =
+      mgr.sequence(kp::Manager::QueueRole::eTransfer)
+        ->record<kp::OpTensorSyncDevice>({ tensorLHS, tensorRHS });
+    std::shared_ptr<kp::Sequence> sqCompute =
+      mgr.sequence(kp::Manager::QueueRole::eCompute)
+        ->record<kp::OpMult>(params, mgr.algorithm());
+    std::shared_ptr<kp::Sequence> sqDownload =
+      mgr.sequence(kp::Manager::QueueRole::eTransfer)
+        ->record<kp::OpTensorSyncLocal>({ tensorOutput });
+
+    for (uint32_t i = 0; i < 5; i++) {
+        tensorLHS->setData({ (float)i, 1, 2 });
+
+        // The copies only wait for the compute on the GPU
+        sqUpload->evalAsync();
+        sqCompute->evalAsync({ sqUpload });
+        sqDownload->evalAsync({ sqCompute });
+
+        sqDownload->evalAwait();
+        sqCompute->evalAwait();
+        sqUpload->evalAwait();
+
+        EXPECT_EQ(tensorOutput->vector(),
+                  std::vector<float>({ 2 * (float)i, 4, 12 }));
+    }
+}
+
+TEST(TestAsyncOperations, TestSchedulerDistributesSequences)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::Scheduler> scheduler = mgr.scheduler(2);
+    EXPECT_GE(scheduler->queueCount(), 1);
+
+    uint32_t total = 16;
+
+    std::vector<std::shared_ptr<kp::TensorT<float>>> tensorsIn;
+    std::vector<std::shared_ptr<kp::TensorT<float>>> tensorsOut;
+    std::vector<std::shared_ptr<kp::Sequence>> sequences;
+    for (uint32_t i = 0; i < total; i++) {
+        tensorsIn.push_back(mgr.tensor({ (float)i, (float)i, (float)i }));
+        tensorsOut.push_back(mgr.tensor({ 0, 0, 0 }));
+        // The sequences are only recorded, the scheduler submits them
+        sequences.push_back(
+          mgr.sequence()
+            ->record<kp::OpTensorSyncDevice>({ tensorsIn[i] })
+            ->record<kp::OpTensorCopy>({ tensorsIn[i], tensorsOut[i] })
+            ->record<kp::OpTensorSyncLocal>({ tensorsOut[i] }));
+    }
+
+    std::atomic<uint32_t> completedCallbacks(0);
+    std::vector<std::future<std::shared_ptr<kp::Sequence>>> futures;
+    for (uint32_t i = 0; i < total; i++) {
+        if (i % 2) {
+            scheduler->submit(sequences[i], [&](std::exception_ptr exception) {
+                EXPECT_FALSE(exception);
+                completedCallbacks++;
+            });
+        } else {
+            futures.push_back(scheduler->submit(sequences[i]));
+        }
+    }
+
+    for (std::future<std::shared_ptr<kp::Sequence>>& future : futures) {
+        EXPECT_FALSE(future.get()->isRunning());
+    }
+    scheduler->await();
+
+    EXPECT_EQ(completedCallbacks, total / 2);
+    EXPECT_EQ(scheduler->outstandingCount(), 0);
+
+    std::vector<uint64_t> completedCounts = scheduler->completedCounts();
+    EXPECT_EQ(completedCounts.size(), scheduler->queueCount());
+    EXPECT_EQ(std::accumulate(completedCounts.begin(), completedCounts.end(),
+                              uint64_t(0)),
+              total);
+
+    for (uint32_t i = 0; i < total; i++) {
+        EXPECT_EQ(tensorsOut[i]->vector(),
+                  std::vector<float>({ (float)i, (float)i, (float)i }));
+    }
+}
+
+TEST(TestAsyncOperations, TestStreamPipelineChunks)
+{
+    kp::Manager mgr;
+
+    std::string shader(R"(
+        #version 450
+
+        layout (local_size_x = 1) in;
+
+        layout(set = 0, binding = 0) buffer tensorIn { float valuesIn[]; };
+        layout(set = 0, binding = 1) buffer tensorOut { float valuesOut[]; };
+
+        void main()
+        {
+            uint index = gl_GlobalInvocationID.x;
+            valuesOut[index] = valuesIn[index] * 2.0;
+        }
+    )");
+
+    std::shared_ptr<kp::StreamPipeline> pipeline =
+      mgr.streamPipeline<float>(compileSource(shader), 4);
+    EXPECT_EQ(pipeline->depth(), 3);
+    EXPECT_EQ(pipeline->chunkSize(), 4);
+
+    // Ten elements are streamed in chunks of four, the last one partial
+    std::vector<float> input(10);
+    std::iota(input.begin(), input.end(), 0);
+    std::vector<float> output;
+    std::vector<uint64_t> sinkChunks;
+
+    uint64_t chunks = pipeline->run(
+      [&](uint64_t chunk,
+          const std::vector<std::shared_ptr<kp::Tensor>>& inputs) {
+          uint64_t offset = chunk * 4;
+          if (offset >= input.size()) {
+              return uint64_t(0);
+          }
+          uint64_t count = std::min<uint64_t>(4, input.size() - offset);
+          memcpy(inputs[0]->rawData(),
+                 input.data() + offset,
+                 count * sizeof(float));
+          return count;
+      },
+      [&](uint64_t chunk,
+          const std::vector<std::shared_ptr<kp::Tensor>>& outputs,
+          uint64_t count) {
+          sinkChunks.push_back(chunk);
+          float* data = outputs[0]->data<float>();
+          output.insert(output.end(), data, data + count);
+      });
+
+    EXPECT_EQ(chunks, 3);
+    EXPECT_EQ(sinkChunks, std::vector<uint64_t>({ 0, 1, 2 }));
+    EXPECT_EQ(output,
+              std::vector<float>({ 0, 2, 4, 6, 8, 10, 12, 14, 16, 18 }));
+
+    // A failing sink is rethrown once the chunks in flight completed
+    EXPECT_THROW(pipeline->run(
+                   [&](uint64_t chunk,
+                       const std::vector<std::shared_ptr<kp::Tensor>>&) {
+                       return chunk < 5 ? uint64_t(4) : uint64_t(0);
+                   },
+                   [&](uint64_t,
+                       const std::vector<std::shared_ptr<kp::Tensor>>&,
+                       uint64_t) { throw std::runtime_error("sink failed"); }),
+                 std::runtime_error);
+}
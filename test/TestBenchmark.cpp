@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+#include "kompute_test/Shader.hpp"
+
+TEST(TestBenchmark, RunTimesLabelledOperations)
+{
+    std::shared_ptr<kp::Manager> mgr = std::make_shared<kp::Manager>();
+
+    std::shared_ptr<kp::Tensor> tensorA = mgr->tensor({ 0, 0, 0 });
+
+    std::string shader(R"(
+      #version 450
+      layout (local_size_x = 1) in;
+      layout(set = 0, binding = 0) buffer a { float pa[]; };
+      void main() {
+          uint index = gl_GlobalInvocationID.x;
+          pa[index] = pa[index] + 1;
+      })");
+
+    std::vector<uint32_t> spirv = compileSource(shader);
+
+    std::shared_ptr<kp::Sequence> seq = mgr->sequence(0, 3);
+    seq->record<kp::OpTensorSyncDevice>({ tensorA })
+      ->record(std::make_shared<kp::OpAlgoDispatch>(
+                 mgr->algorithm({ tensorA }, spirv)),
+               "increment")
+      ->record<kp::OpTensorSyncLocal>({ tensorA });
+
+    kp::Benchmark benchmark(mgr, 2, 5);
+    benchmark.setPeak(1000, 0);
+
+    kp::Benchmark::Result result = benchmark.run(seq, 3, 24, "increment");
+    EXPECT_EQ(result.label, "increment");
+    EXPECT_EQ(result.repetitions, 5);
+    EXPECT_LE(result.minNs, result.medianNs);
+    EXPECT_LE(result.medianNs, result.maxNs);
+    EXPECT_GE(result.stddevNs, 0);
+    EXPECT_GE(result.gflops, 0);
+    EXPECT_EQ(result.peakGflopsFraction, result.gflops / 1000);
+    EXPECT_EQ(result.peakGbpsFraction, 0);
+
+    // Every warmup and repetition evaluates the sequence
+    EXPECT_EQ(tensorA->vector<float>(), std::vector<float>({ 7, 7, 7 }));
+
+    EXPECT_THROW(benchmark.run(seq, 0, 0, "missing"), std::runtime_error);
+    EXPECT_THROW(benchmark.run(mgr->sequence()), std::runtime_error);
+}
+
+TEST(TestBenchmark, RunHostAndPeakBandwidth)
+{
+    std::shared_ptr<kp::Manager> mgr = std::make_shared<kp::Manager>();
+
+    kp::Benchmark benchmark(mgr, 1, 4);
+
+    uint32_t calls = 0;
+    kp::Benchmark::Result host =
+      benchmark.runHost([&calls]() { calls++; }, 10, 10);
+    EXPECT_EQ(calls, 5);
+    EXPECT_EQ(host.label, "host");
+    EXPECT_EQ(host.repetitions, 4);
+
+    double gbps = benchmark.measurePeakBandwidth(1024 * 1024);
+    EXPECT_GT(gbps, 0);
+    EXPECT_EQ(benchmark.peakGbps(), gbps);
+
+    EXPECT_THROW(kp::Benchmark(mgr, 1, 0), std::runtime_error);
+}
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+#include "kompute_test/Shader.hpp"
+
+TEST(TestBlock, BlockRecordedIntoMultipleSequences)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 0, 0, 0 });
+    std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor({ 0, 0, 0 });
+
+    std::string shader(R"(
+      #version 450
+      layout (local_size_x = 1) in;
+      layout(set = 0, binding = 0) buffer a { float pa[]; };
+      void main() {
+          uint index = gl_GlobalInvocationID.x;
+          pa[index] = pa[index] + 1;
+      })");
+
+    std::vector<uint32_t> spirv = compileSource(shader);
+
+    // Two dependent dispatches recorded once
+    std::shared_ptr<kp::Block> block =
+      mgr.block()
+        ->record<kp::OpAlgoDispatch>(mgr.algorithm({ tensorA }, spirv))
+        ->record<kp::OpAlgoDispatch>(mgr.algorithm({ tensorA }, spirv));
+
+    EXPECT_EQ(block->operationCount(), 2);
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorA })
+      ->record(block)
+      ->record(block)
+      ->record<kp::OpTensorCopy>({ tensorA, tensorB })
+      ->record<kp::OpTensorSyncLocal>({ tensorA, tensorB })
+      ->eval();
+
+    EXPECT_FALSE(block->isRecording());
+    EXPECT_EQ(tensorA->vector(), std::vector<float>({ 4, 4, 4 }));
+    EXPECT_EQ(tensorB->vector(), std::vector<float>({ 4, 4, 4 }));
+
+    // The same block is reused without recording its operations again
+    std::shared_ptr<kp::Sequence> sq =
+      mgr.sequence()->record(block)->record<kp::OpTensorSyncLocal>(
+        { tensorA });
+    sq->eval();
+    sq->eval();
+
+    EXPECT_EQ(tensorA->vector(), std::vector<float>({ 8, 8, 8 }));
+}
+
+TEST(TestBlock, BlockRecordedFromSeparateThreads)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensorInA = mgr.tensor({ 1, 2, 3 });
+    std::shared_ptr<kp::TensorT<float>> tensorInB = mgr.tensor({ 4, 5, 6 });
+    std::shared_ptr<kp::TensorT<float>> tensorOutA = mgr.tensor({ 0, 0, 0 });
+    std::shared_ptr<kp::TensorT<float>> tensorOutB = mgr.tensor({ 0, 0, 0 });
+
+    std::shared_ptr<kp::Block> blockA = mgr.block();
+    std::shared_ptr<kp::Block> blockB = mgr.block();
+
+    // Each block owns its command pool so they can be recorded in parallel
+    std::thread threadA([&]() {
+        blockA->record<kp::OpTensorSyncDevice>({ tensorInA })
+          ->record<kp::OpTensorCopy>({ tensorInA, tensorOutA })
+          ->record<kp::OpTensorSyncLocal>({ tensorOutA })
+          ->end();
+    });
+    std::thread threadB([&]() {
+        blockB->record<kp::OpTensorSyncDevice>({ tensorInB })
+          ->record<kp::OpTensorCopy>({ tensorInB, tensorOutB })
+          ->record<kp::OpTensorSyncLocal>({ tensorOutB })
+          ->end();
+    });
+    threadA.join();
+    threadB.join();
+
+    mgr.sequence()->record(blockA)->record(blockB)->eval();
+
+    EXPECT_EQ(tensorOutA->vector(), std::vector<float>({ 1, 2, 3 }));
+    EXPECT_EQ(tensorOutB->vector(), std::vector<float>({ 4, 5, 6 }));
+}
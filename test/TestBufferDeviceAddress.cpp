@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+#include "kompute_test/Shader.hpp"
+
+TEST(TestBufferDeviceAddress, TestAlgorithmPassesTensorAddresses)
+{
+    kp::Manager mgr(0, {}, { VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME });
+
+    if (!mgr.hasBufferDeviceAddress()) {
+        GTEST_SKIP() << "Device has no buffer device addresses";
+    }
+
+    std::string shader(R"(
+      #version 450
+      #extension GL_EXT_buffer_reference : require
+      layout (local_size_x = 1) in;
+      layout(buffer_reference, std430, buffer_reference_align = 4)
+        buffer Values { float v[]; };
+      layout(push_constant) uniform PushConstants {
+        Values a;
+        Values b;
+        float scale;
+      } pcs;
+      void main() {
+          uint index = gl_GlobalInvocationID.x;
+          pcs.b.v[index] = pcs.a.v[index] * pcs.scale;
+      })");
+
+    std::vector<uint32_t> spirv = compileSource(shader);
+
+    std::shared_ptr<kp::TensorT<float>> tensorIn = mgr.tensor({ 1, 2, 3 });
+    std::shared_ptr<kp::TensorT<float>> tensorOut = mgr.tensor({ 0, 0, 0 });
+    std::shared_ptr<kp::TensorT<float>> otherIn = mgr.tensor({ 4, 5, 6 });
+    std::shared_ptr<kp::TensorT<float>> otherOut = mgr.tensor({ 0, 0, 0 });
+
+    EXPECT_NE(tensorIn->deviceAddress(), 0);
+    std::shared_ptr<kp::TensorT<float>> view = mgr.tensorView(otherIn, 1, 2);
+    EXPECT_EQ(view->deviceAddress(), otherIn->deviceAddress() + sizeof(float));
+
+    std::shared_ptr<kp::Algorithm> algo =
+      mgr.algorithm({ tensorIn, tensorOut },
+                    spirv,
+                    kp::Workgroup({ 3 }),
+                    {},
+                    { 2.0 },
+                    kp::Algorithm::BindingModes::eDeviceAddresses);
+    EXPECT_TRUE(algo->isInit());
+    EXPECT_EQ(algo->bindingMode(),
+              kp::Algorithm::BindingModes::eDeviceAddresses);
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>(
+        { tensorIn, tensorOut, otherIn, otherOut })
+      ->record<kp::OpAlgoDispatch>(algo)
+      ->record<kp::OpTensorSyncLocal>({ tensorOut })
+      ->eval();
+
+    EXPECT_EQ(tensorOut->vector(), std::vector<float>({ 2, 4, 6 }));
+
+    // Rebinding only changes the addresses pushed with the push constants
+    algo->setTensors({ otherIn, otherOut });
+    mgr.sequence()
+      ->record<kp::OpAlgoDispatch>(algo, std::vector<float>{ 3.0 })
+      ->record<kp::OpTensorSyncLocal>({ otherOut })
+      ->eval();
+
+    EXPECT_EQ(otherOut->vector(), std::vector<float>({ 12, 15, 18 }));
+}
+
+TEST(TestBufferDeviceAddress, TestRequiresExtension)
+{
+    kp::Manager mgr;
+
+    EXPECT_FALSE(mgr.hasBufferDeviceAddress());
+
+    std::shared_ptr<kp::TensorT<float>> tensor = mgr.tensor({ 1, 2, 3 });
+    EXPECT_THROW(tensor->deviceAddress(), std::runtime_error);
+}
+
+TEST(TestBufferDeviceAddress, TestAddressesExceedDevicePushConstants)
+{
+    kp::Manager mgr(0, {}, { VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME });
+
+    if (!mgr.hasBufferDeviceAddress()) {
+        GTEST_SKIP() << "Device has no buffer device addresses";
+    }
+
+    std::string shader(R"(
+      #version 450
+      #extension GL_EXT_buffer_reference : require
+      layout (local_size_x = 1) in;
+      layout(buffer_reference, std430, buffer_reference_align = 4)
+        buffer Values { float v[]; };
+      layout(push_constant) uniform PushConstants { Values a; } pcs;
+      void main() {
+          pcs.a.v[gl_GlobalInvocationID.x] = 1.0;
+      })");
+
+    // One address more than the limit of the device allows, which may be
+    // lower than KOMPUTE_MAX_PUSH_CONSTANTS_SIZE
+    uint32_t maxPushConstantsSize =
+      std::min<uint32_t>(mgr.getDeviceProperties().limits.maxPushConstantsSize,
+                         KOMPUTE_MAX_PUSH_CONSTANTS_SIZE);
+    std::vector<std::shared_ptr<kp::Tensor>> tensors;
+    for (uint32_t i = 0; i <= maxPushConstantsSize / 8; i++) {
+        tensors.push_back(mgr.tensor({ 0 }));
+    }
+
+    EXPECT_THROW(mgr.algorithm(tensors,
+                               compileSource(shader),
+                               kp::Workgroup({ 1 }),
+                               {},
+                               {},
+                               kp::Algorithm::BindingModes::eDeviceAddresses),
+                 std::runtime_error);
+}
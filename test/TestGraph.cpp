@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+#include "kompute_test/Shader.hpp"
+
+TEST(TestGraph, DependenciesFromTensors)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 1, 2, 3 });
+    std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor({ 0, 0, 0 });
+    std::shared_ptr<kp::TensorT<float>> tensorC = mgr.tensor({ 0, 0, 0 });
+
+    std::shared_ptr<kp::Graph> graph = mgr.graph();
+
+    EXPECT_EQ(graph->add(std::make_shared<kp::OpTensorSyncDevice>(
+                std::vector<std::shared_ptr<kp::Tensor>>{ tensorA })),
+              0);
+    graph->add(std::make_shared<kp::OpTensorCopy>(
+                 std::vector<std::shared_ptr<kp::Tensor>>{ tensorA, tensorB }),
+               { tensorA },
+               { tensorB });
+    graph->add(std::make_shared<kp::OpTensorCopy>(
+                 std::vector<std::shared_ptr<kp::Tensor>>{ tensorA, tensorC }),
+               { tensorA },
+               { tensorC });
+    // Writing the input of the copies has to wait for both of them
+    graph->add(std::make_shared<kp::OpTensorSyncDevice>(
+      std::vector<std::shared_ptr<kp::Tensor>>{ tensorA }));
+
+    EXPECT_EQ(graph->operationCount(), 4);
+    EXPECT_EQ(graph->dependencies(0), std::vector<uint32_t>());
+    EXPECT_EQ(graph->dependencies(1), std::vector<uint32_t>({ 0 }));
+    EXPECT_EQ(graph->dependencies(2), std::vector<uint32_t>({ 0 }));
+    EXPECT_EQ(graph->dependencies(3), std::vector<uint32_t>({ 0, 1, 2 }));
+    EXPECT_THROW(graph->dependencies(4), std::runtime_error);
+}
+
+TEST(TestGraph, RunReusesCompiledSequences)
+{
+    kp::Manager mgr;
+
+    std::string shader(R"(
+        #version 450
+
+        layout (local_size_x = 1) in;
+
+        layout(set = 0, binding = 0) buffer tensorIn { float valuesIn[]; };
+        layout(set = 0, binding = 1) buffer tensorOut { float valuesOut[]; };
+
+        void main()
+        {
+            uint index = gl_GlobalInvocationID.x;
+            valuesOut[index] = valuesIn[index] * 2.0;
+        }
+    )");
+    std::vector<uint32_t> spirv = compileSource(shader);
+
+    std::shared_ptr<kp::TensorT<float>> tensorIn = mgr.tensor({ 1, 2, 3 });
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 0, 0, 0 });
+    std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor({ 0, 0, 0 });
+    std::shared_ptr<kp::TensorT<float>> tensorOut = mgr.tensor({ 0, 0, 0 });
+
+    std::shared_ptr<kp::Graph> graph = mgr.graph();
+
+    graph->add(std::make_shared<kp::OpTensorSyncDevice>(
+                 std::vector<std::shared_ptr<kp::Tensor>>{ tensorIn }),
+               {},
+               { tensorIn });
+    // Two independent branches reading the input, joined by the last dispatch
+    graph->add(std::make_shared<kp::OpAlgoDispatch>(
+                 mgr.algorithm({ tensorIn, tensorA }, spirv)),
+               { tensorIn },
+               { tensorA });
+    graph->add(std::make_shared<kp::OpAlgoDispatch>(
+                 mgr.algorithm({ tensorIn, tensorB }, spirv)),
+               { tensorIn },
+               { tensorB });
+    graph->add(std::make_shared<kp::OpTensorCopy>(
+                 std::vector<std::shared_ptr<kp::Tensor>>{ tensorB,
+                                                           tensorOut }),
+               { tensorA, tensorB },
+               { tensorOut });
+    graph->add(std::make_shared<kp::OpTensorSyncLocal>(
+                 std::vector<std::shared_ptr<kp::Tensor>>{ tensorA,
+                                                           tensorOut }),
+               { tensorA, tensorOut },
+               {});
+
+    EXPECT_FALSE(graph->isCompiled());
+    graph->run();
+    EXPECT_TRUE(graph->isCompiled());
+    EXPECT_GE(graph->sequenceCount(), 1);
+    EXPECT_EQ(tensorA->vector(), std::vector<float>({ 2, 4, 6 }));
+    EXPECT_EQ(tensorOut->vector(), std::vector<float>({ 2, 4, 6 }));
+
+    // The graph is replayed with new data without being recorded again
+    tensorIn->setData({ 3, 4, 5 });
+    graph->run();
+    EXPECT_EQ(graph->compileCount(), 1);
+    EXPECT_EQ(tensorA->vector(), std::vector<float>({ 6, 8, 10 }));
+    EXPECT_EQ(tensorOut->vector(), std::vector<float>({ 6, 8, 10 }));
+
+    // Adding an operation compiles the graph again on its next run
+    graph->add(std::make_shared<kp::OpTensorCopy>(
+                 std::vector<std::shared_ptr<kp::Tensor>>{ tensorIn,
+                                                           tensorA }),
+               { tensorIn },
+               { tensorA });
+    EXPECT_FALSE(graph->isCompiled());
+    graph->runAsync();
+    graph->await();
+    EXPECT_EQ(graph->compileCount(), 2);
+    EXPECT_EQ(graph->operationQueues().size(), 6);
+}
+
+TEST(TestGraph, InvalidOperations)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::Graph> graph = mgr.graph();
+
+    EXPECT_THROW(graph->add(nullptr, {}, {}), std::runtime_error);
+    EXPECT_THROW(graph->add(std::make_shared<kp::OpMemoryBarrier>(
+                   std::vector<std::shared_ptr<kp::Tensor>>{},
+                   vk::AccessFlagBits::eShaderWrite,
+                   vk::AccessFlagBits::eShaderRead,
+                   vk::PipelineStageFlagBits::eComputeShader,
+                   vk::PipelineStageFlagBits::eComputeShader)),
+                 std::runtime_error);
+    EXPECT_THROW(mgr.graph({ 100 }), std::runtime_error);
+}
@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+#include "kompute/Kompute.hpp"
+
+#include "kompute_test/Shader.hpp"
+
+TEST(TestHostAllocator, TracksAllocationsAndFrees)
+{
+    kp::HostAllocator hostAllocator;
+    const vk::AllocationCallbacks& callbacks =
+      hostAllocator.allocationCallbacks();
+
+    void* memory = callbacks.pfnAllocation(
+      callbacks.pUserData, 100, 64, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    ASSERT_NE(memory, nullptr);
+    EXPECT_EQ((size_t)memory % 64, 0);
+    std::memset(memory, 7, 100);
+
+    kp::HostAllocator::Stats stats = hostAllocator.stats();
+    EXPECT_EQ(stats.allocations, 1);
+    EXPECT_EQ(stats.liveBytes, 100);
+
+    // The reallocation keeps the content and counts as a new allocation
+    memory = callbacks.pfnReallocation(
+      callbacks.pUserData, memory, 200, 64, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    ASSERT_NE(memory, nullptr);
+    EXPECT_EQ(((uint8_t*)memory)[99], 7);
+
+    stats = hostAllocator.stats();
+    EXPECT_EQ(stats.allocations, 2);
+    EXPECT_EQ(stats.frees, 1);
+    EXPECT_EQ(stats.liveBytes, 200);
+    EXPECT_EQ(stats.peakBytes, 300);
+
+    callbacks.pfnFree(callbacks.pUserData, memory);
+    stats = hostAllocator.stats();
+    EXPECT_EQ(stats.liveBytes, 0);
+    EXPECT_EQ(stats.totalBytes, 300);
+
+    hostAllocator.resetStats();
+    stats = hostAllocator.stats();
+    EXPECT_EQ(stats.allocations, 0);
+    EXPECT_EQ(stats.peakBytes, 0);
+}
+
+TEST(TestHostAllocator, ArenaServesCommandScope)
+{
+    kp::HostAllocator hostAllocator(1024);
+    const vk::AllocationCallbacks& callbacks =
+      hostAllocator.allocationCallbacks();
+
+    void* first = callbacks.pfnAllocation(
+      callbacks.pUserData, 100, 16, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    void* second = callbacks.pfnAllocation(
+      callbacks.pUserData, 100, 16, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    void* object = callbacks.pfnAllocation(
+      callbacks.pUserData, 100, 16, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    EXPECT_EQ(hostAllocator.stats().arenaAllocations, 2);
+    EXPECT_GT((uint8_t*)second, (uint8_t*)first);
+
+    // Larger than the arena, so served by the heap
+    void* large = callbacks.pfnAllocation(
+      callbacks.pUserData, 2048, 16, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    ASSERT_NE(large, nullptr);
+    EXPECT_EQ(hostAllocator.stats().arenaAllocations, 2);
+
+    callbacks.pfnFree(callbacks.pUserData, first);
+    callbacks.pfnFree(callbacks.pUserData, second);
+    callbacks.pfnFree(callbacks.pUserData, large);
+
+    // The arena is rewound once all its allocations are freed
+    void* third = callbacks.pfnAllocation(
+      callbacks.pUserData, 100, 16, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    EXPECT_EQ(third, first);
+
+    callbacks.pfnFree(callbacks.pUserData, third);
+    callbacks.pfnFree(callbacks.pUserData, object);
+    EXPECT_EQ(hostAllocator.stats().liveBytes, 0);
+}
+
+TEST(TestHostAllocator, ManagerObjectsUseCallbacks)
+{
+    std::shared_ptr<kp::HostAllocator> hostAllocator =
+      std::make_shared<kp::HostAllocator>(64 * 1024);
+
+    {
+        kp::Manager mgr(0, {}, {}, "", {}, hostAllocator);
+        EXPECT_EQ(mgr.hostAllocator(), hostAllocator);
+
+        std::shared_ptr<kp::TensorT<float>> tensorA =
+          mgr.tensor({ 0, 1, 2 });
+
+        std::string shader(R"(
+          #version 450
+          layout (local_size_x = 1) in;
+          layout(set = 0, binding = 0) buffer a { float pa[]; };
+          void main() {
+              uint index = gl_GlobalInvocationID.x;
+              pa[index] = pa[index] + 1;
+          })");
+
+        // Measures the host allocations of creating and running an algorithm
+        hostAllocator->resetStats();
+
+        mgr.sequence()
+          ->record<kp::OpTensorSyncDevice>({ tensorA })
+          ->record<kp::OpAlgoDispatch>(
+            mgr.algorithm({ tensorA }, compileSource(shader)))
+          ->record<kp::OpTensorSyncLocal>({ tensorA })
+          ->eval();
+
+        EXPECT_EQ(tensorA->vector(), std::vector<float>({ 1, 2, 3 }));
+
+        kp::HostAllocator::Stats stats = hostAllocator->stats();
+        EXPECT_GE(stats.allocations, stats.arenaAllocations);
+        EXPECT_GE(stats.peakBytes, stats.liveBytes);
+    }
+
+    // Every object created with the callbacks was destroyed with them
+    EXPECT_EQ(hostAllocator->stats().liveBytes, 0);
+}
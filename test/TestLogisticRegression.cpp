@@ -1,5 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
+#include <cmath>
+
 #include "gtest/gtest.h"
 
 #include "kompute/Kompute.hpp"
@@ -162,3 +164,88 @@ TEST(TestLogisticRegression, TestMainLogisticRegressionManualCopy)
                     bIn->data()[0]);
     }
 }
+
+TEST(TestLogisticRegression, TestOpLogisticRegression)
+{
+    uint32_t EPOCHS = 100;
+    float learningRate = 0.1;
+
+    kp::Manager mgr;
+
+    // Five samples of two features stored row by row
+    std::vector<float> samples = { 0, 0, 1, 0, 1, 0, 1, 1, 1, 1 };
+    std::vector<float> labels = { 0, 0, 0, 1, 1 };
+
+    std::shared_ptr<kp::TensorT<float>> x = mgr.tensor(samples);
+    std::shared_ptr<kp::TensorT<float>> y = mgr.tensor(labels);
+    std::shared_ptr<kp::TensorT<float>> w = mgr.tensor({ 0.001, 0.001 });
+    std::shared_ptr<kp::TensorT<float>> b = mgr.tensor({ 0 });
+    std::shared_ptr<kp::TensorT<float>> loss = mgr.tensor({ 0 });
+
+    std::vector<std::shared_ptr<kp::Tensor>> params = { x, y, w, b, loss };
+
+    // Every epoch runs on the device and only the results are read back
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>(params)
+      ->record<kp::OpLogisticRegression>(
+        params, mgr.algorithm(), EPOCHS, learningRate)
+      ->record<kp::OpTensorSyncLocal>({ w, b, loss })
+      ->eval();
+
+    // Full batch gradient descent on the host
+    std::vector<double> weights = { 0.001, 0.001 };
+    double bias = 0;
+    double expectedLoss = 0;
+    for (uint32_t epoch = 0; epoch < EPOCHS; epoch++) {
+        std::vector<double> gradients = { 0, 0 };
+        double gradientBias = 0;
+        expectedLoss = 0;
+        for (size_t i = 0; i < labels.size(); i++) {
+            double z = weights[0] * samples[2 * i] +
+                       weights[1] * samples[2 * i + 1] + bias;
+            double yHat = 1.0 / (1.0 + std::exp(-z));
+            double dZ = yHat - labels[i];
+            gradients[0] += dZ * samples[2 * i];
+            gradients[1] += dZ * samples[2 * i + 1];
+            gradientBias += dZ;
+            expectedLoss -= labels[i] * std::log(yHat) +
+                            (1 - labels[i]) * std::log(1 - yHat);
+        }
+        expectedLoss /= labels.size();
+        weights[0] -= learningRate * gradients[0] / labels.size();
+        weights[1] -= learningRate * gradients[1] / labels.size();
+        bias -= learningRate * gradientBias / labels.size();
+    }
+
+    EXPECT_NEAR(w->data()[0], weights[0], 1e-4);
+    EXPECT_NEAR(w->data()[1], weights[1], 1e-4);
+    EXPECT_NEAR(b->data()[0], bias, 1e-4);
+    EXPECT_NEAR(loss->data()[0], expectedLoss, 1e-4);
+
+    EXPECT_LT(w->data()[0], 0.01);
+    EXPECT_GT(w->data()[1], 1.0);
+    EXPECT_LT(b->data()[0], 0.0);
+}
+
+TEST(TestLogisticRegression, TestOpLogisticRegressionInvalidParameters)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> x =
+      mgr.tensor({ 0, 0, 1, 0, 1, 0, 1, 1, 1, 1 });
+    std::shared_ptr<kp::TensorT<float>> y = mgr.tensor({ 0, 0, 0, 1, 1 });
+    std::shared_ptr<kp::TensorT<float>> w = mgr.tensor({ 0, 0 });
+    std::shared_ptr<kp::TensorT<float>> w3 = mgr.tensor({ 0, 0, 0 });
+    std::shared_ptr<kp::TensorT<float>> b = mgr.tensor({ 0 });
+    std::shared_ptr<kp::TensorT<float>> loss = mgr.tensor({ 0 });
+
+    // Five samples of three features don't fit the samples tensor
+    EXPECT_THROW(
+      kp::OpLogisticRegression({ x, y, w3, b, loss }, mgr.algorithm(), 10),
+      std::runtime_error);
+    EXPECT_THROW(
+      kp::OpLogisticRegression({ x, y, w, b, loss }, mgr.algorithm(), 0),
+      std::runtime_error);
+    EXPECT_THROW(kp::OpLogisticRegression({ x, y, w, b }, mgr.algorithm(), 10),
+                 std::runtime_error);
+}
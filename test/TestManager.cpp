@@ -1,9 +1,16 @@
 // SPDX-License-Identifier: Apache-2.0
 
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
 #include "gtest/gtest.h"
 
 #include "kompute/Kompute.hpp"
 
+#include "kompute_test/Shader.hpp"
+
 TEST(TestManager, EndToEndOpMultEvalFlow)
 {
     kp::Manager mgr;
@@ -64,6 +71,58 @@ TEST(TestManager, TestMultipleSequences)
     EXPECT_EQ(tensorOutput->vector(), std::vector<float>({ 0, 4, 12 }));
 }
 
+TEST(TestManager, TestQueueRoles)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensorLHS = mgr.tensor({ 0, 1, 2 });
+    std::shared_ptr<kp::TensorT<float>> tensorRHS = mgr.tensor({ 2, 4, 6 });
+    std::shared_ptr<kp::TensorT<float>> tensorOutput = mgr.tensor({ 0, 0, 0 });
+
+    std::vector<std::shared_ptr<kp::Tensor>> params = { tensorLHS,
+                                                        tensorRHS,
+                                                        tensorOutput };
+
+    // The roles fall back to the compute queue on devices without dedicated
+    // queue families, so the sequences run on every device
+    mgr.sequence(kp::Manager::QueueRole::eTransfer)
+      ->eval<kp::OpTensorSyncDevice>(params);
+    mgr.sequence(kp::Manager::QueueRole::eAsyncCompute)
+      ->eval<kp::OpMult>(params, mgr.algorithm());
+    mgr.sequence(kp::Manager::QueueRole::eTransfer)
+      ->eval<kp::OpTensorSyncLocal>(params);
+
+    EXPECT_EQ(tensorOutput->vector(), std::vector<float>({ 0, 4, 12 }));
+    EXPECT_EQ(mgr.queueIndex(kp::Manager::QueueRole::eCompute), 0);
+}
+
+TEST(TestManager, TestQueuePriorities)
+{
+    // The global priority is dropped when the device does not support it or
+    // the process is not permitted it, so the sequence runs on every device
+    kp::Manager mgr(
+      0, { 0 }, {}, "", { { 0.5f, vk::QueueGlobalPriorityEXT::eHigh } });
+
+    EXPECT_EQ(mgr.queuePriority(0).priority, 0.5f);
+    EXPECT_EQ(mgr.queueIndex(kp::Manager::QueueRole::eHighPriority), 0);
+
+    std::shared_ptr<kp::TensorT<float>> tensorLHS = mgr.tensor({ 0, 1, 2 });
+    std::shared_ptr<kp::TensorT<float>> tensorRHS = mgr.tensor({ 2, 4, 6 });
+    std::shared_ptr<kp::TensorT<float>> tensorOutput = mgr.tensor({ 0, 0, 0 });
+
+    std::vector<std::shared_ptr<kp::Tensor>> params = { tensorLHS,
+                                                        tensorRHS,
+                                                        tensorOutput };
+
+    mgr.sequence(kp::Manager::QueueRole::eHighPriority)
+      ->record<kp::OpTensorSyncDevice>(params)
+      ->record<kp::OpMult>(params, mgr.algorithm())
+      ->record<kp::OpTensorSyncLocal>(params)
+      ->eval();
+
+    EXPECT_EQ(tensorOutput->vector(), std::vector<float>({ 0, 4, 12 }));
+}
+
 TEST(TestManager, TestDeviceProperties)
 {
     kp::Manager mgr;
@@ -79,6 +138,30 @@ TEST(TestManager, TestListDevices)
     EXPECT_GT(devices[0].getProperties().deviceName.size(), 0);
 }
 
+TEST(TestManager, TestManagersShareInstance)
+{
+    {
+        kp::Manager mgrA;
+        kp::Manager mgrB;
+
+        // Both managers enumerate the devices of the same instance
+        EXPECT_EQ(mgrA.listDevices()[0], mgrB.listDevices()[0]);
+        EXPECT_EQ(mgrA.getDeviceProperties().deviceID,
+                  mgrB.getDeviceProperties().deviceID);
+
+        mgrA.destroy();
+
+        // The instance is kept alive by the remaining manager
+        std::shared_ptr<kp::TensorT<float>> tensor = mgrB.tensor({ 1, 2, 3 });
+        mgrB.sequence()->eval<kp::OpTensorSyncLocal>({ tensor });
+        EXPECT_EQ(tensor->vector(), std::vector<float>({ 1, 2, 3 }));
+    }
+
+    // A new instance is created once the last manager was destroyed
+    kp::Manager mgr;
+    EXPECT_GT(mgr.getDeviceProperties().deviceName.size(), 0);
+}
+
 TEST(TestManager, TestClearDestroy)
 {
     kp::Manager mgr;
@@ -104,3 +187,347 @@ TEST(TestManager, TestClearDestroy)
 
     mgr.destroy();
 }
+
+TEST(TestManager, TestPersistentPipelineCache)
+{
+    std::string path = "test_pipeline_cache.bin";
+    std::remove(path.c_str());
+
+    {
+        // A missing file starts with an empty cache
+        kp::Manager mgr(0, {}, {}, path);
+
+        std::shared_ptr<kp::TensorT<float>> tensorLHS = mgr.tensor({ 0, 1, 2 });
+        std::shared_ptr<kp::TensorT<float>> tensorRHS = mgr.tensor({ 2, 4, 6 });
+        std::shared_ptr<kp::TensorT<float>> tensorOutput = mgr.tensor({ 0, 0, 0 });
+
+        mgr.sequence()
+          ->record<kp::OpTensorSyncDevice>({ tensorLHS, tensorRHS })
+          ->record<kp::OpMult>({ tensorLHS, tensorRHS, tensorOutput },
+                               mgr.algorithm())
+          ->record<kp::OpTensorSyncLocal>({ tensorOutput })
+          ->eval();
+
+        EXPECT_EQ(tensorOutput->vector(), std::vector<float>({ 0, 4, 12 }));
+
+        mgr.savePipelineCache(path);
+    }
+
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        EXPECT_GT(file.tellg(), 0);
+    }
+
+    {
+        // Pipelines are created from the preloaded cache
+        kp::Manager mgr(0, {}, {}, path);
+
+        std::shared_ptr<kp::TensorT<float>> tensorLHS = mgr.tensor({ 1, 2, 3 });
+        std::shared_ptr<kp::TensorT<float>> tensorRHS = mgr.tensor({ 2, 4, 6 });
+        std::shared_ptr<kp::TensorT<float>> tensorOutput = mgr.tensor({ 0, 0, 0 });
+
+        mgr.sequence()
+          ->record<kp::OpTensorSyncDevice>({ tensorLHS, tensorRHS })
+          ->record<kp::OpMult>({ tensorLHS, tensorRHS, tensorOutput },
+                               mgr.algorithm())
+          ->record<kp::OpTensorSyncLocal>({ tensorOutput })
+          ->eval();
+
+        EXPECT_EQ(tensorOutput->vector(), std::vector<float>({ 2, 8, 18 }));
+    }
+
+    {
+        // Data that is not a pipeline cache of the device is discarded
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << "not a pipeline cache";
+    }
+
+    {
+        kp::Manager mgr(0, {}, {}, path);
+
+        std::shared_ptr<kp::TensorT<float>> tensorLHS = mgr.tensor({ 1, 1, 1 });
+        std::shared_ptr<kp::TensorT<float>> tensorRHS = mgr.tensor({ 3, 4, 5 });
+        std::shared_ptr<kp::TensorT<float>> tensorOutput = mgr.tensor({ 0, 0, 0 });
+
+        mgr.sequence()
+          ->record<kp::OpTensorSyncDevice>({ tensorLHS, tensorRHS })
+          ->record<kp::OpMult>({ tensorLHS, tensorRHS, tensorOutput },
+                               mgr.algorithm())
+          ->record<kp::OpTensorSyncLocal>({ tensorOutput })
+          ->eval();
+
+        EXPECT_EQ(tensorOutput->vector(), std::vector<float>({ 3, 4, 5 }));
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST(TestManager, TestAlgorithmsShareCachedPipelines)
+{
+    kp::Manager mgr;
+
+    std::string shader(R"(
+      #version 450
+      layout (constant_id = 0) const float cOne = 0;
+      layout (local_size_x = 1) in;
+      layout(set = 0, binding = 0) buffer a { float pa[]; };
+      void main() {
+          uint index = gl_GlobalInvocationID.x;
+          pa[index] = pa[index] + cOne;
+      })");
+
+    std::vector<uint32_t> spirv = compileSource(shader);
+
+    {
+        std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 0, 0, 0 });
+        std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor({ 1, 1, 1 });
+        std::shared_ptr<kp::TensorT<float>> tensorC = mgr.tensor({ 2, 2, 2 });
+
+        // Only the algorithm with other constants creates a pipeline
+        std::shared_ptr<kp::Algorithm> algoA =
+          mgr.algorithm({ tensorA }, spirv, {}, std::vector<float>({ 1 }));
+        std::shared_ptr<kp::Algorithm> algoB =
+          mgr.algorithm({ tensorB }, spirv, {}, std::vector<float>({ 1 }));
+        std::shared_ptr<kp::Algorithm> algoC =
+          mgr.algorithm({ tensorC }, spirv, {}, std::vector<float>({ 2 }));
+
+        EXPECT_EQ(mgr.shaderCache()->size(), 2);
+
+        mgr.sequence()
+          ->record<kp::OpTensorSyncDevice>({ tensorA, tensorB, tensorC })
+          ->record<kp::OpAlgoDispatch>(algoA)
+          ->record<kp::OpAlgoDispatch>(algoB)
+          ->record<kp::OpAlgoDispatch>(algoC)
+          ->record<kp::OpTensorSyncLocal>({ tensorA, tensorB, tensorC })
+          ->eval();
+
+        EXPECT_EQ(tensorA->vector(), std::vector<float>({ 1, 1, 1 }));
+        EXPECT_EQ(tensorB->vector(), std::vector<float>({ 2, 2, 2 }));
+        EXPECT_EQ(tensorC->vector(), std::vector<float>({ 4, 4, 4 }));
+
+        // Entries still in use are kept
+        algoC = nullptr;
+        mgr.clear();
+        EXPECT_EQ(mgr.shaderCache()->size(), 1);
+    }
+
+    mgr.clear();
+    EXPECT_EQ(mgr.shaderCache()->size(), 0);
+}
+
+TEST(TestManager, TestAlgorithmsShareDescriptorPools)
+{
+    kp::Manager mgr;
+
+    std::string shader(R"(
+      #version 450
+      layout (local_size_x = 1) in;
+      layout(set = 0, binding = 0) buffer a { float pa[]; };
+      layout(set = 0, binding = 1) buffer b { float pb[]; };
+      void main() {
+          uint index = gl_GlobalInvocationID.x;
+          pb[index] = pa[index] * 2;
+      })");
+
+    std::vector<uint32_t> spirv = compileSource(shader);
+
+    std::shared_ptr<kp::DescriptorAllocator> allocator =
+      mgr.descriptorAllocator();
+
+    {
+        std::vector<std::shared_ptr<kp::Tensor>> tensors;
+        std::vector<std::shared_ptr<kp::Algorithm>> algorithms;
+        for (uint32_t i = 0; i < 16; i++) {
+            tensors.push_back(mgr.tensor({ float(i), float(i) }));
+            tensors.push_back(mgr.tensor({ 0, 0 }));
+            algorithms.push_back(
+              mgr.algorithm({ tensors[2 * i], tensors[2 * i + 1] }, spirv));
+        }
+
+        EXPECT_EQ(allocator->poolCount(), 1);
+        EXPECT_EQ(allocator->allocatedSetCount(), 16);
+
+        std::shared_ptr<kp::Sequence> sq =
+          mgr.sequence()->record<kp::OpTensorSyncDevice>(tensors);
+        for (const std::shared_ptr<kp::Algorithm>& algorithm : algorithms) {
+            sq->record<kp::OpAlgoDispatch>(algorithm);
+        }
+        sq->record<kp::OpTensorSyncLocal>(tensors)->eval();
+
+        for (uint32_t i = 0; i < 16; i++) {
+            EXPECT_EQ(tensors[2 * i + 1]->vector<float>(),
+                      std::vector<float>({ 2.0f * i, 2.0f * i }));
+        }
+    }
+
+    // The sets of destroyed algorithms are reused by the new ones
+    EXPECT_EQ(allocator->allocatedSetCount(), 0);
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 1, 2 });
+    std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor({ 0, 0 });
+    std::shared_ptr<kp::Algorithm> algorithm =
+      mgr.algorithm({ tensorA, tensorB }, spirv);
+
+    EXPECT_EQ(allocator->poolCount(), 1);
+    EXPECT_EQ(allocator->allocatedSetCount(), 1);
+}
+
+TEST(TestManager, TestSelectDeviceByRequirements)
+{
+    kp::Manager::DeviceRequirements requirements;
+    kp::Manager mgr(requirements);
+
+    std::vector<vk::PhysicalDevice> devices = mgr.listDevices();
+    uint32_t selected = mgr.selectDevice(requirements);
+    EXPECT_LT(selected, devices.size());
+    EXPECT_EQ(mgr.getDeviceProperties().deviceID,
+              devices[selected].getProperties().deviceID);
+
+    // No other device scores higher than the selected one
+    int64_t selectedScore =
+      kp::Manager::scoreDevice(devices[selected], requirements);
+    EXPECT_GE(selectedScore, 0);
+    for (const vk::PhysicalDevice& device : devices) {
+        EXPECT_LE(kp::Manager::scoreDevice(device, requirements),
+                  selectedScore);
+    }
+
+    kp::Manager::DeviceRequirements missingExtension;
+    missingExtension.extensions = { "VK_KP_missing_extension" };
+    EXPECT_EQ(kp::Manager::scoreDevice(devices[selected], missingExtension),
+              -1);
+    EXPECT_THROW(mgr.selectDevice(missingExtension), std::runtime_error);
+
+    kp::Manager::DeviceRequirements largeSubgroups;
+    largeSubgroups.minSubgroupSize = 1u << 20;
+    EXPECT_THROW(mgr.selectDevice(largeSubgroups), std::runtime_error);
+}
+
+TEST(TestManager, TestConcurrentResourceCreation)
+{
+    kp::Manager mgr;
+
+    uint32_t threadCount = 8;
+    uint32_t iterations = 32;
+
+    std::atomic<bool> creating(true);
+    std::atomic<uint32_t> mismatches(0);
+
+    // Threads create and submit their resources while clear() runs alongside
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < threadCount; t++) {
+        threads.push_back(std::thread([&, t]() {
+            for (uint32_t i = 0; i < iterations; i++) {
+                float value = t * iterations + i;
+                std::shared_ptr<kp::TensorT<float>> tensorIn =
+                  mgr.tensor({ value, value });
+                std::shared_ptr<kp::TensorT<float>> tensorOut =
+                  mgr.tensor({ 0, 0 });
+                mgr.sequence()
+                  ->record<kp::OpTensorSyncDevice>({ tensorIn })
+                  ->record<kp::OpTensorCopy>({ tensorIn, tensorOut })
+                  ->eval<kp::OpTensorSyncLocal>({ tensorOut });
+                std::vector<float> expected({ value, value });
+                if (tensorOut->vector() != expected) {
+                    mismatches++;
+                }
+            }
+        }));
+    }
+    std::thread clearThread([&]() {
+        while (creating) {
+            mgr.clear();
+        }
+    });
+
+    std::vector<std::shared_ptr<kp::TensorT<float>>> kept;
+    for (uint32_t i = 0; i < iterations; i++) {
+        kept.push_back(mgr.tensor({ (float)i }));
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    creating = false;
+    clearThread.join();
+
+    EXPECT_EQ(mismatches, 0);
+
+    mgr.clear();
+    EXPECT_EQ(mgr.memoryStats().tensorCount, iterations);
+}
+
+TEST(TestManager, TestMetricsCountWork)
+{
+    kp::Manager mgr;
+
+    std::string shader(R"(
+      #version 450
+      layout (local_size_x = 1) in;
+      layout(set = 0, binding = 0) buffer a { float pa[]; };
+      void main() {
+          uint index = gl_GlobalInvocationID.x;
+          pa[index] = pa[index] + 1;
+      })");
+
+    std::vector<uint32_t> spirv = compileSource(shader);
+
+    std::shared_ptr<kp::Tensor> tensorA = mgr.tensor({ 1, 2, 3 });
+    std::shared_ptr<kp::Algorithm> algorithm =
+      mgr.algorithm({ tensorA }, spirv);
+
+    std::shared_ptr<kp::Sequence> sq = mgr.sequence();
+    sq->record<kp::OpTensorSyncDevice>({ tensorA })
+      ->record<kp::OpAlgoDispatch>(algorithm)
+      ->record<kp::OpTensorSyncLocal>({ tensorA })
+      ->eval();
+
+    EXPECT_EQ(tensorA->vector<float>(), std::vector<float>({ 2, 3, 4 }));
+
+    kp::Metrics::Snapshot metrics = mgr.metrics();
+    EXPECT_EQ(metrics.submissions, 1);
+    EXPECT_EQ(metrics.commandBuffersRecorded, 1);
+    EXPECT_GE(metrics.barriers, 2);
+    EXPECT_EQ(metrics.bytesUploaded, 3 * sizeof(float));
+    EXPECT_EQ(metrics.bytesDownloaded, 3 * sizeof(float));
+    EXPECT_EQ(metrics.pipelinesCreated, 1);
+    EXPECT_EQ(metrics.pipelineCacheHits, 0);
+    EXPECT_EQ(metrics.descriptorSetsAllocated, 1);
+    EXPECT_EQ(metrics.fenceWaits, 1);
+    EXPECT_EQ(metrics.tensorCount, 1);
+    EXPECT_EQ(metrics.algorithmCount, 1);
+    EXPECT_EQ(metrics.sequenceCount, 1);
+
+    // An algorithm rebuilt with the same shader reuses the cached pipeline
+    algorithm->rebuild({ tensorA }, spirv);
+    metrics = mgr.metrics();
+    EXPECT_EQ(metrics.pipelinesCreated, 1);
+    EXPECT_EQ(metrics.pipelineCacheHits, 1);
+    EXPECT_EQ(metrics.descriptorSetsAllocated, 2);
+
+    mgr.resetMetrics();
+    metrics = mgr.metrics();
+    EXPECT_EQ(metrics.submissions, 0);
+    EXPECT_EQ(metrics.pipelinesCreated, 0);
+    EXPECT_EQ(metrics.tensorCount, 1);
+}
+
+#if !KOMPUTE_ENABLE_SPDLOG && !defined(KOMPUTE_LOG_OVERRIDE)
+TEST(TestManager, TestLogLevelSkipsMessages)
+{
+    int level = kp::logLevel();
+    kp::setLogLevel(SPDLOG_LEVEL_OFF);
+
+    testing::internal::CaptureStdout();
+    {
+        kp::Manager mgr;
+        std::shared_ptr<kp::Tensor> tensor = mgr.tensor({ 1, 2, 3 });
+        mgr.sequence()->eval<kp::OpTensorSyncLocal>({ tensor });
+    }
+    std::string output = testing::internal::GetCapturedStdout();
+
+    kp::setLogLevel(level);
+
+    EXPECT_EQ(output, "");
+}
+#endif
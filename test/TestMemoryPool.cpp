@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+TEST(TestMemoryPool, ManyTensorsShareBlocks)
+{
+    kp::Manager mgr;
+
+    std::vector<std::shared_ptr<kp::TensorT<float>>> tensors;
+    for (uint32_t i = 0; i < 1000; i++) {
+        tensors.push_back(mgr.tensor({ (float)i, (float)i, (float)i }));
+    }
+
+    // Primary and staging memory types each only need a single block
+    EXPECT_LE(mgr.memoryPool()->blockCount(), 2);
+
+    mgr.sequence()->eval<kp::OpTensorSyncDevice>(
+      { tensors.begin(), tensors.end() });
+    for (const std::shared_ptr<kp::TensorT<float>>& tensor : tensors) {
+        tensor->setData({ 0, 0, 0 });
+    }
+    mgr.sequence()->eval<kp::OpTensorSyncLocal>(
+      { tensors.begin(), tensors.end() });
+
+    for (uint32_t i = 0; i < tensors.size(); i++) {
+        EXPECT_EQ(tensors[i]->vector(),
+                  std::vector<float>({ (float)i, (float)i, (float)i }));
+    }
+}
+
+TEST(TestMemoryPool, FreedRangesAreReused)
+{
+    kp::Manager mgr;
+
+    {
+        std::shared_ptr<kp::TensorT<float>> tensor =
+          mgr.tensor({ 1, 2, 3 });
+    }
+
+    uint32_t blockCount = mgr.memoryPool()->blockCount();
+    vk::DeviceSize allocatedSize = mgr.memoryPool()->allocatedSize();
+
+    for (uint32_t i = 0; i < 100; i++) {
+        std::shared_ptr<kp::TensorT<float>> tensor =
+          mgr.tensor({ 1, 2, 3 });
+        EXPECT_EQ(tensor->vector(), std::vector<float>({ 1, 2, 3 }));
+    }
+
+    EXPECT_EQ(mgr.memoryPool()->blockCount(), blockCount);
+    EXPECT_EQ(mgr.memoryPool()->allocatedSize(), allocatedSize);
+}
+
+TEST(TestMemoryPool, LargeTensorGetsDedicatedBlock)
+{
+    kp::Manager mgr;
+
+    // Anything above half a block is given its own block
+    uint32_t size = KOMPUTE_MEMORY_POOL_BLOCK_SIZE / sizeof(float) / 2 + 1;
+
+    {
+        std::shared_ptr<kp::TensorT<float>> tensor =
+          mgr.tensor(std::vector<float>(size, 1.0));
+
+        mgr.sequence()->eval<kp::OpTensorSyncDevice>({ tensor });
+        tensor->setData(std::vector<float>(size, 0.0));
+        mgr.sequence()->eval<kp::OpTensorSyncLocal>({ tensor });
+
+        EXPECT_EQ(tensor->data()[size - 1], 1.0);
+        EXPECT_EQ(mgr.memoryPool()->blockCount(), 2);
+    }
+
+    EXPECT_EQ(mgr.memoryPool()->blockCount(), 0);
+}
+
+TEST(TestMemoryPool, MemoryStatsAndDeviceLimit)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensor =
+      mgr.tensor(std::vector<float>(1024, 1.0));
+    std::shared_ptr<kp::TensorT<float>> view =
+      mgr.tensorView(tensor, 0, 256);
+
+    kp::Manager::MemoryStats stats = mgr.memoryStats();
+    EXPECT_EQ(stats.tensorCount, 1);
+    EXPECT_EQ(stats.viewCount, 1);
+    EXPECT_EQ(stats.primaryMemorySize, 1024 * sizeof(float));
+    EXPECT_EQ(stats.stagingMemorySize, 1024 * sizeof(float));
+
+    vk::DeviceSize allocated = 0;
+    vk::DeviceSize used = 0;
+    for (const kp::MemoryPool::HeapStats& heap : stats.heaps) {
+        EXPECT_LE(heap.used, heap.allocated);
+        EXPECT_LE(heap.budget, heap.size);
+        allocated += heap.allocated;
+        used += heap.used;
+    }
+    EXPECT_EQ(allocated, mgr.memoryPool()->allocatedSize());
+    EXPECT_GE(used, 2 * 1024 * sizeof(float));
+
+    // No new device local block fits, while the existing ones are reused
+    mgr.setDeviceMemoryLimit(1);
+    EXPECT_NO_THROW(mgr.tensor({ 1, 2, 3 }));
+    EXPECT_ANY_THROW(mgr.tensor(
+      std::vector<float>(KOMPUTE_MEMORY_POOL_BLOCK_SIZE / sizeof(float), 1.0)));
+
+    mgr.setDeviceMemoryLimit(0);
+    EXPECT_NO_THROW(mgr.tensor(
+      std::vector<float>(KOMPUTE_MEMORY_POOL_BLOCK_SIZE / sizeof(float), 1.0)));
+}
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+#include "kompute_test/Shader.hpp"
+
+TEST(TestMultiManager, TestShardRowsDispatchGather)
+{
+    // The same device is used twice, so the sharding runs on any machine
+    kp::MultiManager mgr({ 0, 0 });
+    EXPECT_EQ(mgr.deviceCount(), 2);
+
+    std::string shader(R"(
+        #version 450
+
+        layout (local_size_x = 1) in;
+
+        layout(set = 0, binding = 0) buffer tensorA { float valuesA[]; };
+        layout(set = 0, binding = 1) buffer tensorB { float valuesB[]; };
+
+        void main()
+        {
+            uint index = gl_GlobalInvocationID.x;
+            valuesA[index] = valuesA[index] * valuesB[0];
+        }
+    )");
+
+    // Five rows of two elements are split into three and two rows
+    std::shared_ptr<kp::ShardedTensor> tensorA =
+      mgr.shardRows<float>({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }, 2);
+    std::shared_ptr<kp::ShardedTensor> tensorB = mgr.replicate<float>({ 3 });
+
+    EXPECT_EQ(tensorA->shard(0)->size(), 6);
+    EXPECT_EQ(tensorA->shard(1)->size(), 4);
+    EXPECT_EQ(tensorA->shardOffset(1), 6);
+    EXPECT_EQ(tensorB->shard(1)->size(), 1);
+
+    std::vector<std::shared_ptr<kp::Algorithm>> algorithms =
+      mgr.algorithm({ tensorA, tensorB }, compileSource(shader));
+
+    mgr.syncDevice({ tensorA, tensorB });
+    mgr.dispatch(algorithms);
+
+    EXPECT_EQ(mgr.gather<float>(tensorA),
+              std::vector<float>({ 0, 3, 6, 9, 12, 15, 18, 21, 24, 27 }));
+}
+
+TEST(TestMultiManager, TestAllReduce)
+{
+    kp::MultiManager mgr({ 0, 0 });
+
+    std::shared_ptr<kp::ShardedTensor> tensor =
+      mgr.replicate<float>({ 1, 2, 3 });
+    tensor->shard(1)->setRawData(std::vector<float>({ 10, 20, 30 }).data());
+    mgr.syncDevice({ tensor });
+
+    mgr.allReduce<float>(tensor);
+
+    // The sum is on the devices as well as on the host
+    for (const std::shared_ptr<kp::Tensor>& shard : tensor->shards()) {
+        shard->setRawData(std::vector<float>({ 0, 0, 0 }).data());
+    }
+    EXPECT_EQ(mgr.gather<float>(tensor), std::vector<float>({ 11, 22, 33 }));
+    EXPECT_EQ(tensor->shard(1)->vector<float>(),
+              std::vector<float>({ 11, 22, 33 }));
+}
+
+TEST(TestMultiManager, TestInvalidSharding)
+{
+    kp::MultiManager mgr({ 0, 0 });
+
+    EXPECT_THROW(mgr.shardRows<float>({ 1, 2, 3 }, 2), std::runtime_error);
+    EXPECT_THROW(mgr.shardRows<float>({ 1, 2 }, 2), std::runtime_error);
+    EXPECT_THROW(mgr.allReduce<float>(mgr.shardRows<float>({ 1, 2 })),
+                 std::runtime_error);
+    EXPECT_THROW(mgr.manager(2), std::runtime_error);
+}
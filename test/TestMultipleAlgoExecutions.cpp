@@ -118,6 +118,83 @@ TEST(TestMultipleAlgoExecutions, SingleSequenceRecord)
     EXPECT_EQ(tensorA->vector(), std::vector<float>({ 3, 3, 3 }));
 }
 
+TEST(TestMultipleAlgoExecutions, SingleSequenceRecordTrackedBarriers)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 0, 0, 0 });
+    std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor({ 0, 0, 0 });
+
+    std::string shader(R"(
+      #version 450
+      layout (local_size_x = 1) in;
+      layout(set = 0, binding = 0) buffer a { float pa[]; };
+      void main() {
+          uint index = gl_GlobalInvocationID.x;
+          pa[index] = pa[index] + 1;
+      })");
+
+    std::vector<uint32_t> spirv = compileSource(shader);
+
+    // The sequence records the barriers between the dependent dispatches
+    std::shared_ptr<kp::Sequence> sq =
+      mgr.sequence()
+        ->record<kp::OpTensorSyncDevice>({ tensorA })
+        ->record<kp::OpAlgoDispatch>(mgr.algorithm({ tensorA }, spirv))
+        ->record<kp::OpAlgoDispatch>(mgr.algorithm({ tensorA }, spirv))
+        ->record<kp::OpAlgoDispatch>(mgr.algorithm({ tensorA }, spirv))
+        ->record<kp::OpTensorCopy>({ tensorA, tensorB })
+        ->record<kp::OpTensorSyncLocal>({ tensorA, tensorB });
+
+    // The copy records the barriers of both tensors with a single command
+    EXPECT_EQ(sq->barrierCount(), 6);
+
+    sq->eval();
+
+    EXPECT_EQ(tensorA->vector(), std::vector<float>({ 3, 3, 3 }));
+    EXPECT_EQ(tensorB->vector(), std::vector<float>({ 3, 3, 3 }));
+}
+
+TEST(TestMultipleAlgoExecutions, SingleBarrierAcrossTensors)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 1, 2, 3 });
+    std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor({ 1, 2, 3 });
+    std::shared_ptr<kp::TensorT<float>> tensorC = mgr.tensor({ 0, 0, 0 });
+
+    std::string shader(R"(
+      #version 450
+      layout (local_size_x = 1) in;
+      layout(set = 0, binding = 0) buffer a { float pa[]; };
+      layout(set = 0, binding = 1) buffer b { float pb[]; };
+      layout(set = 0, binding = 2) buffer c { float pc[]; };
+      void main() {
+          uint index = gl_GlobalInvocationID.x;
+          pc[index] = pc[index] + pa[index] * pb[index];
+      })");
+
+    std::vector<std::shared_ptr<kp::Tensor>> params = { tensorA,
+                                                        tensorB,
+                                                        tensorC };
+    std::shared_ptr<kp::Algorithm> algorithm =
+      mgr.algorithm(params, compileSource(shader));
+
+    std::shared_ptr<kp::Sequence> sq =
+      mgr.sequence()
+        ->record<kp::OpTensorSyncDevice>(params)
+        ->record<kp::OpAlgoDispatch>(algorithm)
+        ->record<kp::OpAlgoDispatch>(algorithm)
+        ->record<kp::OpTensorSyncLocal>({ tensorC });
+
+    // One barrier command per operation regardless of the tensors involved
+    EXPECT_EQ(sq->barrierCount(), 4);
+
+    sq->eval();
+
+    EXPECT_EQ(tensorC->vector(), std::vector<float>({ 2, 8, 18 }));
+}
+
 TEST(TestMultipleAlgoExecutions, MultipleCmdBufRecords)
 {
     kp::Manager mgr;
@@ -276,3 +353,47 @@ TEST(TestMultipleAlgoExecutions, TestAlgorithmUtilFunctions)
     EXPECT_EQ(algorithm->getPushConstants<float>(), pushConsts);
     EXPECT_EQ(algorithm->getSpecializationConstants<float>(), specConsts);
 }
+
+TEST(TestMultipleAlgoExecutions, TestAlgorithmSetTensors)
+{
+    kp::Manager mgr;
+
+    std::string shader(R"(
+      #version 450
+      layout (local_size_x = 1) in;
+      layout(set = 0, binding = 0) buffer a { float pa[]; };
+      layout(set = 0, binding = 1) buffer b { float pb[]; };
+      void main() {
+          uint index = gl_GlobalInvocationID.x;
+          pb[index] = pa[index] + 1;
+      })");
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 1, 2, 3 });
+    std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor({ 0, 0, 0 });
+    std::shared_ptr<kp::TensorT<float>> tensorC = mgr.tensor({ 4, 5, 6 });
+    std::shared_ptr<kp::TensorT<float>> tensorD = mgr.tensor({ 0, 0, 0 });
+
+    std::shared_ptr<kp::Algorithm> algorithm =
+      mgr.algorithm({ tensorA, tensorB }, compileSource(shader));
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorA, tensorC })
+      ->record<kp::OpAlgoDispatch>(algorithm)
+      ->eval();
+
+    // The inputs and outputs are swapped without rebuilding the pipeline
+    algorithm->setTensors({ tensorC, tensorD });
+    EXPECT_EQ(algorithm->getTensors()[0], tensorC);
+
+    mgr.sequence()
+      ->record<kp::OpAlgoDispatch>(algorithm)
+      ->record<kp::OpTensorSyncLocal>({ tensorB, tensorD })
+      ->eval();
+
+    EXPECT_EQ(tensorB->vector(), std::vector<float>({ 2, 3, 4 }));
+    EXPECT_EQ(tensorD->vector(), std::vector<float>({ 5, 6, 7 }));
+
+    EXPECT_ANY_THROW(algorithm->setTensors({ tensorA }));
+    EXPECT_ANY_THROW(algorithm->setTensors(
+      { tensorA, mgr.tensor({ 0, 0, 0 }, kp::Tensor::TensorTypes::eUniform) }));
+}
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+#include "kompute_test/Shader.hpp"
+
+namespace {
+
+struct SliceParams
+{
+    uint32_t offset;
+    float value;
+};
+
+}
+
+TEST(TestOpAlgoDispatchBatch, TestDispatchPerSlice)
+{
+    kp::Manager mgr;
+
+    uint32_t sliceSize = 4;
+    uint32_t sliceCount = 100;
+    std::shared_ptr<kp::TensorT<float>> tensor =
+      mgr.tensor(std::vector<float>(sliceSize * sliceCount, 0.0));
+
+    std::string shader(R"(
+        #version 450
+
+        layout(push_constant) uniform PushConstants {
+            uint offset;
+            float value;
+        } pcs;
+
+        layout (local_size_x = 1) in;
+
+        layout(set = 0, binding = 0) buffer buf { float values[]; };
+
+        void main() {
+            values[pcs.offset + gl_GlobalInvocationID.x] = pcs.value;
+        }
+    )");
+
+    std::vector<SliceParams> params;
+    for (uint32_t i = 0; i < sliceCount; i++) {
+        params.push_back({ i * sliceSize, (float)i });
+    }
+
+    std::shared_ptr<kp::Algorithm> algorithm =
+      mgr.algorithm<float, SliceParams>({ tensor },
+                                        compileSource(shader),
+                                        kp::Workgroup({ sliceSize, 1, 1 }),
+                                        {},
+                                        { SliceParams{ 0, 0.0 } });
+
+    std::shared_ptr<kp::OpAlgoDispatchBatch> op =
+      std::make_shared<kp::OpAlgoDispatchBatch>(algorithm, params);
+    EXPECT_EQ(op->dispatchCount(), sliceCount);
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensor })
+      ->record(op)
+      ->record<kp::OpTensorSyncLocal>({ tensor })
+      ->eval();
+
+    std::vector<float> expected;
+    for (uint32_t i = 0; i < sliceCount; i++) {
+        expected.insert(expected.end(), sliceSize, (float)i);
+    }
+    EXPECT_EQ(tensor->vector(), expected);
+}
+
+TEST(TestOpAlgoDispatchBatch, TestBarrierBetweenDispatches)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensor = mgr.tensor({ 1.0 });
+
+    std::string shader(R"(
+        #version 450
+
+        layout(push_constant) uniform PushConstants {
+            float x;
+        } pcs;
+
+        layout (local_size_x = 1) in;
+
+        layout(set = 0, binding = 0) buffer buf { float values[]; };
+
+        void main() {
+            values[0] = values[0] * 2.0 + pcs.x;
+        }
+    )");
+
+    std::shared_ptr<kp::Algorithm> algorithm =
+      mgr.algorithm({ tensor },
+                    compileSource(shader),
+                    kp::Workgroup({ 1, 1, 1 }),
+                    {},
+                    { 0.0 });
+
+    // Each dispatch depends on the result of the previous one
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensor })
+      ->record<kp::OpAlgoDispatchBatch>(
+        algorithm, std::vector<float>{ 1.0, 2.0, 3.0 }, 1, true)
+      ->record<kp::OpTensorSyncLocal>({ tensor })
+      ->eval();
+
+    EXPECT_EQ(tensor->vector(), std::vector<float>({ 22.0 }));
+}
+
+TEST(TestOpAlgoDispatchBatch, TestInvalidPushConstants)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensor = mgr.tensor({ 0.0 });
+    std::shared_ptr<kp::Algorithm> algorithm = mgr.algorithm();
+
+    EXPECT_THROW(kp::OpAlgoDispatchBatch(
+                   algorithm, std::vector<float>{ 1.0, 2.0, 3.0 }, 2),
+                 std::runtime_error);
+    EXPECT_THROW(
+      kp::OpAlgoDispatchBatch(algorithm, std::vector<float>{ 1.0 }, 0),
+      std::runtime_error);
+}
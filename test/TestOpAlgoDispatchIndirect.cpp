@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+#include "kompute_test/Shader.hpp"
+
+TEST(TestOpAlgoDispatchIndirect, TestDispatchSizeWrittenByShader)
+{
+    kp::Manager mgr;
+
+    // Only the first 3 elements are expected to be processed
+    auto tensorCount = mgr.tensorT<uint32_t>({ 3 });
+    auto tensorCommand = mgr.tensorT<uint32_t>({ 0, 0, 0 });
+    auto tensorOut = mgr.tensorT<uint32_t>({ 0, 0, 0, 0, 0 });
+
+    std::string shaderCommand = (R"(
+        #version 450
+
+        layout (local_size_x = 1) in;
+
+        layout(set = 0, binding = 0) buffer buf_count { uint count[]; };
+        layout(set = 0, binding = 1) buffer buf_command { uint command[]; };
+
+        void main() {
+            command[0] = count[0];
+            command[1] = 1;
+            command[2] = 1;
+        }
+    )");
+
+    std::string shaderOut = (R"(
+        #version 450
+
+        layout (local_size_x = 1) in;
+
+        layout(set = 0, binding = 0) buffer buf_out { uint out_a[]; };
+
+        void main() {
+            uint index = gl_GlobalInvocationID.x;
+            out_a[index] = index + 1;
+        }
+    )");
+
+    std::shared_ptr<kp::Algorithm> algoCommand =
+      mgr.algorithm({ tensorCount, tensorCommand },
+                    compileSource(shaderCommand),
+                    kp::Workgroup({ 1, 1, 1 }));
+    std::shared_ptr<kp::Algorithm> algoOut =
+      mgr.algorithm({ tensorOut }, compileSource(shaderOut));
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorCount, tensorCommand, tensorOut })
+      ->record<kp::OpAlgoDispatch>(algoCommand)
+      ->record<kp::OpAlgoDispatchIndirect>(algoOut, tensorCommand)
+      ->record<kp::OpTensorSyncLocal>({ tensorCommand, tensorOut })
+      ->eval();
+
+    EXPECT_EQ(tensorCommand->vector(), std::vector<uint32_t>({ 3, 1, 1 }));
+    EXPECT_EQ(tensorOut->vector(), std::vector<uint32_t>({ 1, 2, 3, 0, 0 }));
+}
+
+TEST(TestOpAlgoDispatchIndirect, TestInvalidIndirectTensor)
+{
+    kp::Manager mgr;
+
+    auto tensorSmall = mgr.tensorT<uint32_t>({ 1, 1 });
+    auto tensorCommand = mgr.tensorT<uint32_t>({ 1, 1, 1, 1 });
+
+    std::shared_ptr<kp::Algorithm> algorithm = mgr.algorithm({ tensorCommand });
+
+    EXPECT_ANY_THROW(kp::OpAlgoDispatchIndirect(algorithm, tensorSmall));
+    EXPECT_ANY_THROW(kp::OpAlgoDispatchIndirect(algorithm, tensorCommand, 2));
+    EXPECT_ANY_THROW(kp::OpAlgoDispatchIndirect(algorithm, tensorCommand, 8));
+    EXPECT_NO_THROW(kp::OpAlgoDispatchIndirect(algorithm, tensorCommand, 4));
+}
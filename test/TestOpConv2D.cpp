@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+namespace {
+
+// Reference convolution with the same layouts as OpConv2D
+std::vector<float>
+conv2D(const std::vector<float>& input,
+       const std::vector<float>& weights,
+       const std::vector<float>& bias,
+       uint32_t batch,
+       uint32_t inC,
+       uint32_t inH,
+       uint32_t inW,
+       uint32_t outC,
+       uint32_t kernel,
+       uint32_t stride,
+       uint32_t padding,
+       kp::OpConv2D::Layout layout,
+       float slope)
+{
+    bool nhwc = layout == kp::OpConv2D::Layout::eNHWC;
+    uint32_t outH = kp::OpConv2D::outputSize(inH, kernel, stride, padding);
+    uint32_t outW = kp::OpConv2D::outputSize(inW, kernel, stride, padding);
+    std::vector<float> output(batch * outC * outH * outW, 0.0);
+    for (uint32_t n = 0; n < batch; n++) {
+        for (uint32_t o = 0; o < outC; o++) {
+            for (uint32_t y = 0; y < outH; y++) {
+                for (uint32_t x = 0; x < outW; x++) {
+                    float sum = bias.empty() ? 0.0f : bias[o];
+                    for (uint32_t c = 0; c < inC; c++) {
+                        for (uint32_t ky = 0; ky < kernel; ky++) {
+                            for (uint32_t kx = 0; kx < kernel; kx++) {
+                                int64_t iy = (int64_t)(y * stride + ky) - padding;
+                                int64_t ix = (int64_t)(x * stride + kx) - padding;
+                                if (iy < 0 || iy >= (int64_t)inH || ix < 0 ||
+                                    ix >= (int64_t)inW) {
+                                    continue;
+                                }
+                                size_t in =
+                                  nhwc ? ((n * inH + iy) * inW + ix) * inC + c
+                                       : ((n * inC + c) * inH + iy) * inW + ix;
+                                size_t w =
+                                  nhwc ? ((o * kernel + ky) * kernel + kx) * inC + c
+                                       : ((o * inC + c) * kernel + ky) * kernel + kx;
+                                sum += input[in] * weights[w];
+                            }
+                        }
+                    }
+                    if (sum < 0.0f) {
+                        sum *= slope;
+                    }
+                    size_t out = nhwc ? ((n * outH + y) * outW + x) * outC + o
+                                      : ((n * outC + o) * outH + y) * outW + x;
+                    output[out] = sum;
+                }
+            }
+        }
+    }
+    return output;
+}
+
+// Small integers keep the float sums exact
+std::vector<float>
+imageValues(uint32_t size)
+{
+    std::vector<float> values(size);
+    for (uint32_t i = 0; i < size; i++) {
+        values[i] = (float)(i % 5) - 2.0f;
+    }
+    return values;
+}
+
+void
+testConv2D(uint32_t batch,
+           uint32_t inC,
+           uint32_t inH,
+           uint32_t inW,
+           uint32_t outC,
+           uint32_t kernel,
+           uint32_t stride,
+           uint32_t padding,
+           kp::OpConv2D::Layout layout,
+           kp::OpConv2D::Activation activation,
+           bool withBias)
+{
+    kp::Manager mgr;
+
+    uint32_t outH = kp::OpConv2D::outputSize(inH, kernel, stride, padding);
+    uint32_t outW = kp::OpConv2D::outputSize(inW, kernel, stride, padding);
+
+    std::vector<float> input = imageValues(batch * inC * inH * inW);
+    std::vector<float> weights = imageValues(outC * inC * kernel * kernel);
+    std::vector<float> bias;
+    if (withBias) {
+        bias = imageValues(outC);
+    }
+
+    std::shared_ptr<kp::TensorT<float>> tensorInput = mgr.tensor(input);
+    std::shared_ptr<kp::TensorT<float>> tensorWeights = mgr.tensor(weights);
+    std::shared_ptr<kp::TensorT<float>> tensorOutput =
+      mgr.tensor(std::vector<float>(batch * outC * outH * outW, 0.0));
+
+    std::vector<std::shared_ptr<kp::Tensor>> tensors = { tensorInput,
+                                                         tensorWeights };
+    if (withBias) {
+        tensors.push_back(mgr.tensor(bias));
+    }
+    tensors.push_back(tensorOutput);
+
+    // A slope of a power of two keeps the leaky relu exact
+    float slope = activation == kp::OpConv2D::Activation::eLeakyRelu ? 0.25f
+                  : activation == kp::OpConv2D::Activation::eRelu    ? 0.0f
+                                                                     : 1.0f;
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>(tensors)
+      ->record<kp::OpConv2D>(tensors,
+                             mgr.algorithm(),
+                             batch,
+                             inC,
+                             inH,
+                             inW,
+                             outC,
+                             kernel,
+                             kernel,
+                             stride,
+                             padding,
+                             layout,
+                             activation,
+                             0.25f)
+      ->record<kp::OpTensorSyncLocal>({ tensorOutput })
+      ->eval();
+
+    EXPECT_EQ(tensorOutput->vector(),
+              conv2D(input,
+                     weights,
+                     bias,
+                     batch,
+                     inC,
+                     inH,
+                     inW,
+                     outC,
+                     kernel,
+                     stride,
+                     padding,
+                     layout,
+                     slope));
+}
+
+}
+
+TEST(TestOpConv2D, TestNCHW)
+{
+    testConv2D(1,
+               3,
+               12,
+               10,
+               8,
+               3,
+               1,
+               0,
+               kp::OpConv2D::Layout::eNCHW,
+               kp::OpConv2D::Activation::eNone,
+               false);
+}
+
+TEST(TestOpConv2D, TestNHWC)
+{
+    testConv2D(1,
+               3,
+               12,
+               10,
+               8,
+               3,
+               1,
+               0,
+               kp::OpConv2D::Layout::eNHWC,
+               kp::OpConv2D::Activation::eNone,
+               false);
+}
+
+TEST(TestOpConv2D, TestStridePadding)
+{
+    testConv2D(2,
+               5,
+               17,
+               13,
+               6,
+               5,
+               2,
+               2,
+               kp::OpConv2D::Layout::eNCHW,
+               kp::OpConv2D::Activation::eNone,
+               true);
+    testConv2D(2,
+               5,
+               17,
+               13,
+               6,
+               3,
+               2,
+               1,
+               kp::OpConv2D::Layout::eNHWC,
+               kp::OpConv2D::Activation::eNone,
+               true);
+}
+
+TEST(TestOpConv2D, TestBiasActivation)
+{
+    testConv2D(1,
+               4,
+               9,
+               9,
+               37,
+               3,
+               1,
+               1,
+               kp::OpConv2D::Layout::eNHWC,
+               kp::OpConv2D::Activation::eRelu,
+               true);
+    testConv2D(1,
+               4,
+               9,
+               9,
+               37,
+               3,
+               1,
+               1,
+               kp::OpConv2D::Layout::eNCHW,
+               kp::OpConv2D::Activation::eLeakyRelu,
+               true);
+}
+
+TEST(TestOpConv2D, TestOutputSize)
+{
+    EXPECT_EQ(kp::OpConv2D::outputSize(32, 3), 30);
+    EXPECT_EQ(kp::OpConv2D::outputSize(32, 3, 1, 1), 32);
+    EXPECT_EQ(kp::OpConv2D::outputSize(32, 3, 2, 1), 16);
+    EXPECT_EQ(kp::OpConv2D::outputSize(2, 3), 0);
+}
+
+TEST(TestOpConv2D, TestInvalidParameters)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensorInput =
+      mgr.tensor(std::vector<float>(16, 1.0));
+    std::shared_ptr<kp::TensorT<float>> tensorWeights =
+      mgr.tensor(std::vector<float>(9, 1.0));
+    std::shared_ptr<kp::TensorT<float>> tensorOutput = mgr.tensor({ 0, 0, 0 });
+
+    // The output is too small for a 2 x 2 image
+    EXPECT_THROW(kp::OpConv2D({ tensorInput, tensorWeights, tensorOutput },
+                              mgr.algorithm(),
+                              1,
+                              1,
+                              4,
+                              4,
+                              1,
+                              3,
+                              3),
+                 std::runtime_error);
+    // The kernel is larger than the image
+    EXPECT_THROW(kp::OpConv2D({ tensorInput, tensorWeights, tensorInput },
+                              mgr.algorithm(),
+                              1,
+                              1,
+                              2,
+                              2,
+                              1,
+                              3,
+                              3),
+                 std::runtime_error);
+}
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+TEST(TestOpExpression, TestMultiplyAdd)
+{
+    if (!kp::Shader::compilerAvailable()) {
+        GTEST_SKIP() << "Kompute built without the shader compiler";
+    }
+
+    kp::Manager mgr;
+
+    auto tensorA = mgr.tensor({ 1, 2, 3, 4 });
+    auto tensorB = mgr.tensor({ 2, 3, 4, 5 });
+    auto tensorC = mgr.tensor({ 10, 20, 30, 40 });
+    auto tensorOut = mgr.tensor({ 0, 0, 0, 0 });
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorA, tensorB, tensorC })
+      ->record<kp::OpExpression>(
+        { tensorOut }, mgr.algorithm(), kp::expr(tensorA) * tensorB + tensorC)
+      ->record<kp::OpTensorSyncLocal>({ tensorOut })
+      ->eval();
+
+    EXPECT_EQ(tensorOut->vector(), std::vector<float>({ 12, 26, 42, 60 }));
+}
+
+TEST(TestOpExpression, TestConstantsAndFunctions)
+{
+    if (!kp::Shader::compilerAvailable()) {
+        GTEST_SKIP() << "Kompute built without the shader compiler";
+    }
+
+    kp::Manager mgr;
+
+    // Past a single workgroup to use the default workgroup of Algorithm
+    uint32_t size = 1000;
+    std::vector<float> a(size);
+    std::vector<float> b(size);
+    for (uint32_t i = 0; i < size; i++) {
+        a[i] = 0.5f + i;
+        b[i] = 2.0f - 0.01f * i;
+    }
+
+    auto tensorA = mgr.tensor(a);
+    auto tensorB = mgr.tensor(b);
+    auto tensorOut = mgr.tensor(size, kp::Tensor::TensorDataTypes::eFloat);
+
+    kp::Expression expression =
+      kp::max(kp::sqrt(tensorA) - 1.0f, -kp::abs(tensorB)) / 2.0f +
+      kp::log(kp::exp(kp::min(tensorA, tensorB)));
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorA, tensorB })
+      ->record<kp::OpExpression>({ tensorOut }, mgr.algorithm(), expression)
+      ->record<kp::OpTensorSyncLocal>({ tensorOut })
+      ->eval();
+
+    std::vector<float> output = tensorOut->vector<float>();
+    for (uint32_t i = 0; i < size; i++) {
+        float expected =
+          std::max(std::sqrt(a[i]) - 1.0f, -std::abs(b[i])) / 2.0f +
+          std::min(a[i], b[i]);
+        EXPECT_NEAR(output[i], expected, 1e-4 * (1 + std::abs(expected)));
+    }
+}
+
+TEST(TestOpExpression, TestOutputReadInPlace)
+{
+    if (!kp::Shader::compilerAvailable()) {
+        GTEST_SKIP() << "Kompute built without the shader compiler";
+    }
+
+    kp::Manager mgr;
+
+    auto tensorA = mgr.tensor({ 1, 2, 3 });
+    auto tensorB = mgr.tensor({ 4, 5, 6 });
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorA, tensorB })
+      ->record<kp::OpExpression>(
+        { tensorA }, mgr.algorithm(), 3.0f * kp::expr(tensorA) - tensorB)
+      ->record<kp::OpTensorSyncLocal>({ tensorA })
+      ->eval();
+
+    EXPECT_EQ(tensorA->vector(), std::vector<float>({ -1, 1, 3 }));
+}
+
+TEST(TestOpExpression, TestSignatureIgnoresTensorsAndValues)
+{
+    if (!kp::Shader::compilerAvailable()) {
+        GTEST_SKIP() << "Kompute built without the shader compiler";
+    }
+
+    kp::Manager mgr;
+
+    auto tensorA = mgr.tensor({ 1, 2 });
+    auto tensorB = mgr.tensor({ 3, 4 });
+    auto tensorC = mgr.tensor({ 5, 6 });
+
+    kp::Expression first = kp::expr(tensorA) * (tensorB + 1.0f);
+    kp::Expression second = kp::expr(tensorC) * (tensorA + 7.0f);
+    kp::Expression repeated = kp::expr(tensorA) * (tensorA + 1.0f);
+
+    EXPECT_EQ(first.signature(), "mul(t0,add(t1,c0))");
+    EXPECT_EQ(second.signature(), first.signature());
+    EXPECT_EQ(second.spirv(), first.spirv());
+    EXPECT_EQ(second.constants(), std::vector<float>({ 7 }));
+    EXPECT_EQ(repeated.signature(), "mul(t0,add(t0,c0))");
+    EXPECT_EQ(repeated.tensors().size(), 1);
+    EXPECT_NE(repeated.spirv(), first.spirv());
+}
+
+TEST(TestOpExpression, TestGlslFollowsSignature)
+{
+    kp::Manager mgr;
+
+    auto tensorA = mgr.tensor({ 1, 2 });
+    auto tensorB = mgr.tensor({ 3, 4 });
+
+    kp::Expression expression =
+      kp::max(kp::expr(tensorA) * 2.0f, -kp::expr(tensorB));
+    std::string glsl = expression.glsl();
+
+    EXPECT_NE(glsl.find("layout(local_size_x_id = 0) in;"), std::string::npos);
+    EXPECT_NE(glsl.find("float values[1]; } constants;"), std::string::npos);
+    EXPECT_NE(glsl.find("tensorOutput.values[index] = "
+                        "max((t0 * constants.values[0]), (-t1));"),
+              std::string::npos);
+    EXPECT_EQ((kp::max(kp::expr(tensorB) * 3.0f, -kp::expr(tensorA))).glsl(),
+              glsl);
+}
+
+TEST(TestOpExpression, TestInvalidTensors)
+{
+    kp::Manager mgr;
+
+    auto tensorA = mgr.tensor({ 1, 2, 3 });
+    auto tensorShort = mgr.tensor({ 1, 2 });
+    auto tensorInt = mgr.tensorT<int32_t>({ 1, 2, 3 });
+
+    EXPECT_ANY_THROW(kp::OpExpression(
+      { tensorA }, mgr.algorithm(), kp::expr(tensorA) + tensorShort));
+    EXPECT_ANY_THROW(kp::OpExpression(
+      { tensorA }, mgr.algorithm(), kp::expr(tensorA) + tensorInt));
+    EXPECT_ANY_THROW(
+      kp::OpExpression({ tensorInt }, mgr.algorithm(), kp::expr(tensorA)));
+}
@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+namespace {
+
+// Reference multiplication of row-major matrices with the same transposes
+std::vector<float>
+matMul(const std::vector<float>& a,
+       const std::vector<float>& b,
+       uint32_t m,
+       uint32_t n,
+       uint32_t k,
+       bool transposeA,
+       bool transposeB,
+       uint32_t batchCount)
+{
+    std::vector<float> c(batchCount * m * n, 0.0);
+    for (uint32_t batch = 0; batch < batchCount; batch++) {
+        const float* batchA = a.data() + batch * m * k;
+        const float* batchB = b.data() + batch * k * n;
+        for (uint32_t i = 0; i < m; i++) {
+            for (uint32_t j = 0; j < n; j++) {
+                float sum = 0.0;
+                for (uint32_t l = 0; l < k; l++) {
+                    sum += (transposeA ? batchA[l * m + i] : batchA[i * k + l]) *
+                           (transposeB ? batchB[j * k + l] : batchB[l * n + j]);
+                }
+                c[batch * m * n + i * n + j] = sum;
+            }
+        }
+    }
+    return c;
+}
+
+// Small integers keep the float sums exact
+std::vector<float>
+matrixValues(uint32_t size)
+{
+    std::vector<float> values(size);
+    for (uint32_t i = 0; i < size; i++) {
+        values[i] = (float)(i % 7) - 3.0f;
+    }
+    return values;
+}
+
+void
+testMatMul(uint32_t m,
+           uint32_t n,
+           uint32_t k,
+           bool transposeA,
+           bool transposeB,
+           uint32_t batchCount,
+           uint32_t tileSize)
+{
+    kp::Manager mgr;
+
+    std::vector<float> a = matrixValues(batchCount * m * k);
+    std::vector<float> b = matrixValues(batchCount * k * n);
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor(a);
+    std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor(b);
+    std::shared_ptr<kp::TensorT<float>> tensorC =
+      mgr.tensor(std::vector<float>(batchCount * m * n, 0.0));
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorA, tensorB })
+      ->record<kp::OpMatMul>({ tensorA, tensorB, tensorC },
+                             mgr.algorithm(),
+                             m,
+                             n,
+                             k,
+                             transposeA,
+                             transposeB,
+                             batchCount,
+                             tileSize)
+      ->record<kp::OpTensorSyncLocal>({ tensorC })
+      ->eval();
+
+    EXPECT_EQ(tensorC->vector(),
+              matMul(a, b, m, n, k, transposeA, transposeB, batchCount));
+}
+
+}
+
+TEST(TestOpMatMul, TestSquare)
+{
+    testMatMul(64, 64, 64, false, false, 1, 0);
+}
+
+TEST(TestOpMatMul, TestPartialTiles)
+{
+    testMatMul(37, 21, 50, false, false, 1, 16);
+}
+
+TEST(TestOpMatMul, TestTransposed)
+{
+    testMatMul(33, 18, 20, true, false, 1, 8);
+    testMatMul(33, 18, 20, false, true, 1, 8);
+    testMatMul(33, 18, 20, true, true, 1, 8);
+}
+
+TEST(TestOpMatMul, TestBatched)
+{
+    testMatMul(20, 12, 9, false, false, 3, 0);
+}
+
+TEST(TestOpMatMul, TestTileSizeForDevice)
+{
+    kp::Manager mgr;
+
+    uint32_t tileSize =
+      kp::OpMatMul::tileSizeForDevice(mgr.getDeviceProperties());
+
+    EXPECT_GE(tileSize, KOMPUTE_MATMUL_WORK_PER_THREAD);
+    EXPECT_LE(tileSize, KOMPUTE_MATMUL_MAX_TILE_SIZE);
+
+    testMatMul(70, 40, 45, false, false, 1, tileSize);
+}
+
+TEST(TestOpMatMul, TestInvalidParameters)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 1, 2, 3, 4 });
+    std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor({ 1, 2, 3, 4 });
+    std::shared_ptr<kp::TensorT<float>> tensorC = mgr.tensor({ 0, 0, 0 });
+
+    // The output is too small for a 2 x 2 matrix
+    EXPECT_THROW(
+      kp::OpMatMul({ tensorA, tensorB, tensorC }, mgr.algorithm(), 2, 2, 2),
+      std::runtime_error);
+    EXPECT_THROW(kp::OpMatMul({ tensorA, tensorB, tensorA },
+                              mgr.algorithm(),
+                              2,
+                              2,
+                              2,
+                              false,
+                              false,
+                              1,
+                              12),
+                 std::runtime_error);
+}
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+namespace {
+
+void
+testMult(uint32_t size, bool broadcastLhs, bool broadcastRhs)
+{
+    kp::Manager mgr;
+
+    std::vector<float> lhs(broadcastLhs ? 1 : size);
+    std::vector<float> rhs(broadcastRhs ? 1 : size);
+    for (size_t i = 0; i < lhs.size(); i++) {
+        lhs[i] = (float)(i % 7) - 3.0f;
+    }
+    for (size_t i = 0; i < rhs.size(); i++) {
+        rhs[i] = (float)(i % 5) + 0.5f;
+    }
+
+    std::shared_ptr<kp::TensorT<float>> tensorLhs = mgr.tensor(lhs);
+    std::shared_ptr<kp::TensorT<float>> tensorRhs = mgr.tensor(rhs);
+    std::shared_ptr<kp::TensorT<float>> tensorOutput =
+      mgr.tensor(std::vector<float>(size, 0.0));
+
+    std::vector<std::shared_ptr<kp::Tensor>> params = { tensorLhs,
+                                                        tensorRhs,
+                                                        tensorOutput };
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>(params)
+      ->record<kp::OpMult>(params, mgr.algorithm())
+      ->record<kp::OpTensorSyncLocal>({ tensorOutput })
+      ->eval();
+
+    std::vector<float> expected(size);
+    for (uint32_t i = 0; i < size; i++) {
+        expected[i] = lhs[broadcastLhs ? 0 : i] * rhs[broadcastRhs ? 0 : i];
+    }
+    EXPECT_EQ(tensorOutput->vector(), expected);
+}
+
+}
+
+TEST(TestOpMult, TestSizesWithTail)
+{
+    testMult(1, false, false);
+    testMult(3, false, false);
+    testMult(4, false, false);
+    testMult(1027, false, false);
+    testMult(60003, false, false);
+    // The prebuilt shader dispatches a workgroup per element, so sizes past
+    // the minimum workgroup count limit need the vectorized shader
+    if (kp::Shader::compilerAvailable()) {
+        testMult(100003, false, false);
+    }
+}
+
+TEST(TestOpMult, TestBroadcast)
+{
+    if (!kp::Shader::compilerAvailable()) {
+        GTEST_SKIP() << "Kompute built without the shader compiler";
+    }
+
+    testMult(1027, true, false);
+    testMult(1027, false, true);
+    testMult(1027, true, true);
+}
+
+TEST(TestOpMult, TestWorkgroupPerFourElements)
+{
+    if (!kp::Shader::compilerAvailable()) {
+        GTEST_SKIP() << "Kompute built without the shader compiler";
+    }
+
+    kp::Manager mgr;
+
+    uint32_t size = 10000;
+    std::shared_ptr<kp::TensorT<float>> tensorLhs =
+      mgr.tensor(std::vector<float>(size, 2.0));
+    std::shared_ptr<kp::TensorT<float>> tensorRhs =
+      mgr.tensor(std::vector<float>(size, 3.0));
+    std::shared_ptr<kp::TensorT<float>> tensorOutput =
+      mgr.tensor(std::vector<float>(size, 0.0));
+
+    std::shared_ptr<kp::Algorithm> algorithm = mgr.algorithm();
+    kp::OpMult op({ tensorLhs, tensorRhs, tensorOutput }, algorithm);
+
+    uint32_t localSize = algorithm->getLocalSizeX();
+    EXPECT_GT(localSize, 1);
+    EXPECT_EQ(algorithm->getWorkgroup()[0],
+              (size / 4 + localSize - 1) / localSize);
+}
+
+TEST(TestOpMult, TestInvalidSizes)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 1, 2, 3 });
+    std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor({ 1, 2 });
+    std::shared_ptr<kp::TensorT<uint32_t>> tensorC =
+      mgr.tensorT<uint32_t>({ 1, 2, 3 });
+
+    EXPECT_THROW(kp::OpMult({ tensorA, tensorB, tensorA }, mgr.algorithm()),
+                 std::runtime_error);
+    EXPECT_THROW(kp::OpMult({ tensorA, tensorC, tensorA }, mgr.algorithm()),
+                 std::runtime_error);
+    EXPECT_THROW(kp::OpMult({ tensorA, tensorA }, mgr.algorithm()),
+                 std::runtime_error);
+}
@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+TEST(TestOpReduce, TestSubgroupProperties)
+{
+    kp::Manager mgr;
+
+    vk::PhysicalDeviceSubgroupProperties properties =
+      mgr.getSubgroupProperties();
+
+    EXPECT_GT(properties.subgroupSize, 0);
+
+    // Basic operations are required in compute shaders by Vulkan 1.1
+    EXPECT_TRUE(
+      mgr.supportsSubgroupOperations(vk::SubgroupFeatureFlagBits::eBasic));
+}
+
+TEST(TestOpReduce, TestSumSharedMemory)
+{
+    kp::Manager mgr;
+
+    // Large enough for the grid-stride loop over the maximum workgroups
+    uint32_t size = 1 << 20;
+    std::shared_ptr<kp::TensorT<float>> tensorIn =
+      mgr.tensor(std::vector<float>(size, 1.0));
+    std::shared_ptr<kp::TensorT<float>> tensorOut = mgr.tensor({ 5.0 });
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorIn })
+      ->record<kp::OpReduce>({ tensorIn, tensorOut },
+                             mgr.algorithm(),
+                             kp::OpReduce::Operation::eSum,
+                             false)
+      ->record<kp::OpTensorSyncLocal>({ tensorOut })
+      ->eval();
+
+    EXPECT_EQ(tensorOut->vector(), std::vector<float>({ (float)size }));
+}
+
+TEST(TestOpReduce, TestSumSubgroupArithmetic)
+{
+    kp::Manager mgr;
+
+    if (!mgr.supportsSubgroupOperations(
+          vk::SubgroupFeatureFlagBits::eBasic |
+          vk::SubgroupFeatureFlagBits::eArithmetic)) {
+        GTEST_SKIP() << "Subgroup arithmetic not supported by the device";
+    }
+
+    uint32_t size = 1000;
+    std::vector<float> values(size);
+    for (uint32_t i = 0; i < size; i++) {
+        values[i] = i + 1;
+    }
+    std::shared_ptr<kp::TensorT<float>> tensorIn = mgr.tensor(values);
+    std::shared_ptr<kp::TensorT<float>> tensorOut = mgr.tensor({ 0.0 });
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorIn })
+      ->record<kp::OpReduce>({ tensorIn, tensorOut },
+                             mgr.algorithm(),
+                             kp::OpReduce::Operation::eSum,
+                             true)
+      ->record<kp::OpTensorSyncLocal>({ tensorOut })
+      ->eval();
+
+    EXPECT_EQ(tensorOut->vector(), std::vector<float>({ 500500.0 }));
+}
+
+TEST(TestOpReduce, TestMinMax)
+{
+    kp::Manager mgr;
+
+    uint32_t size = 5000;
+    std::vector<float> values(size);
+    for (uint32_t i = 0; i < size; i++) {
+        values[i] = (float)((i * 37) % size) - 1000.0f;
+    }
+    std::shared_ptr<kp::TensorT<float>> tensorIn = mgr.tensor(values);
+    std::shared_ptr<kp::TensorT<float>> tensorMin = mgr.tensor({ 0.0 });
+    std::shared_ptr<kp::TensorT<float>> tensorMax = mgr.tensor({ 0.0 });
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorIn })
+      ->record<kp::OpReduce>({ tensorIn, tensorMin },
+                             mgr.algorithm(),
+                             kp::OpReduce::Operation::eMin)
+      ->record<kp::OpReduce>({ tensorIn, tensorMax },
+                             mgr.algorithm(),
+                             kp::OpReduce::Operation::eMax)
+      ->record<kp::OpTensorSyncLocal>({ tensorMin, tensorMax })
+      ->eval();
+
+    EXPECT_EQ(tensorMin->vector(), std::vector<float>({ -1000.0 }));
+    EXPECT_EQ(tensorMax->vector(), std::vector<float>({ 3999.0 }));
+}
+
+TEST(TestOpReduce, TestArgmax)
+{
+    kp::Manager mgr;
+
+    // The first index of the maximum is expected
+    uint32_t size = 100000;
+    std::vector<float> values(size, -2.0);
+    values[70001] = 5.0;
+    values[80002] = 5.0;
+    std::shared_ptr<kp::TensorT<float>> tensorIn = mgr.tensor(values);
+    std::shared_ptr<kp::TensorT<uint32_t>> tensorOut =
+      mgr.tensorT<uint32_t>({ 0, 0 });
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorIn })
+      ->record<kp::OpReduce>({ tensorIn, tensorOut },
+                             mgr.algorithm(),
+                             kp::OpReduce::Operation::eArgmax)
+      ->record<kp::OpTensorSyncLocal>({ tensorOut })
+      ->eval();
+
+    float maximum;
+    memcpy(&maximum, &tensorOut->data()[0], sizeof(float));
+    EXPECT_EQ(maximum, 5.0);
+    EXPECT_EQ(tensorOut->data()[1], 70001);
+}
+
+TEST(TestOpReduce, TestSyncLocal)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensorIn =
+      mgr.tensor({ 3.0, -7.0, 2.0, 9.0 });
+    std::shared_ptr<kp::TensorT<float>> tensorOut = mgr.tensor({ 0.0 });
+    std::shared_ptr<kp::TensorT<float>> tensorHostOut =
+      mgr.tensor({ 0.0 }, kp::Tensor::TensorTypes::eHost);
+
+    // The results are read back without an OpTensorSyncLocal
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorIn })
+      ->record<kp::OpReduce>({ tensorIn, tensorOut },
+                             mgr.algorithm(),
+                             kp::OpReduce::Operation::eSum,
+                             false,
+                             true)
+      ->record<kp::OpReduce>({ tensorIn, tensorHostOut },
+                             mgr.algorithm(),
+                             kp::OpReduce::Operation::eMin,
+                             false,
+                             true)
+      ->eval();
+
+    EXPECT_EQ(tensorOut->vector(), std::vector<float>({ 7.0 }));
+    EXPECT_EQ(tensorHostOut->vector(), std::vector<float>({ -7.0 }));
+}
+
+TEST(TestOpReduce, TestInvalidTensors)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensorIn = mgr.tensor({ 1.0, 2.0 });
+    std::shared_ptr<kp::TensorT<uint32_t>> tensorOut =
+      mgr.tensorT<uint32_t>({ 0 });
+
+    EXPECT_THROW(kp::OpReduce({ tensorIn }, mgr.algorithm()),
+                 std::runtime_error);
+    EXPECT_THROW(kp::OpReduce({ tensorIn, tensorOut }, mgr.algorithm()),
+                 std::runtime_error);
+    EXPECT_THROW(kp::OpReduce({ tensorIn, tensorOut },
+                              mgr.algorithm(),
+                              kp::OpReduce::Operation::eArgmax),
+                 std::runtime_error);
+}
@@ -0,0 +1,205 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+#include "kompute_test/Shader.hpp"
+
+TEST(TestOpScan, TestInclusiveUint)
+{
+    kp::Manager mgr;
+
+    // Past the maximum workgroups so every workgroup scans several blocks
+    uint32_t size = KOMPUTE_SCAN_BLOCK_SIZE * KOMPUTE_SCAN_MAX_WORKGROUPS + 77;
+    std::vector<uint32_t> values(size);
+    std::vector<uint32_t> expected(size);
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < size; i++) {
+        values[i] = i % 5;
+        sum += values[i];
+        expected[i] = sum;
+    }
+
+    auto tensorIn = mgr.tensorT<uint32_t>(values);
+    auto tensorOut = mgr.tensorT<uint32_t>(std::vector<uint32_t>(size, 0));
+    auto tensorPartials = mgr.tensorT<uint32_t>(
+      std::vector<uint32_t>(kp::OpScan::partialsSize(size), 0));
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorIn, tensorOut })
+      ->record<kp::OpScan>({ tensorIn, tensorOut, tensorPartials },
+                           mgr.algorithm())
+      ->record<kp::OpTensorSyncLocal>({ tensorOut })
+      ->eval();
+
+    EXPECT_EQ(tensorOut->vector(), expected);
+}
+
+TEST(TestOpScan, TestExclusiveFloat)
+{
+    kp::Manager mgr;
+
+    uint32_t size = 3000;
+    std::vector<float> values(size, 1.0);
+    std::vector<float> expected(size);
+    for (uint32_t i = 0; i < size; i++) {
+        expected[i] = i;
+    }
+
+    auto tensorIn = mgr.tensor(values);
+    auto tensorOut = mgr.tensor(std::vector<float>(size, -1.0));
+    auto tensorPartials = mgr.tensorT<uint32_t>(
+      std::vector<uint32_t>(kp::OpScan::partialsSize(size), 0));
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorIn, tensorOut })
+      ->record<kp::OpScan>(
+        { tensorIn, tensorOut, tensorPartials }, mgr.algorithm(), false)
+      ->record<kp::OpTensorSyncLocal>({ tensorOut })
+      ->eval();
+
+    EXPECT_EQ(tensorOut->vector(), expected);
+}
+
+TEST(TestOpScan, TestInPlaceInt)
+{
+    kp::Manager mgr;
+
+    auto tensor = mgr.tensorT<int32_t>({ 3, -1, 4, -1, 5 });
+    auto tensorPartials = mgr.tensorT<uint32_t>({ 0 });
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensor })
+      ->record<kp::OpScan>({ tensor, tensor, tensorPartials }, mgr.algorithm())
+      ->record<kp::OpTensorSyncLocal>({ tensor })
+      ->eval();
+
+    EXPECT_EQ(tensor->vector(), std::vector<int32_t>({ 3, 2, 6, 5, 10 }));
+}
+
+TEST(TestOpScan, TestInvalidTensors)
+{
+    kp::Manager mgr;
+
+    auto tensorIn = mgr.tensor(std::vector<float>(2000, 1.0));
+    auto tensorOut = mgr.tensor(std::vector<float>(2000, 0.0));
+    auto tensorOutSmall = mgr.tensor({ 0.0 });
+    auto tensorOutUint = mgr.tensorT<uint32_t>(std::vector<uint32_t>(2000, 0));
+    auto tensorPartials = mgr.tensorT<uint32_t>({ 0, 0 });
+    auto tensorPartialsSmall = mgr.tensorT<uint32_t>({ 0 });
+
+    EXPECT_THROW(kp::OpScan({ tensorIn, tensorOut }, mgr.algorithm()),
+                 std::runtime_error);
+    EXPECT_THROW(
+      kp::OpScan({ tensorIn, tensorOutSmall, tensorPartials }, mgr.algorithm()),
+      std::runtime_error);
+    EXPECT_THROW(
+      kp::OpScan({ tensorIn, tensorOutUint, tensorPartials }, mgr.algorithm()),
+      std::runtime_error);
+    EXPECT_THROW(
+      kp::OpScan({ tensorIn, tensorOut, tensorPartialsSmall }, mgr.algorithm()),
+      std::runtime_error);
+    EXPECT_NO_THROW(
+      kp::OpScan({ tensorIn, tensorOut, tensorPartials }, mgr.algorithm()));
+}
+
+TEST(TestOpCompact, TestCompactWithIndirectDispatch)
+{
+    kp::Manager mgr;
+
+    uint32_t size = 2500;
+    std::vector<float> values(size);
+    std::vector<uint32_t> flags(size);
+    std::vector<float> expected;
+    for (uint32_t i = 0; i < size; i++) {
+        values[i] = i;
+        flags[i] = (i % 3 == 0) ? i + 1 : 0;
+        if (flags[i]) {
+            expected.push_back(values[i] * 2);
+        }
+    }
+
+    auto tensorValues = mgr.tensor(values);
+    auto tensorFlags = mgr.tensorT<uint32_t>(flags);
+    auto tensorOut = mgr.tensor(std::vector<float>(size, -1.0));
+    auto tensorCount = mgr.tensorT<uint32_t>({ 0, 0, 0, 0 });
+    auto tensorPartials = mgr.tensorT<uint32_t>(
+      std::vector<uint32_t>(kp::OpScan::partialsSize(size), 0));
+
+    // Doubles only the compacted values, one invocation per value
+    std::string shaderDouble = (R"(
+        #version 450
+
+        layout (local_size_x = 64) in;
+
+        layout(set = 0, binding = 0) buffer buf_out { float values[]; };
+        layout(set = 0, binding = 1) buffer buf_count { uint count[]; };
+
+        void main() {
+            uint index = gl_GlobalInvocationID.x;
+            if (index < count[3]) {
+                values[index] *= 2.0;
+            }
+        }
+    )");
+
+    std::shared_ptr<kp::Algorithm> algoDouble =
+      mgr.algorithm({ tensorOut, tensorCount }, compileSource(shaderDouble));
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>(
+        { tensorValues, tensorFlags, tensorOut, tensorCount })
+      ->record<kp::OpCompact>(
+        { tensorValues, tensorFlags, tensorOut, tensorCount, tensorPartials },
+        mgr.algorithm(),
+        64)
+      ->record<kp::OpAlgoDispatchIndirect>(algoDouble, tensorCount)
+      ->record<kp::OpTensorSyncLocal>({ tensorOut, tensorCount })
+      ->eval();
+
+    uint32_t count = expected.size();
+    EXPECT_EQ(tensorCount->vector(),
+              std::vector<uint32_t>({ (count + 63) / 64, 1, 1, count }));
+
+    std::vector<float> output = tensorOut->vector();
+    EXPECT_EQ(std::vector<float>(output.begin(), output.begin() + count),
+              expected);
+}
+
+TEST(TestOpCompact, TestInvalidTensors)
+{
+    kp::Manager mgr;
+
+    auto tensorValues = mgr.tensor({ 1.0, 2.0, 3.0 });
+    auto tensorFlags = mgr.tensorT<uint32_t>({ 1, 0, 1 });
+    auto tensorFlagsFloat = mgr.tensor({ 1.0, 0.0, 1.0 });
+    auto tensorOut = mgr.tensor({ 0.0, 0.0, 0.0 });
+    auto tensorCount = mgr.tensorT<uint32_t>({ 0, 0, 0, 0 });
+    auto tensorCountSmall = mgr.tensorT<uint32_t>({ 0, 0, 0 });
+    auto tensorPartials = mgr.tensorT<uint32_t>({ 0 });
+
+    EXPECT_THROW(kp::OpCompact({ tensorValues,
+                                 tensorFlagsFloat,
+                                 tensorOut,
+                                 tensorCount,
+                                 tensorPartials },
+                               mgr.algorithm()),
+                 std::runtime_error);
+    EXPECT_THROW(kp::OpCompact({ tensorValues,
+                                 tensorFlags,
+                                 tensorOut,
+                                 tensorCountSmall,
+                                 tensorPartials },
+                               mgr.algorithm()),
+                 std::runtime_error);
+    EXPECT_THROW(
+      kp::OpCompact(
+        { tensorValues, tensorFlags, tensorOut, tensorCount, tensorPartials },
+        mgr.algorithm(),
+        0),
+      std::runtime_error);
+    EXPECT_NO_THROW(kp::OpCompact(
+      { tensorValues, tensorFlags, tensorOut, tensorCount, tensorPartials },
+      mgr.algorithm()));
+}
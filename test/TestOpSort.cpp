@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+TEST(TestOpSort, TestSortUintKeys)
+{
+    kp::Manager mgr;
+
+    // Past the maximum workgroups so every workgroup sorts several blocks
+    uint32_t size = KOMPUTE_SCAN_BLOCK_SIZE * KOMPUTE_SORT_MAX_WORKGROUPS + 123;
+    std::mt19937 generator(7);
+    std::vector<uint32_t> keys(size);
+    for (uint32_t& key : keys) {
+        key = generator();
+    }
+
+    auto tensorKeys = mgr.tensorT<uint32_t>(keys);
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorKeys })
+      ->record<kp::OpSort>({ tensorKeys }, mgr)
+      ->record<kp::OpTensorSyncLocal>({ tensorKeys })
+      ->eval();
+
+    std::sort(keys.begin(), keys.end());
+    EXPECT_EQ(tensorKeys->vector(), keys);
+}
+
+TEST(TestOpSort, TestSortFloatKeysWithPayload)
+{
+    kp::Manager mgr;
+
+    uint32_t size = 5000;
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<float> distribution(-100.0, 100.0);
+    std::vector<float> keys(size);
+    for (float& key : keys) {
+        key = distribution(generator);
+    }
+    keys[0] = -0.0;
+    std::vector<uint32_t> payload(size);
+    std::iota(payload.begin(), payload.end(), 0);
+
+    auto tensorKeys = mgr.tensor(keys);
+    auto tensorPayload = mgr.tensorT<uint32_t>(payload);
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorKeys, tensorPayload })
+      ->record<kp::OpSort>({ tensorKeys, tensorPayload }, mgr)
+      ->record<kp::OpTensorSyncLocal>({ tensorKeys, tensorPayload })
+      ->eval();
+
+    std::vector<uint32_t> expectedPayload = payload;
+    std::stable_sort(
+      expectedPayload.begin(),
+      expectedPayload.end(),
+      [&keys](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+    std::vector<float> expectedKeys(size);
+    for (uint32_t i = 0; i < size; i++) {
+        expectedKeys[i] = keys[expectedPayload[i]];
+    }
+
+    EXPECT_EQ(tensorKeys->vector(), expectedKeys);
+    EXPECT_EQ(tensorPayload->vector(), expectedPayload);
+}
+
+TEST(TestOpSort, TestSortIsStable)
+{
+    kp::Manager mgr;
+
+    uint32_t size = 3000;
+    std::vector<int32_t> keys(size);
+    std::vector<uint32_t> payload(size);
+    for (uint32_t i = 0; i < size; i++) {
+        keys[i] = (int32_t)((i * 7) % 5) - 2;
+        payload[i] = i;
+    }
+
+    auto tensorKeys = mgr.tensorT<int32_t>(keys);
+    auto tensorPayload = mgr.tensorT<uint32_t>(payload);
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorKeys, tensorPayload })
+      ->record<kp::OpSort>({ tensorKeys, tensorPayload }, mgr)
+      ->record<kp::OpTensorSyncLocal>({ tensorKeys, tensorPayload })
+      ->eval();
+
+    std::stable_sort(
+      payload.begin(), payload.end(), [&keys](uint32_t a, uint32_t b) {
+          return keys[a] < keys[b];
+      });
+    std::stable_sort(keys.begin(), keys.end());
+
+    EXPECT_EQ(tensorKeys->vector(), keys);
+    EXPECT_EQ(tensorPayload->vector(), payload);
+}
+
+TEST(TestOpSort, TestInvalidTensors)
+{
+    kp::Manager mgr;
+
+    auto tensorKeys = mgr.tensorT<uint32_t>({ 3, 1, 2 });
+    auto tensorDoubleKeys = mgr.tensorT<double>({ 3, 1, 2 });
+    auto tensorPayloadSmall = mgr.tensorT<uint32_t>({ 0, 1 });
+
+    EXPECT_THROW(kp::OpSort({ tensorDoubleKeys }, mgr), std::runtime_error);
+    EXPECT_THROW(kp::OpSort({ tensorKeys, tensorPayloadSmall }, mgr),
+                 std::runtime_error);
+    EXPECT_NO_THROW(kp::OpSort({ tensorKeys }, mgr));
+}
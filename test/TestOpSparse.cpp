@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+
+#include "kompute/Kompute.hpp"
+
+namespace {
+
+// CSR arrays of a rows x columns matrix with the given number of non zeros
+// in each row, at spread out columns, holding small integers so the float
+// sums are exact
+struct Csr
+{
+    std::vector<uint32_t> rowPointers;
+    std::vector<uint32_t> columnIndices;
+    std::vector<float> values;
+};
+
+Csr
+csrMatrix(uint32_t rows, uint32_t columns, uint32_t maxRowNonZeros)
+{
+    Csr csr;
+    csr.rowPointers.push_back(0);
+    for (uint32_t row = 0; row < rows; row++) {
+        uint32_t rowNonZeros = std::min((row * 7) % (maxRowNonZeros + 1),
+                                        columns);
+        for (uint32_t i = 0; i < rowNonZeros; i++) {
+            csr.columnIndices.push_back((row + i * 3) % columns);
+            csr.values.push_back((float)((row + i) % 5) - 2.0f);
+        }
+        csr.rowPointers.push_back(csr.columnIndices.size());
+    }
+    return csr;
+}
+
+std::vector<float>
+denseValues(uint32_t size)
+{
+    std::vector<float> values(size);
+    for (uint32_t i = 0; i < size; i++) {
+        values[i] = (float)(i % 7) - 3.0f;
+    }
+    return values;
+}
+
+// Reference product of the sparse matrix by a row-major matrix of n columns
+std::vector<float>
+spMM(const Csr& csr, const std::vector<float>& b, uint32_t rows, uint32_t n)
+{
+    std::vector<float> c(rows * n, 0.0);
+    for (uint32_t row = 0; row < rows; row++) {
+        for (uint32_t j = csr.rowPointers[row]; j < csr.rowPointers[row + 1];
+             j++) {
+            for (uint32_t column = 0; column < n; column++) {
+                c[row * n + column] +=
+                  csr.values[j] * b[csr.columnIndices[j] * n + column];
+            }
+        }
+    }
+    return c;
+}
+
+void
+testSpMV(uint32_t rows,
+         uint32_t columns,
+         uint32_t maxRowNonZeros,
+         uint32_t lanesPerRow)
+{
+    kp::Manager mgr;
+
+    Csr csr = csrMatrix(rows, columns, maxRowNonZeros);
+    std::vector<float> x = denseValues(columns);
+
+    std::shared_ptr<kp::SparseTensor> matrix = mgr.sparseTensor(
+      rows, columns, csr.rowPointers, csr.columnIndices, csr.values);
+    std::shared_ptr<kp::TensorT<float>> tensorX = mgr.tensor(x);
+    std::shared_ptr<kp::TensorT<float>> tensorY =
+      mgr.tensor(std::vector<float>(rows, 0.0));
+
+    std::vector<std::shared_ptr<kp::Tensor>> inputs = matrix->tensors();
+    inputs.push_back(tensorX);
+
+    std::shared_ptr<kp::OpSpMV> op = std::make_shared<kp::OpSpMV>(
+      matrix,
+      std::vector<std::shared_ptr<kp::Tensor>>{ tensorX, tensorY },
+      mgr.algorithm(),
+      lanesPerRow);
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>(inputs)
+      ->record(op)
+      ->record<kp::OpTensorSyncLocal>({ tensorY })
+      ->eval();
+
+    EXPECT_EQ(tensorY->vector(), spMM(csr, x, rows, 1));
+}
+
+void
+testSpMM(uint32_t rows, uint32_t columns, uint32_t maxRowNonZeros, uint32_t n)
+{
+    kp::Manager mgr;
+
+    Csr csr = csrMatrix(rows, columns, maxRowNonZeros);
+    std::vector<float> b = denseValues(columns * n);
+
+    std::shared_ptr<kp::SparseTensor> matrix = mgr.sparseTensor(
+      rows, columns, csr.rowPointers, csr.columnIndices, csr.values);
+    std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor(b);
+    std::shared_ptr<kp::TensorT<float>> tensorC =
+      mgr.tensor(std::vector<float>(rows * n, 0.0));
+
+    std::vector<std::shared_ptr<kp::Tensor>> inputs = matrix->tensors();
+    inputs.push_back(tensorB);
+
+    std::shared_ptr<kp::OpSpMM> op = std::make_shared<kp::OpSpMM>(
+      matrix,
+      std::vector<std::shared_ptr<kp::Tensor>>{ tensorB, tensorC },
+      mgr.algorithm(),
+      n);
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>(inputs)
+      ->record(op)
+      ->record<kp::OpTensorSyncLocal>({ tensorC })
+      ->eval();
+
+    EXPECT_EQ(tensorC->vector(), spMM(csr, b, rows, n));
+}
+
+}
+
+TEST(TestOpSparse, TestSpMV)
+{
+    testSpMV(100, 80, 6, 0);
+    testSpMV(37, 500, 200, 0);
+    testSpMV(37, 500, 200, 64);
+    testSpMV(9, 9, 3, 1);
+}
+
+TEST(TestOpSparse, TestSpMM)
+{
+    testSpMM(100, 80, 6, 1);
+    testSpMM(45, 30, 10, 5);
+    testSpMM(20, 16, 8, 130);
+}
+
+TEST(TestOpSparse, TestLanesPerRowFor)
+{
+    EXPECT_EQ(kp::OpSpMV::lanesPerRowFor(100, 0), 1);
+    EXPECT_EQ(kp::OpSpMV::lanesPerRowFor(100, 300), 4);
+    EXPECT_EQ(kp::OpSpMV::lanesPerRowFor(10, 100000),
+              KOMPUTE_SPMV_MAX_LANES_PER_ROW);
+}
+
+TEST(TestOpSparse, TestEmptyMatrix)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::SparseTensor> matrix =
+      mgr.sparseTensor(3, 4, { 0, 0, 0, 0 }, {}, {});
+    EXPECT_EQ(matrix->nonZeroCount(), 0);
+    EXPECT_EQ(matrix->values()->size(), 1);
+
+    std::shared_ptr<kp::TensorT<float>> tensorX = mgr.tensor({ 1, 2, 3, 4 });
+    std::shared_ptr<kp::TensorT<float>> tensorY = mgr.tensor({ 7, 7, 7 });
+
+    std::shared_ptr<kp::OpSpMV> op = std::make_shared<kp::OpSpMV>(
+      matrix,
+      std::vector<std::shared_ptr<kp::Tensor>>{ tensorX, tensorY },
+      mgr.algorithm());
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>(matrix->tensors())
+      ->record(op)
+      ->record<kp::OpTensorSyncLocal>({ tensorY })
+      ->eval();
+
+    EXPECT_EQ(tensorY->vector(), std::vector<float>({ 0, 0, 0 }));
+}
+
+TEST(TestOpSparse, TestInvalidParameters)
+{
+    kp::Manager mgr;
+
+    // Row pointers not ending at the non zeros, decreasing, and a column
+    // index out of range
+    EXPECT_THROW(mgr.sparseTensor(2, 2, { 0, 1, 1 }, { 0, 1 }, { 1, 2 }),
+                 std::runtime_error);
+    EXPECT_THROW(mgr.sparseTensor(2, 2, { 0, 2, 1 }, { 0 }, { 1 }),
+                 std::runtime_error);
+    EXPECT_THROW(mgr.sparseTensor(2, 2, { 0, 1, 2 }, { 0, 2 }, { 1, 2 }),
+                 std::runtime_error);
+
+    std::shared_ptr<kp::SparseTensor> matrix =
+      mgr.sparseTensor(2, 2, { 0, 1, 2 }, { 0, 1 }, { 1, 2 });
+    std::shared_ptr<kp::TensorT<float>> tensorX = mgr.tensor({ 1, 2 });
+    std::shared_ptr<kp::TensorT<float>> tensorY = mgr.tensor({ 0 });
+
+    // The output is too small, and the lanes not a power of two
+    EXPECT_THROW(kp::OpSpMV(matrix, { tensorX, tensorY }, mgr.algorithm()),
+                 std::runtime_error);
+    EXPECT_THROW(kp::OpSpMV(matrix, { tensorX, tensorX }, mgr.algorithm(), 3),
+                 std::runtime_error);
+    EXPECT_THROW(kp::OpSpMM(matrix, { tensorX, tensorY }, mgr.algorithm(), 2),
+                 std::runtime_error);
+}
@@ -141,6 +141,41 @@ TEST(TestOpTensorCopy, CopyHostToHostTensor)
     EXPECT_EQ(tensorA->vector(), tensorB->vector());
 }
 
+TEST(TestOpTensorCopy, BroadcastWithoutHostUpdate)
+{
+
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 1, 2, 3, 4 });
+    std::vector<std::shared_ptr<kp::Tensor>> tensors = { tensorA };
+    for (size_t i = 0; i < 8; i++) {
+        tensors.push_back(mgr.tensor({ 0, 0, 0, 0 }));
+    }
+    // Host tensors are written directly by the copy
+    tensors.push_back(
+      mgr.tensor({ 0, 0, 0, 0 }, kp::Tensor::TensorTypes::eHost));
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorA })
+      ->record<kp::OpTensorCopy>(
+        tensors,
+        std::vector<kp::Tensor::Range>{ { 1, 2 } },
+        kp::OpTensorCopy::HostUpdate::eNone)
+      ->eval();
+
+    // The staging memory of the device tensors is left untouched
+    EXPECT_EQ(tensors[1]->vector<float>(), std::vector<float>({ 0, 0, 0, 0 }));
+    EXPECT_EQ(tensors.back()->vector<float>(),
+              std::vector<float>({ 0, 2, 3, 0 }));
+
+    mgr.sequence()->eval<kp::OpTensorSyncLocal>(tensors);
+
+    for (size_t i = 1; i < tensors.size(); i++) {
+        EXPECT_EQ(tensors[i]->vector<float>(),
+                  std::vector<float>({ 0, 2, 3, 0 }));
+    }
+}
+
 TEST(TestOpTensorCopy, SingleTensorShouldFail)
 {
 
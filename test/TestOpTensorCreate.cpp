@@ -57,3 +57,64 @@ TEST(TestOpTensorCreate, ExceptionOnZeroSizeTensor)
                     std::string::npos);
     }
 }
+
+TEST(TestOpTensorCreate, AllocateOnlyTensors)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::Tensor> tensorStorage =
+      mgr.tensor(3, kp::Tensor::TensorDataTypes::eFloat,
+                 kp::Tensor::TensorTypes::eStorage);
+    std::shared_ptr<kp::Tensor> tensorZeros =
+      mgr.tensor(3, kp::Tensor::TensorDataTypes::eFloat,
+                 kp::Tensor::TensorTypes::eDevice, true);
+    std::shared_ptr<kp::Tensor> tensorOutput =
+      mgr.tensor(3, kp::Tensor::TensorDataTypes::eFloat);
+
+    EXPECT_TRUE(tensorStorage->isInit());
+    EXPECT_EQ(tensorStorage->rawData(), nullptr);
+    EXPECT_EQ(tensorStorage->memorySize(), 3 * sizeof(float));
+    EXPECT_EQ(tensorZeros->vector<float>(), std::vector<float>({ 0, 0, 0 }));
+
+    float one = 1;
+    uint32_t onePattern;
+    memcpy(&onePattern, &one, sizeof(float));
+
+    mgr.sequence()
+      ->record<kp::OpTensorFill>({ tensorStorage }, onePattern)
+      ->record<kp::OpTensorCopy>({ tensorStorage, tensorOutput })
+      ->record<kp::OpTensorSyncLocal>({ tensorOutput })
+      ->eval();
+
+    EXPECT_EQ(tensorOutput->vector<float>(), std::vector<float>({ 1, 1, 1 }));
+}
+
+TEST(TestOpTensorCreate, AllocateOnlyTensorWrittenInPlace)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::Tensor> tensorIn =
+      mgr.tensor(3,
+                 kp::Tensor::TensorDataTypes::eFloat,
+                 kp::Tensor::TensorTypes::eDevice,
+                 false,
+                 kp::Tensor::HostMemoryTypes::eCached);
+    std::shared_ptr<kp::Tensor> tensorOut =
+      mgr.tensor(3, kp::Tensor::TensorDataTypes::eFloat);
+
+    ASSERT_NE(tensorIn->rawData(), nullptr);
+
+    // The data is written straight into the mapped staging memory
+    float* data = tensorIn->data<float>();
+    for (uint32_t i = 0; i < 3; i++) {
+        data[i] = i + 1;
+    }
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorIn })
+      ->record<kp::OpTensorCopy>({ tensorIn, tensorOut })
+      ->record<kp::OpTensorSyncLocal>({ tensorOut })
+      ->eval();
+
+    EXPECT_EQ(tensorOut->vector<float>(), std::vector<float>({ 1, 2, 3 }));
+}
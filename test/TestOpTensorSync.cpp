@@ -52,3 +52,73 @@ TEST(TestOpTensorSync, SyncToDeviceMemoryMultiTensor)
     EXPECT_EQ(tensorB->vector(), testVec);
     EXPECT_EQ(tensorC->vector(), testVec);
 }
+
+TEST(TestOpTensorSync, SyncCachedHostMemoryTensors)
+{
+
+    kp::Manager mgr;
+
+    std::vector<float> testVec{ 9, 8, 7 };
+
+    std::shared_ptr<kp::TensorT<float>> tensorA =
+      mgr.tensor({ 0, 0, 0 },
+                 kp::Tensor::TensorTypes::eDevice,
+                 kp::Tensor::HostMemoryTypes::eCached);
+    std::shared_ptr<kp::TensorT<float>> tensorB =
+      mgr.tensor({ 0, 0, 0 },
+                 kp::Tensor::TensorTypes::eHost,
+                 kp::Tensor::HostMemoryTypes::eCached);
+
+    EXPECT_TRUE(tensorA->isInit());
+    EXPECT_TRUE(tensorB->isInit());
+    EXPECT_EQ(tensorA->hostMemoryType(), kp::Tensor::HostMemoryTypes::eCached);
+
+    tensorA->setData(testVec);
+
+    mgr.sequence()
+      ->eval<kp::OpTensorSyncDevice>({ tensorA })
+      ->eval<kp::OpTensorCopy>({ tensorA, tensorB })
+      ->eval<kp::OpTensorSyncLocal>({ tensorA, tensorB });
+
+    EXPECT_EQ(tensorA->vector(), testVec);
+    EXPECT_EQ(tensorB->vector(), testVec);
+}
+
+TEST(TestOpTensorSync, SyncDirtyRangesOnly)
+{
+
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensorA =
+      mgr.tensor({ 0, 0, 0, 0, 0, 0 });
+    std::shared_ptr<kp::TensorT<float>> tensorB =
+      mgr.tensor({ 0, 0, 0, 0, 0, 0 });
+
+    EXPECT_TRUE(tensorA->dirtyRanges().empty());
+
+    std::vector<float> head{ 1, 2 };
+    std::vector<float> tail{ 5, 6 };
+    tensorA->setRawData(head.data(), 0, 2);
+    tensorA->setRawData(tail.data(), 4, 2);
+    tensorA->markDirty(1, 1);
+
+    ASSERT_EQ(tensorA->dirtyRanges().size(), 2);
+    EXPECT_EQ(tensorA->dirtyRanges()[0].offset, 0);
+    EXPECT_EQ(tensorA->dirtyRanges()[0].count, 2);
+    EXPECT_EQ(tensorA->dirtyRanges()[1].offset, 4);
+    EXPECT_EQ(tensorA->dirtyRanges()[1].count, 2);
+
+    mgr.sequence()
+      ->eval<kp::OpTensorSyncDevice>({ tensorA }, tensorA->dirtyRanges())
+      ->eval<kp::OpTensorCopy>({ tensorA, tensorB }, tensorA->dirtyRanges());
+
+    tensorA->clearDirtyRanges();
+    EXPECT_TRUE(tensorA->dirtyRanges().empty());
+
+    // Only the second range is read back, the rest remains as set on host
+    tensorB->setData({ 9, 9, 9, 9, 9, 9 });
+    mgr.sequence()->eval<kp::OpTensorSyncLocal>(
+      { tensorB }, std::vector<kp::Tensor::Range>{ { 4, 2 } });
+
+    EXPECT_EQ(tensorB->vector(), std::vector<float>({ 9, 9, 9, 9, 5, 6 }));
+}
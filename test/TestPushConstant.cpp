@@ -364,3 +364,122 @@ TEST(TestPushConstants, TestConstantsDouble)
         }
     }
 }
+
+TEST(TestPushConstants, TestUniformTensorParametersWithoutRerecord)
+{
+    std::string shader(R"(
+      #version 450
+      layout (local_size_x = 1) in;
+      layout(set = 0, binding = 0) buffer a { float pa[]; };
+      layout(set = 0, binding = 1) uniform Params { float scale; } params;
+      void main() {
+          uint index = gl_GlobalInvocationID.x;
+          pa[index] = pa[index] * params.scale;
+      })");
+
+    std::vector<uint32_t> spirv = compileSource(shader);
+
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensor = mgr.tensor({ 1, 2, 3 });
+    std::shared_ptr<kp::TensorT<float>> params =
+      mgr.tensor({ 1 }, kp::Tensor::TensorTypes::eUniform);
+
+    EXPECT_EQ(params->descriptorType(), vk::DescriptorType::eUniformBuffer);
+    EXPECT_EQ(tensor->descriptorType(), vk::DescriptorType::eStorageBuffer);
+
+    std::shared_ptr<kp::Algorithm> algo =
+      mgr.algorithm({ tensor, params }, spirv, kp::Workgroup({ 3 }));
+
+    std::shared_ptr<kp::Sequence> sq = mgr.sequence();
+    sq->eval<kp::OpTensorSyncDevice>({ tensor });
+
+    // Recorded once, the parameter is written on the host before each eval
+    sq->record<kp::OpAlgoDispatch>(algo);
+    for (float scale : { 2.0f, 3.0f, 0.5f }) {
+        params->setData({ scale });
+        sq->eval();
+    }
+
+    mgr.sequence()->eval<kp::OpTensorSyncLocal>({ tensor });
+
+    EXPECT_EQ(tensor->vector(), std::vector<float>({ 3, 6, 9 }));
+}
+
+TEST(TestPushConstants, TestConstantsInPlaceUpdates)
+{
+    std::string shader(R"(
+      #version 450
+      layout(push_constant) uniform PushConstants {
+        float x;
+        float y;
+        float z;
+      } pcs;
+      layout (local_size_x = 1) in;
+      layout(set = 0, binding = 0) buffer a { float pa[]; };
+      void main() {
+          pa[0] += pcs.x;
+          pa[1] += pcs.y;
+          pa[2] += pcs.z;
+      })");
+
+    std::vector<uint32_t> spirv = compileSource(shader);
+
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensor = mgr.tensor({ 0, 0, 0 });
+
+    std::shared_ptr<kp::Algorithm> algo = mgr.algorithm(
+      { tensor }, spirv, kp::Workgroup({ 1 }), {}, { 0.0, 0.0, 0.0 });
+
+    // Single constants are written in place
+    algo->setPushConstant<float>(1, 2.0);
+    EXPECT_EQ(algo->getPushConstants<float>(),
+              std::vector<float>({ 0.0, 2.0, 0.0 }));
+
+    std::shared_ptr<kp::Sequence> sq =
+      mgr.sequence()->eval<kp::OpTensorSyncDevice>({ tensor });
+    sq->eval<kp::OpAlgoDispatch>(algo);
+    sq->eval<kp::OpAlgoDispatch>(algo, std::array<float, 3>{ 1.0, 1.0, 1.0 });
+    sq->eval<kp::OpTensorSyncLocal>({ tensor });
+
+    EXPECT_EQ(tensor->vector(), std::vector<float>({ 1.0, 3.0, 1.0 }));
+
+    algo->setPushConstants(std::array<float, 3>{ 3.0, 2.0, 1.0 });
+    EXPECT_EQ(algo->getPushConstants<float>(),
+              std::vector<float>({ 3.0, 2.0, 1.0 }));
+
+    EXPECT_ANY_THROW(algo->setPushConstant<float>(3, 1.0));
+    EXPECT_ANY_THROW(algo->setPushConstant<double>(0, 1.0));
+    EXPECT_ANY_THROW(algo->setPushConstants(std::array<float, 2>{ 1.0, 1.0 }));
+}
+
+TEST(TestPushConstants, TestConstantsExceedDeviceLimit)
+{
+    std::string shader(R"(
+      #version 450
+      layout(push_constant) uniform PushConstants { float x; } pcs;
+      layout (local_size_x = 1) in;
+      layout(set = 0, binding = 0) buffer a { float pa[]; };
+      void main() {
+          pa[0] += pcs.x;
+      })");
+
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensor = mgr.tensor({ 0 });
+
+    // One constant more than the device allows, which may be lower than
+    // KOMPUTE_MAX_PUSH_CONSTANTS_SIZE
+    uint32_t maxPushConstantsSize =
+      std::min<uint32_t>(mgr.getDeviceProperties().limits.maxPushConstantsSize,
+                         KOMPUTE_MAX_PUSH_CONSTANTS_SIZE);
+    std::vector<float> pushConstants(maxPushConstantsSize / sizeof(float) + 1);
+
+    EXPECT_THROW(mgr.algorithm({ tensor },
+                               compileSource(shader),
+                               kp::Workgroup({ 1 }),
+                               {},
+                               pushConstants),
+                 std::runtime_error);
+}
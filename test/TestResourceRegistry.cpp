@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+namespace {
+
+struct Resource
+{
+    Resource(int value)
+      : value(value)
+    {
+    }
+    virtual ~Resource() {}
+    int value;
+};
+
+struct DerivedResource : public Resource
+{
+    DerivedResource(int value)
+      : Resource(value)
+    {
+    }
+};
+
+}
+
+TEST(TestResourceRegistry, ReleasedResourcesDeregister)
+{
+    std::shared_ptr<kp::ResourceRegistry<Resource>> registry =
+      std::make_shared<kp::ResourceRegistry<Resource>>();
+
+    std::shared_ptr<Resource> kept = registry->add(new Resource(1));
+    for (int i = 0; i < 1000; i++) {
+        std::shared_ptr<DerivedResource> released =
+          registry->add(new DerivedResource(i));
+        EXPECT_EQ(registry->size(), 2);
+    }
+
+    // The slots of the released resources are reused
+    EXPECT_EQ(registry->size(), 1);
+    EXPECT_EQ(registry->capacity(), 2);
+
+    std::vector<std::shared_ptr<Resource>> resources = registry->resources();
+    EXPECT_EQ(resources.size(), 1);
+    EXPECT_EQ(resources[0]->value, 1);
+}
+
+TEST(TestResourceRegistry, TakeAndOutliveRegistry)
+{
+    std::shared_ptr<kp::ResourceRegistry<Resource>> registry =
+      std::make_shared<kp::ResourceRegistry<Resource>>();
+
+    std::shared_ptr<Resource> taken = registry->add(new Resource(1));
+    std::shared_ptr<Resource> outliving = registry->add(new Resource(2));
+
+    EXPECT_EQ(registry->take().size(), 2);
+    EXPECT_EQ(registry->size(), 0);
+
+    // A resource taken finds its slot dropped when released later
+    std::shared_ptr<Resource> added = registry->add(new Resource(3));
+    taken = nullptr;
+    EXPECT_EQ(registry->size(), 1);
+
+    registry = nullptr;
+    EXPECT_EQ(outliving->value, 2);
+    outliving = nullptr;
+    EXPECT_EQ(added->value, 3);
+}
+
+TEST(TestResourceRegistry, ConcurrentAddAndRelease)
+{
+    std::shared_ptr<kp::ResourceRegistry<Resource>> registry =
+      std::make_shared<kp::ResourceRegistry<Resource>>();
+
+    std::vector<std::thread> threads;
+    std::vector<std::vector<std::shared_ptr<Resource>>> kept(8);
+    for (uint32_t t = 0; t < kept.size(); t++) {
+        threads.push_back(std::thread([&, t]() {
+            for (int i = 0; i < 1000; i++) {
+                std::shared_ptr<Resource> resource =
+                  registry->add(new Resource(i));
+                if (i % 100 == 0) {
+                    kept[t].push_back(resource);
+                }
+            }
+        }));
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(registry->size(), 80);
+    EXPECT_EQ(registry->resources().size(), 80);
+    EXPECT_LE(registry->capacity(), 80 + threads.size());
+}
@@ -104,6 +104,49 @@ TEST(TestSequence, RerecordSequence)
     EXPECT_EQ(tensorB->vector(), std::vector<float>({ 2, 8, 18 }));
 }
 
+TEST(TestSequence, RecordManyOperations)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 1, 2, 3 });
+    std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor({ 0, 0, 0 });
+
+    std::vector<uint32_t> spirv = compileSource(R"(
+        #version 450
+
+        layout (local_size_x = 1) in;
+
+        layout(set = 0, binding = 0) buffer bina { float tina[]; };
+
+        void main() {
+            uint index = gl_GlobalInvocationID.x;
+            tina[index] = tina[index] + 1;
+        }
+    )");
+
+    std::shared_ptr<kp::Algorithm> algo = mgr.algorithm({ tensorA }, spirv);
+
+    std::vector<std::shared_ptr<kp::OpBase>> ops = {
+        std::make_shared<kp::OpTensorSyncDevice>(
+          std::vector<std::shared_ptr<kp::Tensor>>{ tensorA })
+    };
+    for (uint32_t i = 0; i < 100; i++) {
+        ops.push_back(std::make_shared<kp::OpAlgoDispatch>(algo));
+    }
+    ops.push_back(std::make_shared<kp::OpTensorCopy>(
+      std::vector<std::shared_ptr<kp::Tensor>>{ tensorA, tensorB }));
+    ops.push_back(std::make_shared<kp::OpTensorSyncLocal>(
+      std::vector<std::shared_ptr<kp::Tensor>>{ tensorA, tensorB }));
+
+    std::shared_ptr<kp::Sequence> sq = mgr.sequence()->record(ops);
+    EXPECT_EQ(sq->operations().size(), ops.size());
+
+    sq->eval();
+
+    EXPECT_EQ(tensorA->vector(), std::vector<float>({ 101, 102, 103 }));
+    EXPECT_EQ(tensorB->vector(), std::vector<float>({ 101, 102, 103 }));
+}
+
 TEST(TestSequence, SequenceTimestamps)
 {
     kp::Manager mgr;
@@ -134,6 +177,127 @@ TEST(TestSequence, SequenceTimestamps)
               6); // 1 timestamp at start + 1 after each operation
 }
 
+TEST(TestSequence, SequenceOpTimings)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::Tensor> tensorA = mgr.tensor({ 0, 0, 0 });
+
+    std::string shader(R"(
+      #version 450
+      layout (local_size_x = 1) in;
+      layout(set = 0, binding = 0) buffer a { float pa[]; };
+      void main() {
+          uint index = gl_GlobalInvocationID.x;
+          pa[index] = pa[index] + 1;
+      })");
+
+    std::vector<uint32_t> spirv = compileSource(shader);
+
+    auto seq = mgr.sequence(0, 10);
+    seq->record<kp::OpTensorSyncDevice>({ tensorA })
+      ->record(std::make_shared<kp::OpAlgoDispatch>(
+                 mgr.algorithm({ tensorA }, spirv)),
+               "increment")
+      ->record<kp::OpTensorSyncLocal>({ tensorA });
+
+    // The queries are reset by each submission, so the timings are
+    // available again after every eval
+    for (uint32_t i = 0; i < 3; i++) {
+        seq->eval();
+
+        std::vector<kp::Sequence::OpTiming> timings = seq->getOpTimings();
+        ASSERT_EQ(timings.size(), 3);
+        EXPECT_EQ(timings[0].label, "OpTensorSyncDevice");
+        EXPECT_EQ(timings[1].label, "increment");
+        EXPECT_EQ(timings[2].label, "OpTensorSyncLocal");
+        for (const kp::Sequence::OpTiming& timing : timings) {
+            EXPECT_GE(timing.durationNs, 0);
+        }
+
+        // The submission completed, so the timestamps are available
+        EXPECT_EQ(seq->getOpTimings(false).size(), 3);
+    }
+
+    EXPECT_EQ(tensorA->vector<float>(), std::vector<float>({ 3, 3, 3 }));
+}
+
+TEST(TestSequence, SequenceDebugNames)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::Tensor> tensorA = mgr.tensor({ 0, 0, 0 });
+    tensorA->setName("tensorA");
+
+    std::string shader(R"(
+      #version 450
+      layout (local_size_x = 1) in;
+      layout(set = 0, binding = 0) buffer a { float pa[]; };
+      void main() {
+          uint index = gl_GlobalInvocationID.x;
+          pa[index] = pa[index] + 1;
+      })");
+
+    std::shared_ptr<kp::Algorithm> algorithm =
+      mgr.algorithm({ tensorA }, compileSource(shader));
+    algorithm->setName("increment");
+
+    auto seq = mgr.sequence();
+    seq->setName("sequence");
+
+    // The names are kept whether VK_EXT_debug_utils is enabled or not, and
+    // the labels of the operations do not change the results
+    seq->record<kp::OpTensorSyncDevice>({ tensorA })
+      ->record(std::make_shared<kp::OpAlgoDispatch>(algorithm), "dispatch")
+      ->record<kp::OpTensorSyncLocal>({ tensorA })
+      ->eval();
+
+    EXPECT_EQ(tensorA->name(), "tensorA");
+    EXPECT_EQ(algorithm->name(), "increment");
+    EXPECT_EQ(seq->name(), "sequence");
+    EXPECT_EQ(tensorA->vector<float>(), std::vector<float>({ 1, 1, 1 }));
+
+    // Rebuilt buffers are named again
+    tensorA->rebuild(std::vector<float>(16, 0).data(), 16, sizeof(float));
+    EXPECT_EQ(tensorA->name(), "tensorA");
+}
+
+TEST(TestSequence, SequencePipelineStatistics)
+{
+    kp::Manager mgr;
+
+    if (!mgr.listDevices()[0].getFeatures().pipelineStatisticsQuery) {
+        GTEST_SKIP() << "Device has no pipeline statistics queries";
+    }
+
+    std::shared_ptr<kp::Tensor> tensorA = mgr.tensor({ 0, 0, 0 });
+
+    std::string shader(R"(
+      #version 450
+      layout (local_size_x = 1) in;
+      layout(set = 0, binding = 0) buffer a { float pa[]; };
+      void main() {
+          uint index = gl_GlobalInvocationID.x;
+          pa[index] = pa[index] + 1;
+      })");
+
+    std::vector<uint32_t> spirv = compileSource(shader);
+
+    // Statistics without timestamps still give an entry per operation
+    auto seq = mgr.sequence(0, 0, 1, false, 10);
+    seq->record<kp::OpTensorSyncDevice>({ tensorA })
+      ->record<kp::OpAlgoDispatch>(mgr.algorithm({ tensorA }, spirv))
+      ->record<kp::OpTensorSyncLocal>({ tensorA })
+      ->eval();
+
+    std::vector<kp::Sequence::OpTiming> timings = seq->getOpTimings();
+    ASSERT_EQ(timings.size(), 3);
+    EXPECT_EQ(timings[0].computeInvocations, 0);
+    EXPECT_GE(timings[1].computeInvocations, 3);
+    EXPECT_EQ(timings[2].computeInvocations, 0);
+    EXPECT_EQ(timings[1].durationNs, 0);
+}
+
 TEST(TestSequence, UtilsClearRecordingRunning)
 {
     kp::Manager mgr;
@@ -242,3 +406,206 @@ TEST(TestSequence, CorrectSequenceRunningError)
 
     EXPECT_EQ(tensorOut->vector(), std::vector<float>({ 2, 4, 6 }));
 }
+
+TEST(TestSequence, RepeatedEvalsReuseFence)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 1, 2, 3 });
+    std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor({ 0, 0, 0 });
+
+    std::shared_ptr<kp::Sequence> sq = mgr.sequence();
+
+    EXPECT_TRUE(sq->isComplete());
+
+    sq->record<kp::OpTensorSyncDevice>({ tensorA })
+      ->record<kp::OpTensorCopy>({ tensorA, tensorB })
+      ->record<kp::OpTensorSyncLocal>({ tensorB });
+
+    for (uint32_t i = 0; i < 100; i++) {
+        tensorA->setData({ (float)i, (float)i, (float)i });
+
+        sq->evalAsync();
+        while (!sq->isComplete()) {
+        }
+        sq->evalAwait();
+
+        EXPECT_TRUE(sq->isComplete());
+        EXPECT_EQ(tensorB->vector(),
+                  std::vector<float>({ (float)i, (float)i, (float)i }));
+    }
+}
+
+TEST(TestSequence, ResetSequenceAndSharedCommandPool)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 1, 2, 3 });
+    std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor({ 0, 0, 0 });
+    std::shared_ptr<kp::TensorT<float>> tensorC = mgr.tensor({ 0, 0, 0 });
+
+    std::shared_ptr<kp::Sequence> sqA = mgr.sequence(0, 0, 2, true);
+    std::shared_ptr<kp::Sequence> sqB = mgr.sequence(0, 0, 1, true);
+
+    sqA->record<kp::OpTensorSyncDevice>({ tensorA })
+      ->record<kp::OpTensorCopy>({ tensorA, tensorB })
+      ->record<kp::OpTensorSyncLocal>({ tensorB })
+      ->eval();
+
+    EXPECT_EQ(tensorB->vector(), std::vector<float>({ 1, 2, 3 }));
+
+    // Resetting discards the operations and the recording in progress
+    sqA->record<kp::OpTensorCopy>({ tensorA, tensorC });
+    sqA->reset();
+
+    EXPECT_FALSE(sqA->isRecording());
+
+    sqA->eval();
+
+    EXPECT_EQ(tensorC->vector(), std::vector<float>({ 0, 0, 0 }));
+
+    sqA->record<kp::OpTensorCopy>({ tensorA, tensorC })
+      ->record<kp::OpTensorSyncLocal>({ tensorC })
+      ->eval();
+    sqB->eval<kp::OpTensorSyncLocal>({ tensorB });
+
+    EXPECT_EQ(tensorC->vector(), std::vector<float>({ 1, 2, 3 }));
+
+    sqA->evalAsync();
+    EXPECT_ANY_THROW(sqA->reset());
+    sqA->evalAwait();
+
+    // Destroying a sequence leaves the pool shared with the other one
+    sqA->destroy();
+    sqB->eval<kp::OpTensorSyncLocal>({ tensorB });
+
+    EXPECT_EQ(tensorB->vector(), std::vector<float>({ 1, 2, 3 }));
+}
+
+TEST(TestSequence, MultipleSubmissionsInFlight)
+{
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 1, 2, 3 });
+    std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor({ 0, 0, 0 });
+
+    std::shared_ptr<kp::Sequence> sq = mgr.sequence(0, 0, 3);
+
+    EXPECT_EQ(sq->inFlightDepth(), 3);
+    EXPECT_EQ(sq->inFlightCount(), 0);
+
+    sq->record<kp::OpTensorSyncDevice>({ tensorA })
+      ->record<kp::OpTensorCopy>({ tensorA, tensorB })
+      ->record<kp::OpTensorSyncLocal>({ tensorB });
+
+    for (uint32_t i = 0; i < 3; i++) {
+        sq->evalAsync();
+        EXPECT_EQ(sq->inFlightCount(), i + 1);
+    }
+    EXPECT_TRUE(sq->isRunning());
+    EXPECT_ANY_THROW(sq->evalAsync());
+
+    sq->evalAwait();
+    EXPECT_EQ(sq->inFlightCount(), 2);
+    sq->evalAsync();
+
+    while (sq->isRunning()) {
+        sq->evalAwait();
+    }
+    EXPECT_EQ(sq->inFlightCount(), 0);
+    EXPECT_EQ(tensorB->vector(), std::vector<float>({ 1, 2, 3 }));
+
+    // Recording again replaces the operations in every command buffer
+    tensorA->setData({ 4, 5, 6 });
+    sq->eval<kp::OpTensorSyncDevice>({ tensorA });
+    sq->evalAsync()->evalAsync()->evalAwait()->evalAwait();
+    sq->eval<kp::OpTensorSyncLocal>({ tensorA });
+    EXPECT_EQ(tensorA->vector(), std::vector<float>({ 4, 5, 6 }));
+
+    EXPECT_ANY_THROW(mgr.sequence(0, 0, 0));
+}
+
+TEST(TestSequence, TimelineSemaphoreDependencies)
+{
+    kp::Manager mgr(0, {}, { VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME });
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 1, 2, 3 });
+    std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor({ 0, 0, 0 });
+    std::shared_ptr<kp::TensorT<float>> tensorC = mgr.tensor({ 0, 0, 0 });
+
+    std::shared_ptr<kp::Sequence> sqA = mgr.sequence();
+    std::shared_ptr<kp::Sequence> sqB = mgr.sequence();
+
+    sqA->record<kp::OpTensorSyncDevice>({ tensorA })
+      ->record<kp::OpTensorCopy>({ tensorA, tensorB });
+    sqB->record<kp::OpTensorCopy>({ tensorB, tensorC })
+      ->record<kp::OpTensorSyncLocal>({ tensorC });
+
+    // Devices without the extension cannot express the dependency
+    if (!mgr.hasTimelineSemaphores()) {
+        EXPECT_ANY_THROW(sqB->evalAsync({ sqA }));
+        return;
+    }
+
+    for (uint32_t i = 0; i < 10; i++) {
+        tensorA->setData({ (float)i, (float)i, (float)i });
+
+        sqA->evalAsync();
+        sqB->evalAsync({ sqA });
+
+        // The dependency is resolved on the GPU, so sqB completing implies
+        // that sqA completed as well
+        sqB->evalAwait();
+        EXPECT_TRUE(sqA->isComplete());
+        sqA->evalAwait();
+
+        EXPECT_EQ(tensorC->vector(),
+                  std::vector<float>({ (float)i, (float)i, (float)i }));
+    }
+}
+
+TEST(TestSequence, BatchedSubmission)
+{
+    kp::Manager mgr;
+
+    uint32_t sequenceCount = 50;
+    std::vector<std::shared_ptr<kp::TensorT<float>>> tensors;
+    std::vector<std::shared_ptr<kp::Sequence>> sequences;
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 1, 2, 3 });
+    mgr.sequence()->eval<kp::OpTensorSyncDevice>({ tensorA });
+
+    for (uint32_t i = 0; i < sequenceCount; i++) {
+        std::shared_ptr<kp::TensorT<float>> tensor = mgr.tensor({ 0, 0, 0 });
+        std::shared_ptr<kp::Sequence> sq = mgr.sequence();
+        sq->record<kp::OpTensorCopy>({ tensorA, tensor })
+          ->record<kp::OpTensorSyncLocal>({ tensor });
+
+        tensors.push_back(tensor);
+        sequences.push_back(sq);
+    }
+
+    std::shared_ptr<kp::SubmitBatch> batch = mgr.submit(sequences);
+
+    // All the sequences share the single queue of the manager
+    EXPECT_EQ(batch->queueSubmitCount(), 1);
+    EXPECT_TRUE(sequences[0]->isRunning());
+
+    // The depth of the sequences is already in use by the batch
+    EXPECT_ANY_THROW(mgr.submit({ sequences[0] }));
+
+    EXPECT_TRUE(batch->await());
+    EXPECT_TRUE(batch->isComplete());
+
+    for (uint32_t i = 0; i < sequenceCount; i++) {
+        EXPECT_FALSE(sequences[i]->isRunning());
+        EXPECT_EQ(tensors[i]->vector(), std::vector<float>({ 1, 2, 3 }));
+    }
+
+    // Sequences submitted in a batch can still be awaited individually
+    batch = mgr.submit({ sequences[0], sequences[1] });
+    sequences[0]->evalAwait();
+    EXPECT_FALSE(sequences[0]->isRunning());
+    EXPECT_TRUE(batch->await());
+    EXPECT_FALSE(sequences[1]->isRunning());
+}
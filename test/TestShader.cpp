@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdio>
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+namespace {
+
+const std::string source(R"(
+    #version 450
+
+    layout (local_size_x = 1) in;
+
+    layout(set = 0, binding = 0) buffer tensorA { float valuesA[]; };
+
+    void main()
+    {
+        uint index = gl_GlobalInvocationID.x;
+        valuesA[index] = valuesA[index] * SCALE;
+    }
+)");
+
+}
+
+TEST(TestShader, TestKeyDependsOnSourceAndOptions)
+{
+    std::string key = kp::Shader::key(source, { { "SCALE", "2.0" } });
+
+    EXPECT_EQ(key.size(), 16);
+    EXPECT_EQ(key, kp::Shader::key(source, { { "SCALE", "2.0" } }));
+    EXPECT_NE(key, kp::Shader::key(source, { { "SCALE", "3.0" } }));
+    EXPECT_NE(key, kp::Shader::key(source + " ", { { "SCALE", "2.0" } }));
+    EXPECT_NE(key, kp::Shader::key(source, { { "SCALE", "2.0" } },
+                                   kp::Shader::Language::eHlsl));
+    EXPECT_NE(key, kp::Shader::key(source, { { "SCALE", "2.0" } },
+                                   kp::Shader::Language::eGlsl, "other"));
+    EXPECT_NE(kp::Shader::key("ab", { { "c", "" } }),
+              kp::Shader::key("a", { { "bc", "" } }));
+}
+
+TEST(TestShader, TestReadsOnDiskCache)
+{
+    std::vector<uint32_t> spirv = { 0x07230203, 0x00010000, 1, 2, 3 };
+    std::string key = kp::Shader::key(source, { { "SCALE", "4.0" } });
+    std::string path = "./" + key + ".spv";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write((const char*)spirv.data(), spirv.size() * sizeof(uint32_t));
+    }
+
+    kp::Shader::clearCache();
+    kp::Shader::setCacheDirectory(".");
+    EXPECT_EQ(kp::Shader::cacheDirectory(), ".");
+    EXPECT_EQ(kp::Shader::compile(source, { { "SCALE", "4.0" } }), spirv);
+
+    // Served from the in-memory cache once the file is removed
+    std::remove(path.c_str());
+    EXPECT_EQ(kp::Shader::compile(source, { { "SCALE", "4.0" } }), spirv);
+
+    kp::Shader::clearCache();
+    kp::Shader::setCacheDirectory("");
+    if (!kp::Shader::compilerAvailable()) {
+        EXPECT_THROW(kp::Shader::compile(source, { { "SCALE", "4.0" } }),
+                     std::runtime_error);
+    }
+}
+
+TEST(TestShader, TestCompileWithDefinitions)
+{
+    if (!kp::Shader::compilerAvailable()) {
+        GTEST_SKIP() << "Kompute built without the shader compiler";
+    }
+
+    kp::Shader::clearCache();
+    std::vector<uint32_t> spirv =
+      kp::Shader::compile(source, { { "SCALE", "2.0" } });
+    EXPECT_EQ(kp::Shader::compile(source, { { "SCALE", "2.0" } }), spirv);
+    EXPECT_THROW(kp::Shader::compile(source), std::runtime_error);
+
+    kp::Manager mgr;
+
+    std::shared_ptr<kp::TensorT<float>> tensor = mgr.tensor({ 1, 2, 3 });
+    std::vector<std::shared_ptr<kp::Tensor>> params = { tensor };
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>(params)
+      ->record<kp::OpAlgoDispatch>(mgr.algorithm(params, spirv))
+      ->record<kp::OpTensorSyncLocal>(params)
+      ->eval();
+
+    EXPECT_EQ(tensor->vector(), std::vector<float>({ 2, 4, 6 }));
+}
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+TEST(TestStagingRing, TensorsHoldNoStagingBuffer)
+{
+    kp::Manager mgr;
+    mgr.enableStagingRing();
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 1, 2, 3 });
+    std::shared_ptr<kp::TensorT<float>> tensorB =
+      mgr.tensor({ 1, 2, 3 }, kp::Tensor::TensorTypes::eHost);
+
+    EXPECT_TRUE(tensorA->isInit());
+    EXPECT_TRUE(tensorA->usesStagingRing());
+    EXPECT_FALSE(tensorB->usesStagingRing());
+    EXPECT_EQ(tensorA->vector(), std::vector<float>({ 1, 2, 3 }));
+}
+
+TEST(TestStagingRing, OpMultThroughStagingRing)
+{
+    kp::Manager mgr;
+    mgr.enableStagingRing();
+
+    std::shared_ptr<kp::TensorT<float>> tensorLHS = mgr.tensor({ 0, 1, 2 });
+    std::shared_ptr<kp::TensorT<float>> tensorRHS = mgr.tensor({ 2, 4, 6 });
+    std::shared_ptr<kp::TensorT<float>> tensorOutput = mgr.tensor({ 0, 0, 0 });
+
+    std::vector<std::shared_ptr<kp::Tensor>> params = { tensorLHS,
+                                                        tensorRHS,
+                                                        tensorOutput };
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>(params)
+      ->record<kp::OpMult>(params, mgr.algorithm())
+      ->record<kp::OpTensorSyncLocal>(params)
+      ->eval();
+
+    EXPECT_EQ(tensorOutput->vector(), std::vector<float>({ 0, 4, 12 }));
+}
+
+TEST(TestStagingRing, LargeTransferSplitAcrossSlots)
+{
+    kp::Manager mgr;
+    // Slots of 64 bytes so the tensor below is streamed in many chunks
+    mgr.enableStagingRing(256);
+
+    std::vector<float> data(1000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = i;
+    }
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor(data);
+    std::shared_ptr<kp::TensorT<float>> tensorB =
+      mgr.tensor(std::vector<float>(data.size(), 0));
+
+    mgr.sequence()
+      ->eval<kp::OpTensorSyncDevice>({ tensorA, tensorB })
+      ->eval<kp::OpTensorCopy>({ tensorA, tensorB });
+
+    tensorB->setData(std::vector<float>(data.size(), 0));
+
+    mgr.sequence()->eval<kp::OpTensorSyncLocal>({ tensorB });
+
+    EXPECT_EQ(tensorB->vector(), data);
+}
+
+TEST(TestStagingRing, SyncsOnlyAtSequenceEnds)
+{
+    kp::Manager mgr;
+    mgr.enableStagingRing();
+
+    std::shared_ptr<kp::TensorT<float>> tensorA = mgr.tensor({ 1, 2, 3 });
+    std::shared_ptr<kp::TensorT<float>> tensorB = mgr.tensor({ 0, 0, 0 });
+
+    EXPECT_ANY_THROW(mgr.sequence()
+                       ->record<kp::OpTensorCopy>({ tensorA, tensorB })
+                       ->record<kp::OpTensorSyncDevice>({ tensorA }));
+
+    EXPECT_ANY_THROW(mgr.sequence()
+                       ->record<kp::OpTensorSyncLocal>({ tensorA })
+                       ->record<kp::OpTensorCopy>({ tensorA, tensorB }));
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorA })
+      ->record<kp::OpTensorSyncDevice>({ tensorB })
+      ->record<kp::OpTensorCopy>({ tensorA, tensorB })
+      ->record<kp::OpTensorSyncLocal>({ tensorA })
+      ->record<kp::OpTensorSyncLocal>({ tensorB })
+      ->eval();
+
+    EXPECT_EQ(tensorB->vector(), std::vector<float>({ 1, 2, 3 }));
+}
@@ -4,6 +4,8 @@
 
 #include "kompute/Kompute.hpp"
 
+#include "kompute_test/Shader.hpp"
+
 TEST(TestTensor, ConstructorData)
 {
     kp::Manager mgr;
@@ -42,3 +44,327 @@ TEST(TestTensor, DataTypes)
         EXPECT_EQ(tensor->dataType(), kp::Tensor::TensorDataTypes::eDouble);
     }
 }
+
+TEST(TestTensor, NarrowDataTypes)
+{
+    kp::Manager mgr;
+
+    std::vector<kp::Half> halves{ 0.5f, -1.0f, 2.0f };
+    std::shared_ptr<kp::TensorT<kp::Half>> tensorHalf = mgr.tensorT(halves);
+    EXPECT_EQ(tensorHalf->dataType(), kp::Tensor::TensorDataTypes::eHalf);
+    EXPECT_EQ(tensorHalf->dataTypeMemorySize(), 2);
+
+    // Odd byte sizes are copied through buffers rounded up to whole words
+    std::shared_ptr<kp::TensorT<int8_t>> tensorA =
+      mgr.tensorT<int8_t>({ -128, -1, 0, 1, 127 });
+    std::shared_ptr<kp::TensorT<int8_t>> tensorB =
+      mgr.tensorT<int8_t>({ 0, 0, 0, 0, 0 });
+    EXPECT_EQ(tensorA->dataType(), kp::Tensor::TensorDataTypes::eInt8);
+    EXPECT_EQ(tensorA->memorySize(), 5);
+
+    std::shared_ptr<kp::TensorT<uint8_t>> tensorU8 =
+      mgr.tensorT<uint8_t>({ 0, 255, 3 });
+    EXPECT_EQ(tensorU8->dataType(),
+              kp::Tensor::TensorDataTypes::eUnsignedInt8);
+
+    std::shared_ptr<kp::TensorT<int16_t>> tensorI16 =
+      mgr.tensorT<int16_t>({ -32768, 0, 32767 });
+    EXPECT_EQ(tensorI16->dataType(), kp::Tensor::TensorDataTypes::eInt16);
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorA, tensorB })
+      ->record<kp::OpTensorCopy>({ tensorA, tensorB })
+      ->record<kp::OpTensorSyncLocal>({ tensorB })
+      ->eval();
+
+    EXPECT_EQ(tensorA->vector(), tensorB->vector());
+}
+
+TEST(TestTensor, HalfConversion)
+{
+    EXPECT_EQ(kp::Half(1.0f).bits, 0x3c00);
+    EXPECT_EQ(kp::Half(-2.0f).bits, 0xc000);
+    EXPECT_EQ(kp::Half(65504.0f).bits, 0x7bff);
+    EXPECT_EQ(kp::Half(1e6f).bits, 0x7c00);
+    EXPECT_EQ(kp::Half(5.960464e-8f).bits, 0x0001);
+
+    // Ties round to the even half
+    EXPECT_EQ(kp::Half(1.0f + 1.0f / 2048).bits, 0x3c00);
+    EXPECT_EQ(kp::Half(1.0f + 3.0f / 2048).bits, 0x3c02);
+
+    for (float value : { 0.0f, 0.25f, -3.5f, 1024.0f, 6.103515625e-5f }) {
+        EXPECT_EQ((float)kp::Half(value), value);
+    }
+}
+
+TEST(TestTensor, ViewsAliasParentMemory)
+{
+    kp::Manager mgr;
+
+    // Chunks of 1024 bytes satisfy the storage buffer offset alignment
+    uint32_t chunkSize = 256;
+    std::vector<float> data(chunkSize * 2);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = i;
+    }
+
+    std::shared_ptr<kp::TensorT<float>> parent = mgr.tensor(data);
+    std::shared_ptr<kp::TensorT<float>> viewA =
+      mgr.tensorView(parent, 0, chunkSize);
+    std::shared_ptr<kp::TensorT<float>> viewB =
+      mgr.tensorView(parent, chunkSize, chunkSize);
+    std::shared_ptr<kp::TensorT<float>> output =
+      mgr.tensor(std::vector<float>(chunkSize, 0));
+
+    EXPECT_TRUE(viewB->isView());
+    EXPECT_FALSE(parent->isView());
+    EXPECT_EQ(viewB->size(), chunkSize);
+    EXPECT_EQ(viewB->bufferOffset(), chunkSize * sizeof(float));
+    EXPECT_EQ(viewB->data(), parent->data() + chunkSize);
+
+    std::vector<std::shared_ptr<kp::Tensor>> params = { viewA, viewB, output };
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ parent })
+      ->record<kp::OpMult>(params, mgr.algorithm())
+      ->record<kp::OpTensorCopy>({ output, viewA })
+      ->record<kp::OpTensorSyncLocal>({ parent })
+      ->eval();
+
+    for (uint32_t i = 0; i < chunkSize; i++) {
+        EXPECT_EQ((*parent)[i], data[i] * data[chunkSize + i]);
+        EXPECT_EQ((*parent)[chunkSize + i], data[chunkSize + i]);
+    }
+
+    EXPECT_ANY_THROW(mgr.tensorView(parent, chunkSize, chunkSize + 1));
+}
+
+TEST(TestTensor, ViewsPinParentMemory)
+{
+    kp::Manager mgr;
+
+    std::vector<float> data(512, 1);
+    std::shared_ptr<kp::TensorT<float>> parent = mgr.tensor(data);
+    std::shared_ptr<kp::TensorT<float>> view = mgr.tensorView(parent, 0, 256);
+
+    // Growing the parent would free the memory the view aliases
+    EXPECT_ANY_THROW(parent->reserve(1024));
+    std::vector<float> larger(1024, 2);
+    EXPECT_ANY_THROW(
+      parent->rebuild(larger.data(), larger.size(), sizeof(float)));
+
+    std::vector<float> smaller(256, 3);
+    parent->rebuild(smaller.data(), smaller.size(), sizeof(float));
+    EXPECT_EQ(view->vector(), smaller);
+
+    parent->destroy();
+    EXPECT_FALSE(view->isView());
+    EXPECT_FALSE(view->isInit());
+}
+
+TEST(TestTensor, ImportedHostMemory)
+{
+    kp::Manager mgr(0, {}, { VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME });
+
+    // A page of floats page aligned, as required by most implementations
+    uint32_t pageElements = 1024;
+    std::vector<float> storage(pageElements * 3);
+    float* data = (float*)(((uintptr_t)storage.data() + 4095) & ~(uintptr_t)4095);
+    for (uint32_t i = 0; i < pageElements; i++) {
+        data[i] = i;
+    }
+
+    std::shared_ptr<kp::Tensor> tensorA =
+      mgr.tensor(data,
+                 pageElements,
+                 sizeof(float),
+                 kp::Tensor::TensorDataTypes::eFloat,
+                 kp::Tensor::TensorTypes::eHost,
+                 kp::Tensor::HostMemoryTypes::eImported);
+    std::shared_ptr<kp::TensorT<float>> tensorB =
+      mgr.tensor(std::vector<float>(pageElements, 0));
+
+    // Devices without the extension fall back to copying the data
+    if (tensorA->isHostMemoryImported()) {
+        EXPECT_EQ(tensorA->rawData(), data);
+    }
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorA })
+      ->record<kp::OpTensorCopy>({ tensorA, tensorB })
+      ->record<kp::OpTensorSyncLocal>({ tensorB })
+      ->eval();
+
+    EXPECT_EQ(tensorB->vector(),
+              std::vector<float>(data, data + pageElements));
+}
+
+TEST(TestTensor, RebuildWithinCapacity)
+{
+    kp::Manager mgr;
+
+    std::string shader(R"(
+        #version 450
+        layout (local_size_x = 1) in;
+        layout(set = 0, binding = 0) buffer buf_in { float in_a[]; };
+        layout(set = 0, binding = 1) buffer buf_out { float out_a[]; };
+        void main() {
+            uint index = gl_GlobalInvocationID.x;
+            out_a[index] = in_a[index] + float(in_a.length());
+        }
+    )");
+
+    std::shared_ptr<kp::TensorT<float>> tensorIn =
+      mgr.tensor({ 1, 2, 3, 4 });
+    std::shared_ptr<kp::TensorT<float>> tensorOut =
+      mgr.tensor({ 0, 0, 0, 0 });
+    std::vector<std::shared_ptr<kp::Tensor>> params = { tensorIn, tensorOut };
+
+    std::shared_ptr<kp::Algorithm> algo =
+      mgr.algorithm(params, compileSource(shader), kp::Workgroup({ 2, 1, 1 }));
+
+    EXPECT_EQ(tensorIn->capacity(), 4);
+
+    // Shrinking keeps the buffers and only updates the size and data
+    void* rawData = tensorIn->rawData();
+    uint64_t generation = tensorIn->generation();
+    std::vector<float> smaller{ 5, 6 };
+    for (const std::shared_ptr<kp::Tensor>& tensor : params) {
+        tensor->rebuild(smaller.data(), smaller.size(), sizeof(float));
+    }
+    EXPECT_EQ(tensorIn->size(), 2);
+    EXPECT_EQ(tensorIn->capacity(), 4);
+    EXPECT_EQ(tensorIn->rawData(), rawData);
+    EXPECT_NE(tensorIn->generation(), generation);
+
+    // The runtime array length shows the descriptors were refreshed
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensorIn })
+      ->record<kp::OpAlgoDispatch>(algo)
+      ->record<kp::OpTensorSyncLocal>({ tensorOut })
+      ->eval();
+
+    EXPECT_EQ(tensorOut->vector(), std::vector<float>({ 7, 8 }));
+
+    // Growing beyond the capacity reallocates the buffers
+    std::vector<float> larger(8, 3);
+    tensorIn->rebuild(larger.data(), larger.size(), sizeof(float));
+    EXPECT_EQ(tensorIn->size(), 8);
+    EXPECT_EQ(tensorIn->capacity(), 8);
+    EXPECT_EQ(tensorIn->vector(), larger);
+
+    // Reserving keeps the host data and size
+    tensorOut->reserve(16);
+    EXPECT_EQ(tensorOut->size(), 2);
+    EXPECT_EQ(tensorOut->capacity(), 16);
+    EXPECT_EQ(tensorOut->vector(), std::vector<float>({ 7, 8 }));
+}
+
+TEST(TestTensor, RebuildRecordsSequencesAgain)
+{
+    kp::Manager mgr;
+
+    std::string shader(R"(
+        #version 450
+        layout (local_size_x = 1) in;
+        layout(set = 0, binding = 0) buffer buf_in { float in_a[]; };
+        layout(set = 0, binding = 1) buffer buf_out { float out_a[]; };
+        void main() {
+            uint index = gl_GlobalInvocationID.x;
+            out_a[index] = in_a[index] + float(in_a.length());
+        }
+    )");
+
+    std::shared_ptr<kp::TensorT<float>> tensorIn =
+      mgr.tensor({ 1, 2, 3, 4 });
+    std::shared_ptr<kp::TensorT<float>> tensorOut =
+      mgr.tensor({ 0, 0, 0, 0 });
+
+    std::shared_ptr<kp::Algorithm> algo = mgr.algorithm(
+      { tensorIn, tensorOut }, compileSource(shader), kp::Workgroup({ 2 }));
+
+    std::shared_ptr<kp::Sequence> seqA = mgr.sequence();
+    seqA->record<kp::OpTensorSyncDevice>({ tensorIn, tensorOut })
+      ->record<kp::OpAlgoDispatch>(algo)
+      ->record<kp::OpTensorSyncLocal>({ tensorOut });
+    std::shared_ptr<kp::Sequence> seqB = mgr.sequence();
+    seqB->record<kp::OpAlgoDispatch>(algo);
+
+    seqA->eval();
+    EXPECT_EQ(tensorOut->vector(), std::vector<float>({ 5, 6, 0, 0 }));
+
+    // Both sequences recorded the descriptor set that the next recording
+    // of the algorithm rewrites, and record themselves again when they are
+    // next submitted
+    std::vector<float> smaller{ 5, 6 };
+    tensorIn->rebuild(smaller.data(), smaller.size(), sizeof(float));
+    EXPECT_FALSE(seqA->isRunning());
+    EXPECT_FALSE(seqB->isRunning());
+
+    seqA->eval();
+    EXPECT_EQ(tensorOut->vector(), std::vector<float>({ 7, 8, 0, 0 }));
+
+    mgr.sequence()->eval<kp::OpTensorFill>({ tensorOut });
+    seqB->eval();
+    mgr.sequence()->eval<kp::OpTensorSyncLocal>({ tensorOut });
+    EXPECT_EQ(tensorOut->vector(), std::vector<float>({ 7, 8, 0, 0 }));
+}
+
+TEST(TestTensor, ImageStorageAndCopies)
+{
+    kp::Manager mgr;
+
+    std::string shader(R"(
+        #version 450
+        layout (local_size_x = 1, local_size_y = 1) in;
+        layout(set = 0, binding = 0, r32f) uniform image2D img;
+        void main() {
+            ivec2 texel = ivec2(gl_GlobalInvocationID.xy);
+            vec4 value = imageLoad(img, texel);
+            imageStore(img, texel, value * 2.0);
+        }
+    )");
+
+    std::vector<float> data{ 1, 2, 3, 4, 5, 6 };
+    std::shared_ptr<kp::Tensor> image = mgr.image(
+      data.data(), 3, 2, 1, kp::Tensor::TensorDataTypes::eFloat);
+
+    EXPECT_EQ(image->tensorType(), kp::Tensor::TensorTypes::eImage);
+    EXPECT_EQ(image->descriptorType(), vk::DescriptorType::eStorageImage);
+    EXPECT_EQ(image->imageFormat(), vk::Format::eR32Sfloat);
+    EXPECT_EQ(image->imageExtent(), vk::Extent3D(3, 2, 1));
+    EXPECT_EQ(image->size(), 6);
+    EXPECT_TRUE(image->image());
+    EXPECT_TRUE(image->imageView());
+
+    std::shared_ptr<kp::Algorithm> algo = mgr.algorithm(
+      { image }, compileSource(shader), kp::Workgroup({ 3, 2, 1 }));
+
+    // The result is also copied into a buffer tensor with tightly packed rows
+    std::shared_ptr<kp::TensorT<float>> tensorOut =
+      mgr.tensor(std::vector<float>(6, 0));
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ image })
+      ->record<kp::OpAlgoDispatch>(algo)
+      ->record<kp::OpTensorCopy>({ image, tensorOut })
+      ->record<kp::OpTensorSyncLocal>({ image, tensorOut })
+      ->eval();
+
+    std::vector<float> expected{ 2, 4, 6, 8, 10, 12 };
+    EXPECT_EQ(image->vector<float>(), expected);
+    EXPECT_EQ(tensorOut->vector(), expected);
+
+    // Fills clear every channel, and the extent cannot change
+    mgr.sequence()
+      ->record<kp::OpTensorFill>({ image }, 0)
+      ->record<kp::OpTensorSyncLocal>({ image })
+      ->eval();
+    EXPECT_EQ(image->vector<float>(), std::vector<float>(6, 0));
+
+    EXPECT_THROW(image->rebuild(data.data(), 4, sizeof(float)),
+                 std::runtime_error);
+    EXPECT_THROW(
+      kp::Tensor::imageFormat(kp::Tensor::TensorDataTypes::eFloat, 3),
+      std::runtime_error);
+}
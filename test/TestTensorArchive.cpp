@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+
+#include "kompute/Kompute.hpp"
+
+TEST(TestTensorArchive, WritesAndLoadsTensors)
+{
+    std::string path = "test_tensor_archive.kpta";
+
+    std::shared_ptr<kp::Manager> mgr = std::make_shared<kp::Manager>();
+
+    std::shared_ptr<kp::TensorT<float>> weight =
+      mgr->tensor({ 1, 2, 3, 4, 5, 6 });
+    std::shared_ptr<kp::TensorT<uint32_t>> indices =
+      mgr->tensorT<uint32_t>({ 7, 8, 9 });
+
+    kp::TensorArchive::write(
+      path, { "weight", "indices" }, { weight, indices }, { { 2, 3 }, { 3 } });
+
+    kp::TensorArchive archive(path);
+    ASSERT_EQ(archive.entries().size(), 2);
+
+    kp::TensorArchive::Entry entry;
+    EXPECT_FALSE(archive.find("bias", entry));
+    ASSERT_TRUE(archive.find("weight", entry));
+    EXPECT_EQ(entry.dataType, kp::Tensor::TensorDataTypes::eFloat);
+    EXPECT_EQ(entry.shape, std::vector<uint64_t>({ 2, 3 }));
+    EXPECT_EQ(entry.size, 6 * sizeof(float));
+    EXPECT_EQ(entry.offset % KOMPUTE_TENSOR_ARCHIVE_ALIGNMENT, 0);
+    EXPECT_EQ(((const float*)archive.data(entry))[5], 6);
+
+    // The tensors are uploaded on load, so they are checked after zeroing
+    // their host data and syncing them back
+    std::map<std::string, std::shared_ptr<kp::Tensor>> tensors =
+      archive.load(mgr);
+    ASSERT_EQ(tensors.size(), 2);
+    EXPECT_EQ(tensors["weight"]->name(), "weight");
+    EXPECT_EQ(tensors["indices"]->dataType(),
+              kp::Tensor::TensorDataTypes::eUnsignedInt);
+    EXPECT_EQ(tensors["indices"]->vector<uint32_t>(),
+              std::vector<uint32_t>({ 7, 8, 9 }));
+
+    std::vector<float> zeros(6, 0);
+    tensors["weight"]->setRawData(zeros.data());
+    mgr->sequence()->eval<kp::OpTensorSyncLocal>({ tensors["weight"] });
+    EXPECT_EQ(tensors["weight"]->vector<float>(),
+              std::vector<float>({ 1, 2, 3, 4, 5, 6 }));
+
+    // Loading a subset creates host tensors without any transfer
+    std::map<std::string, std::shared_ptr<kp::Tensor>> hostTensors =
+      archive.load(mgr, kp::Tensor::TensorTypes::eHost,
+                   kp::Tensor::HostMemoryTypes::eCoherent, { "indices" });
+    ASSERT_EQ(hostTensors.size(), 1);
+    EXPECT_EQ(hostTensors["indices"]->tensorType(),
+              kp::Tensor::TensorTypes::eHost);
+    EXPECT_EQ(hostTensors["indices"]->vector<uint32_t>(),
+              std::vector<uint32_t>({ 7, 8, 9 }));
+
+    EXPECT_THROW(archive.load(mgr, kp::Tensor::TensorTypes::eDevice,
+                              kp::Tensor::HostMemoryTypes::eCoherent,
+                              { "bias" }),
+                 std::runtime_error);
+
+    // Loaded tensors do not depend on the mapping of the archive
+    archive.close();
+    EXPECT_FALSE(archive.isOpen());
+    EXPECT_THROW(archive.data(entry), std::runtime_error);
+    EXPECT_EQ(tensors["indices"]->vector<uint32_t>(),
+              std::vector<uint32_t>({ 7, 8, 9 }));
+
+    std::remove(path.c_str());
+}
+
+TEST(TestTensorArchive, RejectsInvalidArchives)
+{
+    std::string path = "test_tensor_archive_invalid.kpta";
+
+    EXPECT_THROW(kp::TensorArchive("test_tensor_archive_missing.kpta"),
+                 std::runtime_error);
+
+    FILE* file = fopen(path.c_str(), "wb");
+    fputs("not an archive", file);
+    fclose(file);
+    EXPECT_THROW(kp::TensorArchive archive(path), std::runtime_error);
+
+    std::vector<float> data{ 1, 2 };
+    kp::TensorArchive::Entry entry;
+    entry.name = "a";
+    entry.dataType = kp::Tensor::TensorDataTypes::eFloat;
+    entry.shape = { 2 };
+    EXPECT_THROW(kp::TensorArchive::write(
+                   path, { entry, entry }, { data.data(), data.data() }),
+                 std::runtime_error);
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include "kompute/Kompute.hpp"
+
+#include "kompute_test/Shader.hpp"
+
+TEST(TestTracer, RecordsNothingWhenDisabled)
+{
+    kp::Tracer::start();
+    kp::Tracer::stop();
+    EXPECT_FALSE(kp::Tracer::isEnabled());
+
+    kp::Manager mgr;
+    std::shared_ptr<kp::Tensor> tensorA = mgr.tensor({ 0, 0, 0 });
+    mgr.sequence()->eval<kp::OpTensorSyncDevice>({ tensorA });
+
+    EXPECT_EQ(kp::Tracer::eventCount(), 0);
+}
+
+TEST(TestTracer, RecordsCpuAndGpuSpans)
+{
+    kp::Manager mgr;
+
+    std::string shader(R"(
+      #version 450
+      layout (local_size_x = 1) in;
+      layout(set = 0, binding = 0) buffer a { float pa[]; };
+      void main() {
+          uint index = gl_GlobalInvocationID.x;
+          pa[index] = pa[index] + 1;
+      })");
+
+    std::vector<uint32_t> spirv = compileSource(shader);
+
+    kp::Tracer::start();
+    EXPECT_TRUE(kp::Tracer::isEnabled());
+
+    std::shared_ptr<kp::Tensor> tensorA = mgr.tensor({ 0, 0, 0 });
+    tensorA->rebuild(std::vector<float>({ 1, 2, 3 }).data(),
+                     3,
+                     sizeof(float));
+
+    auto seq = mgr.sequence(0, 10);
+    seq->record<kp::OpTensorSyncDevice>({ tensorA })
+      ->record(std::make_shared<kp::OpAlgoDispatch>(
+                 mgr.algorithm({ tensorA }, spirv)),
+               "increment")
+      ->record<kp::OpTensorSyncLocal>({ tensorA })
+      ->eval();
+
+    kp::Tracer::stop();
+
+    EXPECT_EQ(tensorA->vector<float>(), std::vector<float>({ 2, 3, 4 }));
+
+    // The record, evalAsync, evalAwait and rebuild spans, and a span for
+    // each of the three operations
+    EXPECT_GE(kp::Tracer::eventCount(), 9);
+
+    std::string trace = kp::Tracer::chromeTrace();
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.find("\"Sequence::record\""), std::string::npos);
+    EXPECT_NE(trace.find("\"Sequence::evalAwait\""), std::string::npos);
+    EXPECT_NE(trace.find("\"Tensor::rebuild\""), std::string::npos);
+    EXPECT_NE(trace.find("\"increment\""), std::string::npos);
+    EXPECT_NE(trace.find("\"OpTensorSyncLocal\""), std::string::npos);
+
+    // The events are kept until the next start
+    uint64_t eventCount = kp::Tracer::eventCount();
+    mgr.sequence()->eval<kp::OpTensorSyncDevice>({ tensorA });
+    EXPECT_EQ(kp::Tracer::eventCount(), eventCount);
+}
+
+TEST(TestTracer, RecordsGpuSpansWithCalibratedTimestamps)
+{
+    // Spans are calibrated if the device supports the extension and the
+    // monotonic time domain, and aligned to the fence time otherwise
+    kp::Manager mgr(0, {}, { VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME });
+
+    std::shared_ptr<kp::Tensor> tensorA = mgr.tensor({ 0, 0, 0 });
+
+    kp::Tracer::start();
+    std::vector<std::shared_ptr<kp::Tensor>> tensors = { tensorA };
+    mgr.sequence(0, 10)
+      ->record(std::make_shared<kp::OpTensorSyncDevice>(tensors), "upload")
+      ->eval();
+    kp::Tracer::stop();
+
+    EXPECT_NE(kp::Tracer::chromeTrace().find("\"upload\""), std::string::npos);
+}
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+
+#include "kompute/Kompute.hpp"
+
+#include "kompute_test/Shader.hpp"
+
+TEST(TestTuner, TunesAndPersistsChoice)
+{
+    std::string path = "test_tuner_database.tsv";
+    std::remove(path.c_str());
+
+    std::shared_ptr<kp::Manager> mgr = std::make_shared<kp::Manager>();
+
+    std::shared_ptr<kp::TensorT<float>> tensorA =
+      mgr->tensor(std::vector<float>(256, 0));
+
+    std::string shader(R"(
+      #version 450
+      layout (local_size_x_id = 0) in;
+      layout(set = 0, binding = 0) buffer a { float pa[]; };
+      void main() {
+          uint index = gl_GlobalInvocationID.x;
+          pa[index] = float(index);
+      })");
+
+    std::shared_ptr<kp::Algorithm> algorithm =
+      mgr->algorithm({ tensorA }, compileSource(shader));
+
+    std::vector<kp::Tuner::Candidate> candidates = {
+        kp::Tuner::candidate<uint32_t>({ 32, 1, 1 }, { 8 }),
+        kp::Tuner::candidate<uint32_t>({ 4, 1, 1 }, { 64 }),
+        kp::Tuner::candidate<uint32_t>({ 1, 1, 1 }, { 256 }),
+        // Exceeds the workgroup count of any device, so it is skipped
+        kp::Tuner::candidate<uint32_t>({ UINT32_MAX, 1, 1 }, { 1 }),
+    };
+
+    kp::Tuner::Result result;
+    {
+        kp::Tuner tuner(mgr, path, 1, 3);
+        EXPECT_EQ(tuner.size(), 0);
+        EXPECT_FALSE(tuner.find("fill", { 256 }, result));
+
+        result = tuner.tune(algorithm, "fill", { 256 }, candidates);
+        EXPECT_FALSE(result.cached);
+        EXPECT_GT(result.medianNs, 0);
+        EXPECT_NE(result.candidate.workgroup[0], UINT32_MAX);
+        EXPECT_EQ(algorithm->getWorkgroup(), result.candidate.workgroup);
+        EXPECT_EQ(tuner.size(), 1);
+    }
+
+    // The algorithm is left built with the choice
+    mgr->sequence()
+      ->record<kp::OpAlgoDispatch>(algorithm)
+      ->record<kp::OpTensorSyncLocal>({ tensorA })
+      ->eval();
+    EXPECT_EQ(tensorA->data()[255], 255);
+
+    // A tuner created later loads the choice without timing the candidates
+    kp::Tuner tuner(mgr, path);
+    EXPECT_EQ(tuner.size(), 1);
+
+    kp::Tuner::Result cached = tuner.tune(algorithm, "fill", { 256 }, {});
+    EXPECT_TRUE(cached.cached);
+    EXPECT_EQ(cached.candidate.workgroup, result.candidate.workgroup);
+    EXPECT_EQ(cached.candidate.specializationConstants,
+              result.candidate.specializationConstants);
+    EXPECT_EQ(cached.medianNs, result.medianNs);
+
+    // Other shapes have no choice yet
+    EXPECT_THROW(tuner.tune(algorithm, "fill", { 128 }, {}),
+                 std::runtime_error);
+
+    std::remove(path.c_str());
+}
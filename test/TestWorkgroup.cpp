@@ -4,6 +4,7 @@
 
 #include "kompute/Kompute.hpp"
 
+#include "kompute_test/Shader.hpp"
 #include "kompute_test/shaders/shadertest_workgroup.hpp"
 
 TEST(TestWorkgroup, TestSimpleWorkgroup)
@@ -67,3 +68,67 @@ TEST(TestWorkgroup, TestSimpleWorkgroup)
         }
     }
 }
+
+TEST(TestWorkgroup, TestAutomaticLocalSize)
+{
+    kp::Manager mgr;
+
+    // A size which is not a multiple of the local size leaves a partial tail
+    uint32_t size = 1000;
+    std::shared_ptr<kp::TensorT<uint32_t>> tensor =
+      mgr.tensorT<uint32_t>(std::vector<uint32_t>(size));
+
+    std::string shader(R"(
+        #version 450
+
+        layout (constant_id = 0) const uint OFFSET = 0;
+
+        layout (local_size_x_id = 1) in;
+
+        layout(set = 0, binding = 0) buffer buf { uint values[]; };
+
+        void main() {
+            uint index = gl_GlobalInvocationID.x;
+            if (index >= uint(values.length())) {
+                return;
+            }
+            values[index] = index + OFFSET;
+        }
+    )");
+
+    std::shared_ptr<kp::Algorithm> algorithm =
+      mgr.algorithm<uint32_t, float>({ tensor },
+                                     compileSource(shader),
+                                     kp::Workgroup(),
+                                     { 1 },
+                                     {});
+
+    uint32_t localSize = mgr.getDefaultLocalSize();
+    EXPECT_GT(localSize, 1);
+    EXPECT_EQ(algorithm->getLocalSizeX(), localSize);
+    EXPECT_EQ(algorithm->getWorkgroup(),
+              kp::Workgroup({ (size + localSize - 1) / localSize, 1, 1 }));
+
+    mgr.sequence()
+      ->record<kp::OpTensorSyncDevice>({ tensor })
+      ->record<kp::OpAlgoDispatch>(algorithm)
+      ->record<kp::OpTensorSyncLocal>({ tensor })
+      ->eval();
+
+    std::vector<uint32_t> expected(size);
+    for (uint32_t i = 0; i < size; i++) {
+        expected[i] = i + 1;
+    }
+    EXPECT_EQ(tensor->vector(), expected);
+
+    // A local size provided as a specialization constant is kept
+    std::shared_ptr<kp::Algorithm> algorithmExplicit =
+      mgr.algorithm<uint32_t, float>({ tensor },
+                                     compileSource(shader),
+                                     kp::Workgroup(),
+                                     { 1, 1 },
+                                     {});
+    EXPECT_EQ(algorithmExplicit->getLocalSizeX(), 0);
+    EXPECT_EQ(algorithmExplicit->getWorkgroup(),
+              kp::Workgroup({ size, 1, 1 }));
+}
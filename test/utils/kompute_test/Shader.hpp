@@ -6,11 +6,14 @@
 #include <vector>
 #include <fstream>
 
+#include "kompute/Shader.hpp"
+
 /**
  * Compile a single glslang source from string value. This is only meant
- * to be used for testing as it's non threadsafe, and it had to be removed
- * from the glslang dependency and now can only run the CLI directly due to 
- * license issues: see https://github.com/KomputeProject/kompute/pull/235
+ * to be used for testing, and uses kp::Shader::compile when Kompute is built
+ * with the shader compiler. Otherwise it runs the CLI directly, which is non
+ * threadsafe, as glslang is an optional dependency due to license issues:
+ * see https://github.com/KomputeProject/kompute/pull/235
  *
  * @param source An individual raw glsl shader in string format
  * @return The compiled SPIR-V binary in unsigned int32 format
@@ -20,6 +23,10 @@ std::vector<uint32_t>
 compileSource(
   const std::string& source)
 {
+    if (kp::Shader::compilerAvailable()) {
+        return kp::Shader::compile(source);
+    }
+
     std::ofstream fileOut("tmp_kp_shader.comp");
 	fileOut << source;
 	fileOut.close();
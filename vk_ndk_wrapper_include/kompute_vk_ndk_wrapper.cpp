@@ -369,6 +369,10 @@ int InitVulkan(void) {
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
     vkCreateAndroidSurfaceKHR = reinterpret_cast<PFN_vkCreateAndroidSurfaceKHR>(dlsym(libvulkan, "vkCreateAndroidSurfaceKHR"));
+    vkGetAndroidHardwareBufferPropertiesANDROID = reinterpret_cast<PFN_vkGetAndroidHardwareBufferPropertiesANDROID>(
+        dlsym(libvulkan, "vkGetAndroidHardwareBufferPropertiesANDROID"));
+    vkGetMemoryAndroidHardwareBufferANDROID = reinterpret_cast<PFN_vkGetMemoryAndroidHardwareBufferANDROID>(
+        dlsym(libvulkan, "vkGetMemoryAndroidHardwareBufferANDROID"));
 #endif
 
 #ifdef VK_USE_PLATFORM_WAYLAND_KHR